@@ -10,7 +10,7 @@ TARGET = eagle-import
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml network
+QT += core widgets xml network concurrent
 
 LIBS += \
     -L$${DESTDIR} \
@@ -18,7 +18,6 @@ LIBS += \
     -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
     -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
     -lparseagle \
-    -lsexpresso \
     -lclipper \
     -lquazip -lz \
 
@@ -33,7 +32,6 @@ DEPENDPATH += \
     ../../libs/librepcb/library \
     ../../libs/librepcb/common \
     ../../libs/parseagle \
-    ../../libs/sexpresso \
     ../../libs/clipper \
 
 PRE_TARGETDEPS += \
@@ -41,17 +39,14 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcblibrary.a \
     $${DESTDIR}/liblibrepcbcommon.a \
     $${DESTDIR}/libparseagle.a \
-    $${DESTDIR}/libsexpresso.a \
     $${DESTDIR}/libclipper.a \
 
 SOURCES += \
     main.cpp \
     mainwindow.cpp \
-    polygonsimplifier.cpp \
 
 HEADERS += \
     mainwindow.h \
-    polygonsimplifier.h \
 
 FORMS += \
     mainwindow.ui \
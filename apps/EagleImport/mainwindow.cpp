@@ -1,6 +1,5 @@
 #include "mainwindow.h"
 
-#include "polygonsimplifier.h"
 #include "ui_mainwindow.h"
 
 #include <librepcb/common/fileio/fileutils.h>
@@ -10,6 +9,7 @@
 #include <librepcb/eagleimport/deviceconverter.h>
 #include <librepcb/eagleimport/devicesetconverter.h>
 #include <librepcb/eagleimport/packageconverter.h>
+#include <librepcb/eagleimport/polygonsimplifier.h>
 #include <librepcb/eagleimport/symbolconverter.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/dev/device.h>
@@ -18,6 +18,7 @@
 #include <librepcb/library/sym/symbol.h>
 #include <parseagle/library.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -116,8 +117,7 @@ void MainWindow::convertFile(ConvertFileType_t         type,
       case ConvertFileType_t::Symbols_to_Symbols:
         ui->pbarElements->setValue(0);
         ui->pbarElements->setMaximum(library.getSymbols().count());
-        foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
-          bool success = convertSymbol(db, symbol);
+        foreach (bool success, convertSymbols(db, library.getSymbols())) {
           mReadedElementsCount++;
           if (success) mConvertedElementsCount++;
           ui->pbarElements->setValue(ui->pbarElements->value() + 1);
@@ -129,8 +129,7 @@ void MainWindow::convertFile(ConvertFileType_t         type,
       case ConvertFileType_t::Packages_to_PackagesAndDevices:
         ui->pbarElements->setValue(0);
         ui->pbarElements->setMaximum(library.getPackages().count());
-        foreach (const parseagle::Package& package, library.getPackages()) {
-          bool success = convertPackage(db, package);
+        foreach (bool success, convertPackages(db, library.getPackages())) {
           mReadedElementsCount++;
           if (success) mConvertedElementsCount++;
           ui->pbarElements->setValue(ui->pbarElements->value() + 1);
@@ -162,58 +161,122 @@ void MainWindow::convertFile(ConvertFileType_t         type,
   }
 }
 
-bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
-                               const parseagle::Symbol&  symbol) {
-  try {
-    // create symbol
-    eagleimport::SymbolConverter converter(symbol, db);
-    std::unique_ptr<Symbol>      newSymbol = converter.generate();
-
-    // convert line rects to polygon rects
-    PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
-    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+QVector<bool> MainWindow::convertSymbols(
+    eagleimport::ConverterDb& db, const QList<parseagle::Symbol>& symbols) {
+  struct Job {
+    const parseagle::Symbol* input;
+    std::shared_ptr<Symbol>  output;
+    QString                  error;
+  };
+
+  // Symbols are independent of each other, so create them in parallel. Only
+  // saving them is done sequentially since they share the output directory.
+  QVector<Job> jobs;
+  jobs.reserve(symbols.count());
+  for (const parseagle::Symbol& symbol : symbols) {
+    jobs.append(Job{&symbol, nullptr, QString()});
+  }
+  QThread* mainThread = thread();
+  QtConcurrent::blockingMap(jobs, [&db, mainThread](Job& job) {
+    try {
+      // create symbol
+      eagleimport::SymbolConverter converter(*job.input, db);
+      std::shared_ptr<Symbol>      newSymbol = converter.generate();
+
+      // convert line rects to polygon rects
+      eagleimport::PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
+      polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+      newSymbol->moveToThread(mainThread);
+      job.output = newSymbol;
+    } catch (const std::exception& e) {
+      job.error = e.what();
+    }
+  });
 
-    // save symbol to file
+  // save symbols to files
+  QVector<bool> results;
+  try {
     std::shared_ptr<TransactionalFileSystem> fs =
         TransactionalFileSystem::openRW(
             FilePath(QString("%1/sym").arg(ui->output->text())));
     TransactionalDirectory dir(fs);
-    newSymbol->moveIntoParentDirectory(dir);
-    fs->save();
+    foreach (const Job& job, jobs) {
+      try {
+        if (!job.output) throw RuntimeError(__FILE__, __LINE__, job.error);
+        job.output->moveIntoParentDirectory(dir);
+        fs->save();
+        results.append(true);
+      } catch (const std::exception& e) {
+        addError(e.what());
+        results.append(false);
+      }
+    }
   } catch (const std::exception& e) {
     addError(e.what());
-    return false;
+    results.fill(false, jobs.count());
   }
-
-  return true;
+  return results;
 }
 
-bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
-                                const parseagle::Package& package) {
-  try {
-    // create package
-    eagleimport::PackageConverter converter(package, db);
-    std::unique_ptr<Package>      newPackage = converter.generate();
-
-    // convert line rects to polygon rects
-    Q_ASSERT(newPackage->getFootprints().count() == 1);
-    PolygonSimplifier<Footprint> polygonSimplifier(
-        *newPackage->getFootprints().first());
-    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+QVector<bool> MainWindow::convertPackages(
+    eagleimport::ConverterDb& db, const QList<parseagle::Package>& packages) {
+  struct Job {
+    const parseagle::Package* input;
+    std::shared_ptr<Package>  output;
+    QString                   error;
+  };
+
+  // Packages are independent of each other, so create them in parallel. Only
+  // saving them is done sequentially since they share the output directory.
+  QVector<Job> jobs;
+  jobs.reserve(packages.count());
+  for (const parseagle::Package& package : packages) {
+    jobs.append(Job{&package, nullptr, QString()});
+  }
+  QThread* mainThread = thread();
+  QtConcurrent::blockingMap(jobs, [&db, mainThread](Job& job) {
+    try {
+      // create package
+      eagleimport::PackageConverter converter(*job.input, db);
+      std::shared_ptr<Package>      newPackage = converter.generate();
+
+      // convert line rects to polygon rects
+      Q_ASSERT(newPackage->getFootprints().count() == 1);
+      eagleimport::PolygonSimplifier<Footprint> polygonSimplifier(
+          *newPackage->getFootprints().first());
+      polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+      newPackage->moveToThread(mainThread);
+      job.output = newPackage;
+    } catch (const std::exception& e) {
+      job.error = e.what();
+    }
+  });
 
-    // save package to file
+  // save packages to files
+  QVector<bool> results;
+  try {
     std::shared_ptr<TransactionalFileSystem> fs =
         TransactionalFileSystem::openRW(
             FilePath(QString("%1/pkg").arg(ui->output->text())));
     TransactionalDirectory dir(fs);
-    newPackage->moveIntoParentDirectory(dir);
-    fs->save();
+    foreach (const Job& job, jobs) {
+      try {
+        if (!job.output) throw RuntimeError(__FILE__, __LINE__, job.error);
+        job.output->moveIntoParentDirectory(dir);
+        fs->save();
+        results.append(true);
+      } catch (const std::exception& e) {
+        addError(e.what());
+        results.append(false);
+      }
+    }
   } catch (const std::exception& e) {
     addError(e.what());
-    return false;
+    results.fill(false, jobs.count());
   }
-
-  return true;
+  return results;
 }
 
 bool MainWindow::convertDevice(eagleimport::ConverterDb&   db,
@@ -58,10 +58,10 @@ private:
   void convertAllFiles(ConvertFileType_t type);
   void convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
                    const librepcb::FilePath& filepath);
-  bool convertSymbol(eagleimport::ConverterDb& db,
-                     const parseagle::Symbol&  symbol);
-  bool convertPackage(eagleimport::ConverterDb& db,
-                      const parseagle::Package& package);
+  QVector<bool> convertSymbols(eagleimport::ConverterDb&       db,
+                               const QList<parseagle::Symbol>& symbols);
+  QVector<bool> convertPackages(eagleimport::ConverterDb&        db,
+                                const QList<parseagle::Package>& packages);
   bool convertDevice(eagleimport::ConverterDb&   db,
                      const parseagle::DeviceSet& deviceSet);
 
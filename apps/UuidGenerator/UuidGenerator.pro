@@ -10,7 +10,7 @@ TARGET = uuid-generator
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets
+QT += core widgets concurrent
 
 LIBS += \
     -L$${DESTDIR} \
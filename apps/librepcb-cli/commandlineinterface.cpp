@@ -27,15 +27,35 @@
 #include <librepcb/common/debug.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/systeminfo.h>
+#include <librepcb/common/utils/performancecounters.h>
+#include <librepcb/common/utils/profiler.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/deviceconverter.h>
+#include <librepcb/eagleimport/devicesetconverter.h>
+#include <librepcb/eagleimport/packageconverter.h>
+#include <librepcb/eagleimport/polygonsimplifier.h>
+#include <librepcb/eagleimport/symbolconverter.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementcheckcache.h>
+#include <librepcb/library/msg/libraryelementcheckmessage.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardassemblyexport.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
 #include <librepcb/project/boards/boardfabricationoutputsettings.h>
 #include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/items/bi_base.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netsignal.h>
 #include <librepcb/project/erc/ercmsg.h>
 #include <librepcb/project/erc/ercmsglist.h>
 #include <librepcb/project/project.h>
+#include <librepcb/project/schematics/items/si_base.h>
+#include <parseagle/library.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
+#include <QtNetwork>
 
 #include <algorithm>
 
@@ -48,6 +68,17 @@ namespace cli {
 using namespace librepcb::library;
 using namespace librepcb::project;
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+// If set, print() and printErr() write into this buffer instead of the console
+thread_local CommandLineInterface::Output* CommandLineInterface::sOutput =
+    nullptr;
+
+// Name of the local socket used by "serve" if no name is specified
+const char* CommandLineInterface::sDefaultServer = "librepcb-cli";
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -61,6 +92,18 @@ CommandLineInterface::CommandLineInterface(const Application& app) noexcept
  ******************************************************************************/
 
 int CommandLineInterface::execute() noexcept {
+  return execute(mApp.arguments(), true);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+int CommandLineInterface::execute(const QStringList& arguments,
+                                  bool allowServer) const noexcept {
+  QElapsedTimer parseTimer;
+  parseTimer.start();
+
   QMap<QString, QPair<QString, QString>> commands = {
       {"open-project",
        {tr("Open a project to execute project-related tasks."),
@@ -68,6 +111,12 @@ int CommandLineInterface::execute() noexcept {
       {"open-library",
        {tr("Open a library to execute library-related tasks."),
         tr("open-library [command_options]")}},
+      {"import-eagle",
+       {tr("Convert Eagle libraries (*.lbr) to LibrePCB library elements."),
+        tr("import-eagle [command_options]")}},
+      {"serve",
+       {tr("Run a server which executes the commands of other CLI calls."),
+        tr("serve [command_options]")}},
   };
 
   // Add global options
@@ -77,6 +126,30 @@ int CommandLineInterface::execute() noexcept {
   const QCommandLineOption versionOption = parser.addVersionOption();
   QCommandLineOption       verboseOption("verbose", tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption serverOption(
+      "server",
+      tr("Don't execute the command in this process, but send it to the "
+         "server with the given name (see command 'serve') to avoid the "
+         "startup time."),
+      tr("name"));
+  parser.addOption(serverOption);
+  QCommandLineOption profileOption(
+      "profile",
+      tr("Print the durations of the executed operations, the peak memory "
+         "usage and the performance counters after executing the command."));
+  parser.addOption(profileOption);
+  QCommandLineOption profileJsonOption(
+      "profile-json",
+      tr("Like '--profile', but write the timing report as JSON to the given "
+         "file."),
+      tr("file"));
+  parser.addOption(profileJsonOption);
+  QCommandLineOption profileTraceOption(
+      "profile-trace",
+      tr("Write a trace of the executed operations to the given file. It can "
+         "be opened with chrome://tracing or https://ui.perfetto.dev."),
+      tr("file"));
+  parser.addOption(profileTraceOption);
   parser.addPositionalArgument("command", tr("The command to execute."));
 
   // Define options for "open-project"
@@ -85,6 +158,15 @@ int CommandLineInterface::execute() noexcept {
       tr("Run the electrical rule check, print all non-approved "
          "warnings/errors and "
          "report failure (exit code = 1) if there are non-approved messages."));
+  QCommandLineOption drcOption(
+      "drc",
+      tr("Run the design rule check of all boards (or of the boards given "
+         "with '--board'), print all copper clearance violations and report "
+         "failure (exit code = 1) if there are any."));
+  QCommandLineOption routingStatisticsOption(
+      "routing-statistics",
+      tr("Print the track length and via count of each routed net of all "
+         "boards (or of the boards given with '--board')."));
   QCommandLineOption exportSchematicsOption(
       "export-schematics",
       QString(tr("Export schematics to given file(s). Existing files will be "
@@ -96,32 +178,81 @@ int CommandLineInterface::execute() noexcept {
       tr("Export PCB fabrication data (Gerber/Excellon) according the "
          "fabrication "
          "output settings of boards. Existing files will be overwritten."));
+  QCommandLineOption verifyPcbFabricationDataOption(
+      "verify-pcb-fabrication-data",
+      tr("Generate the PCB fabrication data of boards both sequentially and "
+         "in parallel (without writing any files) and report failure "
+         "(exit code = 1) if the results are not identical."));
   QCommandLineOption pcbFabricationSettingsOption(
       "pcb-fabrication-settings",
       tr("Override PCB fabrication output settings by providing a *.lp file "
          "containing custom settings. If not set, the settings from the boards "
          "will be used instead."),
       tr("file"));
+  QCommandLineOption exportBomOption(
+      "export-bom",
+      tr("Export the bill of materials of boards as CSV to the given file. "
+         "Attributes of the board (e.g. '{{BOARD}}') can be used in the path. "
+         "Existing files will be overwritten."),
+      tr("file"));
+  QCommandLineOption exportPnpOption(
+      "export-pnp",
+      tr("Export the pick&place data (position, rotation and side of all "
+         "devices) of boards as CSV to the given file. Attributes of the board "
+         "(e.g. '{{BOARD}}') can be used in the path. Existing files will be "
+         "overwritten."),
+      tr("file"));
   QCommandLineOption boardOption("board",
-                                 tr("The name of the board(s) to export. Can "
+                                 tr("The name of the board(s) to process. Can "
                                     "be given multiple times. If not set, "
-                                    "all boards are exported."),
+                                    "all boards are processed."),
                                  tr("name"));
   QCommandLineOption saveOption(
       "save",
       tr("Save project before closing it (useful to upgrade file format)."));
+  QCommandLineOption projectListOption(
+      "project-list",
+      tr("Read the paths of additional projects to open from a text file "
+         "(one path per line, relative to the text file). All given projects "
+         "are processed one after another in the same process."),
+      tr("file"));
 
   // Define options for "open-library"
   QCommandLineOption libAllOption(
       "all", tr("Perform the selected action(s) on all elements contained in "
                 "the opened library."));
+  QCommandLineOption libCheckOption(
+      "check",
+      tr("Run the checks of the library (and contained elements if '--all' is "
+         "given), print all warnings/errors and report failure (exit code = "
+         "1) if there are any."));
   QCommandLineOption libSaveOption(
       "save", tr("Save library (and contained elements if '--all' is given) "
                  "before closing them (useful to upgrade file format)."));
+  QCommandLineOption libCheckCacheOption(
+      "check-cache",
+      tr("Store the check results of all elements in the given file and reuse "
+         "them for unmodified elements in later runs, which then don't need "
+         "to be checked again. The file is created if it doesn't exist."),
+      tr("file"));
+  QCommandLineOption libJsonReportOption(
+      "json-report",
+      tr("Write the results of all processed elements (including check "
+         "messages) as JSON to the given file, e.g. to be parsed by a CI."),
+      tr("file"));
+
+  // Define options for "import-eagle"
+  QCommandLineOption eagleUuidDbOption(
+      "uuid-db",
+      tr("INI file to look up and store the UUIDs of the converted elements. "
+         "Importing the same libraries again with the same file updates the "
+         "existing elements instead of creating new ones. If not set, all "
+         "elements get new random UUIDs."),
+      tr("file"));
 
   // First parse to get the supplied command (ignoring errors because the parser
   // does not yet know the command-dependent options).
-  parser.parse(mApp.arguments());
+  parser.parse(arguments);
 
   // Add command-dependent options
   QStringList positionalArgs = parser.positionalArguments();
@@ -134,14 +265,23 @@ int CommandLineInterface::execute() noexcept {
     parser.clearPositionalArguments();
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
-    parser.addPositionalArgument("project",
-                                 tr("Path to project file (*.lpp[z])."));
+    parser.addPositionalArgument(
+        "project",
+        tr("Path to project file (*.lpp[z]). Can be given multiple times to "
+           "process several projects."),
+        "[project...]");
     parser.addOption(ercOption);
+    parser.addOption(drcOption);
+    parser.addOption(routingStatisticsOption);
     parser.addOption(exportSchematicsOption);
     parser.addOption(exportPcbFabricationDataOption);
+    parser.addOption(verifyPcbFabricationDataOption);
     parser.addOption(pcbFabricationSettingsOption);
+    parser.addOption(exportBomOption);
+    parser.addOption(exportPnpOption);
     parser.addOption(boardOption);
     parser.addOption(saveOption);
+    parser.addOption(projectListOption);
   } else if (command == "open-library") {
     parser.clearPositionalArguments();
     parser.addPositionalArgument(command, commands[command].first,
@@ -149,7 +289,33 @@ int CommandLineInterface::execute() noexcept {
     parser.addPositionalArgument("library",
                                  tr("Path to library directory (*.lplib)."));
     parser.addOption(libAllOption);
+    parser.addOption(libCheckOption);
     parser.addOption(libSaveOption);
+    parser.addOption(libCheckCacheOption);
+    parser.addOption(libJsonReportOption);
+  } else if (command == "import-eagle") {
+    parser.clearPositionalArguments();
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument(
+        "output",
+        tr("Path to the output directory, e.g. a library (*.lplib). The "
+           "elements are written into its subdirectories 'sym', 'pkg', 'cmp' "
+           "and 'dev'."));
+    parser.addPositionalArgument(
+        "library",
+        tr("Path to Eagle library file (*.lbr). Can be given multiple times "
+           "to convert several libraries concurrently."),
+        "library...");
+    parser.addOption(eagleUuidDbOption);
+  } else if (command == "serve") {
+    parser.clearPositionalArguments();
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument(
+        "name",
+        QString(tr("Name of the server (default: '%1').")).arg(sDefaultServer),
+        "[name]");
   } else if (!command.isEmpty()) {
     printErr(QString(tr("Unknown command '%1'.")).arg(command), 2);
     print(parser.helpText(), 0);
@@ -157,12 +323,17 @@ int CommandLineInterface::execute() noexcept {
   }
 
   // Parse the actual command line arguments given by the user
-  if (!parser.parse(mApp.arguments())) {
+  if (!parser.parse(arguments)) {
     printErr(parser.errorText(), 2);
     print(parser.helpText(), 0);
     return 1;
   }
 
+  // --server (ignored within a server since it forwarded the command to us)
+  if (allowServer && parser.isSet(serverOption)) {
+    return sendToServer(parser.value(serverOption), arguments);
+  }
+
   // --version
   if (parser.isSet(versionOption)) {
     print(
@@ -192,36 +363,99 @@ int CommandLineInterface::execute() noexcept {
     Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
   }
 
+  // --profile / --profile-json / --profile-trace
+  bool profile = parser.isSet(profileOption) ||
+      parser.isSet(profileJsonOption) || parser.isSet(profileTraceOption);
+  if (profile) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    PerformanceCounters::reset();
+    PerformanceCounters::setEnabled(true);
+    Profiler::record("parse command line", parseTimer.nsecsElapsed());
+  }
+
   // Execute command
   bool cmdSuccess = false;
-  if (command == "open-project") {
-    if (positionalArgs.count() != 1) {
+  if (command == "serve") {
+    if (!allowServer) {
+      printErr(tr("Command 'serve' is not allowed within a server."));
+      return 1;
+    }
+    if (positionalArgs.count() > 1) {
       printErr(tr("Wrong argument count."), 2);
       print(parser.helpText(), 0);
       return 1;
     }
-    cmdSuccess = openProject(
-        positionalArgs.value(0),                       // project filepath
-        parser.isSet(ercOption),                       // run ERC
-        parser.values(exportSchematicsOption),         // export schematics
-        parser.isSet(exportPcbFabricationDataOption),  // export PCB fab. data
-        parser.value(pcbFabricationSettingsOption),    // PCB fab. settings
-        parser.values(boardOption),                    // boards
-        parser.isSet(saveOption)                       // save project
-    );
+    return serve(positionalArgs.value(0, sDefaultServer)) ? 0 : 1;
+  } else if (command == "open-project") {
+    QStringList projectFiles = positionalArgs;
+    if (parser.isSet(projectListOption)) {
+      QString listFile = parser.value(projectListOption);
+      if (!readProjectList(listFile, projectFiles)) {
+        return 1;
+      }
+    }
+    if (projectFiles.isEmpty()) {
+      printErr(tr("Wrong argument count."), 2);
+      print(parser.helpText(), 0);
+      return 1;
+    }
+    auto openProjectFunc = [&](const QString& projectFile) {
+      return openProject(
+          projectFile,                                   // project filepath
+          parser.isSet(ercOption),                       // run ERC
+          parser.isSet(drcOption),                       // run DRC
+          parser.isSet(routingStatisticsOption),         // routing stats
+          parser.values(exportSchematicsOption),         // export schematics
+          parser.isSet(exportPcbFabricationDataOption),  // export PCB data
+          parser.isSet(verifyPcbFabricationDataOption),  // verify PCB data
+          parser.value(pcbFabricationSettingsOption),    // PCB fab. settings
+          parser.value(exportBomOption),                 // export BOM
+          parser.value(exportPnpOption),                 // export pick&place
+          parser.values(boardOption),                    // boards
+          parser.isSet(saveOption)                       // save project
+      );
+    };
+    if (projectFiles.count() == 1) {
+      cmdSuccess = openProjectFunc(projectFiles.first());
+    } else {
+      cmdSuccess = processProjects(projectFiles, openProjectFunc);
+    }
   } else if (command == "open-library") {
     if (positionalArgs.count() != 1) {
       printErr(tr("Wrong argument count."), 2);
       print(parser.helpText(), 0);
       return 1;
     }
-    cmdSuccess = openLibrary(positionalArgs.value(0),     // library directory
-                             parser.isSet(libAllOption),  // all elements
-                             parser.isSet(libSaveOption)  // save
+    cmdSuccess = openLibrary(positionalArgs.value(0),            // library path
+                             parser.isSet(libAllOption),         // all elements
+                             parser.isSet(libCheckOption),       // run checks
+                             parser.isSet(libSaveOption),        // save
+                             parser.value(libCheckCacheOption),  // check cache
+                             parser.value(libJsonReportOption)   // JSON report
+    );
+  } else if (command == "import-eagle") {
+    if (positionalArgs.count() < 2) {
+      printErr(tr("Wrong argument count."), 2);
+      print(parser.helpText(), 0);
+      return 1;
+    }
+    cmdSuccess = importEagle(positionalArgs.first(),          // output dir
+                             positionalArgs.mid(1),           // libraries
+                             parser.value(eagleUuidDbOption)  // UUID database
     );
   } else {
     printErr(tr("Internal failure."));
   }
+  if (profile) {
+    Profiler::setEnabled(false);
+    PerformanceCounters::setEnabled(false);
+    if (!printProfile(parser.isSet(profileOption),
+                      parser.value(profileJsonOption),
+                      parser.value(profileTraceOption))) {
+      cmdSuccess = false;
+    }
+  }
   if (cmdSuccess) {
     print(tr("SUCCESS"));
     return 0;
@@ -231,19 +465,19 @@ int CommandLineInterface::execute() noexcept {
   }
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 bool CommandLineInterface::openProject(
-    const QString& projectFile, bool runErc,
-    const QStringList& exportSchematicsFiles, bool exportPcbFabricationData,
-    const QString& pcbFabricationSettingsPath, const QStringList& boards,
-    bool save) const noexcept {
+    const QString& projectFile, bool runErc, bool runDrc,
+    bool printRoutingStatistics, const QStringList& exportSchematicsFiles,
+    bool exportPcbFabricationData, bool verifyPcbFabricationData,
+    const QString& pcbFabricationSettingsPath, const QString& exportBomFile,
+    const QString& exportPnpFile, const QStringList& boards, bool save) const
+    noexcept {
   try {
     bool success = true;
 
     // Open project
+    Profiler::Scope openScope("project '%1': open", projectFile);
+
     FilePath projectFp(QFileInfo(projectFile).absoluteFilePath());
     print(QString(tr("Open project '%1'..."))
               .arg(prettyPath(projectFp, projectFile)));
@@ -262,15 +496,23 @@ bool CommandLineInterface::openProject(
       projectFs = TransactionalFileSystem::open(projectFp.getParentDir(), save);
       projectFileName = projectFp.getFilename();
     }
+    // Boards are only loaded when needed, unless they are required for the
+    // ERC or for saving (i.e. upgrading) the project. Since the CLI never
+    // displays boards, they don't need to create any graphics items.
+    bool    lazyBoards = (!runErc) && (!save);
+    bool    headless   = true;
     Project project(std::unique_ptr<TransactionalDirectory>(
                         new TransactionalDirectory(projectFs)),
-                    projectFileName);  // can throw
+                    projectFileName, lazyBoards, headless);  // can throw
+    openScope.stop();
 
     // ERC
     if (runErc) {
+      Profiler::Scope scope("project '%1': ERC", projectFile);
       print(tr("Run ERC..."));
       QStringList messages;
       int         approvedMsgCount = 0;
+      project.getErcMsgList().updateScheduled();  // no event loop running
       foreach (const ErcMsg* msg, project.getErcMsgList().getItems()) {
         if (!msg->isVisible()) continue;
         if (msg->isIgnored()) {
@@ -302,8 +544,57 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // Determine the boards to process
+    QList<Board*> boardList;
+    if (runDrc || printRoutingStatistics || exportPcbFabricationData ||
+        verifyPcbFabricationData || (!exportBomFile.isEmpty()) ||
+        (!exportPnpFile.isEmpty())) {
+      if (boards.isEmpty()) {
+        // export all boards
+        boardList = project.getBoards();
+      } else {
+        // export specified boards
+        foreach (const QString& boardName, boards) {
+          Board* board = project.getBoardByName(boardName);
+          if (board) {
+            boardList.append(board);
+          } else {
+            printErr(QString(tr("ERROR: No board with the name '%1' found."))
+                         .arg(boardName));
+            success = false;
+          }
+        }
+      }
+    }
+
+    // DRC
+    if (runDrc) {
+      print(tr("Run DRC..."));
+      foreach (Board* board, boardList) {
+        Profiler::Scope loadScope("board '%1': load", *board->getName());
+        board->load();  // can throw
+        loadScope.stop();
+        board->rebuildAllPlanesForFabrication();
+        const BoardDesignRuleCheck& drc = board->runDesignRuleCheck();
+        print("  " % QString(tr("Board '%1': %2 clearance violation(s)"))
+                         .arg(*board->getName())
+                         .arg(drc.getViolations().count()));
+        foreach (const BoardDesignRuleCheck::Violation& violation,
+                 drc.getViolations()) {
+          printErr(QString("    - [%1] %2: %3 (%4, %5)")
+                       .arg(tr("ERROR"), violation.layer, violation.message,
+                            violation.position.getX().toMmString(),
+                            violation.position.getY().toMmString()));
+        }
+        if (drc.getViolations().count() > 0) {
+          success = false;
+        }
+      }
+    }
+
     // Export schematics
     foreach (const QString& destStr, exportSchematicsFiles) {
+      Profiler::Scope scope("project '%1': export '%2'", projectFile, destStr);
       print(QString(tr("Export schematics to '%1'...")).arg(destStr));
       QString suffix = destStr.split('.').last().toLower();
       if (suffix == "pdf") {
@@ -322,26 +613,38 @@ bool CommandLineInterface::openProject(
       }
     }
 
-    // Export PCB fabrication data
-    if (exportPcbFabricationData) {
-      print(tr("Export PCB fabrication data..."));
-      QList<Board*> boardList;
-      if (boards.isEmpty()) {
-        // export all boards
-        boardList = project.getBoards();
-      } else {
-        // export specified boards
-        foreach (const QString& boardName, boards) {
-          Board* board = project.getBoardByName(boardName);
-          if (board) {
-            boardList.append(board);
-          } else {
-            printErr(QString(tr("ERROR: No board with the name '%1' found."))
-                         .arg(boardName));
-            success = false;
+    // Routing statistics
+    if (printRoutingStatistics) {
+      print(tr("Routing statistics..."));
+      QList<NetSignal*> netsignals =
+          project.getCircuit().getNetSignals().values();
+      std::sort(netsignals.begin(), netsignals.end(),
+                [](const NetSignal* a, const NetSignal* b) {
+                  return *a->getName() < *b->getName();
+                });
+      foreach (Board* board, boardList) {
+        // The statistics are maintained while loading the net segments, so
+        // planes and airwires are not needed.
+        board->load(false);  // can throw
+        print("  " % QString(tr("Board '%1':")).arg(*board->getName()));
+        foreach (const NetSignal* netsignal, netsignals) {
+          NetSignal::RoutingStatistics stats =
+              netsignal->getBoardRoutingStatistics(*board);
+          if ((stats.trackLength > 0) || (stats.viaCount > 0)) {
+            print(QString("    - %1: %2 mm, %3 via(s)")
+                      .arg(*netsignal->getName())
+                      .arg(stats.trackLength.toMmString())
+                      .arg(stats.viaCount));
           }
         }
       }
+    }
+
+    // Export and/or verify PCB fabrication data
+    if (exportPcbFabricationData || verifyPcbFabricationData) {
+      print(exportPcbFabricationData ? tr("Export PCB fabrication data...")
+                                     : tr("Verify PCB fabrication data..."));
+      QList<Board*> fabricationBoards = boardList;
       tl::optional<BoardFabricationOutputSettings> customSettings;
       if (!pcbFabricationSettingsPath.isEmpty()) {
         try {
@@ -354,21 +657,42 @@ bool CommandLineInterface::openProject(
           printErr(QString(tr("ERROR: Failed to load custom settings: %1"))
                        .arg(e.getMsg()));
           success = false;
-          boardList.clear();  // avoid exporting any boards
+          fabricationBoards.clear();  // avoid exporting any boards
         }
       }
       QHash<FilePath, int> filesCounter;
       bool                 filesOverwritten = false;
-      foreach (const Board* board, boardList) {
+      foreach (Board* board, fabricationBoards) {
         print("  " % QString(tr("Board '%1':")).arg(*board->getName()));
+        Profiler::Scope loadScope("board '%1': load", *board->getName());
+        board->load();  // can throw
+        loadScope.stop();
+        board->rebuildAllPlanesForFabrication();
         BoardGerberExport grbExport(
             *board, customSettings ? *customSettings
                                    : board->getFabricationOutputSettings());
-        grbExport.exportAllLayers();  // can throw
-        foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
-          filesCounter[fp]++;
-          if (filesCounter[fp] > 1) filesOverwritten = true;
-          print(QString("    => '%1'").arg(prettyPath(fp, projectFile)));
+        if (exportPcbFabricationData) {
+          grbExport.exportAllLayers();  // can throw
+          foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
+            filesCounter[fp]++;
+            if (filesCounter[fp] > 1) filesOverwritten = true;
+            print(QString("    => '%1'").arg(prettyPath(fp, projectFile)));
+          }
+        }
+        if (verifyPcbFabricationData) {
+          QVector<FilePath> differences =
+              grbExport.verifyReproducibility();  // can throw
+          foreach (const FilePath& fp, differences) {
+            printErr("    " %
+                     QString(tr("ERROR: Parallel export of '%1' differs from "
+                                "sequential export!"))
+                         .arg(prettyPath(fp, projectFile)));
+          }
+          if (differences.isEmpty()) {
+            print("    " % tr("Parallel export is reproducible."));
+          } else {
+            success = false;
+          }
         }
       }
       if (filesOverwritten) {
@@ -380,17 +704,71 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // Export BOM and pick&place data
+    typedef QByteArray (BoardAssemblyExport::*AssemblyGenerator)() const;
+    auto exportAssemblyData = [&](const QString&    destStr,
+                                  AssemblyGenerator generator) {
+      QSet<FilePath> writtenFiles;
+      foreach (Board* board, boardList) {
+        Profiler::Scope scope("board '%1': export '%2'", *board->getName(),
+                              destStr);
+        // Only the devices are needed, so don't build planes and airwires.
+        board->load(false);  // can throw
+        QString destPathStr = AttributeSubstitutor::substitute(
+            destStr, board, [&](const QString& str) {
+              return FilePath::cleanFileName(
+                  str, FilePath::ReplaceSpaces | FilePath::KeepCase);
+            });
+        FilePath            destPath(QFileInfo(destPathStr).absoluteFilePath());
+        BoardAssemblyExport assemblyExport(*board);
+        FileUtils::writeFile(destPath,
+                             (assemblyExport.*generator)());  // can throw
+        print(QString("  => '%1'").arg(prettyPath(destPath, destPathStr)));
+        if (writtenFiles.contains(destPath)) {
+          printErr("  " %
+                   QString(tr("ERROR: The file '%1' was written multiple "
+                              "times! Please use an attribute like "
+                              "'{{BOARD}}' in the path or specify the board "
+                              "to export with the '--board' argument."))
+                       .arg(prettyPath(destPath, destPathStr)));
+          success = false;
+        }
+        writtenFiles.insert(destPath);
+      }
+    };
+    if (!exportBomFile.isEmpty()) {
+      print(QString(tr("Export BOM to '%1'...")).arg(exportBomFile));
+      exportAssemblyData(exportBomFile,
+                         &BoardAssemblyExport::generateBom);  // can throw
+    }
+    if (!exportPnpFile.isEmpty()) {
+      print(QString(tr("Export pick&place to '%1'...")).arg(exportPnpFile));
+      exportAssemblyData(exportPnpFile,
+                         &BoardAssemblyExport::generatePickPlace);  // can throw
+    }
+
     // Save project
     if (save) {
+      Profiler::Scope scope("project '%1': save", projectFile);
       print(tr("Save project..."));
-      project.save();  // can throw
+      project.save(true);  // can throw
       if (projectFp.getSuffix() == "lppz") {
-        projectFs->exportToZip(projectFp);  // can throw
+        projectFs->exportToZip(projectFp, true);  // can throw
       } else {
         projectFs->save();  // can throw
       }
     }
 
+    // Record memory usage (after all boards needed by the command are loaded)
+    if (Profiler::isEnabled()) {
+      typedef QPair<QString, qint64> MemoryUsage;
+      foreach (const MemoryUsage& usage, project.getMemoryUsage()) {
+        Profiler::recordMemoryUsage(
+            QString("project '%1': %2").arg(projectFile, usage.first),
+            usage.second);
+      }
+    }
+
     return success;
   } catch (const Exception& e) {
     printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
@@ -399,9 +777,14 @@ bool CommandLineInterface::openProject(
 }
 
 bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
-                                       bool save) const noexcept {
+                                       bool runCheck, bool save,
+                                       const QString& checkCachePath,
+                                       const QString& jsonReportPath) const
+    noexcept {
   try {
-    bool success = true;
+    bool        success = true;
+    QJsonObject report;
+    report.insert("library", libDir);
 
     // Open library
     FilePath libFp(QFileInfo(libDir).absoluteFilePath());
@@ -412,136 +795,596 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
     Library lib(std::unique_ptr<TransactionalDirectory>(
         new TransactionalDirectory(libFs)));  // can throw
 
-    // Open all component categories
-    if (all) {
-      QStringList elements = lib.searchForElements<ComponentCategory>();
-      print(QString(tr("Process %1 component categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        ComponentCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+    // Open check cache
+    QScopedPointer<LibraryElementCheckCache> checkCache;
+    if (runCheck && (!checkCachePath.isEmpty())) {
+      FilePath fp(QFileInfo(checkCachePath).absoluteFilePath());
+      print(QString(tr("Open check cache '%1'..."))
+                .arg(prettyPath(fp, checkCachePath)));
+      // Messages are translated, thus the locale is part of the version.
+      checkCache.reset(new LibraryElementCheckCache(
+          fp,
+          QString("%1-%2-%3").arg(mApp.applicationVersion(),
+                                  mApp.getGitRevision(),
+                                  QLocale().name())));  // can throw
     }
 
-    // Open all package categories
-    if (all) {
-      QStringList elements = lib.searchForElements<PackageCategory>();
-      print(QString(tr("Process %1 package categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        PackageCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
+    // Check library
+    if (runCheck) {
+      print(tr("Check library..."));
+      QJsonArray messages;
+      if (!reportLibraryElementCheckMessages(
+              lib.runChecks(), prettyPath(libFp, libDir),
+              messages)) {  // can throw
+        success = false;
       }
+      report.insert("messages", messages);
     }
 
-    // Open all symbols
+    // Open all elements
     if (all) {
-      QStringList elements = lib.searchForElements<Symbol>();
-      print(QString(tr("Process %1 symbols...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Symbol element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+      QJsonArray elements;
+      success &= processLibraryElements<ComponentCategory>(
+          lib, libFp, libDir, tr("Process %1 component categories..."),
+          runCheck, save, checkCache.data(), elements);
+      success &= processLibraryElements<PackageCategory>(
+          lib, libFp, libDir, tr("Process %1 package categories..."),
+          runCheck, save, checkCache.data(), elements);
+      success &= processLibraryElements<Symbol>(
+          lib, libFp, libDir, tr("Process %1 symbols..."), runCheck, save,
+          checkCache.data(), elements);
+      success &= processLibraryElements<Package>(
+          lib, libFp, libDir, tr("Process %1 packages..."), runCheck, save,
+          checkCache.data(), elements);
+      success &= processLibraryElements<Component>(
+          lib, libFp, libDir, tr("Process %1 components..."), runCheck, save,
+          checkCache.data(), elements);
+      success &= processLibraryElements<Device>(
+          lib, libFp, libDir, tr("Process %1 devices..."), runCheck, save,
+          checkCache.data(), elements);
+      report.insert("elements", elements);
     }
 
-    // Open all packages
-    if (all) {
-      QStringList elements = lib.searchForElements<Package>();
-      print(QString(tr("Process %1 packages...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Package element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
+    // Save check cache
+    if (checkCache) {
+      print(QString(tr("Save check cache (%1 hit(s), %2 miss(es))..."))
+                .arg(checkCache->getHitCount())
+                .arg(checkCache->getMissCount()));
+      checkCache->save();  // can throw
+    }
+
+    // Save library
+    if (save) {
+      print(QString(tr("Save library '%1'...")).arg(prettyPath(libFp, libDir)));
+      lib.save();     // can throw
+      libFs->save();  // can throw
+    }
+
+    // Write JSON report
+    if (!jsonReportPath.isEmpty()) {
+      FilePath fp(QFileInfo(jsonReportPath).absoluteFilePath());
+      print(QString(tr("Write report '%1'..."))
+                .arg(prettyPath(fp, jsonReportPath)));
+      report.insert("success", success);
+      FileUtils::writeFile(fp, QJsonDocument(report).toJson());  // can throw
+    }
+
+    return success;
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    return false;
+  }
+}
+
+template <typename ElementType>
+bool CommandLineInterface::processLibraryElements(
+    const Library& lib, const FilePath& libFp, const QString& libDir,
+    const QString& msg, bool runCheck, bool save,
+    LibraryElementCheckCache* checkCache, QJsonArray& report) const noexcept {
+  QStringList elements = lib.searchForElements<ElementType>();
+  print(msg.arg(elements.count()));
+
+  // Process all elements on the global thread pool. The console output of
+  // each element is buffered to print it in the order of the elements, thus
+  // the output is deterministic.
+  std::function<LibraryElementResult(const QString&)> func =
+      [&](const QString& dir) {
+        return processLibraryElement<ElementType>(
+            libFp.getPathTo(dir), libDir, runCheck, save, checkCache);
+      };
+  QFuture<LibraryElementResult> future = QtConcurrent::mapped(elements, func);
+
+  bool success = true;
+  for (int i = 0; i < elements.count(); ++i) {
+    LibraryElementResult result = future.resultAt(i);
+    printOutput(result.output);
+    result.report.insert("type", ElementType::getShortElementName());
+    report.append(result.report);
+    success = success && result.success;
+  }
+  return success;
+}
+
+template <typename ElementType>
+CommandLineInterface::LibraryElementResult
+    CommandLineInterface::processLibraryElement(
+        const FilePath& fp, const QString& libDir, bool runCheck, bool save,
+        LibraryElementCheckCache* checkCache) const noexcept {
+  LibraryElementResult result;
+  result.success = true;
+  result.report.insert("path", prettyPath(fp, libDir));
+  Output* previousOutput = sOutput;
+  sOutput                = &result.output;
+  try {
+    qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::open(fp, save);  // can throw
+
+    // Look up the check results first since unmodified elements then don't
+    // need to be loaded at all (unless they have to be saved).
+    QByteArray                                   cacheKey;
+    tl::optional<LibraryElementCheckMessageList> messages;
+    if (runCheck && checkCache) {
+      cacheKey = LibraryElementCheckCache::calculateKey(
+          TransactionalDirectory(fs));  // can throw
+      messages = checkCache->find(cacheKey);
+    }
+    std::unique_ptr<ElementType> element;
+    if (save || (!messages)) {
+      element.reset(new ElementType(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(fs))));  // can throw
+    }
+    if (runCheck) {
+      if (!messages) {
+        messages = element->runChecks();  // can throw
+        if (checkCache) {
+          checkCache->insert(cacheKey, *messages);
         }
       }
+      QJsonArray json;
+      if (!reportLibraryElementCheckMessages(*messages, prettyPath(fp, libDir),
+                                             json)) {
+        result.success = false;
+      }
+      result.report.insert("messages", json);
+    }
+    if (save) {
+      qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
+      element->save();  // can throw
+      fs->save();       // can throw
     }
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    result.success = false;
+    result.report.insert("error", e.getMsg());
+  }
+  sOutput = previousOutput;
+  result.report.insert("success", result.success);
+  return result;
+}
 
-    // Open all components
-    if (all) {
-      QStringList elements = lib.searchForElements<Component>();
-      print(QString(tr("Process %1 components...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Component element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
+bool CommandLineInterface::importEagle(const QString&     outputDir,
+                                       const QStringList& files,
+                                       const QString&     uuidDbPath) const
+    noexcept {
+  try {
+    // Open output directory
+    FilePath outputFp(QFileInfo(outputDir).absoluteFilePath());
+    print(QString(tr("Open output directory '%1'..."))
+              .arg(prettyPath(outputFp, outputDir)));
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(outputFp);  // can throw
+    TransactionalDirectory root(fs);
+
+    // Without a given UUID database, use a temporary one which is only needed
+    // to get consistent UUIDs within this import.
+    FilePath tmpDir = FilePath::getRandomTempPath();
+    FilePath uuidDbFp = uuidDbPath.isEmpty()
+        ? tmpDir.getPathTo("uuids.ini")
+        : FilePath(QFileInfo(uuidDbPath).absoluteFilePath());
+
+    // Convert all libraries on the global thread pool. The results are
+    // processed in the order of the files as soon as they are available, thus
+    // the output is deterministic while the conversion is still running.
+    std::function<EagleLibraryResult(const QString&)> func =
+        [&](const QString& file) { return importEagleLibrary(file, uuidDbFp); };
+    QFuture<EagleLibraryResult> future = QtConcurrent::mapped(files, func);
+
+    bool success = true;
+    for (int i = 0; i < files.count(); ++i) {
+      EagleLibraryResult result = future.resultAt(i);
+      printOutput(result.output);
+      success = success && result.success;
+      foreach (const auto& element, result.elements) {
+        try {
+          TransactionalDirectory dir(root, element.first);
+          element.second->moveIntoParentDirectory(dir);  // can throw
+        } catch (const Exception& e) {
+          printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+          success = false;
         }
       }
     }
+    if (tmpDir.isExistingDir()) {
+      FileUtils::removeDirRecursively(tmpDir);  // can throw
+    }
 
-    // Open all devices
-    if (all) {
-      QStringList elements = lib.searchForElements<Device>();
-      print(QString(tr("Process %1 devices...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Device element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
+    // Save all elements at once
+    print(QString(tr("Save output directory '%1'..."))
+              .arg(prettyPath(outputFp, outputDir)));
+    fs->save();  // can throw
+
+    return success;
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    return false;
+  }
+}
+
+CommandLineInterface::EagleLibraryResult
+    CommandLineInterface::importEagleLibrary(const QString&  file,
+                                             const FilePath& uuidDb) const
+    noexcept {
+  EagleLibraryResult result;
+  result.success         = true;
+  Output* previousOutput = sOutput;
+  sOutput                = &result.output;
+  FilePath fp(QFileInfo(file).absoluteFilePath());
+  print(QString(tr("Import '%1'...")).arg(prettyPath(fp, file)));
+
+  // Elements are created in this worker thread, but saved in the main thread.
+  QThread* mainThread = QCoreApplication::instance()->thread();
+
+  auto addElement = [&](const QString&                      dir,
+                        std::shared_ptr<LibraryBaseElement> element) {
+    element->moveToThread(mainThread);
+    result.elements.append(qMakePair(dir, element));
+  };
+  auto tryConvert = [&](const QString& name, const std::function<void()>& f) {
+    try {
+      f();  // can throw
+    } catch (const Exception& e) {
+      printErr(QString("  - [%1] %2: %3").arg(tr("ERROR"), name, e.getMsg()));
+      result.success = false;
+    } catch (const std::exception& e) {
+      printErr(QString("  - [%1] %2: %3").arg(tr("ERROR"), name, e.what()));
+      result.success = false;
+    }
+  };
+
+  try {
+    parseagle::Library        library(fp.toStr());  // can throw
+    eagleimport::ConverterDb db(uuidDb);
+    db.setCurrentLibraryFilePath(fp);
+
+    foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
+      tryConvert(symbol.getName(), [&]() {
+        eagleimport::SymbolConverter converter(symbol, db);
+        std::shared_ptr<Symbol> element = converter.generate();  // can throw
+        eagleimport::PolygonSimplifier<Symbol> simplifier(*element);
+        simplifier.convertLineRectsToPolygonRects(false, true);
+        addElement("sym", element);
+      });
+    }
+
+    foreach (const parseagle::Package& package, library.getPackages()) {
+      tryConvert(package.getName(), [&]() {
+        eagleimport::PackageConverter converter(package, db);
+        std::shared_ptr<Package> element = converter.generate();  // can throw
+        Q_ASSERT(element->getFootprints().count() == 1);
+        eagleimport::PolygonSimplifier<Footprint> simplifier(
+            *element->getFootprints().first());
+        simplifier.convertLineRectsToPolygonRects(false, true);
+        addElement("pkg", element);
+      });
+    }
+
+    foreach (const parseagle::DeviceSet& deviceSet, library.getDeviceSets()) {
+      // Same as the Eagle import tool: skip the US variants of device sets
+      if (deviceSet.getName().endsWith("-US") ||
+          deviceSet.getName().endsWith("-US_")) {
+        continue;
       }
+      tryConvert(deviceSet.getName(), [&]() {
+        eagleimport::DeviceSetConverter converter(deviceSet, db);
+        std::shared_ptr<Component> component =
+            converter.generate();  // can throw
+        QList<std::shared_ptr<Device>> devices;
+        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+          if (device.getPackage().isNull()) continue;
+          eagleimport::DeviceConverter devConverter(deviceSet, device, db);
+          devices.append(devConverter.generate());  // can throw
+        }
+        addElement("cmp", component);
+        foreach (const std::shared_ptr<Device>& device, devices) {
+          addElement("dev", device);
+        }
+      });
     }
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    result.success = false;
+  } catch (const std::exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.what()));
+    result.success = false;
+  }
 
-    // Save library
-    if (save) {
-      print(QString(tr("Save library '%1'...")).arg(prettyPath(libFp, libDir)));
-      lib.save();     // can throw
-      libFs->save();  // can throw
+  print(QString(tr("  Converted %1 element(s).")).arg(result.elements.count()));
+  sOutput = previousOutput;
+  return result;
+}
+
+bool CommandLineInterface::reportLibraryElementCheckMessages(
+    const LibraryElementCheckMessageList& messages, const QString& name,
+    QJsonArray& report) const noexcept {
+  bool success = true;
+  foreach (const auto& msg, messages) {
+    QString severity;
+    switch (msg->getSeverity()) {
+      case LibraryElementCheckMessage::Severity::Hint:
+        severity = "hint";
+        break;
+      case LibraryElementCheckMessage::Severity::Warning:
+        severity = "warning";
+        print(QString("    - [%1] %2: %3")
+                  .arg(tr("WARNING"), name, msg->getMessage()));
+        success = false;
+        break;
+      default:
+        severity = "error";
+        print(QString("    - [%1] %2: %3")
+                  .arg(tr("ERROR"), name, msg->getMessage()));
+        success = false;
+        break;
     }
+    QJsonObject entry;
+    entry.insert("severity", severity);
+    entry.insert("message", msg->getMessage());
+    entry.insert("description", msg->getDescription());
+    report.append(entry);
+  }
+  return success;
+}
 
-    return success;
+bool CommandLineInterface::processProjects(
+    const QStringList&                         files,
+    const std::function<bool(const QString&)>& func) const noexcept {
+  // Note: Projects are processed one after another in this (the GUI) thread
+  // since loading a project creates graphics scenes, and exporting PDFs uses
+  // QPrinter, which are not supported in other threads. The expensive parts
+  // like building planes run in parallel within each project anyway.
+  QStringList summary;
+  bool        success = true;
+  foreach (const QString& file, files) {
+    Output  output;
+    Output* previousOutput = sOutput;
+    sOutput                = &output;
+    bool result            = func(file);
+    sOutput                = previousOutput;
+    printOutput(output);
+    summary.append(
+        QString("  [%1] %2").arg(result ? tr("OK") : tr("FAILED"), file));
+    success = success && result;
+  }
+  print(tr("Summary:"));
+  foreach (const QString& line, summary) { print(line); }
+  return success;
+}
+
+bool CommandLineInterface::readProjectList(const QString& listFile,
+                                           QStringList& projectFiles) const
+    noexcept {
+  try {
+    FilePath fp(QFileInfo(listFile).absoluteFilePath());
+    QString  content = QString::fromUtf8(FileUtils::readFile(fp));  // can throw
+    foreach (QString line, content.split('\n')) {
+      line = line.trimmed();
+      if ((!line.isEmpty()) && (!line.startsWith('#'))) {
+        projectFiles.append(QFileInfo(listFile).dir().filePath(line));
+      }
+    }
+    return true;
   } catch (const Exception& e) {
     printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
     return false;
   }
 }
 
+bool CommandLineInterface::serve(const QString& name) const noexcept {
+  // Don't steal the socket of another server which is still running
+  QLocalSocket probe;
+  probe.connectToServer(name);
+  if (probe.waitForConnected(1000)) {
+    printErr(QString(tr("ERROR: Server '%1' is already running.")).arg(name));
+    return false;
+  }
+  QLocalServer::removeServer(name);  // clean up after a crashed server
+
+  QLocalServer server;
+  if (!server.listen(name)) {
+    printErr(QString(tr("ERROR: %1")).arg(server.errorString()));
+    return false;
+  }
+  QObject::connect(&server, &QLocalServer::newConnection, [this, &server]() {
+    while (QLocalSocket* socket = server.nextPendingConnection()) {
+      QObject::connect(socket, &QLocalSocket::disconnected, socket,
+                       &QLocalSocket::deleteLater);
+      QObject::connect(socket, &QLocalSocket::readyRead,
+                       [this, socket]() { handleServerRequest(*socket); });
+    }
+  });
+  print(QString(tr("Listening on '%1'...")).arg(server.fullServerName()));
+  return QCoreApplication::exec() == 0;
+}
+
+void CommandLineInterface::handleServerRequest(QLocalSocket& socket) const
+    noexcept {
+  if (!socket.canReadLine()) {
+    return;  // request not yet completely received
+  }
+  QJsonObject request = QJsonDocument::fromJson(socket.readLine()).object();
+  QStringList arguments;
+  foreach (const QJsonValue& value, request.value("arguments").toArray()) {
+    arguments.append(value.toString());
+  }
+
+  // Execute the command as if it was called in the working directory of the
+  // client, but with all the console output buffered for the client. Any state
+  // which is modified by a command needs to be restored afterwards.
+  Output              output;
+  QString             currentDir = QDir::currentPath();
+  Debug::DebugLevel_t debugLevel = Debug::instance()->getDebugLevelStderr();
+  int                 exitCode   = 1;
+  QDir::setCurrent(request.value("directory").toString());
+  sOutput = &output;
+  if (!arguments.isEmpty()) {
+    exitCode = execute(arguments, false);
+  }
+  sOutput = nullptr;
+  Debug::instance()->setDebugLevelStderr(debugLevel);
+  QDir::setCurrent(currentDir);
+
+  QJsonArray lines;
+  foreach (const auto& line, output) {
+    QJsonObject obj;
+    obj.insert("stderr", line.first);
+    obj.insert("text", line.second);
+    lines.append(obj);
+  }
+  QJsonObject response;
+  response.insert("exit_code", exitCode);
+  response.insert("output", lines);
+  socket.write(QJsonDocument(response).toJson(QJsonDocument::Compact) + '\n');
+  socket.disconnectFromServer();
+}
+
+int CommandLineInterface::sendToServer(const QString&     name,
+                                       const QStringList& arguments) const
+    noexcept {
+  QLocalSocket socket;
+  socket.connectToServer(name);
+  if (!socket.waitForConnected(5000)) {
+    printErr(QString(tr("ERROR: Could not connect to server '%1': %2"))
+                 .arg(name, socket.errorString()));
+    return 1;
+  }
+  QJsonObject request;
+  request.insert("directory", QDir::currentPath());
+  request.insert("arguments", QJsonArray::fromStringList(arguments));
+  socket.write(QJsonDocument(request).toJson(QJsonDocument::Compact) + '\n');
+  socket.flush();
+
+  // No timeout since some commands (e.g. exports) may take a long time
+  while (!socket.canReadLine()) {
+    if (!socket.waitForReadyRead(-1)) {
+      printErr(QString(tr("ERROR: Connection to server lost: %1"))
+                   .arg(socket.errorString()));
+      return 1;
+    }
+  }
+  QJsonObject response = QJsonDocument::fromJson(socket.readLine()).object();
+  foreach (const QJsonValue& value, response.value("output").toArray()) {
+    QJsonObject line = value.toObject();
+    if (line.value("stderr").toBool()) {
+      printErr(line.value("text").toString(), 0);
+    } else {
+      print(line.value("text").toString(), 0);
+    }
+  }
+  return response.value("exit_code").toInt(1);
+}
+
+bool CommandLineInterface::printProfile(bool           printToConsole,
+                                        const QString& jsonFilePath,
+                                        const QString& traceFilePath) const
+    noexcept {
+  QList<Profiler::Entry> entries        = Profiler::getEntries();
+  qint64                 peakMemory     = SystemInfo::getPeakMemoryUsage();
+  int                    boardItems     = BI_Base::getCreatedItemsCount();
+  int                    schematicItems = SI_Base::getCreatedItemsCount();
+  QList<Profiler::MemoryUsageEntry> memoryUsages =
+      Profiler::getMemoryUsageEntries();
+  QList<PerformanceCounters::Entry> counters =
+      PerformanceCounters::getEntries();
+
+  if (printToConsole) {
+    print(tr("Profile:"));
+    foreach (const Profiler::Entry& entry, entries) {
+      QString line = QString("  %1 ms  %2")
+                         .arg(entry.nanoseconds / 1e6, 10, 'f', 3)
+                         .arg(entry.name);
+      if (entry.count > 1) {
+        line += QString(" (%1x)").arg(entry.count);
+      }
+      print(line);
+    }
+    print("  " % QString(tr("Peak memory usage: %1 MB"))
+                     .arg(peakMemory / 1e6, 0, 'f', 1));
+    print("  " % QString(tr("Created board items: %1")).arg(boardItems));
+    print("  " %
+          QString(tr("Created schematic items: %1")).arg(schematicItems));
+    if (!memoryUsages.isEmpty()) {
+      print("  " % tr("Estimated memory usage:"));
+      foreach (const Profiler::MemoryUsageEntry& entry, memoryUsages) {
+        print(QString("    %1 MB  %2")
+                  .arg(entry.bytes / 1e6, 8, 'f', 1)
+                  .arg(entry.name));
+      }
+    }
+    print("  " % tr("Performance counters:"));
+    foreach (const PerformanceCounters::Entry& entry, counters) {
+      print(QString("    %1  %2").arg(entry.value, 10).arg(entry.name));
+    }
+  }
+
+  if (!jsonFilePath.isEmpty()) {
+    try {
+      QJsonArray timings;
+      foreach (const Profiler::Entry& entry, entries) {
+        QJsonObject obj;
+        obj.insert("name", entry.name);
+        obj.insert("count", entry.count);
+        obj.insert("milliseconds", entry.nanoseconds / 1e6);
+        timings.append(obj);
+      }
+      QJsonArray memory;
+      foreach (const Profiler::MemoryUsageEntry& entry, memoryUsages) {
+        QJsonObject obj;
+        obj.insert("name", entry.name);
+        obj.insert("bytes", entry.bytes);
+        memory.append(obj);
+      }
+      QJsonObject counterValues;
+      foreach (const PerformanceCounters::Entry& entry, counters) {
+        counterValues.insert(entry.name, entry.value);
+      }
+      QJsonObject report;
+      report.insert("timings", timings);
+      report.insert("peak_memory_usage", peakMemory);
+      report.insert("created_board_items", boardItems);
+      report.insert("created_schematic_items", schematicItems);
+      report.insert("memory_usage", memory);
+      report.insert("performance_counters", counterValues);
+      FilePath fp(QFileInfo(jsonFilePath).absoluteFilePath());
+      FileUtils::writeFile(fp, QJsonDocument(report).toJson());  // can throw
+    } catch (const Exception& e) {
+      printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+      return false;
+    }
+  }
+
+  if (!traceFilePath.isEmpty()) {
+    try {
+      FilePath fp(QFileInfo(traceFilePath).absoluteFilePath());
+      FileUtils::writeFile(fp, Profiler::getChromeTrace());  // can throw
+    } catch (const Exception& e) {
+      printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+      return false;
+    }
+  }
+  return true;
+}
+
 QString CommandLineInterface::prettyPath(const FilePath& path,
                                          const QString&  style) noexcept {
   if (QFileInfo(style).isAbsolute()) {
@@ -554,6 +1397,10 @@ QString CommandLineInterface::prettyPath(const FilePath& path,
 }
 
 void CommandLineInterface::print(const QString& str, int newlines) noexcept {
+  if (sOutput) {
+    sOutput->append(qMakePair(false, str % QString(newlines, '\n')));
+    return;
+  }
   QTextStream s(stdout);
   s << str;
   for (int i = 0; i < newlines; ++i) {
@@ -562,6 +1409,10 @@ void CommandLineInterface::print(const QString& str, int newlines) noexcept {
 }
 
 void CommandLineInterface::printErr(const QString& str, int newlines) noexcept {
+  if (sOutput) {
+    sOutput->append(qMakePair(true, str % QString(newlines, '\n')));
+    return;
+  }
   QTextStream s(stderr);
   s << str;
   for (int i = 0; i < newlines; ++i) {
@@ -569,6 +1420,16 @@ void CommandLineInterface::printErr(const QString& str, int newlines) noexcept {
   }
 }
 
+void CommandLineInterface::printOutput(const Output& output) noexcept {
+  foreach (const auto& line, output) {
+    if (line.first) {
+      printErr(line.second, 0);
+    } else {
+      print(line.second, 0);
+    }
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
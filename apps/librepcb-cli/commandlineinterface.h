@@ -25,14 +25,26 @@
  ******************************************************************************/
 #include <QtCore>
 
+#include <functional>
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
+class QLocalSocket;
+
 namespace librepcb {
 
 class Application;
 class FilePath;
 
+namespace library {
+class Library;
+class LibraryBaseElement;
+class LibraryElementCheckCache;
+class LibraryElementCheckMessage;
+}
+
 namespace cli {
 
 /*******************************************************************************
@@ -54,20 +66,76 @@ public:
   // General Methods
   int execute() noexcept;
 
+private:  // Types
+  typedef QList<QPair<bool, QString>> Output;  ///< Lines (stderr, text)
+
+  /// Result of processing a single library element
+  struct LibraryElementResult {
+    bool        success;
+    Output      output;  ///< Console output
+    QJsonObject report;  ///< Entry for the JSON report
+  };
+
+  /// Result of converting a single Eagle library
+  struct EagleLibraryResult {
+    bool   success;
+    Output output;  ///< Console output
+    QList<QPair<QString, std::shared_ptr<library::LibraryBaseElement>>>
+        elements;  ///< Converted elements with their output subdirectory
+  };
+
 private:  // Methods
-  bool openProject(const QString& projectFile, bool runErc,
+  bool openProject(const QString& projectFile, bool runErc, bool runDrc,
+                   bool               printRoutingStatistics,
                    const QStringList& exportSchematicsFiles,
                    bool               exportPcbFabricationData,
+                   bool               verifyPcbFabricationData,
                    const QString&     pcbFabricationSettingsPath,
+                   const QString& exportBomFile, const QString& exportPnpFile,
                    const QStringList& boards, bool save) const noexcept;
-  bool openLibrary(const QString& libDir, bool all, bool save) const noexcept;
+  bool openLibrary(const QString& libDir, bool all, bool runCheck, bool save,
+                   const QString& checkCachePath,
+                   const QString& jsonReportPath) const noexcept;
+  template <typename ElementType>
+  bool processLibraryElements(const library::Library& lib,
+                              const FilePath& libFp, const QString& libDir,
+                              const QString& msg, bool runCheck, bool save,
+                              library::LibraryElementCheckCache* checkCache,
+                              QJsonArray& report) const noexcept;
+  template <typename ElementType>
+  LibraryElementResult processLibraryElement(
+      const FilePath& fp, const QString& libDir, bool runCheck, bool save,
+      library::LibraryElementCheckCache* checkCache) const noexcept;
+  bool importEagle(const QString& outputDir, const QStringList& files,
+                   const QString& uuidDbPath) const noexcept;
+  EagleLibraryResult importEagleLibrary(const QString&  file,
+                                        const FilePath& uuidDb) const noexcept;
+  bool reportLibraryElementCheckMessages(
+      const QVector<std::shared_ptr<const library::LibraryElementCheckMessage>>&
+                     messages,
+      const QString& name, QJsonArray& report) const noexcept;
+  bool processProjects(const QStringList&                         files,
+                       const std::function<bool(const QString&)>& func) const
+      noexcept;
+  bool readProjectList(const QString& listFile,
+                       QStringList&   projectFiles) const noexcept;
+  int  execute(const QStringList& arguments, bool allowServer) const noexcept;
+  bool serve(const QString& name) const noexcept;
+  void handleServerRequest(QLocalSocket& socket) const noexcept;
+  int  sendToServer(const QString&     name,
+                    const QStringList& arguments) const noexcept;
+  bool printProfile(bool printToConsole, const QString& jsonFilePath,
+                    const QString& traceFilePath) const noexcept;
   static QString prettyPath(const FilePath& path,
                             const QString&  style) noexcept;
   static void    print(const QString& str, int newlines = 1) noexcept;
   static void    printErr(const QString& str, int newlines = 1) noexcept;
+  static void    printOutput(const Output& output) noexcept;
 
 private:  // Data
-  const Application& mApp;
+  const Application&          mApp;
+  static thread_local Output* sOutput;
+  static const char*          sDefaultServer;
 };
 
 /*******************************************************************************
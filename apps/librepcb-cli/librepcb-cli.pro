@@ -10,7 +10,7 @@ TARGET = librepcb-cli
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets opengl network xml printsupport sql
+QT += core widgets opengl network xml printsupport sql concurrent
 
 CONFIG += console
 
@@ -28,14 +28,16 @@ LIBS += \
     -llibrepcblibraryeditor \
     -llibrepcbworkspace \
     -llibrepcbproject \
+    -llibrepcbeagleimport \
     -llibrepcblibrary \
     -llibrepcbcommon \
-    -lsexpresso \
+    -lparseagle \
     -lclipper \
     -lquazip -lz
 
 INCLUDEPATH += \
     ../../libs \
+    ../../libs/parseagle \
     ../../libs/quazip \
     ../../libs/type_safe/include \
     ../../libs/type_safe/external/debug_assert \
@@ -47,10 +49,11 @@ DEPENDPATH += \
     ../../libs/librepcb/libraryeditor \
     ../../libs/librepcb/workspace \
     ../../libs/librepcb/project \
+    ../../libs/librepcb/eagleimport \
     ../../libs/librepcb/library \
     ../../libs/librepcb/common \
+    ../../libs/parseagle \
     ../../libs/quazip \
-    ../../libs/sexpresso \
     ../../libs/clipper \
 
 PRE_TARGETDEPS += \
@@ -60,10 +63,11 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcblibraryeditor.a \
     $${DESTDIR}/liblibrepcbworkspace.a \
     $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcbeagleimport.a \
     $${DESTDIR}/liblibrepcblibrary.a \
     $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libparseagle.a \
     $${DESTDIR}/libquazip.a \
-    $${DESTDIR}/libsexpresso.a \
     $${DESTDIR}/libclipper.a \
 
 RESOURCES += \
@@ -27,6 +27,7 @@
 #include "ui_controlpanel.h"
 
 #include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
 #include <librepcb/common/dialogs/aboutdialog.h>
 #include <librepcb/common/dialogs/filedialog.h>
 #include <librepcb/common/fileio/fileutils.h>
@@ -138,8 +139,14 @@ ControlPanel::ControlPanel(Workspace& workspace)
   QTimer::singleShot(10, this, SLOT(openProjectsPassedByCommandLine()));
 #endif
 
-  // start scanning the workspace library (asynchronously)
-  mWorkspace.getLibraryDb().startLibraryRescan();
+  // Start scanning the workspace library (asynchronously). But wait until the
+  // control panel is shown and idle, otherwise the scan competes with the
+  // application startup (for CPU and disk access).
+  QTimer::singleShot(500, this, [this]() {
+    qDebug() << "Start library scan after"
+             << Debug::instance()->getElapsedTimeSinceStartup() << "ms.";
+    mWorkspace.getLibraryDb().startLibraryRescan();
+  });
 }
 
 ControlPanel::~ControlPanel() {
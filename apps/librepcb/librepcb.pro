@@ -10,7 +10,7 @@ TARGET = librepcb
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets opengl network xml printsupport sql
+QT += core widgets opengl network xml printsupport sql concurrent
 
 win32 {
     # Windows-specific configurations
@@ -44,7 +44,6 @@ LIBS += \
     -llibrepcbproject \
     -llibrepcblibrary \
     -llibrepcbcommon \
-    -lsexpresso \
     -lclipper \
     -lquazip -lz
 
@@ -64,7 +63,6 @@ DEPENDPATH += \
     ../../libs/librepcb/library \
     ../../libs/librepcb/common \
     ../../libs/quazip \
-    ../../libs/sexpresso \
     ../../libs/clipper \
 
 PRE_TARGETDEPS += \
@@ -77,7 +75,6 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcblibrary.a \
     $${DESTDIR}/liblibrepcbcommon.a \
     $${DESTDIR}/libquazip.a \
-    $${DESTDIR}/libsexpresso.a \
     $${DESTDIR}/libclipper.a \
 
 RESOURCES += \
@@ -26,7 +26,9 @@
 #include <librepcb/common/application.h>
 #include <librepcb/common/debug.h>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/network/networkaccessmanager.h>
+#include <librepcb/common/utils/profiler.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
 
@@ -55,6 +57,7 @@ static bool     isFileFormatStableOrAcceptUnstable() noexcept;
 static FilePath determineWorkspacePath() noexcept;
 static int      openWorkspace(const FilePath& path) noexcept;
 static int      appExec() noexcept;
+static void     writeProfileTrace(const QString& filepath) noexcept;
 
 /*******************************************************************************
  *  main()
@@ -75,6 +78,13 @@ int main(int argc, char* argv[]) {
   // (organization + name).
   Debug::instance();
 
+  // Record a trace of the executed operations if requested by the user. The
+  // trace is written to the given file when the application exits.
+  QString profileTraceFile = qgetenv("LIBREPCB_PROFILE_TRACE");
+  if (!profileTraceFile.isEmpty()) {
+    Profiler::setEnabled(true);
+  }
+
   // Configure the application settings format and location used by QSettings
   configureApplicationSettings();
 
@@ -122,6 +132,11 @@ int main(int argc, char* argv[]) {
   // Cleanup all 3rd party libraries
   cleanup3rdPartyLibs();
 
+  // Write the recorded trace, if enabled
+  if (!profileTraceFile.isEmpty()) {
+    writeProfileTrace(profileTraceFile);
+  }
+
   qDebug() << "Exit application with code" << retval;
   return retval;
 }
@@ -158,6 +173,11 @@ static void configureApplicationSettings() noexcept {
     QSettings::setPath(QSettings::IniFormat, QSettings::UserScope,
                        customConfigDir);
   }
+
+  // Graphics items of boards (e.g. planes and footprints) are cached as
+  // pixmaps in device coordinates. The default cache limit of 10MB is too
+  // small to hold the pixmaps of a single full screen board view.
+  QPixmapCache::setCacheLimit(qMax(QPixmapCache::cacheLimit(), 100 * 1024));
 }
 
 /*******************************************************************************
@@ -292,9 +312,13 @@ static FilePath determineWorkspacePath() noexcept {
 
 static int openWorkspace(const FilePath& path) noexcept {
   try {
-    Workspace    ws(path);  // The Workspace constructor can throw an exception
+    Workspace ws(path);  // The Workspace constructor can throw an exception
+    qInfo() << "Workspace opened after"
+            << Debug::instance()->getElapsedTimeSinceStartup() << "ms.";
     ControlPanel p(ws);
     p.show();
+    qInfo() << "Control panel shown after"
+            << Debug::instance()->getElapsedTimeSinceStartup() << "ms.";
 
     return appExec();
   } catch (UserCanceled& e) {
@@ -329,3 +353,17 @@ static int appExec() noexcept {
 
   return -1;
 }
+
+/*******************************************************************************
+ *  writeProfileTrace()
+ ******************************************************************************/
+
+static void writeProfileTrace(const QString& filepath) noexcept {
+  try {
+    FilePath fp(QFileInfo(filepath).absoluteFilePath());
+    FileUtils::writeFile(fp, Profiler::getChromeTrace());  // can throw
+    qInfo() << "Wrote profile trace to" << fp.toNative();
+  } catch (const Exception& e) {
+    qCritical() << "Could not write profile trace:" << e.getMsg();
+  }
+}
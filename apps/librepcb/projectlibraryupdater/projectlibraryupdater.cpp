@@ -37,6 +37,7 @@
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/workspace/workspace.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -47,7 +48,6 @@ namespace librepcb {
 namespace application {
 
 using project::Project;
-using workspace::WorkspaceLibraryDb;
 
 /*******************************************************************************
  *  Constructors / Destructor
@@ -105,10 +105,12 @@ void ProjectLibraryUpdater::btnUpdateClicked() {
               TransactionalFileSystem::RestoreMode::ABORT);
 
       // update all elements
-      updateElements(fs, "cmp", &WorkspaceLibraryDb::getLatestComponent);
-      updateElements(fs, "dev", &WorkspaceLibraryDb::getLatestDevice);
-      updateElements(fs, "pkg", &WorkspaceLibraryDb::getLatestPackage);
-      updateElements(fs, "sym", &WorkspaceLibraryDb::getLatestSymbol);
+      QVector<Element> elements;
+      elements += getElements<library::Component>(*fs);  // can throw
+      elements += getElements<library::Device>(*fs);     // can throw
+      elements += getElements<library::Package>(*fs);    // can throw
+      elements += getElements<library::Symbol>(*fs);     // can throw
+      updateElements(*fs, elements);                     // can throw
 
       // check whether project can still be opened of if we broke something
       try {
@@ -162,26 +164,95 @@ QString ProjectLibraryUpdater::prettyPath(const FilePath& fp) const noexcept {
   return fp.toRelative(mProjectFilePath.getParentDir());
 }
 
-void ProjectLibraryUpdater::updateElements(
-    std::shared_ptr<TransactionalFileSystem> fs, const QString& type,
-    FilePath (workspace::WorkspaceLibraryDb::*getter)(const Uuid&) const) {
-  QString dirpath = "library/" % type;
-  foreach (const QString& dirname, fs->getDirs(dirpath)) {
+template <typename ElementType>
+QVector<ProjectLibraryUpdater::Element> ProjectLibraryUpdater::getElements(
+    const TransactionalFileSystem& fs) const {
+  // Look up the latest versions of all elements with a single batch query.
+  const QString     dirpath  = "library/" % ElementType::getShortElementName();
+  const QStringList dirnames = fs.getDirs(dirpath);
+  QSet<Uuid>        uuids;
+  foreach (const QString& dirname, dirnames) {
     tl::optional<Uuid> uuid = Uuid::tryFromString(dirname);
-    FilePath           src =
-        uuid ? (mWorkspace.getLibraryDb().*getter)(*uuid) : FilePath();
-    QString                dst = dirpath % "/" % dirname;
-    TransactionalDirectory dstDir(fs, dst);
-    if (src.isValid() && (!dstDir.getFiles().isEmpty())) {
-      log(QString(tr("Update %1...")).arg(dst));
-      std::shared_ptr<TransactionalFileSystem> srcFs =
-          TransactionalFileSystem::openRO(src);
-      TransactionalDirectory srcDir(srcFs);
-      fs->removeDirRecursively(dst);
-      srcDir.saveTo(dstDir);
+    if (uuid) uuids.insert(*uuid);
+  }
+  const QHash<Uuid, FilePath> sources =
+      mWorkspace.getLibraryDb().getLatestElements<ElementType>(uuids);
+
+  QVector<Element> elements;
+  foreach (const QString& dirname, dirnames) {
+    tl::optional<Uuid> uuid = Uuid::tryFromString(dirname);
+    FilePath           src  = uuid ? sources.value(*uuid) : FilePath();
+    elements.append(Element{dirpath % "/" % dirname, src, false,
+                            QHash<QString, QByteArray>(), QString()});
+  }
+  return elements;
+}
+
+void ProjectLibraryUpdater::updateElements(TransactionalFileSystem& fs,
+                                           const QVector<Element>& elements) {
+  // Compare all elements in parallel, but apply the results in the original
+  // order (in the main thread since the file system is not thread-safe).
+  FilePath projectDir = mProjectFilePath.getParentDir();
+  std::function<Element(const Element&)> func = [projectDir](const Element& e) {
+    return compareElement(e, projectDir);
+  };
+  QFuture<Element> future = QtConcurrent::mapped(elements, func);
+
+  int updated = 0;
+  int skipped = 0;
+  for (int i = 0; i < elements.count(); ++i) {
+    const Element result = future.resultAt(i);  // blocks until available
+    if (!result.error.isEmpty()) {
+      throw RuntimeError(__FILE__, __LINE__, result.error);
+    } else if (result.update) {
+      log(QString(tr("Update %1...")).arg(result.path));
+      fs.removeDirRecursively(result.path);  // can throw
+      for (auto it = result.files.constBegin(); it != result.files.constEnd();
+           ++it) {
+        fs.write(result.path % "/" % it.key(), it.value());  // can throw
+      }
+      ++updated;
     } else {
-      log(QString(tr("Skip %1...")).arg(dst));
+      log(QString(tr("Skip %1...")).arg(result.path));
+      ++skipped;
+    }
+  }
+  log(QString(tr("%1 elements updated, %2 elements skipped."))
+          .arg(updated)
+          .arg(skipped));
+}
+
+ProjectLibraryUpdater::Element ProjectLibraryUpdater::compareElement(
+    Element element, const FilePath& projectDir) {
+  try {
+    if (element.source.isValid()) {
+      QHash<QString, QByteArray> oldFiles;
+      readFiles(*TransactionalFileSystem::openRO(
+                    projectDir.getPathTo(element.path)),
+                QString(), oldFiles);  // can throw
+      if (!oldFiles.isEmpty()) {
+        readFiles(*TransactionalFileSystem::openRO(element.source), QString(),
+                  element.files);  // can throw
+        element.update = (element.files != oldFiles);
+      }
+    }
+    if (!element.update) {
+      element.files.clear();  // not needed anymore
     }
+  } catch (const Exception& e) {
+    element.error = e.getMsg();
+  }
+  return element;
+}
+
+void ProjectLibraryUpdater::readFiles(const FileSystem& fs, const QString& path,
+                                      QHash<QString, QByteArray>& files) {
+  QString prefix = path.isEmpty() ? path : path % "/";
+  foreach (const QString& filename, fs.getFiles(path)) {
+    files.insert(prefix % filename, fs.read(prefix % filename));  // can throw
+  }
+  foreach (const QString& dirname, fs.getDirs(path)) {
+    readFiles(fs, prefix % dirname, files);  // can throw
   }
 }
 
@@ -36,11 +36,11 @@
  ******************************************************************************/
 namespace librepcb {
 
+class FileSystem;
 class TransactionalFileSystem;
 
 namespace workspace {
 class Workspace;
-class WorkspaceLibraryDb;
 }  // namespace workspace
 
 namespace application {
@@ -58,6 +58,11 @@ class ProjectLibraryUpdater;
 /**
  * @brief The ProjectLibraryUpdater class
  *
+ * The elements are read and compared with the workspace library in parallel
+ * on the global thread pool. Elements which are already identical to the
+ * workspace library are skipped, only the modified ones are written back to
+ * the project (in the main thread).
+ *
  * @note This updater is currently an ugly hack with very limited functionality.
  * The whole project library update concept needs to be refactored some time to
  * provide an updater with much more functionality and higher reliability.
@@ -74,12 +79,25 @@ public:
 private slots:
   void btnUpdateClicked();
 
-private:
-  void    log(const QString& msg) noexcept;
-  QString prettyPath(const FilePath& fp) const noexcept;
-  void    updateElements(
-         std::shared_ptr<TransactionalFileSystem> fs, const QString& type,
-         FilePath (workspace::WorkspaceLibraryDb::*getter)(const Uuid&) const);
+private:  // Types
+  struct Element {
+    QString  path;    ///< Path of the element within the project
+    FilePath source;  ///< Element in the workspace library (invalid if none)
+    bool     update;  ///< Whether the element needs to be updated or not
+    QHash<QString, QByteArray> files;  ///< New files, if ::update is true
+    QString                    error;  ///< Empty on success
+  };
+
+private:  // Methods
+  void             log(const QString& msg) noexcept;
+  QString          prettyPath(const FilePath& fp) const noexcept;
+  template <typename ElementType>
+  QVector<Element> getElements(const TransactionalFileSystem& fs) const;
+  void           updateElements(TransactionalFileSystem& fs,
+                                const QVector<Element>&  elements);
+  static Element compareElement(Element element, const FilePath& projectDir);
+  static void    readFiles(const FileSystem& fs, const QString& path,
+                           QHash<QString, QByteArray>& files);
 
 private:
   workspace::Workspace&                     mWorkspace;
@@ -46,3 +46,6 @@ QMAKE_CXXFLAGS_DEBUG += -Wextra
 
 # QuaZIP: use as static library
 DEFINES += QUAZIP_STATIC
+
+# SystemInfo::getPeakMemoryUsage() needs the process status API on Windows
+win32: LIBS += -lpsapi
@@ -40,8 +40,9 @@ namespace librepcb {
  ******************************************************************************/
 
 inline static QString cleanAttributeKey(const QString& userInput) noexcept {
-  return Toolbox::cleanUserInputString(
-      userInput, QRegularExpression("[^_0-9A-Z]"), true, false, true, "_", 40);
+  static const QRegularExpression re("[^_0-9A-Z]");
+  return Toolbox::cleanUserInputString(userInput, re, true, false, true, "_",
+                                       40);
 }
 
 struct AttributeKeyVerifier {
@@ -61,8 +62,8 @@ struct AttributeKeyVerifier {
 
 struct AttributeKeyConstraint {
   bool operator()(const QString& value) const noexcept {
-    return QRegularExpression("^[_0-9A-Z]{1,40}$")
-        .match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
+    static const QRegularExpression re("^[_0-9A-Z]{1,40}$");
+    return re.match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
         .hasMatch();
   }
 };
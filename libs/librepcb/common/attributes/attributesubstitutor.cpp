@@ -38,6 +38,10 @@ namespace librepcb {
 QString AttributeSubstitutor::substitute(QString                  str,
                                          const AttributeProvider* ap,
                                          FilterFunction filter) noexcept {
+  if (!str.contains("{{")) {
+    return str;  // fast path: nothing to substitute (and thus to filter)
+  }
+
   int           startPos           = 0;
   int           length             = 0;
   int           outerVariableStart = -1;
@@ -90,8 +94,8 @@ bool AttributeSubstitutor::searchVariablesInText(const QString& text,
                                                  int startPos, int& pos,
                                                  int&         length,
                                                  QStringList& keys) noexcept {
-  QRegularExpression      re("\\{\\{(.*?)\\}\\}");
-  QRegularExpressionMatch match = re.match(text, startPos);
+  static const QRegularExpression re("\\{\\{(.*?)\\}\\}");
+  QRegularExpressionMatch         match = re.match(text, startPos);
   if (match.hasMatch() && match.capturedLength() > 0) {
     pos = match.capturedStart();
     if (text.midRef(pos).startsWith("{{ '}}' }}")) {
@@ -101,6 +101,11 @@ public:
     return mRestringViaMax;
   }
 
+  // Getters: Clearances
+  const UnsignedLength& getCopperClearance() const noexcept {
+    return mCopperClearance;
+  }
+
   // Setters: General Attributes
   void setName(const ElementName& name) noexcept { mName = name; }
   void setDescription(const QString& desc) noexcept { mDescription = desc; }
@@ -134,6 +139,11 @@ public:
   void setRestringViaBounds(const UnsignedLength& min,
                             const UnsignedLength& max);
 
+  // Setters: Clearances
+  void setCopperClearance(const UnsignedLength& clearance) noexcept {
+    mCopperClearance = clearance;
+  }
+
   // General Methods
   void restoreDefaults() noexcept;
 
@@ -173,6 +183,9 @@ private:
   UnsignedRatio  mRestringViaRatio;
   UnsignedLength mRestringViaMin;
   UnsignedLength mRestringViaMax;
+
+  // Clearances
+  UnsignedLength mCopperClearance;
 };
 
 /*******************************************************************************
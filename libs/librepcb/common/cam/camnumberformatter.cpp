@@ -0,0 +1,91 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "camnumberformatter.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void CamNumberFormatter::appendInteger(QByteArray& output,
+                                       qint64      value) noexcept {
+  char    buffer[24];
+  char*   end = buffer + sizeof(buffer);
+  char*   pos = end;
+  quint64 abs = (value < 0) ? (0 - static_cast<quint64>(value))
+                            : static_cast<quint64>(value);
+  do {
+    *--pos = static_cast<char>('0' + (abs % 10));
+    abs /= 10;
+  } while (abs > 0);
+  if (value < 0) {
+    *--pos = '-';
+  }
+  output.append(pos, static_cast<int>(end - pos));
+}
+
+void CamNumberFormatter::appendDecimal(QByteArray& output, qint64 value,
+                                       int pointPos) noexcept {
+  Q_ASSERT((pointPos > 0) && (pointPos <= 20));
+  char    buffer[48];
+  char*   end = buffer + sizeof(buffer);
+  char*   pos = end;
+  quint64 abs = (value < 0) ? (0 - static_cast<quint64>(value))
+                            : static_cast<quint64>(value);
+
+  // decimal digits, without trailing zeros
+  bool trailingZero = true;
+  for (int i = 0; i < pointPos; ++i) {
+    char digit = static_cast<char>('0' + (abs % 10));
+    abs /= 10;
+    if (trailingZero && (digit == '0')) continue;
+    trailingZero = false;
+    *--pos       = digit;
+  }
+  if (trailingZero) {
+    *--pos = '0';  // at least one decimal digit
+  }
+  *--pos = '.';
+
+  // integer digits
+  do {
+    *--pos = static_cast<char>('0' + (abs % 10));
+    abs /= 10;
+  } while (abs > 0);
+  if (value < 0) {
+    *--pos = '-';
+  }
+  output.append(pos, static_cast<int>(end - pos));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,86 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CAMNUMBERFORMATTER_H
+#define LIBREPCB_CAMNUMBERFORMATTER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class CamNumberFormatter
+ ******************************************************************************/
+
+/**
+ * @brief Fast formatting of numbers for Gerber and Excellon files
+ *
+ * CAM files may contain millions of coordinates, so formatting them through
+ * QString is a significant part of the export time. These functions write
+ * the ASCII digits into a stack buffer and append them to the output without
+ * any locale handling or temporary allocations.
+ */
+class CamNumberFormatter final {
+public:
+  // Constructors / Destructor
+  CamNumberFormatter()                                = delete;
+  CamNumberFormatter(const CamNumberFormatter& other) = delete;
+  ~CamNumberFormatter()                               = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Append an integer in decimal notation (e.g. "-1234")
+   *
+   * @param output  The buffer to append the number to
+   * @param value   The number to append
+   */
+  static void appendInteger(QByteArray& output, qint64 value) noexcept;
+
+  /**
+   * @brief Append a fixed point decimal number (e.g. "-1.25")
+   *
+   * The format is the same as of
+   * librepcb::Toolbox::decimalFixedPointToString(), i.e. trailing zeros are
+   * omitted but there is always at least one decimal digit.
+   *
+   * @param output    The buffer to append the number to
+   * @param value     The number to append
+   * @param pointPos  Number of fixed point decimal positions (max. 20)
+   */
+  static void appendDecimal(QByteArray& output, qint64 value,
+                            int pointPos) noexcept;
+
+  // Operator Overloadings
+  CamNumberFormatter& operator=(const CamNumberFormatter& rhs) = delete;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_CAMNUMBERFORMATTER_H
@@ -23,9 +23,13 @@
 #include "excellongenerator.h"
 
 #include "../fileio/fileutils.h"
+#include "camnumberformatter.h"
 
 #include <QtCore>
 
+#include <algorithm>
+#include <functional>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -35,12 +39,29 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-ExcellonGenerator::ExcellonGenerator() noexcept : mOutput() {
+ExcellonGenerator::ExcellonGenerator() noexcept
+  : mOutput(),
+    mOptimizeDrillOrder(false),
+    mRepeatColumns(1),
+    mRepeatRows(1),
+    mRepeatStep() {
 }
 
 ExcellonGenerator::~ExcellonGenerator() noexcept {
 }
 
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void ExcellonGenerator::setStepAndRepeat(int columns, int rows,
+                                         const Point& step) noexcept {
+  Q_ASSERT((columns >= 1) && (rows >= 1));
+  mRepeatColumns = columns;
+  mRepeatRows    = rows;
+  mRepeatStep    = step;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -58,7 +79,7 @@ void ExcellonGenerator::generate() {
 }
 
 void ExcellonGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::writeFile(filepath, mOutput);  // can throw
 }
 
 void ExcellonGenerator::reset() noexcept {
@@ -66,6 +87,29 @@ void ExcellonGenerator::reset() noexcept {
   mDrillList.clear();
 }
 
+QByteArray ExcellonGenerator::calcFingerprint() const noexcept {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(qApp->applicationVersion().toUtf8());
+  hash.addData(mOptimizeDrillOrder ? "optimized\n" : "unordered\n");
+  hash.addData(QString("%1 %2 %3 %4\n")
+                   .arg(mRepeatColumns)
+                   .arg(mRepeatRows)
+                   .arg(mRepeatStep.getX().toNm())
+                   .arg(mRepeatStep.getY().toNm())
+                   .toLatin1());
+  for (auto it = mDrillList.constBegin(); it != mDrillList.constEnd(); ++it) {
+    QByteArray line;
+    CamNumberFormatter::appendInteger(line, it.key().toNm());
+    line.append(' ');
+    CamNumberFormatter::appendInteger(line, it.value().getX().toNm());
+    line.append(' ');
+    CamNumberFormatter::appendInteger(line, it.value().getY().toNm());
+    line.append('\n');
+    hash.addData(line);
+  }
+  return hash.result().toHex();
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -75,10 +119,12 @@ void ExcellonGenerator::printHeader() noexcept {
 
   // Comments
   mOutput.append(";DRILL FILE\n");
-  mOutput.append(
-      QString(";Generated by LibrePCB %1\n").arg(qApp->applicationVersion()));
+  mOutput.append(QString(";Generated by LibrePCB %1\n")
+                     .arg(qApp->applicationVersion())
+                     .toLatin1());
   mOutput.append(QString(";Creation Date: %1\n")
-                     .arg(QDateTime::currentDateTime().toString(Qt::ISODate)));
+                     .arg(QDateTime::currentDateTime().toString(Qt::ISODate))
+                     .toLatin1());
   mOutput.append("FMAT,2\n");     // Use Format 2 commands
   mOutput.append("METRIC,TZ\n");  // Metric Format, Trailing Zeros Mode
 
@@ -91,20 +137,46 @@ void ExcellonGenerator::printHeader() noexcept {
 }
 
 void ExcellonGenerator::printToolList() noexcept {
-  for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-    Length dia = mDrillList.uniqueKeys().value(i);
-    mOutput.append(QString("T%1C%2\n").arg(i + 1).arg(dia.toMmString()));
+  QList<Length> diameters = mDrillList.uniqueKeys();
+  for (int i = 0; i < diameters.count(); ++i) {
+    mOutput.append('T');
+    CamNumberFormatter::appendInteger(mOutput, i + 1);
+    mOutput.append('C');
+    CamNumberFormatter::appendDecimal(mOutput, diameters.at(i).toNm(), 6);
+    mOutput.append('\n');
   }
 }
 
 void ExcellonGenerator::printDrills() noexcept {
-  for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-    mOutput.append(QString("T%1\n").arg(i + 1));  // Select Tool
-    Length dia = mDrillList.uniqueKeys().value(i);
-    foreach (const Point& pos, mDrillList.values(dia)) {
-      mOutput.append(
-          QString("X%1Y%2\n")
-              .arg(pos.getX().toMmString(), pos.getY().toMmString()));
+  QList<Length> diameters = mDrillList.uniqueKeys();
+  Point         lastPos(0, 0);  // the drill starts at the origin
+  for (int i = 0; i < diameters.count(); ++i) {
+    mOutput.append('T');
+    CamNumberFormatter::appendInteger(mOutput, i + 1);
+    mOutput.append('\n');
+    QList<Point> positions = mDrillList.values(diameters.at(i));
+    if ((mRepeatColumns > 1) || (mRepeatRows > 1)) {
+      QList<Point> board = positions;
+      positions.clear();
+      for (int row = 0; row < mRepeatRows; ++row) {
+        for (int col = 0; col < mRepeatColumns; ++col) {
+          Point offset(mRepeatStep.getX() * col, mRepeatStep.getY() * row);
+          foreach (const Point& pos, board) {
+            positions.append(pos + offset);
+          }
+        }
+      }
+    }
+    if (mOptimizeDrillOrder) {
+      positions = sortByNearestNeighbour(positions, lastPos);
+      lastPos   = positions.last();
+    }
+    foreach (const Point& pos, positions) {
+      mOutput.append('X');
+      CamNumberFormatter::appendDecimal(mOutput, pos.getX().toNm(), 6);
+      mOutput.append('Y');
+      CamNumberFormatter::appendDecimal(mOutput, pos.getY().toNm(), 6);
+      mOutput.append('\n');
     }
   }
 }
@@ -114,6 +186,97 @@ void ExcellonGenerator::printFooter() noexcept {
   mOutput.append("M30\n");  // End of Program Rewind
 }
 
+QList<Point> ExcellonGenerator::sortByNearestNeighbour(
+    const QList<Point>& points, Point pos) noexcept {
+  // To find the nearest remaining hit fast, the hits are stored in an
+  // implicit k-d tree: The hit in the middle of each index range splits the
+  // rest of the range at its coordinate along the axis of the bigger extent.
+  // Visited hits are not removed from the tree, but each node stores the
+  // number of not yet visited hits in its subtree to skip empty subtrees.
+  QVector<Point> tree    = points.toVector();
+  const int      count   = tree.count();
+  QVector<int>   pending = QVector<int>(count);  // unvisited hits of subtree
+  QVector<bool>  visited = QVector<bool>(count, false);
+  QVector<bool>  splitY  = QVector<bool>(count, false);
+  std::function<void(int, int)> build = [&](int begin, int end) {
+    if (begin >= end) return;
+    Length minX = tree.at(begin).getX(), maxX = minX;
+    Length minY = tree.at(begin).getY(), maxY = minY;
+    for (int i = begin; i < end; ++i) {
+      minX = std::min(minX, tree.at(i).getX());
+      maxX = std::max(maxX, tree.at(i).getX());
+      minY = std::min(minY, tree.at(i).getY());
+      maxY = std::max(maxY, tree.at(i).getY());
+    }
+    const int  mid = (begin + end) / 2;
+    const bool y   = (maxY - minY) > (maxX - minX);
+    std::nth_element(tree.begin() + begin, tree.begin() + mid,
+                     tree.begin() + end, [y](const Point& a, const Point& b) {
+                       return y ? (a.getY() < b.getY()) : (a.getX() < b.getX());
+                     });
+    splitY[mid]  = y;
+    pending[mid] = end - begin;
+    build(begin, mid);
+    build(mid + 1, end);
+  };
+  build(0, count);
+
+  int   best     = -1;
+  qreal bestDist = 0;
+  std::function<void(int, int)> search = [&](int begin, int end) {
+    if (begin >= end) return;
+    const int mid = (begin + end) / 2;
+    if (pending.at(mid) == 0) return;
+    const Point& hit = tree.at(mid);
+    if (!visited.at(mid)) {
+      const qreal dx   = (hit.getX() - pos.getX()).toNm();
+      const qreal dy   = (hit.getY() - pos.getY()).toNm();
+      const qreal dist = dx * dx + dy * dy;
+      if ((best < 0) || (dist < bestDist)) {
+        best     = mid;
+        bestDist = dist;
+      }
+    }
+    // Search the side of the splitting line containing the position first,
+    // the other side only if it might contain a nearer hit.
+    const qreal diff = splitY.at(mid) ? (pos.getY() - hit.getY()).toNm()
+                                      : (pos.getX() - hit.getX()).toNm();
+    if (diff < 0) {
+      search(begin, mid);
+      if ((best < 0) || (diff * diff < bestDist)) search(mid + 1, end);
+    } else {
+      search(mid + 1, end);
+      if ((best < 0) || (diff * diff < bestDist)) search(begin, mid);
+    }
+  };
+
+  QList<Point> sorted;
+  sorted.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    best = -1;
+    search(0, count);
+    Q_ASSERT(best >= 0);
+    pos = tree.at(best);
+    sorted.append(pos);
+    // mark the hit as visited in all subtrees containing it
+    visited[best] = true;
+    int begin     = 0;
+    int end       = count;
+    while (true) {
+      const int mid = (begin + end) / 2;
+      --pending[mid];
+      if (best == mid) {
+        break;
+      } else if (best < mid) {
+        end = mid;
+      } else {
+        begin = mid + 1;
+      }
+    }
+  }
+  return sorted;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
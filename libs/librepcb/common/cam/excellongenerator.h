@@ -52,7 +52,35 @@ public:
   ~ExcellonGenerator() noexcept;
 
   // Getters
-  const QString& toStr() const noexcept { return mOutput; }
+  const QByteArray& toByteArray() const noexcept { return mOutput; }
+
+  // Setters
+
+  /**
+   * @brief Enable or disable optimizing the order of the drill hits
+   *
+   * If enabled, the hits of each tool are sorted to reduce the travel of the
+   * drill machine (greedy nearest neighbour tour, starting at the last hit of
+   * the previous tool). Otherwise they are written in the order they were
+   * added. Disabled by default.
+   *
+   * @param optimize  Whether to optimize the order or not
+   */
+  void setOptimizeDrillOrder(bool optimize) noexcept {
+    mOptimizeDrillOrder = optimize;
+  }
+
+  /**
+   * @brief Repeat all hits in a grid (e.g. to create a panel)
+   *
+   * Since the step and repeat commands of Excellon are not widely supported,
+   * every hit is written once per copy.
+   *
+   * @param columns   Number of copies along the X axis (at least 1)
+   * @param rows      Number of copies along the Y axis (at least 1)
+   * @param step      Distance between two neighbouring copies
+   */
+  void setStepAndRepeat(int columns, int rows, const Point& step) noexcept;
 
   // General Methods
   void drill(const Point& pos, const PositiveLength& dia) noexcept;
@@ -60,6 +88,15 @@ public:
   void saveToFile(const FilePath& filepath) const;
   void reset() noexcept;
 
+  /**
+   * @brief Calculate a checksum over everything which affects the output
+   *
+   * @see librepcb::GerberGenerator::calcFingerprint()
+   *
+   * @return SHA-256 checksum as hex string
+   */
+  QByteArray calcFingerprint() const noexcept;
+
   // Operator Overloadings
   ExcellonGenerator& operator=(const ExcellonGenerator& rhs) = delete;
 
@@ -68,10 +105,16 @@ private:
   void printToolList() noexcept;
   void printDrills() noexcept;
   void printFooter() noexcept;
+  static QList<Point> sortByNearestNeighbour(const QList<Point>& points,
+                                             Point               pos) noexcept;
 
   // Excellon Data
-  QString                  mOutput;
+  QByteArray               mOutput;  ///< ASCII file content
   QMultiMap<Length, Point> mDrillList;
+  bool  mOptimizeDrillOrder;  ///< See #setOptimizeDrillOrder()
+  int   mRepeatColumns;       ///< See #setStepAndRepeat()
+  int   mRepeatRows;          ///< See #setStepAndRepeat()
+  Point mRepeatStep;          ///< See #setStepAndRepeat()
 };
 
 /*******************************************************************************
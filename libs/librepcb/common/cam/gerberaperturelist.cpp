@@ -46,12 +46,18 @@ GerberApertureList::~GerberApertureList() noexcept {
 QString GerberApertureList::generateString() const noexcept {
   QString str;
   str.append("G04 --- APERTURE LIST BEGIN --- *\n");
-  foreach (const QString& macro, mApertureMacros) {
-    str.append(QString("%AM%1*%\n").arg(macro));
+  QStringList macros;
+  foreach (const Aperture& aperture, mApertures) {
+    QString macro = generateMacro(aperture);
+    if ((!macro.isEmpty()) && (!macros.contains(macro))) {
+      str.append(QString("%AM%1*%\n").arg(macro));
+      macros.append(macro);
+    }
   }
-  foreach (int number, mApertures.keys()) {
-    str.append(
-        QString("%ADD%1%2*%\n").arg(number).arg(mApertures.value(number)));
+  for (int i = 0; i < mApertures.count(); ++i) {
+    str.append(QString("%ADD%1%2*%\n")
+                   .arg(i + 10)
+                   .arg(generateDefinition(mApertures.at(i))));
   }
   str.append("G04 --- APERTURE LIST END --- *\n");
   return str;
@@ -63,25 +69,20 @@ QString GerberApertureList::generateString() const noexcept {
 
 int GerberApertureList::setCircle(const UnsignedLength& dia,
                                   const UnsignedLength& hole) {
-  return setCurrentAperture(generateCircle(dia, hole));
+  return setCurrentAperture(Aperture(Shape::Circle, dia, dia, Angle(0), hole));
 }
 
 int GerberApertureList::setRect(const UnsignedLength& w,
                                 const UnsignedLength& h, const Angle& rot,
                                 const UnsignedLength& hole) noexcept {
   if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateRect(w, h, hole));
+    return setCurrentAperture(Aperture(Shape::Rect, w, h, Angle(0), hole));
   } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateRect(h, w, hole));
+    return setCurrentAperture(Aperture(Shape::Rect, h, w, Angle(0), hole));
   } else {
     // Rotation is not a multiple of 90 degrees --> we need to use an aperture
     // macro
-    if (hole > 0) {
-      addMacro(generateRotatedRectMacroWithHole());
-    } else {
-      addMacro(generateRotatedRectMacro());
-    }
-    return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
+    return setCurrentAperture(Aperture(Shape::RotatedRect, w, h, rot, hole));
   }
 }
 
@@ -89,18 +90,14 @@ int GerberApertureList::setObround(const UnsignedLength& w,
                                    const UnsignedLength& h, const Angle& rot,
                                    const UnsignedLength& hole) noexcept {
   if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateObround(w, h, hole));
+    return setCurrentAperture(Aperture(Shape::Obround, w, h, Angle(0), hole));
   } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateObround(h, w, hole));
+    return setCurrentAperture(Aperture(Shape::Obround, h, w, Angle(0), hole));
   } else {
     // Rotation is not a multiple of 90 degrees --> we need to use an aperture
     // macro
-    if (hole > 0) {
-      addMacro(generateRotatedObroundMacroWithHole());
-    } else {
-      addMacro(generateRotatedObroundMacro());
-    }
-    return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
+    return setCurrentAperture(
+        Aperture(Shape::RotatedObround, w, h, rot, hole));
   }
 }
 
@@ -115,31 +112,62 @@ int GerberApertureList::setRegularPolygon(const UnsignedLength& dia, int n,
   // Adjust rotation as its interpretation differs between LibrePCB and Gerber
   // specs
   Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
-  return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+  return setCurrentAperture(
+      Aperture(Shape::RegularPolygon, dia, dia, grbRot, hole, n));
 }
 
 void GerberApertureList::reset() noexcept {
-  // mApertureMacros.clear();
   mApertures.clear();
+  mApertureNumbers.clear();
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept {
-  int number = mApertures.key(aperture, -1);
-  if (number < 0) {
-    number = mApertures.count() + 10;  // 10 is the number of the first aperture
-    Q_ASSERT(!mApertures.contains(number));
-    mApertures.insert(number, aperture);
+int GerberApertureList::setCurrentAperture(const Aperture& aperture) noexcept {
+  auto it = mApertureNumbers.constFind(aperture);
+  if (it != mApertureNumbers.constEnd()) {
+    return it.value();
   }
+  int number = mApertures.count() + 10;  // 10 is the number of the first one
+  mApertures.append(aperture);
+  mApertureNumbers.insert(aperture, number);
   return number;
 }
 
-void GerberApertureList::addMacro(const QString& macro) noexcept {
-  if (!mApertureMacros.contains(macro)) {
-    mApertureMacros.append(macro);
+QString GerberApertureList::generateMacro(const Aperture& aperture) noexcept {
+  switch (aperture.shape) {
+    case Shape::RotatedRect:
+      return (aperture.hole > 0) ? generateRotatedRectMacroWithHole()
+                                 : generateRotatedRectMacro();
+    case Shape::RotatedObround:
+      return (aperture.hole > 0) ? generateRotatedObroundMacroWithHole()
+                                 : generateRotatedObroundMacro();
+    default:
+      return QString();  // no macro needed
+  }
+}
+
+QString GerberApertureList::generateDefinition(
+    const Aperture& aperture) noexcept {
+  const Aperture& a = aperture;
+  switch (a.shape) {
+    case Shape::Circle:
+      return generateCircle(a.width, a.hole);
+    case Shape::Rect:
+      return generateRect(a.width, a.height, a.hole);
+    case Shape::Obround:
+      return generateObround(a.width, a.height, a.hole);
+    case Shape::RegularPolygon:
+      return generateRegularPolygon(a.width, a.vertices, a.rotation, a.hole);
+    case Shape::RotatedRect:
+      return generateRotatedRect(a.width, a.height, a.rotation, a.hole);
+    case Shape::RotatedObround:
+      return generateRotatedObround(a.width, a.height, a.rotation, a.hole);
+    default:
+      Q_ASSERT(false);
+      return QString();
   }
 }
 
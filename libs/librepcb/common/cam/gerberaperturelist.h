@@ -69,9 +69,43 @@ public:
   GerberApertureList& operator=(const GerberApertureList& rhs) = delete;
 
 private:
+  // Private Types
+  enum class Shape {
+    Circle,
+    Rect,
+    Obround,
+    RegularPolygon,
+    RotatedRect,
+    RotatedObround,
+  };
+  struct Aperture {
+    Shape          shape;
+    UnsignedLength width;  ///< Diameter for circles and polygons
+    UnsignedLength height;
+    Angle          rotation;
+    UnsignedLength hole;
+    int            vertices;  ///< Only used for regular polygons
+
+    Aperture(Shape s, const UnsignedLength& w, const UnsignedLength& h,
+             const Angle& rot, const UnsignedLength& d, int n = 0) noexcept
+      : shape(s), width(w), height(h), rotation(rot), hole(d), vertices(n) {}
+    bool operator==(const Aperture& rhs) const noexcept {
+      return (shape == rhs.shape) && (width == rhs.width) &&
+             (height == rhs.height) && (rotation == rhs.rotation) &&
+             (hole == rhs.hole) && (vertices == rhs.vertices);
+    }
+    friend uint qHash(const Aperture& key, uint seed = 0) noexcept {
+      return ::qHash(static_cast<int>(key.shape), seed) ^
+             qHash(qMakePair(key.width, key.height), seed) ^
+             qHash(qMakePair(key.rotation, key.hole), seed) ^
+             ::qHash(key.vertices, seed);
+    }
+  };
+
   // Private Methods
-  int  setCurrentAperture(const QString& aperture) noexcept;
-  void addMacro(const QString& macro) noexcept;
+  int            setCurrentAperture(const Aperture& aperture) noexcept;
+  static QString generateMacro(const Aperture& aperture) noexcept;
+  static QString generateDefinition(const Aperture& aperture) noexcept;
 
   // Aperture Generator Methods
   static QString generateCircle(const UnsignedLength& dia,
@@ -96,9 +130,8 @@ private:
                                         const Angle&          rot,
                                         const UnsignedLength& hole) noexcept;
 
-  QList<QString> mApertureMacros;
-  QMap<int, QString>
-      mApertures;  ///< key: aperture number (>= 10); value: aperture definition
+  QList<Aperture>      mApertures;  ///< index + 10 = aperture number
+  QHash<Aperture, int> mApertureNumbers;  ///< value: aperture number (>= 10)
 };
 
 /*******************************************************************************
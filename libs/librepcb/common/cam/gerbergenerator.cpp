@@ -26,6 +26,7 @@
 #include "../geometry/circle.h"
 #include "../geometry/path.h"
 #include "../toolbox.h"
+#include "camnumberformatter.h"
 #include "gerberaperturelist.h"
 
 #include <QtCore>
@@ -48,12 +49,28 @@ GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
     mContent(),
     mApertureList(new GerberApertureList()),
     mCurrentApertureNumber(-1),
-    mMultiQuadrantArcModeOn(false) {
+    mMultiQuadrantArcModeOn(false),
+    mArcRecoveryTolerance(),
+    mRepeatColumns(1),
+    mRepeatRows(1),
+    mRepeatStep() {
 }
 
 GerberGenerator::~GerberGenerator() noexcept {
 }
 
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void GerberGenerator::setStepAndRepeat(int columns, int rows,
+                                       const Point& step) noexcept {
+  Q_ASSERT((columns >= 1) && (rows >= 1));
+  mRepeatColumns = columns;
+  mRepeatRows    = rows;
+  mRepeatStep    = step;
+}
+
 /*******************************************************************************
  *  Plot Methods
  ******************************************************************************/
@@ -93,11 +110,14 @@ void GerberGenerator::drawCircleArea(const Circle& circle) noexcept {
 }
 
 void GerberGenerator::drawPathOutline(
-    const Path& path, const UnsignedLength& lineWidth) noexcept {
-  if (path.getVertices().count() < 2) {
+    const Path& original, const UnsignedLength& lineWidth) noexcept {
+  if (original.getVertices().count() < 2) {
     qWarning() << "Invalid path was ignored in gerber output!";
     return;
   }
+  Path path = mArcRecoveryTolerance
+      ? Path::recoverArcs(original, *mArcRecoveryTolerance)
+      : original;
   setCurrentAperture(mApertureList->setCircle(lineWidth, UnsignedLength(0)));
   moveToPosition(path.getVertices().first().getPos());
   for (int i = 1; i < path.getVertices().count(); ++i) {
@@ -125,11 +145,14 @@ void GerberGenerator::drawPathOutline(
   }
 }
 
-void GerberGenerator::drawPathArea(const Path& path) noexcept {
-  if (!path.isClosed()) {
+void GerberGenerator::drawPathArea(const Path& original) noexcept {
+  if (!original.isClosed()) {
     qWarning() << "Non-closed path was ignored in gerber output!";
     return;
   }
+  Path path = mArcRecoveryTolerance
+      ? Path::recoverArcs(original, *mArcRecoveryTolerance)
+      : original;
   setCurrentAperture(
       mApertureList->setCircle(UnsignedLength(0), UnsignedLength(0)));
   setRegionModeOn();
@@ -208,7 +231,24 @@ void GerberGenerator::generate() {
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::writeFile(filepath, mOutput);  // can throw
+}
+
+QByteArray GerberGenerator::calcFingerprint() const noexcept {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(qApp->applicationVersion().toUtf8());
+  hash.addData(mProjectId.toUtf8());
+  hash.addData(mProjectUuid.toStr().toUtf8());
+  hash.addData(mProjectRevision.toUtf8());
+  hash.addData(QString("%1 %2 %3 %4\n")
+                   .arg(mRepeatColumns)
+                   .arg(mRepeatRows)
+                   .arg(mRepeatStep.getX().toNm())
+                   .arg(mRepeatStep.getY().toNm())
+                   .toLatin1());
+  hash.addData(mApertureList->generateString().toLatin1());
+  hash.addData(mContent);
+  return hash.result().toHex();
 }
 
 /*******************************************************************************
@@ -217,7 +257,9 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const {
 
 void GerberGenerator::setCurrentAperture(int number) noexcept {
   if (number != mCurrentApertureNumber) {
-    mContent.append(QString("D%1*\n").arg(number));
+    mContent.append('D');
+    CamNumberFormatter::appendInteger(mContent, number);
+    mContent.append("*\n");
     mCurrentApertureNumber = number;
   }
 }
@@ -257,13 +299,13 @@ void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept {
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D02*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos);
+  mContent.append("D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D01*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos);
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start,
@@ -273,14 +315,24 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start,
   if (!mMultiQuadrantArcModeOn) {
     diff.makeAbs();  // no sign allowed in single quadrant mode!
   }
-  mContent.append(QString("X%1Y%2I%3J%4D01*\n")
-                      .arg(end.getX().toNmString(), end.getY().toNmString(),
-                           diff.getX().toNmString(), diff.getY().toNmString()));
+  appendCoordinates(end);
+  mContent.append('I');
+  CamNumberFormatter::appendInteger(mContent, diff.getX().toNm());
+  mContent.append('J');
+  CamNumberFormatter::appendInteger(mContent, diff.getY().toNm());
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D03*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos);
+  mContent.append("D03*\n");
+}
+
+void GerberGenerator::appendCoordinates(const Point& pos) noexcept {
+  mContent.append('X');
+  CamNumberFormatter::appendInteger(mContent, pos.getX().toNm());
+  mContent.append('Y');
+  CamNumberFormatter::appendInteger(mContent, pos.getY().toNm());
 }
 
 void GerberGenerator::printHeader() noexcept {
@@ -293,11 +345,18 @@ void GerberGenerator::printHeader() noexcept {
   QString projUuid     = mProjectUuid.toStr();
   QString projRevision = mProjectRevision.remove(',');
   mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
-                     .arg(appVersion));
-  mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
+                     .arg(appVersion)
+                     .toLatin1());
+  mOutput.append(
+      QString("%TF.CreationDate,%1*%\n").arg(creationDate).toLatin1());
   mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n")
-                     .arg(projId, projUuid, projRevision));
-  mOutput.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
+                     .arg(projId, projUuid, projRevision)
+                     .toLatin1());
+  if (isRepeated()) {
+    mOutput.append("%TF.Part,Array*%\n");  // "Array" means "this is a panel"
+  } else {
+    mOutput.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
+  }
   // mOutput.append("%TF.FilePolarity,Positive*%\n");
 
   // coordinate format specification:
@@ -320,29 +379,50 @@ void GerberGenerator::printHeader() noexcept {
 }
 
 void GerberGenerator::printApertureList() noexcept {
-  mOutput.append(mApertureList->generateString());
+  mOutput.append(mApertureList->generateString().toLatin1());
 }
 
 void GerberGenerator::printContent() noexcept {
+  if (isRepeated()) {
+    mOutput.append("%SRX");
+    CamNumberFormatter::appendInteger(mOutput, mRepeatColumns);
+    mOutput.append('Y');
+    CamNumberFormatter::appendInteger(mOutput, mRepeatRows);
+    mOutput.append('I');
+    CamNumberFormatter::appendDecimal(mOutput, mRepeatStep.getX().toNm(), 6);
+    mOutput.append('J');
+    CamNumberFormatter::appendDecimal(mOutput, mRepeatStep.getY().toNm(), 6);
+    mOutput.append("*%\n");
+  }
   mOutput.append("G04 --- BOARD BEGIN --- *\n");
   mOutput.append(mContent);
   mOutput.append("G04 --- BOARD END --- *\n");
+  if (isRepeated()) {
+    mOutput.append("%SR*%\n");
+  }
 }
 
 void GerberGenerator::printFooter() noexcept {
   // MD5 checksum over content
-  mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+  mOutput.append("%TF.MD5,").append(calcOutputMd5Checksum()).append("*%\n");
 
   // end of file
   mOutput.append("M02*\n");
 }
 
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept {
+QByteArray GerberGenerator::calcOutputMd5Checksum() const noexcept {
   // according to the RS-274C standard, linebreaks are not included in the
-  // checksum
-  QString data = QString(mOutput).remove(QChar('\n'));
-  return QString(
-      QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+  // checksum, so hash the output line by line to avoid copying it
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  const char*        data  = mOutput.constData();
+  int                start = 0;
+  while (start < mOutput.size()) {
+    int end = mOutput.indexOf('\n', start);
+    if (end < 0) end = mOutput.size();
+    hash.addData(data + start, end - start);
+    start = end + 1;
+  }
+  return hash.result().toHex();
 }
 
 /*******************************************************************************
@@ -356,8 +436,9 @@ QString GerberGenerator::escapeString(const QString& str) noexcept {
   // Note: Even if backslashes are allowed, we will remove them because we
   // haven't implemented proper escaping. Escaping of unicode characters is also
   // missing here.
-  QString validChars("[a-zA-Z0-9_+-/!?<>”’(){}.|&@# ,;$:=]");
-  ret.remove(QRegularExpression(QString("[^%1]").arg(validChars)));
+  static const QRegularExpression invalidChars(
+      "[^[a-zA-Z0-9_+-/!?<>”’(){}.|&@# ,;$:=]]");
+  ret.remove(invalidChars);
   // limit length to 65535 characters
   ret.truncate(65535);
   return ret;
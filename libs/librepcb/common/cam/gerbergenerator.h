@@ -28,6 +28,8 @@
 #include "../units/all_length_units.h"
 #include "../uuid.h"
 
+#include <optional/tl/optional.hpp>
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -66,7 +68,40 @@ public:
   ~GerberGenerator() noexcept;
 
   // Getters
-  const QString& toStr() const noexcept { return mOutput; }
+  const QByteArray& toByteArray() const noexcept { return mOutput; }
+
+  // Setters
+
+  /**
+   * @brief Repeat the whole image in a grid (e.g. to create a panel)
+   *
+   * The image is still generated only once, but wrapped in a step and
+   * repeat block (`%SR`), so the file size does not depend on the number of
+   * copies.
+   *
+   * @param columns   Number of copies along the X axis (at least 1)
+   * @param rows      Number of copies along the Y axis (at least 1)
+   * @param step      Distance between two neighbouring copies
+   */
+  void setStepAndRepeat(int columns, int rows, const Point& step) noexcept;
+
+  /**
+   * @brief Export flattened arcs of paths as circular interpolations
+   *
+   * Arc segments of paths are always exported as `G02`/`G03` circular
+   * interpolations. If a tolerance is set, paths drawn afterwards are also
+   * checked for straight segments approximating arcs (e.g. plane fragments
+   * calculated by Clipper), which are then exported as real arcs too. See
+   * librepcb::Path::recoverArcs() for details.
+   *
+   * @param tolerance   Maximum deviation of the replaced segments from the
+   *                    arc, or `tl::nullopt` to export them as they are
+   *                    (default)
+   */
+  void setArcRecoveryTolerance(
+      const tl::optional<PositiveLength>& tolerance) noexcept {
+    mArcRecoveryTolerance = tolerance;
+  }
 
   // Plot Methods
   void setLayerPolarity(LayerPolarity p) noexcept;
@@ -94,29 +129,46 @@ public:
   void generate();
   void saveToFile(const FilePath& filepath) const;
 
+  /**
+   * @brief Calculate a checksum over everything which affects the output
+   *
+   * In contrast to a checksum of the generated file content, this does not
+   * depend on volatile data like the creation date. So it can be used to
+   * detect whether a previously generated file is still up to date, without
+   * having to call #generate().
+   *
+   * @return SHA-256 checksum as hex string
+   */
+  QByteArray calcFingerprint() const noexcept;
+
   // Operator Overloadings
   GerberGenerator& operator=(const GerberGenerator& rhs) = delete;
 
 private:
   // Private Methods
-  void    setCurrentAperture(int number) noexcept;
-  void    setRegionModeOn() noexcept;
-  void    setRegionModeOff() noexcept;
-  void    setMultiQuadrantArcModeOn() noexcept;
-  void    setMultiQuadrantArcModeOff() noexcept;
-  void    switchToLinearInterpolationModeG01() noexcept;
-  void    switchToCircularCwInterpolationModeG02() noexcept;
-  void    switchToCircularCcwInterpolationModeG03() noexcept;
-  void    moveToPosition(const Point& pos) noexcept;
-  void    linearInterpolateToPosition(const Point& pos) noexcept;
-  void    circularInterpolateToPosition(const Point& start, const Point& center,
-                                        const Point& end) noexcept;
-  void    flashAtPosition(const Point& pos) noexcept;
-  void    printHeader() noexcept;
-  void    printApertureList() noexcept;
-  void    printContent() noexcept;
-  void    printFooter() noexcept;
-  QString calcOutputMd5Checksum() const noexcept;
+  void       setCurrentAperture(int number) noexcept;
+  void       setRegionModeOn() noexcept;
+  void       setRegionModeOff() noexcept;
+  void       setMultiQuadrantArcModeOn() noexcept;
+  void       setMultiQuadrantArcModeOff() noexcept;
+  void       switchToLinearInterpolationModeG01() noexcept;
+  void       switchToCircularCwInterpolationModeG02() noexcept;
+  void       switchToCircularCcwInterpolationModeG03() noexcept;
+  void       moveToPosition(const Point& pos) noexcept;
+  void       linearInterpolateToPosition(const Point& pos) noexcept;
+  void       circularInterpolateToPosition(const Point& start,
+                                           const Point& center,
+                                           const Point& end) noexcept;
+  void       flashAtPosition(const Point& pos) noexcept;
+  void       appendCoordinates(const Point& pos) noexcept;
+  void       printHeader() noexcept;
+  void       printApertureList() noexcept;
+  void       printContent() noexcept;
+  void       printFooter() noexcept;
+  bool       isRepeated() const noexcept {
+    return (mRepeatColumns > 1) || (mRepeatRows > 1);
+  }
+  QByteArray calcOutputMd5Checksum() const noexcept;
 
   // Static Methods
   static QString escapeString(const QString& str) noexcept;
@@ -127,11 +179,17 @@ private:
   QString mProjectRevision;
 
   // Gerber Data
-  QString                            mOutput;
-  QString                            mContent;
+  QByteArray                         mOutput;   ///< ASCII file content
+  QByteArray                         mContent;  ///< ASCII board data
   QScopedPointer<GerberApertureList> mApertureList;
   int                                mCurrentApertureNumber;
   bool                               mMultiQuadrantArcModeOn;
+  tl::optional<PositiveLength>       mArcRecoveryTolerance;
+
+  // Step and Repeat (see #setStepAndRepeat())
+  int   mRepeatColumns;
+  int   mRepeatRows;
+  Point mRepeatStep;
 };
 
 /*******************************************************************************
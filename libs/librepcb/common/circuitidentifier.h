@@ -41,9 +41,9 @@ namespace librepcb {
 
 inline static QString cleanCircuitIdentifier(
     const QString& userInput) noexcept {
-  return Toolbox::cleanUserInputString(
-      userInput, QRegularExpression("[^-a-zA-Z0-9_+/!?@#$]"), true, false,
-      false, "_", 32);
+  static const QRegularExpression re("[^-a-zA-Z0-9_+/!?@#$]");
+  return Toolbox::cleanUserInputString(userInput, re, true, false, false, "_",
+                                       32);
 }
 
 struct CircuitIdentifierVerifier {
@@ -62,8 +62,8 @@ struct CircuitIdentifierVerifier {
 
 struct CircuitIdentifierConstraint {
   bool operator()(const QString& value) const noexcept {
-    return QRegularExpression("^[-a-zA-Z0-9_+/!?@#$]{1,32}$")
-        .match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
+    static const QRegularExpression re("^[-a-zA-Z0-9_+/!?@#$]{1,32}$");
+    return re.match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
         .hasMatch();
   }
 };
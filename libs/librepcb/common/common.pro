@@ -15,7 +15,7 @@ DEFINES += BUILD_OUTPUT_DIRECTORY="\\\"$${OUTPUT_DIR_ABS}\\\""
 DEFINES += SHARE_DIRECTORY_SOURCE="\\\"$${SHARE_DIR_ABS}\\\""
 DEFINES += GIT_COMMIT_SHA="\\\"$(shell git -C \""$$_PRO_FILE_PWD_"\" rev-parse --verify HEAD)\\\""
 
-QT += core widgets xml opengl network sql
+QT += core widgets xml opengl network sql concurrent
 
 CONFIG += staticlib
 
@@ -23,7 +23,6 @@ INCLUDEPATH += \
     ../../ \
     ../../fontobene \
     ../../quazip \
-    ../../sexpresso \
     ../../type_safe/include \
     ../../type_safe/external/debug_assert \
 
@@ -46,6 +45,7 @@ SOURCES += \
     attributes/attrtypevoltage.cpp \
     attributes/cmd/cmdattributeedit.cpp \
     boarddesignrules.cpp \
+    cam/camnumberformatter.cpp \
     cam/excellongenerator.cpp \
     cam/gerberaperturelist.cpp \
     cam/gerbergenerator.cpp \
@@ -63,7 +63,10 @@ SOURCES += \
     fileio/directorylock.cpp \
     fileio/filepath.cpp \
     fileio/fileutils.cpp \
+    fileio/mappedfile.cpp \
+    fileio/pathtrie.cpp \
     fileio/sexpression.cpp \
+    fileio/sexpressioncache.cpp \
     fileio/transactionaldirectory.cpp \
     fileio/transactionalfilesystem.cpp \
     fileio/versionfile.cpp \
@@ -116,8 +119,11 @@ SOURCES += \
     units/point.cpp \
     units/ratio.cpp \
     utils/clipperhelpers.cpp \
+    utils/clipperpathcache.cpp \
     utils/exclusiveactiongroup.cpp \
     utils/graphicslayerstackappearancesettings.cpp \
+    utils/performancecounters.cpp \
+    utils/profiler.cpp \
     utils/toolbarproxy.cpp \
     utils/undostackactiongroup.cpp \
     uuid.cpp \
@@ -155,6 +161,7 @@ HEADERS += \
     attributes/attrtypevoltage.h \
     attributes/cmd/cmdattributeedit.h \
     boarddesignrules.h \
+    cam/camnumberformatter.h \
     cam/excellongenerator.h \
     cam/gerberaperturelist.h \
     cam/gerbergenerator.h \
@@ -178,10 +185,13 @@ HEADERS += \
     fileio/filepath.h \
     fileio/filesystem.h \
     fileio/fileutils.h \
+    fileio/mappedfile.h \
+    fileio/pathtrie.h \
     fileio/serializablekeyvaluemap.h \
     fileio/serializableobject.h \
     fileio/serializableobjectlist.h \
     fileio/sexpression.h \
+    fileio/sexpressioncache.h \
     fileio/transactionaldirectory.h \
     fileio/transactionalfilesystem.h \
     fileio/versionfile.h \
@@ -241,8 +251,15 @@ HEADERS += \
     units/point.h \
     units/ratio.h \
     utils/clipperhelpers.h \
+    utils/clipperpathcache.h \
+    utils/disjointsets.h \
     utils/exclusiveactiongroup.h \
     utils/graphicslayerstackappearancesettings.h \
+    utils/indexedlist.h \
+    utils/objectpool.h \
+    utils/performancecounters.h \
+    utils/profiler.h \
+    utils/taskscheduler.h \
     utils/toolbarproxy.h \
     utils/undostackactiongroup.h \
     uuid.h \
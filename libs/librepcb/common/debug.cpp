@@ -31,6 +31,22 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Class Debug::WriterThread
+ ******************************************************************************/
+
+class Debug::WriterThread final : public QThread {
+public:
+  explicit WriterThread(Debug& debug) noexcept : QThread(), mDebug(debug) {}
+  ~WriterThread() noexcept {}
+
+protected:
+  void run() noexcept override { mDebug.writerLoop(); }
+
+private:
+  Debug& mDebug;
+};
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -40,7 +56,12 @@ Debug::Debug()
     mDebugLevelLogFile(DebugLevel_t::Nothing),
     mStderrStream(new QTextStream(stderr)),
     mLogFilepath(),
-    mLogFile(0) {
+    mLogFile(0),
+    mWriterBusy(false),
+    mStopWriter(false),
+    mWriterThread(nullptr) {
+  mStartupTimer.start();
+
   // determine the filename of the log file which will be used if logging is
   // enabled
   QString datetime =
@@ -50,11 +71,25 @@ Debug::Debug()
   if (!dataDir.isEmpty())
     mLogFilepath.setPath(dataDir % "/logs/" % datetime % ".log");
 
+  // start the thread which writes the messages in background
+  mWriterThread = new WriterThread(*this);
+  mWriterThread->start(QThread::LowPriority);
+
   // install the message handler for Qt's debug functions (qDebug(), ...)
   qInstallMessageHandler(messageHandler);
 }
 
 Debug::~Debug() {
+  // write all pending messages and stop the writer thread
+  {
+    QMutexLocker locker(&mQueueMutex);
+    mStopWriter = true;
+    mQueueCondition.wakeAll();
+  }
+  mWriterThread->wait();
+  delete mWriterThread;
+  mWriterThread = nullptr;
+
   delete mStderrStream;
   mStderrStream = 0;
 
@@ -80,23 +115,31 @@ void Debug::setDebugLevelLogFile(DebugLevel_t level) {
       (level != DebugLevel_t::Nothing)) {
     // enable logging to file
     QDir().mkpath(mLogFilepath.getParentDir().toStr());
-    mLogFile     = new QFile(mLogFilepath.toStr());
-    bool success = mLogFile->open(QFile::WriteOnly);
+    QFile* file    = new QFile(mLogFilepath.toStr());
+    bool   success = file->open(QFile::WriteOnly);
     if (success) {
+      {
+        QMutexLocker locker(&mMutex);
+        mLogFile = file;
+      }
       mDebugLevelLogFile = level;  // activate logging to file immediately!
       qDebug() << "Enabled logging to file:" << mLogFilepath.toNative();
     } else {
       qWarning() << "Cannot enable logging to file" << mLogFilepath.toNative();
-      qWarning() << "Error message:" << mLogFile->errorString();
-      delete mLogFile;
-      mLogFile = 0;
+      qWarning() << "Error message:" << file->errorString();
+      delete file;
     }
   } else if ((mDebugLevelLogFile != DebugLevel_t::Nothing) &&
              (level == DebugLevel_t::Nothing) && (mLogFile)) {
-    // disable logging to file
-    mLogFile->close();
-    delete mLogFile;
-    mLogFile = 0;
+    // disable logging to file, but write pending messages first
+    flush();
+    QFile* file = nullptr;
+    {
+      QMutexLocker locker(&mMutex);
+      std::swap(file, mLogFile);
+    }
+    file->close();
+    delete file;
   }
 
   mDebugLevelLogFile = level;
@@ -114,53 +157,120 @@ const FilePath& Debug::getLogFilepath() const {
   return mLogFilepath;
 }
 
+qint64 Debug::getElapsedTimeSinceStartup() const noexcept {
+  return mStartupTimer.elapsed();
+}
+
 void Debug::print(DebugLevel_t level, const QString& msg, const char* file,
                   int line) {
-  QMutexLocker locker(&mMutex);
+  // If there is nothing to print, return immediately from this function,
+  // without any formatting or locking.
+  bool toStderr  = (mDebugLevelStderr >= level);
+  bool toLogFile = (mDebugLevelLogFile >= level);
+  if ((!toStderr) && (!toLogFile)) {
+    return;
+  }
 
-  if ((mDebugLevelStderr < level) &&
-      ((mDebugLevelLogFile < level) || (!mLogFile)))
-    return;  // if there is nothing to print, we will return immediately from
-             // this function
+  Message message{level, msg, file, line, toStderr, toLogFile};
+  QMutexLocker locker(&mQueueMutex);
+  if (mWriterThread && (!mStopWriter)) {
+    mQueue.append(message);
+    mQueueCondition.wakeOne();
+  } else {
+    // writer thread not running (anymore), thus write synchronously
+    locker.unlock();
+    write({message});
+  }
+}
 
-  const char* levelStr =
-      "---------";  // the debug level string has always 9 characters
-  switch (level) {
-    case DebugLevel_t::DebugMsg:
-      levelStr = "DEBUG-MSG";
-      break;
-    case DebugLevel_t::Info:
-      levelStr = "  INFO   ";
-      break;
-    case DebugLevel_t::Warning:
-      levelStr = " WARNING ";
-      break;
-    case DebugLevel_t::Exception:
-      levelStr = "EXCEPTION";
-      break;
-    case DebugLevel_t::Critical:
-      levelStr = "CRITICAL ";
-      break;
-    case DebugLevel_t::Fatal:
-      levelStr = "  FATAL  ";
-      break;
-    default:
-      break;
+void Debug::flush() noexcept {
+  QMutexLocker locker(&mQueueMutex);
+  if ((!mWriterThread) || (QThread::currentThread() == mWriterThread)) {
+    return;  // nothing to wait for, or we would wait forever
+  }
+  while ((!mQueue.isEmpty()) || mWriterBusy) {
+    mFlushedCondition.wait(&mQueueMutex);
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void Debug::writerLoop() noexcept {
+  QMutexLocker locker(&mQueueMutex);
+  while (true) {
+    while (mQueue.isEmpty() && (!mStopWriter)) {
+      mQueueCondition.wait(&mQueueMutex);
+    }
+    if (mQueue.isEmpty()) {
+      break;  // stop requested and all messages written
+    }
+    // take all messages at once and write them without holding the lock
+    QVector<Message> messages;
+    messages.swap(mQueue);
+    mWriterBusy = true;
+    locker.unlock();
+    write(messages);
+    locker.relock();
+    mWriterBusy = false;
+    mFlushedCondition.wakeAll();
+  }
+}
+
+void Debug::write(const QVector<Message>& messages) noexcept {
+  QMutexLocker locker(&mMutex);
+  QTextStream  logFileStream;
+  if (mLogFile) {
+    logFileStream.setDevice(mLogFile);
   }
 
-  QString logMsg = QString("[%1] %2 (%3:%4)")
-                       .arg(levelStr, msg.toLocal8Bit().constData(), file)
-                       .arg(line);
+  foreach (const Message& message, messages) {
+    const char* levelStr =
+        "---------";  // the debug level string has always 9 characters
+    switch (message.level) {
+      case DebugLevel_t::DebugMsg:
+        levelStr = "DEBUG-MSG";
+        break;
+      case DebugLevel_t::Info:
+        levelStr = "  INFO   ";
+        break;
+      case DebugLevel_t::Warning:
+        levelStr = " WARNING ";
+        break;
+      case DebugLevel_t::Exception:
+        levelStr = "EXCEPTION";
+        break;
+      case DebugLevel_t::Critical:
+        levelStr = "CRITICAL ";
+        break;
+      case DebugLevel_t::Fatal:
+        levelStr = "  FATAL  ";
+        break;
+      default:
+        break;
+    }
+
+    QString logMsg =
+        QString("[%1] %2 (%3:%4)")
+            .arg(levelStr, message.msg.toLocal8Bit().constData(), message.file)
+            .arg(message.line);
+
+    if (message.toStderr) {
+      // write to stderr
+      *mStderrStream << logMsg << '\n';
+    }
 
-  if (mDebugLevelStderr >= level) {
-    // write to stderr
-    *mStderrStream << logMsg << endl;
+    if (message.toLogFile && mLogFile) {
+      // write to the log file
+      logFileStream << logMsg << '\n';
+    }
   }
 
-  if ((mDebugLevelLogFile >= level) && (mLogFile)) {
-    // write to the log file
-    QTextStream logFileStream(mLogFile);
-    logFileStream << logMsg << endl;
+  // flush only once per batch of messages
+  mStderrStream->flush();
+  if (mLogFile) {
+    logFileStream.flush();
   }
 }
 
@@ -191,6 +301,7 @@ void Debug::messageHandler(QtMsgType type, const QMessageLogContext& context,
 
     case QtFatalMsg:
       instance()->print(DebugLevel_t::Fatal, msg, context.file, context.line);
+      instance()->flush();
       abort();  // fatal error --> quit the whole application!
 
     default:
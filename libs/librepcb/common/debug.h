@@ -54,6 +54,11 @@ namespace librepcb {
  * This class can write messages to the stderr output and to a log file. You can
  * set seperate debug levels for both. By default, logging to a file is
  * disabled.
+ *
+ * Messages are written asynchronously by a background thread to keep logging
+ * cheap for the calling thread. Messages not accepted by any of the outputs
+ * are dropped immediately without formatting them. Use #flush() to wait until
+ * all messages are written (done automatically for fatal errors).
  */
 class Debug final {
 public:
@@ -117,6 +122,16 @@ public:
    */
   const FilePath& getLogFilepath() const;
 
+  /**
+   * @brief Get the time elapsed since the Debug object was created
+   *
+   * The singleton is created very early in main(), so this is the time since
+   * the application was started. Useful to log the duration of the startup.
+   *
+   * @return Elapsed time in milliseconds
+   */
+  qint64 getElapsedTimeSinceStartup() const noexcept;
+
   /**
    * @brief Print a message to stderr/logfile (with respect to the current debug
    * level)
@@ -129,12 +144,19 @@ public:
    * @param level     The debug level of the message (DO NOT USE "Nothing" and
    * "All"!)
    * @param msg       The message
-   * @param file      The source file (use the macro __FILE__)
+   * @param file      The source file (use the macro __FILE__). Since the
+   *                  message is written asynchronously, the string must be
+   *                  static!
    * @param line      The line number (use the macro __LINE__)
    */
   void print(DebugLevel_t level, const QString& msg, const char* file,
              int line);
 
+  /**
+   * @brief Block until all pending messages are written to stderr/logfile
+   */
+  void flush() noexcept;
+
   // Static methods
 
   /**
@@ -152,7 +174,19 @@ public:
     return &dbg;
   }
 
-private:
+private:  // Types
+  class WriterThread;
+
+  struct Message {
+    DebugLevel_t level;
+    QString      msg;
+    const char*  file;
+    int          line;
+    bool         toStderr;
+    bool         toLogFile;
+  };
+
+private:  // Methods
   // make some methods inaccessible...
   Debug();
   Debug(const Debug& other);
@@ -169,6 +203,18 @@ private:
   static void messageHandler(QtMsgType type, const QMessageLogContext& context,
                              const QString& msg);
 
+  /**
+   * @brief Main loop of the background thread which writes queued messages
+   */
+  void writerLoop() noexcept;
+
+  /**
+   * @brief Format messages and write them to stderr/logfile
+   *
+   * @param messages  The messages to write
+   */
+  void write(const QVector<Message>& messages) noexcept;
+
   // General Attributes
   DebugLevel_t
       mDebugLevelStderr;  ///< the current debug level for the stderr output
@@ -177,7 +223,19 @@ private:
   QTextStream* mStderrStream;       ///< the stream to stderr
   FilePath     mLogFilepath;        ///< the filepath for the log file
   QFile*       mLogFile;            ///< NULL if file logging is disabled
-  QMutex       mMutex;              ///< for thread safety
+  QMutex       mMutex;              ///< for the stderr/logfile streams
+
+  // Startup Time
+  QElapsedTimer mStartupTimer;  ///< Started in the constructor
+
+  // Asynchronous Writing
+  QMutex           mQueueMutex;        ///< protects the queue & flags below
+  QWaitCondition   mQueueCondition;    ///< wakes up the writer thread
+  QWaitCondition   mFlushedCondition;  ///< signals written messages
+  QVector<Message> mQueue;             ///< messages not written yet
+  bool             mWriterBusy;        ///< writer thread is writing
+  bool             mStopWriter;        ///< writer thread shall quit
+  WriterThread*    mWriterThread;      ///< NULL if writing synchronously
 };
 
 /*******************************************************************************
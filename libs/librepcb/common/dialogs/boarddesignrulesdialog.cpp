@@ -104,6 +104,9 @@ void BoardDesignRulesDialog::updateWidgets() noexcept {
       mDesignRules.getRestringViaRatio()->toPercent());
   mUi->spbxRestringViasMin->setValue(mDesignRules.getRestringViaMin()->toMm());
   mUi->spbxRestringViasMax->setValue(mDesignRules.getRestringViaMax()->toMm());
+  // clearances
+  mUi->spbxCopperClearance->setValue(
+      mDesignRules.getCopperClearance()->toMm());
 }
 
 void BoardDesignRulesDialog::applyRules() noexcept {
@@ -140,6 +143,9 @@ void BoardDesignRulesDialog::applyRules() noexcept {
         UnsignedLength(Length::fromMm(mUi->spbxRestringViasMin->value())),
         UnsignedLength(
             Length::fromMm(mUi->spbxRestringViasMax->value())));  // can throw
+    // clearances
+    mDesignRules.setCopperClearance(UnsignedLength(
+        Length::fromMm(mUi->spbxCopperClearance->value())));  // can throw
   } catch (const Exception& e) {
     QMessageBox::warning(this, tr("Could not apply settings"), e.getMsg());
   }
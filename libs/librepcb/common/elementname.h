@@ -68,7 +68,9 @@ struct ElementNameConstraint {
   bool operator()(const QString& value) const noexcept {
     if (value.isEmpty()) return false;
     if (value.length() > 70) return false;
-    if (value != value.trimmed()) return false;
+    if (value.at(0).isSpace() || value.at(value.length() - 1).isSpace()) {
+      return false;  // not trimmed
+    }
     foreach (const QChar& c, value) {
       if (!c.isPrint()) return false;
     }
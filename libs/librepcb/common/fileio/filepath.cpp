@@ -223,7 +223,8 @@ QString FilePath::cleanFileName(const QString&       userInput,
   // perform compatibility decomposition (NFKD)
   QString ret = userInput.normalized(QString::NormalizationForm_KD);
   // remove all invalid characters
-  ret.remove(QRegularExpression("[^-._ 0-9A-Za-z]"));
+  static const QRegularExpression invalidChars("[^-._ 0-9A-Za-z]");
+  ret.remove(invalidChars);
   // remove leading and trailing spaces
   ret = ret.trimmed();
   // replace remaining spaces with underscore (if corresponding option set)
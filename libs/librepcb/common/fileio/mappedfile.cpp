@@ -0,0 +1,79 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "mappedfile.h"
+
+#include "../exceptions.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+MappedFile::MappedFile(const QByteArray& content) noexcept
+  : mFile(), mData(nullptr), mContent(content) {
+}
+
+MappedFile::MappedFile(const FilePath& filepath)
+  : mFile(filepath.toStr()), mData(nullptr), mContent() {
+  if (!filepath.isExistingFile()) {
+    throw LogicError(__FILE__, __LINE__,
+                     QString(tr("The file \"%1\" does not exist."))
+                         .arg(filepath.toNative()));
+  }
+  if (!mFile.open(QIODevice::ReadOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Cannot open file \"%1\": %2"))
+                           .arg(filepath.toNative(), mFile.errorString()));
+  }
+  qint64 size = mFile.size();
+  if ((size > 0) && (size <= std::numeric_limits<int>::max())) {
+    mData = mFile.map(0, size);
+  }
+  if (mData) {
+    // Note: The file must be kept open since closing it unmaps the memory.
+    mContent = QByteArray::fromRawData(reinterpret_cast<const char*>(mData),
+                                       static_cast<int>(size));
+  } else {
+    mContent = mFile.readAll();
+    mFile.close();
+  }
+}
+
+MappedFile::~MappedFile() noexcept {
+  mContent.clear();  // release the raw data before unmapping it
+  if (mData) {
+    mFile.unmap(mData);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
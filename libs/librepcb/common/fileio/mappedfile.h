@@ -0,0 +1,84 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_MAPPEDFILE_H
+#define LIBREPCB_MAPPEDFILE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class MappedFile
+ ******************************************************************************/
+
+/**
+ * @brief Read-only view to the content of a file
+ *
+ * If possible, the file is memory-mapped so its content is backed by the
+ * page cache of the operating system instead of being copied into heap
+ * memory. If mapping is not possible (e.g. for empty files or unsupported
+ * file systems), the file is read into memory as a fallback. In addition, a
+ * view can also be created from content which is already in memory.
+ *
+ * @warning The byte array returned by #getContent() does not own its data,
+ *          so neither it nor any copy of it must be used after this object
+ *          has been destroyed. Also the file must not be modified in place
+ *          while it is mapped (replacing it atomically with
+ *          librepcb::FileUtils::writeFile() is fine on Unix).
+ */
+class MappedFile final {
+  Q_DECLARE_TR_FUNCTIONS(MappedFile)
+
+public:
+  // Constructors / Destructor
+  MappedFile()                        = delete;
+  MappedFile(const MappedFile& other) = delete;
+  explicit MappedFile(const QByteArray& content) noexcept;
+  explicit MappedFile(const FilePath& filepath);
+  ~MappedFile() noexcept;
+
+  // Getters
+  const QByteArray& getContent() const noexcept { return mContent; }
+  bool              isMapped() const noexcept { return mData != nullptr; }
+
+  // Operator Overloadings
+  MappedFile& operator=(const MappedFile& rhs) = delete;
+
+private:  // Data
+  QFile      mFile;
+  uchar*     mData;  ///< Start of the mapped memory, or nullptr if not mapped
+  QByteArray mContent;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_MAPPEDFILE_H
@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "pathtrie.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+bool PathTrie::contains(const QString& path) const noexcept {
+  auto it = mNodes.constFind(splitPath(path).join('/'));
+  return (it != mNodes.constEnd()) && it->contained;
+}
+
+bool PathTrie::containsPathOrParent(const QString& path) const noexcept {
+  QString key;  // root
+  auto    it = mNodes.constFind(key);
+  if (it == mNodes.constEnd()) {
+    return false;  // empty trie
+  } else if (it->contained) {
+    return true;
+  }
+  foreach (const QString& name, splitPath(path)) {
+    key = childKey(key, name);
+    it  = mNodes.constFind(key);
+    if (it == mNodes.constEnd()) {
+      return false;  // there are no deeper nodes either
+    } else if (it->contained) {
+      return true;
+    }
+  }
+  return false;
+}
+
+QStringList PathTrie::getPaths(const QString& dir) const noexcept {
+  QStringList paths;
+  collectPaths(splitPath(dir).join('/'), paths);
+  return paths;
+}
+
+QStringList PathTrie::getDirs(const QString& dir) const noexcept {
+  QStringList dirs;
+  QString     key = splitPath(dir).join('/');
+  auto        it  = mNodes.constFind(key);
+  if (it != mNodes.constEnd()) {
+    foreach (const QString& name, it->children) {
+      if (!mNodes.value(childKey(key, name)).children.isEmpty()) {
+        dirs.append(name);
+      }
+    }
+  }
+  return dirs;
+}
+
+QStringList PathTrie::getFiles(const QString& dir) const noexcept {
+  QStringList files;
+  QString     key = splitPath(dir).join('/');
+  auto        it  = mNodes.constFind(key);
+  if (it != mNodes.constEnd()) {
+    foreach (const QString& name, it->children) {
+      if (mNodes.value(childKey(key, name)).contained) {
+        files.append(name);
+      }
+    }
+  }
+  return files;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+bool PathTrie::insert(const QString& path) noexcept {
+  QString key;  // root
+  Node*   node = &mNodes[key];
+  foreach (const QString& name, splitPath(path)) {
+    node->children.insert(name);
+    key  = childKey(key, name);
+    node = &mNodes[key];  // Note: Might invalidate the previous node.
+  }
+  if (node->contained) {
+    return false;
+  }
+  node->contained = true;
+  ++mCount;
+  return true;
+}
+
+bool PathTrie::remove(const QString& path) noexcept {
+  QStringList names = splitPath(path);
+  QString     key   = names.join('/');
+  auto        it    = mNodes.find(key);
+  if ((it == mNodes.end()) || (!it->contained)) {
+    return false;
+  }
+  it->contained = false;
+  --mCount;
+
+  // remove all nodes which are not needed anymore, from the bottom up
+  while ((!it->contained) && it->children.isEmpty()) {
+    mNodes.erase(it);
+    if (names.isEmpty()) {
+      break;  // root removed
+    }
+    QString name = names.takeLast();
+    key          = names.join('/');
+    it           = mNodes.find(key);
+    Q_ASSERT(it != mNodes.end());
+    it->children.remove(name);
+  }
+  return true;
+}
+
+QStringList PathTrie::removeRecursively(const QString& dir) noexcept {
+  QStringList paths = getPaths(dir);
+  foreach (const QString& path, paths) { remove(path); }
+  return paths;
+}
+
+void PathTrie::clear() noexcept {
+  mNodes.clear();
+  mCount = 0;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void PathTrie::collectPaths(const QString& key, QStringList& paths) const
+    noexcept {
+  auto it = mNodes.constFind(key);
+  if (it != mNodes.constEnd()) {
+    if (it->contained) {
+      paths.append(key);
+    }
+    foreach (const QString& name, it->children) {
+      collectPaths(childKey(key, name), paths);
+    }
+  }
+}
+
+QStringList PathTrie::splitPath(const QString& path) noexcept {
+  return path.split('/', QString::SkipEmptyParts);
+}
+
+QString PathTrie::childKey(const QString& key, const QString& name) noexcept {
+  return key.isEmpty() ? name : QString(key % "/" % name);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,182 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PATHTRIE_H
+#define LIBREPCB_PATHTRIE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class PathTrie
+ ******************************************************************************/
+
+/**
+ * @brief A set of relative file or directory paths, organized as a tree
+ *
+ * In contrast to a QSet<QString>, the paths are stored per directory, so
+ * queries like "is this path or one of its parent directories contained?" or
+ * "which paths are contained in this directory?" only depend on the depth of
+ * the path (resp. the number of results), but not on the number of contained
+ * paths. This is used by librepcb::TransactionalFileSystem to keep track of
+ * modified and removed files.
+ *
+ * Paths are separated by slashes. Leading, trailing and duplicate slashes
+ * are ignored, so "foo/bar/" and "foo/bar" are the same path. The empty path
+ * represents the root directory.
+ *
+ * @note The nodes are stored in a QHash, so copying a trie is cheap (implicit
+ *       sharing) and copies can safely be used from other threads.
+ */
+class PathTrie final {
+public:
+  // Constructors / Destructor
+  PathTrie() noexcept : mNodes(), mCount(0) {}
+  PathTrie(const PathTrie& other) noexcept
+    : mNodes(other.mNodes), mCount(other.mCount) {}
+  ~PathTrie() noexcept {}
+
+  // Getters
+  bool isEmpty() const noexcept { return mCount == 0; }
+  int  count() const noexcept { return mCount; }
+
+  /**
+   * @brief Check whether a path is contained
+   *
+   * @param path    The path to look for
+   *
+   * @return True if exactly this path is contained
+   */
+  bool contains(const QString& path) const noexcept;
+
+  /**
+   * @brief Check whether a path or one of its parent directories is contained
+   *
+   * @param path    The path to look for
+   *
+   * @return True if the path itself, one of its parent directories or the
+   *         root directory is contained
+   */
+  bool containsPathOrParent(const QString& path) const noexcept;
+
+  /**
+   * @brief Get all contained paths within a directory (recursively)
+   *
+   * @param dir     The directory (the root directory by default)
+   *
+   * @return All contained paths below the directory, including the directory
+   *         itself if it is contained (in arbitrary order)
+   */
+  QStringList getPaths(const QString& dir = QString()) const noexcept;
+
+  /**
+   * @brief Get the names of all subdirectories containing paths
+   *
+   * @param dir     The parent directory
+   *
+   * @return Names of the direct subdirectories of the directory which contain
+   *         at least one path (in arbitrary order)
+   */
+  QStringList getDirs(const QString& dir) const noexcept;
+
+  /**
+   * @brief Get the names of all contained paths within a directory
+   *
+   * @param dir     The parent directory
+   *
+   * @return Names of the contained paths directly within the directory (in
+   *         arbitrary order)
+   */
+  QStringList getFiles(const QString& dir) const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Add a path
+   *
+   * @param path    The path to add
+   *
+   * @retval true   If the path was added
+   * @retval false  If the path was already contained (nothing changed)
+   */
+  bool insert(const QString& path) noexcept;
+
+  /**
+   * @brief Remove a path
+   *
+   * @param path    The path to remove (paths within it are not removed)
+   *
+   * @retval true   If the path was removed
+   * @retval false  If the path was not contained (nothing changed)
+   */
+  bool remove(const QString& path) noexcept;
+
+  /**
+   * @brief Remove all paths within a directory (recursively)
+   *
+   * @param dir     The directory (the root directory removes all paths)
+   *
+   * @return The removed paths, including the directory itself if it was
+   *         contained (in arbitrary order)
+   */
+  QStringList removeRecursively(const QString& dir) noexcept;
+
+  /**
+   * @brief Remove all paths
+   */
+  void clear() noexcept;
+
+  // Operator Overloadings
+  PathTrie& operator=(const PathTrie& rhs) noexcept {
+    mNodes = rhs.mNodes;
+    mCount = rhs.mCount;
+    return *this;
+  }
+
+private:  // Types
+  struct Node {
+    QSet<QString> children;           ///< Names of the child nodes
+    bool          contained = false;  ///< Whether this path is contained
+  };
+
+private:  // Methods
+  void collectPaths(const QString& key, QStringList& paths) const noexcept;
+  static QStringList splitPath(const QString& path) noexcept;
+  static QString     childKey(const QString& key, const QString& name) noexcept;
+
+private:  // Data
+  QHash<QString, Node> mNodes;  ///< Key: Normalized path of the node
+  int                  mCount;  ///< Number of contained paths
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PATHTRIE_H
@@ -75,15 +75,16 @@ public:
     mValues.insert("", defaultValue);
   }
   explicit SerializableKeyValueMap(const SExpression& node) : onEdited(*this) {
-    foreach (const SExpression& child, node.getChildren(T::tagname)) {
+    static const QString tagname = SExpression::intern(T::tagname);
+    foreach (const SExpression* child, node.getChildren(tagname)) {
       QString     key;
       SExpression value;
-      if (child.getChildren().count() > 1) {
-        key   = child.getValueByPath<QString>(T::keyname);
-        value = child.getChildByIndex(1);
+      if (child->getChildren().count() > 1) {
+        key   = child->getValueByPath<QString>(T::keyname);
+        value = child->getChildByIndex(1);
       } else {
         key   = QString("");
-        value = child.getChildByIndex(0);
+        value = child->getChildByIndex(0);
       }
       if (mValues.contains(key)) {
         throw RuntimeError(
@@ -53,7 +53,8 @@ namespace librepcb {
  *   librepcb::SExpression.
  * - Iterators (for example to use in C++11 range based for loops).
  * - Methods to find elements by UUID and/or name (if supported by template type
- *   `T`).
+ *   `T`). For big lists, the lookups use hash tables which are built lazily on
+ *   first use and kept up to date while elements are appended.
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by
  *   UUID.
  * - Signals to get notified about added, removed and modified elements.
@@ -201,6 +202,10 @@ public:
 
   // Element Query
   int indexOf(const T* obj) const noexcept {
+    if (count() >= minIndexedCount()) {
+      return lookup(mPointerIndex, obj,
+                    [](const T& element) { return &element; });
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i].get() == obj) {
         return i;
@@ -209,6 +214,10 @@ public:
     return -1;
   }
   int indexOf(const Uuid& key) const noexcept {
+    if (count() >= minIndexedCount()) {
+      return lookup(mUuidIndex, key,
+                    [](const T& element) { return element.getUuid(); });
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getUuid() == key) {
         return i;
@@ -217,6 +226,11 @@ public:
     return -1;
   }
   int indexOf(const QString& name) const noexcept {
+    if (count() >= minIndexedCount()) {
+      return lookup(mNameIndex, name, [](const T& element) {
+        return toNameString(element.getName());
+      });
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getName() == name) {
         return i;
@@ -297,8 +311,9 @@ public:
   // General Methods
   int loadFromSExpression(const SExpression& node) {
     clear();
-    foreach (const SExpression& node, node.getChildren(P::tagname)) {
-      append(std::make_shared<T>(node));  // can throw
+    static const QString tagname = SExpression::intern(P::tagname);
+    foreach (const SExpression* node, node.getChildren(tagname)) {
+      append(std::make_shared<T>(*node));  // can throw
     }
     return count();
   }
@@ -412,13 +427,58 @@ public:
     return *this;
   }
 
+protected:  // Types
+  /**
+   * @brief Hash table to find elements by a key
+   *
+   * Only the first #count elements of the list are indexed. So appending
+   * elements keeps the index valid, while inserting or removing elements
+   * before the end of the indexed range invalidates it.
+   */
+  template <typename K>
+  struct Index {
+    QHash<K, int> indices;  ///< Index of the first element with this key
+    int           count = 0;
+
+    void invalidate(int index) noexcept {
+      if (index < count) {
+        indices.clear();
+        count = 0;
+      }
+    }
+  };
+
 protected:  // Methods
+  template <typename K, typename F>
+  int lookup(Index<K>& index, const K& key, F getKey) const noexcept {
+    QMutexLocker locker(&mIndexMutex);
+    for (; index.count < mObjects.count(); ++index.count) {
+      K elementKey = getKey(*mObjects[index.count]);
+      if (!index.indices.contains(elementKey)) {
+        index.indices.insert(elementKey, index.count);
+      }
+    }
+    return index.indices.value(key, -1);
+  }
+  static QString toNameString(const QString& name) noexcept { return name; }
+  template <typename N>
+  static QString toNameString(const N& name) noexcept {
+    return *name;  // e.g. librepcb::ElementName
+  }
+  void invalidateIndices(int index) noexcept {
+    QMutexLocker locker(&mIndexMutex);
+    mPointerIndex.invalidate(index);
+    mUuidIndex.invalidate(index);
+    mNameIndex.invalidate(index);
+  }
   void insertElement(int index, const std::shared_ptr<T>& obj) noexcept {
+    invalidateIndices(index);
     mObjects.insert(index, obj);
     obj->onEdited.attach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementAdded);
   }
   std::shared_ptr<T> takeElement(int index) noexcept {
+    invalidateIndices(index);
     std::shared_ptr<T> obj = mObjects.takeAt(index);
     obj->onEdited.detach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementRemoved);
@@ -427,6 +487,10 @@ protected:  // Methods
   void elementEditedHandler(const T& obj, OnEditedArgs... args) noexcept {
     int index = indexOf(&obj);
     if (contains(index)) {
+      // the name might have been modified
+      QMutexLocker locker(&mIndexMutex);
+      mNameIndex.invalidate(0);
+      locker.unlock();
       onElementEdited.notify(index, at(index), args...);
       onEdited.notify(index, at(index), Event::ElementEdited);
     } else {
@@ -453,9 +517,21 @@ protected:  // Methods
             .arg(name));
   }
 
+  /**
+   * Returns the minimum number of elements to use hash tables for lookups.
+   * Smaller lists are searched linearly, which is faster for them.
+   */
+  static int minIndexedCount() noexcept { return 16; }
+
 protected:  // Data
   QVector<std::shared_ptr<T>> mObjects;
   Slot<T, OnEditedArgs...>    mOnEditedSlot;
+
+  // Cached Lookup Tables
+  mutable QMutex          mIndexMutex;
+  mutable Index<const T*> mPointerIndex;
+  mutable Index<Uuid>     mUuidIndex;
+  mutable Index<QString>  mNameIndex;
 };
 
 }  // namespace librepcb
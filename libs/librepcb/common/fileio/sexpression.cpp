@@ -22,7 +22,8 @@
  ******************************************************************************/
 #include "sexpression.h"
 
-#include <sexpresso/sexpresso.hpp>
+#include "../utils/performancecounters.h"
+#include "../utils/taskscheduler.h"
 
 #include <QtCore>
 
@@ -31,6 +32,388 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Class SExpression::Parser
+ ******************************************************************************/
+
+/**
+ * @brief Single-pass parser which builds an SExpression tree directly from
+ *        the UTF-8 encoded file content
+ *
+ * The input is scanned only once and every node is written directly into its
+ * parent, so no intermediate tree is needed. While scanning, the current line
+ * and column are tracked to provide useful error messages.
+ *
+ * For large files, #parseRootParallel() first scans only the brackets to
+ * split the children of the root node into chunks, which are then parsed by
+ * separate parsers in worker threads.
+ */
+class SExpression::Parser final {
+public:
+  // Constructors / Destructor
+  Parser() = delete;
+  Parser(const Parser& other) = delete;
+  Parser(const QByteArray& content, const FilePath& filePath) noexcept
+    : mFilePath(filePath),
+      mBegin(content.constData()),
+      mPos(content.constData()),
+      mEnd(content.constData() + content.size()),
+      mContentEnd(mEnd),
+      mLineStart(content.constData()),
+      mLine(1) {}
+  ~Parser() noexcept {}
+
+  // General Methods
+
+  /**
+   * @brief Parse the whole content
+   *
+   * @param filter  If not nullptr, only child lists of the root node with one
+   *                of these names are parsed. All other child lists are
+   *                skipped without building (or validating) them.
+   */
+  SExpression parseRoot(const QSet<QString>* filter = nullptr) {
+    skipWhitespaceAndComments();
+    if ((mPos == mEnd) || (*mPos != '(')) {
+      throwError(mLine, getColumn(), tr("Root node is not a list."));
+    }
+    SExpression root(Type::List, QString());
+    root.mFilePath = mFilePath;
+    parseList(root, filter);  // can throw
+    skipWhitespaceAndComments();
+    if (mPos != mEnd) {
+      throwError(mLine, getColumn(),
+                 tr("File does not have exactly one root node."));
+    }
+    return root;
+  }
+
+  SExpression parseRootParallel(int maxChunks) {
+    // Split the children of the root node into chunks of similar size. The
+    // scan does not validate anything except the brackets, so on any error
+    // the whole content is parsed again sequentially to report the error.
+    skipWhitespaceAndComments();
+    if ((mPos == mEnd) || (*mPos != '(')) {
+      return parseRootSequentially();
+    }
+    ++mPos;  // skip '('
+    skipWhitespaceAndComments();
+    if ((mPos == mEnd) || isDelimiter(*mPos)) {
+      return parseRootSequentially();
+    }
+    SExpression root(Type::List, parseToken(true));
+    root.mFilePath = mFilePath;
+    const qint64   minChunkSize = ((mEnd - mPos) / maxChunks) + 1;
+    QVector<Chunk> chunks;
+    forever {
+      skipWhitespaceAndComments();
+      if (mPos == mEnd) {
+        return parseRootSequentially();
+      } else if (*mPos == ')') {
+        break;
+      }
+      if (chunks.isEmpty() || (mPos - chunks.last().begin >= minChunkSize)) {
+        chunks.append(Chunk{mPos, mPos, mLineStart, mLine});
+      }
+      if (!skipChild()) {
+        return parseRootSequentially();
+      }
+      chunks.last().end = mPos;
+    }
+    ++mPos;  // skip ')'
+    skipWhitespaceAndComments();
+    if (mPos != mEnd) {
+      return parseRootSequentially();
+    }
+
+    // Parse the chunks in parallel and put them together in their original
+    // order.
+    QList<QFuture<QList<SExpression>>> futures;
+    foreach (const Chunk& chunk, chunks) {
+      auto parse = [this, chunk]() {
+        Parser parser(chunk, mContentEnd, mFilePath);
+        return parser.parseChildren();  // can throw
+      };
+      futures.append(
+          TaskScheduler::run(TaskScheduler::Priority::Background, parse));
+    }
+    try {
+      for (QFuture<QList<SExpression>>& future : futures) {
+        root.mChildren.append(future.result());  // can throw
+      }
+      root.updateChildIndex();
+    } catch (const Exception&) {
+      for (QFuture<QList<SExpression>>& future : futures) {
+        future.waitForFinished();
+      }
+      return parseRootSequentially();
+    }
+    return root;
+  }
+
+  // Operator Overloadings
+  Parser& operator=(const Parser& rhs) = delete;
+
+private:  // Types
+  struct Chunk {
+    const char* begin;
+    const char* end;
+    const char* lineStart;
+    int         line;
+  };
+
+private:  // Methods
+  Parser(const Chunk& chunk, const char* contentEnd,
+         const FilePath& filePath) noexcept
+    : mFilePath(filePath),
+      mBegin(chunk.begin),
+      mPos(chunk.begin),
+      mEnd(chunk.end),
+      mContentEnd(contentEnd),
+      mLineStart(chunk.lineStart),
+      mLine(chunk.line) {}
+
+  int getColumn() const noexcept { return (mPos - mLineStart) + 1; }
+
+  static bool isDelimiter(char c) noexcept {
+    return (c == '(') || (c == ')') || (c == '"') || (c == ';') ||
+        (c == ' ') || (c == '\n') || (c == '\t') || (c == '\r') ||
+        (c == '\v') || (c == '\f');
+  }
+
+  SExpression parseRootSequentially() {
+    mPos       = mBegin;
+    mLineStart = mBegin;
+    mLine      = 1;
+    return parseRoot();  // can throw
+  }
+
+  QList<SExpression> parseChildren() {
+    QList<SExpression> children;
+    forever {
+      skipWhitespaceAndComments();
+      if (mPos == mEnd) {
+        return children;
+      } else if (*mPos == ')') {
+        throwError(mLine, getColumn(), tr("Unexpected end of list."));
+      }
+      children.append(SExpression());
+      parseChild(children.last());  // can throw
+    }
+  }
+
+  bool skipChild() noexcept {
+    int depth = 0;
+    do {
+      skipWhitespaceAndComments();
+      if (mPos == mEnd) {
+        return false;
+      } else if (*mPos == '(') {
+        ++depth;
+        ++mPos;
+      } else if (*mPos == ')') {
+        if (depth == 0) return false;
+        --depth;
+        ++mPos;
+      } else if (*mPos == '"') {
+        if (!skipString()) return false;
+      } else {
+        while ((mPos < mEnd) && (!isDelimiter(*mPos))) ++mPos;
+      }
+    } while (depth > 0);
+    return true;
+  }
+
+  bool skipString() noexcept {
+    ++mPos;  // skip opening '"'
+    while (mPos < mEnd) {
+      const char c = *mPos++;
+      if (c == '"') {
+        return true;
+      } else if ((c == '\\') && (mPos < mEnd) && (*mPos != '\n')) {
+        ++mPos;
+      } else if (c == '\n') {
+        ++mLine;
+        mLineStart = mPos;
+      }
+    }
+    return false;
+  }
+
+  [[noreturn]] void throwError(int line, int column, const QString& msg) const {
+    const char* lineEnd = mLineStart;
+    while ((lineEnd < mContentEnd) && (*lineEnd != '\n')) ++lineEnd;
+    throw FileParseError(__FILE__, __LINE__, mFilePath, line, column,
+                         QString::fromUtf8(mLineStart, lineEnd - mLineStart),
+                         msg);
+  }
+
+  void skipWhitespaceAndComments() noexcept {
+    while (mPos < mEnd) {
+      switch (*mPos) {
+        case '\n':
+          ++mPos;
+          ++mLine;
+          mLineStart = mPos;
+          break;
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\v':
+        case '\f':
+          ++mPos;
+          break;
+        case ';':
+          while ((mPos < mEnd) && (*mPos != '\n')) ++mPos;
+          break;
+        default:
+          return;
+      }
+    }
+  }
+
+  void parseList(SExpression& list, const QSet<QString>* filter = nullptr) {
+    const int line   = mLine;
+    const int column = getColumn();
+    ++mPos;  // skip '('
+    skipWhitespaceAndComments();
+    if ((mPos == mEnd) || (*mPos == '(') || (*mPos == ')') || (*mPos == '"')) {
+      throwError(mLine, getColumn(), tr("List does not have a name."));
+    }
+    list.mValue = parseToken(true);
+    forever {
+      skipWhitespaceAndComments();
+      if (mPos == mEnd) {
+        throwError(line, column, tr("List is not closed."));
+      } else if (*mPos == ')') {
+        ++mPos;
+        list.updateChildIndex();
+        return;
+      }
+      if (filter && (*mPos == '(') && (!filter->contains(peekListName()))) {
+        if (!skipChild()) {
+          throwError(line, column, tr("List is not closed."));
+        }
+        continue;
+      }
+      list.mChildren.append(SExpression());
+      parseChild(list.mChildren.last());  // can throw
+    }
+  }
+
+  void parseChild(SExpression& child) {
+    child.mFilePath = mFilePath;
+    if (*mPos == '(') {
+      child.mType = Type::List;
+      parseList(child);  // can throw
+    } else if (*mPos == '"') {
+      child.mType  = Type::String;
+      child.mValue = parseString();  // can throw
+    } else {
+      child.mType  = Type::Token;
+      child.mValue = parseToken(false);
+    }
+  }
+
+  QString peekListName() noexcept {
+    const char* start = mPos + 1;  // skip '('
+    const char* end   = start;
+    while ((end < mEnd) && (!isDelimiter(*end))) ++end;
+    return internAtom(start, end - start);
+  }
+
+  QString parseToken(bool isListName) noexcept {
+    const char* start = mPos;
+    while ((mPos < mEnd) && (!isDelimiter(*mPos))) ++mPos;
+    // Intern list names and short identifier-like tokens (e.g. layer names) as
+    // they occur many times. Numbers and UUIDs are (almost) unique, so they
+    // are not worth to be interned.
+    const int length = mPos - start;
+    if (isListName || ((length <= sMaxInternedTokenLength) &&
+                       (((*start >= 'a') && (*start <= 'z')) ||
+                        ((*start >= 'A') && (*start <= 'Z'))))) {
+      return internAtom(start, length);
+    } else {
+      return QString::fromUtf8(start, length);
+    }
+  }
+
+  QString internAtom(const char* data, int length) noexcept {
+    // Note: Look up the local cache first to avoid locking the global pool.
+    QHash<QByteArray, QString>::const_iterator it =
+        mAtoms.constFind(QByteArray::fromRawData(data, length));
+    if (it != mAtoms.constEnd()) {
+      return *it;
+    }
+    QString atom = SExpression::intern(QString::fromUtf8(data, length));
+    mAtoms.insert(QByteArray(data, length), atom);
+    return atom;
+  }
+
+  QString parseString() {
+    const int   line   = mLine;
+    const int   column = getColumn();
+    const char* start  = ++mPos;  // skip opening '"'
+
+    // fast path for strings without escape sequences (the most common case)
+    while ((mPos < mEnd) && (*mPos != '"') && (*mPos != '\\')) {
+      if (*mPos == '\n') {
+        ++mLine;
+        mLineStart = mPos + 1;
+      }
+      ++mPos;
+    }
+    QByteArray buffer(start, mPos - start);
+
+    // slow path for strings containing escape sequences
+    while (mPos < mEnd) {
+      const char c = *mPos++;
+      if (c == '"') {
+        return QString::fromUtf8(buffer);
+      } else if (c == '\\') {
+        if (mPos == mEnd) break;
+        const char escaped = *mPos;
+        const int  index   = sEscapeChars.indexOf(escaped);
+        if (index < 0) {
+          throwError(mLine, getColumn(),
+                     QString(tr("Invalid escape sequence: \\%1"))
+                         .arg(QChar(escaped)));
+        }
+        buffer.append(sEscapeValues.at(index));
+        ++mPos;
+      } else {
+        if (c == '\n') {
+          ++mLine;
+          mLineStart = mPos;
+        }
+        buffer.append(c);
+      }
+    }
+    throwError(line, column, tr("String is not terminated."));
+  }
+
+public:  // Data
+  static const QByteArray sEscapeChars;   ///< Characters after a backslash
+  static const QByteArray sEscapeValues;  ///< Their unescaped values
+
+private:  // Data
+  const FilePath&            mFilePath;
+  const char*                mBegin;
+  const char*                mPos;
+  const char*                mEnd;
+  const char*                mContentEnd;  ///< End of the whole file content
+  const char*                mLineStart;
+  int                        mLine;
+  QHash<QByteArray, QString> mAtoms;  ///< Atoms already interned by this parser
+
+  /// Maximum length of tokens (other than list names) to be interned
+  static const int sMaxInternedTokenLength = 24;
+};
+
+const QByteArray SExpression::Parser::sEscapeChars("\"\\'?abfnrtv", 11);
+const QByteArray SExpression::Parser::sEscapeValues("\"\\'?\a\b\f\n\r\t\v",
+                                                    11);
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -46,31 +429,16 @@ SExpression::SExpression(const SExpression& other) noexcept
   : mType(other.mType),
     mValue(other.mValue),
     mChildren(other.mChildren),
-    mFilePath(other.mFilePath) {
+    mFilePath(other.mFilePath),
+    mChildIndex(other.mChildIndex) {
 }
 
-SExpression::SExpression(sexpresso::Sexp& sexp, const FilePath& filePath)
-  : mType(Type::List), mValue(), mFilePath(filePath) {
-  if (sexp.childCount() < 1) {
-    throw RuntimeError(__FILE__, __LINE__);
-  }
-
-  if (sexp.isSexp()) {
-    sexpresso::Sexp& first = sexp.getChild(0);
-    if (!first.isString()) {
-      throw RuntimeError(__FILE__, __LINE__);
-    }
-    mValue = QString::fromStdString(first.getString());
-    for (auto&& arg : sexp.arguments()) {
-      mChildren.append(SExpression(arg, filePath));
-    }
-  } else if (sexp.isString()) {
-    mValue = QString::fromStdString(sexp.getString());
-    mType  = Type::String;
-  } else {
-    throw FileParseError(__FILE__, __LINE__, mFilePath, -1, -1, QString(),
-                         tr("Unknown node type."));
-  }
+SExpression::SExpression(SExpression&& other) noexcept
+  : mType(other.mType),
+    mValue(std::move(other.mValue)),
+    mChildren(std::move(other.mChildren)),
+    mFilePath(other.mFilePath),
+    mChildIndex(std::move(other.mChildIndex)) {
 }
 
 SExpression::~SExpression() noexcept {
@@ -110,12 +478,20 @@ const QString& SExpression::getStringOrToken(bool throwIfEmpty) const {
   return mValue;
 }
 
-QList<SExpression> SExpression::getChildren(const QString& name) const
+QList<const SExpression*> SExpression::getChildren(const QString& name) const
     noexcept {
-  QList<SExpression> children;
-  foreach (const SExpression& child, mChildren) {
-    if (child.isList() && (child.mValue == name)) {
-      children.append(child);
+  QList<const SExpression*> children;
+  if (mChildren.count() >= sChildIndexThreshold) {
+    const QVector<int> indices = mChildIndex.value(name);
+    children.reserve(indices.count());
+    foreach (int index, indices) {
+      children.append(&mChildren.at(index));
+    }
+  } else {
+    for (const SExpression& child : mChildren) {
+      if (child.isList() && (child.mValue == name)) {
+        children.append(&child);
+      }
     }
   }
   return children;
@@ -131,16 +507,14 @@ const SExpression& SExpression::getChildByIndex(int index) const {
 
 const SExpression* SExpression::tryGetChildByPath(const QString& path) const
     noexcept {
+  // avoid splitting the path since most paths consist of only one name
+  if (!path.contains('/')) {
+    return tryGetLastChildByName(path);
+  }
   const SExpression* child = this;
   foreach (const QString& name, path.split('/')) {
-    bool found = false;
-    foreach (const SExpression& childchild, child->mChildren) {
-      if (childchild.isList() && (childchild.mValue == name)) {
-        child = &childchild;
-        found = true;
-      }
-    }
-    if (!found) {
+    child = child->tryGetLastChildByName(name);
+    if (!child) {
       return nullptr;
     }
   }
@@ -163,6 +537,7 @@ const SExpression& SExpression::getChildByPath(const QString& path) const {
 
 SExpression& SExpression::appendLineBreak() {
   mChildren.append(createLineBreak());
+  updateChildIndexAfterAppend();
   return *this;
 }
 
@@ -175,6 +550,21 @@ SExpression& SExpression::appendChild(const SExpression& child,
   if (mType == Type::List) {
     if (linebreak) appendLineBreak();
     mChildren.append(child);
+    updateChildIndexAfterAppend();
+    return mChildren.last();
+  } else {
+    throw LogicError(__FILE__, __LINE__);
+  }
+}
+
+SExpression& SExpression::appendChild(SExpression&& child, bool linebreak) {
+  if (mType == Type::List) {
+    if (linebreak) appendLineBreak();
+    // Note: QList has no append() for rvalues, so append an empty node and
+    // move the child into it to avoid copying its value and children.
+    mChildren.append(SExpression());
+    mChildren.last() = std::move(child);
+    updateChildIndexAfterAppend();
     return mChildren.last();
   } else {
     throw LogicError(__FILE__, __LINE__);
@@ -187,12 +577,40 @@ void SExpression::removeLineBreaks() noexcept {
       mChildren.removeAt(i);
     }
   }
+  updateChildIndex();
 }
 
 QByteArray SExpression::toByteArray() const {
-  QString str = toString(0);  // can throw
-  str += '\n';                // newline at end of file
-  return str.toUtf8();
+  QByteArray str;
+  serialize(str, 0);  // can throw
+  str += '\n';        // newline at end of file
+  return str;
+}
+
+QByteArray SExpression::toBinary() const {
+  // Note: The nodes are written first to collect all (unique) strings, but
+  // the string table needs to be stored before the nodes.
+  QHash<QString, quint32> strings;
+  QByteArray              nodes;
+  QDataStream             nodesStream(&nodes, QIODevice::WriteOnly);
+  nodesStream.setByteOrder(QDataStream::LittleEndian);
+  serializeBinary(nodesStream, strings);  // can throw
+
+  QVector<QString> stringTable(strings.count());
+  for (auto it = strings.constBegin(); it != strings.constEnd(); ++it) {
+    stringTable[it.value()] = it.key();
+  }
+
+  QByteArray  data;
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  stream.setVersion(QDataStream::Qt_5_2);
+  stream.setByteOrder(QDataStream::LittleEndian);
+  stream << sBinaryFormatVersion << static_cast<quint32>(stringTable.count());
+  foreach (const QString& string, stringTable) {
+    stream << string;
+  }
+  stream.writeRawData(nodes.constData(), nodes.size());
+  return data;
 }
 
 /*******************************************************************************
@@ -200,10 +618,20 @@ QByteArray SExpression::toByteArray() const {
  ******************************************************************************/
 
 SExpression& SExpression::operator=(const SExpression& rhs) noexcept {
-  mType     = rhs.mType;
-  mValue    = rhs.mValue;
-  mChildren = rhs.mChildren;
+  mType       = rhs.mType;
+  mValue      = rhs.mValue;
+  mChildren   = rhs.mChildren;
+  mFilePath   = rhs.mFilePath;
+  mChildIndex = rhs.mChildIndex;
+  return *this;
+}
+
+SExpression& SExpression::operator=(SExpression&& rhs) noexcept {
+  mType = rhs.mType;
+  mValue.swap(rhs.mValue);
+  mChildren.swap(rhs.mChildren);
   mFilePath = rhs.mFilePath;
+  mChildIndex.swap(rhs.mChildIndex);
   return *this;
 }
 
@@ -211,64 +639,236 @@ SExpression& SExpression::operator=(const SExpression& rhs) noexcept {
  *  Private Methods
  ******************************************************************************/
 
-QString SExpression::escapeString(const QString& string) const noexcept {
-  return QString::fromStdString(sexpresso::escape(string.toStdString()));
+const SExpression* SExpression::tryGetLastChildByName(
+    const QString& name) const noexcept {
+  // Note: If there are multiple children with the same name, the last one is
+  // returned (for compatibility with the former implementation).
+  if (mChildren.count() >= sChildIndexThreshold) {
+    QHash<QString, QVector<int>>::const_iterator it =
+        mChildIndex.constFind(name);
+    return (it != mChildIndex.constEnd()) ? &mChildren.at(it->last()) : nullptr;
+  } else {
+    for (int i = mChildren.count() - 1; i >= 0; --i) {
+      const SExpression& child = mChildren.at(i);
+      if (child.isList() && (child.mValue == name)) {
+        return &child;
+      }
+    }
+    return nullptr;
+  }
+}
+
+void SExpression::updateChildIndex() noexcept {
+  mChildIndex.clear();
+  if (mChildren.count() >= sChildIndexThreshold) {
+    for (int i = 0; i < mChildren.count(); ++i) {
+      const SExpression& child = mChildren.at(i);
+      if (child.isList()) {
+        mChildIndex[child.mValue].append(i);
+      }
+    }
+  }
+}
+
+void SExpression::updateChildIndexAfterAppend() noexcept {
+  const int count = mChildren.count();
+  if (count > sChildIndexThreshold) {
+    const SExpression& child = mChildren.last();
+    if (child.isList()) {
+      mChildIndex[child.mValue].append(count - 1);
+    }
+  } else if (count == sChildIndexThreshold) {
+    updateChildIndex();
+  }
 }
 
-bool SExpression::isValidListName(const QString& name) const noexcept {
-  return QRegExp("[a-z][a-z0-9_]*").exactMatch(name);
+void SExpression::appendEscapedString(QByteArray&    out,
+                                      const QString& string) noexcept {
+  const QByteArray utf8 = string.toUtf8();
+  out.reserve(out.size() + utf8.size() + 2);
+  out += '"';
+  for (const char c : utf8) {
+    // Note: Single quotes and question marks wouldn't need to be escaped, but
+    // they always were, so keep escaping them to not modify existing files.
+    // Bytes of multi-byte UTF-8 sequences are never ASCII, thus they are not
+    // affected by this.
+    const int index = Parser::sEscapeValues.indexOf(c);
+    if (index >= 0) {
+      out += '\\';
+      out += Parser::sEscapeChars.at(index);
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
 }
 
-bool SExpression::isValidToken(const QString& token) const noexcept {
-  return QRegExp("[a-zA-Z0-9\\.:_-]+").exactMatch(token);
+bool SExpression::isValidListName(const QString& name) noexcept {
+  // regex: [a-z][a-z0-9_]*
+  if (name.isEmpty() || (name.at(0) < 'a') || (name.at(0) > 'z')) {
+    return false;
+  }
+  foreach (const QChar& c, name) {
+    if (((c < 'a') || (c > 'z')) && ((c < '0') || (c > '9')) && (c != '_')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SExpression::isValidToken(const QString& token) noexcept {
+  // regex: [a-zA-Z0-9\.:_-]+
+  if (token.isEmpty()) {
+    return false;
+  }
+  foreach (const QChar& c, token) {
+    if (((c < 'a') || (c > 'z')) && ((c < 'A') || (c > 'Z')) &&
+        ((c < '0') || (c > '9')) && (c != '.') && (c != ':') && (c != '_') &&
+        (c != '-')) {
+      return false;
+    }
+  }
+  return true;
 }
 
-QString SExpression::toString(int indent) const {
+bool SExpression::serialize(QByteArray& out, int indent) const {
   if (mType == Type::List) {
     if (!isValidListName(mValue)) {
       throw LogicError(
           __FILE__, __LINE__,
           QString(tr("Invalid S-Expression list name: %1")).arg(mValue));
     }
-    QString str = '(' + mValue;
+    // Note: Whether this list is multi-line is determined while serializing
+    // the children, to avoid calling isMultiLineList() recursively.
+    bool multiLine = false;
+    out += '(';
+    out += mValue.toLatin1();  // list names are always ASCII
     for (int i = 0; i < mChildren.count(); ++i) {
-      const SExpression& child = mChildren.at(i);
-      if ((!str.at(str.length() - 1).isSpace()) && (!child.isLineBreak())) {
-        str += ' ';
+      const SExpression& child     = mChildren.at(i);
+      const char         lastChar  = out.at(out.size() - 1);
+      const bool         lastSpace = (lastChar == ' ') || (lastChar == '\n');
+      if ((!lastSpace) && (!child.isLineBreak())) {
+        out += ' ';
       }
       bool nextChildIsLineBreak = (i < mChildren.count() - 1)
                                       ? mChildren.at(i + 1).isLineBreak()
                                       : true;
+      if (child.isLineBreak()) {
+        multiLine = true;
+      }
       if (child.isLineBreak() && nextChildIsLineBreak) {
         if ((i > 0) && mChildren.at(i - 1).isLineBreak()) {
           // too many line breaks ;)
         } else {
-          str += '\n';
+          out += '\n';
         }
-      } else {
-        str += child.toString(indent + 1);
+      } else if (child.serialize(out, indent + 1)) {
+        multiLine = true;
       }
     }
-    if (isMultiLineList()) {
-      str += '\n' + QString(' ').repeated(indent);
+    if (multiLine) {
+      appendIndentation(out, indent);
     }
-    return str + ')';
+    out += ')';
+    return multiLine;
   } else if (mType == Type::Token) {
     if (!isValidToken(mValue)) {
       throw LogicError(
           __FILE__, __LINE__,
           QString(tr("Invalid S-Expression token: %1")).arg(mValue));
     }
-    return mValue;
+    out += mValue.toLatin1();  // tokens are always ASCII
+    return false;
   } else if (mType == Type::String) {
-    return '"' + escapeString(mValue) + '"';
+    appendEscapedString(out, mValue);
+    return false;
   } else if (mType == Type::LineBreak) {
-    return '\n' + QString(' ').repeated(indent);
+    appendIndentation(out, indent);
+    return true;
   } else {
     throw LogicError(__FILE__, __LINE__);
   }
 }
 
+void SExpression::serializeBinary(QDataStream&             stream,
+                                  QHash<QString, quint32>& strings) const {
+  stream << static_cast<quint8>(mType);
+  if (mType != Type::LineBreak) {
+    QHash<QString, quint32>::const_iterator it = strings.constFind(mValue);
+    if (it == strings.constEnd()) {
+      it = strings.insert(mValue, static_cast<quint32>(strings.count()));
+    }
+    stream << it.value();
+  }
+  if (mType == Type::List) {
+    stream << static_cast<quint32>(mChildren.count());
+    foreach (const SExpression& child, mChildren) {
+      child.serializeBinary(stream, strings);  // can throw
+    }
+  }
+}
+
+void SExpression::deserializeBinary(QDataStream&            stream,
+                                    const QVector<QString>& strings,
+                                    int                     depth) {
+  quint8 type = 0;
+  stream >> type;
+  if ((stream.status() != QDataStream::Ok) ||
+      (type > static_cast<quint8>(Type::LineBreak)) || (depth > 1000)) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Invalid binary node."));
+  }
+  mType = static_cast<Type>(type);
+  if (mType != Type::LineBreak) {
+    quint32 index = 0;
+    stream >> index;
+    if (index >= static_cast<quint32>(strings.count())) {
+      throw RuntimeError(__FILE__, __LINE__, tr("Invalid binary node."));
+    }
+    mValue = strings.at(index);
+  }
+  if (mType == Type::List) {
+    quint32 count = 0;
+    stream >> count;
+    if (stream.status() != QDataStream::Ok) {
+      throw RuntimeError(__FILE__, __LINE__, tr("Invalid binary node."));
+    }
+    mChildren.reserve(qMin(count, 100000U));
+    for (quint32 i = 0; i < count; ++i) {
+      mChildren.append(SExpression());
+      SExpression& child = mChildren.last();
+      child.mFilePath    = mFilePath;
+      child.deserializeBinary(stream, strings, depth + 1);  // can throw
+    }
+    updateChildIndex();
+  }
+}
+
+void SExpression::appendIndentation(QByteArray& out, int indent) noexcept {
+  const int oldSize = out.size();
+  out.resize(oldSize + 1 + indent);
+  char* data = out.data() + oldSize;
+  data[0]    = '\n';
+  std::fill(data + 1, data + 1 + indent, ' ');
+}
+
+void SExpression::countParsedNodes(const SExpression& root) noexcept {
+  // Note: The nodes are counted afterwards instead of while parsing to keep
+  // the parser free of any overhead if the counters are disabled.
+  if (PerformanceCounters::isEnabled()) {
+    qint64                    count = 0;
+    QList<const SExpression*> stack = {&root};
+    while (!stack.isEmpty()) {
+      const SExpression* node = stack.takeLast();
+      ++count;
+      for (const SExpression& child : node->mChildren) {
+        stack.append(&child);
+      }
+    }
+    PerformanceCounters::add(
+        PerformanceCounters::Counter::SExpressionNodesParsed, count);
+  }
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
@@ -289,22 +889,77 @@ SExpression SExpression::createLineBreak() {
   return SExpression(Type::LineBreak, QString());
 }
 
+QString SExpression::intern(const QString& atom) noexcept {
+  static QMutex        mutex;
+  static QSet<QString> pool;
+  QMutexLocker         lock(&mutex);
+  QSet<QString>::const_iterator it = pool.constFind(atom);
+  if (it != pool.constEnd()) {
+    return *it;
+  } else {
+    pool.insert(atom);
+    return atom;
+  }
+}
+
 SExpression SExpression::parse(const QByteArray& content,
-                               const FilePath&   filePath) {
-  std::string     error;
-  QString         str  = QString::fromUtf8(content);
-  sexpresso::Sexp tree = sexpresso::parse(str.toStdString(), error);
-  if (error.empty()) {
-    if (tree.childCount() == 1) {
-      return SExpression(tree.getChild(0), filePath);
-    } else {
-      throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
-                           tr("File does not have exactly one root node."));
-    }
+                               const FilePath& filePath, bool parallel) {
+  Parser      parser(content, filePath);
+  const int   threads = QThread::idealThreadCount();
+  SExpression root;
+  if (parallel && (threads > 1) && (content.size() >= sMinParallelParseSize)) {
+    root = parser.parseRootParallel(threads);  // can throw
   } else {
+    root = parser.parseRoot();  // can throw
+  }
+  countParsedNodes(root);
+  return root;
+}
+
+SExpression SExpression::parsePartially(const QByteArray&    content,
+                                        const FilePath&      filePath,
+                                        const QSet<QString>& rootChildNames) {
+  Parser      parser(content, filePath);
+  SExpression root = parser.parseRoot(&rootChildNames);  // can throw
+  countParsedNodes(root);
+  return root;
+}
+
+SExpression SExpression::parseBinary(const QByteArray& content,
+                                     const FilePath&   filePath) {
+  QDataStream stream(content);
+  stream.setVersion(QDataStream::Qt_5_2);
+  stream.setByteOrder(QDataStream::LittleEndian);
+  quint32 version = 0, stringCount = 0;
+  stream >> version >> stringCount;
+  if ((stream.status() != QDataStream::Ok) ||
+      (version != sBinaryFormatVersion) ||
+      (stringCount > static_cast<quint32>(content.size()))) {
+    throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                         tr("Invalid or unsupported binary S-Expression."));
+  }
+  QVector<QString> strings;
+  strings.reserve(stringCount);
+  for (quint32 i = 0; i < stringCount; ++i) {
+    QString string;
+    stream >> string;
+    strings.append(string);
+  }
+  SExpression root;
+  root.mFilePath = filePath;
+  try {
+    root.deserializeBinary(stream, strings, 0);  // can throw
+  } catch (const Exception& e) {
+    throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                         e.getMsg());
+  }
+  if ((stream.status() != QDataStream::Ok) || (!stream.atEnd()) ||
+      (!root.isList())) {
     throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
-                         QString::fromStdString(error));
+                         tr("Invalid or unsupported binary S-Expression."));
   }
+  countParsedNodes(root);
+  return root;
 }
 
 /*******************************************************************************
@@ -32,10 +32,6 @@
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
-namespace sexpresso {
-struct Sexp;
-}
-
 namespace librepcb {
 
 class SExpression;
@@ -53,6 +49,12 @@ T deserializeFromSExpression(const SExpression& sexpr,
 
 /**
  * @brief The SExpression class
+ *
+ * @note To make lookups of children by name fast, list nodes with many
+ *       children keep an index (name -> child positions) which is updated
+ *       whenever the children are modified. Const methods never modify a
+ *       node, so a node can be read concurrently from multiple threads as
+ *       long as it is not modified at the same time.
  */
 class SExpression final {
   Q_DECLARE_TR_FUNCTIONS(SExpression)
@@ -69,6 +71,7 @@ public:
   // Constructors / Destructor
   SExpression() noexcept;
   SExpression(const SExpression& other) noexcept;
+  SExpression(SExpression&& other) noexcept;
   ~SExpression() noexcept;
 
   // Getters
@@ -82,7 +85,7 @@ public:
   const QString&            getName() const;
   const QString&            getStringOrToken(bool throwIfEmpty = false) const;
   const QList<SExpression>& getChildren() const { return mChildren; }
-  QList<SExpression>        getChildren(const QString& name) const noexcept;
+  QList<const SExpression*> getChildren(const QString& name) const noexcept;
   const SExpression&        getChildByIndex(int index) const;
   const SExpression* tryGetChildByPath(const QString& path) const noexcept;
   const SExpression& getChildByPath(const QString& path) const;
@@ -116,6 +119,7 @@ public:
   SExpression& appendLineBreak();
   SExpression& appendList(const QString& name, bool linebreak);
   SExpression& appendChild(const SExpression& child, bool linebreak);
+  SExpression& appendChild(SExpression&& child, bool linebreak);
   template <typename T>
   SExpression& appendChild(const T& obj) {
     appendChild(serializeToSExpression(obj), false);
@@ -127,31 +131,117 @@ public:
   }
   void       removeLineBreaks() noexcept;
   QByteArray toByteArray() const;
+  QByteArray toBinary() const;
 
   // Operator Overloadings
   SExpression& operator=(const SExpression& rhs) noexcept;
+  SExpression& operator=(SExpression&& rhs) noexcept;
 
   // Static Methods
   static SExpression createList(const QString& name);
   static SExpression createToken(const QString& token);
   static SExpression createString(const QString& string);
   static SExpression createLineBreak();
-  static SExpression parse(const QByteArray& content, const FilePath& filePath);
+
+  /**
+   * @brief Parse the content of an S-Expression file
+   *
+   * @param content   The UTF-8 encoded file content.
+   * @param filePath  The path of the file (used for error messages).
+   * @param parallel  If true, the children of the root node of large files
+   *                  are parsed in parallel by multiple threads. The result
+   *                  (including error messages) is the same as parsing them
+   *                  sequentially.
+   *
+   * @return The root node
+   */
+  static SExpression parse(const QByteArray& content, const FilePath& filePath,
+                           bool parallel = false);
+
+  /**
+   * @brief Parse only some children of the root node of an S-Expression file
+   *
+   * This is much faster than #parse() if only a few attributes of a large
+   * file are needed (e.g. the metadata of a library element), since all other
+   * child lists of the root node are only scanned for their end, without
+   * building (or validating) them. Tokens and strings of the root node are
+   * always parsed.
+   *
+   * @param content         The UTF-8 encoded file content.
+   * @param filePath        The path of the file (used for error messages).
+   * @param rootChildNames  Names of the child lists of the root node to parse.
+   *
+   * @return The root node, containing only the requested child lists
+   */
+  static SExpression parsePartially(const QByteArray&    content,
+                                    const FilePath&      filePath,
+                                    const QSet<QString>& rootChildNames);
+  static SExpression parseBinary(const QByteArray& content,
+                                 const FilePath&   filePath);
+  static quint32     getBinaryFormatVersion() noexcept {
+    return sBinaryFormatVersion;
+  }
+
+  /**
+   * @brief Get the shared instance of a list name or token from a global pool
+   *
+   * All list names and frequently used tokens of parsed files are interned,
+   * i.e. identical strings share the same memory. Names used to look up
+   * children (e.g. tag names of serializable objects) are best interned too,
+   * so they are compared by pointer instead of by content.
+   *
+   * @param atom    The list name or token to intern.
+   *
+   * @return The interned string (equal to the passed string).
+   *
+   * @note This method is thread-safe.
+   */
+  static QString intern(const QString& atom) noexcept;
 
 private:  // Methods
   SExpression(Type type, const QString& value);
-  SExpression(sexpresso::Sexp& sexp, const FilePath& filePath);
 
-  QString escapeString(const QString& string) const noexcept;
-  bool    isValidListName(const QString& name) const noexcept;
-  bool    isValidToken(const QString& token) const noexcept;
-  QString toString(int indent) const;
+  const SExpression* tryGetLastChildByName(const QString& name) const noexcept;
+  void updateChildIndex() noexcept;
+  void updateChildIndexAfterAppend() noexcept;
+
+  bool serialize(QByteArray& out, int indent) const;
+  void serializeBinary(QDataStream&             stream,
+                       QHash<QString, quint32>& strings) const;
+  void deserializeBinary(QDataStream& stream, const QVector<QString>& strings,
+                         int depth);
+
+  // Static Methods
+  static void appendEscapedString(QByteArray& out,
+                                  const QString& string) noexcept;
+  static void appendIndentation(QByteArray& out, int indent) noexcept;
+  static void countParsedNodes(const SExpression& root) noexcept;
+  static bool isValidListName(const QString& name) noexcept;
+  static bool isValidToken(const QString& token) noexcept;
+
+private:  // Types
+  class Parser;  ///< Single-pass parser, see sexpression.cpp
 
 private:  // Data
   Type               mType;
   QString            mValue;  ///< either a list name, a token or a string
   QList<SExpression> mChildren;
   FilePath           mFilePath;
+
+  /// Indices of list children by name, only used (and built) if there are at
+  /// least #sChildIndexThreshold children. It is updated eagerly whenever the
+  /// children change and never modified by const methods, so nodes shared
+  /// between threads (QList is implicitly shared) can be read concurrently.
+  QHash<QString, QVector<int>> mChildIndex;
+
+  /// Minimum count of children to use #mChildIndex instead of a linear search
+  static const int sChildIndexThreshold = 16;
+
+  /// Minimum file size in bytes to parse it in parallel, see #parse()
+  static const int sMinParallelParseSize = 1024 * 1024;
+
+  /// Version of the format created by #toBinary(), increment on any change!
+  static const quint32 sBinaryFormatVersion = 1;
 };
 
 /*******************************************************************************
@@ -0,0 +1,166 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "sexpressioncache.h"
+
+#include "fileutils.h"
+#include "mappedfile.h"
+#include "transactionaldirectory.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+SExpressionCache::SExpressionCache(const FilePath& directory) noexcept
+  : mDirectory(directory) {
+}
+
+SExpressionCache::~SExpressionCache() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+SExpression SExpressionCache::parse(const TransactionalDirectory& dir,
+                                    const QString&                path) const {
+  const FilePath filePath = dir.getAbsPath(path);
+  const FilePath cacheFp  = getCacheFilePath(filePath);
+
+  // Note: The stamp is determined before reading the file, so if the file is
+  // modified in the meantime, the stored stamp is outdated and thus the
+  // content hash will be compared when loading the file the next time.
+  QByteArray stamp;
+  if (dir.isFileOnDisk(path)) {
+    stamp = calcStamp(filePath);
+  }
+
+  // if the file on disk is unmodified, use the cache without reading the file
+  Entry entry;
+  if (cacheFp.isExistingFile()) {
+    try {
+      entry = readEntry(cacheFp);  // can throw
+      if ((!stamp.isEmpty()) && (entry.stamp == stamp)) {
+        return SExpression::parseBinary(entry.binary,
+                                        filePath);  // can throw
+      }
+    } catch (const Exception& e) {
+      qWarning() << "Ignoring invalid S-Expression cache file"
+                 << cacheFp.toNative() << ":" << e.getMsg();
+      entry = Entry();
+    }
+  }
+
+  // otherwise read the file and use the cache only if the content is the same
+  std::unique_ptr<const MappedFile> file = dir.map(path);  // can throw
+  const QByteArray                  hash = QCryptographicHash::hash(
+      file->getContent(), QCryptographicHash::Sha256);
+  if ((!entry.hash.isEmpty()) && (entry.hash == hash)) {
+    try {
+      SExpression root =
+          SExpression::parseBinary(entry.binary, filePath);  // can throw
+      if (entry.stamp != stamp) {
+        writeEntry(cacheFp, Entry{stamp, hash, entry.binary});
+      }
+      return root;
+    } catch (const Exception& e) {
+      qWarning() << "Ignoring invalid S-Expression cache file"
+                 << cacheFp.toNative() << ":" << e.getMsg();
+    }
+  }
+
+  // parse the file and replace the outdated cache file, if any
+  SExpression root =
+      SExpression::parse(file->getContent(), filePath);  // can throw
+  try {
+    QByteArray binary = root.toBinary();  // can throw
+    writeEntry(cacheFp, Entry{stamp, hash, binary});
+  } catch (const Exception& e) {
+    qWarning() << "Failed to serialize S-Expression cache file"
+               << cacheFp.toNative() << ":" << e.getMsg();
+  }
+  return root;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+FilePath SExpressionCache::getCacheFilePath(const FilePath& filePath) const
+    noexcept {
+  // Note: The binary format version is stored in the file too. But if it was
+  // not part of the hash, updating the application would lead to replacing
+  // all cache files, which would be a problem if multiple application versions
+  // are used with the same cache directory.
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(QByteArray::number(SExpression::getBinaryFormatVersion()));
+  hash.addData(filePath.toStr().toUtf8());
+  QString hex = QString::fromLatin1(hash.result().toHex());
+  return mDirectory.getPathTo(hex.left(2) % "/" % hex.mid(2) % ".bin");
+}
+
+QByteArray SExpressionCache::calcStamp(const FilePath& filePath) noexcept {
+  QFileInfo info(filePath.toStr());
+  return QByteArray::number(info.size()) % ":" %
+      QByteArray::number(info.lastModified().toMSecsSinceEpoch());
+}
+
+SExpressionCache::Entry SExpressionCache::readEntry(const FilePath& cacheFp) {
+  QByteArray  content = FileUtils::readFile(cacheFp);  // can throw
+  QDataStream stream(content);
+  Entry       entry;
+  stream >> entry.stamp >> entry.hash >> entry.binary;
+  if ((stream.status() != QDataStream::Ok) || (!stream.atEnd())) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString("Invalid cache file: %1")
+                           .arg(cacheFp.toNative()));
+  }
+  return entry;
+}
+
+void SExpressionCache::writeEntry(const FilePath& cacheFp,
+                                  const Entry&    entry) noexcept {
+  try {
+    QByteArray  content;
+    QDataStream stream(&content, QIODevice::WriteOnly);
+    stream << entry.stamp << entry.hash << entry.binary;
+    // Note: FileUtils::writeFile() writes atomically, so it doesn't matter if
+    // the same file is written by multiple threads at the same time.
+    FileUtils::writeFile(cacheFp, content);  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Failed to write S-Expression cache file"
+               << cacheFp.toNative() << ":" << e.getMsg();
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SEXPRESSIONCACHE_H
+#define LIBREPCB_SEXPRESSIONCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "filepath.h"
+#include "sexpression.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class TransactionalDirectory;
+
+/*******************************************************************************
+ *  Class SExpressionCache
+ ******************************************************************************/
+
+/**
+ * @brief Binary on-disk cache for parsed S-Expression files
+ *
+ * Parsing large S-Expression files (e.g. library elements) is expensive and
+ * is repeated every time such a file is loaded. This class stores the parsed
+ * tree in the compact binary format of librepcb::SExpression::toBinary() in a
+ * cache directory, with one cache file per parsed file path. So if a file was
+ * parsed before and has not been modified since then, it is loaded from the
+ * cache instead of being parsed again.
+ *
+ * To detect modifications, each cache file contains the size and modification
+ * time of the parsed file, which allows to use the cache without even reading
+ * the parsed file. Only if they differ (or the file is modified in memory),
+ * the file is read and the hash of its content is compared. If it differs
+ * too, the file is parsed and its cache file is replaced, so outdated content
+ * doesn't accumulate in the cache directory.
+ *
+ * Invalid or outdated cache files are silently ignored and replaced, and
+ * writing the cache is best effort only, i.e. if the cache directory is not
+ * writable, files are just parsed as usual.
+ *
+ * @note This class is thread-safe.
+ */
+class SExpressionCache final {
+public:
+  // Constructors / Destructor
+  SExpressionCache()                              = delete;
+  SExpressionCache(const SExpressionCache& other) = delete;
+  explicit SExpressionCache(const FilePath& directory) noexcept;
+  ~SExpressionCache() noexcept;
+
+  // Getters
+  const FilePath& getDirectory() const noexcept { return mDirectory; }
+
+  // General Methods
+
+  /**
+   * @brief Parse an S-Expression file, using the cache if possible
+   *
+   * @param dir   The directory containing the file
+   * @param path  The path of the file, relative to the directory
+   *
+   * @return The parsed S-Expression tree
+   *
+   * @throw Exception if the file could not be read or its content is invalid
+   */
+  SExpression parse(const TransactionalDirectory& dir,
+                    const QString&                path) const;
+
+  // Operator Overloadings
+  SExpressionCache& operator=(const SExpressionCache& rhs) = delete;
+
+private:  // Types
+  /// Content of a cache file
+  struct Entry {
+    QByteArray stamp;   ///< Size and modification time of the parsed file
+    QByteArray hash;    ///< SHA-256 hash of the parsed file content
+    QByteArray binary;  ///< Parsed tree, see librepcb::SExpression::toBinary()
+  };
+
+private:  // Methods
+  FilePath getCacheFilePath(const FilePath& filePath) const noexcept;
+  static QByteArray calcStamp(const FilePath& filePath) noexcept;
+  static Entry      readEntry(const FilePath& cacheFp);
+  static void       writeEntry(const FilePath& cacheFp,
+                               const Entry&    entry) noexcept;
+
+private:  // Data
+  FilePath mDirectory;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_SEXPRESSIONCACHE_H
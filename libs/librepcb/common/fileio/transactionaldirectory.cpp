@@ -116,6 +116,15 @@ void TransactionalDirectory::removeDirRecursively(const QString& path) {
  *  General Methods
  ******************************************************************************/
 
+std::unique_ptr<const MappedFile> TransactionalDirectory::map(
+    const QString& path) const {
+  return mFileSystem->map(mPath % "/" % path);  // can throw
+}
+
+bool TransactionalDirectory::isFileOnDisk(const QString& path) const noexcept {
+  return mFileSystem->isFileOnDisk(mPath % "/" % path);
+}
+
 void TransactionalDirectory::saveTo(TransactionalDirectory& dest) {
   // copy files to destination
   QString srcDir = mPath.isEmpty() ? mPath : mPath % "/";
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "filesystem.h"
+#include "mappedfile.h"
 
 #include <QtCore>
 
@@ -92,8 +93,11 @@ public:
   virtual void removeDirRecursively(const QString& path = "") override;
 
   // General Methods
-  void saveTo(TransactionalDirectory& dest);
-  void moveTo(TransactionalDirectory& dest);
+  std::unique_ptr<const MappedFile> map(const QString& path) const;
+  bool                              isFileOnDisk(const QString& path) const
+      noexcept;
+  void                              saveTo(TransactionalDirectory& dest);
+  void                              moveTo(TransactionalDirectory& dest);
 
 private:  // Methods
   static void copyDirRecursively(TransactionalFileSystem& srcFs,
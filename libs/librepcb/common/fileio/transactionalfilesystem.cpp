@@ -22,13 +22,19 @@
  ******************************************************************************/
 #include "transactionalfilesystem.h"
 
+#include "../scopeguard.h"
 #include "../toolbox.h"
+#include "../utils/taskscheduler.h"
 #include "fileutils.h"
 #include "sexpression.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
 #include <quazip/quazipfile.h>
+#include <quazip/unzip.h>
+#include <zlib.h>
+
+#include <QtCore>
 
 /*******************************************************************************
  *  Namespace
@@ -97,6 +103,9 @@ TransactionalFileSystem::TransactionalFileSystem(const FilePath& filepath,
 }
 
 TransactionalFileSystem::~TransactionalFileSystem() noexcept {
+  // The autosave worker must not write anything after the lock is released.
+  waitForAutosave();
+
   // Remove autosave directory as it is not needed in case the file system
   // was gracefully closed. We only need it if the application has crashed.
   // But if the file system is opened in read-only mode, or if an autosave was
@@ -111,6 +120,43 @@ TransactionalFileSystem::~TransactionalFileSystem() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+static qint64 stringMemoryUsage(const QString& str) noexcept {
+  return sizeof(QString) + str.capacity() * sizeof(QChar);
+}
+
+qint64 TransactionalFileSystem::getMemoryUsage() const noexcept {
+  qint64 usage = sizeof(TransactionalFileSystem);
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    usage += stringMemoryUsage(it.key()) + sizeof(ModifiedFile) +
+        it.value().data.capacity();
+  }
+  foreach (const QString& path, mRemovedFiles.getPaths()) {
+    usage += stringMemoryUsage(path);
+  }
+  foreach (const QString& path, mRemovedDirs.getPaths()) {
+    usage += stringMemoryUsage(path);
+  }
+  foreach (const QString& path, mZipFiles.getPaths()) {
+    usage += stringMemoryUsage(path);
+  }
+  {
+    QMutexLocker lock(&mZipMutex);
+    usage += mZipIndex.count() * sizeof(ZipEntry);
+  }
+  QMutexLocker lock(&mDiskFileHashesMutex);
+  for (auto it = mDiskFileHashes.constBegin(); it != mDiskFileHashes.constEnd();
+       ++it) {
+    usage += stringMemoryUsage(it.key()) + sizeof(QByteArray) +
+        it.value().capacity();
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  Inherited from FileSystem
  ******************************************************************************/
@@ -136,13 +182,9 @@ QStringList TransactionalFileSystem::getDirs(const QString& path) const
   }
 
   // add directories of new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    if (filepath.startsWith(dirpath)) {
-      QStringList relpath = filepath.mid(dirpath.length()).split('/');
-      if (relpath.count() > 1) {
-        dirnames.insert(relpath.first());
-      }
-    }
+  foreach (const QString& dirname,
+           mModifiedPaths.getDirs(dirpath) + mZipFiles.getDirs(dirpath)) {
+    dirnames.insert(dirname);
   }
 
   return dirnames.toList();
@@ -163,13 +205,9 @@ QStringList TransactionalFileSystem::getFiles(const QString& path) const
   }
 
   // add new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    if (filepath.startsWith(dirpath)) {
-      QStringList relpath = filepath.mid(dirpath.length()).split('/');
-      if (relpath.count() == 1) {
-        filenames.insert(relpath.first());
-      }
-    }
+  foreach (const QString& filename,
+           mModifiedPaths.getFiles(dirpath) + mZipFiles.getFiles(dirpath)) {
+    filenames.insert(filename);
   }
 
   return filenames.toList();
@@ -177,7 +215,7 @@ QStringList TransactionalFileSystem::getFiles(const QString& path) const
 
 bool TransactionalFileSystem::fileExists(const QString& path) const noexcept {
   QString cleanedPath = cleanPath(path);
-  if (mModifiedFiles.contains(cleanedPath)) {
+  if (mModifiedFiles.contains(cleanedPath) || mZipFiles.contains(cleanedPath)) {
     return true;
   } else if (isRemoved(cleanedPath)) {
     return false;
@@ -188,10 +226,20 @@ bool TransactionalFileSystem::fileExists(const QString& path) const noexcept {
 
 QByteArray TransactionalFileSystem::read(const QString& path) const {
   QString cleanedPath = cleanPath(path);
-  if (mModifiedFiles.contains(cleanedPath)) {
-    return mModifiedFiles.value(cleanedPath);
+  auto    it          = mModifiedFiles.constFind(cleanedPath);
+  if (it != mModifiedFiles.constEnd()) {
+    return unpackContent(*it);  // can throw
+  } else if (mZipFiles.contains(cleanedPath)) {
+    return readFromZip(cleanedPath);  // can throw
   } else if (!isRemoved(cleanedPath)) {
-    return FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    QByteArray content =
+        FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    if (mIsWritable) {
+      QByteArray   hash = calcHash(content);
+      QMutexLocker lock(&mDiskFileHashesMutex);
+      mDiskFileHashes.insert(cleanedPath, hash);
+    }
+    return content;
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        QString(tr("File '%1' does not exist."))
@@ -199,32 +247,59 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
   }
 }
 
+std::unique_ptr<const MappedFile> TransactionalFileSystem::map(
+    const QString& path) const {
+  QString cleanedPath = cleanPath(path);
+  if ((!mIsWritable) && (!mModifiedFiles.contains(cleanedPath)) &&
+      (!mZipFiles.contains(cleanedPath)) && (!isRemoved(cleanedPath))) {
+    return std::unique_ptr<const MappedFile>(
+        new MappedFile(mFilePath.getPathTo(cleanedPath)));  // can throw
+  } else {
+    return std::unique_ptr<const MappedFile>(
+        new MappedFile(read(cleanedPath)));  // can throw
+  }
+}
+
+bool TransactionalFileSystem::isFileOnDisk(const QString& path) const noexcept {
+  QString cleanedPath = cleanPath(path);
+  return (!mModifiedFiles.contains(cleanedPath)) &&
+      (!mZipFiles.contains(cleanedPath)) && (!isRemoved(cleanedPath)) &&
+      mFilePath.getPathTo(cleanedPath).isExistingFile();
+}
+
 void TransactionalFileSystem::write(const QString&    path,
                                     const QByteArray& content) {
-  QString cleanedPath         = cleanPath(path);
-  mModifiedFiles[cleanedPath] = content;
+  QString cleanedPath = cleanPath(path);
+  if ((!mZipFiles.contains(cleanedPath)) && (!isRemoved(cleanedPath)) &&
+      isContentOnDisk(cleanedPath, content)) {
+    // Writing the same content as on the disk, so there is nothing to save
+    // and the file doesn't need to be kept in memory.
+    mModifiedFiles.remove(cleanedPath);
+    mModifiedPaths.remove(cleanedPath);
+    return;
+  }
+  mModifiedFiles[cleanedPath] = packContent(content);
+  mModifiedPaths.insert(cleanedPath);
+  mZipFiles.remove(cleanedPath);
   mRemovedFiles.remove(cleanedPath);
 }
 
 void TransactionalFileSystem::removeFile(const QString& path) {
   QString cleanedPath = cleanPath(path);
   mModifiedFiles.remove(cleanedPath);
+  mModifiedPaths.remove(cleanedPath);
+  mZipFiles.remove(cleanedPath);
   mRemovedFiles.insert(cleanedPath);
 }
 
 void TransactionalFileSystem::removeDirRecursively(const QString& path) {
   QString dirpath = cleanPath(path);
-  if (!dirpath.isEmpty()) dirpath.append("/");
-  foreach (const QString& fp, mModifiedFiles.keys()) {
-    if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
-      mModifiedFiles.remove(fp);
-    }
-  }
-  foreach (const QString& fp, mRemovedFiles) {
-    if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
-      mRemovedFiles.remove(fp);
-    }
+  foreach (const QString& fp, mModifiedPaths.removeRecursively(dirpath)) {
+    mModifiedFiles.remove(fp);
   }
+  mZipFiles.removeRecursively(dirpath);
+  mRemovedFiles.removeRecursively(dirpath);
+  mRemovedDirs.removeRecursively(dirpath);  // covered by the new entry
   mRemovedDirs.insert(dirpath);
 }
 
@@ -232,24 +307,39 @@ void TransactionalFileSystem::removeDirRecursively(const QString& path) {
  *  General Methods
  ******************************************************************************/
 
-void TransactionalFileSystem::loadFromZip(const FilePath& fp) {
-  QuaZip zip(fp.toStr());
-  if (!zip.open(QuaZip::mdUnzip)) {
-    throw RuntimeError(
-        __FILE__, __LINE__,
-        QString(tr("Failed to open the ZIP file '%1'.")).arg(fp.toNative()));
-  }
-  QuaZipFile file(&zip);
-  for (bool f = zip.goToFirstFile(); f; f = zip.goToNextFile()) {
-    file.open(QIODevice::ReadOnly);
-    write(file.getActualFileName(), file.readAll());
-    file.close();
+void TransactionalFileSystem::loadFromZip(const FilePath& fp,
+                                          const QString&  dir) {
+  // files of a previously loaded ZIP can't be read lazily anymore afterwards
+  inflateZipFiles();  // can throw
+
+  QMutexLocker lock(&mZipMutex);
+  mZipFilePath = fp;
+  mZipDir      = dir;
+  openZip();  // can throw
+  foreach (const QString& cleanedPath, mZipIndex.keys()) {
+    mModifiedFiles.remove(cleanedPath);
+    mModifiedPaths.remove(cleanedPath);
+    mRemovedFiles.remove(cleanedPath);
+    mZipFiles.insert(cleanedPath);
   }
-  zip.close();
 }
 
-void TransactionalFileSystem::exportToZip(const FilePath& fp) const {
-  QuaZip zip(fp.toStr());
+void TransactionalFileSystem::exportToZip(const FilePath& fp,
+                                          bool            parallel) const {
+  // source archive of lazily loaded files, to copy them without recompressing
+  std::unique_ptr<QuaZip> srcZip;
+  if (!mZipFiles.isEmpty()) {
+    srcZip.reset(new QuaZip(mZipFilePath.toStr()));
+    if ((!srcZip->open(QuaZip::mdUnzip)) || (!srcZip->goToFirstFile())) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Failed to open the ZIP file '%1'."))
+                             .arg(mZipFilePath.toNative()));
+    }
+  }
+  const bool overwriteZip = srcZip && (fp == mZipFilePath);
+
+  FilePath tmpFp(fp.toStr() % ".tmp");
+  QuaZip   zip(tmpFp.toStr());
   if (!zip.open(QuaZip::mdCreate)) {
     throw RuntimeError(
         __FILE__, __LINE__,
@@ -257,21 +347,77 @@ void TransactionalFileSystem::exportToZip(const FilePath& fp) const {
   }
   try {
     QuaZipFile file(&zip);
-    exportDirToZip(file, fp, "");
+    exportDirToZip(file, srcZip.get(), {fp, tmpFp}, "",
+                   parallel);  // can throw
     zip.close();
+    if (srcZip) {
+      srcZip->close();
+    }
+    QMutexLocker lock(&mZipMutex);
+    if (overwriteZip) {
+      mZip.reset();  // release the file to allow replacing it
+    }
+    if (fp.isExistingFile()) {
+      FileUtils::removeFile(fp);  // can throw
+    }
+    if (!QFile::rename(tmpFp.toStr(), fp.toStr())) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Failed to rename '%1' to '%2'."))
+                             .arg(tmpFp.toNative(), fp.toNative()));
+    }
+    if (overwriteZip) {
+      // The new archive contains all files with their paths in this file
+      // system, but at different positions.
+      mZipDir.clear();
+      openZip();  // can throw
+    }
   } catch (const Exception& e) {
     // Remove ZIP file because it is not complete
-    QFile(fp.toStr()).remove();
     zip.close();
+    QFile(tmpFp.toStr()).remove();
     throw;
   }
 }
 
 void TransactionalFileSystem::autosave() {
+  waitForAutosave();
+  inflateZipFiles();     // can throw
   saveDiff("autosave");  // can throw
 }
 
+QFuture<void> TransactionalFileSystem::startAutosave() {
+  if (!mIsWritable) {
+    throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
+  }
+
+  // only one autosave at a time, they write to the same directory
+  waitForAutosave();
+  inflateZipFiles();  // can throw
+
+  FilePath                     root          = mFilePath;
+  QHash<QString, ModifiedFile> modifiedFiles = mModifiedFiles;
+  PathTrie                     removedFiles  = mRemovedFiles;
+  PathTrie                     removedDirs   = mRemovedDirs;
+  mAutosaveFuture =
+      TaskScheduler::run(TaskScheduler::Priority::Background, [=]() {
+        try {
+          saveDiff(root, "autosave", modifiedFiles, removedFiles,
+                   removedDirs);  // can throw
+          qDebug() << "Autosave backup successfully written.";
+        } catch (const Exception& e) {
+          qCritical() << "Failed to write autosave backup:" << e.getMsg();
+        }
+      });
+  return mAutosaveFuture;
+}
+
 void TransactionalFileSystem::save() {
+  // a running autosave must not interfere with removing the autosave directory
+  waitForAutosave();
+
+  // the content of lazily loaded files is needed to write them to the disk
+  inflateZipFiles();  // can throw
+
   // save to backup directory
   saveDiff("backup");  // can throw
 
@@ -284,7 +430,7 @@ void TransactionalFileSystem::save() {
   removeDiff("autosave");  // can throw
 
   // remove directories
-  foreach (const QString& dir, mRemovedDirs) {
+  foreach (const QString& dir, mRemovedDirs.getPaths()) {
     FilePath fp = mFilePath.getPathTo(dir);
     if (fp.isExistingDir()) {
       FileUtils::removeDirRecursively(fp);  // can throw
@@ -292,7 +438,7 @@ void TransactionalFileSystem::save() {
   }
 
   // remove files
-  foreach (const QString& filepath, mRemovedFiles) {
+  foreach (const QString& filepath, mRemovedFiles.getPaths()) {
     FilePath fp = mFilePath.getPathTo(filepath);
     if (fp.isExistingFile()) {
       FileUtils::removeFile(fp);  // can throw
@@ -300,9 +446,25 @@ void TransactionalFileSystem::save() {
   }
 
   // save new or modified files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+  QHash<QString, QByteArray> newHashes;
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    QByteArray content = unpackContent(it.value());  // can throw
+    FileUtils::writeFile(mFilePath.getPathTo(it.key()), content);  // can throw
+    newHashes.insert(it.key(), calcHash(content));
+  }
+
+  // update hashes of the files on the disk
+  {
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    foreach (const QString& filepath, mDiskFileHashes.keys()) {
+      if (isRemoved(filepath)) {
+        mDiskFileHashes.remove(filepath);
+      }
+    }
+    for (auto it = newHashes.constBegin(); it != newHashes.constEnd(); ++it) {
+      mDiskFileHashes.insert(it.key(), it.value());
+    }
   }
 
   // remove backup
@@ -329,88 +491,362 @@ QString TransactionalFileSystem::cleanPath(QString path) noexcept {
  ******************************************************************************/
 
 bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
-  if (mRemovedFiles.contains(path)) {
-    return true;
+  return mRemovedFiles.contains(path) ||
+      mRemovedDirs.containsPathOrParent(path);
+}
+
+QByteArray TransactionalFileSystem::readFromZip(const QString& path) const {
+  // Note: Reads from multiple threads are serialized since they share the
+  // archive. That's still much faster than opening the archive for every
+  // read, which requires to read its whole directory table again.
+  QMutexLocker lock(&mZipMutex);
+  if (!mZip) {
+    openZip();  // can throw
   }
+  QuaZipFile file(mZip.data());
+  if ((!goToZipEntry(*mZip, path)) || (!file.open(QIODevice::ReadOnly))) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to read file '%1' from '%2'."))
+                           .arg(path, mZipFilePath.toNative()));
+  }
+  QByteArray content = file.readAll();
+  file.close();
+  return content;
+}
 
-  foreach (const QString dir, mRemovedDirs) {
-    if (path.startsWith(dir)) {
-      return true;
+void TransactionalFileSystem::openZip() const {
+  // Note: mZipMutex must be locked by the caller.
+  mZip.reset(new QuaZip(mZipFilePath.toStr()));
+  mZipIndex.clear();
+  if (!mZip->open(QuaZip::mdUnzip)) {
+    mZip.reset();
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to open the ZIP file '%1'."))
+                           .arg(mZipFilePath.toNative()));
+  }
+  for (bool more = mZip->goToFirstFile(); more; more = mZip->goToNextFile()) {
+    QString        name        = mZip->getCurrentFileName();
+    QString        cleanedPath = cleanPath(mZipDir % "/" % name);
+    unz64_file_pos pos;
+    if (name.endsWith('/') || cleanedPath.isEmpty()) {
+      continue;  // skip directory entries
+    } else if (unzGetFilePos64(mZip->getUnzFile(), &pos) == UNZ_OK) {
+      mZipIndex.insert(cleanedPath,
+                       ZipEntry{pos.pos_in_zip_directory, pos.num_of_file});
     }
   }
+  // QuaZipFile only opens entries if the archive has a current file, which
+  // is no longer the case after iterating past the last entry.
+  mZip->goToFirstFile();
+}
+
+bool TransactionalFileSystem::goToZipEntry(QuaZip&        zip,
+                                           const QString& path) const
+    noexcept {
+  // Note: mZipMutex must be locked by the caller if zip is mZip.
+  auto it = mZipIndex.constFind(path);
+  if (it == mZipIndex.constEnd()) {
+    return false;
+  }
+  unz64_file_pos pos;
+  pos.pos_in_zip_directory = it->posInZipDirectory;
+  pos.num_of_file          = it->numOfFile;
+  return unzGoToFilePos64(zip.getUnzFile(), &pos) == UNZ_OK;
+}
+
+void TransactionalFileSystem::inflateZipFiles() {
+  foreach (const QString& filepath, mZipFiles.getPaths()) {
+    mModifiedFiles.insert(filepath,
+                          packContent(readFromZip(filepath)));  // can throw
+    mModifiedPaths.insert(filepath);
+    mZipFiles.remove(filepath);
+  }
+  QMutexLocker lock(&mZipMutex);
+  mZip.reset();
+  mZipIndex.clear();
+}
 
-  return false;
+bool TransactionalFileSystem::isContentOnDisk(const QString&    path,
+                                              const QByteArray& content) const
+    noexcept {
+  QMutexLocker lock(&mDiskFileHashesMutex);
+  auto         it = mDiskFileHashes.constFind(path);
+  return (it != mDiskFileHashes.constEnd()) && (*it == calcHash(content));
 }
 
-void TransactionalFileSystem::exportDirToZip(QuaZipFile&     file,
-                                             const FilePath& zipFp,
-                                             const QString&  dir) const {
+void TransactionalFileSystem::exportDirToZip(QuaZipFile&            file,
+                                             QuaZip*                srcZip,
+                                             const QList<FilePath>& skipFiles,
+                                             const QString&         dir,
+                                             bool parallel) const {
   QString path = dir.isEmpty() ? dir : dir % "/";
 
   // export directories
   foreach (const QString& dirname, getDirs(dir)) {
     // skip dotdirs, e.g. ".git", ".svn", ".autosave", ".backup"
     if (dirname.startsWith('.')) continue;
-    exportDirToZip(file, zipFp, path % dirname);
+    exportDirToZip(file, srcZip, skipFiles, path % dirname,
+                   parallel);  // can throw
   }
 
-  // export files
+  // determine files to export
+  QStringList filepaths;
   foreach (const QString& filename, getFiles(dir)) {
     QString filepath = path % filename;
-    if (filepath == zipFp.toRelative(mFilePath)) {
+    if (skipFiles.contains(mFilePath.getPathTo(filepath))) {
       // In case the exported ZIP file is located inside this file system,
       // we have to skip it. Otherwise we would get a ZIP inside the ZIP file.
       continue;
     }
     // skip lock file
     if (filename == ".lock") continue;
-    // read file content and add it to the ZIP archive
-    const QByteArray& content = read(filepath);  // can throw
-    QuaZipNewInfo     newFileInfo(filepath);
-    newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
-                               QFileDevice::ReadOther |
-                               QFileDevice::WriteOwner);
+    filepaths.append(filepath);
+  }
+
+  // In parallel mode, compress the files in worker threads. Only unmodified
+  // files of a loaded ZIP are not compressed since they are copied raw anyway.
+  QHash<QString, QFuture<CompressedFile>> futures;
+  auto waitForFutures = scopeGuard([&]() {
+    foreach (QFuture<CompressedFile> future, futures) {
+      try {
+        future.waitForFinished();
+      } catch (...) {
+        // errors are handled where the result is used
+      }
+    }
+  });
+  if (parallel) {
+    foreach (const QString& filepath, filepaths) {
+      if (!(srcZip && mZipFiles.contains(filepath))) {
+        futures.insert(
+            filepath,
+            TaskScheduler::run(TaskScheduler::Priority::Background,
+                               [this, filepath]() {
+                                 return compress(read(filepath));  // can throw
+                               }));
+      }
+    }
+  }
+
+  // write files in order
+  foreach (const QString& filepath, filepaths) {
+    if (futures.contains(filepath)) {
+      exportFileToZip(file, filepath,
+                      futures[filepath].result());  // can throw
+    } else {
+      exportFileToZip(file, srcZip, filepath);  // can throw
+    }
+  }
+}
+
+void TransactionalFileSystem::exportFileToZip(QuaZipFile&    file,
+                                              QuaZip*        srcZip,
+                                              const QString& filepath) const {
+  QuaZipNewInfo newFileInfo(filepath);
+  newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
+                             QFileDevice::ReadOther | QFileDevice::WriteOwner);
+  bool success = true;
+  if (mModifiedFiles.contains(filepath)) {
+    // write modified file from memory
+    const QByteArray content =
+        unpackContent(mModifiedFiles.value(filepath));  // can throw
     if (!file.open(QIODevice::WriteOnly, newFileInfo)) {
       throw RuntimeError(__FILE__, __LINE__);
     }
-    qint64 bytesWritten = file.write(content);
+    success = (file.write(content) == content.length());
     file.close();
-    if (bytesWritten != content.length()) {
+  } else if (srcZip && mZipFiles.contains(filepath)) {
+    // copy the compressed data of an unmodified ZIP entry without inflating
+    // and recompressing it
+    QuaZipFile       srcFile(srcZip);
+    QuaZipFileInfo64 srcInfo;
+    int              method = 0;
+    int              level  = 0;
+    bool             found  = false;
+    {
+      QMutexLocker lock(&mZipMutex);
+      found = goToZipEntry(*srcZip, filepath);
+    }
+    if ((!found) || (!srcZip->getCurrentFileInfo(&srcInfo)) ||
+        (!srcFile.open(QIODevice::ReadOnly, &method, &level, true))) {
       throw RuntimeError(__FILE__, __LINE__,
-                         QString(tr("Failed to write file '%1' to '%2'."))
-                             .arg(filepath, zipFp.toNative()));
+                         QString(tr("Failed to read file '%1' from '%2'."))
+                             .arg(filepath, mZipFilePath.toNative()));
+    }
+    newFileInfo.uncompressedSize = srcInfo.uncompressedSize;
+    if (!file.open(QIODevice::WriteOnly, newFileInfo, nullptr, srcInfo.crc,
+                   method, level, true)) {
+      throw RuntimeError(__FILE__, __LINE__);
+    }
+    success = copyData(srcFile, file);
+    file.close();
+    srcFile.close();
+  } else {
+    // stream unmodified file from the disk
+    QFile srcFile(mFilePath.getPathTo(filepath).toStr());
+    if (!srcFile.open(QIODevice::ReadOnly)) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("Cannot open file \"%1\": %2"))
+              .arg(mFilePath.getPathTo(filepath).toNative(),
+                   srcFile.errorString()));
+    }
+    if (!file.open(QIODevice::WriteOnly, newFileInfo)) {
+      throw RuntimeError(__FILE__, __LINE__);
+    }
+    success = copyData(srcFile, file);
+    file.close();
+  }
+  if (!success) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Failed to write file '%1' to '%2'."))
+            .arg(filepath, file.getZip()->getZipName()));
+  }
+}
+
+void TransactionalFileSystem::exportFileToZip(
+    QuaZipFile& file, const QString& filepath,
+    const CompressedFile& compressed) const {
+  QuaZipNewInfo newFileInfo(filepath);
+  newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
+                             QFileDevice::ReadOther | QFileDevice::WriteOwner);
+  newFileInfo.uncompressedSize = compressed.uncompressedSize;
+  if (!file.open(QIODevice::WriteOnly, newFileInfo, nullptr, compressed.crc,
+                 Z_DEFLATED, Z_DEFAULT_COMPRESSION, true)) {
+    throw RuntimeError(__FILE__, __LINE__);
+  }
+  qint64 bytesWritten = file.write(compressed.data);
+  file.close();
+  if (bytesWritten != compressed.data.length()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to write file '%1' to '%2'."))
+                           .arg(filepath, file.getZip()->getZipName()));
+  }
+}
+
+bool TransactionalFileSystem::copyData(QIODevice& src,
+                                       QIODevice& dst) noexcept {
+  QByteArray buffer(64 * 1024, Qt::Uninitialized);
+  while (!src.atEnd()) {
+    qint64 size = src.read(buffer.data(), buffer.size());
+    if ((size < 0) || (dst.write(buffer.constData(), size) != size)) {
+      return false;
     }
   }
+  return true;
 }
 
-void TransactionalFileSystem::saveDiff(const QString& type) const {
-  QDateTime dt       = QDateTime::currentDateTime();
-  FilePath  dir      = mFilePath.getPathTo("." % type);
-  FilePath  filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+TransactionalFileSystem::CompressedFile TransactionalFileSystem::compress(
+    const QByteArray& content) {
+  // raw deflate stream (negative window bits), as stored in ZIP files
+  z_stream stream;
+  stream.zalloc = Z_NULL;
+  stream.zfree  = Z_NULL;
+  stream.opaque = Z_NULL;
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to initialize zlib."));
+  }
+  CompressedFile compressed;
+  compressed.data.resize(
+      static_cast<int>(deflateBound(&stream, content.size())));
+  stream.next_in =
+      reinterpret_cast<Bytef*>(const_cast<char*>(content.constData()));
+  stream.avail_in  = static_cast<uInt>(content.size());
+  stream.next_out  = reinterpret_cast<Bytef*>(compressed.data.data());
+  stream.avail_out = static_cast<uInt>(compressed.data.size());
+  int result       = deflate(&stream, Z_FINISH);
+  deflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to compress data."));
+  }
+  compressed.data.resize(static_cast<int>(stream.total_out));
+  compressed.crc = static_cast<quint32>(
+      crc32(crc32(0, nullptr, 0),
+            reinterpret_cast<const Bytef*>(content.constData()),
+            static_cast<uInt>(content.size())));
+  compressed.uncompressedSize = content.size();
+  return compressed;
+}
 
+/**
+ * Files bigger than a few kilobytes are compressed with the fastest zlib
+ * level. For the text files of LibrePCB, this reduces the size to about a
+ * fifth while the (de)compression is still much faster than parsing the
+ * content. Small files are kept uncompressed since they would not shrink
+ * much.
+ */
+TransactionalFileSystem::ModifiedFile TransactionalFileSystem::packContent(
+    const QByteArray& content) noexcept {
+  static const int minSizeToCompress = 4096;
+  if (content.size() >= minSizeToCompress) {
+    QByteArray compressed = qCompress(content, 1);
+    if (compressed.size() < content.size()) {
+      return ModifiedFile{compressed, true};
+    }
+  }
+  return ModifiedFile{content, false};
+}
+
+QByteArray TransactionalFileSystem::unpackContent(const ModifiedFile& file) {
+  if (!file.compressed) {
+    return file.data;
+  }
+  QByteArray content = qUncompress(file.data);
+  if (content.isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to decompress data."));
+  }
+  return content;
+}
+
+QByteArray TransactionalFileSystem::calcHash(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+}
+
+void TransactionalFileSystem::saveDiff(const QString& type) const {
   if (!mIsWritable) {
     throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
   }
 
-  SExpression root = SExpression::createList("librepcb_" % type);
-  root.appendChild("created", dt, true);
-  root.appendChild("modified_files_directory", filesDir.getFilename(), true);
-  foreach (const QString& filepath, Toolbox::sorted(mModifiedFiles.keys())) {
-    root.appendChild("modified_file", filepath, true);
-    FileUtils::writeFile(filesDir.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+  saveDiff(mFilePath, type, mModifiedFiles, mRemovedFiles,
+           mRemovedDirs);  // can throw
+}
+
+void TransactionalFileSystem::waitForAutosave() noexcept {
+  // exceptions are already handled by the worker itself
+  mAutosaveFuture.waitForFinished();
+}
+
+void TransactionalFileSystem::saveDiff(
+    const FilePath& root, const QString& type,
+    const QHash<QString, ModifiedFile>& modifiedFiles,
+    const PathTrie& removedFiles, const PathTrie& removedDirs) {
+  QDateTime dt       = QDateTime::currentDateTime();
+  FilePath  dir      = root.getPathTo("." % type);
+  FilePath  filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+
+  SExpression index = SExpression::createList("librepcb_" % type);
+  index.appendChild("created", dt, true);
+  index.appendChild("modified_files_directory", filesDir.getFilename(), true);
+  foreach (const QString& filepath, Toolbox::sorted(modifiedFiles.keys())) {
+    index.appendChild("modified_file", filepath, true);
+    FileUtils::writeFile(
+        filesDir.getPathTo(filepath),
+        unpackContent(modifiedFiles.value(filepath)));  // can throw
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedFiles.toList())) {
-    root.appendChild("removed_file", filepath, true);
+  foreach (const QString& filepath, Toolbox::sorted(removedFiles.getPaths())) {
+    index.appendChild("removed_file", filepath, true);
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedDirs.toList())) {
-    root.appendChild("removed_directory", filepath, true);
+  foreach (const QString& filepath, Toolbox::sorted(removedDirs.getPaths())) {
+    index.appendChild("removed_directory", filepath, true);
   }
 
   // Writing the main file must be the last operation to "mark" this diff as
   // complete!
   FileUtils::writeFile(dir.getPathTo(type % ".lp"),
-                       root.toByteArray());  // can throw
+                       index.toByteArray());  // can throw
 }
 
 void TransactionalFileSystem::loadDiff(const FilePath& fp) {
@@ -421,17 +857,19 @@ void TransactionalFileSystem::loadDiff(const FilePath& fp) {
   QString modifiedFilesDirName =
       root.getValueByPath<QString>("modified_files_directory", true);
   FilePath modifiedFilesDir = fp.getParentDir().getPathTo(modifiedFilesDirName);
-  foreach (const SExpression& node, root.getChildren("modified_file")) {
-    QString  relPath = node.getValueOfFirstChild<QString>(true);
+  foreach (const SExpression* node, root.getChildren("modified_file")) {
+    QString  relPath = node->getValueOfFirstChild<QString>(true);
     FilePath absPath = modifiedFilesDir.getPathTo(relPath);
-    mModifiedFiles.insert(relPath, FileUtils::readFile(absPath));  // can throw
+    mModifiedFiles.insert(
+        relPath, packContent(FileUtils::readFile(absPath)));  // can throw
+    mModifiedPaths.insert(relPath);
   }
-  foreach (const SExpression& node, root.getChildren("removed_file")) {
-    QString relPath = node.getValueOfFirstChild<QString>(true);
+  foreach (const SExpression* node, root.getChildren("removed_file")) {
+    QString relPath = node->getValueOfFirstChild<QString>(true);
     mRemovedFiles.insert(relPath);
   }
-  foreach (const SExpression& node, root.getChildren("removed_directory")) {
-    QString relPath = node.getValueOfFirstChild<QString>(true);
+  foreach (const SExpression* node, root.getChildren("removed_directory")) {
+    QString relPath = node->getValueOfFirstChild<QString>(true);
     mRemovedDirs.insert(relPath);
   }
 }
@@ -451,8 +889,13 @@ void TransactionalFileSystem::removeDiff(const QString& type) {
 
 void TransactionalFileSystem::discardChanges() noexcept {
   mModifiedFiles.clear();
+  mModifiedPaths.clear();
   mRemovedFiles.clear();
   mRemovedDirs.clear();
+  mZipFiles.clear();
+  QMutexLocker lock(&mZipMutex);
+  mZip.reset();
+  mZipIndex.clear();
 }
 
 /*******************************************************************************
@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "directorylock.h"
 #include "filesystem.h"
+#include "mappedfile.h"
+#include "pathtrie.h"
 
 #include <QtCore>
 
@@ -34,6 +36,7 @@
  *  Namespace / Forward Declarations
  ******************************************************************************/
 
+class QuaZip;
 class QuaZipFile;
 
 namespace librepcb {
@@ -57,8 +60,10 @@ namespace librepcb {
  *  - Supports periodic saving to allow restoring the last autosave backup after
  *    an application crash (see @ref doc_project_autosave).
  *  - Holds all file modifications in memory and allows to write those in an
- *    atomic way to the disk (see @ref doc_project_save).
- *  - Allows to export the whole file system to a ZIP file.
+ *    atomic way to the disk (see @ref doc_project_save). Bigger files are
+ *    kept compressed to reduce the memory usage of large modifications.
+ *  - Allows to export the whole file system to a ZIP file, and to load the
+ *    content of a ZIP file lazily (see #loadFromZip()).
  */
 class TransactionalFileSystem final : public FileSystem {
   Q_OBJECT
@@ -83,6 +88,17 @@ public:
   bool isWritable() const noexcept { return mIsWritable; }
   bool isRestoredFromAutosave() const noexcept { return mRestoredFromAutosave; }
 
+  /**
+   * @brief Get the (estimated) memory usage of this file system
+   *
+   * Counts the file modifications held in memory and the bookkeeping of
+   * removed files, disk file hashes and lazily loaded ZIP entries. Memory
+   * mapped files are not counted since they are not allocated on the heap.
+   *
+   * @return Memory usage in bytes
+   */
+  qint64 getMemoryUsage() const noexcept;
+
   // Inherited from FileSystem
   virtual FilePath getAbsPath(const QString& path = "") const noexcept override;
   virtual QStringList getDirs(const QString& path = "") const noexcept override;
@@ -95,10 +111,100 @@ public:
   virtual void removeDirRecursively(const QString& path = "") override;
 
   // General Methods
-  void loadFromZip(const FilePath& fp);
-  void exportToZip(const FilePath& fp) const;
+
+  /**
+   * @brief Get a read-only view to the content of a file
+   *
+   * Same as #read(), but if the file system is opened in read-only mode and
+   * the file is not modified in memory, the file is memory-mapped instead of
+   * copying its content into heap memory. For writable file systems, files
+   * are never mapped since mapped files might block saving on some platforms.
+   *
+   * @param path  The file path, relative to the root of the file system
+   *
+   * @return A view to the file content
+   *
+   * @throw Exception if the file does not exist or could not be read
+   */
+  std::unique_ptr<const MappedFile> map(const QString& path) const;
+
+  /**
+   * @brief Check whether a file is read unmodified from the disk
+   *
+   * This is the case if the file is neither modified nor removed in memory
+   * and not loaded from a ZIP archive, i.e. if #read() returns the content of
+   * the file at #getAbsPath(). Then the size and modification time of that
+   * file can be used to detect changes of its content without reading it.
+   *
+   * @param path  The file path, relative to the root of the file system
+   *
+   * @return Whether the file exists on the disk and is not overlaid in memory
+   */
+  bool isFileOnDisk(const QString& path) const noexcept;
+
+  /**
+   * @brief Load all files of a ZIP archive into this file system
+   *
+   * The files of the archive overlay the files on the disk, just like files
+   * written with #write(). But the files are not extracted into memory,
+   * instead every entry is only inflated when it is actually read. So the
+   * ZIP file must not be modified or removed as long as this file system
+   * contains unmodified files of it.
+   *
+   * The directory table of the archive is read only once, and the archive is
+   * kept open until all its files are inflated. So reading a file needs just
+   * a single seek to its entry, which makes even big archives with thousands
+   * of small files (e.g. packed libraries on a network drive) fast to read.
+   *
+   * @param fp    Path to the ZIP file to load
+   * @param dir   Directory (relative to the root of this file system) to
+   *              load the files into. By default, they are loaded into the
+   *              root directory.
+   *
+   * @throw Exception   If the ZIP file could not be opened.
+   */
+  void loadFromZip(const FilePath& fp, const QString& dir = QString());
+
+  /**
+   * @brief Export the whole file system to a ZIP file
+   *
+   * Files are streamed in chunks into the archive, and files which were loaded
+   * with #loadFromZip() and not modified since then are copied without
+   * recompressing them. The archive is first written to a temporary file
+   * and then moved to the destination, so it is even allowed to overwrite the
+   * ZIP file loaded with #loadFromZip().
+   *
+   * @param fp        Path to the ZIP file to create or overwrite
+   * @param parallel  If true, the files of each directory are compressed in
+   *                  parallel on the global thread pool before writing them
+   *                  in order to the archive. This is considerably faster
+   *                  for big file systems on multi-core machines, but needs
+   *                  to hold the compressed files of a directory in memory.
+   *
+   * @throw Exception   If the ZIP file could not be written.
+   */
+  void exportToZip(const FilePath& fp, bool parallel = false) const;
   void autosave();
-  void save();
+
+  /**
+   * @brief Start writing an autosave backup in a worker thread
+   *
+   * Only a snapshot of the current modifications is taken in the calling
+   * thread (which is cheap since the file contents are implicitly shared), so
+   * further modifications don't need to wait for the backup to be written.
+   * Errors are only logged, since an autosave backup is created on a
+   * best-effort basis anyway.
+   *
+   * A previously started autosave is completed before starting the new one,
+   * and #save() as well as the destructor wait for a running autosave. So the
+   * backup is always written while this file system holds the directory lock.
+   *
+   * @return The future of the started worker
+   *
+   * @throw Exception   If the file system is read-only.
+   */
+  QFuture<void> startAutosave();
+  void          save();
 
   // Static Methods
   static std::shared_ptr<TransactionalFileSystem> open(
@@ -119,11 +225,52 @@ public:
   }
   static QString cleanPath(QString path) noexcept;
 
+private:  // Types
+  /// The content of a modified file held in memory
+  struct ModifiedFile {
+    QByteArray data;        ///< Content, or compressed with qCompress()
+    bool       compressed;  ///< Whether #data is compressed
+  };
+
+  /// A file compressed with raw deflate, to be stored in a ZIP archive
+  struct CompressedFile {
+    QByteArray data;              ///< Compressed data
+    quint32    crc;               ///< CRC32 of the uncompressed data
+    qint64     uncompressedSize;  ///< Size of the uncompressed data
+  };
+
+  /// Position of an entry in the directory table of a ZIP archive
+  struct ZipEntry {
+    quint64 posInZipDirectory;  ///< Offset of the entry in the directory
+    quint64 numOfFile;          ///< Index of the entry in the directory
+  };
+
 private:  // Methods
-  bool isRemoved(const QString& path) const noexcept;
-  void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
-                      const QString& dir) const;
+  bool       isRemoved(const QString& path) const noexcept;
+  bool       isContentOnDisk(const QString&    path,
+                             const QByteArray& content) const noexcept;
+  QByteArray readFromZip(const QString& path) const;
+  void       openZip() const;
+  bool       goToZipEntry(QuaZip& zip, const QString& path) const noexcept;
+  void       inflateZipFiles();
+  void       exportDirToZip(QuaZipFile& file, QuaZip* srcZip,
+                            const QList<FilePath>& skipFiles,
+                            const QString& dir, bool parallel) const;
+  void       exportFileToZip(QuaZipFile& file, QuaZip* srcZip,
+                             const QString& filepath) const;
+  void       exportFileToZip(QuaZipFile& file, const QString& filepath,
+                             const CompressedFile& compressed) const;
   void saveDiff(const QString& type) const;
+  void waitForAutosave() noexcept;
+  static void saveDiff(const FilePath& root, const QString& type,
+                       const QHash<QString, ModifiedFile>& modifiedFiles,
+                       const PathTrie&                     removedFiles,
+                       const PathTrie&                     removedDirs);
+  static ModifiedFile   packContent(const QByteArray& content) noexcept;
+  static QByteArray     unpackContent(const ModifiedFile& file);
+  static bool copyData(QIODevice& src, QIODevice& dst) noexcept;
+  static CompressedFile compress(const QByteArray& content);
+  static QByteArray     calcHash(const QByteArray& content) noexcept;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
   void discardChanges() noexcept;
@@ -134,10 +281,30 @@ private:  // Data
   DirectoryLock mLock;
   bool          mRestoredFromAutosave;
 
-  // File system modifications
-  QHash<QString, QByteArray> mModifiedFiles;
-  QSet<QString>              mRemovedFiles;
-  QSet<QString>              mRemovedDirs;
+  // File system modifications (the paths are kept in tries since directory
+  // listings need to check every entry against them)
+  QHash<QString, ModifiedFile> mModifiedFiles;  ///< See #packContent()
+  PathTrie                     mModifiedPaths;  ///< Keys of #mModifiedFiles
+  PathTrie                     mRemovedFiles;
+  PathTrie                     mRemovedDirs;
+
+  // Content hashes of files read from the disk (in R/W mode only), to detect
+  // writes which don't change the file content at all
+  mutable QHash<QString, QByteArray> mDiskFileHashes;
+  mutable QMutex                     mDiskFileHashesMutex;
+
+  // Files loaded with loadFromZip() which are not inflated yet
+  FilePath mZipFilePath;
+  PathTrie mZipFiles;
+
+  // The archive loaded with loadFromZip(), kept open for fast reads
+  mutable QScopedPointer<QuaZip>   mZip;
+  mutable QString                  mZipDir;    ///< Directory to load into
+  mutable QHash<QString, ZipEntry> mZipIndex;  ///< Key: Path in file system
+  mutable QMutex                   mZipMutex;  ///< Protects the three above
+
+  // Autosave
+  QFuture<void> mAutosaveFuture;  ///< Worker of #startAutosave()
 };
 
 /*******************************************************************************
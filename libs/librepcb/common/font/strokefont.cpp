@@ -22,10 +22,11 @@
  ******************************************************************************/
 #include "strokefont.h"
 
+#include "../utils/taskscheduler.h"
+
 #include <fontobene/font.h>
 #include <fontobene/glyphlistaccessor.h>
 
-#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -41,13 +42,14 @@ namespace fb = fontobene;
 
 StrokeFont::StrokeFont(const FilePath&   fontFilePath,
                        const QByteArray& content) noexcept
-  : QObject(nullptr), mFilePath(fontFilePath) {
+  : QObject(nullptr), mFilePath(fontFilePath), mStrokeCache(10000) {
   // load the font in another thread because it takes some time to load it
   qDebug() << "Start loading font" << mFilePath.toNative();
-  mFuture = QtConcurrent::run([content]() {
-    QTextStream s(content);
-    return fb::Font(s);
-  });
+  mFuture = TaskScheduler::run(TaskScheduler::Priority::Background,
+                               [content]() {
+                                 QTextStream s(content);
+                                 return fb::Font(s);
+                               });
   connect(&mWatcher, &QFutureWatcher<fb::Font>::finished, this,
           &StrokeFont::fontLoaded);
   mWatcher.setFuture(mFuture);
@@ -80,6 +82,16 @@ QVector<Path> StrokeFont::stroke(const QString&        text,
                                  const Length&         lineSpacing,
                                  const Alignment& align, Point& bottomLeft,
                                  Point& topRight) const noexcept {
+  StrokeCacheKey key{text, *height, letterSpacing, lineSpacing, align};
+  {
+    QMutexLocker locker(&mStrokeCacheMutex);
+    if (const StrokeCacheEntry* entry = mStrokeCache.object(key)) {
+      bottomLeft = entry->bottomLeft;
+      topRight   = entry->topRight;
+      return entry->paths;
+    }
+  }
+
   accessor();  // block until the font is loaded. TODO: abort instead of
                // waiting?
   QVector<Path>                         paths;
@@ -130,6 +142,8 @@ QVector<Path> StrokeFont::stroke(const QString&        text,
     topRight.setY(totalHeight / 2);
   }
 
+  QMutexLocker locker(&mStrokeCacheMutex);
+  mStrokeCache.insert(key, new StrokeCacheEntry{paths, bottomLeft, topRight});
   return paths;
 }
 
@@ -154,22 +168,20 @@ QVector<Path> StrokeFont::strokeLine(const QString&        text,
   Length        offset = 0;
   width                = 0;  // same as offset, but without last letter spacing
   for (int i = 0; i < text.length(); ++i) {
-    Length        glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
+    Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
       Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
-        paths.append(p.translated(Point(offset + shift, Length(0))));
+          (i == 0) ? -glyph.bottomLeft.getX() : 0;  // left-align first char
+      Point translation(offset + shift, Length(0));
+      foreach (const Path& p, glyph.paths) {
+        paths.append(p.translated(translation));
       }
-      width = offset + topRight.getX() +
+      width = offset + glyph.topRight.getX() +
               shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
       // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width  = offset + glyphSpacing;
+      width  = offset + glyph.spacing;
       offset = width + letterSpacing;
     }
   }
@@ -179,29 +191,54 @@ QVector<Path> StrokeFont::strokeLine(const QString&        text,
 QVector<Path> StrokeFont::strokeGlyph(const QChar&          glyph,
                                       const PositiveLength& height,
                                       Length& spacing) const noexcept {
+  Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void StrokeFont::fontLoaded() noexcept {
+  accessor();  // trigger the message about loading succeeded or failed
+}
+
+StrokeFont::Glyph StrokeFont::getGlyph(const QChar&          glyph,
+                                       const PositiveLength& height) const
+    noexcept {
+  QPair<uint, Length> key(glyph.unicode(), *height);
+  {
+    QMutexLocker locker(&mGlyphCacheMutex);
+    auto         it = mGlyphCache.constFind(key);
+    if (it != mGlyphCache.constEnd()) {
+      return it.value();
+    }
+  }
+
+  Glyph g;
   try {
     qreal                 glyphSpacing = 0;
     QVector<fb::Polyline> polylines =
         accessor().getAllPolylinesOfGlyph(glyph.unicode(),
                                           &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
+    g.spacing = convertLength(height, glyphSpacing);
+    g.paths   = polylines2paths(polylines, height);
+    if (!g.paths.isEmpty()) {
+      computeBoundingRect(g.paths, g.bottomLeft, g.topRight);
+    }
   } catch (const fb::Exception& e) {
     qWarning() << "Failed to load stroke font glyph" << glyph;
-    spacing = 0;
-    return QVector<Path>();
+    g = Glyph();
   }
-}
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
-void StrokeFont::fontLoaded() noexcept {
-  accessor();  // trigger the message about loading succeeded or failed
+  QMutexLocker locker(&mGlyphCacheMutex);
+  mGlyphCache.insert(key, g);
+  return g;
 }
 
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
+  QMutexLocker locker(&mFontMutex);
   if (!mFont) {
     try {
       mFont.reset(new fb::Font(mFuture.result()));  // can throw
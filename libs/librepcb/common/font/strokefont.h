@@ -48,6 +48,18 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * The results of #stroke() are cached (keyed by text, height, spacing and
+ * alignment), so identical texts (e.g. the same "{{NAME}}" text of many
+ * footprints) are only stroked once. The cache is protected by a mutex since
+ * texts may be stroked from multiple threads.
+ *
+ * Since a font may be shared between several librepcb::StrokeFontPool
+ * objects (see there), all methods are thread-safe.
+ *
+ * In addition, the converted paths, spacing and bounding rect of every glyph
+ * are cached per text height, so laying out a string just concatenates
+ * (translated copies of) the cached glyph paths.
  */
 class StrokeFont final : public QObject {
   Q_OBJECT
@@ -79,9 +91,43 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
-private:
+private:  // Types
+  struct StrokeCacheKey {
+    QString   text;
+    Length    height;
+    Length    letterSpacing;
+    Length    lineSpacing;
+    Alignment align;
+
+    bool operator==(const StrokeCacheKey& rhs) const noexcept {
+      return (text == rhs.text) && (height == rhs.height) &&
+             (letterSpacing == rhs.letterSpacing) &&
+             (lineSpacing == rhs.lineSpacing) && (align == rhs.align);
+    }
+    friend uint qHash(const StrokeCacheKey& key, uint seed = 0) noexcept {
+      return ::qHash(key.text, seed) ^
+             qHash(qMakePair(key.letterSpacing, key.lineSpacing), seed) ^
+             qHash(key.height, seed) ^
+             ::qHash(static_cast<int>(key.align.toQtAlign()), seed);
+    }
+  };
+  struct StrokeCacheEntry {
+    QVector<Path> paths;
+    Point         bottomLeft;
+    Point         topRight;
+  };
+  struct Glyph {
+    QVector<Path> paths;
+    Length        spacing;
+    Point         bottomLeft;
+    Point         topRight;
+  };
+
+private:  // Methods
   void                                fontLoaded() noexcept;
   const fontobene::GlyphListAccessor& accessor() const noexcept;
+  Glyph getGlyph(const QChar& glyph, const PositiveLength& height) const
+      noexcept;
   static QVector<Path>                polylines2paths(
                      const QVector<fontobene::Polyline>& polylines,
                      const PositiveLength&               height) noexcept;
@@ -98,9 +144,14 @@ private:  // Data
   FilePath                                             mFilePath;
   QFuture<fontobene::Font>                             mFuture;
   QFutureWatcher<fontobene::Font>                      mWatcher;
+  mutable QMutex                                       mFontMutex;
   mutable QScopedPointer<fontobene::Font>              mFont;
   mutable QScopedPointer<fontobene::GlyphListCache>    mGlyphListCache;
   mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+  mutable QMutex                                       mStrokeCacheMutex;
+  mutable QCache<StrokeCacheKey, StrokeCacheEntry>     mStrokeCache;
+  mutable QMutex                                       mGlyphCacheMutex;
+  mutable QHash<QPair<uint, Length>, Glyph>            mGlyphCache;
 };
 
 /*******************************************************************************
@@ -40,10 +40,8 @@ StrokeFontPool::StrokeFontPool(const FileSystem& directory) noexcept {
     FilePath fp = directory.getAbsPath(filename);
     if (fp.getSuffix() != "bene") continue;
     try {
-      qDebug() << "Load stroke font:" << filename;
-      mFonts.insert(filename, std::make_shared<StrokeFont>(
-                                  fp,
-                                  directory.read(filename)));  // can throw
+      QByteArray content = directory.read(filename);  // can throw
+      mFonts.insert(filename, getSharedFont(fp, content));
     } catch (const Exception& e) {
       qCritical() << "Failed to load stroke font" << fp.toNative() << ":"
                   << e.getMsg();
@@ -69,6 +67,35 @@ const StrokeFont& StrokeFontPool::getFont(const QString& filename) const {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+std::shared_ptr<StrokeFont> StrokeFontPool::getSharedFont(
+    const FilePath& filepath, const QByteArray& content) noexcept {
+  static QMutex                                       mutex;
+  static QHash<QByteArray, std::weak_ptr<StrokeFont>> fonts;
+
+  QByteArray key =
+      QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  QMutexLocker                locker(&mutex);
+  std::shared_ptr<StrokeFont> font = fonts.value(key).lock();
+  if (!font) {
+    qDebug() << "Load stroke font:" << filepath.toNative();
+    font = std::make_shared<StrokeFont>(filepath, content);
+    // remove fonts which are no longer used by any pool
+    for (auto it = fonts.begin(); it != fonts.end();) {
+      if (it.value().expired()) {
+        it = fonts.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    fonts.insert(key, font);
+  }
+  return font;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -42,6 +42,11 @@ class FileSystem;
 
 /**
  * @brief The StrokeFontPool class
+ *
+ * The fonts are shared between all pools of the process, keyed by the hash of
+ * their file content. So the application fonts and the (usually identical)
+ * fonts of all opened projects are parsed only once and kept in memory only
+ * once. A font is released as soon as no pool uses it anymore.
  */
 class StrokeFontPool final {
   Q_DECLARE_TR_FUNCTIONS(StrokeFontPool)
@@ -58,6 +63,10 @@ public:
   // Operator Overloadings
   StrokeFontPool& operator=(const StrokeFontPool& rhs) noexcept;
 
+private:  // Methods
+  static std::shared_ptr<StrokeFont> getSharedFont(
+      const FilePath& filepath, const QByteArray& content) noexcept;
+
 private:  // Data
   QHash<QString, std::shared_ptr<StrokeFont>> mFonts;
 };
@@ -39,9 +39,16 @@ Path::Path(const Path& other) noexcept
   : mVertices(other.mVertices), mPainterPathPx(other.mPainterPathPx) {
 }
 
+Path::Path(Path&& other) noexcept
+  : mVertices(std::move(other.mVertices)), mPainterPathPx() {
+  mPainterPathPx.swap(other.mPainterPathPx);
+}
+
 Path::Path(const SExpression& node) {
-  foreach (const SExpression& child, node.getChildren("vertex")) {
-    mVertices.append(Vertex(child));
+  QList<const SExpression*> children = node.getChildren("vertex");
+  mVertices.reserve(children.count());
+  foreach (const SExpression* child, children) {
+    mVertices.append(Vertex(*child));
   }
 }
 
@@ -57,6 +64,11 @@ bool Path::isClosed() const noexcept {
   }
 }
 
+qint64 Path::getMemoryUsage() const noexcept {
+  return sizeof(Path) + (mVertices.capacity() * sizeof(Vertex)) +
+         (mPainterPathPx.elementCount() * sizeof(QPainterPath::Element));
+}
+
 const QPainterPath& Path::toQPainterPathPx(bool close) const noexcept {
   if (mPainterPathPx.isEmpty()) {
     int count = mVertices.count();
@@ -96,27 +108,40 @@ const QPainterPath& Path::toQPainterPathPx(bool close) const noexcept {
  ******************************************************************************/
 
 Path& Path::translate(const Point& offset) noexcept {
-  for (Vertex& vertex : mVertices) {
-    vertex.setPos(vertex.getPos() + offset);
+  if (!offset.isOrigin()) {
+    for (Vertex& vertex : mVertices) {
+      vertex.setPos(vertex.getPos() + offset);
+    }
+    invalidatePainterPath();
   }
-  invalidatePainterPath();
   return *this;
 }
 
-Path Path::translated(const Point& offset) const noexcept {
-  return Path(*this).translate(offset);
+Path Path::translated(const Point& offset) const& noexcept {
+  Path result(*this);
+  result.translate(offset);
+  return result;
+}
+
+Path Path::translated(const Point& offset) && noexcept {
+  return std::move(translate(offset));
 }
 
 Path& Path::rotate(const Angle& angle, const Point& center) noexcept {
-  for (Vertex& vertex : mVertices) {
-    vertex.setPos(vertex.getPos().rotated(angle, center));
+  if (rotateAndTranslate(angle, center, center)) {
+    invalidatePainterPath();
   }
-  invalidatePainterPath();
   return *this;
 }
 
-Path Path::rotated(const Angle& angle, const Point& center) const noexcept {
-  return Path(*this).rotate(angle, center);
+Path Path::rotated(const Angle& angle, const Point& center) const& noexcept {
+  Path result(*this);
+  result.rotate(angle, center);
+  return result;
+}
+
+Path Path::rotated(const Angle& angle, const Point& center) && noexcept {
+  return std::move(rotate(angle, center));
 }
 
 Path& Path::mirror(Qt::Orientation orientation, const Point& center) noexcept {
@@ -128,9 +153,35 @@ Path& Path::mirror(Qt::Orientation orientation, const Point& center) noexcept {
   return *this;
 }
 
-Path Path::mirrored(Qt::Orientation orientation, const Point& center) const
+Path Path::mirrored(Qt::Orientation orientation, const Point& center) const&
+    noexcept {
+  Path result(*this);
+  result.mirror(orientation, center);
+  return result;
+}
+
+Path Path::mirrored(Qt::Orientation orientation, const Point& center) &&
+    noexcept {
+  return std::move(mirror(orientation, center));
+}
+
+Path& Path::transform(const Angle& rotation, const Point& offset) noexcept {
+  if (rotateAndTranslate(rotation, Point(0, 0), offset)) {
+    invalidatePainterPath();
+  }
+  return *this;
+}
+
+Path Path::transformed(const Angle& rotation, const Point& offset) const&
+    noexcept {
+  Path result(*this);
+  result.transform(rotation, offset);
+  return result;
+}
+
+Path Path::transformed(const Angle& rotation, const Point& offset) &&
     noexcept {
-  return Path(*this).mirror(orientation, center);
+  return std::move(transform(rotation, offset));
 }
 
 /*******************************************************************************
@@ -180,10 +231,69 @@ Path& Path::operator=(const Path& rhs) noexcept {
   return *this;
 }
 
+Path& Path::operator=(Path&& rhs) noexcept {
+  mVertices.swap(rhs.mVertices);
+  mPainterPathPx.swap(rhs.mPainterPathPx);
+  return *this;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
 
+namespace {
+
+struct FlatArcStep {
+  Angle angle;
+  bool  exact;  ///< Multiple of 90° (rotated without floating point math)
+  qreal sin;
+  qreal cos;
+};
+
+typedef QVector<FlatArcStep> FlatArcSteps;
+
+}  // namespace
+
+/**
+ * Returns the rotations of all intermediate points of a flattened arc. They
+ * only depend on the arc angle and the number of segments, so they are
+ * shared between all arcs with the same parameters (e.g. all vias or holes
+ * of the same size) instead of evaluating sin/cos again for every arc.
+ */
+static FlatArcSteps getFlatArcSteps(const Angle& angle, int steps) noexcept {
+  static QMutex                                  mutex;
+  static QHash<QPair<qint32, int>, FlatArcSteps> cache;
+
+  QPair<qint32, int> key(angle.toMicroDeg(), steps);
+  {
+    QMutexLocker lock(&mutex);
+    auto         it = cache.constFind(key);
+    if (it != cache.constEnd()) {
+      return *it;
+    }
+  }
+
+  FlatArcSteps table;
+  table.reserve(qMax(steps - 1, 0));
+  qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
+  for (int i = 1; i < steps; ++i) {
+    Angle stepAngle(angleDelta * i);
+    Angle angle0_360 = stepAngle.mappedTo0_360deg();
+    bool  exact      = (angle0_360 == Angle::deg0()) ||
+        (angle0_360 == Angle::deg90()) || (angle0_360 == Angle::deg180()) ||
+        (angle0_360 == Angle::deg270());
+    table.append(FlatArcStep{stepAngle, exact, qSin(stepAngle.toRad()),
+                             qCos(stepAngle.toRad())});
+  }
+
+  QMutexLocker lock(&mutex);
+  if (cache.count() >= 1000) {
+    cache.clear();  // limit memory usage
+  }
+  cache.insert(key, table);
+  return table;
+}
+
 Path Path::line(const Point& p1, const Point& p2, const Angle& angle) noexcept {
   return Path({Vertex(p1, angle), Vertex(p2)});
 }
@@ -286,25 +396,181 @@ Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
   int steps = qCeil(stepsPerRad * angle.abs().toRad());
 
   // some other very complex calculations...
-  qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
-  Point center     = Toolbox::arcCenter(p1, p2, angle);
-
-  // create line segments
-  Path p;
+  Point center = Toolbox::arcCenter(p1, p2, angle);
+
+  // create line segments (same calculation as Point::rotated(), but with
+  // cached sin/cos values)
+  LengthBase_t cx = center.getX().toNm();
+  LengthBase_t cy = center.getY().toNm();
+  LengthBase_t dx = p1.getX().toNm() - cx;
+  LengthBase_t dy = p1.getY().toNm() - cy;
+  Path         p;
+  p.mVertices.reserve(steps + 1);
   p.addVertex(p1);
-  for (int i = 1; i < steps; ++i) {
-    p.addVertex(p1.rotated(Angle(angleDelta * i), center));
+  foreach (const FlatArcStep& step, getFlatArcSteps(angle, steps)) {
+    if (step.exact) {
+      p.addVertex(p1.rotated(step.angle, center));
+    } else {
+      p.addVertex(Point(Length(cx + step.cos * dx - step.sin * dy),
+                        Length(cy + step.sin * dx + step.cos * dy)));
+    }
   }
   p.addVertex(p2);
   return p;
 }
 
+/**
+ * Checks whether the straight segments between two vertices approximate a
+ * single circular arc.
+ *
+ * All vertices must lie on the circle through the first, the middle and the
+ * last vertex, and each segment must deviate from the arc by at most the
+ * given tolerance. Additionally, all segments must turn into the same
+ * direction and must be short enough, so that coarse polygons (e.g.
+ * octagons) are not mistaken for circles.
+ */
+static bool fitArc(const QVector<Vertex>& vertices, int first, int last,
+                   qreal tolerance, Angle& angle) noexcept {
+  static const qreal maxSegmentAngle = Angle::fromDeg(24).toRad();
+
+  // Calculate the circle through the first, the middle and the last vertex,
+  // relative to the first vertex to keep the numbers small.
+  const Point& origin = vertices.at(first).getPos();
+  Point        a      = vertices.at((first + last) / 2).getPos() - origin;
+  Point        b      = vertices.at(last).getPos() - origin;
+  qreal        ax     = a.getX().toNm();
+  qreal        ay     = a.getY().toNm();
+  qreal        bx     = b.getX().toNm();
+  qreal        by     = b.getY().toNm();
+  qreal        d      = 2 * (ax * by - ay * bx);
+  if (qAbs(d) < 1) {
+    return false;  // collinear
+  }
+  qreal aa     = ax * ax + ay * ay;
+  qreal bb     = bx * bx + by * by;
+  qreal cx     = (by * aa - ay * bb) / d;
+  qreal cy     = (ax * bb - bx * aa) / d;
+  qreal radius = qSqrt(cx * cx + cy * cy);
+
+  qreal total = 0;
+  for (int i = first; i < last; ++i) {
+    if (vertices.at(i).getAngle() != 0) {
+      return false;  // already an arc
+    }
+    Point p1  = vertices.at(i).getPos() - origin;
+    Point p2  = vertices.at(i + 1).getPos() - origin;
+    qreal x1  = p1.getX().toNm() - cx;
+    qreal y1  = p1.getY().toNm() - cy;
+    qreal x2  = p2.getX().toNm() - cx;
+    qreal y2  = p2.getY().toNm() - cy;
+    qreal seg = qAtan2(x1 * y2 - y1 * x2, x1 * x2 + y1 * y2);
+    if ((seg == 0) || (qAbs(seg) > maxSegmentAngle) ||
+        ((total != 0) && ((seg > 0) != (total > 0)))) {
+      return false;
+    }
+    qreal sagitta = radius * (1 - qCos(seg / 2));
+    if ((qAbs(qSqrt(x2 * x2 + y2 * y2) - radius) > tolerance) ||
+        (sagitta > tolerance)) {
+      return false;
+    }
+    total += seg;
+  }
+  if (qAbs(total) >= 2 * Angle::deg180().toRad()) {
+    return false;
+  }
+  angle = Angle::fromRad(total);
+  return true;
+}
+
+Path Path::recoverArcs(const Path&           path,
+                       const PositiveLength& maxTolerance) noexcept {
+  static const int minSegments = 4;
+
+  const QVector<Vertex>& vertices = path.getVertices();
+  qreal                  tolerance = maxTolerance->toNm();
+  Path                   p;
+  p.mVertices.reserve(vertices.count());
+  int i = 0;
+  while (i < vertices.count()) {
+    // find the longest arc starting at this vertex
+    int   last = i;
+    Angle angle;
+    for (int j = i + minSegments; j < vertices.count(); ++j) {
+      if (!fitArc(vertices, i, j, tolerance, angle)) {
+        break;
+      }
+      last = j;
+    }
+    if (last > i) {
+      p.addVertex(vertices.at(i).getPos(), angle);
+      i = last;
+    } else {
+      p.addVertex(vertices.at(i));
+      ++i;
+    }
+  }
+  return p;
+}
+
 QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths) noexcept {
   QPainterPath p;
   foreach (const Path& path, paths) { p.addPath(path.toQPainterPathPx()); }
   return p;
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool Path::rotateAndTranslate(const Angle& angle, const Point& center,
+                              const Point& target) noexcept {
+  // Note: This is the same calculation as Point::rotate() followed by a
+  // translation (to get exactly the same results), but the expensive parts
+  // (normalizing the angle, sin/cos) are done only once for all vertices.
+  LengthBase_t cx         = center.getX().toNm();
+  LengthBase_t cy         = center.getY().toNm();
+  LengthBase_t tx         = target.getX().toNm();
+  LengthBase_t ty         = target.getY().toNm();
+  Angle        angle0_360 = angle.mappedTo0_360deg();
+  if (angle0_360 == Angle::deg90()) {
+    for (Vertex& vertex : mVertices) {
+      LengthBase_t dx = vertex.getPos().getX().toNm() - cx;
+      LengthBase_t dy = vertex.getPos().getY().toNm() - cy;
+      vertex.setPos(Point(tx - dy, ty + dx));
+    }
+  } else if (angle0_360 == Angle::deg180()) {
+    for (Vertex& vertex : mVertices) {
+      LengthBase_t dx = vertex.getPos().getX().toNm() - cx;
+      LengthBase_t dy = vertex.getPos().getY().toNm() - cy;
+      vertex.setPos(Point(tx - dx, ty - dy));
+    }
+  } else if (angle0_360 == Angle::deg270()) {
+    for (Vertex& vertex : mVertices) {
+      LengthBase_t dx = vertex.getPos().getX().toNm() - cx;
+      LengthBase_t dy = vertex.getPos().getY().toNm() - cy;
+      vertex.setPos(Point(tx + dy, ty - dx));
+    }
+  } else if (angle != Angle::deg0()) {
+    qreal sin = qSin(angle.toRad());
+    qreal cos = qCos(angle.toRad());
+    for (Vertex& vertex : mVertices) {
+      LengthBase_t dx = vertex.getPos().getX().toNm() - cx;
+      LengthBase_t dy = vertex.getPos().getY().toNm() - cy;
+      Length       x(cx + cos * dx - sin * dy);
+      Length       y(cy + sin * dx + cos * dy);
+      vertex.setPos(Point(x + (tx - cx), y + (ty - cy)));
+    }
+  } else if ((tx != cx) || (ty != cy)) {
+    Point offset(tx - cx, ty - cy);
+    for (Vertex& vertex : mVertices) {
+      vertex.setPos(vertex.getPos() + offset);
+    }
+  } else {
+    return false;  // nothing to do, keep the vertices shared
+  }
+  return true;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
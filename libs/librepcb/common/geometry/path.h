@@ -49,12 +49,20 @@ namespace librepcb {
  *
  * For a valid path, minimum two vertices are required. Paths with less than two
  * vertices are useless and thus considered as invalid.
+ *
+ * The vertices (and the cached QPainterPath) are implicitly shared, so copying
+ * a path is cheap. The data is only detached (copied) when a copy gets
+ * modified, and transformations which don't change anything (e.g. translating
+ * by zero) keep the data shared. The transformation methods returning a copy
+ * (e.g. #translated()) modify temporary paths in place, so chaining them like
+ * `path.translated(a).rotated(b)` detaches the vertices only once.
  */
 class Path final : public SerializableObject {
 public:
   // Constructors / Destructor
   Path() noexcept : mVertices(), mPainterPathPx() {}
   Path(const Path& other) noexcept;
+  Path(Path&& other) noexcept;
   explicit Path(const QVector<Vertex>& vertices) noexcept
     : mVertices(vertices) {}
   explicit Path(const SExpression& node);
@@ -69,16 +77,44 @@ public:
   const QVector<Vertex>& getVertices() const noexcept { return mVertices; }
   const QPainterPath&    toQPainterPathPx(bool close = false) const noexcept;
 
+  /**
+   * @brief Get the (estimated) memory usage of this path
+   *
+   * @return Memory usage in bytes, including the cached QPainterPath
+   */
+  qint64 getMemoryUsage() const noexcept;
+
   // Transformations
   Path& translate(const Point& offset) noexcept;
-  Path  translated(const Point& offset) const noexcept;
+  Path  translated(const Point& offset) const& noexcept;
+  Path  translated(const Point& offset) && noexcept;
   Path& rotate(const Angle& angle, const Point& center = Point(0, 0)) noexcept;
-  Path  rotated(const Angle& angle, const Point& center = Point(0, 0)) const
+  Path  rotated(const Angle& angle, const Point& center = Point(0, 0)) const&
+      noexcept;
+  Path  rotated(const Angle& angle, const Point& center = Point(0, 0)) &&
       noexcept;
   Path& mirror(Qt::Orientation orientation,
                const Point&    center = Point(0, 0)) noexcept;
   Path  mirrored(Qt::Orientation orientation,
-                 const Point&    center = Point(0, 0)) const noexcept;
+                 const Point&    center = Point(0, 0)) const& noexcept;
+  Path  mirrored(Qt::Orientation orientation,
+                 const Point&    center = Point(0, 0)) && noexcept;
+
+  /**
+   * @brief Rotate around the origin and then translate, in a single pass
+   *
+   * Gives exactly the same result as `rotate(rotation).translate(offset)`,
+   * but iterates over the vertices only once. Useful to map item coordinates
+   * to scene coordinates.
+   *
+   * @param rotation    Rotation around the origin
+   * @param offset      Translation applied after the rotation
+   *
+   * @return A reference to the modified path
+   */
+  Path& transform(const Angle& rotation, const Point& offset) noexcept;
+  Path  transformed(const Angle& rotation, const Point& offset) const& noexcept;
+  Path  transformed(const Angle& rotation, const Point& offset) && noexcept;
 
   // General Methods
   void addVertex(const Vertex& vertex) noexcept;
@@ -97,6 +133,7 @@ public:
   }
   bool  operator!=(const Path& rhs) const noexcept { return !(*this == rhs); }
   Path& operator=(const Path& rhs) noexcept;
+  Path& operator=(Path&& rhs) noexcept;
 
   // Static Methods
   static Path line(const Point& p1, const Point& p2,
@@ -113,9 +150,28 @@ public:
                       const PositiveLength& height) noexcept;
   static Path flatArc(const Point& p1, const Point& p2, const Angle& angle,
                       const PositiveLength& maxTolerance) noexcept;
+
+  /**
+   * @brief Replace straight segments approximating arcs by real arcs
+   *
+   * This is the inverse of #flatArc(): Runs of at least four straight
+   * segments whose vertices lie on a common circle are replaced by a single
+   * arc segment, e.g. to get real arcs back from paths calculated by Clipper.
+   * Existing arc segments and all other vertices are kept as they are.
+   *
+   * @param path          The path to process
+   * @param maxTolerance  Maximum deviation of the replaced segments from the
+   *                      arc, i.e. the tolerance the arcs were flattened with
+   *
+   * @return The path with recovered arcs
+   */
+  static Path recoverArcs(const Path&           path,
+                          const PositiveLength& maxTolerance) noexcept;
   static QPainterPath toQPainterPathPx(const QVector<Path>& paths) noexcept;
 
 private:  // Methods
+  bool rotateAndTranslate(const Angle& angle, const Point& center,
+                          const Point& target) noexcept;
   void invalidatePainterPath() const noexcept {
     mPainterPathPx = QPainterPath();
   }
@@ -75,6 +75,14 @@ Polygon::Polygon(const SExpression& node)
 Polygon::~Polygon() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 Polygon::getMemoryUsage() const noexcept {
+  return sizeof(Polygon) - sizeof(Path) + mPath.getMemoryUsage();
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -79,6 +79,7 @@ public:
   bool                     isFilled() const noexcept { return mIsFilled; }
   bool                     isGrabArea() const noexcept { return mIsGrabArea; }
   const Path&              getPath() const noexcept { return mPath; }
+  qint64                   getMemoryUsage() const noexcept;
 
   // Setters
   bool setLayerName(const GraphicsLayerName& name) noexcept;
@@ -116,6 +116,15 @@ const QVector<Path>& StrokeText::getPaths() const noexcept {
   return needsAutoRotation() ? mPathsRotated : mPaths;
 }
 
+qint64 StrokeText::getMemoryUsage() const noexcept {
+  qint64 usage =
+      sizeof(StrokeText) +
+      ((mText.capacity() + mSubstitutedText.capacity()) * sizeof(QChar));
+  foreach (const Path& path, mPaths) { usage += path.getMemoryUsage(); }
+  foreach (const Path& path, mPathsRotated) { usage += path.getMemoryUsage(); }
+  return usage;
+}
+
 bool StrokeText::needsAutoRotation() const noexcept {
   Angle rot360 = (mMirrored ? -mRotation : mRotation).mappedTo0_360deg();
   return mAutoRotate && (rot360 > Angle::deg90()) &&
@@ -300,14 +309,11 @@ void StrokeText::setFont(const StrokeFont* font) noexcept {
 void StrokeText::updatePaths() noexcept {
   QVector<Path> paths;
   Point         center;
+  mSubstitutedText = substituteText();
   if (mFont) {
-    QString str = mText;
-    if (mAttributeProvider) {
-      str = AttributeSubstitutor::substitute(str, mAttributeProvider);
-    }
     Point bottomLeft, topRight;
-    paths  = mFont->stroke(str, mHeight, calcLetterSpacing(), calcLineSpacing(),
-                          mAlign, bottomLeft, topRight);
+    paths  = mFont->stroke(mSubstitutedText, mHeight, calcLetterSpacing(),
+                          calcLineSpacing(), mAlign, bottomLeft, topRight);
     center = (bottomLeft + topRight) / 2;
   }
   if (paths == mPaths) return;
@@ -322,6 +328,12 @@ void StrokeText::updatePaths() noexcept {
   onEdited.notify(Event::PathsChanged);
 }
 
+void StrokeText::updateSubstitutedText() noexcept {
+  if (substituteText() != mSubstitutedText) {
+    updatePaths();
+  }
+}
+
 void StrokeText::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.appendChild("layer", mLayerName, false);
@@ -376,6 +388,18 @@ StrokeText& StrokeText::operator=(const StrokeText& rhs) noexcept {
   return *this;
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QString StrokeText::substituteText() const noexcept {
+  if (mAttributeProvider) {
+    return AttributeSubstitutor::substitute(mText, mAttributeProvider);
+  } else {
+    return mText;
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -170,6 +170,7 @@ public:
   bool                 getAutoRotate() const noexcept { return mAutoRotate; }
   const QString&       getText() const noexcept { return mText; }
   const QVector<Path>& getPaths() const noexcept;
+  qint64               getMemoryUsage() const noexcept;
   bool                 needsAutoRotation() const noexcept;
   Length               calcLetterSpacing() const noexcept;
   Length               calcLineSpacing() const noexcept;
@@ -193,6 +194,15 @@ public:
   const StrokeFont* getCurrentFont() const noexcept { return mFont; }
   void              updatePaths() noexcept;
 
+  /**
+   * @brief Update the paths after attributes of the provider have changed
+   *
+   * Same as #updatePaths(), but the (expensive) stroking of the text is
+   * skipped if the substituted text did not change (e.g. if the text does
+   * not contain any of the modified attributes).
+   */
+  void updateSubstitutedText() noexcept;
+
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
@@ -203,6 +213,9 @@ public:
   }
   StrokeText& operator=(const StrokeText& rhs) noexcept;
 
+private:  // Methods
+  QString substituteText() const noexcept;
+
 private:  // Data
   Uuid              mUuid;
   GraphicsLayerName mLayerName;
@@ -221,6 +234,7 @@ private:  // Data
   const AttributeProvider*
                     mAttributeProvider;  ///< for substituting placeholders in text
   const StrokeFont* mFont;               ///< font used for calculating paths
+  QString           mSubstitutedText;    ///< text used for the current #mPaths
   QVector<Path>     mPaths;     ///< stroke paths without transformations
                                 ///< (mirror/rotate/translate)
   QVector<Path> mPathsRotated;  ///< same as #mPaths, but rotated by 180°
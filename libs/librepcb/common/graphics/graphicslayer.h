@@ -46,6 +46,11 @@ namespace librepcb {
  *
  * These layers are used in graphics items (QGraphicsItem) to determine their
  * visibility and colors.
+ *
+ * Graphics items read the visibility and colors of their layers when they are
+ * painted, instead of caching them. So modifying a layer does not need to
+ * update every item on that layer, it only needs to repaint the scene once
+ * (no matter how many items are on the layer).
  */
 class GraphicsLayer : public QObject {
   Q_OBJECT
@@ -55,8 +55,8 @@ struct GraphicsLayerNameVerifier {
 
 struct GraphicsLayerNameConstraint {
   bool operator()(const QString& value) const noexcept {
-    return QRegularExpression("^[a-z][_0-9a-z]{0,39}$")
-        .match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
+    static const QRegularExpression re("^[a-z][_0-9a-z]{0,39}$");
+    return re.match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
         .hasMatch();
   }
 };
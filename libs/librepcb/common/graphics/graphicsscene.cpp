@@ -37,7 +37,10 @@ namespace librepcb {
  ******************************************************************************/
 
 GraphicsScene::GraphicsScene() noexcept
-  : QGraphicsScene(nullptr), mSelectionRectItem(nullptr) {
+  : QGraphicsScene(nullptr),
+    mSelectionRectItem(nullptr),
+    mBulkChangesDepth(0),
+    mCullingEnabled(false) {
   /*QBrush selectBrush = QGuiApplication::palette().highlight();
   QColor selectColor = selectBrush.color();
   selectColor.setAlpha(50);
@@ -48,6 +51,11 @@ GraphicsScene::GraphicsScene() noexcept
   mSelectionRectItem->setBrush(selectBrush);
   mSelectionRectItem->setZValue(1000);
   QGraphicsScene::addItem(mSelectionRectItem);
+
+  mCullingRefreshTimer.setSingleShot(true);
+  mCullingRefreshTimer.setInterval(0);
+  connect(&mCullingRefreshTimer, &QTimer::timeout, this,
+          &GraphicsScene::refreshCulledItems);
 }
 
 GraphicsScene::~GraphicsScene() noexcept {
@@ -68,6 +76,117 @@ void GraphicsScene::removeItem(QGraphicsItem& item) noexcept {
   QGraphicsScene::removeItem(&item);
 }
 
+void GraphicsScene::beginBulkChanges() noexcept {
+  if (mBulkChangesDepth++ == 0) {
+    setItemIndexMethod(QGraphicsScene::NoIndex);
+  }
+}
+
+void GraphicsScene::endBulkChanges() noexcept {
+  Q_ASSERT(mBulkChangesDepth > 0);
+  if (--mBulkChangesDepth == 0) {
+    setItemIndexMethod(QGraphicsScene::BspTreeIndex);  // rebuilds the index
+  }
+}
+
+void GraphicsScene::setCullingEnabled(bool enabled) noexcept {
+  if (enabled == mCullingEnabled) {
+    return;
+  }
+  if (enabled) {
+    refreshCulledItems();  // the index is not updated while disabled
+  }
+  beginBulkChanges();
+  mCullingEnabled = enabled;
+  mPopulatedRect  = QRectF();
+  for (auto it = mCulledItems.constBegin(); it != mCulledItems.constEnd();
+       ++it) {
+    updatePopulation(*it.key(), it.value());
+  }
+  endBulkChanges();
+  setCullingViewport(mCullingViewport);
+}
+
+void GraphicsScene::addCulledItem(QGraphicsItem& item) noexcept {
+  Q_ASSERT(!mCulledItems.contains(&item));
+  CulledItem data{item.sceneBoundingRect(), false, false};
+  addToCullingGrid(item, data);
+  mCulledItems.insert(&item, data);
+  mCulledItemsBoundingRect |= data.bounds;
+  updatePopulation(item, data);
+}
+
+void GraphicsScene::removeCulledItem(QGraphicsItem& item) noexcept {
+  auto it = mCulledItems.find(&item);
+  Q_ASSERT(it != mCulledItems.end());
+  if (it != mCulledItems.end()) {
+    removeFromCullingGrid(item, it.value());
+    mCulledItems.erase(it);
+  }
+  if (mPopulatedItems.remove(&item)) {
+    QGraphicsScene::removeItem(&item);
+  }
+}
+
+void GraphicsScene::updateCulledItem(QGraphicsItem& item) noexcept {
+  auto it = mCulledItems.find(&item);
+  if ((!mCullingEnabled) || (it == mCulledItems.end())) {
+    return;  // index is rebuilt when enabling culling
+  }
+  QRectF bounds = item.sceneBoundingRect();
+  if (bounds != it->bounds) {
+    removeFromCullingGrid(item, it.value());
+    it->bounds = bounds;
+    addToCullingGrid(item, it.value());
+    mCulledItemsBoundingRect |= bounds;
+    updatePopulation(item, it.value());
+  }
+}
+
+void GraphicsScene::setCulledItemPinned(QGraphicsItem& item,
+                                        bool           pinned) noexcept {
+  auto it = mCulledItems.find(&item);
+  if ((it != mCulledItems.end()) && (it->pinned != pinned)) {
+    it->pinned = pinned;
+    if (!pinned) {
+      // The item might have been moved while it was pinned.
+      updateCulledItem(item);
+    }
+    updatePopulation(item, it.value());
+  }
+}
+
+void GraphicsScene::setCullingViewport(const QRectF& rect) noexcept {
+  mCullingViewport = rect;
+  if ((!mCullingEnabled) || rect.isEmpty()) {
+    return;
+  }
+  // Hysteresis: Only update the scene if the viewport was moved out of the
+  // populated area, or if it became much smaller (zoomed in).
+  if (mPopulatedRect.contains(rect) &&
+      (mPopulatedRect.width() <= rect.width() * 4) &&
+      (mPopulatedRect.height() <= rect.height() * 4)) {
+    return;
+  }
+  qreal dx = rect.width() / 2;
+  qreal dy = rect.height() / 2;
+  setPopulatedRect(rect.adjusted(-dx, -dy, dx, dy));
+}
+
+void GraphicsScene::invalidateCulledItems() noexcept {
+  if (mCullingEnabled) {
+    mCullingRefreshTimer.start();
+  }
+}
+
+QRectF GraphicsScene::getItemsBoundingRect() const noexcept {
+  QRectF rect = itemsBoundingRect();
+  if (mCullingEnabled) {
+    rect |= mCulledItemsBoundingRect;
+  }
+  return rect;
+}
+
 void GraphicsScene::setSelectionRect(const Point& p1,
                                      const Point& p2) noexcept {
   QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
@@ -75,7 +194,7 @@ void GraphicsScene::setSelectionRect(const Point& p1,
 }
 
 QPixmap GraphicsScene::toPixmap(int dpi, const QColor& background) noexcept {
-  QRectF rect = itemsBoundingRect();
+  QRectF rect = getItemsBoundingRect();
   return toPixmap(QSize(qCeil(dpi * Length::fromPx(rect.width()).toInch()),
                         qCeil(dpi * Length::fromPx(rect.height()).toInch())),
                   background);
@@ -83,14 +202,189 @@ QPixmap GraphicsScene::toPixmap(int dpi, const QColor& background) noexcept {
 
 QPixmap GraphicsScene::toPixmap(const QSize&  size,
                                 const QColor& background) noexcept {
-  QRectF  rect = itemsBoundingRect();
   QPixmap pixmap(size);
   pixmap.fill(background);
   QPainter painter(&pixmap);
+  renderAllItems(painter);
+  return pixmap;
+}
+
+QImage GraphicsScene::toImage(const QSize&  size,
+                              const QColor& background) noexcept {
+  QImage image(size, QImage::Format_ARGB32_Premultiplied);
+  image.fill(background);
+  QPainter painter(&image);
+  renderAllItems(painter);
+  return image;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void GraphicsScene::renderAllItems(QPainter& painter) noexcept {
   painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing |
                          QPainter::SmoothPixmapTransform);
-  render(&painter, QRectF(), rect, Qt::KeepAspectRatio);
-  return pixmap;
+  if (mCullingEnabled) {
+    // Temporarily populate all items. Since the spatial index is disabled in
+    // the meantime, this is much cheaper than keeping all items populated.
+    if (mCullingRefreshTimer.isActive()) {
+      mCullingRefreshTimer.stop();
+      refreshCulledItems();
+    }
+    QRectF populatedRect = mPopulatedRect;
+    beginBulkChanges();
+    setPopulatedRect(mCulledItemsBoundingRect);
+    render(&painter, QRectF(), getItemsBoundingRect(), Qt::KeepAspectRatio);
+    setPopulatedRect(populatedRect);
+    endBulkChanges();
+  } else {
+    render(&painter, QRectF(), itemsBoundingRect(), Qt::KeepAspectRatio);
+  }
+}
+
+void GraphicsScene::refreshCulledItems() noexcept {
+  mCulledItemsBoundingRect = QRectF();
+  for (auto it = mCulledItems.begin(); it != mCulledItems.end(); ++it) {
+    QRectF bounds = it.key()->sceneBoundingRect();
+    if (bounds != it->bounds) {
+      removeFromCullingGrid(*it.key(), it.value());
+      it->bounds = bounds;
+      addToCullingGrid(*it.key(), it.value());
+      if (mCullingEnabled) {
+        updatePopulation(*it.key(), it.value());
+      }
+    }
+    mCulledItemsBoundingRect |= bounds;
+  }
+}
+
+void GraphicsScene::setPopulatedRect(const QRectF& rect) noexcept {
+  mPopulatedRect = rect;
+
+  // remove items which are not located in the new area anymore
+  QVector<QGraphicsItem*> itemsToRemove;
+  foreach (QGraphicsItem* item, mPopulatedItems) {
+    if (!isPopulated(mCulledItems.value(item))) {
+      itemsToRemove.append(item);
+    }
+  }
+  bool bulk = (itemsToRemove.count() > mPopulatedItems.count() / 2);
+  if (bulk) {
+    beginBulkChanges();  // replacing most items, rebuild the index only once
+  }
+  foreach (QGraphicsItem* item, itemsToRemove) {
+    mPopulatedItems.remove(item);
+    QGraphicsScene::removeItem(item);
+  }
+
+  // add items located in the new area
+  QRectF area = rect & mCulledItemsBoundingRect;
+  if (!area.isNull()) {
+    int   firstX    = getCullingCellIndex(area.left());
+    int   lastX     = getCullingCellIndex(area.right());
+    int   firstY    = getCullingCellIndex(area.top());
+    int   lastY     = getCullingCellIndex(area.bottom());
+    qreal cellCount = qreal(lastX - firstX + 1) * qreal(lastY - firstY + 1);
+    if (cellCount > mCullingGrid.count()) {
+      // cheaper to check all items than to look up all (mostly empty) cells
+      for (auto it = mCulledItems.constBegin(); it != mCulledItems.constEnd();
+           ++it) {
+        updatePopulation(*it.key(), it.value());
+      }
+    } else {
+      for (int x = firstX; x <= lastX; ++x) {
+        for (int y = firstY; y <= lastY; ++y) {
+          auto cell = mCullingGrid.constFind(getCullingCellKey(x, y));
+          if (cell != mCullingGrid.constEnd()) {
+            foreach (QGraphicsItem* item, *cell) {
+              updatePopulation(*item, mCulledItems.value(item));
+            }
+          }
+        }
+      }
+      foreach (QGraphicsItem* item, mLargeCulledItems) {
+        updatePopulation(*item, mCulledItems.value(item));
+      }
+    }
+  }
+  if (bulk) {
+    endBulkChanges();
+  }
+}
+
+void GraphicsScene::updatePopulation(QGraphicsItem&    item,
+                                     const CulledItem& data) noexcept {
+  bool populated = mPopulatedItems.contains(&item);
+  if (isPopulated(data) && (!populated)) {
+    mPopulatedItems.insert(&item);
+    QGraphicsScene::addItem(&item);
+  } else if ((!isPopulated(data)) && populated) {
+    mPopulatedItems.remove(&item);
+    QGraphicsScene::removeItem(&item);
+  }
+}
+
+bool GraphicsScene::isPopulated(const CulledItem& data) const noexcept {
+  // Note: Not using QRectF::intersects() since it returns false for items
+  // with an empty bounding rect (e.g. horizontal lines).
+  return (!mCullingEnabled) || data.pinned ||
+      ((data.bounds.left() <= mPopulatedRect.right()) &&
+       (data.bounds.right() >= mPopulatedRect.left()) &&
+       (data.bounds.top() <= mPopulatedRect.bottom()) &&
+       (data.bounds.bottom() >= mPopulatedRect.top()) &&
+       (!mPopulatedRect.isNull()));
+}
+
+void GraphicsScene::addToCullingGrid(QGraphicsItem& item,
+                                     CulledItem&    data) noexcept {
+  int   firstX    = getCullingCellIndex(data.bounds.left());
+  int   lastX     = getCullingCellIndex(data.bounds.right());
+  int   firstY    = getCullingCellIndex(data.bounds.top());
+  int   lastY     = getCullingCellIndex(data.bounds.bottom());
+  qreal cellCount = qreal(lastX - firstX + 1) * qreal(lastY - firstY + 1);
+  data.large      = (cellCount > getCullingMaxCellsPerItem());
+  if (data.large) {
+    mLargeCulledItems.insert(&item);
+    return;
+  }
+  for (int x = firstX; x <= lastX; ++x) {
+    for (int y = firstY; y <= lastY; ++y) {
+      mCullingGrid[getCullingCellKey(x, y)].append(&item);
+    }
+  }
+}
+
+void GraphicsScene::removeFromCullingGrid(QGraphicsItem&    item,
+                                          const CulledItem& data) noexcept {
+  if (data.large) {
+    mLargeCulledItems.remove(&item);
+    return;
+  }
+  for (int x = getCullingCellIndex(data.bounds.left());
+       x <= getCullingCellIndex(data.bounds.right()); ++x) {
+    for (int y = getCullingCellIndex(data.bounds.top());
+         y <= getCullingCellIndex(data.bounds.bottom()); ++y) {
+      auto cell = mCullingGrid.find(getCullingCellKey(x, y));
+      if (cell != mCullingGrid.end()) {
+        cell->removeOne(&item);
+        if (cell->isEmpty()) {
+          mCullingGrid.erase(cell);
+        }
+      }
+    }
+  }
+}
+
+int GraphicsScene::getCullingCellIndex(qreal coordinate) noexcept {
+  // Note: Round towards negative infinity to get correct indices for
+  // negative coordinates too.
+  return qFloor(coordinate / getCullingCellSize());
+}
+
+quint64 GraphicsScene::getCullingCellKey(int x, int y) noexcept {
+  return (static_cast<quint64>(static_cast<quint32>(x)) << 32) |
+      static_cast<quint32>(y);
 }
 
 /*******************************************************************************
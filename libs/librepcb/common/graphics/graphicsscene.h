@@ -39,6 +39,21 @@ class Point;
 
 /**
  * @brief The GraphicsScene class
+ *
+ * Optionally, the scene supports viewport culling (see #setCullingEnabled()):
+ * Items added with #addCulledItem() are then only added to the underlying
+ * QGraphicsScene if they are located in the area around the viewport reported
+ * by #setCullingViewport(). All other items are only kept in a grid index of
+ * this class, so neither the memory of the spatial index of QGraphicsScene
+ * nor the time needed to add or remove items grows with the total number of
+ * items. The populated area is twice as big as the viewport in each
+ * direction, so the scene is updated only after panning or zooming by a
+ * considerable distance.
+ *
+ * Since culled items outside the populated area are not part of the scene,
+ * moving them is not tracked automatically. So #updateCulledItem() must be
+ * called after moving an item which might not be populated, or
+ * #invalidateCulledItems() after modifying many items.
  */
 class GraphicsScene final : public QGraphicsScene {
   Q_OBJECT
@@ -51,14 +66,140 @@ public:
   // General Methods
   void    addItem(QGraphicsItem& item) noexcept;
   void    removeItem(QGraphicsItem& item) noexcept;
+
+  /**
+   * @brief Start adding or removing many items at once
+   *
+   * Until #endBulkChanges() is called, the spatial index of the scene is
+   * disabled. So it is rebuilt only once afterwards, instead of being updated
+   * for each added or removed item. Calls can be nested.
+   */
+  void beginBulkChanges() noexcept;
+  void endBulkChanges() noexcept;
+
+  // Viewport Culling
+
+  /**
+   * @brief Enable or disable viewport culling
+   *
+   * If disabled (the default), culled items are always added to the scene.
+   *
+   * @param enabled   Whether culling should be enabled or not
+   */
+  void setCullingEnabled(bool enabled) noexcept;
+  bool isCullingEnabled() const noexcept { return mCullingEnabled; }
+
+  /**
+   * @brief Add an item which is only populated around the viewport
+   *
+   * @param item  The item to add (must not be added already)
+   */
+  void addCulledItem(QGraphicsItem& item) noexcept;
+  void removeCulledItem(QGraphicsItem& item) noexcept;
+
+  /**
+   * @brief Update the index after the bounding rect of a culled item changed
+   *
+   * @param item  The modified item (ignored if it is not a culled item)
+   */
+  void updateCulledItem(QGraphicsItem& item) noexcept;
+
+  /**
+   * @brief Always populate a culled item, independent of the viewport
+   *
+   * Useful for items which are modified very frequently (e.g. selected items
+   * while moving them), since pinned items are tracked by QGraphicsScene.
+   *
+   * @param item    The item to pin (ignored if it is not a culled item)
+   * @param pinned  Whether the item should be pinned or not
+   */
+  void setCulledItemPinned(QGraphicsItem& item, bool pinned) noexcept;
+
+  /**
+   * @brief Set the currently visible area of the scene
+   *
+   * This is called by librepcb::GraphicsView whenever it is scrolled, zoomed
+   * or resized.
+   *
+   * @param rect  The visible area in scene coordinates
+   */
+  void setCullingViewport(const QRectF& rect) noexcept;
+
+  /**
+   * @brief Rebuild the index of all culled items (deferred)
+   *
+   * Call this after modifying culled items without calling
+   * #updateCulledItem(), e.g. after executing an undo command. All bounding
+   * rects are updated once the control returns to the event loop.
+   */
+  void invalidateCulledItems() noexcept;
+
+  /**
+   * @brief Get the bounding rect of all items, including unpopulated ones
+   *
+   * In contrast to QGraphicsScene::itemsBoundingRect(), this also takes the
+   * culled items into account which are currently not populated.
+   */
+  QRectF getItemsBoundingRect() const noexcept;
+
+
   void    setSelectionRect(const Point& p1, const Point& p2) noexcept;
   QPixmap toPixmap(int           dpi,
                    const QColor& background = Qt::transparent) noexcept;
   QPixmap toPixmap(const QSize&  size,
                    const QColor& background = Qt::transparent) noexcept;
 
-private:
+  /**
+   * @brief Render the scene into an image
+   *
+   * In contrast to #toPixmap(), this may also be called from other threads
+   * than the GUI thread (if the scene is not accessed concurrently and
+   * culling is disabled).
+   */
+  QImage toImage(const QSize&  size,
+                 const QColor& background = Qt::transparent) noexcept;
+
+private:  // Types
+  struct CulledItem {
+    QRectF bounds;  ///< Scene bounding rect at the time of indexing
+    bool   pinned;  ///< Always populated, see #setCulledItemPinned()
+    bool   large;   ///< Stored in #mLargeCulledItems instead of the grid
+  };
+
+private:  // Methods
+  void renderAllItems(QPainter& painter) noexcept;
+  void refreshCulledItems() noexcept;
+  void setPopulatedRect(const QRectF& rect) noexcept;
+  void updatePopulation(QGraphicsItem& item, const CulledItem& data) noexcept;
+  bool isPopulated(const CulledItem& data) const noexcept;
+  void addToCullingGrid(QGraphicsItem& item, CulledItem& data) noexcept;
+  void removeFromCullingGrid(QGraphicsItem&    item,
+                             const CulledItem& data) noexcept;
+  static int     getCullingCellIndex(qreal coordinate) noexcept;
+  static quint64 getCullingCellKey(int x, int y) noexcept;
+
+  /**
+   * Returns the size of the grid cells in scene pixels (~10mm). Items
+   * spanning more than #getCullingMaxCellsPerItem() cells are not stored in
+   * the grid, but always considered when populating the scene.
+   */
+  static qreal getCullingCellSize() noexcept { return 28.35; }
+  static int   getCullingMaxCellsPerItem() noexcept { return 64; }
+
+private:  // Data
   QGraphicsRectItem* mSelectionRectItem;
+  int                mBulkChangesDepth;  ///< Nesting of #beginBulkChanges()
+
+  // Viewport Culling
+  bool   mCullingEnabled;
+  QRectF mCullingViewport;  ///< Last rect passed to #setCullingViewport()
+  QRectF mPopulatedRect;    ///< Area whose culled items are populated
+  QRectF mCulledItemsBoundingRect;  ///< May be bigger than needed
+  QHash<QGraphicsItem*, CulledItem>       mCulledItems;
+  QHash<quint64, QVector<QGraphicsItem*>> mCullingGrid;  ///< Items per cell
+  QSet<QGraphicsItem*>                    mLargeCulledItems;
+  QSet<QGraphicsItem*> mPopulatedItems;  ///< Culled items added to the scene
+  QTimer               mCullingRefreshTimer;
 };
 
 /*******************************************************************************
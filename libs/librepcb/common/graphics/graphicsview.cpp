@@ -48,10 +48,17 @@ GraphicsView::GraphicsView(QWidget*                     parent,
     mGridProperties(new GridProperties()),
     mOriginCrossVisible(true),
     mUseOpenGl(false),
-    mPanningActive(false) {
+    mFullViewportUpdate(qgetenv("LIBREPCB_FULL_VIEWPORT_UPDATE") == "1"),
+    mShowRepaintedRegions(qgetenv("LIBREPCB_SHOW_REPAINTED_REGIONS") == "1"),
+    mPanningActive(false),
+    mMouseMoveTimer(),
+    mPendingMouseMoveEvent(),
+    mGridBrushInterval(-1),
+    mGridBrushScale(-1),
+    mGridBrushType(GridProperties::Type_t::Off) {
   setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-  setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
   setOptimizationFlags(QGraphicsView::DontSavePainterState);
+  updateViewportMode();
   setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
   setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
   setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
@@ -62,6 +69,11 @@ GraphicsView::GraphicsView(QWidget*                     parent,
           &GraphicsView::zoomAnimationValueChanged);
 
   viewport()->grabGesture(Qt::PinchGesture);
+
+  mMouseMoveTimer.setSingleShot(true);
+  mMouseMoveTimer.setTimerType(Qt::PreciseTimer);
+  connect(&mMouseMoveTimer, &QTimer::timeout, this,
+          &GraphicsView::processPendingMouseMoveEvent);
 }
 
 GraphicsView::~GraphicsView() noexcept {
@@ -85,12 +97,22 @@ QRectF GraphicsView::getVisibleSceneRect() const noexcept {
 
 void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept {
   if (useOpenGl != mUseOpenGl) {
-    if (useOpenGl)
+    if (useOpenGl) {
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+      QOpenGLWidget* widget = new QOpenGLWidget();
+      QSurfaceFormat format = widget->format();
+      format.setSamples(4);
+      widget->setFormat(format);
+      setViewport(widget);
+#else
       setViewport(new QGLWidget(QGLFormat(
           QGL::DoubleBuffer | QGL::AlphaChannel | QGL::SampleBuffers)));
-    else
+#endif
+    } else {
       setViewport(nullptr);
+    }
     mUseOpenGl = useOpenGl;
+    updateViewportMode();
   }
   viewport()->grabGesture(Qt::PinchGesture);
 }
@@ -102,14 +124,17 @@ void GraphicsView::setGridProperties(
 }
 
 void GraphicsView::setScene(GraphicsScene* scene) noexcept {
+  mPendingMouseMoveEvent.reset();  // belongs to the old scene
   if (mScene) mScene->removeEventFilter(this);
   mScene = scene;
   if (mScene) mScene->installEventFilter(this);
   QGraphicsView::setScene(mScene);
+  updateCullingViewport();
 }
 
 void GraphicsView::setVisibleSceneRect(const QRectF& rect) noexcept {
   fitInView(rect, Qt::KeepAspectRatio);
+  updateCullingViewport();
 }
 
 void GraphicsView::setOriginCrossVisible(bool visible) noexcept {
@@ -161,6 +186,7 @@ void GraphicsView::handleMouseWheelEvent(
     // Zoom to mouse
     qreal scaleFactor = qPow(sZoomStepFactor, event->delta() / qreal(120));
     scale(scaleFactor, scaleFactor);
+    updateCullingViewport();
   }
   event->setAccepted(true);
 }
@@ -172,16 +198,18 @@ void GraphicsView::handleMouseWheelEvent(
 void GraphicsView::zoomIn() noexcept {
   if (!mScene) return;
   scale(sZoomStepFactor, sZoomStepFactor);
+  updateCullingViewport();
 }
 
 void GraphicsView::zoomOut() noexcept {
   if (!mScene) return;
   scale(1 / sZoomStepFactor, 1 / sZoomStepFactor);
+  updateCullingViewport();
 }
 
 void GraphicsView::zoomAll() noexcept {
   if (!mScene) return;
-  QRectF rect = mScene->itemsBoundingRect();
+  QRectF rect = mScene->getItemsBoundingRect();
   if (rect.isEmpty()) rect = QRectF(-100, -100, 200, 200);
   qreal xMargins = rect.width() / 50;
   qreal yMargins = rect.height() / 50;
@@ -198,8 +226,18 @@ void GraphicsView::zoomAll() noexcept {
  ******************************************************************************/
 
 void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept {
-  if (value.canConvert(QMetaType::QRectF))
+  if (value.canConvert(QMetaType::QRectF)) {
     fitInView(value.toRectF(), Qt::KeepAspectRatio);  // zoom smoothly
+    updateCullingViewport();
+  }
+}
+
+void GraphicsView::processPendingMouseMoveEvent() noexcept {
+  if (mPendingMouseMoveEvent) {
+    QScopedPointer<QGraphicsSceneMouseEvent> e(mPendingMouseMoveEvent.take());
+    processMouseMoveEvent(*e);
+    mMouseMoveTimer.start(getFrameIntervalMs());  // start the next frame
+  }
 }
 
 /*******************************************************************************
@@ -223,6 +261,16 @@ void GraphicsView::wheelEvent(QWheelEvent* event) {
 }
 #endif
 
+void GraphicsView::resizeEvent(QResizeEvent* event) {
+  QGraphicsView::resizeEvent(event);
+  updateCullingViewport();
+}
+
+void GraphicsView::scrollContentsBy(int dx, int dy) {
+  QGraphicsView::scrollContentsBy(dx, dy);
+  updateCullingViewport();
+}
+
 bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
   switch (event->type()) {
     case QEvent::Gesture: {
@@ -230,6 +278,7 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       QPinchGesture* pinch_g = dynamic_cast<QPinchGesture*>(ge->gesture(Qt::PinchGesture));
       if (pinch_g) {
         scale(pinch_g->scaleFactor(), pinch_g->scaleFactor());
+        updateCullingViewport();
         return true;
       }
       break;
@@ -238,6 +287,7 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       QGraphicsSceneMouseEvent* e =
           dynamic_cast<QGraphicsSceneMouseEvent*>(event);
       Q_ASSERT(e);
+      processPendingMouseMoveEvent();
       if (e->button() == Qt::MiddleButton) {
         mCursorBeforePanning = cursor();
         setCursor(Qt::ClosedHandCursor);
@@ -250,6 +300,7 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       QGraphicsSceneMouseEvent* e =
           dynamic_cast<QGraphicsSceneMouseEvent*>(event);
       Q_ASSERT(e);
+      processPendingMouseMoveEvent();
       if (e->button() == Qt::MiddleButton) {
         setCursor(mCursorBeforePanning);
       } else if (mEventHandlerObject) {
@@ -261,20 +312,40 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       QGraphicsSceneMouseEvent* e =
           dynamic_cast<QGraphicsSceneMouseEvent*>(event);
       Q_ASSERT(e);
-      if (e->buttons().testFlag(Qt::MiddleButton) && (!mPanningActive)) {
-        QPoint diff = mapFromScene(e->scenePos()) -
-                      mapFromScene(e->buttonDownScenePos(Qt::MiddleButton));
-        mPanningActive = true;  // avoid recursive calls (=> stack overflow)
-        horizontalScrollBar()->setValue(horizontalScrollBar()->value() -
-                                        diff.x());
-        verticalScrollBar()->setValue(verticalScrollBar()->value() - diff.y());
-        mPanningActive = false;
+      if (!mMouseMoveTimer.isActive()) {
+        processMouseMoveEvent(*e);
+        mMouseMoveTimer.start(getFrameIntervalMs());
+      } else {
+        // Coalesce with a pending event, but keep its last position to
+        // allow the event handler calculating the total movement.
+        QGraphicsSceneMouseEvent* pending =
+            new QGraphicsSceneMouseEvent(QEvent::GraphicsSceneMouseMove);
+        pending->setWidget(e->widget());
+        pending->setPos(e->pos());
+        pending->setScenePos(e->scenePos());
+        pending->setScreenPos(e->screenPos());
+        foreach (Qt::MouseButton button,
+                 {Qt::LeftButton, Qt::RightButton, Qt::MiddleButton}) {
+          pending->setButtonDownPos(button, e->buttonDownPos(button));
+          pending->setButtonDownScenePos(button, e->buttonDownScenePos(button));
+          pending->setButtonDownScreenPos(button,
+                                          e->buttonDownScreenPos(button));
+        }
+        const QGraphicsSceneMouseEvent& last =
+            mPendingMouseMoveEvent ? *mPendingMouseMoveEvent : *e;
+        pending->setLastPos(last.lastPos());
+        pending->setLastScenePos(last.lastScenePos());
+        pending->setLastScreenPos(last.lastScreenPos());
+        pending->setButtons(e->buttons());
+        pending->setButton(e->button());
+        pending->setModifiers(e->modifiers());
+        mPendingMouseMoveEvent.reset(pending);
       }
-      emit cursorScenePositionChanged(Point::fromPx(e->scenePos()));
+      return true;
     }
-      // fall through
     case QEvent::GraphicsSceneMouseDoubleClick:
     case QEvent::GraphicsSceneContextMenu: {
+      processPendingMouseMoveEvent();
       if (mEventHandlerObject) {
         mEventHandlerObject->graphicsViewEventHandler(event);
       }
@@ -282,6 +353,7 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
     }
     case QEvent::GraphicsSceneWheel: {
       if (!underMouse()) break;
+      processPendingMouseMoveEvent();
       if (mEventHandlerObject) {
         if (!mEventHandlerObject->graphicsViewEventHandler(event)) {
           handleMouseWheelEvent(dynamic_cast<QGraphicsSceneWheelEvent*>(event));
@@ -298,57 +370,29 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
 }
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
-  QPen gridPen(Qt::gray);
-  gridPen.setCosmetic(true);
-
   // draw background color
   painter->setPen(Qt::NoPen);
   painter->setBrush(backgroundBrush());
   painter->fillRect(rect, backgroundBrush());
 
-  // draw background grid lines
-  gridPen.setWidth(
-      (mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-  painter->setPen(gridPen);
-  painter->setBrush(Qt::NoBrush);
+  // draw background grid
+  // Note: The rect is only the exposed part of the viewport, so the scale
+  // factor must be determined from the transform instead of from the rect.
   qreal gridIntervalPixels = mGridProperties->getInterval()->toPx();
-  qreal scaleFactor        = width() / rect.width();
-  if (gridIntervalPixels * scaleFactor >= (qreal)5) {
-    qreal left, right, top, bottom;
-    left   = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
-    right  = rect.right();
-    top    = rect.top();
-    bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
-    switch (mGridProperties->getType()) {
-      case GridProperties::Type_t::Lines: {
-        QVarLengthArray<QLineF, 500> lines;
-        for (qreal x = left; x < right; x += gridIntervalPixels)
-          lines.append(QLineF(x, rect.top(), x, rect.bottom()));
-        for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-          lines.append(QLineF(rect.left(), y, rect.right(), y));
-        painter->setOpacity(0.5);
-        painter->drawLines(lines.data(), lines.size());
-        break;
-      }
-
-      case GridProperties::Type_t::Dots: {
-        QVarLengthArray<QPointF, 2000> dots;
-        for (qreal x = left; x < right; x += gridIntervalPixels)
-          for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-            dots.append(QPointF(x, y));
-        painter->drawPoints(dots.data(), dots.size());
-        break;
-      }
-
-      default:
-        break;
-    }
+  qreal scaleFactor =
+      QStyleOptionGraphicsItem::levelOfDetailFromTransform(transform());
+  if ((mGridProperties->getType() != GridProperties::Type_t::Off) &&
+      (gridIntervalPixels * scaleFactor >= (qreal)5)) {
+    // Note: The tile is (almost) not scaled, so don't smooth it (would only
+    // blur the grid).
+    bool smooth = painter->testRenderHint(QPainter::SmoothPixmapTransform);
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, false);
+    painter->fillRect(rect, getGridBrush(gridIntervalPixels, scaleFactor));
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, smooth);
   }
 }
 
 void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect) {
-  Q_UNUSED(rect);
-
   if (mOriginCrossVisible) {
     // draw origin cross
     qreal len = Length::fromMm(2.54).toPx();
@@ -358,6 +402,122 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect) {
     painter->drawLine(QLineF(-len, 0.0, len, 0.0));
     painter->drawLine(QLineF(0.0, -len, 0.0, len));
   }
+
+  if (mShowRepaintedRegions) {
+    // draw frame around repainted region (for debugging)
+    QColor color = QColor::fromHsv(qrand() % 360, 255, 255);
+    painter->setPen(QPen(color, 0));
+    painter->setBrush(Qt::NoBrush);
+    painter->drawRect(rect);
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+const QBrush& GraphicsView::getGridBrush(qreal intervalPx,
+                                         qreal scaleFactor) noexcept {
+  GridProperties::Type_t type = mGridProperties->getType();
+  if ((intervalPx == mGridBrushInterval) && (scaleFactor == mGridBrushScale) &&
+      (type == mGridBrushType)) {
+    return mGridBrush;
+  }
+
+  // Note: The size of the tile must be an integer number of pixels. To keep
+  // the resulting rounding error small, the tile contains several grid cells.
+  qreal cellSize = intervalPx * scaleFactor;  // [device pixels]
+  int   cells    = qCeil(qreal(64) / cellSize);
+  int   size     = qRound(cells * cellSize);
+  qreal step     = qreal(size) / cells;
+
+  QPixmap pixmap(size, size);
+  pixmap.fill(Qt::transparent);
+  QPainter painter(&pixmap);
+  QPen     gridPen(Qt::gray);
+  gridPen.setCosmetic(true);
+  // Note: Lines and dots on the tile border are drawn on both sides of the
+  // tile, since only half of them is visible on each side.
+  if (type == GridProperties::Type_t::Lines) {
+    gridPen.setWidth(1);
+    painter.setPen(gridPen);
+    painter.setOpacity(0.5);
+    for (int i = 0; i <= cells; ++i) {
+      painter.drawLine(QLineF(i * step, 0, i * step, size));
+    }
+    for (int i = 0; i <= cells; ++i) {
+      painter.drawLine(QLineF(0, i * step, size, i * step));
+    }
+  } else if (type == GridProperties::Type_t::Dots) {
+    gridPen.setWidth(2);
+    painter.setPen(gridPen);
+    for (int x = 0; x <= cells; ++x) {
+      for (int y = 0; y <= cells; ++y) {
+        painter.drawPoint(QPointF(x * step, y * step));
+      }
+    }
+  }
+  painter.end();
+
+  // scale the tile from device pixels to scene pixels
+  qreal tileScale = (cells * intervalPx) / size;
+  mGridBrush      = QBrush(pixmap);
+  mGridBrush.setTransform(QTransform::fromScale(tileScale, tileScale));
+  mGridBrushInterval = intervalPx;
+  mGridBrushScale    = scaleFactor;
+  mGridBrushType     = type;
+  return mGridBrush;
+}
+
+void GraphicsView::processMouseMoveEvent(QGraphicsSceneMouseEvent& e) noexcept {
+  if (e.buttons().testFlag(Qt::MiddleButton) && (!mPanningActive)) {
+    QPoint diff = mapFromScene(e.scenePos()) -
+                  mapFromScene(e.buttonDownScenePos(Qt::MiddleButton));
+    mPanningActive = true;  // avoid recursive calls (=> stack overflow)
+    horizontalScrollBar()->setValue(horizontalScrollBar()->value() - diff.x());
+    verticalScrollBar()->setValue(verticalScrollBar()->value() - diff.y());
+    mPanningActive = false;
+  }
+  emit cursorScenePositionChanged(Point::fromPx(e.scenePos()));
+  if (mEventHandlerObject) {
+    mEventHandlerObject->graphicsViewEventHandler(&e);
+  }
+}
+
+int GraphicsView::getFrameIntervalMs() const noexcept {
+  QScreen* screen = nullptr;
+  if (window() && window()->windowHandle()) {
+    screen = window()->windowHandle()->screen();
+  }
+  if (!screen) {
+    screen = QGuiApplication::primaryScreen();
+  }
+  qreal refreshRate = screen ? screen->refreshRate() : 0;
+  if (refreshRate < 1) {
+    refreshRate = 60;  // fallback if the refresh rate is unknown
+  }
+  return qBound(1, qRound(1000 / refreshRate), 50);
+}
+
+void GraphicsView::updateViewportMode() noexcept {
+  if (mUseOpenGl || mFullViewportUpdate) {
+    // OpenGL viewports always need to redraw the whole frame
+    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    setCacheMode(QGraphicsView::CacheNone);
+  } else {
+    // Only repaint the changed regions, and don't draw the grid again on
+    // every repaint (the cache is reset by setBackgroundBrush())
+    setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+    setCacheMode(QGraphicsView::CacheBackground);
+  }
+}
+
+void GraphicsView::updateCullingViewport() noexcept {
+  // Note: Reported after every scroll, zoom or resize of the view, but the
+  // scene only populates other items if the viewport moved far enough.
+  if (mScene) {
+    mScene->setCullingViewport(getVisibleSceneRect());
+  }
 }
 
 /*******************************************************************************
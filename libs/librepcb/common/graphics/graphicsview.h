@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../gridproperties.h"
 #include "../units/all_length_units.h"
 
 #include <QtCore>
@@ -35,7 +36,6 @@ namespace librepcb {
 
 class IF_GraphicsViewEventHandler;
 class GraphicsScene;
-class GridProperties;
 
 /*******************************************************************************
  *  Class GraphicsView
@@ -43,6 +43,23 @@ class GridProperties;
 
 /**
  * @brief The GraphicsView class
+ *
+ * Without OpenGL, only the changed regions of the viewport are repainted. For
+ * debugging, this can be controlled with the following environment variables:
+ *
+ *   - `LIBREPCB_FULL_VIEWPORT_UPDATE=1`: Always repaint the whole viewport
+ *   - `LIBREPCB_SHOW_REPAINTED_REGIONS=1`: Draw a randomly colored frame
+ *     around each repainted region
+ *
+ * The grid is drawn with a tiled brush containing a few grid cells, so its
+ * drawing cost does not depend on the number of visible grid lines or dots.
+ *
+ * Mouse move events of the scene are coalesced to the refresh rate of the
+ * screen before passing them to the event handler object: The first move
+ * event is processed immediately, but further move events within the same
+ * frame only replace a pending event which is processed at the end of the
+ * frame. Other mouse events process a pending move event first, so the event
+ * handler still sees all events in the correct order.
  */
 class GraphicsView final : public QGraphicsView {
   Q_OBJECT
@@ -95,6 +112,7 @@ private slots:
 
   // Private Slots
   void zoomAnimationValueChanged(const QVariant& value) noexcept;
+  void processPendingMouseMoveEvent() noexcept;
 
 private:
   // make some methods inaccessible...
@@ -103,10 +121,19 @@ private:
 
   // Inherited Methods
   void wheelEvent(QWheelEvent* event);
+  void resizeEvent(QResizeEvent* event);
+  void scrollContentsBy(int dx, int dy);
   bool eventFilter(QObject* obj, QEvent* event);
   void drawBackground(QPainter* painter, const QRectF& rect);
   void drawForeground(QPainter* painter, const QRectF& rect);
 
+  // Private Methods
+  void          processMouseMoveEvent(QGraphicsSceneMouseEvent& e) noexcept;
+  int           getFrameIntervalMs() const noexcept;
+  void          updateViewportMode() noexcept;
+  void          updateCullingViewport() noexcept;
+  const QBrush& getGridBrush(qreal intervalPx, qreal scaleFactor) noexcept;
+
   // General Attributes
   IF_GraphicsViewEventHandler* mEventHandlerObject;
   GraphicsScene*               mScene;
@@ -114,9 +141,21 @@ private:
   GridProperties*              mGridProperties;
   bool                         mOriginCrossVisible;
   bool                         mUseOpenGl;
+  bool                         mFullViewportUpdate;
+  bool                         mShowRepaintedRegions;
   volatile bool                mPanningActive;
   QCursor                      mCursorBeforePanning;
 
+  // Mouse move coalescing
+  QTimer mMouseMoveTimer;  ///< Running while a frame is not finished yet
+  QScopedPointer<QGraphicsSceneMouseEvent> mPendingMouseMoveEvent;
+
+  // Cached Attributes
+  QBrush                 mGridBrush;          ///< See #getGridBrush()
+  qreal                  mGridBrushInterval;  ///< Interval of #mGridBrush [px]
+  qreal                  mGridBrushScale;     ///< Scale of #mGridBrush
+  GridProperties::Type_t mGridBrushType;      ///< Type of #mGridBrush
+
   // Static Variables
   static constexpr qreal sZoomStepFactor = 1.3;
 };
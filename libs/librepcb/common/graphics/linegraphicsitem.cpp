@@ -41,9 +41,7 @@ LineGraphicsItem::LineGraphicsItem(QGraphicsItem* parent) noexcept
     mLayer(nullptr),
     mOnLayerEditedSlot(*this, &LineGraphicsItem::layerEdited) {
   mPen.setCapStyle(Qt::RoundCap);
-  mPenHighlighted.setCapStyle(Qt::RoundCap);
   mPen.setWidth(0);
-  mPenHighlighted.setWidth(0);
   updateBoundingRectAndShape();
   setVisible(false);
 }
@@ -70,7 +68,6 @@ void LineGraphicsItem::setLine(const Point& p1, const Point& p2) noexcept {
 
 void LineGraphicsItem::setLineWidth(const UnsignedLength& width) noexcept {
   mPen.setWidthF(width->toPx());
-  mPenHighlighted.setWidthF(width->toPx());
   updateBoundingRectAndShape();
 }
 
@@ -81,9 +78,7 @@ void LineGraphicsItem::setLayer(const GraphicsLayer* layer) noexcept {
   mLayer = layer;
   if (mLayer) {
     mLayer->onEdited.attach(mOnLayerEditedSlot);
-    mPen.setColor(mLayer->getColor(false));
-    mPenHighlighted.setColor(mLayer->getColor(true));
-    setVisible(mLayer->isVisible());
+    setVisible(true);
   } else {
     setVisible(false);
   }
@@ -97,11 +92,15 @@ void LineGraphicsItem::paint(QPainter*                       painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget*                        widget) noexcept {
   Q_UNUSED(widget);
-  if (option->state.testFlag(QStyle::State_Selected)) {
-    painter->setPen(mPenHighlighted);
-  } else {
-    painter->setPen(mPen);
+  // Note: Color and visibility are taken from the layer only here, so
+  // modifying the layer does not need to touch the items on that layer.
+  if ((!mLayer) || (!mLayer->isVisible())) {
+    return;
   }
+  QPen pen = mPen;
+  pen.setColor(
+      mLayer->getColor(option->state.testFlag(QStyle::State_Selected)));
+  painter->setPen(pen);
   painter->drawLine(mLine);
 }
 
@@ -111,18 +110,15 @@ void LineGraphicsItem::paint(QPainter*                       painter,
 
 void LineGraphicsItem::layerEdited(const GraphicsLayer& layer,
                                    GraphicsLayer::Event event) noexcept {
+  Q_UNUSED(layer);
   switch (event) {
     case GraphicsLayer::Event::ColorChanged:
-      mPen.setColor(layer.getColor(false));
-      update();
-      break;
     case GraphicsLayer::Event::HighlightColorChanged:
-      mPenHighlighted.setColor(layer.getColor(true));
-      update();
-      break;
     case GraphicsLayer::Event::VisibleChanged:
     case GraphicsLayer::Event::EnabledChanged:
-      setVisible(layer.isVisible() && layer.isEnabled());
+      // Only the whole scene is marked for repainting, which is a no-op if
+      // another item on the layer did this already.
+      if (scene()) scene()->update();
       break;
     case GraphicsLayer::Event::Destroyed:
       setLayer(nullptr);
@@ -72,8 +72,7 @@ private:  // Methods
 
 private:  // Data
   const GraphicsLayer* mLayer;
-  QPen                 mPen;
-  QPen                 mPenHighlighted;
+  QPen                 mPen;  ///< Without color, see #paint()
   QLineF               mLine;
   QRectF               mBoundingRect;
   QPainterPath         mShape;
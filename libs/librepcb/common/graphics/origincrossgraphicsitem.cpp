@@ -40,7 +40,6 @@ OriginCrossGraphicsItem::OriginCrossGraphicsItem(QGraphicsItem* parent) noexcept
     mSize(0),
     mOnLayerEditedSlot(*this, &OriginCrossGraphicsItem::layerEdited) {
   mPen.setWidth(0);
-  mPenHighlighted.setWidth(0);
   updateBoundingRectAndShape();
   setFlag(QGraphicsItem::ItemIsSelectable, true);
   setVisible(false);
@@ -76,9 +75,7 @@ void OriginCrossGraphicsItem::setLayer(const GraphicsLayer* layer) noexcept {
   mLayer = layer;
   if (mLayer) {
     mLayer->onEdited.attach(mOnLayerEditedSlot);
-    mPen.setColor(mLayer->getColor(false));
-    mPenHighlighted.setColor(mLayer->getColor(true));
-    setVisible(mLayer->isVisible());
+    setVisible(true);
   } else {
     setVisible(false);
   }
@@ -92,11 +89,15 @@ void OriginCrossGraphicsItem::paint(QPainter*                       painter,
                                     const QStyleOptionGraphicsItem* option,
                                     QWidget* widget) noexcept {
   Q_UNUSED(widget);
-  if (option->state.testFlag(QStyle::State_Selected)) {
-    painter->setPen(mPenHighlighted);
-  } else {
-    painter->setPen(mPen);
+  // Note: Color and visibility are taken from the layer only here, so
+  // modifying the layer does not need to touch the items on that layer.
+  if ((!mLayer) || (!mLayer->isVisible())) {
+    return;
   }
+  QPen pen = mPen;
+  pen.setColor(
+      mLayer->getColor(option->state.testFlag(QStyle::State_Selected)));
+  painter->setPen(pen);
   painter->drawLine(mLineH);
   painter->drawLine(mLineV);
 }
@@ -107,18 +108,15 @@ void OriginCrossGraphicsItem::paint(QPainter*                       painter,
 
 void OriginCrossGraphicsItem::layerEdited(const GraphicsLayer& layer,
                                           GraphicsLayer::Event event) noexcept {
+  Q_UNUSED(layer);
   switch (event) {
     case GraphicsLayer::Event::ColorChanged:
-      mPen.setColor(layer.getColor(false));
-      update();
-      break;
     case GraphicsLayer::Event::HighlightColorChanged:
-      mPenHighlighted.setColor(layer.getColor(true));
-      update();
-      break;
     case GraphicsLayer::Event::VisibleChanged:
     case GraphicsLayer::Event::EnabledChanged:
-      setVisible(layer.isVisible() && layer.isEnabled());
+      // Only the whole scene is marked for repainting, which is a no-op if
+      // another item on the layer did this already.
+      if (scene()) scene()->update();
       break;
     case GraphicsLayer::Event::Destroyed:
       setLayer(nullptr);
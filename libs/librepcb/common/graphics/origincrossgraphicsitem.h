@@ -72,8 +72,7 @@ private:  // Methods
 
 private:  // Data
   const GraphicsLayer* mLayer;
-  QPen                 mPen;
-  QPen                 mPenHighlighted;
+  QPen                 mPen;  ///< Without color, see #paint()
   UnsignedLength       mSize;
   QLineF               mLineH;
   QLineF               mLineV;
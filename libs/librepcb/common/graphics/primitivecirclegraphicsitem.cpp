@@ -43,8 +43,7 @@ PrimitiveCircleGraphicsItem::PrimitiveCircleGraphicsItem(
     mFillLayer(nullptr),
     mOnLayerEditedSlot(*this, &PrimitiveCircleGraphicsItem::layerEdited) {
   mPen.setWidthF(0);
-  mPenHighlighted.setWidthF(0);
-  updateColors();
+  updateStyles();
   updateBoundingRectAndShape();
   updateVisibility();
 }
@@ -69,7 +68,6 @@ void PrimitiveCircleGraphicsItem::setDiameter(
 void PrimitiveCircleGraphicsItem::setLineWidth(
     const UnsignedLength& width) noexcept {
   mPen.setWidthF(width->toPx());
-  mPenHighlighted.setWidthF(width->toPx());
   updateBoundingRectAndShape();
 }
 
@@ -82,7 +80,7 @@ void PrimitiveCircleGraphicsItem::setLineLayer(
   if (mLineLayer) {
     mLineLayer->onEdited.attach(mOnLayerEditedSlot);
   }
-  updateColors();
+  updateStyles();
   updateVisibility();
   updateBoundingRectAndShape();  // grab area may have changed
 }
@@ -96,7 +94,7 @@ void PrimitiveCircleGraphicsItem::setFillLayer(
   if (mFillLayer) {
     mFillLayer->onEdited.attach(mOnLayerEditedSlot);
   }
-  updateColors();
+  updateStyles();
   updateVisibility();
   updateBoundingRectAndShape();  // grab area may have changed
 }
@@ -109,13 +107,26 @@ void PrimitiveCircleGraphicsItem::paint(QPainter*                       painter,
                                         const QStyleOptionGraphicsItem* option,
                                         QWidget* widget) noexcept {
   Q_UNUSED(widget);
-  if (option->state.testFlag(QStyle::State_Selected)) {
-    painter->setPen(mPenHighlighted);
-    painter->setBrush(mBrushHighlighted);
+  // Note: Colors and visibility are taken from the layers only here, so
+  // modifying a layer does not need to touch the items on that layer.
+  const bool selected = option->state.testFlag(QStyle::State_Selected);
+  QPen       pen      = mPen;
+  QBrush     brush    = mBrush;
+  if (mLineLayer && mLineLayer->isVisible()) {
+    pen.setColor(mLineLayer->getColor(selected));
+  } else {
+    pen.setStyle(Qt::NoPen);
+  }
+  if (mFillLayer && mFillLayer->isVisible()) {
+    brush.setColor(mFillLayer->getColor(selected));
   } else {
-    painter->setPen(mPen);
-    painter->setBrush(mBrush);
+    brush.setStyle(Qt::NoBrush);
+  }
+  if ((pen.style() == Qt::NoPen) && (brush.style() == Qt::NoBrush)) {
+    return;
   }
+  painter->setPen(pen);
+  painter->setBrush(brush);
   painter->drawEllipse(mCircleRect);
 }
 
@@ -130,8 +141,9 @@ void PrimitiveCircleGraphicsItem::layerEdited(
     case GraphicsLayer::Event::HighlightColorChanged:
     case GraphicsLayer::Event::VisibleChanged:
     case GraphicsLayer::Event::EnabledChanged:
-      updateColors();
-      updateVisibility();
+      // Only the whole scene is marked for repainting, which is a no-op if
+      // another item on the layer did this already.
+      if (scene()) scene()->update();
       break;
     case GraphicsLayer::Event::Destroyed:
       if (&layer == mLineLayer) {
@@ -149,26 +161,9 @@ void PrimitiveCircleGraphicsItem::layerEdited(
   }
 }
 
-void PrimitiveCircleGraphicsItem::updateColors() noexcept {
-  if (mLineLayer && mLineLayer->isVisible()) {
-    mPen.setStyle(Qt::SolidLine);
-    mPenHighlighted.setStyle(Qt::SolidLine);
-    mPen.setColor(mLineLayer->getColor(false));
-    mPenHighlighted.setColor(mLineLayer->getColor(true));
-  } else {
-    mPen.setStyle(Qt::NoPen);
-    mPenHighlighted.setStyle(Qt::NoPen);
-  }
-
-  if (mFillLayer && mFillLayer->isVisible()) {
-    mBrush.setStyle(Qt::SolidPattern);
-    mBrushHighlighted.setStyle(Qt::SolidPattern);
-    mBrush.setColor(mFillLayer->getColor(false));
-    mBrushHighlighted.setColor(mFillLayer->getColor(true));
-  } else {
-    mBrush.setStyle(Qt::NoBrush);
-    mBrushHighlighted.setStyle(Qt::NoBrush);
-  }
+void PrimitiveCircleGraphicsItem::updateStyles() noexcept {
+  mPen.setStyle(mLineLayer ? Qt::SolidLine : Qt::NoPen);
+  mBrush.setStyle(mFillLayer ? Qt::SolidPattern : Qt::NoBrush);
   update();
 }
 
@@ -73,17 +73,15 @@ public:
 private:  // Methods
   void layerEdited(const GraphicsLayer& layer,
                    GraphicsLayer::Event event) noexcept;
-  void updateColors() noexcept;
+  void updateStyles() noexcept;
   void updateBoundingRectAndShape() noexcept;
   void updateVisibility() noexcept;
 
 private:  // Data
   const GraphicsLayer* mLineLayer;
   const GraphicsLayer* mFillLayer;
-  QPen                 mPen;
-  QPen                 mPenHighlighted;
-  QBrush               mBrush;
-  QBrush               mBrushHighlighted;
+  QPen                 mPen;    ///< Without color, see #paint()
+  QBrush               mBrush;  ///< Without color, see #paint()
   QRectF               mCircleRect;
   QRectF               mBoundingRect;
   QPainterPath         mShape;
@@ -107,9 +107,7 @@ void PrimitiveTextGraphicsItem::setLayer(const GraphicsLayer* layer) noexcept {
   mLayer = layer;
   if (mLayer) {
     mLayer->onEdited.attach(mOnLayerEditedSlot);
-    mPen.setColor(mLayer->getColor(false));
-    mPenHighlighted.setColor(mLayer->getColor(true));
-    setVisible(mLayer->isVisible());
+    setVisible(true);
     update();
   } else {
     setVisible(false);
@@ -124,12 +122,18 @@ void PrimitiveTextGraphicsItem::paint(QPainter*                       painter,
                                       const QStyleOptionGraphicsItem* option,
                                       QWidget* widget) noexcept {
   Q_UNUSED(widget);
-  painter->setFont(mFont);
-  if (option->state.testFlag(QStyle::State_Selected)) {
-    painter->setPen(mPenHighlighted);
-  } else {
-    painter->setPen(mPen);
+  // Note: Color and visibility are taken from the layer only here, so
+  // modifying the layer does not need to touch the items on that layer.
+  if ((!mLayer) || (!mLayer->isVisible())) {
+    return;
   }
+  // Note: The font must be the same as used for #mStaticText, otherwise the
+  // text would be laid out again.
+  painter->setFont(mFont);
+  QPen pen = mPen;
+  pen.setColor(
+      mLayer->getColor(option->state.testFlag(QStyle::State_Selected)));
+  painter->setPen(pen);
 
   if (mapToScene(0, 1).y() < mapToScene(0, 0).y()) {
     // The text needs to be rotated 180°!
@@ -138,10 +142,10 @@ void PrimitiveTextGraphicsItem::paint(QPainter*                       painter,
     // painter->save();
     painter->rotate(180);
     painter->translate(-mBoundingRect.topLeft() - mBoundingRect.bottomRight());
-    painter->drawText(QRectF(), mTextFlags, mText);
+    painter->drawStaticText(mBoundingRect.topLeft(), mStaticText);
     // painter->restore();
   } else {
-    painter->drawText(QRectF(), mTextFlags, mText);
+    painter->drawStaticText(mBoundingRect.topLeft(), mStaticText);
   }
 }
 
@@ -151,18 +155,15 @@ void PrimitiveTextGraphicsItem::paint(QPainter*                       painter,
 
 void PrimitiveTextGraphicsItem::layerEdited(
     const GraphicsLayer& layer, GraphicsLayer::Event event) noexcept {
+  Q_UNUSED(layer);
   switch (event) {
     case GraphicsLayer::Event::ColorChanged:
-      mPen.setColor(layer.getColor(false));
-      update();
-      break;
     case GraphicsLayer::Event::HighlightColorChanged:
-      mPenHighlighted.setColor(layer.getColor(true));
-      update();
-      break;
     case GraphicsLayer::Event::VisibleChanged:
     case GraphicsLayer::Event::EnabledChanged:
-      setVisible(layer.isVisible() && layer.isEnabled());
+      // Only the whole scene is marked for repainting, which is a no-op if
+      // another item on the layer did this already.
+      if (scene()) scene()->update();
       break;
     case GraphicsLayer::Event::Destroyed:
       setLayer(nullptr);
@@ -181,6 +182,15 @@ void PrimitiveTextGraphicsItem::updateBoundingRectAndShape() noexcept {
   mBoundingRect = fm.boundingRect(QRectF(), mTextFlags, mText);
   mShape        = QPainterPath();
   mShape.addRect(mBoundingRect);
+
+  // Lay out the text only once instead of on every repaint. The width is
+  // only needed to align the lines of multiline texts horizontally.
+  QTextOption option(mAlignment.getH().toQtAlignFlag());
+  option.setWrapMode(QTextOption::NoWrap);
+  mStaticText.setText(mText);
+  mStaticText.setTextFormat(Qt::PlainText);
+  mStaticText.setTextOption(option);
+  mStaticText.setTextWidth(mBoundingRect.width());
   update();
 }
 
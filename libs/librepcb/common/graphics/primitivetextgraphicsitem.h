@@ -83,9 +83,9 @@ private:  // Data
   QString              mText;
   Alignment            mAlignment;
   QFont                mFont;
-  QPen                 mPen;
-  QPen                 mPenHighlighted;
+  QPen                 mPen;  ///< Without color, see #paint()
   int                  mTextFlags;
+  QStaticText          mStaticText;  ///< Cached layout of #mText
   QRectF               mBoundingRect;
   QPainterPath         mShape;
 
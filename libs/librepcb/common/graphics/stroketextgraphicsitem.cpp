@@ -36,6 +36,12 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+constexpr qreal StrokeTextGraphicsItem::sLodMinTextHeight;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -75,6 +81,28 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept {
   return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter*                       painter,
+                                   const QStyleOptionGraphicsItem* option,
+                                   QWidget* widget) noexcept {
+  const bool deviceIsPrinter =
+      (painter->device()->devType() == QInternal::Printer);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  if (deviceIsPrinter ||
+      (lod * mText.getHeight()->toPx() >= sLodMinTextHeight)) {
+    PrimitivePathGraphicsItem::paint(painter, option, widget);
+  } else {
+    // The text is not readable anyway, so draw a box instead of all the
+    // strokes, which is much faster for texts with many characters.
+    const GraphicsLayer* layer = mLayerProvider.getLayer(*mText.getLayerName());
+    if (layer) {
+      bool selected = option->state.testFlag(QStyle::State_Selected);
+      painter->fillRect(boundingRect(),
+                        QBrush(layer->getColor(selected), Qt::Dense5Pattern));
+    }
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -59,6 +59,8 @@ public:
 
   // Inherited from QGraphicsItem
   QPainterPath shape() const noexcept override;
+  void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                     QWidget* widget = 0) noexcept override;
 
   // Operator Overloadings
   StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
@@ -72,6 +74,9 @@ private:  // Methods
                       const QVariant&    value) noexcept override;
 
 private:  // Data
+  /// Texts smaller than this (in device pixels) are drawn as boxes
+  static constexpr qreal sLodMinTextHeight = 4;
+
   StrokeText&                             mText;
   const IF_GraphicsLayerProvider&         mLayerProvider;
   QScopedPointer<OriginCrossGraphicsItem> mOriginCrossGraphicsItem;
@@ -68,6 +68,9 @@ void FileDownload::setZipExtractionDirectory(const FilePath& dir) noexcept {
  ******************************************************************************/
 
 void FileDownload::prepareRequest() {
+  // don't let big downloads (e.g. library archives) pollute the HTTP cache
+  mRequest.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
+
   // check destination filepath
   if (mDestination.isExistingFile() || mDestination.isExistingDir()) {
     throw RuntimeError(__FILE__, __LINE__,
@@ -96,6 +96,16 @@ void NetworkAccessManager::run() noexcept {
   Q_ASSERT(QThread::currentThread() == this);
   qDebug() << "Started network access manager thread.";
   mManager = new QNetworkAccessManager();
+  QString cacheDir =
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (!cacheDir.isEmpty()) {
+    // Keep responses on disk to avoid downloading unmodified resources again.
+    // Stale entries are revalidated with the server (ETag/Last-Modified).
+    QNetworkDiskCache* cache = new QNetworkDiskCache(mManager);
+    cache->setCacheDirectory(cacheDir % "/http");
+    cache->setMaximumCacheSize(50 * 1024 * 1024);  // 50 MB
+    mManager->setCache(cache);
+  }
   mThreadStartSemaphore.release();
   try {
     exec();  // event loop (blocking)
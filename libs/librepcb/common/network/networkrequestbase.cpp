@@ -54,6 +54,13 @@ NetworkRequestBase::NetworkRequestBase(const QUrl& url) noexcept
   mRequest.setRawHeader("X-LibrePCB-FileFormatVersion",
                         qApp->getFileFormatVersion().toStr().toUtf8());
 
+  // use cached responses if the server reports them as not modified
+  mRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute,
+                        QNetworkRequest::PreferNetwork);
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+  mRequest.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
+#endif
+
   // create queued connection to let executeRequest() execute in download thread
   connect(this, &NetworkRequestBase::startRequested, this,
           &NetworkRequestBase::executeRequest, Qt::QueuedConnection);
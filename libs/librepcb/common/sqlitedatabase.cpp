@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "sqlitedatabase.h"
 
+#include "utils/performancecounters.h"
 #include "uuid.h"
 
 #include <QtCore>
@@ -93,6 +94,7 @@ SQLiteDatabase::SQLiteDatabase(const FilePath& filepath)
 }
 
 SQLiteDatabase::~SQLiteDatabase() noexcept {
+  mQueryCache.clear();  // statements must be released before closing
   mDb.close();
 }
 
@@ -101,6 +103,7 @@ SQLiteDatabase::~SQLiteDatabase() noexcept {
  ******************************************************************************/
 
 void SQLiteDatabase::beginTransaction() {
+  finishCachedQueries();
   // Q_ASSERT(mNestedTransactionCount >= 0);
   // if (mNestedTransactionCount == 0) {
   if (!mDb.transaction()) {
@@ -112,6 +115,7 @@ void SQLiteDatabase::beginTransaction() {
 }
 
 void SQLiteDatabase::commitTransaction() {
+  finishCachedQueries();
   // Q_ASSERT(mNestedTransactionCount >= 0);
   // if (mNestedTransactionCount == 1) {
   if (!mDb.commit()) {
@@ -126,6 +130,7 @@ void SQLiteDatabase::commitTransaction() {
 }
 
 void SQLiteDatabase::rollbackTransaction() {
+  finishCachedQueries();
   // Q_ASSERT(mNestedTransactionCount >= 0);
   // if (mNestedTransactionCount == 1) {
   if (!mDb.rollback()) {
@@ -149,6 +154,14 @@ void SQLiteDatabase::clearTable(const QString& table) {
  ******************************************************************************/
 
 QSqlQuery SQLiteDatabase::prepareQuery(const QString& query) const {
+  // Note: An active statement might still be iterated by its caller, so a new
+  // one is prepared and replaces it in the cache. The old statement is
+  // released as soon as the caller does not need it anymore.
+  auto it = mQueryCache.find(query);
+  if ((it != mQueryCache.end()) && (!it->isActive())) {
+    return *it;
+  }
+
   QSqlQuery q(mDb);
   if (!q.prepare(query)) {
     qDebug() << q.lastError().databaseText();
@@ -157,6 +170,12 @@ QSqlQuery SQLiteDatabase::prepareQuery(const QString& query) const {
         __FILE__, __LINE__,
         QString(tr("Error while preparing SQL query: %1")).arg(query));
   }
+  if (mQueryCache.count() >= sMaxCachedQueries) {
+    // Most likely queries with literal values in their SQL text are prepared,
+    // so it's not worth to keep them all.
+    mQueryCache.clear();
+  }
+  mQueryCache.insert(query, q);
   return q;
 }
 
@@ -168,6 +187,7 @@ int SQLiteDatabase::count(QSqlQuery& query) {
   if (success) {
     count = query.value(0).toInt(&success);
   }
+  query.finish();
   if (success) {
     return count;
   } else {
@@ -190,6 +210,12 @@ int SQLiteDatabase::insert(QSqlQuery& query) {
 }
 
 void SQLiteDatabase::exec(QSqlQuery& query) {
+  // Note: Other cached queries must not be finished here since their results
+  // might still be iterated.
+  if (query.isActive()) {
+    query.finish();
+  }
+  PerformanceCounters::add(PerformanceCounters::Counter::SqlQueries);
   if (!query.exec()) {
     qDebug() << query.lastError().databaseText();
     qDebug() << query.lastError().driverText();
@@ -204,10 +230,53 @@ void SQLiteDatabase::exec(const QString& query) {
   exec(q);
 }
 
+void SQLiteDatabase::insertRows(const QString&             table,
+                                const QStringList&         columns,
+                                const QList<QVariantList>& rows) {
+  if (columns.isEmpty()) {
+    throw LogicError(__FILE__, __LINE__);
+  }
+  QStringList columnPlaceholders;
+  for (int i = 0; i < columns.count(); ++i) {
+    columnPlaceholders.append("?");
+  }
+  const QString rowPlaceholder = "(" % columnPlaceholders.join(", ") % ")";
+  const int     batchSize = qMax(sMaxBoundVariables / columns.count(), 1);
+  for (int first = 0; first < rows.count(); first += batchSize) {
+    int         count = qMin(batchSize, rows.count() - first);
+    QStringList rowPlaceholders;
+    for (int i = 0; i < count; ++i) {
+      rowPlaceholders.append(rowPlaceholder);
+    }
+    QSqlQuery query = prepareQuery("INSERT INTO " % table % " (" %
+                                   columns.join(", ") % ") VALUES " %
+                                   rowPlaceholders.join(", "));  // can throw
+    int index = 0;
+    for (int i = first; i < first + count; ++i) {
+      const QVariantList& row = rows.at(i);
+      if (row.count() != columns.count()) {
+        throw LogicError(__FILE__, __LINE__);
+      }
+      foreach (const QVariant& value, row) {
+        query.bindValue(index++, value);
+      }
+    }
+    exec(query);  // can throw
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
+void SQLiteDatabase::finishCachedQueries() noexcept {
+  for (auto it = mQueryCache.begin(); it != mQueryCache.end(); ++it) {
+    if (it->isActive()) {
+      it->finish();
+    }
+  }
+}
+
 void SQLiteDatabase::enableSqliteWriteAheadLogging() {
   QSqlQuery query("PRAGMA journal_mode=WAL", mDb);
   exec(query);  // can throw
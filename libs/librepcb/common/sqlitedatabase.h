@@ -40,6 +40,21 @@ namespace librepcb {
 
 /**
  * @brief The SQLiteDatabase class
+ *
+ * Prepared queries are cached by their SQL text, so preparing the same query
+ * again (e.g. in a loop) only rebinds the values of the already prepared
+ * statement. A cached statement which is still active (i.e. its results may
+ * still be iterated, e.g. by an outer loop) is never handed out again, a new
+ * statement is prepared instead. So results of several queries, even of the
+ * same SQL text, can be iterated at the same time.
+ *
+ * Since all copies of a cached query share the same statement, a prepared
+ * query must be executed before the same SQL text is prepared again.
+ *
+ * @note A statement whose results were not fetched completely keeps its read
+ *       transaction open, so this connection would not see modifications made
+ *       by other connections. Call QSqlQuery::finish() once the results of
+ *       such a query are not needed anymore.
  */
 class SQLiteDatabase final : public QObject {
   Q_OBJECT
@@ -79,6 +94,21 @@ public:
   void      exec(QSqlQuery& query);
   void      exec(const QString& query);
 
+  /**
+   * @brief Insert multiple rows into a table
+   *
+   * The rows are inserted with multi-row INSERT statements, which is much
+   * faster than inserting every row with a separate statement.
+   *
+   * @param table     Name of the table
+   * @param columns   Names of the columns to insert
+   * @param rows      The rows to insert, each containing one value per column
+   *
+   * @throw Exception on errors.
+   */
+  void insertRows(const QString& table, const QStringList& columns,
+                  const QList<QVariantList>& rows);
+
   // Operator Overloadings
   SQLiteDatabase& operator=(const SQLiteDatabase& rhs) = delete;
 
@@ -103,9 +133,24 @@ private:  // Methods
    */
   QHash<QString, QString> getSqliteCompileOptions();
 
+  /**
+   * @brief Finish all cached queries
+   *
+   * Resets the statements of all cached queries to release their result sets
+   * when the transaction state changes.
+   */
+  void finishCachedQueries() noexcept;
+
 private:  // Data
   QSqlDatabase mDb;
+
+  /// Prepared queries, with the SQL text as key (see #prepareQuery())
+  mutable QHash<QString, QSqlQuery> mQueryCache;
   // int mNestedTransactionCount;
+
+  // Constants
+  static const int sMaxCachedQueries  = 256;  ///< Limit of #mQueryCache
+  static const int sMaxBoundVariables = 999;  ///< SQLITE_MAX_VARIABLE_NUMBER
 };
 
 /*******************************************************************************
@@ -34,6 +34,7 @@
 #include <cerrno>
 #include <libproc.h>
 #include <signal.h>
+#include <sys/resource.h>
 #elif defined(Q_OS_UNIX)  // UNIX/Linux
 #include <sys/types.h>
 #include <system_error>
@@ -41,6 +42,7 @@
 #include <cerrno>
 #include <pwd.h>
 #include <signal.h>
+#include <sys/resource.h>
 #include <unistd.h>
 #elif defined(Q_OS_WIN32) || defined(Q_OS_WIN64)  // Windows
 #ifdef WINVER
@@ -52,6 +54,8 @@
 #define WINVER 0x0600
 #define _WIN32_WINNT 0x0600
 #include <windows.h>
+// windows.h must be included first
+#include <psapi.h>
 #else
 #error "Unknown operating system!"
 #endif
@@ -298,6 +302,29 @@ QString SystemInfo::getProcessNameByPid(qint64 pid) {
   return processName;
 }
 
+qint64 SystemInfo::getPeakMemoryUsage() noexcept {
+#if defined(Q_OS_UNIX)  // Mac OS X / Linux / UNIX
+  struct rusage usage;
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(Q_OS_OSX)
+  return static_cast<qint64>(usage.ru_maxrss);  // bytes
+#else
+  return static_cast<qint64>(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+#elif defined(Q_OS_WIN32) || defined(Q_OS_WIN64)  // Windows
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters,
+                              sizeof(counters))) {
+    return 0;
+  }
+  return static_cast<qint64>(counters.PeakWorkingSetSize);
+#else
+#error "Unknown operating system!"
+#endif
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
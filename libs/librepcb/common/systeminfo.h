@@ -99,6 +99,14 @@ public:
    */
   static QString getProcessNameByPid(qint64 pid);
 
+  /**
+   * @brief Get the peak resident set size (physical memory) of this process
+   *
+   * @return  The highest memory usage since the process was started [bytes],
+   *          or 0 if it could not be determined.
+   */
+  static qint64 getPeakMemoryUsage() noexcept;
+
 private:
   // Cached Data
   static QString sUsername;
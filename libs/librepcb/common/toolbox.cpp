@@ -126,8 +126,8 @@ Length Toolbox::shortestDistanceBetweenPointAndLine(const Point& p,
 }
 
 QString Toolbox::incrementNumberInString(QString string) noexcept {
-  QRegularExpression      regex("([0-9]+)(?!.*[0-9]+)");
-  QRegularExpressionMatch match = regex.match(string);
+  static const QRegularExpression regex("([0-9]+)(?!.*[0-9]+)");
+  QRegularExpressionMatch         match = regex.match(string);
   if (match.hasMatch()) {
     // string contains numbers -> increment last number
     bool ok     = false;
@@ -144,19 +144,21 @@ QString Toolbox::incrementNumberInString(QString string) noexcept {
 }
 
 QStringList Toolbox::expandRangesInString(const QString& string) noexcept {
-  // Do NOT accept '+' and '-', they are considered as strings, not numbers!
-  // For example in the range connector signals range "X-1..10" you expect
-  // numbers starting from 1, not -1.
-  QString number    = "\\d+";
-  QString character = "[a-zA-Z]";
-  QString separator = "\\.\\.";
-  QString numberRange =
-      QString("(?<num_start>%1)%2(?<num_end>%1)").arg(number, separator);
-  QString characterRange =
-      QString("(?<char_start>%1)%2(?<char_end>%1)").arg(character, separator);
-  QString pattern =
-      QString("(?<num>%1)|(?<char>%2)").arg(numberRange, characterRange);
-  QRegularExpression                         re(pattern);
+  static const QRegularExpression re = []() {
+    // Do NOT accept '+' and '-', they are considered as strings, not numbers!
+    // For example in the range connector signals range "X-1..10" you expect
+    // numbers starting from 1, not -1.
+    QString number    = "\\d+";
+    QString character = "[a-zA-Z]";
+    QString separator = "\\.\\.";
+    QString numberRange =
+        QString("(?<num_start>%1)%2(?<num_end>%1)").arg(number, separator);
+    QString characterRange =
+        QString("(?<char_start>%1)%2(?<char_end>%1)").arg(character, separator);
+    QString pattern =
+        QString("(?<num>%1)|(?<char>%2)").arg(numberRange, characterRange);
+    return QRegularExpression(pattern);
+  }();
   QRegularExpressionMatchIterator            it = re.globalMatch(string);
   QVector<std::tuple<int, int, QStringList>> replacements;
   while (it.hasNext()) {
@@ -203,20 +203,35 @@ public:
       valueAbs = static_cast<UnsignedT>(value);
     }
 
-    QString str = QString::number(valueAbs);
-    if (str.length() > pointPos) {
-      // pointPos must be > 0 for this to work correctly
-      str.insert(str.length() - pointPos, '.');
-    } else {
-      for (qint32 i = pointPos - str.length(); i != 0; i--) str.insert(0, '0');
-      str.insert(0, "0.");
+    // collect the digits, least significant first
+    char   digits[std::numeric_limits<UnsignedT>::digits10 + 1];
+    qint32 digitsCount = 0;
+    do {
+      digits[digitsCount++] = static_cast<char>('0' + (valueAbs % 10));
+      valueAbs /= 10;
+    } while (valueAbs != 0);
+
+    // pointPos must be > 0 for this to work correctly
+    qint32 lastFracDigit = 0;  // skip trailing zeros, but keep at least one
+    while ((lastFracDigit < pointPos - 1) &&
+           ((lastFracDigit >= digitsCount) || (digits[lastFracDigit] == '0'))) {
+      ++lastFracDigit;
     }
 
-    while (str.endsWith('0') && !str.endsWith(".0")) str.chop(1);
-
-    if (value < 0) str.insert(0, '-');
-
-    return str;
+    QVarLengthArray<char, 32> str;
+    if (value < 0) str.append('-');
+    if (digitsCount > pointPos) {
+      for (qint32 i = digitsCount - 1; i >= pointPos; --i) {
+        str.append(digits[i]);
+      }
+    } else {
+      str.append('0');
+    }
+    str.append('.');
+    for (qint32 i = pointPos - 1; i >= lastFracDigit; --i) {
+      str.append((i < digitsCount) ? digits[i] : '0');
+    }
+    return QString::fromLatin1(str.constData(), str.size());
   }
 
   /**
@@ -230,6 +245,12 @@ public:
   static T decimalFixedPointFromString(const QString& str, qint32 pointPos) {
     using UnsignedT = typename std::make_unsigned<T>::type;
 
+    // fast path for the most common (serialized) format
+    T plainResult;
+    if (decimalFixedPointFromPlainString<T>(str, pointPos, plainResult)) {
+      return plainResult;
+    }
+
     const T         min   = std::numeric_limits<T>::min();
     const T         max   = std::numeric_limits<T>::max();
     const UnsignedT max_u = std::numeric_limits<UnsignedT>::max();
@@ -484,6 +505,72 @@ public:
   }
 
 private:
+  /**
+   * @brief Fast path of #decimalFixedPointFromString() for plain numbers
+   *
+   * Only handles strings like "-12.345" (ASCII digits, no '+', no exponent,
+   * at most pointPos decimal digits) which cannot overflow. All other
+   * strings are left to the generic parser.
+   *
+   * @param str      A QString that represents the number
+   * @param pointPos Number of decimal positions
+   * @param result   The parsed number (only set on success)
+   *
+   * @retval true    If the string was parsed successfully
+   * @retval false   If the generic parser needs to be used instead
+   */
+  template <typename T>
+  static bool decimalFixedPointFromPlainString(const QString& str,
+                                               qint32 pointPos,
+                                               T&     result) noexcept {
+    using UnsignedT = typename std::make_unsigned<T>::type;
+
+    const QChar* it   = str.constData();
+    const QChar* end  = it + str.length();
+    bool         sign = false;
+    if ((it != end) && (*it == '-')) {
+      sign = true;
+      ++it;
+    }
+
+    UnsignedT valueAbs   = 0;
+    qint32    digits     = 0;
+    qint32    fracDigits = -1;  // -1 means no decimal point found yet
+    for (; it != end; ++it) {
+      ushort c = it->unicode();
+      if ((c >= '0') && (c <= '9')) {
+        // may wrap around, but then the string is rejected below anyway
+        valueAbs = (valueAbs * 10) + static_cast<UnsignedT>(c - '0');
+        ++digits;
+        if (fracDigits >= 0) ++fracDigits;
+      } else if ((c == '.') && (fracDigits < 0)) {
+        fracDigits = 0;
+      } else {
+        return false;
+      }
+    }
+    if (fracDigits < 0) fracDigits = 0;
+    if ((digits == 0) || (fracDigits > pointPos) ||
+        (digits + pointPos - fracDigits >
+         std::numeric_limits<UnsignedT>::digits10)) {
+      return false;
+    }
+
+    for (qint32 i = fracDigits; i < pointPos; ++i) valueAbs *= 10;
+    if (sign) {
+      if (valueAbs > static_cast<UnsignedT>(std::numeric_limits<T>::min())) {
+        return false;
+      }
+      result = static_cast<T>(-valueAbs);
+    } else {
+      if (valueAbs > static_cast<UnsignedT>(std::numeric_limits<T>::max())) {
+        return false;
+      }
+      result = static_cast<T>(valueAbs);
+    }
+    return true;
+  }
+
   /**
    * @brief Internal helper function for #expandRangesInString(const QString&)
    */
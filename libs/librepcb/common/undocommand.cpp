@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "undocommand.h"
 
+#include "utils/performancecounters.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -41,6 +43,14 @@ UndoCommand::~UndoCommand() noexcept {
   Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommand::getMemoryUsage() const noexcept {
+  return sizeof(UndoCommand) + (mText.capacity() * sizeof(QChar));
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -53,6 +63,7 @@ bool UndoCommand::execute() {
   mIsExecuted = true;  // set this flag BEFORE performing the execution!
   bool retval = performExecute();  // can throw
   mRedoCount++;
+  PerformanceCounters::add(PerformanceCounters::Counter::UndoCommandsExecuted);
 
   return retval;
 }
@@ -75,6 +75,16 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Get the (estimated) memory usage of this command
+   *
+   * This is used by librepcb::UndoStack to limit its memory consumption.
+   * Derived classes holding a lot of data should override this method.
+   *
+   * @return Memory usage in bytes
+   */
+  virtual qint64 getMemoryUsage() const noexcept;
+
   // General Methods
 
   /**
@@ -46,6 +46,20 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommandGroup::getMemoryUsage() const noexcept {
+  qint64 usage = UndoCommand::getMemoryUsage() + sizeof(UndoCommandGroup) -
+                 sizeof(UndoCommand) +
+                 (mChilds.count() * sizeof(UndoCommand*));
+  foreach (const UndoCommand* child, mChilds) {
+    usage += child->getMemoryUsage();
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
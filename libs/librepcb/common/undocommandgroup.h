@@ -53,6 +53,9 @@ public:
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
 
+  /// @copydoc UndoCommand::getMemoryUsage()
+  virtual qint64 getMemoryUsage() const noexcept override;
+
   // General Methods
 
   /**
@@ -24,6 +24,7 @@
 
 #include "undocommand.h"
 #include "undocommandgroup.h"
+#include "utils/profiler.h"
 
 #include <QtCore>
 #include <QtWidgets>
@@ -77,7 +78,9 @@ UndoStack::UndoStack() noexcept
   : QObject(nullptr),
     mCurrentIndex(0),
     mCleanIndex(0),
-    mActiveCommandGroup(nullptr) {
+    mActiveCommandGroup(nullptr),
+    mMaxDepth(0),
+    mMaxMemoryUsage(100 * 1024 * 1024) {
 }
 
 UndoStack::~UndoStack() noexcept {
@@ -118,6 +121,12 @@ bool UndoStack::isCommandGroupActive() const noexcept {
   return (mActiveCommandGroup != nullptr);
 }
 
+qint64 UndoStack::getMemoryUsage() const noexcept {
+  qint64 usage = 0;
+  foreach (qint64 cmdUsage, mCommandsMemoryUsage) { usage += cmdUsage; }
+  return usage;
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -130,11 +139,23 @@ void UndoStack::setClean() noexcept {
   emit cleanChanged(true);
 }
 
+void UndoStack::setMaxDepth(int depth) noexcept {
+  mMaxDepth = qMax(depth, 0);
+  enforceLimits();
+}
+
+void UndoStack::setMaxMemoryUsage(qint64 bytes) noexcept {
+  mMaxMemoryUsage = qMax(bytes, qint64(0));
+  enforceLimits();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
 bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
+  Profiler::Scope scope(QStringLiteral("undo stack: execute command"));
+
   // make sure "cmd" is deleted when going out of scope (e.g. because of an
   // exception)
   QScopedPointer<UndoCommand> cmdScopeGuard(cmd);
@@ -159,13 +180,16 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
       delete mCommands.takeLast();
+      mCommandsMemoryUsage.removeLast();
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
 
     // add command to the command stack
     mCommands.append(
         cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
+    mCommandsMemoryUsage.append(forceKeepCmd ? 0 : cmd->getMemoryUsage());
     mCurrentIndex++;
+    if (!forceKeepCmd) enforceLimits();
 
     // emit signals
     emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -234,7 +258,9 @@ bool UndoStack::commitCmdGroup() {
 
   // To finish the active command group, we only need to reset the pointer to
   // the currently active command group
-  mActiveCommandGroup = nullptr;
+  mCommandsMemoryUsage.last() = mActiveCommandGroup->getMemoryUsage();
+  mActiveCommandGroup         = nullptr;
+  enforceLimits();
 
   // emit signals
   emit canUndoChanged(canUndo());
@@ -256,6 +282,7 @@ void UndoStack::abortCmdGroup() {
     mCurrentIndex--;
     delete mCommands.takeLast();  // delete and remove the aborted command group
                                   // from the stack
+    mCommandsMemoryUsage.removeLast();
   } catch (Exception& e) {
     qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
     throw;
@@ -333,6 +360,7 @@ void UndoStack::clear() noexcept {
   while (!mCommands.isEmpty()) {
     delete mCommands.takeLast();
   }
+  mCommandsMemoryUsage.clear();
 
   mCurrentIndex       = 0;
   mCleanIndex         = 0;
@@ -346,6 +374,31 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void UndoStack::enforceLimits() noexcept {
+  if (isCommandGroupActive()) {
+    return;  // the active command group must not be deleted
+  }
+
+  // Note: Since the newest command is always kept, neither the undo text nor
+  // the clean state changes, thus no signals need to be emitted.
+  qint64 memoryUsage = getMemoryUsage();
+  while ((mCurrentIndex > 1) &&
+         (((mMaxDepth > 0) && (mCommands.count() > mMaxDepth)) ||
+          ((mMaxMemoryUsage > 0) && (memoryUsage > mMaxMemoryUsage)))) {
+    // delete the oldest command, it can't be undone anymore
+    delete mCommands.takeFirst();
+    memoryUsage -= mCommandsMemoryUsage.takeFirst();
+    mCurrentIndex--;
+    if (mCleanIndex >= 0) {
+      mCleanIndex--;  // -1 means the clean state is no longer reachable
+    }
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
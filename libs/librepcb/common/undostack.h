@@ -114,6 +114,8 @@ public:
 
   /**
    * @brief The default constructor
+   *
+   * By default, the depth is unlimited and the memory budget is 100MB.
    */
   UndoStack() noexcept;
 
@@ -167,6 +169,34 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the count of commands on the stack (including redoable ones)
+   *
+   * @return Number of commands
+   */
+  int getCommandCount() const noexcept { return mCommands.count(); }
+
+  /**
+   * @brief Get the (estimated) memory usage of all commands on the stack
+   *
+   * @return Memory usage in bytes (see UndoCommand#getMemoryUsage())
+   */
+  qint64 getMemoryUsage() const noexcept;
+
+  /**
+   * @brief Get the maximum count of commands (see #setMaxDepth())
+   *
+   * @return Maximum count of commands (0 means unlimited)
+   */
+  int getMaxDepth() const noexcept { return mMaxDepth; }
+
+  /**
+   * @brief Get the memory budget (see #setMaxMemoryUsage())
+   *
+   * @return Maximum memory usage in bytes (0 means unlimited)
+   */
+  qint64 getMaxMemoryUsage() const noexcept { return mMaxMemoryUsage; }
+
   // Setters
 
   /**
@@ -174,6 +204,31 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Set the maximum count of commands on the stack
+   *
+   * If more commands are pushed, the oldest commands are deleted (i.e. they
+   * can't be undone anymore).
+   *
+   * @param depth     Maximum count of commands (0 means unlimited)
+   */
+  void setMaxDepth(int depth) noexcept;
+
+  /**
+   * @brief Set the memory budget for the commands on the stack
+   *
+   * If the commands need more memory (see #getMemoryUsage()), the oldest
+   * commands are deleted (i.e. they can't be undone anymore). The newest
+   * command is always kept, even if it exceeds the budget on its own.
+   *
+   * @note Deleted commands can't be swapped out to disk instead, since
+   *       commands refer to the (living or removed) objects they modify by
+   *       pointer, and executed commands own the objects they removed.
+   *
+   * @param bytes     Maximum memory usage in bytes (0 means unlimited)
+   */
+  void setMaxMemoryUsage(qint64 bytes) noexcept;
+
   // General Methods
 
   /**
@@ -291,6 +346,13 @@ signals:
   void stateModified();
 
 private:
+  /**
+   * @brief Delete the oldest commands until the limits are no longer exceeded
+   *
+   * @see #setMaxDepth(), #setMaxMemoryUsage()
+   */
+  void enforceLimits() noexcept;
+
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -324,6 +386,17 @@ private:
    * nullptr.
    */
   UndoCommandGroup* mActiveCommandGroup;
+
+  /**
+   * @brief The estimated memory usage of each command in #mCommands
+   *
+   * The memory usage of a command group is determined when it is committed
+   * (while being active, its entry is zero).
+   */
+  QList<qint64> mCommandsMemoryUsage;
+
+  int    mMaxDepth;        ///< See #setMaxDepth()
+  qint64 mMaxMemoryUsage;  ///< See #setMaxMemoryUsage()
 };
 
 /*******************************************************************************
@@ -22,6 +22,9 @@
  ******************************************************************************/
 #include "clipperhelpers.h"
 
+#include "performancecounters.h"
+
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -39,6 +42,7 @@ void ClipperHelpers::offset(ClipperLib::Paths& paths, const Length& offset,
     ClipperLib::ClipperOffset o(2.0, maxArcTolerance->toNm());
     o.AddPaths(paths, ClipperLib::jtRound, ClipperLib::etClosedPolygon);
     o.Execute(paths, offset.toNm());
+    PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
   } catch (const std::exception& e) {
     throw LogicError(__FILE__, __LINE__,
                      QString(tr("Failed to offset a path: %1")).arg(e.what()));
@@ -47,24 +51,46 @@ void ClipperHelpers::offset(ClipperLib::Paths& paths, const Length& offset,
 
 ClipperLib::Paths ClipperHelpers::flattenTree(
     const ClipperLib::PolyNode& node) {
-  ClipperLib::Paths paths;
+  QVector<const ClipperLib::PolyNode*> outlines;
+  outlines.reserve(static_cast<int>(node.Childs.size()));
   for (const ClipperLib::PolyNode* outlineChild : node.Childs) {
     Q_ASSERT(outlineChild);
     if (outlineChild->IsHole()) throw LogicError(__FILE__, __LINE__);
-    ClipperLib::Paths holes;
-    for (ClipperLib::PolyNode* holeChild : outlineChild->Childs) {
-      Q_ASSERT(holeChild);
-      if (!holeChild->IsHole()) throw LogicError(__FILE__, __LINE__);
-      holes.push_back(holeChild->Contour);
-      ClipperLib::Paths subpaths = flattenTree(*holeChild);  // can throw
-      paths.insert(paths.end(), subpaths.begin(), subpaths.end());
+    outlines.append(outlineChild);
+  }
+
+  // The outlines are independent of each other, so their cut-ins are
+  // calculated in parallel. The results are concatenated in the original
+  // order to get exactly the same output as a sequential run.
+  QVector<ClipperLib::Paths> results;
+  if (outlines.count() > 1) {
+    results = QtConcurrent::blockingMapped<QVector<ClipperLib::Paths>>(
+        outlines, &ClipperHelpers::flattenOutline);  // can throw
+  } else {
+    foreach (const ClipperLib::PolyNode* outline, outlines) {
+      results.append(flattenOutline(outline));  // can throw
     }
-    paths.push_back(
-        convertHolesToCutIns(outlineChild->Contour, holes));  // can throw
+  }
+
+  ClipperLib::Paths paths;
+  foreach (const ClipperLib::Paths& result, results) {
+    paths.insert(paths.end(), result.begin(), result.end());
   }
   return paths;
 }
 
+/*******************************************************************************
+ *  Batch Methods
+ ******************************************************************************/
+
+void ClipperHelpers::offset(QVector<ClipperLib::Paths>& paths,
+                            const Length&               offset,
+                            const PositiveLength&       maxArcTolerance) {
+  QtConcurrent::blockingMap(paths, [&](ClipperLib::Paths& item) {
+    ClipperHelpers::offset(item, offset, maxArcTolerance);  // can throw
+  });
+}
+
 /*******************************************************************************
  *  Conversion Methods
  ******************************************************************************/
@@ -105,6 +131,7 @@ ClipperLib::Paths ClipperHelpers::convert(
 ClipperLib::Path ClipperHelpers::convert(
     const Path& path, const PositiveLength& maxArcTolerance) noexcept {
   ClipperLib::Path p;
+  p.reserve(path.getVertices().count());  // more if there are arcs
   for (int i = 0; i < path.getVertices().count(); ++i) {
     const Vertex& v  = path.getVertices().at(i);
     const Vertex& v0 = path.getVertices().at(qMax(i - 1, 0));
@@ -136,6 +163,25 @@ ClipperLib::IntPoint ClipperHelpers::convert(const Point& point) noexcept {
  *  Internal Helper Methods
  ******************************************************************************/
 
+ClipperLib::Paths ClipperHelpers::flattenOutline(
+    const ClipperLib::PolyNode* outline) {
+  ClipperLib::Paths paths;
+  ClipperLib::Paths holes;
+  for (const ClipperLib::PolyNode* holeChild : outline->Childs) {
+    Q_ASSERT(holeChild);
+    if (!holeChild->IsHole()) throw LogicError(__FILE__, __LINE__);
+    holes.push_back(holeChild->Contour);
+    for (const ClipperLib::PolyNode* outlineChild : holeChild->Childs) {
+      Q_ASSERT(outlineChild);
+      if (outlineChild->IsHole()) throw LogicError(__FILE__, __LINE__);
+      ClipperLib::Paths subpaths = flattenOutline(outlineChild);  // can throw
+      paths.insert(paths.end(), subpaths.begin(), subpaths.end());
+    }
+  }
+  paths.push_back(convertHolesToCutIns(outline->Contour, holes));  // can throw
+  return paths;
+}
+
 ClipperLib::Path ClipperHelpers::convertHolesToCutIns(
     const ClipperLib::Path& outline, const ClipperLib::Paths& holes) {
   ClipperLib::Path  path          = outline;
@@ -54,6 +54,22 @@ public:
                      const PositiveLength& maxArcTolerance);
   static ClipperLib::Paths flattenTree(const ClipperLib::PolyNode& node);
 
+  // Batch Methods
+
+  /**
+   * @brief Offset many independent paths in parallel
+   *
+   * Same as #offset(ClipperLib::Paths&, const Length&, const PositiveLength&)
+   * on each item, but the items are distributed across the global thread
+   * pool. The order of the items is not modified.
+   *
+   * @param paths           The items to offset (in place)
+   * @param offset          The offset to apply to all items
+   * @param maxArcTolerance Maximum tolerance of the rounded corners
+   */
+  static void offset(QVector<ClipperLib::Paths>& paths, const Length& offset,
+                     const PositiveLength& maxArcTolerance);
+
   // Type Conversions
   static QVector<Path>     convert(const ClipperLib::Paths& paths) noexcept;
   static Path              convert(const ClipperLib::Path& path) noexcept;
@@ -66,6 +82,7 @@ public:
   static ClipperLib::IntPoint convert(const Point& point) noexcept;
 
 private:  // Internal Helper Methods
+  static ClipperLib::Paths flattenOutline(const ClipperLib::PolyNode* outline);
   static ClipperLib::Path  convertHolesToCutIns(const ClipperLib::Path&  outline,
                                                 const ClipperLib::Paths& holes);
   static ClipperLib::Paths prepareHoles(
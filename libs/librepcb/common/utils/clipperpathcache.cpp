@@ -17,14 +17,12 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef POLYGONSIMPLIFIER_H
-#define POLYGONSIMPLIFIER_H
-
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "clipperpathcache.h"
 
-#include <librepcb/common/geometry/polygon.h>
+#include "clipperhelpers.h"
 
 #include <QtCore>
 
@@ -34,38 +32,38 @@
 namespace librepcb {
 
 /*******************************************************************************
- *  Class PolygonSimplifier
+ *  Constructors / Destructor
  ******************************************************************************/
 
-/**
- * @brief The PolygonSimplifier class
- */
-template <typename LibElemType>
-class PolygonSimplifier {
-public:
-  // Constructors / Destructor
-  PolygonSimplifier(LibElemType& libraryElement);
-  ~PolygonSimplifier();
+ClipperPathCache::ClipperPathCache() noexcept : mVersion(0) {
+}
+
+ClipperPathCache::~ClipperPathCache() noexcept {
+}
 
-  // General Methods
-  void convertLineRectsToPolygonRects(bool fillArea, bool isGrabArea) noexcept;
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
 
-private:
-  // Private Methods
-  bool findLineRectangle(QList<librepcb::Polygon*>& lines) noexcept;
-  bool findHLine(const QList<Polygon*>& lines, librepcb::Point& p,
-                 UnsignedLength* width, librepcb::Polygon** line) noexcept;
-  bool findVLine(const QList<Polygon*>& lines, librepcb::Point& p,
-                 UnsignedLength* width, librepcb::Polygon** line) noexcept;
+ClipperLib::Path ClipperPathCache::get(
+    const Length& expansion, const PositiveLength& maxArcTolerance,
+    const OutlineGenerator& generator) noexcept {
+  QPair<qint64, qint64> key(expansion.toNm(), maxArcTolerance->toNm());
+  auto                  it = mPaths.find(key);
+  if (it == mPaths.end()) {
+    it = mPaths.insert(
+        key, ClipperHelpers::convert(generator(expansion), maxArcTolerance));
+  }
+  return *it;
+}
 
-  // Attributes
-  LibElemType& mLibraryElement;
-};
+void ClipperPathCache::invalidate() noexcept {
+  mPaths.clear();
+  ++mVersion;
+}
 
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
 
 }  // namespace librepcb
-
-#endif  // POLYGONSIMPLIFIER_H
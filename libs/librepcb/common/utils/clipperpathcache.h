@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CLIPPERPATHCACHE_H
+#define LIBREPCB_CLIPPERPATHCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../geometry/path.h"
+
+#include <clipper/clipper.hpp>
+
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ClipperPathCache
+ ******************************************************************************/
+
+/**
+ * @brief Cache for the ClipperLib paths of an outline
+ *
+ * Some objects (e.g. pads, vias and traces of a board) are converted to
+ * ClipperLib paths with the same parameters over and over again, for example
+ * for each rebuild of a plane. This class caches the converted path for each
+ * pair of expansion and arc tolerance.
+ *
+ * The owner must call #invalidate() whenever the outline changes. This also
+ * increments the version returned by #getVersion(), so users can cheaply
+ * detect whether the outline was modified since they last looked at it.
+ *
+ * @note This class is not thread-safe.
+ */
+class ClipperPathCache final {
+public:
+  // Types
+  typedef std::function<Path(const Length& expansion)> OutlineGenerator;
+
+  // Constructors / Destructor
+  ClipperPathCache(const ClipperPathCache& other) = delete;
+  ClipperPathCache() noexcept;
+  ~ClipperPathCache() noexcept;
+
+  // Getters
+  quint64 getVersion() const noexcept { return mVersion; }
+
+  // General Methods
+
+  /**
+   * @brief Get the converted path, generating it if not cached yet
+   *
+   * @param expansion         Expansion of the outline
+   * @param maxArcTolerance   Maximum arc tolerance for the conversion
+   * @param generator         Generates the outline for a given expansion
+   *
+   * @return The outline converted with librepcb::ClipperHelpers::convert()
+   */
+  ClipperLib::Path get(const Length&           expansion,
+                       const PositiveLength&   maxArcTolerance,
+                       const OutlineGenerator& generator) noexcept;
+
+  /**
+   * @brief Remove all cached paths and increment the version
+   */
+  void invalidate() noexcept;
+
+  // Operator Overloadings
+  ClipperPathCache& operator=(const ClipperPathCache& rhs) = delete;
+
+private:  // Data
+  quint64                                        mVersion;
+  QHash<QPair<qint64, qint64>, ClipperLib::Path> mPaths;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_CLIPPERPATHCACHE_H
@@ -0,0 +1,161 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_DISJOINTSETS_H
+#define LIBREPCB_DISJOINTSETS_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class DisjointSets
+ ******************************************************************************/
+
+/**
+ * @brief A partition of pointers into disjoint sets (union-find)
+ *
+ * This is intended to keep track of which items of a net segment are connected
+ * together while items are added, without traversing the whole segment after
+ * every modification. Merging two sets and looking up the set of an element
+ * take almost constant time.
+ *
+ * Every element is either "counted" or not, and #getCount() returns the number
+ * of sets containing at least one counted element. For example vias or net
+ * points would be counted, while pins (which are only part of a segment if a
+ * net line is attached) would not.
+ *
+ * @note Sets can only be merged, not split. After removing elements, the sets
+ *       need to be built again from scratch (see #clear()).
+ *
+ * @tparam T  The type of the pointed-to objects
+ */
+template <typename T>
+class DisjointSets final {
+public:
+  // Getters
+  bool contains(const T* element) const noexcept {
+    return mNodes.contains(element);
+  }
+
+  /**
+   * @brief Get the number of sets containing at least one counted element
+   */
+  int getCount() const noexcept { return mCount; }
+
+  // General Methods
+
+  /**
+   * @brief Add an element as a new set
+   *
+   * @param element   The element to add
+   * @param counted   Whether the element is taken into account by #getCount()
+   *
+   * @retval true   If the element was added
+   * @retval false  If the element was already contained (nothing changed)
+   */
+  bool insert(const T* element, bool counted) noexcept {
+    if (mNodes.contains(element)) return false;
+    mNodes.insert(element, Node{element, 0, counted});
+    if (counted) ++mCount;
+    return true;
+  }
+
+  /**
+   * @brief Get the representative element of the set containing an element
+   *
+   * @param element   An element which is contained in the sets
+   *
+   * @return The same element for all elements of the same set
+   */
+  const T* find(const T* element) noexcept {
+    Q_ASSERT(mNodes.contains(element));
+    const T* root = element;
+    while (mNodes[root].parent != root) {
+      root = mNodes[root].parent;
+    }
+    // path compression
+    while (element != root) {
+      Node& node  = mNodes[element];
+      element     = node.parent;
+      node.parent = root;
+    }
+    return root;
+  }
+
+  /**
+   * @brief Merge the sets of two elements
+   *
+   * Elements which are not contained yet are added as not counted elements.
+   *
+   * @retval true   If two different sets were merged
+   * @retval false  If both elements were already in the same set
+   */
+  bool unite(const T* a, const T* b) noexcept {
+    insert(a, false);
+    insert(b, false);
+    Node& rootA = mNodes[find(a)];
+    Node& rootB = mNodes[find(b)];
+    if (&rootA == &rootB) return false;
+    if (rootA.counted && rootB.counted) --mCount;
+    // union by rank
+    if (rootA.rank < rootB.rank) {
+      rootA.parent  = rootB.parent;
+      rootB.counted = rootB.counted || rootA.counted;
+    } else {
+      rootB.parent  = rootA.parent;
+      rootA.counted = rootA.counted || rootB.counted;
+      if (rootA.rank == rootB.rank) ++rootA.rank;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Remove all elements
+   */
+  void clear() noexcept {
+    mNodes.clear();
+    mCount = 0;
+  }
+
+private:  // Types
+  struct Node {
+    const T* parent;
+    int      rank;
+    bool     counted;  ///< Whether the set (if root) contains a counted element
+  };
+
+private:  // Data
+  QHash<const T*, Node> mNodes;
+  int                   mCount = 0;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_DISJOINTSETS_H
@@ -50,12 +50,12 @@ GraphicsLayerStackAppearanceSettings::GraphicsLayerStackAppearanceSettings(
 GraphicsLayerStackAppearanceSettings::GraphicsLayerStackAppearanceSettings(
     IF_GraphicsLayerProvider& layers, const SExpression& node)
   : mLayers(layers) {
-  for (const SExpression& child : node.getChildren("layer")) {
-    QString name = child.getChildByIndex(0).getValue<QString>(true);
+  for (const SExpression* child : node.getChildren("layer")) {
+    QString name = child->getChildByIndex(0).getValue<QString>(true);
     if (GraphicsLayer* layer = mLayers.getLayer(name)) {
-      layer->setColor(child.getValueByPath<QColor>("color"));
-      layer->setColorHighlighted(child.getValueByPath<QColor>("color_hl"));
-      layer->setVisible(child.getValueByPath<bool>("visible"));
+      layer->setColor(child->getValueByPath<QColor>("color"));
+      layer->setColorHighlighted(child->getValueByPath<QColor>("color_hl"));
+      layer->setVisible(child->getValueByPath<bool>("visible"));
     }
   }
 }
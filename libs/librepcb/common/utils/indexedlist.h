@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_INDEXEDLIST_H
+#define LIBREPCB_INDEXEDLIST_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class IndexedList
+ ******************************************************************************/
+
+/**
+ * @brief A list of unique pointers with constant time lookup and removal
+ *
+ * This is intended for the registration of objects at other objects (e.g.
+ * net segments at their net signal), where a plain QList would need a linear
+ * search for each registration and unregistration. Additionally to the list,
+ * the index of each element is stored in a hash map.
+ *
+ * @warning Removing an element moves the last element of the list to the
+ *          position of the removed element, i.e. the order of the elements is
+ *          not stable.
+ *
+ * @tparam T  The type of the pointed-to objects
+ */
+template <typename T>
+class IndexedList final {
+public:
+  // Getters
+  const QList<T*>& values() const noexcept { return mValues; }
+  int              count() const noexcept { return mValues.count(); }
+  bool             isEmpty() const noexcept { return mValues.isEmpty(); }
+  bool contains(const T* value) const noexcept {
+    return mIndices.contains(value);
+  }
+
+  // General Methods
+
+  /**
+   * @brief Append an element to the list
+   *
+   * @param value   The element to append
+   *
+   * @retval true   If the element was appended
+   * @retval false  If the element was already contained in the list
+   */
+  bool append(T* value) noexcept {
+    if (mIndices.contains(value)) return false;
+    mIndices.insert(value, mValues.count());
+    mValues.append(value);
+    return true;
+  }
+
+  /**
+   * @brief Remove an element from the list
+   *
+   * @param value   The element to remove
+   *
+   * @retval true   If the element was removed
+   * @retval false  If the element was not contained in the list
+   */
+  bool remove(const T* value) noexcept {
+    auto it = mIndices.find(value);
+    if (it == mIndices.end()) return false;
+    int index = it.value();
+    mIndices.erase(it);
+    T* last = mValues.takeLast();
+    if (last != value) {
+      mValues[index] = last;
+      mIndices[last] = index;
+    }
+    return true;
+  }
+
+private:  // Data
+  QList<T*>            mValues;
+  QHash<const T*, int> mIndices;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_INDEXEDLIST_H
@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_OBJECTPOOL_H
+#define LIBREPCB_OBJECTPOOL_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <new>
+#include <type_traits>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ObjectPool
+ ******************************************************************************/
+
+/**
+ * @brief Fixed size block allocator for frequently created objects
+ *
+ * Objects of type T are allocated from chunks of memory which are never
+ * returned to the system, but reused for objects created later. This makes
+ * creating and destroying lots of objects (e.g. when loading a project, or
+ * when undoing a big paste) cheap, and objects created together are close
+ * to each other in memory.
+ *
+ * To use the pool, overload the class specific allocation functions of T:
+ *
+ * @code
+ * static void* operator new(std::size_t size) {
+ *   return ObjectPool<Foo>::allocate(size);
+ * }
+ * static void operator delete(void* p, std::size_t size) noexcept {
+ *   ObjectPool<Foo>::deallocate(p, size);
+ * }
+ * @endcode
+ *
+ * Requests of a different size than `sizeof(T)` (i.e. of derived classes) are
+ * forwarded to the global allocation functions.
+ *
+ * @note The pool is thread-safe.
+ */
+template <typename T>
+class ObjectPool final {
+public:
+  // Constructors / Destructor
+  ObjectPool()                        = delete;
+  ObjectPool(const ObjectPool& other) = delete;
+  ~ObjectPool()                       = delete;
+
+  // General Methods
+  static void* allocate(std::size_t size) {
+    if (size != sizeof(T)) {
+      return ::operator new(size);  // can throw
+    }
+    State&       state = getState();
+    QMutexLocker locker(&state.mutex);
+    if (!state.freeBlocks) {
+      Block* chunk = static_cast<Block*>(
+          ::operator new(sizeof(Block) * chunkSize()));  // can throw
+      for (int i = chunkSize() - 1; i >= 0; --i) {
+        chunk[i].next    = state.freeBlocks;
+        state.freeBlocks = &chunk[i];
+      }
+    }
+    Block* block     = state.freeBlocks;
+    state.freeBlocks = block->next;
+    return block;
+  }
+
+  static void deallocate(void* p, std::size_t size) noexcept {
+    if (!p) {
+      return;
+    } else if (size != sizeof(T)) {
+      ::operator delete(p);
+      return;
+    }
+    State&       state = getState();
+    QMutexLocker locker(&state.mutex);
+    Block*       block = static_cast<Block*>(p);
+    block->next        = state.freeBlocks;
+    state.freeBlocks   = block;
+  }
+
+  // Operator Overloadings
+  ObjectPool& operator=(const ObjectPool& rhs) = delete;
+
+private:  // Types
+  union Block {
+    Block*                                                     next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  struct State {
+    QMutex mutex;
+    Block* freeBlocks = nullptr;
+  };
+
+private:  // Methods
+  static State& getState() noexcept {
+    // Note: Intentionally never destroyed since objects might be deleted
+    // during destruction of static objects.
+    static State* state = new State();
+    return *state;
+  }
+
+  /**
+   * Returns the number of objects allocated at once.
+   */
+  static int chunkSize() noexcept { return 256; }
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_OBJECTPOOL_H
@@ -0,0 +1,93 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "performancecounters.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+QAtomicInt PerformanceCounters::sEnabled(0);
+QAtomicInteger<qint64>
+    PerformanceCounters::sValues[static_cast<int>(Counter::_COUNT)];
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void PerformanceCounters::setEnabled(bool enabled) noexcept {
+  sEnabled.store(enabled ? 1 : 0);
+}
+
+qint64 PerformanceCounters::get(Counter counter) noexcept {
+  return sValues[static_cast<int>(counter)].load();
+}
+
+QString PerformanceCounters::getName(Counter counter) noexcept {
+  switch (counter) {
+    case Counter::SExpressionNodesParsed:
+      return "sexpression nodes parsed";
+    case Counter::ClipperExecutions:
+      return "clipper executions";
+    case Counter::PlaneRebuilds:
+      return "plane rebuilds";
+    case Counter::AirWireRebuilds:
+      return "airwire rebuilds";
+    case Counter::UndoCommandsExecuted:
+      return "undo commands executed";
+    case Counter::SqlQueries:
+      return "sql queries";
+    case Counter::GraphicsItemsCreated:
+      return "graphics items created";
+    default:
+      Q_ASSERT(false);
+      return QString();
+  }
+}
+
+QList<PerformanceCounters::Entry> PerformanceCounters::getEntries() noexcept {
+  QList<Entry> entries;
+  for (int i = 0; i < static_cast<int>(Counter::_COUNT); ++i) {
+    Counter counter = static_cast<Counter>(i);
+    entries.append(Entry{counter, getName(counter), get(counter)});
+  }
+  return entries;
+}
+
+void PerformanceCounters::reset() noexcept {
+  for (int i = 0; i < static_cast<int>(Counter::_COUNT); ++i) {
+    sValues[i].store(0);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
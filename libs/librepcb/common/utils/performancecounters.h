@@ -0,0 +1,102 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PERFORMANCECOUNTERS_H
+#define LIBREPCB_PERFORMANCECOUNTERS_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class PerformanceCounters
+ ******************************************************************************/
+
+/**
+ * @brief Counts how often expensive operations are executed
+ *
+ * In contrast to the timings of the ::librepcb::Profiler, these counts are
+ * deterministic, so unit tests can assert on them (e.g. that moving a via
+ * does not rebuild all planes) and they are reported in diagnostics like the
+ * `--profile` output of the command line interface.
+ *
+ * The counters are disabled by default, then #add() only loads an atomic flag
+ * and does nothing else. After enabling them with #setEnabled(), every call
+ * atomically adds to the counter.
+ *
+ * Example:
+ * @code
+ * PerformanceCounters::add(PerformanceCounters::Counter::PlaneRebuilds);
+ * @endcode
+ *
+ * @note All methods are thread-safe.
+ */
+class PerformanceCounters final {
+public:
+  // Types
+  enum class Counter {
+    SExpressionNodesParsed,  ///< Nodes of parsed S-Expression files
+    ClipperExecutions,       ///< Executed Clipper operations
+    PlaneRebuilds,           ///< Built plane fragments (per plane)
+    AirWireRebuilds,         ///< Built airwires (per net signal)
+    UndoCommandsExecuted,    ///< Executed undo commands (incl. child commands)
+    SqlQueries,              ///< Executed SQLite queries
+    GraphicsItemsCreated,    ///< Created board and schematic graphics items
+    _COUNT                   ///< Number of counters, not a valid counter
+  };
+  struct Entry {
+    Counter counter;
+    QString name;
+    qint64  value;
+  };
+
+  // Constructors / Destructor
+  PerformanceCounters() = delete;
+
+  // Static Methods
+  static bool isEnabled() noexcept { return sEnabled.load() != 0; }
+  static void setEnabled(bool enabled) noexcept;
+  static void add(Counter counter, qint64 value = 1) noexcept {
+    if (isEnabled()) {
+      sValues[static_cast<int>(counter)].fetchAndAddRelaxed(value);
+    }
+  }
+  static qint64       get(Counter counter) noexcept;
+  static QString      getName(Counter counter) noexcept;
+  static QList<Entry> getEntries() noexcept;
+  static void         reset() noexcept;
+
+private:  // Data
+  static QAtomicInt             sEnabled;
+  static QAtomicInteger<qint64> sValues[static_cast<int>(Counter::_COUNT)];
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PERFORMANCECOUNTERS_H
@@ -0,0 +1,264 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "profiler.h"
+
+#include <QtCore>
+
+#include <algorithm>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+struct TraceEvent {
+  QString name;
+  int     sequence;  ///< To keep the order of recording across threads
+  qint64  start;     ///< Nanoseconds, from Profiler::getTimestamp()
+  qint64  duration;  ///< Nanoseconds
+  int     threadId;  ///< Only set by getAllEvents()
+};
+
+struct TraceBuffer {
+  QMutex              mutex;  ///< Only contended while exporting
+  int                 threadId;
+  QString             threadName;
+  QVector<TraceEvent> events;
+};
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+static QAtomicInt                          sEnabled(0);
+static QAtomicInt                          sSequence(0);
+static QMutex                              sMutex;    // protects the lists
+static QList<std::shared_ptr<TraceBuffer>> sBuffers;  // one per thread
+static QList<Profiler::MemoryUsageEntry>   sMemoryUsages;
+
+/*******************************************************************************
+ *  Static Functions
+ ******************************************************************************/
+
+static TraceBuffer& getTraceBuffer() noexcept {
+  // The buffer is shared with sBuffers to keep its events after the thread
+  // has finished.
+  thread_local std::shared_ptr<TraceBuffer> buffer;
+  if (!buffer) {
+    buffer.reset(new TraceBuffer());
+    bool isMainThread = qApp && (QThread::currentThread() == qApp->thread());
+    QMutexLocker locker(&sMutex);
+    buffer->threadId = sBuffers.count() + 1;
+    if (isMainThread) {
+      buffer->threadName = "main";
+    } else {
+      buffer->threadName = QString("thread %1").arg(buffer->threadId);
+    }
+    sBuffers.append(buffer);
+  }
+  return *buffer;
+}
+
+static QVector<TraceEvent> getAllEvents() noexcept {
+  QVector<TraceEvent> events;
+  QMutexLocker        locker(&sMutex);
+  foreach (const std::shared_ptr<TraceBuffer>& buffer, sBuffers) {
+    QMutexLocker bufferLocker(&buffer->mutex);
+    foreach (const TraceEvent& event, buffer->events) {
+      events.append(event);
+      events.last().threadId = buffer->threadId;
+    }
+  }
+  std::sort(events.begin(), events.end(),
+            [](const TraceEvent& a, const TraceEvent& b) {
+              return a.sequence < b.sequence;
+            });
+  return events;
+}
+
+/*******************************************************************************
+ *  Class Profiler::Scope
+ ******************************************************************************/
+
+Profiler::Scope::Scope(const char* name) noexcept : mStart(0) {
+  if (isEnabled()) {
+    mName  = QString(name);
+    mStart = getTimestamp();
+  }
+}
+
+Profiler::Scope::Scope(const QString& name) noexcept : mStart(0) {
+  if (isEnabled()) {
+    mName  = name;
+    mStart = getTimestamp();
+  }
+}
+
+Profiler::Scope::Scope(const char* format, const QString& arg1) noexcept
+  : mStart(0) {
+  if (isEnabled()) {
+    mName  = QString(format).arg(arg1);
+    mStart = getTimestamp();
+  }
+}
+
+Profiler::Scope::Scope(const char* format, const QString& arg1,
+                       const QString& arg2) noexcept
+  : mStart(0) {
+  if (isEnabled()) {
+    mName  = QString(format).arg(arg1, arg2);
+    mStart = getTimestamp();
+  }
+}
+
+Profiler::Scope::~Scope() noexcept {
+  stop();
+}
+
+void Profiler::Scope::stop() noexcept {
+  if (!mName.isEmpty()) {
+    recordEvent(mName, mStart, getTimestamp() - mStart);
+    mName.clear();
+  }
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+bool Profiler::isEnabled() noexcept {
+  return sEnabled.load() != 0;
+}
+
+void Profiler::setEnabled(bool enabled) noexcept {
+  sEnabled.store(enabled ? 1 : 0);
+}
+
+void Profiler::record(const QString& name, qint64 nanoseconds) noexcept {
+  recordEvent(name, getTimestamp() - nanoseconds, nanoseconds);
+}
+
+QList<Profiler::Entry> Profiler::getEntries() noexcept {
+  QList<Entry>        entries;  // in order of first recording
+  QHash<QString, int> indices;
+  foreach (const TraceEvent& event, getAllEvents()) {
+    auto it = indices.find(event.name);
+    if (it == indices.end()) {
+      indices.insert(event.name, entries.count());
+      entries.append(Entry{event.name, 1, event.duration});
+    } else {
+      Entry& entry = entries[it.value()];
+      entry.count++;
+      entry.nanoseconds += event.duration;
+    }
+  }
+  return entries;
+}
+
+QByteArray Profiler::getChromeTrace() noexcept {
+  QVector<TraceEvent> events = getAllEvents();
+  qint64              pid    = QCoreApplication::applicationPid();
+  QJsonArray          traceEvents;
+  {
+    QMutexLocker locker(&sMutex);
+    foreach (const std::shared_ptr<TraceBuffer>& buffer, sBuffers) {
+      QJsonObject args;
+      args.insert("name", buffer->threadName);
+      QJsonObject obj;
+      obj.insert("name", "thread_name");
+      obj.insert("ph", "M");  // metadata event
+      obj.insert("pid", pid);
+      obj.insert("tid", buffer->threadId);
+      obj.insert("args", args);
+      traceEvents.append(obj);
+    }
+  }
+  foreach (const TraceEvent& event, events) {
+    QJsonObject obj;
+    obj.insert("name", event.name);
+    obj.insert("cat", "librepcb");
+    obj.insert("ph", "X");  // complete event
+    obj.insert("ts", event.start / 1e3);  // microseconds
+    obj.insert("dur", event.duration / 1e3);
+    obj.insert("pid", pid);
+    obj.insert("tid", event.threadId);
+    traceEvents.append(obj);
+  }
+  QJsonObject root;
+  root.insert("traceEvents", traceEvents);
+  root.insert("displayTimeUnit", "ms");
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+void Profiler::recordMemoryUsage(const QString& name, qint64 bytes) noexcept {
+  if (isEnabled()) {
+    QMutexLocker locker(&sMutex);
+    sMemoryUsages.append(MemoryUsageEntry{name, bytes});
+  }
+}
+
+QList<Profiler::MemoryUsageEntry> Profiler::getMemoryUsageEntries() noexcept {
+  QMutexLocker locker(&sMutex);
+  return sMemoryUsages;
+}
+
+void Profiler::clear() noexcept {
+  QMutexLocker locker(&sMutex);
+  sMemoryUsages.clear();
+  foreach (const std::shared_ptr<TraceBuffer>& buffer, sBuffers) {
+    QMutexLocker bufferLocker(&buffer->mutex);
+    buffer->events.clear();
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+qint64 Profiler::getTimestamp() noexcept {
+  static QElapsedTimer timer = []() {
+    QElapsedTimer t;
+    t.start();
+    return t;
+  }();
+  return timer.nsecsElapsed();
+}
+
+void Profiler::recordEvent(const QString& name, qint64 start,
+                           qint64 duration) noexcept {
+  TraceEvent   event{name, sSequence.fetchAndAddRelaxed(1), start, duration, 0};
+  TraceBuffer& buffer = getTraceBuffer();
+  QMutexLocker locker(&buffer.mutex);
+  buffer.events.append(event);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,137 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROFILER_H
+#define LIBREPCB_PROFILER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class Profiler
+ ******************************************************************************/
+
+/**
+ * @brief Collects the durations of named operations for a timing report
+ *
+ * The profiler is disabled by default, then #Scope does not measure anything.
+ * After enabling it with #setEnabled(), every #Scope adds its lifetime to the
+ * entry with its name. Entries are reported in the order they were recorded
+ * the first time, and operations with the same name are accumulated.
+ *
+ * Every recorded operation is also kept as a separate event with its start
+ * time and thread, so #getChromeTrace() can export the timeline for the
+ * Chrome trace viewer (chrome://tracing) or Perfetto (https://ui.perfetto.dev).
+ * Nested scopes appear as a hierarchy there. Events are collected in
+ * separate buffers per thread, so recording is cheap even from worker threads.
+ *
+ * In addition, (estimated) memory usages of named objects can be recorded
+ * with #recordMemoryUsage(), e.g. the parts of a project right after opening
+ * it. They are reported by #getMemoryUsageEntries() in recording order.
+ *
+ * Example:
+ * @code
+ * void Board::rebuildAllPlanes() noexcept {
+ *   Profiler::Scope scope("planes");
+ *   ...
+ * }
+ * @endcode
+ *
+ * @note All methods are thread-safe.
+ */
+class Profiler final {
+public:
+  // Types
+  struct Entry {
+    QString name;
+    int     count;        ///< Number of recorded operations
+    qint64  nanoseconds;  ///< Total duration of all recorded operations
+  };
+  struct MemoryUsageEntry {
+    QString name;
+    qint64  bytes;
+  };
+
+  /**
+   * @brief Measures its own lifetime and records it in the profiler
+   *
+   * To keep scopes cheap while the profiler is disabled, names containing
+   * arguments should be passed as format string with separate arguments
+   * (e.g. `Scope scope("board '%1': planes", *mName)`). Then the name is only
+   * built if the profiler is enabled.
+   */
+  class Scope final {
+  public:
+    Scope()                   = delete;
+    Scope(const Scope& other) = delete;
+    explicit Scope(const char* name) noexcept;
+    explicit Scope(const QString& name) noexcept;
+    Scope(const char* format, const QString& arg1) noexcept;
+    Scope(const char* format, const QString& arg1,
+          const QString& arg2) noexcept;
+    ~Scope() noexcept;
+
+    /**
+     * @brief Record the duration now instead of in the destructor
+     *
+     * Useful if the measured operation ends before the end of the C++ scope,
+     * e.g. the construction of a local object.
+     */
+    void stop() noexcept;
+
+    Scope& operator=(const Scope& rhs) = delete;
+
+  private:
+    QString mName;   ///< Empty if the profiler is disabled
+    qint64  mStart;  ///< Timestamp from Profiler::getTimestamp()
+  };
+
+  // Constructors / Destructor
+  Profiler() = delete;
+
+  // Static Methods
+  static bool         isEnabled() noexcept;
+  static void         setEnabled(bool enabled) noexcept;
+  static void         record(const QString& name, qint64 nanoseconds) noexcept;
+  static QList<Entry> getEntries() noexcept;
+  static QByteArray   getChromeTrace() noexcept;
+  static void recordMemoryUsage(const QString& name, qint64 bytes) noexcept;
+  static QList<MemoryUsageEntry> getMemoryUsageEntries() noexcept;
+  static void                    clear() noexcept;
+
+private:  // Methods
+  static qint64 getTimestamp() noexcept;
+  static void   recordEvent(const QString& name, qint64 start,
+                            qint64 duration) noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROFILER_H
@@ -0,0 +1,212 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_TASKSCHEDULER_H
+#define LIBREPCB_TASKSCHEDULER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <functional>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class TaskScheduler
+ ******************************************************************************/
+
+/**
+ * @brief Runs background computations with priorities on a shared thread pool
+ *
+ * All tasks are executed by the global QThreadPool, i.e. the same threads
+ * which are used by QtConcurrent. So the whole application never uses more
+ * worker threads than there are cores, no matter how many subsystems compute
+ * something in the background at the same time.
+ *
+ * Queued tasks are started in the order of their #Priority, so for example a
+ * plane rebuild triggered by the user is not delayed by exporting production
+ * data in the background.
+ *
+ * Waiting for a task which was not started yet (e.g. with
+ * QFuture::waitForFinished() or QFuture::result()) executes it directly in
+ * the waiting thread instead of blocking it. So tasks can wait for other
+ * tasks without the risk of deadlocks or idle worker threads. This is also
+ * how task dependencies are implemented: A task waits for its dependencies
+ * before calling its function.
+ *
+ * Example:
+ * @code
+ * TaskScheduler::CancellationToken token;
+ * QFuture<QVector<Path>> future = TaskScheduler::run(
+ *     TaskScheduler::Priority::Interactive, [token, builder]() {
+ *       return builder->build(token);  // checks token.isCanceled()
+ *     });
+ * ...
+ * token.cancel();
+ * @endcode
+ *
+ * @note Like with QtConcurrent, exceptions derived from QException (e.g.
+ *       ::librepcb::Exception) thrown by a task's function are rethrown by
+ *       QFuture::result(). Other exceptions are converted to
+ *       QUnhandledException.
+ */
+class TaskScheduler final {
+public:
+  // Types
+
+  /**
+   * @brief Priorities of tasks, the values are passed to QThreadPool::start()
+   */
+  enum class Priority {
+    Batch       = 0,  ///< E.g. exports, which may take as long as they need
+    Background  = 1,  ///< E.g. loading or scanning files
+    Interactive = 2,  ///< E.g. planes, airwires, everything the user waits for
+  };
+
+  /**
+   * @brief Allows to cancel running tasks
+   *
+   * Copies of a token share their state, so a token can be captured by the
+   * task's function and canceled from another thread. Canceling does not
+   * interrupt anything, the function needs to check #isCanceled()
+   * periodically. To abort tasks which were not started yet, use
+   * QFuture::cancel() (which does not affect running tasks).
+   */
+  class CancellationToken final {
+  public:
+    CancellationToken() noexcept : mCanceled(std::make_shared<QAtomicInt>(0)) {}
+    CancellationToken(const CancellationToken& other) = default;
+    ~CancellationToken() noexcept {}
+    bool isCanceled() const noexcept { return mCanceled->load() != 0; }
+    void cancel() noexcept { mCanceled->store(1); }
+    CancellationToken& operator=(const CancellationToken& rhs) = default;
+
+  private:
+    std::shared_ptr<QAtomicInt> mCanceled;
+  };
+
+  // Constructors / Destructor
+  TaskScheduler() = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Run a function in a worker thread
+   *
+   * @param priority    Priority of the task.
+   * @param func        The function to execute.
+   *
+   * @return The future of the function's result. Canceling the future before
+   *         the task was started prevents the function from being called.
+   */
+  template <typename Func>
+  static auto run(Priority priority, Func func) -> QFuture<decltype(func())> {
+    return run(priority, QList<QFuture<void>>(), func);
+  }
+
+  /**
+   * @brief Run a function in a worker thread after other tasks are finished
+   *
+   * @param priority      Priority of the task.
+   * @param dependencies  Futures which need to be finished before the function
+   *                      is called. The function is still called if any of
+   *                      them was canceled.
+   * @param func          The function to execute.
+   *
+   * @return The future of the function's result.
+   */
+  template <typename Func>
+  static auto run(Priority priority, const QList<QFuture<void>>& dependencies,
+                  Func func) -> QFuture<decltype(func())> {
+    typedef decltype(func()) T;
+    Task<T>* task = new Task<T>(dependencies, func);
+    return task->start(getThreadPool(), priority);
+  }
+
+  /**
+   * @brief Get the thread pool which executes all tasks
+   */
+  static QThreadPool& getThreadPool() noexcept {
+    return *QThreadPool::globalInstance();
+  }
+
+private:  // Types
+  template <typename T>
+  class Task final : public QRunnable {
+  public:
+    Task(const QList<QFuture<void>>& dependencies,
+         const std::function<T()>&   func) noexcept
+      : mDependencies(dependencies), mFunc(func) {}
+
+    QFuture<T> start(QThreadPool& pool, Priority priority) noexcept {
+      mInterface.setThreadPool(&pool);
+      mInterface.setRunnable(this);
+      mInterface.reportStarted();
+      QFuture<T> future = mInterface.future();
+      pool.start(this, static_cast<int>(priority));  // takes ownership
+      return future;
+    }
+
+    void run() override {
+      for (QFuture<void>& dependency : mDependencies) {
+        dependency.waitForFinished();  // runs it here if not started yet
+      }
+      if (!mInterface.isCanceled()) {
+        try {
+          execute(mInterface, mFunc);
+        } catch (const QException& e) {
+          mInterface.reportException(e);
+        } catch (...) {
+          mInterface.reportException(QUnhandledException());
+        }
+      }
+      mInterface.reportFinished();
+    }
+
+  private:
+    template <typename R>
+    static void execute(QFutureInterface<R>&      interface,
+                        const std::function<R()>& func) {
+      interface.reportResult(func());  // can throw
+    }
+    static void execute(QFutureInterface<void>&      interface,
+                        const std::function<void()>& func) {
+      Q_UNUSED(interface);
+      func();  // can throw
+    }
+
+    QList<QFuture<void>> mDependencies;
+    std::function<T()>   mFunc;
+    QFutureInterface<T>  mInterface;
+  };
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_TASKSCHEDULER_H
@@ -22,7 +22,6 @@
  ******************************************************************************/
 #include "uuid.h"
 
-#include <QRegularExpressionValidator>
 #include <QtCore>
 
 /*******************************************************************************
@@ -30,39 +29,51 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QString Uuid::toStr() const noexcept {
+  static const char hexDigits[] = "0123456789abcdef";
+  QString           str(36, Qt::Uninitialized);
+  QChar*            out = str.data();
+  for (int i = 0; i < 16; ++i) {
+    if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+      *out++ = QLatin1Char('-');
+    }
+    *out++ = QLatin1Char(hexDigits[mBytes[i] >> 4]);
+    *out++ = QLatin1Char(hexDigits[mBytes[i] & 0x0F]);
+  }
+  return str;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
 
 bool Uuid::isValid(const QString& str) noexcept {
-  // check format of string (only accept EXACT matches!)
-  QRegularExpression re(
-      "^[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}$");
-  QRegularExpressionMatch match =
-      re.match(str, 0, QRegularExpression::PartialPreferCompleteMatch);
-  if (!match.hasMatch()) return false;
-
-  // check type of uuid
-  QUuid quuid(str);
-  if (quuid.isNull()) return false;
-  if (quuid.variant() != QUuid::DCE) return false;
-  if (quuid.version() != QUuid::Random) return false;
-  return true;
+  quint8 bytes[16];
+  return parse(str, bytes);
 }
 
 Uuid Uuid::createRandom() noexcept {
-  QString str =
-      QUuid::createUuid().toString().remove("{").remove("}").toLower();
-  if (isValid(str)) {
-    return Uuid(str);
+  QUuid  quuid = QUuid::createUuid();
+  quint8 bytes[16];
+  qToBigEndian(quuid.data1, bytes);
+  qToBigEndian(quuid.data2, bytes + 4);
+  qToBigEndian(quuid.data3, bytes + 6);
+  std::memcpy(bytes + 8, quuid.data4, 8);
+  if ((quuid.variant() == QUuid::DCE) && (quuid.version() == QUuid::Random)) {
+    return Uuid(bytes);
   } else {
     qFatal("Not able to generate valid random UUID!");  // calls abort()!
   }
 }
 
 Uuid Uuid::fromString(const QString& str) {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint8 bytes[16];
+  if (parse(str, bytes)) {
+    return Uuid(bytes);
   } else {
     throw RuntimeError(
         __FILE__, __LINE__,
@@ -71,13 +82,46 @@ Uuid Uuid::fromString(const QString& str) {
 }
 
 tl::optional<Uuid> Uuid::tryFromString(const QString& str) noexcept {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint8 bytes[16];
+  if (parse(str, bytes)) {
+    return Uuid(bytes);
   } else {
     return tl::nullopt;
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool Uuid::parse(const QString& str, quint8* bytes) noexcept {
+  // check format of string (only accept EXACT matches of lowercase UUIDs!)
+  if (str.length() != 36) return false;
+  const QChar* in = str.constData();
+  for (int i = 0; i < 16; ++i) {
+    if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+      if (*in++ != QLatin1Char('-')) return false;
+    }
+    int value = 0;
+    for (int k = 0; k < 2; ++k) {
+      ushort c = (in++)->unicode();
+      if ((c >= '0') && (c <= '9')) {
+        value = (value << 4) | (c - '0');
+      } else if ((c >= 'a') && (c <= 'f')) {
+        value = (value << 4) | (c - 'a' + 10);
+      } else {
+        return false;
+      }
+    }
+    bytes[i] = static_cast<quint8>(value);
+  }
+
+  // check type of uuid (DCE variant, version 4)
+  if ((bytes[6] & 0xF0) != 0x40) return false;
+  if ((bytes[8] & 0xC0) != 0x80) return false;
+  return true;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
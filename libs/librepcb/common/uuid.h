@@ -29,6 +29,8 @@
 
 #include <QtCore>
 
+#include <cstring>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -48,6 +50,10 @@ namespace librepcb {
  *
  * A valid UUID looks like this: "d79d354b-62bd-4866-996a-78941c575e78"
  *
+ * Internally the UUID is stored as its 16 raw bytes (in the same order as
+ * they appear in the string), thus copying, comparing and hashing is cheap
+ * and the ordering is the same as if the strings were compared.
+ *
  * @note This class guarantees that only Uuid objects representing a valid UUID
  * can be created (in opposite to QUuid which allows "Null UUIDs")! If you need
  * a nullable UUID, use tl::optional<librepcb::Uuid> instead.
@@ -71,7 +77,9 @@ public:
    *
    * @param other     Another #Uuid object
    */
-  Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+  Uuid(const Uuid& other) noexcept {
+    std::memcpy(mBytes, other.mBytes, sizeof(mBytes));
+  }
 
   /**
    * @brief Destructor
@@ -85,7 +93,7 @@ public:
    *
    * @return The UUID as a string
    */
-  QString toStr() const noexcept { return mUuid; }
+  QString toStr() const noexcept;
 
   //@{
   /**
@@ -93,20 +101,32 @@ public:
    *
    * @param rhs   The other object to compare
    *
-   * @return Result of comparing the UUIDs as strings
+   * @return Result of comparing the UUIDs as strings (since the characters
+   *         are lowercase hex digits, comparing the raw bytes is equivalent)
    */
   Uuid& operator=(const Uuid& rhs) noexcept {
-    mUuid = rhs.mUuid;
+    std::memcpy(mBytes, rhs.mBytes, sizeof(mBytes));
     return *this;
   }
-  bool operator==(const Uuid& rhs) const noexcept { return mUuid == rhs.mUuid; }
-  bool operator!=(const Uuid& rhs) const noexcept { return mUuid != rhs.mUuid; }
-  bool operator<(const Uuid& rhs) const noexcept { return mUuid < rhs.mUuid; }
-  bool operator>(const Uuid& rhs) const noexcept { return mUuid > rhs.mUuid; }
-  bool operator<=(const Uuid& rhs) const noexcept { return mUuid <= rhs.mUuid; }
-  bool operator>=(const Uuid& rhs) const noexcept { return mUuid >= rhs.mUuid; }
+  bool operator==(const Uuid& rhs) const noexcept { return compare(rhs) == 0; }
+  bool operator!=(const Uuid& rhs) const noexcept { return compare(rhs) != 0; }
+  bool operator<(const Uuid& rhs) const noexcept { return compare(rhs) < 0; }
+  bool operator>(const Uuid& rhs) const noexcept { return compare(rhs) > 0; }
+  bool operator<=(const Uuid& rhs) const noexcept { return compare(rhs) <= 0; }
+  bool operator>=(const Uuid& rhs) const noexcept { return compare(rhs) >= 0; }
   //@}
 
+  /**
+   * @brief Calculate the hash of this UUID
+   *
+   * @param seed      Seed for the hash function
+   *
+   * @return Hash of the raw bytes
+   */
+  uint hash(uint seed) const noexcept {
+    return qHashBits(mBytes, sizeof(mBytes), seed);
+  }
+
   // Static Methods
 
   /**
@@ -150,14 +170,31 @@ public:
 
 private:  // Methods
   /**
-   * @brief Constructor which creates a Uuid object from a string
+   * @brief Constructor which creates a Uuid object from its raw bytes
    *
-   * @param str       The uuid as a string (lowercase and without braces)
+   * @param bytes     The 16 bytes of a valid UUID
+   */
+  explicit Uuid(const quint8* bytes) noexcept {
+    std::memcpy(mBytes, bytes, sizeof(mBytes));
+  }
+
+  int compare(const Uuid& rhs) const noexcept {
+    return std::memcmp(mBytes, rhs.mBytes, sizeof(mBytes));
+  }
+
+  /**
+   * @brief Parse a UUID string into its raw bytes
+   *
+   * @param str       The string to parse
+   * @param bytes     Output buffer of 16 bytes (undefined if invalid)
+   *
+   * @retval true     If str is a valid UUID
+   * @retval false    If str is not a valid UUID
    */
-  explicit Uuid(const QString& str) noexcept : mUuid(str) {}
+  static bool parse(const QString& str, quint8* bytes) noexcept;
 
-private:          // Data
-  QString mUuid;  ///< Guaranteed to always contain a valid UUID
+private:              // Data
+  quint8 mBytes[16];  ///< Guaranteed to always contain a valid UUID
 };
 
 /*******************************************************************************
@@ -206,7 +243,7 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-  return ::qHash(key.toStr(), seed);
+  return key.hash(seed);
 }
 
 /*******************************************************************************
@@ -39,6 +39,7 @@ ConverterDb::ConverterDb(const FilePath& ini) noexcept
 }
 
 ConverterDb::~ConverterDb() noexcept {
+  flush();
 }
 
 /*******************************************************************************
@@ -93,35 +94,62 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName,
   return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+void ConverterDb::flush() noexcept {
+  QMutexLocker lock(&mMutex);
+  if (mNewUuids.isEmpty()) return;
+  for (auto it = mNewUuids.constBegin(); it != mNewUuids.constEnd(); ++it) {
+    mIniFile.setValue(it.key(), it.value().toStr());
+  }
+  mIniFile.sync();
+  mNewUuids.clear();
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
 Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
                                   const QString& key2) {
-  QString allowedChars(
-      "_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-
-  QString settingsKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
-  settingsKey.replace("{", "");
-  settingsKey.replace("}", "");
-  settingsKey.replace(" ", "_");
-  for (int i = 0; i < settingsKey.length(); i++) {
-    if (!allowedChars.contains(settingsKey[i]))
-      settingsKey.replace(
-          i, 1,
-          QString("__U%1__").arg(
-              QString::number(settingsKey[i].unicode(), 16).toUpper()));
-  }
-  settingsKey.prepend(cat % '/');
+  QString settingsKey = cat % '/' %
+      escapeKey(mLibFilePath.getFilename() % '_' % key1 % '_' % key2);
+
+  QMutexLocker lock(&mMutex);
+  auto         it = mUuids.constFind(settingsKey);
+  if (it != mUuids.constEnd()) return it.value();
 
   Uuid    uuid  = Uuid::createRandom();
   QString value = mIniFile.value(settingsKey).toString();
-  if (!value.isEmpty()) uuid = Uuid::fromString(value);  // can throw
-  mIniFile.setValue(settingsKey, uuid.toStr());
+  if (!value.isEmpty()) {
+    uuid = Uuid::fromString(value);  // can throw
+  } else {
+    mNewUuids.insert(settingsKey, uuid);
+  }
+  mUuids.insert(settingsKey, uuid);
   return uuid;
 }
 
+QString ConverterDb::escapeKey(const QString& key) noexcept {
+  // Remove curly braces, replace spaces by underscores and escape all other
+  // characters which are not allowed in INI keys.
+  QString escaped;
+  escaped.reserve(key.length());
+  foreach (const QChar& c, key) {
+    ushort u = c.unicode();
+    if ((u == '{') || (u == '}')) {
+      continue;
+    } else if (u == ' ') {
+      escaped += '_';
+    } else if (((u >= 'a') && (u <= 'z')) || ((u >= 'A') && (u <= 'Z')) ||
+               ((u >= '0') && (u <= '9')) || (u == '_') || (u == '-') ||
+               (u == '.')) {
+      escaped += c;
+    } else {
+      escaped += "__U" % QString::number(u, 16).toUpper() % "__";
+    }
+  }
+  return escaped;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -43,6 +43,10 @@ namespace eagleimport {
 
 /**
  * @brief The ConverterDb class
+ *
+ * All UUIDs are cached in memory, newly created UUIDs are written to the INI
+ * file only by #flush() (or the destructor). The getters are thread-safe, so
+ * multiple elements can be converted in parallel.
  */
 class ConverterDb final {
 public:
@@ -72,15 +76,24 @@ public:
                                 const QString& gateName);
   Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
 
+  /**
+   * @brief Write all newly created UUIDs to the INI file
+   */
+  void flush() noexcept;
+
   // Operator Overloadings
   ConverterDb& operator=(const ConverterDb& rhs) = delete;
 
 private:
-  Uuid getOrCreateUuid(const QString& cat, const QString& key1,
-                       const QString& key2 = QString());
+  Uuid           getOrCreateUuid(const QString& cat, const QString& key1,
+                                 const QString& key2 = QString());
+  static QString escapeKey(const QString& key) noexcept;
 
-  QSettings mIniFile;
-  FilePath  mLibFilePath;
+  QSettings            mIniFile;
+  FilePath             mLibFilePath;
+  QMutex               mMutex;     ///< Protects the members below
+  QHash<QString, Uuid> mUuids;     ///< All UUIDs looked up so far
+  QHash<QString, Uuid> mNewUuids;  ///< Not written to #mIniFile yet
 };
 
 /*******************************************************************************
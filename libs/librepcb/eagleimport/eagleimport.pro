@@ -25,6 +25,7 @@ SOURCES += \
     deviceconverter.cpp \
     devicesetconverter.cpp \
     packageconverter.cpp \
+    polygonsimplifier.cpp \
     symbolconverter.cpp \
 
 HEADERS += \
@@ -32,6 +33,7 @@ HEADERS += \
     deviceconverter.h \
     devicesetconverter.h \
     packageconverter.h \
+    polygonsimplifier.h \
     symbolconverter.h \
 
 FORMS += \
@@ -20,7 +20,6 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-
 #include "polygonsimplifier.h"
 
 #include <librepcb/library/pkg/footprint.h>
@@ -32,18 +31,20 @@
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
+namespace eagleimport {
 
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 template <typename LibElemType>
-PolygonSimplifier<LibElemType>::PolygonSimplifier(LibElemType& libraryElement)
+PolygonSimplifier<LibElemType>::PolygonSimplifier(
+    LibElemType& libraryElement) noexcept
   : mLibraryElement(libraryElement) {
 }
 
 template <typename LibElemType>
-PolygonSimplifier<LibElemType>::~PolygonSimplifier() {
+PolygonSimplifier<LibElemType>::~PolygonSimplifier() noexcept {
 }
 
 /*******************************************************************************
@@ -53,8 +54,22 @@ PolygonSimplifier<LibElemType>::~PolygonSimplifier() {
 template <typename LibElemType>
 void PolygonSimplifier<LibElemType>::convertLineRectsToPolygonRects(
     bool fillArea, bool isGrabArea) noexcept {
-  QList<Polygon*> lines;
-  while (findLineRectangle(lines)) {
+  // index all lines by their end points
+  QList<Polygon*> linePolygons;
+  LineMap         lineMap;
+  for (Polygon& polygon : mLibraryElement.getPolygons()) {
+    if (polygon.getPath().getVertices().count() == 2) {
+      linePolygons.append(&polygon);
+      addLine(lineMap, polygon);
+    }
+  }
+
+  // find rectangles
+  QSet<const Polygon*> removedLines;
+  QList<Polygon*>      lines;
+  foreach (const Polygon* startLine, linePolygons) {
+    if (removedLines.contains(startLine)) continue;
+    if (!findLineRectangle(lineMap, *startLine, lines)) continue;
     QSet<LengthBase_t> xValues, yValues;
     foreach (const Polygon* line, lines) {
       xValues.insert(
@@ -66,8 +81,7 @@ void PolygonSimplifier<LibElemType>::convertLineRectsToPolygonRects(
       yValues.insert(
           line->getPath().getVertices().at(1).getPos().getY().toNm());
     }
-    if (xValues.count() != 2 || yValues.count() != 2) break;
-    // Q_ASSERT(xValues.count() == 2 && yValues.count() == 2);
+    if (xValues.count() != 2 || yValues.count() != 2) continue;
     Point p1(xValues.values().first(), yValues.values().first());
     Point p2(xValues.values().first(), yValues.values().last());
     Point p3(xValues.values().last(), yValues.values().last());
@@ -81,9 +95,19 @@ void PolygonSimplifier<LibElemType>::convertLineRectsToPolygonRects(
         std::make_shared<Polygon>(Uuid::createRandom(), layerName, lineWidth,
                                   fillArea, isGrabArea, rectPath));
 
-    // remove all lines
-    foreach (Polygon* line, lines)
-      mLibraryElement.getPolygons().remove(line);
+    // the lines must not be part of another rectangle
+    foreach (Polygon* line, lines) {
+      removeLine(lineMap, *line);
+      removedLines.insert(line);
+    }
+  }
+
+  // remove all merged lines at once (removing them one by one from the list
+  // would be quadratic)
+  for (int i = mLibraryElement.getPolygons().count() - 1; i >= 0; --i) {
+    if (removedLines.contains(mLibraryElement.getPolygons().at(i).get())) {
+      mLibraryElement.getPolygons().remove(i);
+    }
   }
 }
 
@@ -93,84 +117,65 @@ void PolygonSimplifier<LibElemType>::convertLineRectsToPolygonRects(
 
 template <typename LibElemType>
 bool PolygonSimplifier<LibElemType>::findLineRectangle(
-    QList<Polygon*>& lines) noexcept {
-  // find lines
-  QList<Polygon*> linePolygons;
-  for (Polygon& polygon : mLibraryElement.getPolygons()) {
-    if (polygon.getPath().getVertices().count() == 2)
-      linePolygons.append(&polygon);
-  }
-
-  // find rectangle
-  Polygon*       line;
-  UnsignedLength width(0);
-  for (int i = 0; i < linePolygons.count(); i++) {
-    lines.clear();
-    Point p = linePolygons.at(i)->getPath().getVertices().first().getPos();
-    if (findHLine(linePolygons, p, nullptr, &line)) {
-      lines.append(line);
-      width = line->getLineWidth();
-      if (findVLine(linePolygons, p, &width, &line)) {
-        lines.append(line);
-        if (findHLine(linePolygons, p, &width, &line)) {
-          lines.append(line);
-          if (findVLine(linePolygons, p, &width, &line)) {
-            lines.append(line);
-            return true;
-          }
-        }
-      }
+    const LineMap& map, const Polygon& start, QList<Polygon*>& lines) noexcept {
+  // starting at the first vertex of the start line, alternately follow
+  // horizontal and vertical lines of the same width
+  lines.clear();
+  Point p = start.getPath().getVertices().first().getPos();
+
+  tl::optional<UnsignedLength> width;  // not known before the first line
+  for (int i = 0; i < 4; ++i) {
+    Direction direction =
+        (i % 2 == 0) ? Direction::Horizontal : Direction::Vertical;
+    Polygon* line = findLine(map, p, direction, width, lines);
+    if (!line) {
+      lines.clear();
+      return false;
     }
+    lines.append(line);
+    width = line->getLineWidth();
   }
-
-  lines.clear();
-  return false;
+  return true;
 }
 
 template <typename LibElemType>
-bool PolygonSimplifier<LibElemType>::findHLine(const QList<Polygon*>& lines,
-                                               Point& p, UnsignedLength* width,
-                                               Polygon** line) noexcept {
-  foreach (Polygon* polygon, lines) {
-    if (width) {
-      if (polygon->getLineWidth() != *width) continue;
-    }
-    Point p1 = polygon->getPath().getVertices().at(0).getPos();
-    Point p2 = polygon->getPath().getVertices().at(1).getPos();
-    if ((p1 == p) && (p2.getY() == p.getY())) {
-      *line = polygon;
-      p     = p2;
-      return true;
-    } else if ((p2 == p) && (p1.getY() == p.getY())) {
-      *line = polygon;
-      p     = p1;
-      return true;
+Polygon* PolygonSimplifier<LibElemType>::findLine(
+    const LineMap& map, Point& p, Direction direction,
+    const tl::optional<UnsignedLength>& width,
+    const QList<Polygon*>&              exclude) noexcept {
+  auto it = map.constFind(p);
+  if (it == map.constEnd()) return nullptr;
+  foreach (Polygon* polygon, it.value()) {
+    if (width && (polygon->getLineWidth() != *width)) continue;
+    if (exclude.contains(polygon)) continue;
+    Point p1    = polygon->getPath().getVertices().at(0).getPos();
+    Point p2    = polygon->getPath().getVertices().at(1).getPos();
+    Point other = (p1 == p) ? p2 : p1;
+    if (((direction == Direction::Horizontal) && (other.getY() == p.getY())) ||
+        ((direction == Direction::Vertical) && (other.getX() == p.getX()))) {
+      p = other;
+      return polygon;
     }
   }
-  return false;
+  return nullptr;
 }
 
 template <typename LibElemType>
-bool PolygonSimplifier<LibElemType>::findVLine(const QList<Polygon*>& lines,
-                                               Point& p, UnsignedLength* width,
-                                               Polygon** line) noexcept {
-  foreach (Polygon* polygon, lines) {
-    if (width) {
-      if (polygon->getLineWidth() != *width) continue;
-    }
-    Point p1 = polygon->getPath().getVertices().at(0).getPos();
-    Point p2 = polygon->getPath().getVertices().at(1).getPos();
-    if ((p1 == p) && (p2.getX() == p.getX())) {
-      *line = polygon;
-      p     = p2;
-      return true;
-    } else if ((p2 == p) && (p1.getX() == p.getX())) {
-      *line = polygon;
-      p     = p1;
-      return true;
-    }
+void PolygonSimplifier<LibElemType>::addLine(LineMap& map,
+                                             Polygon& line) noexcept {
+  Point p1 = line.getPath().getVertices().at(0).getPos();
+  Point p2 = line.getPath().getVertices().at(1).getPos();
+  map[p1].append(&line);
+  if (p2 != p1) map[p2].append(&line);
+}
+
+template <typename LibElemType>
+void PolygonSimplifier<LibElemType>::removeLine(LineMap& map,
+                                                Polygon& line) noexcept {
+  for (const Vertex& vertex : line.getPath().getVertices()) {
+    auto it = map.find(vertex.getPos());
+    if (it != map.end()) it.value().removeOne(&line);
   }
-  return false;
 }
 
 /*******************************************************************************
@@ -184,4 +189,5 @@ template class PolygonSimplifier<library::Footprint>;
  *  End of File
  ******************************************************************************/
 
+}  // namespace eagleimport
 }  // namespace librepcb
@@ -0,0 +1,87 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
+#define LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/geometry/polygon.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+
+/*******************************************************************************
+ *  Class PolygonSimplifier
+ ******************************************************************************/
+
+/**
+ * @brief Merges lines of a library element to rectangle polygons
+ *
+ * Eagle libraries often contain rectangles drawn as four separate lines. These
+ * are replaced by a single polygon. All lines are indexed by their end points
+ * first, so finding adjacent lines is a hash lookup and the whole conversion
+ * is linear in the number of lines.
+ */
+template <typename LibElemType>
+class PolygonSimplifier final {
+public:
+  // Constructors / Destructor
+  PolygonSimplifier()                               = delete;
+  PolygonSimplifier(const PolygonSimplifier& other) = delete;
+  explicit PolygonSimplifier(LibElemType& libraryElement) noexcept;
+  ~PolygonSimplifier() noexcept;
+
+  // General Methods
+  void convertLineRectsToPolygonRects(bool fillArea, bool isGrabArea) noexcept;
+
+  // Operator Overloadings
+  PolygonSimplifier& operator=(const PolygonSimplifier& rhs) = delete;
+
+private:  // Types
+  typedef QHash<Point, QList<Polygon*>> LineMap;  ///< Lines by end points
+  enum class Direction { Horizontal, Vertical };
+
+private:  // Methods
+  static bool     findLineRectangle(const LineMap& map, const Polygon& start,
+                                    QList<Polygon*>& lines) noexcept;
+  static Polygon* findLine(const LineMap& map, Point& p, Direction direction,
+                           const tl::optional<UnsignedLength>& width,
+                           const QList<Polygon*>& exclude) noexcept;
+  static void     addLine(LineMap& map, Polygon& line) noexcept;
+  static void     removeLine(LineMap& map, Polygon& line) noexcept;
+
+private:  // Data
+  LibElemType& mLibraryElement;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace eagleimport
+}  // namespace librepcb
+
+#endif  // LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
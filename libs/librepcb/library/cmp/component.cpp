@@ -132,6 +132,22 @@ LibraryElementCheckMessageList Component::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Component::getMemoryUsage() const noexcept {
+  qint64 usage = LibraryElement::getMemoryUsage() + sizeof(Component) -
+                 sizeof(LibraryElement) +
+                 (mAttributes.count() * sizeof(Attribute)) +
+                 (mSignals.count() * sizeof(ComponentSignal));
+  for (const ComponentSymbolVariant& variant : mSymbolVariants) {
+    usage += sizeof(ComponentSymbolVariant);
+    for (const ComponentSymbolVariantItem& item : variant.getSymbolItems()) {
+      usage += sizeof(ComponentSymbolVariantItem) +
+               (item.getPinSignalMap().count() *
+                sizeof(ComponentPinSignalMapItem));
+    }
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -147,7 +163,8 @@ void Component::serialize(SExpression& root) const {
 }
 
 QString Component::cleanNorm(QString norm) noexcept {
-  return QString(norm.toUpper().remove(QRegularExpression("[^0-9A-Z]")));
+  static const QRegularExpression invalidChars("[^0-9A-Z]");
+  return QString(norm.toUpper().remove(invalidChars));
 }
 
 /*******************************************************************************
@@ -132,6 +132,7 @@ public:
 
   // General Methods
   virtual LibraryElementCheckMessageList runChecks() const override;
+  virtual qint64 getMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Component& operator=(const Component& rhs) = delete;
@@ -48,6 +48,7 @@ ComponentPinSignalMapModel::ComponentPinSignalMapModel(QObject* parent) noexcept
     mSignals(nullptr),
     mSymbolsCache(nullptr),
     mUndoStack(nullptr),
+    mRowCount(0),
     mOnItemsEditedSlot(*this, &ComponentPinSignalMapModel::symbolItemsEdited),
     mOnSignalsEditedSlot(*this, &ComponentPinSignalMapModel::signalListEdited) {
   foreach (const CmpSigPinDisplayType& type,
@@ -73,6 +74,7 @@ void ComponentPinSignalMapModel::setSymbolVariant(
   if (mSymbolVariant) {
     mSymbolVariant->getSymbolItems().onEdited.attach(mOnItemsEditedSlot);
   }
+  mRowCount = rowCount();
 
   emit endResetModel();
 }
@@ -331,14 +333,35 @@ void ComponentPinSignalMapModel::symbolItemsEdited(
     const std::shared_ptr<const ComponentSymbolVariantItem>& item,
     ComponentSymbolVariantItemList::Event                    event) noexcept {
   Q_UNUSED(list);
-  Q_UNUSED(index);
-  Q_UNUSED(item);
+  // Each symbol item occupies the rows of its pins, so only the rows of the
+  // modified item are inserted, removed or updated.
+  int firstRow  = getFirstRowOfSymbolItem(index);
+  int itemCount = item->getPinSignalMap().count();
   switch (event) {
     case ComponentSymbolVariantItemList::Event::ElementAdded:
+      if (itemCount > 0) {
+        beginInsertRows(QModelIndex(), firstRow, firstRow + itemCount - 1);
+        mRowCount += itemCount;
+        endInsertRows();
+      }
+      break;
     case ComponentSymbolVariantItemList::Event::ElementRemoved:
+      if (itemCount > 0) {
+        beginRemoveRows(QModelIndex(), firstRow, firstRow + itemCount - 1);
+        mRowCount -= itemCount;
+        endRemoveRows();
+      }
+      break;
     case ComponentSymbolVariantItemList::Event::ElementEdited:
-      emit beginResetModel();
-      emit endResetModel();
+      if (rowCount() != mRowCount) {
+        // pins were added or removed, thus row indices are not valid anymore
+        emit beginResetModel();
+        mRowCount = rowCount();
+        emit endResetModel();
+      } else if (itemCount > 0) {
+        dataChanged(this->index(firstRow, 0),
+                    this->index(firstRow + itemCount - 1, _COLUMN_COUNT - 1));
+      }
       break;
     default:
       qWarning() << "Unhandled switch-case in "
@@ -399,6 +422,15 @@ void ComponentPinSignalMapModel::updateSignalComboBoxItems() noexcept {
       0, qMakePair(QString("(%1)").arg(tr("unconnected")), QVariant()));
 }
 
+int ComponentPinSignalMapModel::getFirstRowOfSymbolItem(
+    int symbolItemIndex) const noexcept {
+  int row = 0;
+  for (int i = 0; i < symbolItemIndex; ++i) {
+    row += mSymbolVariant->getSymbolItems().at(i)->getPinSignalMap().count();
+  }
+  return row;
+}
+
 void ComponentPinSignalMapModel::getRowItem(
     int row, int& symbolItemIndex,
     std::shared_ptr<ComponentSymbolVariantItem>& symbolItem,
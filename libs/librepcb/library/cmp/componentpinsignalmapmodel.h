@@ -99,6 +99,7 @@ private:
                         ComponentSignalList::Event event) noexcept;
   void execCmd(UndoCommand* cmd);
   void updateSignalComboBoxItems() noexcept;
+  int  getFirstRowOfSymbolItem(int symbolItemIndex) const noexcept;
   void getRowItem(int row, int& symbolItemIndex,
                   std::shared_ptr<ComponentSymbolVariantItem>& symbolItem,
                   std::shared_ptr<ComponentPinSignalMapItem>&  mapItem) const
@@ -111,6 +112,7 @@ private:  // Data
   UndoStack*                                 mUndoStack;
   QVector<QPair<QString, QVariant>>          mSignalComboBoxItems;
   QVector<QPair<QString, QVariant>>          mDisplayTypeComboBoxItems;
+  int mRowCount;  ///< Cached to detect modified pin counts of symbol items
 
   // Slots
   ComponentSymbolVariantItemList::OnEditedSlot mOnItemsEditedSlot;
@@ -55,8 +55,8 @@ struct ComponentPrefixVerifier {
 
 struct ComponentPrefixConstraint {
   bool operator()(const QString& value) const noexcept {
-    return QRegularExpression("^[a-zA-Z_]{0,16}$")
-        .match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
+    static const QRegularExpression re("^[a-zA-Z_]{0,16}$");
+    return re.match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
         .hasMatch();
   }
 };
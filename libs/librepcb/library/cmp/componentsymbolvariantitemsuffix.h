@@ -55,8 +55,8 @@ struct ComponentSymbolVariantItemSuffixVerifier {
 
 struct ComponentSymbolVariantItemSuffixConstraint {
   bool operator()(const QString& value) const noexcept {
-    return QRegularExpression("^[0-9a-zA-Z_]{0,16}$")
-        .match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
+    static const QRegularExpression re("^[0-9a-zA-Z_]{0,16}$");
+    return re.match(value, 0, QRegularExpression::PartialPreferCompleteMatch)
         .hasMatch();
   }
 };
@@ -77,6 +77,16 @@ void Device::setPackageUuid(const Uuid& uuid) noexcept {
   emit packageUuidChanged(mPackageUuid);
 }
 
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+qint64 Device::getMemoryUsage() const noexcept {
+  return LibraryElement::getMemoryUsage() + sizeof(Device) -
+         sizeof(LibraryElement) + (mAttributes.count() * sizeof(Attribute)) +
+         (mPadSignalMap.count() * sizeof(DevicePadSignalMapItem));
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -78,6 +78,9 @@ public:
   void setComponentUuid(const Uuid& uuid) noexcept;
   void setPackageUuid(const Uuid& uuid) noexcept;
 
+  // General Methods
+  virtual qint64 getMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   Device& operator=(const Device& rhs) = delete;
 
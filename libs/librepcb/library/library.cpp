@@ -58,7 +58,8 @@ Library::Library(const Uuid& uuid, const Version& version,
 Library::Library(std::unique_ptr<TransactionalDirectory> directory)
   : LibraryBaseElement(std::move(directory), false, "lib", "library") {
   // check directory suffix
-  if (mDirectory->getAbsPath().getSuffix() != "lplib") {
+  QString suffix = mDirectory->getAbsPath().getSuffix();
+  if ((suffix != "lplib") && (suffix != getPackedLibrarySuffix())) {
     throw RuntimeError(__FILE__, __LINE__,
                        QString(tr("The library directory does not have the "
                                   "suffix '.lplib':\n\n%1"))
@@ -72,9 +73,9 @@ Library::Library(std::unique_ptr<TransactionalDirectory> directory)
               QUrl::StrictMode);
 
   // read dependency UUIDs
-  foreach (const SExpression& node,
+  foreach (const SExpression* node,
            mLoadingFileDocument.getChildren("dependency")) {
-    mDependencies.insert(node.getValueOfFirstChild<Uuid>());
+    mDependencies.insert(node->getValueOfFirstChild<Uuid>());
   }
 
   // load image if available
@@ -167,6 +168,42 @@ template QStringList Library::searchForElements<Package>() const noexcept;
 template QStringList Library::searchForElements<Component>() const noexcept;
 template QStringList Library::searchForElements<Device>() const noexcept;
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+FilePath Library::getPackedLibraryFilePath(const FilePath& fp) noexcept {
+  // Note: FilePath always uses '/' as separator.
+  QString pattern = "." % getPackedLibrarySuffix() % "/";
+  QString path    = fp.toStr() % "/";
+  int     index   = path.indexOf(pattern);
+  if ((!fp.isValid()) || (index < 0)) {
+    return FilePath();
+  }
+  return FilePath(path.left(index + pattern.length() - 1));
+}
+
+std::shared_ptr<TransactionalFileSystem> Library::openPackedLibrary(
+    const FilePath& fp) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(fp.getParentDir());  // can throw
+  fs->loadFromZip(fp, fp.getFilename());                   // can throw
+  return fs;
+}
+
+std::unique_ptr<TransactionalDirectory> Library::openElementDirectory(
+    const FilePath& fp) {
+  FilePath packedFp = getPackedLibraryFilePath(fp);
+  if (packedFp.isValid()) {
+    return std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+        openPackedLibrary(packedFp),
+        fp.toRelative(packedFp.getParentDir())));  // can throw
+  } else {
+    return std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+        TransactionalFileSystem::openRO(fp)));  // can throw
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
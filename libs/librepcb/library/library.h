@@ -88,6 +88,59 @@ public:
     return QStringLiteral("library");
   }
 
+  /**
+   * @brief Get the file suffix of packed libraries
+   *
+   * A packed library is a ZIP file containing the same files as a library
+   * directory. It is read-only, but much faster to load from slow (e.g.
+   * network) drives than thousands of small files since its directory table
+   * is read only once and every file is then accessed with a single seek.
+   */
+  static QString getPackedLibrarySuffix() noexcept {
+    return QStringLiteral("lplibz");
+  }
+
+  /**
+   * @brief Get the packed library a path is located in
+   *
+   * @param fp  Path to a packed library or to a file or directory within it
+   *
+   * @return Path to the packed library file, or an invalid FilePath if the
+   *         passed path does not point into a packed library
+   */
+  static FilePath getPackedLibraryFilePath(const FilePath& fp) noexcept;
+
+  /**
+   * @brief Open a packed library as a read-only file system
+   *
+   * The files of the archive are loaded into a directory with the same name
+   * as the archive, i.e. the returned file system has its root in the parent
+   * directory of the archive.
+   *
+   * @param fp  Path to the packed library file
+   *
+   * @return The opened file system
+   *
+   * @throw Exception   If the archive could not be opened.
+   */
+  static std::shared_ptr<TransactionalFileSystem> openPackedLibrary(
+      const FilePath& fp);
+
+  /**
+   * @brief Open the directory of a library or library element read-only
+   *
+   * Works for library directories as well as for packed libraries (see
+   * #getPackedLibrarySuffix()) and the elements within them.
+   *
+   * @param fp  Path to the library or library element
+   *
+   * @return The opened directory
+   *
+   * @throw Exception   If the directory could not be opened.
+   */
+  static std::unique_ptr<TransactionalDirectory> openElementDirectory(
+      const FilePath& fp);
+
 private:  // Methods
   /// @copydoc librepcb::SerializableObject::serialize()
   virtual void serialize(SExpression& root) const override;
@@ -10,7 +10,7 @@ TARGET = librepcblibrary
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -59,6 +59,9 @@ SOURCES += \
     libraryelement.cpp \
     libraryelementcache.cpp \
     libraryelementcheck.cpp \
+    libraryelementcheckcache.cpp \
+    libraryelementmetadata.cpp \
+    libraryelementthumbnailrenderer.cpp \
     msg/libraryelementcheckmessage.cpp \
     msg/msgmissingauthor.cpp \
     msg/msgmissingcategories.cpp \
@@ -83,6 +86,7 @@ SOURCES += \
     pkg/packagecheck.cpp \
     pkg/packagepad.cpp \
     pkg/packagepadlistmodel.cpp \
+    pkg/padarraygenerator.cpp \
     sym/cmd/cmdsymbolpinedit.cpp \
     sym/msg/msgduplicatepinname.cpp \
     sym/msg/msgmissingsymbolname.cpp \
@@ -141,6 +145,9 @@ HEADERS += \
     libraryelement.h \
     libraryelementcache.h \
     libraryelementcheck.h \
+    libraryelementcheckcache.h \
+    libraryelementmetadata.h \
+    libraryelementthumbnailrenderer.h \
     msg/libraryelementcheckmessage.h \
     msg/msgmissingauthor.h \
     msg/msgmissingcategories.h \
@@ -165,6 +172,7 @@ HEADERS += \
     pkg/packagecheck.h \
     pkg/packagepad.h \
     pkg/packagepadlistmodel.h \
+    pkg/padarraygenerator.h \
     sym/cmd/cmdsymbolpinedit.h \
     sym/msg/msgduplicatepinname.h \
     sym/msg/msgmissingsymbolname.h \
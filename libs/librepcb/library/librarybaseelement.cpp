@@ -25,8 +25,10 @@
 #include "librarybaseelementcheck.h"
 
 #include <librepcb/common/application.h>
+#include <librepcb/common/fileio/mappedfile.h>
 #include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/fileio/versionfile.h>
+#include <librepcb/common/toolbox.h>
 
 #include <QtCore>
 
@@ -109,10 +111,17 @@ LibraryBaseElement::LibraryBaseElement(
   }
 
   // open main file
-  QString  sexprFileName = mLongElementName % ".lp";
-  FilePath sexprFilePath = mDirectory->getAbsPath(sexprFileName);
-  mLoadingFileDocument =
-      SExpression::parse(mDirectory->read(sexprFileName), sexprFilePath);
+  QString sexprFileName = mLongElementName % ".lp";
+  if (std::shared_ptr<const SExpressionCache> cache = getParseCache()) {
+    mLoadingFileDocument =
+        cache->parse(*mDirectory, sexprFileName);  // can throw
+  } else {
+    std::unique_ptr<const MappedFile> sexprFile =
+        mDirectory->map(sexprFileName);  // can throw
+    mLoadingFileDocument =
+        SExpression::parse(sexprFile->getContent(),
+                           mDirectory->getAbsPath(sexprFileName));  // can throw
+  }
 
   // read attributes
   mUuid         = mLoadingFileDocument.getChildByIndex(0).getValue<Uuid>();
@@ -154,6 +163,10 @@ QStringList LibraryBaseElement::getAllAvailableLocales() const noexcept {
   return list;
 }
 
+qint64 LibraryBaseElement::getMemoryUsage() const noexcept {
+  return sizeof(LibraryBaseElement) + (mAuthor.capacity() * sizeof(QChar));
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -194,6 +207,40 @@ void LibraryBaseElement::moveIntoParentDirectory(TransactionalDirectory& dest) {
   moveTo(dir);  // can throw
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+// Note: Function-local statics are used to make sure they are initialized
+// before they are used, independent of the static initialization order.
+static QMutex& parseCacheMutex() noexcept {
+  static QMutex mutex;
+  return mutex;
+}
+
+static std::shared_ptr<const SExpressionCache>& parseCache() noexcept {
+  static std::shared_ptr<const SExpressionCache> cache;
+  return cache;
+}
+
+void LibraryBaseElement::setParseCache(
+    const std::shared_ptr<const SExpressionCache>& cache) noexcept {
+  QMutexLocker lock(&parseCacheMutex());
+  parseCache() = cache;
+}
+
+QByteArray LibraryBaseElement::calcContentHash(
+    const TransactionalDirectory& dir) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  foreach (const QString& filename, Toolbox::sorted(dir.getFiles())) {
+    std::unique_ptr<const MappedFile> file = dir.map(filename);  // can throw
+    hash.addData(filename.toUtf8());
+    hash.addData(QByteArray::number(file->getContent().size()));
+    hash.addData(file->getContent());
+  }
+  return hash.result();
+}
+
 /*******************************************************************************
  *  Protected Methods
  ******************************************************************************/
@@ -202,6 +249,12 @@ void LibraryBaseElement::cleanupAfterLoadingElementFromFile() noexcept {
   mLoadingFileDocument = SExpression();  // destroy the whole DOM tree
 }
 
+std::shared_ptr<const SExpressionCache>
+    LibraryBaseElement::getParseCache() noexcept {
+  QMutexLocker lock(&parseCacheMutex());
+  return parseCache();
+}
+
 void LibraryBaseElement::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   mNames.serialize(root);
@@ -28,6 +28,7 @@
 #include <librepcb/common/fileio/serializablekeyvaluemap.h>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/sexpressioncache.h>
 #include <librepcb/common/fileio/transactionaldirectory.h>
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/version.h>
@@ -92,6 +93,15 @@ public:
   const LocalizedKeywordsMap& getKeywords() const noexcept { return mKeywords; }
   QStringList                 getAllAvailableLocales() const noexcept;
 
+  /**
+   * @brief Get the (estimated) memory usage of this element
+   *
+   * Derived classes holding a lot of data should override this method.
+   *
+   * @return Memory usage in bytes
+   */
+  virtual qint64 getMemoryUsage() const noexcept;
+
   // Setters
   void setVersion(const Version& version) noexcept { mVersion = version; }
   void setAuthor(const QString& author) noexcept { mAuthor = author; }
@@ -128,9 +138,38 @@ public:
                           ElementType::getShortElementName());
   }
 
+  /**
+   * @brief Set the cache to be used for parsing element files
+   *
+   * If set, the parsed S-Expression files of all subsequently loaded elements
+   * are cached in binary form, which avoids parsing unmodified files again.
+   *
+   * @param cache   The cache to use (nullptr to disable caching)
+   *
+   * @note This method is thread-safe.
+   */
+  static void setParseCache(
+      const std::shared_ptr<const SExpressionCache>& cache) noexcept;
+
+  /**
+   * @brief Calculate a hash over all files of a library element
+   *
+   * This allows to detect whether two library elements (e.g. in the
+   * workspace library and in a project library) have exactly the same
+   * content, without loading them.
+   *
+   * @param dir   The directory of the library element
+   *
+   * @return SHA-256 hash over the names and contents of all files
+   *
+   * @throw Exception if a file could not be read
+   */
+  static QByteArray calcContentHash(const TransactionalDirectory& dir);
+
 protected:
   // Protected Methods
   virtual void cleanupAfterLoadingElementFromFile() noexcept;
+  static std::shared_ptr<const SExpressionCache> getParseCache() noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   virtual void serialize(SExpression& root) const override;
@@ -55,9 +55,9 @@ LibraryElement::LibraryElement(
   : LibraryBaseElement(std::move(directory), true, shortElementName,
                        longElementName) {
   // read category UUIDs
-  foreach (const SExpression& node,
+  foreach (const SExpression* node,
            mLoadingFileDocument.getChildren("category")) {
-    mCategories.insert(node.getValueOfFirstChild<Uuid>());
+    mCategories.insert(node->getValueOfFirstChild<Uuid>());
   }
 }
 
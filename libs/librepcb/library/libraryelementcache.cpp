@@ -25,10 +25,13 @@
 #include "elements.h"
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 
 #include <QtCore>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -40,17 +43,70 @@ namespace library {
  ******************************************************************************/
 
 LibraryElementCache::LibraryElementCache(
-    const workspace::WorkspaceLibraryDb& db) noexcept
-  : mDb(&db) {
+    const workspace::WorkspaceLibraryDb& db, int maxEntries) noexcept
+  : mDb(&db),
+    mThread(QThread::currentThread()),
+    mMaxEntries(maxEntries),
+    mAccessCounter(0),
+    mHitCount(0),
+    mMissCount(0) {
 }
 
 LibraryElementCache::~LibraryElementCache() noexcept {
+  waitForPrefetching();
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryElementCache::setMaxEntries(int maxEntries) noexcept {
+  QMutexLocker lock(&mMutex);
+  mMaxEntries = maxEntries;
+  evict();
 }
 
 /*******************************************************************************
  *  Getters
  ******************************************************************************/
 
+int LibraryElementCache::getMaxEntries() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mMaxEntries;
+}
+
+int LibraryElementCache::getEntryCount() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return countEntries();
+}
+
+quint64 LibraryElementCache::getHitCount() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mHitCount;
+}
+
+quint64 LibraryElementCache::getMissCount() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mMissCount;
+}
+
+template <typename T>
+static qint64 entriesMemoryUsage(const QHash<Uuid, T>& container) noexcept {
+  qint64 usage = 0;
+  foreach (const T& entry, container) {
+    usage += sizeof(T) + entry.element->getMemoryUsage();
+  }
+  return usage;
+}
+
+qint64 LibraryElementCache::getMemoryUsage() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return sizeof(LibraryElementCache) + entriesMemoryUsage(mCmpCat) +
+      entriesMemoryUsage(mPkgCat) + entriesMemoryUsage(mSym) +
+      entriesMemoryUsage(mPkg) + entriesMemoryUsage(mCmp) +
+      entriesMemoryUsage(mDev);
+}
+
 std::shared_ptr<const ComponentCategory>
 LibraryElementCache::getComponentCategory(const Uuid& uuid) const noexcept {
   return getElement(&workspace::WorkspaceLibraryDb::getLatestComponentCategory,
@@ -87,29 +143,234 @@ std::shared_ptr<const Device> LibraryElementCache::getDevice(
                     uuid);
 }
 
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void LibraryElementCache::prefetchSymbols(const QList<Uuid>& uuids) const
+    noexcept {
+  prefetch(&workspace::WorkspaceLibraryDb::getLatestSymbol, mSym, uuids);
+}
+
+void LibraryElementCache::prefetchPackages(const QList<Uuid>& uuids) const
+    noexcept {
+  prefetch(&workspace::WorkspaceLibraryDb::getLatestPackage, mPkg, uuids);
+}
+
+void LibraryElementCache::prefetchComponents(const QList<Uuid>& uuids) const
+    noexcept {
+  prefetch(&workspace::WorkspaceLibraryDb::getLatestComponent, mCmp, uuids);
+}
+
+void LibraryElementCache::prefetchDevices(const QList<Uuid>& uuids) const
+    noexcept {
+  prefetch(&workspace::WorkspaceLibraryDb::getLatestDevice, mDev, uuids);
+}
+
+void LibraryElementCache::waitForPrefetching() const noexcept {
+  QList<QFuture<void>> futures;
+  {
+    QMutexLocker lock(&mMutex);
+    futures = mPendingLoads.values();
+  }
+  foreach (QFuture<void> future, futures) {
+    future.waitForFinished();
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
 template <typename T>
 std::shared_ptr<const T> LibraryElementCache::getElement(
-    FilePath (workspace::WorkspaceLibraryDb::*getter)(const Uuid&) const,
-    QHash<Uuid, std::shared_ptr<const T>>& container, const Uuid& uuid) const
+    Getter getter, QHash<Uuid, Entry<T>>& container, const Uuid& uuid) const
     noexcept {
-  std::shared_ptr<const T> element = container.value(uuid);
-  if ((!element) && mDb) {
-    try {
-      FilePath fp = (mDb->*getter)(uuid);
-      element     = std::make_shared<T>(std::unique_ptr<TransactionalDirectory>(
-          new TransactionalDirectory(TransactionalFileSystem::openRO(fp))));
-      container.insert(uuid, element);
-    } catch (const Exception& e) {
-      qWarning() << "Could not open library element:" << e.getMsg();
+  QMutexLocker lock(&mMutex);
+  auto         it = container.find(uuid);
+  if (it != container.end()) {
+    ++mHitCount;
+    it->lastAccess = ++mAccessCounter;
+    return it->element;
+  }
+
+  // If the element is currently prefetched, wait for it instead of loading
+  // it a second time.
+  auto pendingIt = mPendingLoads.find(uuid);
+  if (pendingIt != mPendingLoads.end()) {
+    QFuture<void> future = *pendingIt;
+    lock.unlock();
+    future.waitForFinished();
+    lock.relock();
+    ++mHitCount;
+    it = container.find(uuid);
+    if (it != container.end()) {
+      it->lastAccess = ++mAccessCounter;
+      return it->element;
+    } else {
+      return nullptr;  // loading failed
     }
   }
+
+  // Load the element without holding the lock to allow loading other
+  // elements in parallel.
+  ++mMissCount;
+  lock.unlock();
+  std::shared_ptr<const T> element = loadElement<T>(getter, uuid);
+  lock.relock();
+  return insertElement(container, uuid, element);
+}
+
+template <typename T>
+void LibraryElementCache::prefetch(Getter getter,
+                                   QHash<Uuid, Entry<T>>& container,
+                                   const QList<Uuid>& uuids) const noexcept {
+  QMutexLocker lock(&mMutex);
+  foreach (const Uuid& uuid, uuids) {
+    if (container.contains(uuid) || mPendingLoads.contains(uuid)) {
+      continue;
+    }
+    // Note: The job gets removed from mPendingLoads by itself, which can't
+    // happen before it was added since we are holding the lock here.
+    mPendingLoads.insert(
+        uuid,
+        TaskScheduler::run(TaskScheduler::Priority::Background,
+                           [this, getter, &container, uuid]() {
+                             std::shared_ptr<const T> element =
+                                 loadElement<T>(getter, uuid);
+                             QMutexLocker             lock(&mMutex);
+                             insertElement(container, uuid, element);
+                             mPendingLoads.remove(uuid);
+                           }));
+  }
+}
+
+template <typename T>
+std::shared_ptr<const T> LibraryElementCache::loadElement(
+    Getter getter, const Uuid& uuid) const noexcept {
+  if (!mDb) {
+    return nullptr;
+  }
+  try {
+    FilePath fp = (mDb->*getter)(uuid);  // can throw
+    std::shared_ptr<T> element =
+        std::make_shared<T>(openElementDirectory(fp));  // can throw
+    element->moveToThread(mThread);
+    return element;
+  } catch (const Exception& e) {
+    qWarning() << "Could not open library element:" << e.getMsg();
+    return nullptr;
+  }
+}
+
+template <typename T>
+std::shared_ptr<const T> LibraryElementCache::insertElement(
+    QHash<Uuid, Entry<T>>& container, const Uuid& uuid,
+    const std::shared_ptr<const T>& element) const noexcept {
+  // Another thread might have loaded the same element in the meantime. Then
+  // keep the existing one, so all users get the same object.
+  auto it = container.find(uuid);
+  if (it != container.end()) {
+    it->lastAccess = ++mAccessCounter;
+    return it->element;
+  }
+  if (element) {
+    container.insert(uuid, Entry<T>{element, ++mAccessCounter});
+    evict();
+  }
   return element;
 }
 
+std::unique_ptr<TransactionalDirectory>
+    LibraryElementCache::openElementDirectory(const FilePath& fp) const {
+  FilePath packedFp = Library::getPackedLibraryFilePath(fp);
+  if (!packedFp.isValid()) {
+    return Library::openElementDirectory(fp);  // can throw
+  }
+
+  // Keep packed libraries open to read the directory table of the archive
+  // only once, not for every loaded element. If the archive was replaced in
+  // the meantime, it needs to be opened again.
+  qint64 modified =
+      QFileInfo(packedFp.toStr()).lastModified().toMSecsSinceEpoch();
+  std::shared_ptr<TransactionalFileSystem> fs;
+  {
+    QMutexLocker lock(&mMutex);
+    auto it = mPackedLibraries.constFind(packedFp);
+    if ((it != mPackedLibraries.constEnd()) && (it->modified == modified)) {
+      fs = it->fs;
+    }
+  }
+  if (!fs) {
+    fs = Library::openPackedLibrary(packedFp);  // can throw
+    QMutexLocker lock(&mMutex);
+    mPackedLibraries.insert(packedFp, PackedLibrary{fs, modified});
+  }
+  return std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+      fs, fp.toRelative(packedFp.getParentDir())));
+}
+
+int LibraryElementCache::countEntries() const noexcept {
+  return mCmpCat.count() + mPkgCat.count() + mSym.count() + mPkg.count() +
+      mCmp.count() + mDev.count();
+}
+
+template <typename T>
+static void collectUnusedEntries(const QHash<Uuid, T>& container,
+                                 QVector<quint64>&     lastAccesses) noexcept {
+  foreach (const T& entry, container) {
+    if (entry.element.use_count() == 1) {
+      lastAccesses.append(entry.lastAccess);
+    }
+  }
+}
+
+template <typename T>
+static void removeUnusedEntries(QHash<Uuid, T>& container,
+                                quint64         lastAccess) noexcept {
+  for (auto it = container.begin(); it != container.end();) {
+    if ((it->element.use_count() == 1) && (it->lastAccess <= lastAccess)) {
+      it = container.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void LibraryElementCache::evict() const noexcept {
+  int count = countEntries();
+  if ((mMaxEntries < 0) || (count <= mMaxEntries)) {
+    return;
+  }
+
+  // Elements which are still used somewhere else (i.e. the cache does not
+  // hold the only reference) must be kept, otherwise the same element could
+  // be loaded a second time.
+  QVector<quint64> lastAccesses;
+  collectUnusedEntries(mCmpCat, lastAccesses);
+  collectUnusedEntries(mPkgCat, lastAccesses);
+  collectUnusedEntries(mSym, lastAccesses);
+  collectUnusedEntries(mPkg, lastAccesses);
+  collectUnusedEntries(mCmp, lastAccesses);
+  collectUnusedEntries(mDev, lastAccesses);
+  int removeCount = qMin(count - mMaxEntries, lastAccesses.count());
+  if (removeCount <= 0) {
+    return;
+  }
+
+  // Access times are unique, so this removes exactly the oldest entries.
+  std::nth_element(lastAccesses.begin(),
+                   lastAccesses.begin() + (removeCount - 1),
+                   lastAccesses.end());
+  quint64 lastAccess = lastAccesses.at(removeCount - 1);
+  removeUnusedEntries(mCmpCat, lastAccess);
+  removeUnusedEntries(mPkgCat, lastAccess);
+  removeUnusedEntries(mSym, lastAccess);
+  removeUnusedEntries(mPkg, lastAccess);
+  removeUnusedEntries(mCmp, lastAccess);
+  removeUnusedEntries(mDev, lastAccess);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -35,12 +35,16 @@
  ******************************************************************************/
 namespace librepcb {
 
+class TransactionalDirectory;
+class TransactionalFileSystem;
+
 namespace workspace {
 class WorkspaceLibraryDb;
 }
 
 namespace library {
 
+class LibraryBaseElement;
 class ComponentCategory;
 class PackageCategory;
 class Symbol;
@@ -54,6 +58,15 @@ class Device;
 
 /**
  * @brief Cache for fast access to library elements
+ *
+ * Optionally the number of cached elements can be limited. If the limit is
+ * exceeded, the least recently used elements are removed from the cache.
+ * Elements which are still referenced outside of the cache are never
+ * removed, so the limit may temporarily be exceeded if all cached elements
+ * are in use.
+ *
+ * @note This class is thread-safe. Loaded elements are moved to the thread
+ *       which created the cache, even if they were loaded by another thread.
  */
 class LibraryElementCache final {
   Q_DECLARE_TR_FUNCTIONS(LibraryElementCache)
@@ -62,11 +75,32 @@ public:
   // Constructors / Destructor
   LibraryElementCache()                                 = delete;
   LibraryElementCache(const LibraryElementCache& other) = delete;
-  explicit LibraryElementCache(
-      const workspace::WorkspaceLibraryDb& db) noexcept;
+  explicit LibraryElementCache(const workspace::WorkspaceLibraryDb& db,
+                               int maxEntries = -1) noexcept;
   ~LibraryElementCache() noexcept;
 
+  // Setters
+
+  /**
+   * @brief Set the maximum number of cached elements
+   *
+   * @param maxEntries  Maximum count of elements, or -1 for unlimited
+   */
+  void setMaxEntries(int maxEntries) noexcept;
+
   // Getters
+  int     getMaxEntries() const noexcept;
+  int     getEntryCount() const noexcept;
+  quint64 getHitCount() const noexcept;
+  quint64 getMissCount() const noexcept;
+
+  /**
+   * @brief Get the (estimated) memory usage of all cached elements
+   *
+   * @return Memory usage in bytes
+   */
+  qint64 getMemoryUsage() const noexcept;
+
   std::shared_ptr<const ComponentCategory> getComponentCategory(
       const Uuid& uuid) const noexcept;
   std::shared_ptr<const PackageCategory> getPackageCategory(
@@ -77,24 +111,88 @@ public:
       noexcept;
   std::shared_ptr<const Device> getDevice(const Uuid& uuid) const noexcept;
 
+  // General Methods
+
+  /**
+   * @brief Start loading elements in the background
+   *
+   * The elements are loaded on the global thread pool, so later calls to
+   * the getters don't need to load them anymore. If a getter is called for
+   * an element which is currently being loaded, it waits until loading has
+   * finished. Elements which are already cached are skipped.
+   *
+   * @param uuids   UUIDs of the elements to load
+   */
+  void prefetchSymbols(const QList<Uuid>& uuids) const noexcept;
+  void prefetchPackages(const QList<Uuid>& uuids) const noexcept;
+  void prefetchComponents(const QList<Uuid>& uuids) const noexcept;
+  void prefetchDevices(const QList<Uuid>& uuids) const noexcept;
+
+  /**
+   * @brief Wait until all elements started by the prefetch methods are loaded
+   */
+  void waitForPrefetching() const noexcept;
+
   // Operator Overloadings
   LibraryElementCache& operator=(const LibraryElementCache& rhs) = delete;
 
+private:  // Types
+  template <typename T>
+  struct Entry {
+    std::shared_ptr<const T> element;
+    quint64                  lastAccess;  ///< value of #mAccessCounter
+  };
+
+  struct PackedLibrary {
+    std::shared_ptr<TransactionalFileSystem> fs;
+    qint64                                   modified;  ///< Archive mtime [ms]
+  };
+
+  typedef FilePath (workspace::WorkspaceLibraryDb::*Getter)(
+      const Uuid&) const;
+
 private:  // Methods
   template <typename T>
-  std::shared_ptr<const T> getElement(
-      FilePath (workspace::WorkspaceLibraryDb::*getter)(const Uuid&) const,
-      QHash<Uuid, std::shared_ptr<const T>>& container, const Uuid& uuid) const
-      noexcept;
+  std::shared_ptr<const T> getElement(Getter getter,
+                                      QHash<Uuid, Entry<T>>& container,
+                                      const Uuid& uuid) const noexcept;
+  template <typename T>
+  void prefetch(Getter getter, QHash<Uuid, Entry<T>>& container,
+                const QList<Uuid>& uuids) const noexcept;
+  template <typename T>
+  std::shared_ptr<const T> loadElement(Getter      getter,
+                                       const Uuid& uuid) const noexcept;
+  template <typename T>
+  std::shared_ptr<const T> insertElement(
+      QHash<Uuid, Entry<T>>& container, const Uuid& uuid,
+      const std::shared_ptr<const T>& element) const noexcept;
+  std::unique_ptr<TransactionalDirectory> openElementDirectory(
+      const FilePath& fp) const;
+  int  countEntries() const noexcept;
+  void evict() const noexcept;
 
 private:  // Data
-  QPointer<const workspace::WorkspaceLibraryDb>                 mDb;
-  mutable QHash<Uuid, std::shared_ptr<const ComponentCategory>> mCmpCat;
-  mutable QHash<Uuid, std::shared_ptr<const PackageCategory>>   mPkgCat;
-  mutable QHash<Uuid, std::shared_ptr<const Symbol>>            mSym;
-  mutable QHash<Uuid, std::shared_ptr<const Package>>           mPkg;
-  mutable QHash<Uuid, std::shared_ptr<const Component>>         mCmp;
-  mutable QHash<Uuid, std::shared_ptr<const Device>>            mDev;
+  QPointer<const workspace::WorkspaceLibraryDb> mDb;
+  QThread*                                      mThread;  ///< see loadElement()
+
+  /// Protects all the members below
+  mutable QMutex                                mMutex;
+  int                                           mMaxEntries;
+  mutable quint64                               mAccessCounter;
+  mutable quint64                               mHitCount;
+  mutable quint64                               mMissCount;
+  mutable QHash<Uuid, Entry<ComponentCategory>> mCmpCat;
+  mutable QHash<Uuid, Entry<PackageCategory>>   mPkgCat;
+  mutable QHash<Uuid, Entry<Symbol>>            mSym;
+  mutable QHash<Uuid, Entry<Package>>           mPkg;
+  mutable QHash<Uuid, Entry<Component>>         mCmp;
+  mutable QHash<Uuid, Entry<Device>>            mDev;
+
+  /// Elements currently being loaded by #prefetch()
+  mutable QHash<Uuid, QFuture<void>> mPendingLoads;
+
+  /// Packed libraries opened by #openElementDirectory()
+  mutable QHash<FilePath, PackedLibrary> mPackedLibraries;
 };
 
 /*******************************************************************************
@@ -0,0 +1,231 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryelementcheckcache.h"
+
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/sqlitedatabase.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Class CachedCheckMessage
+ ******************************************************************************/
+
+/**
+ * @brief A check message restored from the cache
+ *
+ * Only severity, message and description are stored in the cache, so the
+ * original message type is lost.
+ */
+class CachedCheckMessage final : public LibraryElementCheckMessage {
+public:
+  CachedCheckMessage(Severity severity, const QString& msg,
+                     const QString& description) noexcept
+    : LibraryElementCheckMessage(severity, msg, description) {}
+  ~CachedCheckMessage() noexcept {}
+};
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryElementCheckCache::LibraryElementCheckCache(const FilePath& fp,
+                                                   const QString&  version)
+  : mDb(new SQLiteDatabase(fp)),  // can throw
+    mVersion(version),
+    mHitCount(0),
+    mMissCount(0) {
+  mDb->exec(
+      "CREATE TABLE IF NOT EXISTS check_results ("
+      "`key` BLOB PRIMARY KEY NOT NULL, "
+      "`version` TEXT NOT NULL, "
+      "`messages` TEXT NOT NULL"
+      ")");  // can throw
+
+  // Remove results of other application versions
+  QSqlQuery query = mDb->prepareQuery(
+      "DELETE FROM check_results WHERE version != :version");
+  query.bindValue(":version", mVersion);
+  mDb->exec(query);  // can throw
+
+  query = mDb->prepareQuery("SELECT key, messages FROM check_results");
+  mDb->exec(query);  // can throw
+  while (query.next()) {
+    mEntries.insert(query.value(0).toByteArray(),
+                    deserialize(query.value(1).toString()));
+  }
+}
+
+LibraryElementCheckCache::~LibraryElementCheckCache() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+int LibraryElementCheckCache::getEntryCount() const noexcept {
+  QMutexLocker locker(&mMutex);
+  return mEntries.count() + mNewEntries.count();
+}
+
+quint64 LibraryElementCheckCache::getHitCount() const noexcept {
+  QMutexLocker locker(&mMutex);
+  return mHitCount;
+}
+
+quint64 LibraryElementCheckCache::getMissCount() const noexcept {
+  QMutexLocker locker(&mMutex);
+  return mMissCount;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+tl::optional<LibraryElementCheckMessageList> LibraryElementCheckCache::find(
+    const QByteArray& key) const noexcept {
+  QMutexLocker locker(&mMutex);
+  auto         it = mEntries.find(key);
+  if (it == mEntries.end()) {
+    it = mNewEntries.find(key);
+    if (it == mNewEntries.end()) {
+      ++mMissCount;
+      return tl::nullopt;
+    }
+  }
+  ++mHitCount;
+  return *it;
+}
+
+void LibraryElementCheckCache::insert(
+    const QByteArray&                     key,
+    const LibraryElementCheckMessageList& messages) noexcept {
+  QMutexLocker locker(&mMutex);
+  if (!mEntries.contains(key)) {
+    mNewEntries.insert(key, messages);
+  }
+}
+
+void LibraryElementCheckCache::save() {
+  QMutexLocker locker(&mMutex);
+  if (mNewEntries.isEmpty()) {
+    return;
+  }
+
+  SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDb);  // can throw
+  for (auto it = mNewEntries.constBegin(); it != mNewEntries.constEnd(); ++it) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT OR REPLACE INTO check_results (key, version, messages) "
+        "VALUES (:key, :version, :messages)");
+    query.bindValue(":key", it.key());
+    query.bindValue(":version", mVersion);
+    query.bindValue(":messages", serialize(it.value()));
+    mDb->exec(query);  // can throw
+  }
+  transactionGuard.commit();  // can throw
+
+  mEntries.unite(mNewEntries);
+  mNewEntries.clear();
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QByteArray LibraryElementCheckCache::calculateKey(
+    const TransactionalDirectory& dir) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  addToHash(hash, dir, QString());  // can throw
+  return hash.result();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void LibraryElementCheckCache::addToHash(QCryptographicHash&           hash,
+                                         const TransactionalDirectory& dir,
+                                         const QString&                path) {
+  // Sort the entries since their order depends on the file system.
+  QStringList files = dir.getFiles(path);
+  files.sort();
+  foreach (const QString& file, files) {
+    QString    filepath = path.isEmpty() ? file : QString(path % "/" % file);
+    QByteArray content  = dir.read(filepath);  // can throw
+    // Also hash the path and the size to make the key unambiguous.
+    hash.addData(filepath.toUtf8());
+    hash.addData(QByteArray::number(content.size()));
+    hash.addData(content);
+  }
+  QStringList dirs = dir.getDirs(path);
+  dirs.sort();
+  foreach (const QString& subdir, dirs) {
+    if (!subdir.startsWith('.')) {
+      addToHash(hash, dir,
+                path.isEmpty() ? subdir
+                               : QString(path % "/" % subdir));  // can throw
+    }
+  }
+}
+
+QString LibraryElementCheckCache::serialize(
+    const LibraryElementCheckMessageList& messages) noexcept {
+  QJsonArray array;
+  foreach (const auto& msg, messages) {
+    QJsonObject obj;
+    obj.insert("severity", static_cast<int>(msg->getSeverity()));
+    obj.insert("message", msg->getMessage());
+    obj.insert("description", msg->getDescription());
+    array.append(obj);
+  }
+  return QString::fromUtf8(QJsonDocument(array).toJson(QJsonDocument::Compact));
+}
+
+LibraryElementCheckMessageList LibraryElementCheckCache::deserialize(
+    const QString& json) noexcept {
+  LibraryElementCheckMessageList messages;
+  foreach (const QJsonValue& value,
+           QJsonDocument::fromJson(json.toUtf8()).array()) {
+    QJsonObject obj = value.toObject();
+    messages.append(std::make_shared<CachedCheckMessage>(
+        static_cast<LibraryElementCheckMessage::Severity>(
+            obj.value("severity").toInt()),
+        obj.value("message").toString(),
+        obj.value("description").toString()));
+  }
+  return messages;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,162 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTCHECKCACHE_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTCHECKCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "msg/libraryelementcheckmessage.h"
+
+#include <librepcb/common/fileio/filepath.h>
+#include <optional/tl/optional.hpp>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class SQLiteDatabase;
+class TransactionalDirectory;
+
+namespace library {
+
+/*******************************************************************************
+ *  Class LibraryElementCheckCache
+ ******************************************************************************/
+
+/**
+ * @brief Persistent cache for the check results of library elements
+ *
+ * The results of librepcb::library::LibraryBaseElement::runChecks() only
+ * depend on the content of the element's files, so they are stored in a
+ * SQLite database with the hash of the content as key (see #calculateKey()).
+ * Checking unmodified elements again (e.g. in a CI) then only needs to hash
+ * their files instead of loading and checking them.
+ *
+ * Each entry is also tagged with a version string (e.g. application version
+ * and locale of the messages). Entries with a different version are removed
+ * when opening the cache, so results of other application versions are never
+ * returned.
+ *
+ * @note #find() and #insert() are thread-safe, but the database is only
+ *       accessed by the constructor and #save(), which must be called from
+ *       the thread which created the cache.
+ */
+class LibraryElementCheckCache final {
+  Q_DECLARE_TR_FUNCTIONS(LibraryElementCheckCache)
+
+public:
+  // Constructors / Destructor
+  LibraryElementCheckCache()                                      = delete;
+  LibraryElementCheckCache(const LibraryElementCheckCache& other) = delete;
+  LibraryElementCheckCache(const FilePath& fp, const QString& version);
+  ~LibraryElementCheckCache() noexcept;
+
+  // Getters
+  int     getEntryCount() const noexcept;
+  quint64 getHitCount() const noexcept;
+  quint64 getMissCount() const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get the cached check results of an element
+   *
+   * @param key   Key of the element, see #calculateKey()
+   *
+   * @return The check messages, or tl::nullopt if there is no cache entry
+   */
+  tl::optional<LibraryElementCheckMessageList> find(const QByteArray& key) const
+      noexcept;
+
+  /**
+   * @brief Add the check results of an element
+   *
+   * The entry is written to the database by the next call to #save().
+   *
+   * @param key       Key of the element, see #calculateKey()
+   * @param messages  The messages returned by the checks
+   */
+  void insert(const QByteArray&                     key,
+              const LibraryElementCheckMessageList& messages) noexcept;
+
+  /**
+   * @brief Write all inserted entries to the database
+   *
+   * @throw Exception on errors.
+   */
+  void save();
+
+  // Static Methods
+
+  /**
+   * @brief Calculate the cache key of an element
+   *
+   * The key is the SHA-256 hash of the relative paths and the content of
+   * all files in the element's directory, including subdirectories. Hidden
+   * directories (e.g. ".git") are ignored, but hidden files are not since
+   * they contain the file format version of the element.
+   *
+   * @param dir   The directory of the element
+   *
+   * @return The key (binary)
+   *
+   * @throw Exception if reading a file failed.
+   */
+  static QByteArray calculateKey(const TransactionalDirectory& dir);
+
+  // Operator Overloadings
+  LibraryElementCheckCache& operator=(const LibraryElementCheckCache& rhs) =
+      delete;
+
+private:  // Methods
+  static void    addToHash(QCryptographicHash&           hash,
+                           const TransactionalDirectory& dir,
+                           const QString&                path);
+  static QString serialize(
+      const LibraryElementCheckMessageList& messages) noexcept;
+  static LibraryElementCheckMessageList deserialize(
+      const QString& json) noexcept;
+
+private:  // Data
+  QScopedPointer<SQLiteDatabase> mDb;
+  QString                        mVersion;
+
+  mutable QMutex                                    mMutex;
+  QHash<QByteArray, LibraryElementCheckMessageList> mEntries;
+  QHash<QByteArray, LibraryElementCheckMessageList> mNewEntries;
+  mutable quint64                                   mHitCount;
+  mutable quint64                                   mMissCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_LIBRARYELEMENTCHECKCACHE_H
@@ -0,0 +1,155 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryelementmetadata.h"
+
+#include "librarybaseelement.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/mappedfile.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/fileio/versionfile.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryElementMetadata::LibraryElementMetadata(const SExpression& root)
+  : mUuid(root.getChildByIndex(0).getValue<Uuid>()),
+    mVersion(root.getValueByPath<Version>("version")),
+    mNames(root),
+    mDescriptions(root),
+    mKeywords(root) {
+  foreach (const SExpression* node, root.getChildren("category")) {
+    mCategories.insert(node->getValueOfFirstChild<Uuid>());
+  }
+  if (const SExpression* node = root.tryGetChildByPath("parent")) {
+    mParentUuid = node->getValueOfFirstChild<tl::optional<Uuid>>();
+  }
+  if (const SExpression* node = root.tryGetChildByPath("component")) {
+    mComponentUuid = node->getValueOfFirstChild<Uuid>();
+  }
+  if (const SExpression* node = root.tryGetChildByPath("package")) {
+    mPackageUuid = node->getValueOfFirstChild<Uuid>();
+  }
+}
+
+LibraryElementMetadata::~LibraryElementMetadata() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QStringList LibraryElementMetadata::getAllAvailableLocales() const noexcept {
+  QStringList list;
+  list.append(mNames.keys());
+  list.append(mDescriptions.keys());
+  list.append(mKeywords.keys());
+  list.removeDuplicates();
+  list.sort(Qt::CaseSensitive);
+  return list;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+LibraryElementMetadata LibraryElementMetadata::read(
+    const TransactionalDirectory& dir, const QString& shortElementName,
+    const QString& longElementName) {
+  // Note: Use the messages of LibraryBaseElement as the checks are the same.
+
+  // check if the directory is a library element
+  QString versionFileName = ".librepcb-" % shortElementName;
+  if (!dir.fileExists(versionFileName)) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(LibraryBaseElement::tr(
+                    "Directory is not a library element of type %1: \"%2\""))
+            .arg(longElementName, dir.getAbsPath().toNative()));
+  }
+
+  // check directory name
+  QString dirUuidStr = dir.getAbsPath().getFilename();
+  if (!Uuid::isValid(dirUuidStr)) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(LibraryBaseElement::tr(
+                    "Directory name is not a valid UUID: \"%1\""))
+            .arg(dir.getAbsPath().toNative()));
+  }
+
+  // read version number from version file
+  VersionFile versionFile =
+      VersionFile::fromByteArray(dir.read(versionFileName));  // can throw
+  if (versionFile.getVersion() > qApp->getAppVersion()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(LibraryBaseElement::tr(
+                    "The library element %1 was created with a newer "
+                    "application version. You need at least LibrePCB "
+                    "version %2 to open it."))
+            .arg(dir.getAbsPath().toNative())
+            .arg(versionFile.getVersion().toPrettyStr(3)));
+  }
+
+  // parse only the attributes of the main file
+  static const QSet<QString> attributes = {
+      "version",  "name",   "description", "keywords",
+      "category", "parent", "component",   "package",
+  };
+  QString  sexprFileName = longElementName % ".lp";
+  FilePath sexprFilePath = dir.getAbsPath(sexprFileName);
+  std::unique_ptr<const MappedFile> sexprFile =
+      dir.map(sexprFileName);  // can throw
+  LibraryElementMetadata metadata(SExpression::parsePartially(
+      sexprFile->getContent(), sexprFilePath, attributes));  // can throw
+
+  // check if the UUID equals to the directory basename
+  if (metadata.mUuid.toStr() != dirUuidStr) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(LibraryBaseElement::tr(
+                    "UUID mismatch between element directory and main file: "
+                    "\"%1\""))
+            .arg(sexprFilePath.toNative()));
+  }
+  return metadata;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
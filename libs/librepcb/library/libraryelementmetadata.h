@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/elementname.h>
+#include <librepcb/common/fileio/serializablekeyvaluemap.h>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
+#include <optional/tl/optional.hpp>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class SExpression;
+class TransactionalDirectory;
+
+namespace library {
+
+/*******************************************************************************
+ *  Class LibraryElementMetadata
+ ******************************************************************************/
+
+/**
+ * @brief The attributes of a library element needed to index it
+ *
+ * Reading the metadata is several times faster than loading the element,
+ * since only the attribute nodes of the element's main file are parsed (see
+ * librepcb::SExpression::parsePartially()). All other nodes, e.g. the
+ * footprints of a package, are skipped without building them.
+ *
+ * The same checks as in the constructor of
+ * librepcb::library::LibraryBaseElement are done (version file, directory
+ * name, UUID), so elements which cannot be loaded are rejected as well.
+ */
+class LibraryElementMetadata final {
+  Q_DECLARE_TR_FUNCTIONS(LibraryElementMetadata)
+
+public:
+  // Constructors / Destructor
+  LibraryElementMetadata()                                    = delete;
+  LibraryElementMetadata(const LibraryElementMetadata& other) = default;
+  ~LibraryElementMetadata() noexcept;
+
+  // Getters
+  const Uuid&                    getUuid() const noexcept { return mUuid; }
+  const Version&                 getVersion() const noexcept {
+    return mVersion;
+  }
+  const LocalizedNameMap&        getNames() const noexcept { return mNames; }
+  const LocalizedDescriptionMap& getDescriptions() const noexcept {
+    return mDescriptions;
+  }
+  const LocalizedKeywordsMap& getKeywords() const noexcept { return mKeywords; }
+  QStringList                 getAllAvailableLocales() const noexcept;
+
+  /// Categories of the element (always empty for categories)
+  const QSet<Uuid>& getCategories() const noexcept { return mCategories; }
+
+  /// Parent category (only available for categories)
+  const tl::optional<Uuid>& getParentUuid() const noexcept {
+    return mParentUuid;
+  }
+
+  /// Component of the element (only available for devices)
+  const tl::optional<Uuid>& getComponentUuid() const noexcept {
+    return mComponentUuid;
+  }
+
+  /// Package of the element (only available for devices)
+  const tl::optional<Uuid>& getPackageUuid() const noexcept {
+    return mPackageUuid;
+  }
+
+  // Operator Overloadings
+  LibraryElementMetadata& operator=(const LibraryElementMetadata& rhs) =
+      default;
+
+  // Static Methods
+
+  /**
+   * @brief Read the metadata of a library element
+   *
+   * @tparam ElementType  The type of the element, e.g.
+   *                      librepcb::library::Package.
+   *
+   * @param dir           The directory of the element.
+   *
+   * @return The metadata
+   *
+   * @throw Exception if the element or its metadata is invalid
+   */
+  template <typename ElementType>
+  static LibraryElementMetadata read(const TransactionalDirectory& dir) {
+    return read(dir, ElementType::getShortElementName(),
+                ElementType::getLongElementName());  // can throw
+  }
+  static LibraryElementMetadata read(const TransactionalDirectory& dir,
+                                     const QString& shortElementName,
+                                     const QString& longElementName);
+
+private:  // Methods
+  explicit LibraryElementMetadata(const SExpression& root);
+
+private:  // Data
+  Uuid                    mUuid;
+  Version                 mVersion;
+  LocalizedNameMap        mNames;
+  LocalizedDescriptionMap mDescriptions;
+  LocalizedKeywordsMap    mKeywords;
+  QSet<Uuid>              mCategories;
+  tl::optional<Uuid>      mParentUuid;
+  tl::optional<Uuid>      mComponentUuid;
+  tl::optional<Uuid>      mPackageUuid;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
@@ -0,0 +1,176 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryelementthumbnailrenderer.h"
+
+#include "library.h"
+#include "pkg/footprintpreviewgraphicsitem.h"
+#include "pkg/package.h"
+#include "sym/symbol.h"
+#include "sym/symbolpreviewgraphicsitem.h"
+
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/utils/taskscheduler.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryElementThumbnailRenderer::LibraryElementThumbnailRenderer(
+    const FilePath& cacheDir, const QSize& size, QObject* parent) noexcept
+  : QObject(parent), mCacheDir(cacheDir), mSize(size) {
+}
+
+LibraryElementThumbnailRenderer::~LibraryElementThumbnailRenderer() noexcept {
+  foreach (QFutureWatcher<QImage>* watcher, mJobs) {
+    watcher->waitForFinished();
+    delete watcher;
+  }
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QImage LibraryElementThumbnailRenderer::getThumbnail(
+    const FilePath& elementDir) noexcept {
+  if (!mJobs.contains(elementDir)) {
+    QFutureWatcher<QImage>* watcher = new QFutureWatcher<QImage>(this);
+    connect(watcher, &QFutureWatcher<QImage>::finished, this,
+            [this, elementDir]() { jobFinished(elementDir); });
+    FilePath cacheDir = mCacheDir;
+    QSize    size     = mSize;
+    watcher->setFuture(TaskScheduler::run(
+        TaskScheduler::Priority::Background, [cacheDir, size, elementDir]() {
+          return loadOrRender(cacheDir, size, elementDir);
+        }));
+    mJobs.insert(elementDir, watcher);
+  }
+  return mThumbnails.value(elementDir);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void LibraryElementThumbnailRenderer::jobFinished(
+    const FilePath& elementDir) noexcept {
+  QFutureWatcher<QImage>* watcher = mJobs.take(elementDir);
+  Q_ASSERT(watcher);
+  QImage image = watcher->result();
+  watcher->deleteLater();
+  if (image.isNull()) {
+    mThumbnails.remove(elementDir);
+  } else if (image != mThumbnails.value(elementDir)) {
+    mThumbnails.insert(elementDir, image);
+  } else {
+    return;  // thumbnail has not changed
+  }
+  emit thumbnailReady(elementDir, image);
+}
+
+QImage LibraryElementThumbnailRenderer::loadOrRender(
+    const FilePath& cacheDir, const QSize& size,
+    const FilePath& elementDir) noexcept {
+  try {
+    FilePath fp = elementDir.getPathTo(Symbol::getLongElementName() % ".lp");
+    if (!fp.isExistingFile()) {
+      fp = elementDir.getPathTo(Package::getLongElementName() % ".lp");
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(FileUtils::readFile(fp));  // can throw
+    QString  hex     = QString::fromLatin1(hash.result().toHex());
+    FilePath cacheFp = cacheDir.getPathTo(
+        QString("%1/%2_%3x%4.png")
+            .arg(elementDir.getFilename(), hex)
+            .arg(size.width())
+            .arg(size.height()));
+
+    QImage image;
+    if (cacheFp.isExistingFile() && image.load(cacheFp.toStr(), "PNG")) {
+      return image;
+    }
+    image = render(elementDir, size);  // can throw
+    if (image.isNull()) {
+      return image;
+    }
+    QByteArray png;
+    QBuffer    buffer(&png);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    try {
+      // Note: FileUtils::writeFile() writes atomically, so it doesn't matter if
+      // the same file is written by multiple threads at the same time.
+      FileUtils::writeFile(cacheFp, png);  // can throw
+    } catch (const Exception& e) {
+      qWarning() << "Failed to write thumbnail cache file"
+                 << cacheFp.toNative() << ":" << e.getMsg();
+    }
+    return image;
+  } catch (const Exception& e) {
+    qWarning() << "Failed to render thumbnail of" << elementDir.toNative()
+               << ":" << e.getMsg();
+    return QImage();
+  }
+}
+
+QImage LibraryElementThumbnailRenderer::render(const FilePath& elementDir,
+                                               const QSize&    size) {
+  DefaultGraphicsLayerProvider            layerProvider;
+  GraphicsScene                           scene;
+  std::unique_ptr<TransactionalDirectory> dir =
+      Library::openElementDirectory(elementDir);  // can throw
+  if (dir->fileExists(Symbol::getLongElementName() % ".lp")) {
+    Symbol                    symbol(std::move(dir));  // can throw
+    SymbolPreviewGraphicsItem item(layerProvider, QStringList(), symbol);
+    scene.addItem(item);
+    return scene.toImage(size, Qt::white);
+  } else {
+    Package package(std::move(dir));  // can throw
+    if (package.getFootprints().isEmpty()) {
+      return QImage();
+    }
+    FootprintPreviewGraphicsItem item(layerProvider, QStringList(),
+                                      *package.getFootprints().first(),
+                                      &package);
+    scene.addItem(item);
+    return scene.toImage(size, Qt::black);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
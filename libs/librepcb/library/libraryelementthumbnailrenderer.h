@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTTHUMBNAILRENDERER_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTTHUMBNAILRENDERER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Class LibraryElementThumbnailRenderer
+ ******************************************************************************/
+
+/**
+ * @brief Renders thumbnails of symbols and packages in the background
+ *
+ * Building a graphics scene just to show a small preview of a library element
+ * is expensive, especially when browsing through many elements. This class
+ * renders such thumbnails offscreen on the global thread pool and stores them
+ * as PNG files in a cache directory. The cache files are keyed by the element
+ * UUID (its directory name) and the hash of its element file, which contains
+ * the version too. So a thumbnail is rendered only once per element version,
+ * even across application restarts.
+ *
+ * Thumbnails which are available are returned immediately by
+ * #getThumbnail(). Missing or outdated thumbnails are rendered in the
+ * background and reported with the #thumbnailReady() signal.
+ */
+class LibraryElementThumbnailRenderer final : public QObject {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  LibraryElementThumbnailRenderer() = delete;
+  LibraryElementThumbnailRenderer(
+      const LibraryElementThumbnailRenderer& other) = delete;
+  LibraryElementThumbnailRenderer(const FilePath& cacheDir, const QSize& size,
+                                  QObject* parent = nullptr) noexcept;
+  ~LibraryElementThumbnailRenderer() noexcept;
+
+  // Getters
+  const FilePath& getCacheDirectory() const noexcept { return mCacheDir; }
+  const QSize&    getSize() const noexcept { return mSize; }
+
+  // General Methods
+
+  /**
+   * @brief Get the thumbnail of a symbol or package
+   *
+   * @param elementDir  Directory of the symbol or package
+   *
+   * @return The last known thumbnail of the element, or a null image if there
+   *         is no thumbnail available yet. In addition, the thumbnail is
+   *         updated in the background (if the element was modified) and then
+   *         reported with #thumbnailReady().
+   */
+  QImage getThumbnail(const FilePath& elementDir) noexcept;
+
+  // Operator Overloadings
+  LibraryElementThumbnailRenderer& operator       =(
+      const LibraryElementThumbnailRenderer& rhs) = delete;
+
+signals:
+  void thumbnailReady(const FilePath& elementDir, const QImage& image);
+
+private:  // Methods
+  void          jobFinished(const FilePath& elementDir) noexcept;
+  static QImage loadOrRender(const FilePath& cacheDir, const QSize& size,
+                             const FilePath& elementDir) noexcept;
+  static QImage render(const FilePath& elementDir, const QSize& size);
+
+private:  // Data
+  FilePath                                 mCacheDir;
+  QSize                                    mSize;
+  QHash<FilePath, QImage>                  mThumbnails;
+  QHash<FilePath, QFutureWatcher<QImage>*> mJobs;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_LIBRARYELEMENTTHUMBNAILRENDERER_H
@@ -35,7 +35,6 @@ namespace library {
 LibraryElementCheckMessage::LibraryElementCheckMessage(
     const LibraryElementCheckMessage& other) noexcept
   : mSeverity(other.mSeverity),
-    mSeverityPixmap(other.mSeverityPixmap),
     mMessage(other.mMessage),
     mDescription(other.mDescription) {
 }
@@ -43,7 +42,6 @@ LibraryElementCheckMessage::LibraryElementCheckMessage(
 LibraryElementCheckMessage::LibraryElementCheckMessage(
     Severity severity, const QString& msg, const QString& description) noexcept
   : mSeverity(severity),
-    mSeverityPixmap(getSeverityPixmap(severity)),
     mMessage(msg),
     mDescription(description) {
 }
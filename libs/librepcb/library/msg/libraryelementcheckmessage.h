@@ -57,7 +57,9 @@ public:
 
   // Getters
   Severity       getSeverity() const noexcept { return mSeverity; }
-  const QPixmap& getSeverityPixmap() const noexcept { return mSeverityPixmap; }
+  QPixmap        getSeverityPixmap() const noexcept {
+    return getSeverityPixmap(mSeverity);
+  }
   const QString& getMessage() const noexcept { return mMessage; }
   const QString& getDescription() const noexcept { return mDescription; }
 
@@ -87,7 +89,6 @@ protected:  // Methods
 
 protected:  // Data
   Severity mSeverity;
-  QPixmap  mSeverityPixmap;
   QString  mMessage;
   QString  mDescription;
 };
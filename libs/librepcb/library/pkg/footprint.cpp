@@ -130,6 +130,20 @@ Footprint::~Footprint() noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 Footprint::getMemoryUsage() const noexcept {
+  qint64 usage = sizeof(Footprint) + (mPads.count() * sizeof(FootprintPad)) +
+                 (mCircles.count() * sizeof(Circle)) +
+                 (mHoles.count() * sizeof(Hole));
+  for (const Polygon& polygon : mPolygons) {
+    usage += polygon.getMemoryUsage();
+  }
+  for (const StrokeText& text : mStrokeTexts) {
+    usage += text.getMemoryUsage();
+  }
+  foreach (const QPicture& picture, mPictureCache) { usage += picture.size(); }
+  return usage;
+}
+
 void Footprint::setStrokeFontForAllTexts(const StrokeFont* font) noexcept {
   mStrokeFont = font;
   for (StrokeText& text : mStrokeTexts) {
@@ -137,6 +151,25 @@ void Footprint::setStrokeFontForAllTexts(const StrokeFont* font) noexcept {
   }
 }
 
+QPicture Footprint::getPicture(
+    const QByteArray&                      key,
+    const std::function<void(QPainter&)>& record) const noexcept {
+  auto it = mPictureCache.constFind(key);
+  if (it != mPictureCache.constEnd()) {
+    return it.value();
+  }
+
+  QPicture picture;
+  QPainter painter(&picture);
+  record(painter);
+  painter.end();
+  if (mPictureCache.count() >= 16) {
+    mPictureCache.clear();  // e.g. after many layer color changes
+  }
+  mPictureCache.insert(key, picture);
+  return picture;
+}
+
 void Footprint::registerGraphicsItem(FootprintGraphicsItem& item) noexcept {
   Q_ASSERT(!mRegisteredGraphicsItem);
   mRegisteredGraphicsItem = &item;
@@ -251,6 +284,7 @@ void Footprint::polygonsEdited(const PolygonList& list, int index,
     default:
       break;
   }
+  mPictureCache.clear();
   onEdited.notify(Event::PolygonsEdited);
 }
 
@@ -273,6 +307,7 @@ void Footprint::circlesEdited(const CircleList& list, int index,
     default:
       break;
   }
+  mPictureCache.clear();
   onEdited.notify(Event::CirclesEdited);
 }
 
@@ -36,6 +36,9 @@
 #include <librepcb/common/geometry/stroketext.h>
 
 #include <QtCore>
+#include <QtGui>
+
+#include <functional>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -104,9 +107,28 @@ public:
   StrokeTextList&       getStrokeTexts() noexcept { return mStrokeTexts; }
   const HoleList&       getHoles() const noexcept { return mHoles; }
   HoleList&             getHoles() noexcept { return mHoles; }
+  qint64                getMemoryUsage() const noexcept;
 
   // General Methods
   void setStrokeFontForAllTexts(const StrokeFont* font) noexcept;
+
+  /**
+   * @brief Get a recorded drawing of the footprint, recording it if needed
+   *
+   * All graphics items showing this footprint share the recorded drawings,
+   * so they only need to replay them with their own transformation instead
+   * of drawing every polygon and circle again.
+   *
+   * @param key     Identifies everything the drawing depends on apart from
+   *                the footprint itself (e.g. the layer colors)
+   * @param record  Draws the footprint if there is no drawing for the key
+   *
+   * @return The (implicitly shared) recorded drawing
+   */
+  QPicture getPicture(
+      const QByteArray&                      key,
+      const std::function<void(QPainter&)>& record) const noexcept;
+
   void registerGraphicsItem(FootprintGraphicsItem& item) noexcept;
   void unregisterGraphicsItem(FootprintGraphicsItem& item) noexcept;
 
@@ -157,6 +179,9 @@ private:  // Data
   const StrokeFont*      mStrokeFont;
   FootprintGraphicsItem* mRegisteredGraphicsItem;
 
+  /// Recorded drawings, see #getPicture()
+  mutable QHash<QByteArray, QPicture> mPictureCache;
+
   // Slots
   LocalizedNameMap::OnEditedSlot        mNamesEditedSlot;
   LocalizedDescriptionMap::OnEditedSlot mDescriptionsEditedSlot;
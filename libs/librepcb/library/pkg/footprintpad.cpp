@@ -113,34 +113,44 @@ bool FootprintPad::isOnLayer(const QString& name) const noexcept {
 }
 
 Path FootprintPad::getOutline(const Length& expansion) const noexcept {
-  Length width  = mWidth + (expansion * 2);
-  Length height = mHeight + (expansion * 2);
-  if (width > 0 && height > 0) {
-    PositiveLength pWidth(width);
-    PositiveLength pHeight(height);
-    switch (mShape) {
-      case Shape::ROUND:
-        return Path::obround(pWidth, pHeight);
-      case Shape::RECT:
-        return Path::centeredRect(pWidth, pHeight);
-      case Shape::OCTAGON:
-        return Path::octagon(pWidth, pHeight);
-      default:
-        Q_ASSERT(false);
-        break;
-    }
+  auto it = mOutlineCache.constFind(expansion);
+  if (it != mOutlineCache.constEnd()) {
+    return it.value();
   }
-  return Path();
+
+  Path p = buildOutline(expansion);
+  mOutlineCache.insert(expansion, p);
+  return p;
 }
 
 QPainterPath FootprintPad::toQPainterPathPx(const Length& expansion) const
     noexcept {
-  QPainterPath p = getOutline(expansion).toQPainterPathPx();
+  QPair<Length, bool> key(expansion, true);
+  auto                it = mPainterPathPxCache.constFind(key);
+  if (it != mPainterPathPxCache.constEnd()) {
+    return it.value();
+  }
+
+  QPainterPath p = toOutlineQPainterPathPx(expansion);
   if (mBoardSide == BoardSide::THT) {
     p.setFillRule(Qt::OddEvenFill);  // important to subtract the hole!
     p.addEllipse(QPointF(0, 0), mDrillDiameter->toPx() / 2,
                  mDrillDiameter->toPx() / 2);
   }
+  mPainterPathPxCache.insert(key, p);
+  return p;
+}
+
+QPainterPath FootprintPad::toOutlineQPainterPathPx(
+    const Length& expansion) const noexcept {
+  QPair<Length, bool> key(expansion, false);
+  auto                it = mPainterPathPxCache.constFind(key);
+  if (it != mPainterPathPxCache.constEnd()) {
+    return it.value();
+  }
+
+  QPainterPath p = getOutline(expansion).toQPainterPathPx();
+  mPainterPathPxCache.insert(key, p);
   return p;
 }
 
@@ -185,6 +195,7 @@ bool FootprintPad::setShape(Shape shape) noexcept {
   }
 
   mShape = shape;
+  invalidateGeometryCache();
   if (mRegisteredGraphicsItem)
     mRegisteredGraphicsItem->setShape(toQPainterPathPx());
   onEdited.notify(Event::ShapeChanged);
@@ -197,6 +208,7 @@ bool FootprintPad::setWidth(const PositiveLength& width) noexcept {
   }
 
   mWidth = width;
+  invalidateGeometryCache();
   if (mRegisteredGraphicsItem)
     mRegisteredGraphicsItem->setShape(toQPainterPathPx());
   onEdited.notify(Event::WidthChanged);
@@ -209,6 +221,7 @@ bool FootprintPad::setHeight(const PositiveLength& height) noexcept {
   }
 
   mHeight = height;
+  invalidateGeometryCache();
   if (mRegisteredGraphicsItem)
     mRegisteredGraphicsItem->setShape(toQPainterPathPx());
   onEdited.notify(Event::HeightChanged);
@@ -221,6 +234,7 @@ bool FootprintPad::setDrillDiameter(const UnsignedLength& diameter) noexcept {
   }
 
   mDrillDiameter = diameter;
+  invalidateGeometryCache();
   if (mRegisteredGraphicsItem)
     mRegisteredGraphicsItem->setShape(toQPainterPathPx());
   onEdited.notify(Event::DrillDiameterChanged);
@@ -233,6 +247,7 @@ bool FootprintPad::setBoardSide(BoardSide side) noexcept {
   }
 
   mBoardSide = side;
+  invalidateGeometryCache();
   if (mRegisteredGraphicsItem)
     mRegisteredGraphicsItem->setLayerName(getLayerName());
   if (mRegisteredGraphicsItem)
@@ -268,6 +283,36 @@ void FootprintPad::serialize(SExpression& root) const {
   root.appendChild("drill", mDrillDiameter, false);
 }
 
+/*******************************************************************************
+ *  Protected Methods
+ ******************************************************************************/
+
+Path FootprintPad::buildOutline(const Length& expansion) const noexcept {
+  Length width  = mWidth + (expansion * 2);
+  Length height = mHeight + (expansion * 2);
+  if (width > 0 && height > 0) {
+    PositiveLength pWidth(width);
+    PositiveLength pHeight(height);
+    switch (mShape) {
+      case Shape::ROUND:
+        return Path::obround(pWidth, pHeight);
+      case Shape::RECT:
+        return Path::centeredRect(pWidth, pHeight);
+      case Shape::OCTAGON:
+        return Path::octagon(pWidth, pHeight);
+      default:
+        Q_ASSERT(false);
+        break;
+    }
+  }
+  return Path();
+}
+
+void FootprintPad::invalidateGeometryCache() noexcept {
+  mOutlineCache.clear();
+  mPainterPathPxCache.clear();
+}
+
 /*******************************************************************************
  *  Operator Overloadings
  ******************************************************************************/
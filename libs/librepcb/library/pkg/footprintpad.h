@@ -100,6 +100,8 @@ public:
   Path         getOutline(const Length& expansion = Length(0)) const noexcept;
   QPainterPath toQPainterPathPx(const Length& expansion = Length(0)) const
       noexcept;
+  QPainterPath toOutlineQPainterPathPx(
+      const Length& expansion = Length(0)) const noexcept;
 
   // Setters
   bool setPackagePadUuid(const Uuid& pad) noexcept;
@@ -125,6 +127,10 @@ public:
   }
   FootprintPad& operator=(const FootprintPad& rhs) noexcept;
 
+protected:  // Methods
+  Path buildOutline(const Length& expansion) const noexcept;
+  void invalidateGeometryCache() noexcept;
+
 protected:  // Data
   Uuid                      mPackagePadUuid;
   Point                     mPosition;
@@ -135,6 +141,19 @@ protected:  // Data
   UnsignedLength            mDrillDiameter;  // no effect if BoardSide != THT!
   BoardSide                 mBoardSide;
   FootprintPadGraphicsItem* mRegisteredGraphicsItem;
+
+  /// Cached outlines, keyed by expansion
+  ///
+  /// Like #mPainterPathPxCache, these (implicitly shared) paths are shared by
+  /// all board pads of the same footprint pad, which only need to apply
+  /// their own transformation.
+  mutable QHash<Length, Path> mOutlineCache;
+
+  /// Cached painter paths, keyed by expansion and whether the hole is included
+  ///
+  /// All board pads of the same footprint pad share these (implicitly shared)
+  /// paths, so they are built only once per library pad and expansion.
+  mutable QHash<QPair<Length, bool>, QPainterPath> mPainterPathPxCache;
 };
 
 /*******************************************************************************
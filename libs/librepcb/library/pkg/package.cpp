@@ -67,6 +67,15 @@ LibraryElementCheckMessageList Package::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Package::getMemoryUsage() const noexcept {
+  qint64 usage = LibraryElement::getMemoryUsage() + sizeof(Package) -
+                 sizeof(LibraryElement) + (mPads.count() * sizeof(PackagePad));
+  for (const Footprint& footprint : mFootprints) {
+    usage += footprint.getMemoryUsage();
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
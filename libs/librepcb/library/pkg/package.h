@@ -74,6 +74,7 @@ public:
 
   // General Methods
   virtual LibraryElementCheckMessageList runChecks() const override;
+  virtual qint64 getMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Package& operator=(const Package& rhs) = delete;
@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "padarraygenerator.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QVector<PadArrayGenerator::Pad> PadArrayGenerator::generateGrid(
+    int columns, int rows, const PositiveLength& pitchX,
+    const PositiveLength& pitchY, bool staggered) noexcept {
+  QVector<Pad> pads;
+  pads.reserve(qMax(columns * rows, 0));
+  for (int row = 0; row < rows; ++row) {
+    QString rowName = getGridRowName(row);
+    Length  y       = -getOffset(*pitchY, row, rows);  // first row at top
+    for (int column = 0; column < columns; ++column) {
+      if (staggered && ((row + column) % 2 != 0)) {
+        continue;
+      }
+      pads.append(Pad{rowName % QString::number(column + 1),
+                      Point(getOffset(*pitchX, column, columns), y),
+                      Angle::deg0()});
+    }
+  }
+  return pads;
+}
+
+QVector<PadArrayGenerator::Pad> PadArrayGenerator::generatePerimeter(
+    int padsX, int padsY, const PositiveLength& pitch,
+    const PositiveLength& spanX, const PositiveLength& spanY) noexcept {
+  QVector<Pad> pads;
+  pads.reserve(qMax(2 * (padsX + padsY), 0));
+  Length left   = -(*spanX / 2);
+  Length right  = *spanX / 2;
+  Length top    = *spanY / 2;
+  Length bottom = -(*spanY / 2);
+  for (int i = 0; i < padsY; ++i) {  // left side, top to bottom
+    pads.append(Pad{QString(), Point(left, -getOffset(*pitch, i, padsY)),
+                    Angle::deg0()});
+  }
+  for (int i = 0; i < padsX; ++i) {  // bottom side, left to right
+    pads.append(Pad{QString(), Point(getOffset(*pitch, i, padsX), bottom),
+                    Angle::deg90()});
+  }
+  for (int i = 0; i < padsY; ++i) {  // right side, bottom to top
+    pads.append(Pad{QString(), Point(right, getOffset(*pitch, i, padsY)),
+                    Angle::deg0()});
+  }
+  for (int i = 0; i < padsX; ++i) {  // top side, right to left
+    pads.append(Pad{QString(), Point(-getOffset(*pitch, i, padsX), top),
+                    Angle::deg90()});
+  }
+  for (int i = 0; i < pads.count(); ++i) {
+    pads[i].name = QString::number(i + 1);
+  }
+  return pads;
+}
+
+QString PadArrayGenerator::getGridRowName(int row) noexcept {
+  static const QString letters = "ABCDEFGHJKLMNPRTUVWY";
+  QString              name;
+  do {
+    name.prepend(letters.at(row % letters.length()));
+    row = (row / letters.length()) - 1;
+  } while (row >= 0);
+  return name;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+Length PadArrayGenerator::getOffset(const Length& pitch, int index,
+                                    int count) noexcept {
+  // offset of the element at the given index from the center of all elements
+  return Length((pitch.toNm() * ((2 * index) - (count - 1))) / 2);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
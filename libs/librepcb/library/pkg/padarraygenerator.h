@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_PADARRAYGENERATOR_H
+#define LIBREPCB_LIBRARY_PADARRAYGENERATOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/units/all_length_units.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Class PadArrayGenerator
+ ******************************************************************************/
+
+/**
+ * @brief Calculates names and positions of regular pad arrays
+ *
+ * Used to create all pads of packages like BGAs or QFPs at once instead of
+ * placing them one by one. The arrays are always centered at the origin.
+ */
+class PadArrayGenerator final {
+  Q_DECLARE_TR_FUNCTIONS(PadArrayGenerator)
+
+public:
+  // Types
+  struct Pad {
+    QString name;
+    Point   position;
+    Angle   rotation;
+  };
+
+  // Constructors / Destructor
+  PadArrayGenerator()                               = delete;
+  PadArrayGenerator(const PadArrayGenerator& other) = delete;
+  ~PadArrayGenerator()                              = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Generate a grid array (e.g. BGA)
+   *
+   * The rows are named with letters according to JEDEC (i.e. without I, O, Q,
+   * S, X and Z), starting with "A" at the top. The columns are numbered from
+   * left to right, starting with "1". So the top left pad is named "A1".
+   *
+   * @param columns   Number of columns
+   * @param rows      Number of rows
+   * @param pitchX    Horizontal distance between two columns
+   * @param pitchY    Vertical distance between two rows
+   * @param staggered If true, only every second pad of the grid is generated
+   *                  (starting with "A1"), like used for staggered BGAs
+   *
+   * @return All generated pads
+   */
+  static QVector<Pad> generateGrid(int columns, int rows,
+                                   const PositiveLength& pitchX,
+                                   const PositiveLength& pitchY,
+                                   bool                  staggered) noexcept;
+
+  /**
+   * @brief Generate pads around a rectangle (e.g. QFP, DIP)
+   *
+   * The pads are numbered counterclockwise, starting with "1" at the top of
+   * the left side. Pads on the top and bottom sides are rotated by 90°.
+   *
+   * @param padsX   Number of pads on the top and bottom side each
+   * @param padsY   Number of pads on the left and right side each
+   * @param pitch   Distance between two pads on the same side
+   * @param spanX   Horizontal distance between the left and right side
+   * @param spanY   Vertical distance between the top and bottom side
+   *
+   * @return All generated pads
+   */
+  static QVector<Pad> generatePerimeter(int padsX, int padsY,
+                                        const PositiveLength& pitch,
+                                        const PositiveLength& spanX,
+                                        const PositiveLength& spanY) noexcept;
+
+  /**
+   * @brief Get the name of a grid row according to JEDEC
+   *
+   * @param row   Zero-based row index
+   *
+   * @return Row name ("A", "B", ..., "Y", "AA", "AB", ...)
+   */
+  static QString getGridRowName(int row) noexcept;
+
+  // Operator Overloadings
+  PadArrayGenerator& operator=(const PadArrayGenerator& rhs) = delete;
+
+private:  // Methods
+  static Length getOffset(const Length& pitch, int index, int count) noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_PADARRAYGENERATOR_H
@@ -93,6 +93,17 @@ LibraryElementCheckMessageList Symbol::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Symbol::getMemoryUsage() const noexcept {
+  qint64 usage = LibraryElement::getMemoryUsage() + sizeof(Symbol) -
+                 sizeof(LibraryElement) + (mPins.count() * sizeof(SymbolPin)) +
+                 (mCircles.count() * sizeof(Circle)) +
+                 (mTexts.count() * sizeof(Text));
+  for (const Polygon& polygon : mPolygons) {
+    usage += polygon.getMemoryUsage();
+  }
+  return usage;
+}
+
 void Symbol::registerGraphicsItem(SymbolGraphicsItem& item) noexcept {
   Q_ASSERT(!mRegisteredGraphicsItem);
   mRegisteredGraphicsItem = &item;
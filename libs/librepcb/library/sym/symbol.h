@@ -89,6 +89,7 @@ public:
 
   // General Methods
   virtual LibraryElementCheckMessageList runChecks() const override;
+  virtual qint64 getMemoryUsage() const noexcept override;
   void registerGraphicsItem(SymbolGraphicsItem& item) noexcept;
   void unregisterGraphicsItem(SymbolGraphicsItem& item) noexcept;
 
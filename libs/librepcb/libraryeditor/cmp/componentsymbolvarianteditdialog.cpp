@@ -30,6 +30,7 @@
 #include <librepcb/common/norms.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/cmp/componentsymbolvariant.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/libraryelementcache.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/sym/symbolgraphicsitem.h>
@@ -59,7 +60,7 @@ ComponentSymbolVariantEditDialog::ComponentSymbolVariantEditDialog(
     mOriginalSymbVar(symbVar),
     mSymbVar(symbVar),
     mGraphicsScene(new GraphicsScene()),
-    mLibraryElementCache(new LibraryElementCache(ws.getLibraryDb())),
+    mLibraryElementCache(ws.getLibraryElementCache()),
     mUi(new Ui::ComponentSymbolVariantEditDialog) {
   mUi->setupUi(this);
   mUi->cbxNorm->addItems(getAvailableNorms());
@@ -115,8 +116,7 @@ void ComponentSymbolVariantEditDialog::updateGraphicsItems() noexcept {
       FilePath fp = mWorkspace.getLibraryDb().getLatestSymbol(
           item.getSymbolUuid());  // can throw
       std::shared_ptr<Symbol> sym = std::make_shared<Symbol>(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(fp))));  // can throw
+          Library::openElementDirectory(fp));  // can throw
       mSymbols.append(sym);
       std::shared_ptr<SymbolGraphicsItem> graphicsItem =
           std::make_shared<SymbolGraphicsItem>(*sym, *mGraphicsLayerProvider);
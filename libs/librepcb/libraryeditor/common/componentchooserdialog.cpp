@@ -27,6 +27,7 @@
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/library/cmp/component.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/sym/symbolpreviewgraphicsitem.h>
 #include <librepcb/workspace/library/cat/categorytreemodel.h>
@@ -209,8 +210,7 @@ void ComponentChooserDialog::updatePreview(const FilePath& fp) noexcept {
   if (fp.isValid() && mLayerProvider) {
     try {
       mComponent.reset(new Component(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(fp)))));  // can throw
+          Library::openElementDirectory(fp)));  // can throw
       if (mComponent && mComponent->getSymbolVariants().count() > 0) {
         const ComponentSymbolVariant& symbVar =
             *mComponent->getSymbolVariants().first();
@@ -220,9 +220,7 @@ void ComponentChooserDialog::updatePreview(const FilePath& fp) noexcept {
             FilePath fp = mWorkspace.getLibraryDb().getLatestSymbol(
                 item.getSymbolUuid());  // can throw
             std::shared_ptr<Symbol> sym = std::make_shared<Symbol>(
-                std::unique_ptr<TransactionalDirectory>(
-                    new TransactionalDirectory(
-                        TransactionalFileSystem::openRO(fp))));  // can throw
+                Library::openElementDirectory(fp));  // can throw
             mSymbols.append(sym);
             std::shared_ptr<SymbolPreviewGraphicsItem> graphicsItem =
                 std::make_shared<SymbolPreviewGraphicsItem>(
@@ -62,6 +62,10 @@ EditorWidgetBase::EditorWidgetBase(const Context& context, const FilePath& fp,
 
   mCommandToolBarProxy.reset(new ToolBarProxy());
 
+  mCheckMessagesTimer.setSingleShot(true);
+  connect(&mCheckMessagesTimer, &QTimer::timeout, this,
+          &EditorWidgetBase::updateCheckMessages);
+
   // Run checks, but delay it because the subclass is not loaded yet!
   scheduleLibraryElementChecks();
 }
@@ -213,11 +217,10 @@ void EditorWidgetBase::scheduleLibraryElementChecks() noexcept {
   // results. Instead, just delay checks for some time to get more stable
   // messages. But also don't wait too long, otherwise it would feel like a
   // lagging user interface.
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
-  QTimer::singleShot(50, this, &EditorWidgetBase::updateCheckMessages);
-#else
-  QTimer::singleShot(50, this, SLOT(updateCheckMessages()));
-#endif
+  // Restarting the timer makes sure that a burst of modifications (e.g. typing
+  // into a field) leads to only one check run after the last modification,
+  // instead of one run per modification.
+  mCheckMessagesTimer.start(50);
 }
 
 void EditorWidgetBase::updateCheckMessages() noexcept {
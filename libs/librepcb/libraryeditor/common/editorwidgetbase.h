@@ -168,6 +168,9 @@ protected:  // Data
   ExclusiveActionGroup*                    mToolsActionGroup;
   QScopedPointer<ToolBarProxy>             mCommandToolBarProxy;
   bool                                     mIsInterfaceBroken;
+
+private:  // Data
+  QTimer mCheckMessagesTimer;  ///< Debounces #scheduleLibraryElementChecks()
 };
 
 /*******************************************************************************
@@ -26,6 +26,7 @@
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/pkg/footprintpreviewgraphicsitem.h>
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/workspace/library/cat/categorytreemodel.h>
@@ -209,8 +210,7 @@ void PackageChooserDialog::updatePreview(const FilePath& fp) noexcept {
   if (fp.isValid() && mLayerProvider) {
     try {
       mPackage.reset(new Package(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(fp)))));  // can throw
+          Library::openElementDirectory(fp)));  // can throw
       if (mPackage->getFootprints().count() > 0) {
         mGraphicsItem.reset(new FootprintPreviewGraphicsItem(
             *mLayerProvider, QStringList(), *mPackage->getFootprints().first(),
@@ -26,6 +26,7 @@
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/sym/symbolgraphicsitem.h>
 #include <librepcb/workspace/library/cat/categorytreemodel.h>
@@ -207,8 +208,7 @@ void SymbolChooserDialog::setSelectedSymbol(const FilePath& fp) noexcept {
   if (fp.isValid()) {
     try {
       mSelectedSymbol.reset(new Symbol(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(fp)))));  // can throw
+          Library::openElementDirectory(fp)));  // can throw
       mUi->lblSymbolName->setText(
           *mSelectedSymbol->getNames().value(localeOrder()));
       mUi->lblSymbolDescription->setText(
@@ -34,6 +34,7 @@
 #include <librepcb/library/dev/cmd/cmddeviceedit.h>
 #include <librepcb/library/dev/cmd/cmddevicepadsignalmapitemedit.h>
 #include <librepcb/library/dev/device.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/msg/msgmissingauthor.h>
 #include <librepcb/library/msg/msgmissingcategories.h>
 #include <librepcb/library/msg/msgnamenottitlecase.h>
@@ -235,9 +236,7 @@ void DeviceEditorWidget::btnChooseComponentClicked() noexcept {
         if (!fp.isValid()) {
           throw RuntimeError(__FILE__, __LINE__, tr("Component not found!"));
         }
-        Component component(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(fp))));  // can throw
+        Component component(Library::openElementDirectory(fp));  // can throw
 
         // edit device
         QScopedPointer<UndoCommandGroup> cmdGroup(
@@ -275,9 +274,7 @@ void DeviceEditorWidget::btnChoosePackageClicked() noexcept {
         if (!fp.isValid()) {
           throw RuntimeError(__FILE__, __LINE__, tr("Package not found!"));
         }
-        Package package(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(fp))));  // can throw
+        Package package(Library::openElementDirectory(fp));  // can throw
         QSet<Uuid> pads = package.getPads().getUuidSet();
 
         // edit device
@@ -317,8 +314,7 @@ void DeviceEditorWidget::updateDeviceComponentUuid(const Uuid& uuid) noexcept {
       throw RuntimeError(__FILE__, __LINE__, tr("Component not found!"));
     }
     mComponent.reset(new Component(
-        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-            TransactionalFileSystem::openRO(fp)))));  // can throw
+        Library::openElementDirectory(fp)));  // can throw
     mUi->padSignalMapEditorWidget->setSignalList(mComponent->getSignals());
     mUi->lblComponentName->setText(
         *mComponent->getNames().value(getLibLocaleOrder()));
@@ -343,8 +339,7 @@ void DeviceEditorWidget::updateComponentPreview() noexcept {
         FilePath fp = mContext.workspace.getLibraryDb().getLatestSymbol(
             item.getSymbolUuid());  // can throw
         std::shared_ptr<Symbol> sym = std::make_shared<Symbol>(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(fp))));  // can throw
+            Library::openElementDirectory(fp));  // can throw
         mSymbols.append(sym);
         std::shared_ptr<SymbolPreviewGraphicsItem> graphicsItem =
             std::make_shared<SymbolPreviewGraphicsItem>(
@@ -371,8 +366,7 @@ void DeviceEditorWidget::updateDevicePackageUuid(const Uuid& uuid) noexcept {
       throw RuntimeError(__FILE__, __LINE__, tr("Package not found!"));
     }
     mPackage.reset(new Package(
-        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-            TransactionalFileSystem::openRO(fp)))));  // can throw
+        Library::openElementDirectory(fp)));  // can throw
     mUi->padSignalMapEditorWidget->setPadList(mPackage->getPads());
     mUi->lblPackageName->setText(
         *mPackage->getNames().value(getLibLocaleOrder()));
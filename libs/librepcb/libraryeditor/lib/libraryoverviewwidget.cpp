@@ -27,8 +27,10 @@
 
 #include <librepcb/common/dialogs/filedialog.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/library/cmd/cmdlibraryedit.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementthumbnailrenderer.h>
 #include <librepcb/library/msg/msgmissingauthor.h>
 #include <librepcb/library/msg/msgnamenottitlecase.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
@@ -52,7 +54,9 @@ namespace editor {
 LibraryOverviewWidget::LibraryOverviewWidget(const Context&  context,
                                              const FilePath& fp,
                                              QWidget*        parent) noexcept
-  : EditorWidgetBase(context, fp, parent), mUi(new Ui::LibraryOverviewWidget) {
+  : EditorWidgetBase(context, fp, parent),
+    mUi(new Ui::LibraryOverviewWidget),
+    mElementListsOutdated(false) {
   mUi->setupUi(this);
   mUi->lstMessages->setHandler(this);
   connect(mUi->btnIcon, &QPushButton::clicked, this,
@@ -120,7 +124,19 @@ LibraryOverviewWidget::LibraryOverviewWidget(const Context&  context,
   connect(mUi->lstDev, &QListWidget::customContextMenuRequested, this,
           &LibraryOverviewWidget::openContextMenuAtPos);
 
+  // Show thumbnails of symbols and packages, rendered in the background.
+  mThumbnailRenderer.reset(new LibraryElementThumbnailRenderer(
+      mContext.workspace.getMetadataPath().getPathTo("cache/thumbnails"),
+      QSize(64, 64)));
+  connect(mThumbnailRenderer.data(),
+          &LibraryElementThumbnailRenderer::thumbnailReady, this,
+          &LibraryOverviewWidget::thumbnailReady);
+  mUi->lstSym->setIconSize(QSize(32, 32));
+  mUi->lstPkg->setIconSize(QSize(32, 32));
+
   // Load all library elements.
+  connect(&mElementListsWatcher, &QFutureWatcherBase::finished, this,
+          &LibraryOverviewWidget::elementListsLoaded);
   updateElementLists();
   connect(&mContext.workspace.getLibraryDb(),
           &workspace::WorkspaceLibraryDb::scanFinished, this,
@@ -128,6 +144,7 @@ LibraryOverviewWidget::LibraryOverviewWidget(const Context&  context,
 }
 
 LibraryOverviewWidget::~LibraryOverviewWidget() noexcept {
+  mElementListsWatcher.waitForFinished();
 }
 
 /*******************************************************************************
@@ -261,38 +278,86 @@ bool LibraryOverviewWidget::processCheckMessage(
 }
 
 void LibraryOverviewWidget::updateElementLists() noexcept {
-  updateElementList<ComponentCategory>(*mUi->lstCmpCat,
-                                       QIcon(":/img/places/folder.png"));
-  updateElementList<PackageCategory>(*mUi->lstPkgCat,
-                                     QIcon(":/img/places/folder_green.png"));
-  updateElementList<Symbol>(*mUi->lstSym, QIcon(":/img/library/symbol.png"));
-  updateElementList<Package>(*mUi->lstPkg, QIcon(":/img/library/package.png"));
-  updateElementList<Component>(*mUi->lstCmp,
-                               QIcon(":/img/library/component.png"));
-  updateElementList<Device>(*mUi->lstDev, QIcon(":/img/library/device.png"));
+  // If a job is already running, its result might be outdated already. So
+  // load the lists again once it is finished.
+  if (mElementListsWatcher.isRunning()) {
+    mElementListsOutdated = true;
+    return;
+  }
+
+  // Only capture copies since the job runs in a worker thread.
+  const workspace::WorkspaceLibraryDb& db =
+      mContext.workspace.getLibraryDb();  // thread-safe
+  FilePath    libDir      = mLibrary->getDirectory().getAbsPath();
+  QStringList localeOrder = getLibLocaleOrder();
+  mElementListsOutdated   = false;
+  mElementListsWatcher.setFuture(TaskScheduler::run(
+      TaskScheduler::Priority::Interactive, [&db, libDir, localeOrder]() {
+        return QVector<ElementList>{
+            loadElementList<ComponentCategory>(db, libDir, localeOrder),
+            loadElementList<PackageCategory>(db, libDir, localeOrder),
+            loadElementList<Symbol>(db, libDir, localeOrder),
+            loadElementList<Package>(db, libDir, localeOrder),
+            loadElementList<Component>(db, libDir, localeOrder),
+            loadElementList<Device>(db, libDir, localeOrder),
+        };
+      }));
 }
 
-template <typename ElementType>
-void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
-                                              const QIcon& icon) noexcept {
-  QHash<FilePath, QString> elementNames;
+void LibraryOverviewWidget::elementListsLoaded() noexcept {
+  if (mElementListsOutdated) {
+    updateElementLists();
+    return;
+  }
+
+  QVector<ElementList> lists = mElementListsWatcher.result();
+  Q_ASSERT(lists.count() == 6);
+  updateElementList(*mUi->lstCmpCat, lists.at(0),
+                    QIcon(":/img/places/folder.png"));
+  updateElementList(*mUi->lstPkgCat, lists.at(1),
+                    QIcon(":/img/places/folder_green.png"));
+  updateElementList(*mUi->lstSym, lists.at(2),
+                    QIcon(":/img/library/symbol.png"));
+  updateElementList(*mUi->lstPkg, lists.at(3),
+                    QIcon(":/img/library/package.png"));
+  updateElementList(*mUi->lstCmp, lists.at(4),
+                    QIcon(":/img/library/component.png"));
+  updateElementList(*mUi->lstDev, lists.at(5),
+                    QIcon(":/img/library/device.png"));
+  updateThumbnails(*mUi->lstSym);
+  updateThumbnails(*mUi->lstPkg);
+}
 
+template <typename ElementType>
+LibraryOverviewWidget::ElementList LibraryOverviewWidget::loadElementList(
+    const workspace::WorkspaceLibraryDb& db, const FilePath& libDir,
+    const QStringList& localeOrder) noexcept {
+  ElementList list;
   try {
-    // get all library element names
+    // get all library elements with their names (only two queries in total)
     QList<FilePath> elements =
-        mContext.workspace.getLibraryDb().getLibraryElements<ElementType>(
-            mLibrary->getDirectory().getAbsPath());  // can throw
+        db.getLibraryElements<ElementType>(libDir);  // can throw
+    QHash<FilePath, QString> names =
+        db.getElementNames<ElementType>(elements, localeOrder);  // can throw
+    list.names.reserve(elements.count());
     foreach (const FilePath& filepath, elements) {
-      QString name;
-      mContext.workspace.getLibraryDb().getElementTranslations<ElementType>(
-          filepath, getLibLocaleOrder(), &name);  // can throw
-      elementNames.insert(filepath, name);
+      list.names.insert(filepath, names.value(filepath));
     }
   } catch (const Exception& e) {
+    list.names.clear();
+    list.error = e.getMsg();
+  }
+  return list;
+}
+
+void LibraryOverviewWidget::updateElementList(QListWidget&       listWidget,
+                                              const ElementList& elements,
+                                              const QIcon& icon) noexcept {
+  if (!elements.error.isEmpty()) {
     listWidget.clear();
     QListWidgetItem* item = new QListWidgetItem(&listWidget);
-    item->setText(e.getMsg());
-    item->setToolTip(e.getMsg());
+    item->setText(elements.error);
+    item->setToolTip(elements.error);
     item->setIcon(QIcon(":/img/status/dialog_error.png"));
     item->setBackground(Qt::red);
     item->setForeground(Qt::white);
@@ -300,28 +365,60 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
   }
 
   // update/remove existing list widget items
+  QHash<FilePath, QString> elementNames = elements.names;
   for (int i = listWidget.count() - 1; i >= 0; --i) {
     QListWidgetItem* item = listWidget.item(i);
     Q_ASSERT(item);
     FilePath filePath(item->data(Qt::UserRole).toString());
     if (elementNames.contains(filePath)) {
-      item->setText(elementNames.take(filePath));
+      QString name = elementNames.take(filePath);
+      if (item->text() != name) {
+        item->setText(name);
+        item->setToolTip(name);
+      }
     } else {
       delete item;
     }
   }
 
   // add new list widget items
-  foreach (const FilePath& fp, elementNames.keys()) {
-    QString          name = elementNames.value(fp);
+  for (auto it = elementNames.constBegin(); it != elementNames.constEnd();
+       ++it) {
     QListWidgetItem* item = new QListWidgetItem(&listWidget);
-    item->setText(name);
-    item->setToolTip(name);
-    item->setData(Qt::UserRole, fp.toStr());
+    item->setText(it.value());
+    item->setToolTip(it.value());
+    item->setData(Qt::UserRole, it.key().toStr());
     item->setIcon(icon);
   }
 }
 
+void LibraryOverviewWidget::updateThumbnails(QListWidget& listWidget) noexcept {
+  for (int i = 0; i < listWidget.count(); ++i) {
+    QListWidgetItem* item = listWidget.item(i);
+    Q_ASSERT(item);
+    FilePath fp(item->data(Qt::UserRole).toString());
+    if (!fp.isValid()) continue;
+    QImage image = mThumbnailRenderer->getThumbnail(fp);
+    if (!image.isNull()) {
+      item->setIcon(QIcon(QPixmap::fromImage(image)));
+    }
+  }
+}
+
+void LibraryOverviewWidget::thumbnailReady(const FilePath& fp,
+                                           const QImage&   image) noexcept {
+  if (image.isNull()) return;  // keep the current icon
+  for (QListWidget* list : {mUi->lstSym, mUi->lstPkg}) {
+    for (int i = 0; i < list->count(); ++i) {
+      QListWidgetItem* item = list->item(i);
+      Q_ASSERT(item);
+      if (FilePath(item->data(Qt::UserRole).toString()) == fp) {
+        item->setIcon(QIcon(QPixmap::fromImage(image)));
+      }
+    }
+  }
+}
+
 QHash<QListWidgetItem*, FilePath>
 LibraryOverviewWidget::getElementListItemFilePaths(
     const QList<QListWidgetItem*>& items) const noexcept {
@@ -32,9 +32,15 @@
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
+
+namespace workspace {
+class WorkspaceLibraryDb;
+}
+
 namespace library {
 
 class Library;
+class LibraryElementThumbnailRenderer;
 
 namespace editor {
 
@@ -93,6 +99,12 @@ signals:
   void duplicateDeviceTriggered(const FilePath& fp);
   void removeElementTriggered(const FilePath& fp);
 
+private:  // Types
+  struct ElementList {
+    QHash<FilePath, QString> names;  ///< All elements of a list by filepath
+    QString                  error;  ///< Empty if loaded successfully
+  };
+
 private:  // Methods
   void    updateMetadata() noexcept;
   QString commitMetadata() noexcept;
@@ -107,8 +119,15 @@ private:  // Methods
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
   void updateElementLists() noexcept;
+  void elementListsLoaded() noexcept;
   template <typename ElementType>
-  void updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept;
+  static ElementList loadElementList(const workspace::WorkspaceLibraryDb& db,
+                                     const FilePath&    libDir,
+                                     const QStringList& localeOrder) noexcept;
+  void updateElementList(QListWidget& listWidget, const ElementList& elements,
+                         const QIcon& icon) noexcept;
+  void updateThumbnails(QListWidget& listWidget) noexcept;
+  void thumbnailReady(const FilePath& fp, const QImage& image) noexcept;
   QHash<QListWidgetItem*, FilePath> getElementListItemFilePaths(
       const QList<QListWidgetItem*>& items) const noexcept;
   void openContextMenuAtPos(const QPoint& pos) noexcept;
@@ -123,10 +142,15 @@ private:  // Methods
   void lstDoubleClicked(const QModelIndex& index) noexcept;
 
 private:  // Data
-  QScopedPointer<Ui::LibraryOverviewWidget> mUi;
-  QScopedPointer<LibraryListEditorWidget>   mDependenciesEditorWidget;
-  QSharedPointer<Library>                   mLibrary;
-  QByteArray                                mIcon;
+  QScopedPointer<Ui::LibraryOverviewWidget>       mUi;
+  QScopedPointer<LibraryListEditorWidget>         mDependenciesEditorWidget;
+  QScopedPointer<LibraryElementThumbnailRenderer> mThumbnailRenderer;
+  QSharedPointer<Library>                         mLibrary;
+  QByteArray                                      mIcon;
+
+  // Element lists are loaded from the library database in a worker thread.
+  QFutureWatcher<QVector<ElementList>> mElementListsWatcher;
+  bool mElementListsOutdated;  ///< Reload as soon as the current job is done
 };
 
 /*******************************************************************************
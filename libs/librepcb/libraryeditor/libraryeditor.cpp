@@ -38,6 +38,7 @@
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/library/library.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
@@ -63,7 +64,8 @@ LibraryEditor::LibraryEditor(workspace::Workspace& ws, const FilePath& libFp,
     mIsOpenedReadOnly(readOnly),
     mUi(new Ui::LibraryEditor),
     mCurrentEditorWidget(nullptr),
-    mLibrary(nullptr) {
+    mLibrary(nullptr),
+    mLibraryElementCache(ws.getLibraryElementCache()) {
   mUi->setupUi(this);
   connect(mUi->actionClose, &QAction::triggered, this, &LibraryEditor::close);
   connect(mUi->actionNew, &QAction::triggered, this,
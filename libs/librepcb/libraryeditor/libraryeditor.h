@@ -51,6 +51,7 @@ class Workspace;
 namespace library {
 
 class Library;
+class LibraryElementCache;
 
 namespace editor {
 
@@ -188,6 +189,10 @@ private:  // Data
   QList<GraphicsLayer*>                mLayers;
   EditorWidgetBase*                    mCurrentEditorWidget;
   Library*                             mLibrary;
+
+  /// Keeps the workspace library element cache alive while the editor is
+  /// open (see librepcb::workspace::Workspace::getLibraryElementCache())
+  std::shared_ptr<LibraryElementCache> mLibraryElementCache;
 };
 
 /*******************************************************************************
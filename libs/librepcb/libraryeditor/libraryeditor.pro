@@ -10,7 +10,7 @@ TARGET = librepcblibraryeditor
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -53,8 +53,10 @@ SOURCES += \
     newelementwizard/newelementwizardpage_entermetadata.cpp \
     newelementwizard/newelementwizardpage_packagepads.cpp \
     pkg/dialogs/footprintpadpropertiesdialog.cpp \
+    pkg/dialogs/padarraydialog.cpp \
     pkg/footprintclipboarddata.cpp \
     pkg/footprintlisteditorwidget.cpp \
+    pkg/fsm/cmd/cmdaddfootprintpadarray.cpp \
     pkg/fsm/cmd/cmddragselectedfootprintitems.cpp \
     pkg/fsm/cmd/cmdpastefootprintitems.cpp \
     pkg/fsm/cmd/cmdremoveselectedfootprintitems.cpp \
@@ -133,8 +135,10 @@ HEADERS += \
     newelementwizard/newelementwizardpage_entermetadata.h \
     newelementwizard/newelementwizardpage_packagepads.h \
     pkg/dialogs/footprintpadpropertiesdialog.h \
+    pkg/dialogs/padarraydialog.h \
     pkg/footprintclipboarddata.h \
     pkg/footprintlisteditorwidget.h \
+    pkg/fsm/cmd/cmdaddfootprintpadarray.h \
     pkg/fsm/cmd/cmddragselectedfootprintitems.h \
     pkg/fsm/cmd/cmdpastefootprintitems.h \
     pkg/fsm/cmd/cmdremoveselectedfootprintitems.h \
@@ -202,6 +206,7 @@ FORMS += \
     newelementwizard/newelementwizardpage_entermetadata.ui \
     newelementwizard/newelementwizardpage_packagepads.ui \
     pkg/dialogs/footprintpadpropertiesdialog.ui \
+    pkg/dialogs/padarraydialog.ui \
     pkg/packageeditorwidget.ui \
     pkgcat/packagecategoryeditorwidget.ui \
     sym/dialogs/symbolpinpropertiesdialog.ui \
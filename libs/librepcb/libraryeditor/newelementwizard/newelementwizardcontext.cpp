@@ -102,8 +102,8 @@ void NewElementWizardContext::copyElement(ElementType     type,
                                           const FilePath& fp) {
   mElementType = type;
 
-  std::unique_ptr<TransactionalDirectory> dir(
-      new TransactionalDirectory(TransactionalFileSystem::openRO(fp)));
+  std::unique_ptr<TransactionalDirectory> dir =
+      Library::openElementDirectory(fp);
 
   QScopedPointer<LibraryBaseElement> element;
 
@@ -78,8 +78,7 @@ void NewElementWizardPage_ComponentPinSignalMap::initializePage() noexcept {
   mSymbolVariantList = mContext.mComponentSymbolVariants;
   mUi->pinSignalMapEditorWidget->setReferences(
       mSymbolVariantList.value(0).get(),
-      std::make_shared<LibraryElementCache>(
-          mContext.getWorkspace().getLibraryDb()),
+      mContext.getWorkspace().getLibraryElementCache(),
       &mContext.mComponentSignals, nullptr);
 }
 
@@ -26,6 +26,7 @@
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/library/cmp/component.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/workspace/workspace.h>
@@ -81,9 +82,7 @@ NewElementWizardPage_ComponentSignals::getPinNames(const Uuid&    symbol,
   try {
     FilePath fp = mContext.getWorkspace().getLibraryDb().getLatestSymbol(
         symbol);  // can throw
-    Symbol sym(
-        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-            TransactionalFileSystem::openRO(fp))));  // can throw
+    Symbol sym(Library::openElementDirectory(fp));  // can throw
     for (const SymbolPin& pin : sym.getPins()) {
       names.insert(pin.getUuid(),
                    CircuitIdentifier(suffix % pin.getName()));  // can throw
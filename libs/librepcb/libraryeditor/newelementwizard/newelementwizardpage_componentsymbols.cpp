@@ -85,8 +85,7 @@ void NewElementWizardPage_ComponentSymbols::initializePage() noexcept {
   mUi->symbolListEditorWidget->setReferences(
       mContext.getWorkspace(), mContext.getLayerProvider(),
       mSymbolVariantList.value(0)->getSymbolItems(),
-      std::make_shared<LibraryElementCache>(
-          mContext.getWorkspace().getLibraryDb()),
+      mContext.getWorkspace().getLibraryElementCache(),
       nullptr);
 }
 
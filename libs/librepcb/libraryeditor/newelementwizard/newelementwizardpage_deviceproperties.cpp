@@ -27,6 +27,7 @@
 #include "ui_newelementwizardpage_deviceproperties.h"
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/workspace/workspace.h>
@@ -125,9 +126,7 @@ void NewElementWizardPage_DeviceProperties::setPackage(
     try {
       FilePath fp = mContext.getWorkspace().getLibraryDb().getLatestPackage(
           *uuid);  // can throw
-      Package package(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(fp))));  // can throw
+      Package package(Library::openElementDirectory(fp));  // can throw
       DevicePadSignalMapHelpers::setPads(mContext.mDevicePadSignalMap,
                                          package.getPads().getUuidSet());
       mUi->lblPackageName->setText(
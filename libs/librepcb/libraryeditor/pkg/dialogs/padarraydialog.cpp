@@ -0,0 +1,169 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "padarraydialog.h"
+
+#include "../fsm/cmd/cmdaddfootprintpadarray.h"
+#include "ui_padarraydialog.h"
+
+#include <librepcb/common/undostack.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/package.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+PadArrayDialog::PadArrayDialog(Package& pkg, Footprint& fpt,
+                               const FootprintPad& templatePad,
+                               UndoStack& undoStack, QWidget* parent) noexcept
+  : QDialog(parent),
+    mPackage(pkg),
+    mFootprint(fpt),
+    mTemplatePad(templatePad),
+    mUndoStack(undoStack),
+    mUi(new Ui::PadArrayDialog) {
+  mUi->setupUi(this);
+  mUi->cbxLayout->addItem(tr("Grid"));
+  mUi->cbxLayout->addItem(tr("Staggered Grid"));
+  mUi->cbxLayout->addItem(tr("Perimeter"));
+  mUi->spbCountX->setValue(8);
+  mUi->spbCountY->setValue(8);
+  mUi->spbPitchX->setValue(1);
+  mUi->spbPitchY->setValue(1);
+  mUi->spbSpanX->setValue(10);
+  mUi->spbSpanY->setValue(10);
+  layoutChanged();
+
+  connect(mUi->cbxLayout,
+          static_cast<void (QComboBox::*)(int)>(
+              &QComboBox::currentIndexChanged),
+          this, &PadArrayDialog::layoutChanged);
+  connect(mUi->spbCountX,
+          static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), this,
+          &PadArrayDialog::updateInfo);
+  connect(mUi->spbCountY,
+          static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), this,
+          &PadArrayDialog::updateInfo);
+  for (QDoubleSpinBox* spinBox :
+       {mUi->spbPitchX, mUi->spbPitchY, mUi->spbSpanX, mUi->spbSpanY}) {
+    connect(spinBox,
+            static_cast<void (QDoubleSpinBox::*)(double)>(
+                &QDoubleSpinBox::valueChanged),
+            this, &PadArrayDialog::updateInfo);
+  }
+  connect(mUi->buttonBox, &QDialogButtonBox::accepted, this,
+          &PadArrayDialog::buttonBoxAccepted);
+  connect(mUi->buttonBox, &QDialogButtonBox::rejected, this,
+          &PadArrayDialog::reject);
+}
+
+PadArrayDialog::~PadArrayDialog() noexcept {
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void PadArrayDialog::layoutChanged() noexcept {
+  bool perimeter = (mUi->cbxLayout->currentIndex() == 2);
+  mUi->lblCount->setText(perimeter ? tr("Pads per Side (X/Y):")
+                                   : tr("Columns/Rows:"));
+  mUi->spbPitchY->setEnabled(!perimeter);
+  mUi->spbSpanX->setEnabled(perimeter);
+  mUi->spbSpanY->setEnabled(perimeter);
+  updateInfo();
+}
+
+void PadArrayDialog::updateInfo() noexcept {
+  QVector<PadArrayGenerator::Pad> pads;
+  try {
+    pads = generatePads();  // can throw
+  } catch (const Exception& e) {
+    mUi->lblInfo->setText(e.getMsg());
+    mUi->buttonBox->button(QDialogButtonBox::Ok)->setEnabled(false);
+    return;
+  }
+  if (pads.isEmpty()) {
+    mUi->lblInfo->setText(tr("No pads will be added."));
+  } else {
+    mUi->lblInfo->setText(tr("%1 pads will be added (%2 ... %3).")
+                              .arg(pads.count())
+                              .arg(pads.first().name)
+                              .arg(pads.last().name));
+  }
+  mUi->buttonBox->button(QDialogButtonBox::Ok)->setEnabled(!pads.isEmpty());
+}
+
+QVector<PadArrayGenerator::Pad> PadArrayDialog::generatePads() const {
+  PositiveLength pitchX(Length::fromMm(mUi->spbPitchX->value()));  // can throw
+  PositiveLength pitchY(Length::fromMm(mUi->spbPitchY->value()));  // can throw
+  PositiveLength spanX(Length::fromMm(mUi->spbSpanX->value()));    // can throw
+  PositiveLength spanY(Length::fromMm(mUi->spbSpanY->value()));    // can throw
+  switch (mUi->cbxLayout->currentIndex()) {
+    case 0:
+      return PadArrayGenerator::generateGrid(mUi->spbCountX->value(),
+                                             mUi->spbCountY->value(), pitchX,
+                                             pitchY, false);
+    case 1:
+      return PadArrayGenerator::generateGrid(mUi->spbCountX->value(),
+                                             mUi->spbCountY->value(), pitchX,
+                                             pitchY, true);
+    case 2:
+      return PadArrayGenerator::generatePerimeter(
+          mUi->spbCountX->value(), mUi->spbCountY->value(), pitchX, spanX,
+          spanY);
+    default:
+      Q_ASSERT(false);
+      return QVector<PadArrayGenerator::Pad>();
+  }
+}
+
+void PadArrayDialog::buttonBoxAccepted() noexcept {
+  try {
+    Point center = Point::fromMm(mUi->spbPosX->value(), mUi->spbPosY->value());
+    mUndoStack.execCmd(new CmdAddFootprintPadArray(
+        mPackage, mFootprint, generatePads(), mTemplatePad,
+        center));  // can throw
+    accept();
+  } catch (const Exception& e) {
+    QMessageBox::critical(this, tr("Error"), e.getMsg());
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_EDITOR_PADARRAYDIALOG_H
+#define LIBREPCB_LIBRARY_EDITOR_PADARRAYDIALOG_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/library/pkg/footprintpad.h>
+#include <librepcb/library/pkg/padarraygenerator.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class UndoStack;
+
+namespace library {
+
+class Package;
+class Footprint;
+
+namespace editor {
+
+namespace Ui {
+class PadArrayDialog;
+}
+
+/*******************************************************************************
+ *  Class PadArrayDialog
+ ******************************************************************************/
+
+/**
+ * @brief Dialog to add a whole array of pads (grid, staggered grid or
+ *        perimeter) to a footprint with a single undo command
+ *
+ * All pads get the shape, size, drill diameter and board side of the passed
+ * template pad.
+ */
+class PadArrayDialog final : public QDialog {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  PadArrayDialog()                            = delete;
+  PadArrayDialog(const PadArrayDialog& other) = delete;
+  PadArrayDialog(Package& pkg, Footprint& fpt, const FootprintPad& templatePad,
+                 UndoStack& undoStack, QWidget* parent = nullptr) noexcept;
+  ~PadArrayDialog() noexcept;
+
+  // Operator Overloadings
+  PadArrayDialog& operator=(const PadArrayDialog& rhs) = delete;
+
+private:  // Methods
+  void                            layoutChanged() noexcept;
+  void                            updateInfo() noexcept;
+  QVector<PadArrayGenerator::Pad> generatePads() const;
+  void                            buttonBoxAccepted() noexcept;
+
+private:  // Data
+  Package&                           mPackage;
+  Footprint&                         mFootprint;
+  FootprintPad                       mTemplatePad;
+  UndoStack&                         mUndoStack;
+  QScopedPointer<Ui::PadArrayDialog> mUi;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_EDITOR_PADARRAYDIALOG_H
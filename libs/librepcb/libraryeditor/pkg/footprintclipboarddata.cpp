@@ -74,17 +74,26 @@ std::unique_ptr<QMimeData> FootprintClipboardData::toMimeData(
     const IF_GraphicsLayerProvider& lp) {
   SExpression sexpr =
       serializeToDomElement("librepcb_clipboard_footprint");  // can throw
+  QByteArray content = sexpr.toByteArray();
 
   std::unique_ptr<QMimeData> data(new QMimeData());
   data->setImageData(generatePixmap(lp));
-  data->setData(getMimeType(), sexpr.toByteArray());
+  data->setData(getMimeType(), content);
+
+  // keep the DOM to avoid parsing the data again when pasting it in the same
+  // process
+  getLastCopiedData() = qMakePair(content, sexpr);
   return data;
 }
 
 std::unique_ptr<FootprintClipboardData> FootprintClipboardData::fromMimeData(
     const QMimeData* mime) {
   QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
-  if (!content.isNull()) {
+  const QPair<QByteArray, SExpression>& lastCopied = getLastCopiedData();
+  if ((!content.isNull()) && (content == lastCopied.first)) {
+    return std::unique_ptr<FootprintClipboardData>(
+        new FootprintClipboardData(lastCopied.second));  // can throw
+  } else if (!content.isNull()) {
     SExpression root = SExpression::parse(content, FilePath());
     return std::unique_ptr<FootprintClipboardData>(
         new FootprintClipboardData(root));  // can throw
@@ -133,6 +142,12 @@ QPixmap FootprintClipboardData::generatePixmap(
   return scene.toPixmap(300, Qt::black);
 }
 
+QPair<QByteArray, SExpression>&
+    FootprintClipboardData::getLastCopiedData() noexcept {
+  static QPair<QByteArray, SExpression> data;
+  return data;
+}
+
 QString FootprintClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.footprint; version=%1")
       .arg(qApp->applicationVersion());
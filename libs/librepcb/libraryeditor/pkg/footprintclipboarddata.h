@@ -102,6 +102,11 @@ private:  // Methods
   QPixmap        generatePixmap(const IF_GraphicsLayerProvider& lp) noexcept;
   static QString getMimeType() noexcept;
 
+  /**
+   * Returns the content and DOM of the last #toMimeData() call
+   */
+  static QPair<QByteArray, SExpression>& getLastCopiedData() noexcept;
+
 private:  // Data
   Uuid             mFootprintUuid;
   PackagePadList   mPackagePads;
@@ -0,0 +1,95 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "cmdaddfootprintpadarray.h"
+
+#include <librepcb/common/scopeguard.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/package.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+CmdAddFootprintPadArray::CmdAddFootprintPadArray(
+    Package& package, Footprint& footprint,
+    const QVector<PadArrayGenerator::Pad>& pads,
+    const FootprintPad& templatePad, const Point& posOffset) noexcept
+  : UndoCommandGroup(tr("Add Footprint Pad Array")),
+    mPackage(package),
+    mFootprint(footprint),
+    mPads(pads),
+    mTemplatePad(templatePad),
+    mPosOffset(posOffset) {
+}
+
+CmdAddFootprintPadArray::~CmdAddFootprintPadArray() noexcept {
+}
+
+/*******************************************************************************
+ *  Inherited from UndoCommand
+ ******************************************************************************/
+
+bool CmdAddFootprintPadArray::performExecute() {
+  // if an error occurs, undo all already executed child commands
+  auto undoScopeGuard = scopeGuard([&]() { performUndo(); });
+
+  foreach (const PadArrayGenerator::Pad& pad, mPads) {
+    CircuitIdentifier name(pad.name);  // can throw
+    std::shared_ptr<PackagePad> pkgPad = mPackage.getPads().find(*name);
+    if (!pkgPad) {
+      pkgPad = std::make_shared<PackagePad>(Uuid::createRandom(), name);
+      execNewChildCmd(new CmdPackagePadInsert(mPackage.getPads(), pkgPad));
+    } else if (mFootprint.getPads().contains(pkgPad->getUuid())) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("The footprint already contains a pad named \"%1\".")
+              .arg(*name));
+    }
+    std::shared_ptr<FootprintPad> fptPad = std::make_shared<FootprintPad>(
+        pkgPad->getUuid(), pad.position + mPosOffset,
+        mTemplatePad.getRotation() + pad.rotation, mTemplatePad.getShape(),
+        mTemplatePad.getWidth(), mTemplatePad.getHeight(),
+        mTemplatePad.getDrillDiameter(), mTemplatePad.getBoardSide());
+    execNewChildCmd(new CmdFootprintPadInsert(mFootprint.getPads(), fptPad));
+  }
+
+  undoScopeGuard.dismiss();  // no undo required
+  return getChildCount() > 0;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,89 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_EDITOR_CMDADDFOOTPRINTPADARRAY_H
+#define LIBREPCB_LIBRARY_EDITOR_CMDADDFOOTPRINTPADARRAY_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/undocommandgroup.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include <librepcb/library/pkg/padarraygenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+class Package;
+class Footprint;
+
+namespace editor {
+
+/*******************************************************************************
+ *  Class CmdAddFootprintPadArray
+ ******************************************************************************/
+
+/**
+ * @brief Adds many footprint pads (and their package pads) at once
+ *
+ * For each pad of the array, the package pad with the same name is used, or
+ * created if it does not exist yet. All pads are added within this single
+ * command, thus the package is modified (and checked) only once.
+ */
+class CmdAddFootprintPadArray final : public UndoCommandGroup {
+public:
+  // Constructors / Destructor
+  CmdAddFootprintPadArray()                                     = delete;
+  CmdAddFootprintPadArray(const CmdAddFootprintPadArray& other) = delete;
+  CmdAddFootprintPadArray(Package& package, Footprint& footprint,
+                          const QVector<PadArrayGenerator::Pad>& pads,
+                          const FootprintPad&                    templatePad,
+                          const Point& posOffset) noexcept;
+  ~CmdAddFootprintPadArray() noexcept;
+
+  // Operator Overloadings
+  CmdAddFootprintPadArray& operator=(const CmdAddFootprintPadArray& rhs) =
+      delete;
+
+protected:  // Methods
+  /// @copydoc UndoCommand::performExecute()
+  bool performExecute() override;
+
+private:  // Data
+  Package&                        mPackage;
+  Footprint&                      mFootprint;
+  QVector<PadArrayGenerator::Pad> mPads;
+  FootprintPad                    mTemplatePad;
+  Point                           mPosOffset;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_EDITOR_CMDADDFOOTPRINTPADARRAY_H
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "packageeditorstate_addpads.h"
 
+#include "../dialogs/padarraydialog.h"
 #include "../packageeditorwidget.h"
 #include "../widgets/boardsideselectorwidget.h"
 #include "../widgets/footprintpadshapeselectorwidget.h"
@@ -163,6 +164,16 @@ bool PackageEditorState_AddPads::entry() noexcept {
     mContext.commandToolBar.addWidget(std::move(drillDiameterSpinBox));
   }
 
+  // pad array
+  mContext.commandToolBar.addSeparator();
+  std::unique_ptr<QToolButton> padArrayButton(new QToolButton());
+  padArrayButton->setText(tr("Add Array..."));
+  padArrayButton->setToolTip(
+      tr("Add a grid or perimeter array of pads with the current properties"));
+  connect(padArrayButton.get(), &QToolButton::clicked, this,
+          &PackageEditorState_AddPads::padArrayButtonClicked);
+  mContext.commandToolBar.addWidget(std::move(padArrayButton));
+
   Point pos =
       mContext.graphicsView.mapGlobalPosToScenePos(QCursor::pos(), true, true);
   return startAddPad(pos);
@@ -352,6 +363,22 @@ void PackageEditorState_AddPads::drillDiameterSpinBoxValueChanged(
   }
 }
 
+void PackageEditorState_AddPads::padArrayButtonClicked() noexcept {
+  // the pad attached to the cursor must not be part of the array
+  if (mCurrentPad && (!abortAddPad())) {
+    return;
+  }
+
+  PadArrayDialog dialog(mContext.package, *mContext.currentFootprint, mLastPad,
+                        mContext.undoStack, &mContext.editorWidget);
+  dialog.exec();
+  mPackagePadComboBox->updatePads();
+
+  Point pos =
+      mContext.graphicsView.mapGlobalPosToScenePos(QCursor::pos(), true, true);
+  startAddPad(pos);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
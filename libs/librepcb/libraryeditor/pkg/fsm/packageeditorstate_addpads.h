@@ -92,6 +92,7 @@ private:  // Methods
   void widthSpinBoxValueChanged(double value) noexcept;
   void heightSpinBoxValueChanged(double value) noexcept;
   void drillDiameterSpinBoxValueChanged(double value) noexcept;
+  void padArrayButtonClicked() noexcept;
 
 private:  // Types / Data
   PadType                             mPadType;
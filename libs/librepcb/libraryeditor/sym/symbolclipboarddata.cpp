@@ -67,17 +67,26 @@ std::unique_ptr<QMimeData> SymbolClipboardData::toMimeData(
     const IF_GraphicsLayerProvider& lp) {
   SExpression sexpr =
       serializeToDomElement("librepcb_clipboard_symbol");  // can throw
+  QByteArray content = sexpr.toByteArray();
 
   std::unique_ptr<QMimeData> data(new QMimeData());
   data->setImageData(generatePixmap(lp));
-  data->setData(getMimeType(), sexpr.toByteArray());
+  data->setData(getMimeType(), content);
+
+  // keep the DOM to avoid parsing the data again when pasting it in the same
+  // process
+  getLastCopiedData() = qMakePair(content, sexpr);
   return data;
 }
 
 std::unique_ptr<SymbolClipboardData> SymbolClipboardData::fromMimeData(
     const QMimeData* mime) {
   QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
-  if (!content.isNull()) {
+  const QPair<QByteArray, SExpression>& lastCopied = getLastCopiedData();
+  if ((!content.isNull()) && (content == lastCopied.first)) {
+    return std::unique_ptr<SymbolClipboardData>(
+        new SymbolClipboardData(lastCopied.second));  // can throw
+  } else if (!content.isNull()) {
     SExpression root = SExpression::parse(content, FilePath());
     return std::unique_ptr<SymbolClipboardData>(
         new SymbolClipboardData(root));  // can throw
@@ -119,6 +128,12 @@ QPixmap SymbolClipboardData::generatePixmap(
   return scene.toPixmap(300);
 }
 
+QPair<QByteArray, SExpression>&
+    SymbolClipboardData::getLastCopiedData() noexcept {
+  static QPair<QByteArray, SExpression> data;
+  return data;
+}
+
 QString SymbolClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.symbol; version=%1")
       .arg(qApp->applicationVersion());
@@ -49,7 +49,10 @@ namespace manager {
  ******************************************************************************/
 
 AddLibraryWidget::AddLibraryWidget(workspace::Workspace& ws) noexcept
-  : QWidget(nullptr), mWorkspace(ws), mUi(new Ui::AddLibraryWidget) {
+  : QWidget(nullptr),
+    mWorkspace(ws),
+    mUi(new Ui::AddLibraryWidget),
+    mRunningRepoLibraryDownloads(0) {
   mUi->setupUi(this);
   connect(mUi->btnDownloadZip, &QPushButton::clicked, this,
           &AddLibraryWidget::downloadZippedLibraryButtonClicked);
@@ -362,6 +365,8 @@ void AddLibraryWidget::repositoryLibraryListReceived(
             &RepositoryLibraryListWidgetItem::setChecked);
     connect(widget, &RepositoryLibraryListWidgetItem::checkedChanged, this,
             &AddLibraryWidget::repoLibraryDownloadCheckedChanged);
+    connect(widget, &RepositoryLibraryListWidgetItem::downloadFinished, this,
+            &AddLibraryWidget::repoLibraryDownloadFinished);
     QListWidgetItem* item = new QListWidgetItem(mUi->lstRepoLibs);
     item->setSizeHint(widget->sizeHint());
     mUi->lstRepoLibs->setItemWidget(item, widget);
@@ -380,13 +385,19 @@ void AddLibraryWidget::clearRepositoryLibraryList() noexcept {
            mLibraryDownloadConnections) {
     disconnect(connection);
   }
+  mQueuedRepoLibraryDownloads.clear();
   for (int i = mUi->lstRepoLibs->count() - 1; i >= 0; i--) {
     QListWidgetItem* item = mUi->lstRepoLibs->item(i);
     Q_ASSERT(item);
-    delete mUi->lstRepoLibs->itemWidget(item);
+    delete mUi->lstRepoLibs->itemWidget(item);  // aborts running downloads
     delete item;
   }
   Q_ASSERT(mUi->lstRepoLibs->count() == 0);
+  if (mRunningRepoLibraryDownloads > 0) {
+    // index the libraries which have been downloaded so far
+    mRunningRepoLibraryDownloads = 0;
+    mWorkspace.getLibraryDb().startLibraryRescan();
+  }
 }
 
 void AddLibraryWidget::repoLibraryDownloadCheckedChanged(
@@ -444,11 +455,35 @@ void AddLibraryWidget::downloadLibrariesFromRepositoryButtonClicked() noexcept {
     auto* widget = dynamic_cast<RepositoryLibraryListWidgetItem*>(
         mUi->lstRepoLibs->itemWidget(item));
     if (widget) {
-      widget->startDownloadIfSelected();
+      if (!mQueuedRepoLibraryDownloads.contains(widget)) {
+        mQueuedRepoLibraryDownloads.append(widget);
+      }
     } else {
       qWarning() << "Invalid item widget detected.";
     }
   }
+  startQueuedRepoLibraryDownloads();
+}
+
+void AddLibraryWidget::startQueuedRepoLibraryDownloads() noexcept {
+  while ((mRunningRepoLibraryDownloads < maxConcurrentDownloads()) &&
+         (!mQueuedRepoLibraryDownloads.isEmpty())) {
+    RepositoryLibraryListWidgetItem* widget =
+        mQueuedRepoLibraryDownloads.takeFirst();
+    if (widget->startDownloadIfSelected()) {
+      ++mRunningRepoLibraryDownloads;
+    }
+  }
+}
+
+void AddLibraryWidget::repoLibraryDownloadFinished() noexcept {
+  Q_ASSERT(mRunningRepoLibraryDownloads > 0);
+  --mRunningRepoLibraryDownloads;
+  startQueuedRepoLibraryDownloads();
+  if (mRunningRepoLibraryDownloads == 0) {
+    // all libraries downloaded -> index them with a single library scan
+    mWorkspace.getLibraryDb().startLibraryRescan();
+  }
 }
 
 /*******************************************************************************
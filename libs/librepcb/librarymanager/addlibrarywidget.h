@@ -42,6 +42,7 @@ namespace library {
 namespace manager {
 
 class LibraryDownload;
+class RepositoryLibraryListWidgetItem;
 
 namespace Ui {
 class AddLibraryWidget;
@@ -84,15 +85,29 @@ private:  // Methods
   void clearRepositoryLibraryList() noexcept;
   void repoLibraryDownloadCheckedChanged(bool checked) noexcept;
   void downloadLibrariesFromRepositoryButtonClicked() noexcept;
+  void startQueuedRepoLibraryDownloads() noexcept;
+  void repoLibraryDownloadFinished() noexcept;
 
   static QString getTextOrPlaceholderFromQLineEdit(QLineEdit* edit,
                                                    bool isFilename) noexcept;
 
+  /**
+   * Returns the maximum number of libraries downloaded at the same time.
+   * Starting all downloads at once would saturate the network connection and
+   * it would take very long until the first library is ready.
+   */
+  static int maxConcurrentDownloads() noexcept { return 4; }
+
 private:  // Data
   workspace::Workspace&                mWorkspace;
   QScopedPointer<Ui::AddLibraryWidget> mUi;
   QScopedPointer<LibraryDownload>      mManualLibraryDownload;
   QList<QMetaObject::Connection>       mLibraryDownloadConnections;
+
+  // Repository library downloads (the library rescan is started when the
+  // number of running downloads drops to zero)
+  QList<RepositoryLibraryListWidgetItem*> mQueuedRepoLibraryDownloads;
+  int                                     mRunningRepoLibraryDownloads;
 };
 
 /*******************************************************************************
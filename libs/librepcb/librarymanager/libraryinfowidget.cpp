@@ -58,9 +58,7 @@ LibraryInfoWidget::LibraryInfoWidget(workspace::Workspace& ws,
           &LibraryInfoWidget::btnRemoveLibraryClicked);
 
   // try to load the library
-  Library lib(
-      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-          TransactionalFileSystem::openRO(mLibDir))));  // can throw
+  Library lib(Library::openElementDirectory(mLibDir));  // can throw
 
   const QStringList& localeOrder =
       ws.getSettings().getLibLocaleOrder().getLocaleOrder();
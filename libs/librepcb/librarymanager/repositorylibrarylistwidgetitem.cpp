@@ -115,7 +115,7 @@ void RepositoryLibraryListWidgetItem::setChecked(bool checked) noexcept {
  *  General Methods
  ******************************************************************************/
 
-void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
+bool RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
   if (mUuid && mUi->cbxDownload->isVisible() && mUi->cbxDownload->isChecked() &&
       (!mLibraryDownload)) {
     mUi->cbxDownload->setVisible(false);
@@ -144,9 +144,12 @@ void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
     connect(mLibraryDownload.data(), &LibraryDownload::progressPercent,
             mUi->prgProgress, &QProgressBar::setValue, Qt::QueuedConnection);
     connect(mLibraryDownload.data(), &LibraryDownload::finished, this,
-            &RepositoryLibraryListWidgetItem::downloadFinished,
+            &RepositoryLibraryListWidgetItem::libraryDownloadFinished,
             Qt::QueuedConnection);
     mLibraryDownload->start();
+    return true;
+  } else {
+    return false;
   }
 }
 
@@ -154,7 +157,7 @@ void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
  *  Private Methods
  ******************************************************************************/
 
-void RepositoryLibraryListWidgetItem::downloadFinished(
+void RepositoryLibraryListWidgetItem::libraryDownloadFinished(
     bool success, const QString& errMsg) noexcept {
   Q_ASSERT(mLibraryDownload);
 
@@ -171,8 +174,9 @@ void RepositoryLibraryListWidgetItem::downloadFinished(
   // delete download helper
   mLibraryDownload.reset();
 
-  // start library scanner to index the new library
-  mWorkspace.getLibraryDb().startLibraryRescan();
+  // Note: The library scanner to index the new library is started by the
+  // AddLibraryWidget once all libraries are downloaded.
+  emit downloadFinished();
 }
 
 void RepositoryLibraryListWidgetItem::iconReceived(
@@ -77,7 +77,15 @@ public:
   void setChecked(bool checked) noexcept;
 
   // General Methods
-  void startDownloadIfSelected() noexcept;
+
+  /**
+   * @brief Start downloading the library if it is checked
+   *
+   * @retval true   If the download was started (#downloadFinished() will be
+   *                emitted when it is finished)
+   * @retval false  If the library is not checked or already downloading
+   */
+  bool startDownloadIfSelected() noexcept;
 
   // Operator Overloadings
   RepositoryLibraryListWidgetItem& operator       =(
@@ -85,9 +93,10 @@ public:
 
 signals:
   void checkedChanged(bool checked);
+  void downloadFinished();
 
 private:  // Methods
-  void downloadFinished(bool success, const QString& errMsg) noexcept;
+  void libraryDownloadFinished(bool success, const QString& errMsg) noexcept;
   void iconReceived(const QByteArray& data) noexcept;
   void updateInstalledStatus() noexcept;
 
@@ -28,11 +28,20 @@
 #include "../erc/ercmsg.h"
 #include "../project.h"
 #include "boardairwiresbuilder.h"
+#include "boarddesignrulecheck.h"
 #include "boardfabricationoutputsettings.h"
 #include "boardlayerstack.h"
+#include "boardplanefragmentsbuilder.h"
 #include "boardselectionquery.h"
+#include "boardspatialindex.h"
 #include "boardusersettings.h"
-#include "items/bi_airwire.h"
+#include "graphicsitems/bgi_airwires.h"
+#include "graphicsitems/bgi_footprint.h"
+#include "graphicsitems/bgi_footprintpad.h"
+#include "graphicsitems/bgi_netline.h"
+#include "graphicsitems/bgi_netpoint.h"
+#include "graphicsitems/bgi_plane.h"
+#include "graphicsitems/bgi_via.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
 #include "items/bi_footprintpad.h"
@@ -47,12 +56,17 @@
 
 #include <librepcb/common/application.h>
 #include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/geometry/polygon.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/utils/performancecounters.h>
+#include <librepcb/common/utils/profiler.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/pkg/footprint.h>
 
@@ -67,6 +81,17 @@
 namespace librepcb {
 namespace project {
 
+/*******************************************************************************
+ *  Struct PlaneRebuildTask
+ ******************************************************************************/
+
+struct Board::PlaneRebuildTask {
+  int                                         level;
+  BoardPlaneFragmentsBuilder::Snapshot        snapshot;
+  std::shared_ptr<BoardPlaneFragmentsBuilder> builder;
+  QByteArray                                  fingerprint;
+};
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -78,11 +103,25 @@ Board::Board(const Board&                            other,
     mProject(other.getProject()),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(true),
     mUuid(Uuid::createRandom()),
     mName(name),
     mDefaultFontFileName(other.mDefaultFontFileName) {
+  if (!other.isLoaded()) {
+    throw LogicError(__FILE__, __LINE__, "Board is not loaded.");
+  }
+
   try {
     mGraphicsScene.reset(new GraphicsScene());
+    mGraphicsScene->setCullingEnabled(isSceneCullingEnabled());
+    mDesignRuleCheck.reset(new BoardDesignRuleCheck());
+    mBoardAreaCache.reset(new BoardAreaCache());
+    connect(&mPlanesRebuildWatcher, &QFutureWatcherBase::finished, this,
+            &Board::planesRebuildFinished);
+    mAirWiresRebuildTimer.setSingleShot(true);
+    mAirWiresRebuildTimer.setInterval(0);
+    connect(&mAirWiresRebuildTimer, &QTimer::timeout, this,
+            &Board::triggerAirWiresRebuild);
 
     // copy layer stack
     mLayerStack.reset(new BoardLayerStack(*this, *other.mLayerStack));
@@ -100,22 +139,24 @@ Board::Board(const Board&                            other,
     // copy user settings
     mUserSettings.reset(new BoardUserSettings(*this, *other.mUserSettings));
 
-    // copy device instances
-    QHash<const BI_Device*, BI_Device*> copiedDeviceInstances;
+    // copy device instances (and remember their pads for the netsegments)
+    QHash<const BI_NetLineAnchor*, BI_NetLineAnchor*> copiedPads;
     foreach (const BI_Device* device, other.mDeviceInstances) {
       BI_Device* copy = new BI_Device(*this, *device);
       Q_ASSERT(
           !getDeviceInstanceByComponentUuid(copy->getComponentInstanceUuid()));
       mDeviceInstances.insert(copy->getComponentInstanceUuid(), copy);
-      copiedDeviceInstances.insert(device, copy);
+      foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+        copiedPads.insert(pad,
+                          copy->getFootprint().getPad(pad->getLibPadUuid()));
+      }
     }
 
-    // copy netsegments
+    // copy netsegments (they get new random UUIDs, so no need to check for
+    // duplicates)
+    mNetSegments.reserve(other.mNetSegments.count());
     foreach (const BI_NetSegment* netsegment, other.mNetSegments) {
-      BI_NetSegment* copy =
-          new BI_NetSegment(*this, *netsegment, copiedDeviceInstances);
-      Q_ASSERT(!getNetSegmentByUuid(copy->getUuid()));
-      mNetSegments.append(copy);
+      mNetSegments.append(new BI_NetSegment(*this, *netsegment, copiedPads));
     }
 
     // copy planes
@@ -159,8 +200,6 @@ Board::Board(const Board&                            other,
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
     mErcMsgListUnplacedComponentInstances.clear();
-    qDeleteAll(mAirWires);
-    mAirWires.clear();
     qDeleteAll(mHoles);
     mHoles.clear();
     qDeleteAll(mStrokeTexts);
@@ -185,15 +224,25 @@ Board::Board(const Board&                            other,
 
 Board::Board(Project&                                project,
              std::unique_ptr<TransactionalDirectory> directory, bool create,
-             const QString& newName)
+             const QString& newName, const SExpression* root, bool lazy)
   : QObject(&project),
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(create),
     mUuid(Uuid::createRandom()),
     mName("New Board") {
   try {
     mGraphicsScene.reset(new GraphicsScene());
+    mGraphicsScene->setCullingEnabled(isSceneCullingEnabled());
+    mDesignRuleCheck.reset(new BoardDesignRuleCheck());
+    mBoardAreaCache.reset(new BoardAreaCache());
+    connect(&mPlanesRebuildWatcher, &QFutureWatcherBase::finished, this,
+            &Board::planesRebuildFinished);
+    mAirWiresRebuildTimer.setSingleShot(true);
+    mAirWiresRebuildTimer.setInterval(0);
+    connect(&mAirWiresRebuildTimer, &QTimer::timeout, this,
+            &Board::triggerAirWiresRebuild);
 
     // try to open/create the board file
     if (create) {
@@ -226,34 +275,33 @@ Board::Board(Project&                                project,
                       Path::rect(Point(0, 0), Point(100000000, 80000000)));
       mPolygons.append(new BI_Polygon(*this, polygon));
     } else {
-      SExpression root = SExpression::parse(
-          mDirectory->read(getFilePath().getFilename()), getFilePath());
+      Q_ASSERT(root);
 
       // the board seems to be ready to open, so we will create all needed
       // objects
 
-      mUuid = root.getChildByIndex(0).getValue<Uuid>();
-      mName = root.getValueByPath<ElementName>("name");
-      if (const SExpression* child = root.tryGetChildByPath("default_font")) {
+      mUuid = root->getChildByIndex(0).getValue<Uuid>();
+      mName = root->getValueByPath<ElementName>("name");
+      if (const SExpression* child = root->tryGetChildByPath("default_font")) {
         mDefaultFontFileName = child->getValueOfFirstChild<QString>(true);
       } else {
         mDefaultFontFileName = qApp->getDefaultStrokeFontName();
       }
 
       // Load grid properties
-      mGridProperties.reset(new GridProperties(root.getChildByPath("grid")));
+      mGridProperties.reset(new GridProperties(root->getChildByPath("grid")));
 
       // Load layer stack
       mLayerStack.reset(
-          new BoardLayerStack(*this, root.getChildByPath("layers")));
+          new BoardLayerStack(*this, root->getChildByPath("layers")));
 
       // load design rules
       mDesignRules.reset(
-          new BoardDesignRules(root.getChildByPath("design_rules")));
+          new BoardDesignRules(root->getChildByPath("design_rules")));
 
       // load fabrication output settings
       mFabricationOutputSettings.reset(new BoardFabricationOutputSettings(
-          root.getChildByPath("fabrication_output_settings")));
+          root->getChildByPath("fabrication_output_settings")));
 
       // load user settings
       try {
@@ -272,58 +320,15 @@ Board::Board(Project&                                project,
         mUserSettings.reset(new BoardUserSettings(*this));
       }
 
-      // Load all device instances
-      foreach (const SExpression& node, root.getChildren("device")) {
-        BI_Device* device = new BI_Device(*this, node);
-        if (getDeviceInstanceByComponentUuid(
-                device->getComponentInstanceUuid())) {
-          throw RuntimeError(
-              __FILE__, __LINE__,
-              QString(tr("There is already a device of the component instance "
-                         "\"%1\"!"))
-                  .arg(device->getComponentInstanceUuid().toStr()));
-        }
-        mDeviceInstances.insert(device->getComponentInstanceUuid(), device);
-      }
-
-      // Load all netsegments
-      foreach (const SExpression& node, root.getChildren("netsegment")) {
-        BI_NetSegment* netsegment = new BI_NetSegment(*this, node);
-        if (getNetSegmentByUuid(netsegment->getUuid())) {
-          throw RuntimeError(
-              __FILE__, __LINE__,
-              QString(tr("There is already a netsegment with the UUID \"%1\"!"))
-                  .arg(netsegment->getUuid().toStr()));
-        }
-        mNetSegments.append(netsegment);
-      }
-
-      // Load all planes
-      foreach (const SExpression& node, root.getChildren("plane")) {
-        BI_Plane* plane = new BI_Plane(*this, node);
-        mPlanes.append(plane);
-      }
-
-      // Load all polygons
-      foreach (const SExpression& node, root.getChildren("polygon")) {
-        BI_Polygon* polygon = new BI_Polygon(*this, node);
-        mPolygons.append(polygon);
-      }
-
-      // Load all stroke texts
-      foreach (const SExpression& node, root.getChildren("stroke_text")) {
-        BI_StrokeText* text = new BI_StrokeText(*this, node);
-        mStrokeTexts.append(text);
-      }
-
-      // Load all holes
-      foreach (const SExpression& node, root.getChildren("hole")) {
-        BI_Hole* hole = new BI_Hole(*this, node);
-        mHoles.append(hole);
+      // Load all items, or defer it until the board is actually needed
+      if (lazy) {
+        mUnloadedContent.reset(new SExpression(*root));
+      } else {
+        loadItems(*root);  // can throw
       }
     }
 
-    rebuildAllPlanes();
+    rebuildAllPlanesFromCache();
     updateErcMessages();
     updateIcon();
 
@@ -339,8 +344,6 @@ Board::Board(Project&                                project,
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
     mErcMsgListUnplacedComponentInstances.clear();
-    qDeleteAll(mAirWires);
-    mAirWires.clear();
     qDeleteAll(mHoles);
     mHoles.clear();
     qDeleteAll(mStrokeTexts);
@@ -366,11 +369,15 @@ Board::Board(Project&                                project,
 Board::~Board() noexcept {
   Q_ASSERT(!mIsAddedToProject);
 
+  // the planes rebuild does not access the board, but don't leave it running
+  cancelPlanesRebuild();
+  mPlanesRebuildWatcher.waitForFinished();
+
   qDeleteAll(mErcMsgListUnplacedComponentInstances);
   mErcMsgListUnplacedComponentInstances.clear();
 
   // delete all items
-  qDeleteAll(mAirWires);
+  mAirWiresGraphicsItem.reset();
   mAirWires.clear();
   qDeleteAll(mHoles);
   mHoles.clear();
@@ -401,14 +408,82 @@ FilePath Board::getFilePath() const noexcept {
   return mDirectory->getAbsPath("board.lp");
 }
 
+bool Board::isHeadless() const noexcept {
+  return mProject.isHeadless();
+}
+
 bool Board::isEmpty() const noexcept {
   return (mDeviceInstances.isEmpty() && mNetSegments.isEmpty() &&
           mPlanes.isEmpty() && mPolygons.isEmpty() && mStrokeTexts.isEmpty() &&
           mHoles.isEmpty());
 }
 
+qint64 Board::getMemoryUsage() const noexcept {
+  qint64 usage = sizeof(Board) + sizeof(GraphicsScene) +
+      sizeof(BoardLayerStack) + sizeof(GridProperties) +
+      sizeof(BoardDesignRules) + sizeof(BoardFabricationOutputSettings) +
+      sizeof(BoardUserSettings) + sizeof(BoardDesignRuleCheck) +
+      mItemsByGraphicsItem.count() * 2 * sizeof(void*);
+  foreach (const BI_Device* device, mDeviceInstances) {
+    const BI_Footprint& footprint = device->getFootprint();
+    usage += sizeof(BI_Device) + sizeof(BI_Footprint) + sizeof(BGI_Footprint);
+    usage += footprint.getPads().count() *
+        (sizeof(BI_FootprintPad) + sizeof(BGI_FootprintPad));
+    foreach (const BI_StrokeText* text, footprint.getStrokeTexts()) {
+      usage += sizeof(BI_StrokeText) + text->getText().getMemoryUsage();
+    }
+  }
+  foreach (const BI_NetSegment* netsegment, mNetSegments) {
+    usage += sizeof(BI_NetSegment);
+    usage += netsegment->getVias().count() * (sizeof(BI_Via) + sizeof(BGI_Via));
+    usage += netsegment->getNetPoints().count() *
+        (sizeof(BI_NetPoint) + sizeof(BGI_NetPoint));
+    usage += netsegment->getNetLines().count() *
+        (sizeof(BI_NetLine) + sizeof(BGI_NetLine));
+  }
+  foreach (const BI_Plane* plane, mPlanes) {
+    usage += sizeof(BI_Plane) + sizeof(BGI_Plane);
+    usage += plane->getOutline().getMemoryUsage();
+    foreach (const Path& fragment, plane->getFragments()) {
+      // The graphics item holds a painter path of roughly the same size.
+      usage += 2 * fragment.getMemoryUsage();
+    }
+  }
+  foreach (const BI_Polygon* polygon, mPolygons) {
+    usage += sizeof(BI_Polygon) + polygon->getPolygon().getMemoryUsage();
+  }
+  foreach (const BI_StrokeText* text, mStrokeTexts) {
+    usage += sizeof(BI_StrokeText) + text->getText().getMemoryUsage();
+  }
+  usage += mHoles.count() * (sizeof(BI_Hole) + sizeof(Hole));
+  foreach (const auto& airWires, mAirWires) {
+    // The graphics item holds a line of roughly the same size per airwire.
+    usage += airWires.capacity() * (sizeof(QPair<Point, Point>) +
+                                    sizeof(QLineF));
+  }
+  if (mAirWiresGraphicsItem) {
+    usage += sizeof(BGI_AirWires);
+  }
+  return usage;
+}
+
+QList<QGraphicsItem*> Board::getGraphicsItemsOf(
+    const QSet<BI_Base*>& items) const noexcept {
+  QList<QGraphicsItem*> graphicsItems;
+  for (auto it = mItemsByGraphicsItem.constBegin();
+       it != mItemsByGraphicsItem.constEnd(); ++it) {
+    if (items.contains(it.value())) {
+      // Note: The keys are only const to look them up by const references,
+      // the graphics items themselves are owned by the (non-const) items.
+      graphicsItems.append(const_cast<QGraphicsItem*>(it.key()));
+    }
+  }
+  return graphicsItems;
+}
+
 QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
-  QPointF scenePosPx = pos.toPxQPointF();
+  QPointF         scenePosPx = pos.toPxQPointF();
+  QList<BI_Base*> candidates = getItemCandidatesAtScenePos(pos);
   QList<BI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
@@ -424,29 +499,25 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
     list.append(netline);
   }
   // footprints & pads
-  foreach (BI_Device* device, mDeviceInstances) {
-    BI_Footprint& footprint = device->getFootprint();
-    if (footprint.isSelectable() &&
-        footprint.getGrabAreaScenePx().contains(scenePosPx)) {
-      if (footprint.getIsMirrored()) {
-        list.append(&footprint);
+  foreach (BI_Base* item, candidates) {
+    if ((!item->isSelectable()) || (!item->isInGrabAreaScenePx(scenePosPx))) {
+      continue;
+    }
+    if (item->getType() == BI_Base::Type_t::Footprint) {
+      if (item->getIsMirrored()) {
+        list.append(item);
       } else {
-        list.prepend(&footprint);
+        list.prepend(item);
       }
-    }
-    foreach (BI_FootprintPad* pad, footprint.getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(scenePosPx)) {
-        if (pad->getIsMirrored()) {
-          list.append(pad);
-        } else {
-          list.insert(1, pad);
-        }
+    } else if (item->getType() == BI_Base::Type_t::FootprintPad) {
+      if (item->getIsMirrored()) {
+        list.append(item);
+      } else {
+        list.insert(1, item);
       }
-    }
-    foreach (BI_StrokeText* text, device->getFootprint().getStrokeTexts()) {
-      if (text->isSelectable() &&
-          text->getGrabAreaScenePx().contains(scenePosPx)) {
+    } else if (item->getType() == BI_Base::Type_t::StrokeText) {
+      BI_StrokeText* text = static_cast<BI_StrokeText*>(item);
+      if (text->getFootprint()) {
         if (GraphicsLayer::isTopLayer(*text->getText().getLayerName())) {
           list.prepend(text);
         } else {
@@ -455,32 +526,21 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
       }
     }
   }
-  // planes
-  foreach (BI_Plane* planes, mPlanes) {
-    if (planes->isSelectable() &&
-        planes->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(planes);
-    }
-  }
-  // polygons
-  foreach (BI_Polygon* polygon, mPolygons) {
-    if (polygon->isSelectable() &&
-        polygon->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(polygon);
-    }
-  }
-  // texts
-  foreach (BI_StrokeText* text, mStrokeTexts) {
-    if (text->isSelectable() &&
-        text->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(text);
-    }
-  }
-  // holes
-  foreach (BI_Hole* hole, mHoles) {
-    if (hole->isSelectable() &&
-        hole->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(hole);
+  // planes, polygons, texts, holes
+  QList<BI_Base::Type_t> types = {BI_Base::Type_t::Plane,
+                                  BI_Base::Type_t::Polygon,
+                                  BI_Base::Type_t::StrokeText,
+                                  BI_Base::Type_t::Hole};
+  foreach (BI_Base::Type_t type, types) {
+    foreach (BI_Base* item, candidates) {
+      if ((item->getType() == type) && item->isSelectable() &&
+          item->isInGrabAreaScenePx(scenePosPx)) {
+        if ((type == BI_Base::Type_t::StrokeText) &&
+            static_cast<BI_StrokeText*>(item)->getFootprint()) {
+          continue;  // already added above
+        }
+        list.append(item);
+      }
     }
   }
   return list;
@@ -490,9 +550,13 @@ QList<BI_Via*> Board::getViasAtScenePos(const Point&     pos,
                                         const NetSignal* netsignal) const
     noexcept {
   QList<BI_Via*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getViasAtScenePos(pos, list);
+  foreach (BI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if (item->getType() != BI_Base::Type_t::Via) continue;
+    BI_Via* via = static_cast<BI_Via*>(item);
+    if (via->isSelectable() &&
+        via->isInGrabAreaScenePx(pos.toPxQPointF()) &&
+        ((!netsignal) || (&via->getNetSignalOfNetSegment() == netsignal))) {
+      list.append(via);
     }
   }
   return list;
@@ -502,9 +566,15 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_NetPoint*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getNetPointsAtScenePos(pos, layer, list);
+  foreach (BI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if (item->getType() != BI_Base::Type_t::NetPoint) continue;
+    BI_NetPoint* netpoint = static_cast<BI_NetPoint*>(item);
+    if (netpoint->isSelectable() &&
+        netpoint->isInGrabAreaScenePx(pos.toPxQPointF()) &&
+        ((!layer) || (netpoint->getLayerOfLines() == layer)) &&
+        ((!netsignal) ||
+         (&netpoint->getNetSignalOfNetSegment() == netsignal))) {
+      list.append(netpoint);
     }
   }
   return list;
@@ -514,9 +584,15 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_NetLine*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getNetLinesAtScenePos(pos, layer, list);
+  foreach (BI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if (item->getType() != BI_Base::Type_t::NetLine) continue;
+    BI_NetLine* netline = static_cast<BI_NetLine*>(item);
+    if (netline->isSelectable() &&
+        netline->isInGrabAreaScenePx(pos.toPxQPointF()) &&
+        ((!layer) || (&netline->getLayer() == layer)) &&
+        ((!netsignal) ||
+         (&netline->getNetSignalOfNetSegment() == netsignal))) {
+      list.append(netline);
     }
   }
   return list;
@@ -526,14 +602,14 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_FootprintPad*> list;
-  foreach (BI_Device* device, mDeviceInstances) {
-    foreach (BI_FootprintPad* pad, device->getFootprint().getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(pos.toPxQPointF()) &&
-          ((!layer) || (pad->isOnLayer(layer->getName()))) &&
-          ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal))) {
-        list.append(pad);
-      }
+  foreach (BI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if (item->getType() != BI_Base::Type_t::FootprintPad) continue;
+    BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item);
+    if (pad->isSelectable() &&
+        pad->isInGrabAreaScenePx(pos.toPxQPointF()) &&
+        ((!layer) || (pad->isOnLayer(layer->getName()))) &&
+        ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal))) {
+      list.append(pad);
     }
   }
   return list;
@@ -553,8 +629,6 @@ QList<BI_Base*> Board::getAllItems() const noexcept {
     items.append(text);
   foreach (BI_Hole* hole, mHoles)
     items.append(hole);
-  foreach (BI_AirWire* airWire, mAirWires)
-    items.append(airWire);
   return items;
 }
 
@@ -564,6 +638,7 @@ QList<BI_Base*> Board::getAllItems() const noexcept {
 
 void Board::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -591,6 +666,7 @@ void Board::addDeviceInstance(BI_Device& instance) {
   // add to board
   instance.addToBoard();  // can throw
   mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
+  mIsModified = true;
   updateErcMessages();
   emit deviceAdded(instance);
 }
@@ -603,6 +679,7 @@ void Board::removeDeviceInstance(BI_Device& instance) {
   // remove from board
   instance.removeFromBoard();  // can throw
   mDeviceInstances.remove(instance.getComponentInstanceUuid());
+  mIsModified = true;
   updateErcMessages();
   emit deviceRemoved(instance);
 }
@@ -633,6 +710,7 @@ void Board::addNetSegment(BI_NetSegment& netsegment) {
   // add to board
   netsegment.addToBoard();  // can throw
   mNetSegments.append(&netsegment);
+  mIsModified = true;
 }
 
 void Board::removeNetSegment(BI_NetSegment& netsegment) {
@@ -642,6 +720,7 @@ void Board::removeNetSegment(BI_NetSegment& netsegment) {
   // remove from board
   netsegment.removeFromBoard();  // can throw
   mNetSegments.removeOne(&netsegment);
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -655,6 +734,7 @@ void Board::addPlane(BI_Plane& plane) {
   }
   plane.addToBoard();  // can throw
   mPlanes.append(&plane);
+  mIsModified = true;
 }
 
 void Board::removePlane(BI_Plane& plane) {
@@ -663,15 +743,45 @@ void Board::removePlane(BI_Plane& plane) {
   }
   plane.removeFromBoard();  // can throw
   mPlanes.removeOne(&plane);
+  mIsModified = true;
 }
 
 void Board::rebuildAllPlanes() noexcept {
-  QList<BI_Plane*> planes = mPlanes;
-  std::sort(planes.begin(), planes.end(),
-            [](const BI_Plane* p1, const BI_Plane* p2) {
-              return !(*p1 < *p2);
-            });  // sort by priority (highest priority first)
-  foreach (BI_Plane* plane, planes) { plane->rebuild(); }
+  Profiler::Scope scope("board \'%1\': planes", *mName);
+  cancelPlanesRebuild();
+  mPlanesRebuildWatcher.waitForFinished();
+  QList<PlaneRebuildTask> tasks = createPlaneRebuildTasks(false);
+  applyPlaneFragments(buildPlanes(tasks, QAtomicInt(0)),
+                      getFingerprints(tasks));
+}
+
+void Board::rebuildAllPlanesForFabrication() noexcept {
+  Profiler::Scope scope("board \'%1\': planes", *mName);
+  cancelPlanesRebuild();
+  mPlanesRebuildWatcher.waitForFinished();
+  QList<PlaneRebuildTask> tasks = createPlaneRebuildTasks(true);
+  applyPlaneFragments(buildPlanes(tasks, QAtomicInt(0)),
+                      getFingerprints(tasks));
+}
+
+const BoardDesignRuleCheck& Board::runDesignRuleCheck() noexcept {
+  Profiler::Scope scope("board \'%1\': DRC", *mName);
+  mDesignRuleCheck->check(BoardDesignRuleCheck::createSnapshot(*this));
+  return *mDesignRuleCheck;
+}
+
+void Board::scheduleAllPlanesRebuild() noexcept {
+  cancelPlanesRebuild();
+
+  startPlanesRebuild(createPlaneRebuildTasks(false), PlaneFragments());
+}
+
+void Board::cancelPlanesRebuild() noexcept {
+  if (mPlanesRebuildCanceled) {
+    mPlanesRebuildCanceled->store(1);
+    mPlanesRebuildCanceled.reset();
+    emit planesRebuildRunningChanged(false);
+  }
 }
 
 /*******************************************************************************
@@ -685,6 +795,7 @@ void Board::addPolygon(BI_Polygon& polygon) {
   }
   polygon.addToBoard();  // can throw
   mPolygons.append(&polygon);
+  mIsModified = true;
 }
 
 void Board::removePolygon(BI_Polygon& polygon) {
@@ -693,6 +804,7 @@ void Board::removePolygon(BI_Polygon& polygon) {
   }
   polygon.removeFromBoard();  // can throw
   mPolygons.removeOne(&polygon);
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -706,6 +818,7 @@ void Board::addStrokeText(BI_StrokeText& text) {
   }
   text.addToBoard();  // can throw
   mStrokeTexts.append(&text);
+  mIsModified = true;
 }
 
 void Board::removeStrokeText(BI_StrokeText& text) {
@@ -714,6 +827,7 @@ void Board::removeStrokeText(BI_StrokeText& text) {
   }
   text.removeFromBoard();  // can throw
   mStrokeTexts.removeOne(&text);
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -727,6 +841,7 @@ void Board::addHole(BI_Hole& hole) {
   }
   hole.addToBoard();  // can throw
   mHoles.append(&hole);
+  mIsModified = true;
 }
 
 void Board::removeHole(BI_Hole& hole) {
@@ -735,6 +850,7 @@ void Board::removeHole(BI_Hole& hole) {
   }
   hole.removeFromBoard();  // can throw
   mHoles.removeOne(&hole);
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -746,40 +862,81 @@ void Board::triggerAirWiresRebuild() noexcept {
     return;
   }
 
+  Profiler::Scope scope("board \'%1\': airwires", *mName);
   try {
+    // Note: The builders collect their data from the board in the main thread,
+    // but the (expensive) airwire calculation of all net signals runs in
+    // parallel in worker threads. Net signals whose data has not changed since
+    // the last build keep their airwires. Airwires of net signals which are
+    // not shown are not calculated at all, their builder is discarded to
+    // calculate them from scratch as soon as they get shown.
+    typedef BoardAirWiresBuilder::AirWires AirWires;
+    QList<NetSignal*>                      netSignals;
+    QList<QFuture<AirWires>>               futures;
     foreach (NetSignal* netsignal, mScheduledNetSignalsForAirWireRebuild) {
-      // remove old airwires
-      while (BI_AirWire* airWire = mAirWires.take(netsignal)) {
-        airWire->removeFromBoard();  // can throw
-        delete airWire;
+      if (netsignal && netsignal->isAddedToCircuit() &&
+          netsignal->areAirWiresShown()) {
+        std::shared_ptr<BoardAirWiresBuilder>& builder =
+            mAirWiresBuilders[netsignal];
+        if (!builder) {
+          builder = std::make_shared<BoardAirWiresBuilder>();
+        }
+        if (!builder->update(*this, *netsignal)) {
+          continue;  // airwires are still up to date
+        }
+        PerformanceCounters::add(PerformanceCounters::Counter::AirWireRebuilds);
+        netSignals.append(netsignal);
+        futures.append(TaskScheduler::run(
+            TaskScheduler::Priority::Interactive, [builder]() -> AirWires {
+              try {
+                return builder->buildAirWires();
+              } catch (const std::exception& e) {
+                qCritical() << "Failed to build airwires:" << e.what();
+                return AirWires();
+              }
+            }));
+      } else {
+        mAirWiresBuilders.remove(netsignal);
+        netSignals.append(netsignal);
+        futures.append(QFuture<AirWires>());
       }
+    }
 
-      if (netsignal && netsignal->isAddedToCircuit()) {
-        // calculate new airwires
-        BoardAirWiresBuilder         builder(*this, *netsignal);
-        QVector<QPair<Point, Point>> airwires = builder.buildAirWires();
-
-        // add new airwires
-        foreach (const auto& points, airwires) {
-          QScopedPointer<BI_AirWire> airWire(
-              new BI_AirWire(*this, *netsignal, points.first, points.second));
-          airWire->addToBoard();  // can throw
-          mAirWires.insertMulti(netsignal, airWire.take());
-        }
+    // update airwires
+    bool modified = false;
+    for (int i = 0; i < netSignals.count(); ++i) {
+      NetSignal* netsignal = netSignals.at(i);
+      AirWires   airWires;
+      if (mAirWiresBuilders.contains(netsignal)) {
+        airWires = futures[i].result();
+      }
+      if (airWires.isEmpty()) {
+        modified = (mAirWires.remove(netsignal) > 0) || modified;
+      } else if (mAirWires.value(netsignal) != airWires) {
+        mAirWires.insert(netsignal, airWires);
+        modified = true;
       }
     }
     mScheduledNetSignalsForAirWireRebuild.clear();
+    if (modified && mAirWiresGraphicsItem) {
+      mAirWiresGraphicsItem->updateCacheAndRepaint();
+    }
   } catch (const std::exception&
                e) {  // std::exception because of the many std containers...
     qCritical() << "Failed to build airwires:" << e.what();
+    mAirWiresBuilders.clear();  // airwires may be inconsistent now
   }
 }
 
 void Board::forceAirWiresRebuild() noexcept {
+  scheduleAllAirWiresRebuild();
+  triggerAirWiresRebuild();
+}
+
+void Board::scheduleAllAirWiresRebuild() noexcept {
   mScheduledNetSignalsForAirWireRebuild.unite(
       mProject.getCircuit().getNetSignals().values().toSet());
   mScheduledNetSignalsForAirWireRebuild.unite(mAirWires.keys().toSet());
-  triggerAirWiresRebuild();
 }
 
 /*******************************************************************************
@@ -790,6 +947,9 @@ void Board::addToProject() {
   if (mIsAddedToProject) {
     throw LogicError(__FILE__, __LINE__);
   }
+  mGraphicsScene->beginBulkChanges();
+  auto bulkGuard = scopeGuard([this]() { mGraphicsScene->endBulkChanges(); });
+
   QList<BI_Base*> items = getAllItems();
   ScopeGuardList  sgl(items.count());
   for (int i = 0; i < items.count(); ++i) {
@@ -797,8 +957,19 @@ void Board::addToProject() {
     item->addToBoard();  // can throw
     sgl.add([item]() { item->removeFromBoard(); });
   }
+  if (!isHeadless()) {
+    if (!mAirWiresGraphicsItem) {
+      mAirWiresGraphicsItem.reset(new BGI_AirWires(*this));
+    }
+    mGraphicsScene->addItem(*mAirWiresGraphicsItem);
+  }
   mIsAddedToProject = true;
-  forceAirWiresRebuild();
+  scheduleAllAirWiresRebuild();
+  if (isHeadless()) {
+    triggerAirWiresRebuild();
+  } else {
+    triggerAirWiresRebuildDeferred();  // don't delay showing the editor
+  }
   updateErcMessages();
   sgl.dismiss();
 }
@@ -807,6 +978,17 @@ void Board::removeFromProject() {
   if (!mIsAddedToProject) {
     throw LogicError(__FILE__, __LINE__);
   }
+  mGraphicsScene->beginBulkChanges();
+  auto bulkGuard = scopeGuard([this]() { mGraphicsScene->endBulkChanges(); });
+
+  if (mAirWiresGraphicsItem) {
+    mGraphicsScene->removeItem(*mAirWiresGraphicsItem);
+  }
+  auto airWiresGuard = scopeGuard([this]() {
+    if (mAirWiresGraphicsItem) {
+      mGraphicsScene->addItem(*mAirWiresGraphicsItem);
+    }
+  });
   QList<BI_Base*> items = getAllItems();
   ScopeGuardList  sgl(items.count());
   for (int i = items.count() - 1; i >= 0; --i) {
@@ -817,22 +999,85 @@ void Board::removeFromProject() {
   mIsAddedToProject = false;
   updateErcMessages();
   sgl.dismiss();
+  airWiresGuard.dismiss();
+}
+
+void Board::load(bool buildPlanesAndAirWires) {
+  if (isLoaded()) {
+    return;
+  }
+
+  try {
+    loadItems(*mUnloadedContent);  // can throw
+    if (mIsAddedToProject) {
+      mGraphicsScene->beginBulkChanges();
+      auto bulkGuard = scopeGuard([this]() {
+        mGraphicsScene->endBulkChanges();
+      });
+
+      QList<BI_Base*> items = getAllItems();
+      ScopeGuardList  sgl(items.count());
+      for (int i = 0; i < items.count(); ++i) {
+        BI_Base* item = items.at(i);
+        item->addToBoard();  // can throw
+        sgl.add([item]() { item->removeFromBoard(); });
+      }
+      sgl.dismiss();
+    }
+  } catch (...) {
+    // remove all partially loaded items, the board stays unloaded
+    qDeleteAll(mHoles);
+    mHoles.clear();
+    qDeleteAll(mStrokeTexts);
+    mStrokeTexts.clear();
+    qDeleteAll(mPolygons);
+    mPolygons.clear();
+    qDeleteAll(mPlanes);
+    mPlanes.clear();
+    qDeleteAll(mNetSegments);
+    mNetSegments.clear();
+    qDeleteAll(mDeviceInstances);
+    mDeviceInstances.clear();
+    throw;
+  }
+
+  mUnloadedContent.reset();
+  if (buildPlanesAndAirWires) {
+    rebuildAllPlanesFromCache();
+    scheduleAllAirWiresRebuild();
+    if (isHeadless()) {
+      triggerAirWiresRebuild();
+    } else {
+      triggerAirWiresRebuildDeferred();  // don't delay showing the editor
+    }
+  }
+  updateErcMessages();
 }
 
 void Board::save() {
   if (mIsAddedToProject) {
-    // save board file
-    SExpression brdDoc(serializeToDomElement("librepcb_board"));  // can throw
-    mDirectory->write(getFilePath().getFilename(),
-                      brdDoc.toByteArray());  // can throw
+    if (!isLoaded()) {
+      return;  // not modified since it was opened, keep the files as they are
+    }
+
+    // save board file (only if modified since it is expensive)
+    if (mIsModified) {
+      SExpression brdDoc(serializeToDomElement("librepcb_board"));  // can throw
+      mDirectory->write(getFilePath().getFilename(),
+                        brdDoc.toByteArray());  // can throw
+    }
 
     // save user settings
     SExpression usrDoc(mUserSettings->serializeToDomElement(
         "librepcb_board_user_settings"));                         // can throw
     mDirectory->write("settings.user.lp", usrDoc.toByteArray());  // can throw
+
+    // save plane fragments to avoid rebuilding them when opening the board
+    savePlanesCache();
   } else {
     mDirectory->removeDirRecursively();  // can throw
   }
+  mIsModified = false;
 }
 
 void Board::showInView(GraphicsView& view) noexcept {
@@ -843,64 +1088,42 @@ void Board::setSelectionRect(const Point& p1, const Point& p2,
                              bool updateItems) noexcept {
   mGraphicsScene->setSelectionRect(p1, p2);
   if (updateItems) {
+    // Note: Only the items within the rect are determined with the spatial
+    // index of the graphics scene, and only the previously selected items need
+    // to be deselected. So this doesn't iterate over all items of the board.
     QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-    foreach (BI_Device* component, mDeviceInstances) {
-      BI_Footprint& footprint       = component->getFootprint();
-      bool          selectFootprint = footprint.isSelectable() &&
-                             footprint.getGrabAreaScenePx().intersects(rectPx);
-      footprint.setSelected(selectFootprint);
-      foreach (BI_FootprintPad* pad, footprint.getPads()) {
-        bool selectPad =
-            pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-        pad->setSelected(selectFootprint || selectPad);
-      }
-      foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
-        bool selectText = text->isSelectable() &&
-                          text->getGrabAreaScenePx().intersects(rectPx);
-        text->setSelected(selectFootprint || selectText);
+    QSet<BI_Base*> items;
+    foreach (QGraphicsItem* graphicsItem,
+             mGraphicsScene->items(rectPx, Qt::IntersectsItemBoundingRect)) {
+      BI_Base* item = mItemsByGraphicsItem.value(graphicsItem);
+      if (item && isSelectableByRect(*item) && item->isSelectable() &&
+          item->getGrabAreaScenePx().intersects(rectPx)) {
+        items.insert(item);
       }
     }
-    foreach (BI_NetSegment* segment, mNetSegments) {
-      segment->setSelectionRect(rectPx);
-    }
-    foreach (BI_Plane* plane, mPlanes) {
-      bool select = plane->isSelectable() &&
-                    plane->getGrabAreaScenePx().intersects(rectPx);
-      plane->setSelected(select);
-    }
-    foreach (BI_Polygon* polygon, mPolygons) {
-      bool select = polygon->isSelectable() &&
-                    polygon->getGrabAreaScenePx().intersects(rectPx);
-      polygon->setSelected(select);
-    }
-    foreach (BI_StrokeText* text, mStrokeTexts) {
-      bool select =
-          text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
-      text->setSelected(select);
+    foreach (BI_Base* item, mSelectedItems) {
+      if (isSelectableByRect(*item) && (!items.contains(item))) {
+        item->setSelected(false);
+      }
     }
-    foreach (BI_Hole* hole, mHoles) {
-      bool select =
-          hole->isSelectable() && hole->getGrabAreaScenePx().intersects(rectPx);
-      hole->setSelected(select);
+    foreach (BI_Base* item, items) {
+      item->setSelected(true);  // footprints also select their pads and texts
     }
   }
 }
 
 void Board::clearSelection() const noexcept {
-  foreach (BI_Device* device, mDeviceInstances)
-    device->getFootprint().setSelected(false);
-  foreach (BI_NetSegment* segment, mNetSegments) { segment->clearSelection(); }
-  foreach (BI_Plane* plane, mPlanes) { plane->setSelected(false); }
-  foreach (BI_Polygon* polygon, mPolygons) { polygon->setSelected(false); }
-  foreach (BI_StrokeText* text, mStrokeTexts) { text->setSelected(false); }
-  foreach (BI_Hole* hole, mHoles) { hole->setSelected(false); }
+  foreach (BI_Base* item, mSelectedItems) {
+    if (isSelectableByRect(*item)) {
+      item->setSelected(false);
+    }
+  }
 }
 
 std::unique_ptr<BoardSelectionQuery> Board::createSelectionQuery() const
     noexcept {
-  return std::unique_ptr<BoardSelectionQuery>(new BoardSelectionQuery(
-      mDeviceInstances, mNetSegments, mPlanes, mPolygons, mStrokeTexts, mHoles,
-      const_cast<Board*>(this)));
+  return std::unique_ptr<BoardSelectionQuery>(
+      new BoardSelectionQuery(mSelectedItems, const_cast<Board*>(this)));
 }
 
 /*******************************************************************************
@@ -924,10 +1147,351 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const
  *  Private Methods
  ******************************************************************************/
 
+void Board::loadItems(const SExpression& root) {
+  // Load all device instances
+  foreach (const SExpression* node, root.getChildren("device")) {
+    BI_Device* device = new BI_Device(*this, *node);
+    if (getDeviceInstanceByComponentUuid(device->getComponentInstanceUuid())) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("There is already a device of the component instance "
+                     "\"%1\"!"))
+              .arg(device->getComponentInstanceUuid().toStr()));
+    }
+    mDeviceInstances.insert(device->getComponentInstanceUuid(), device);
+  }
+
+  // Load all netsegments
+  foreach (const SExpression* node, root.getChildren("netsegment")) {
+    BI_NetSegment* netsegment = new BI_NetSegment(*this, *node);
+    if (getNetSegmentByUuid(netsegment->getUuid())) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("There is already a netsegment with the UUID \"%1\"!"))
+              .arg(netsegment->getUuid().toStr()));
+    }
+    mNetSegments.append(netsegment);
+  }
+
+  // Load all planes
+  foreach (const SExpression* node, root.getChildren("plane")) {
+    BI_Plane* plane = new BI_Plane(*this, *node);
+    mPlanes.append(plane);
+  }
+
+  // Load all polygons
+  foreach (const SExpression* node, root.getChildren("polygon")) {
+    BI_Polygon* polygon = new BI_Polygon(*this, *node);
+    mPolygons.append(polygon);
+  }
+
+  // Load all stroke texts
+  foreach (const SExpression* node, root.getChildren("stroke_text")) {
+    BI_StrokeText* text = new BI_StrokeText(*this, *node);
+    mStrokeTexts.append(text);
+  }
+
+  // Load all holes
+  foreach (const SExpression* node, root.getChildren("hole")) {
+    BI_Hole* hole = new BI_Hole(*this, *node);
+    mHoles.append(hole);
+  }
+}
+
+QList<BI_Base*> Board::getItemCandidatesAtScenePos(const Point& pos) const
+    noexcept {
+  // Note: The graphics scene maintains a BSP tree of the bounding rects of all
+  // its items, which is updated automatically whenever an item is moved. So
+  // querying it costs O(log n) instead of iterating over all board items.
+  QList<BI_Base*> items;
+  foreach (QGraphicsItem* graphicsItem,
+           mGraphicsScene->items(pos.toPxQPointF(),
+                                 Qt::IntersectsItemBoundingRect,
+                                 Qt::DescendingOrder)) {
+    if (BI_Base* item = mItemsByGraphicsItem.value(graphicsItem)) {
+      items.append(item);
+    }
+  }
+  return items;
+}
+
+bool Board::isSelectableByRect(const BI_Base& item) noexcept {
+  switch (item.getType()) {
+    case BI_Base::Type_t::Footprint:
+    case BI_Base::Type_t::FootprintPad:
+    case BI_Base::Type_t::StrokeText:
+    case BI_Base::Type_t::Via:
+    case BI_Base::Type_t::NetPoint:
+    case BI_Base::Type_t::NetLine:
+    case BI_Base::Type_t::Plane:
+    case BI_Base::Type_t::Polygon:
+    case BI_Base::Type_t::Hole:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool Board::isSceneCullingEnabled() noexcept {
+  static bool enabled = qgetenv("LIBREPCB_DISABLE_SCENE_CULLING") != "1";
+  return enabled;
+}
+
 void Board::updateIcon() noexcept {
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
 
+QList<Board::PlaneRebuildTask> Board::createPlaneRebuildTasks(
+    bool forFabrication) const noexcept {
+  BoardPlaneFragmentsBuilder::Quality quality = forFabrication
+      ? mUserSettings->getPlanesFabricationQuality()
+      : mUserSettings->getPlanesEditingQuality();
+
+  QList<BI_Plane*> planes = mPlanes;
+  std::sort(planes.begin(), planes.end(),
+            [](const BI_Plane* p1, const BI_Plane* p2) {
+              return !(*p1 < *p2);
+            });  // sort by priority (highest priority first)
+
+  // A plane only depends on the fragments of planes with higher priority on
+  // the same layer and with a different net signal. So group the planes into
+  // levels where each plane only depends on planes of lower levels. All planes
+  // of the same level are independent of each other and thus can be built in
+  // parallel.
+  BoardSpatialIndex           index(*this);
+  QList<PlaneRebuildTask>     tasks;
+  QHash<const BI_Plane*, int> planeLevels;
+  QHash<Uuid, QByteArray>     fingerprints;
+  for (int i = 0; i < planes.count(); ++i) {
+    const BI_Plane* plane = planes.at(i);
+    int             level = 0;
+    for (int k = 0; k < i; ++k) {
+      const BI_Plane* other = planes.at(k);
+      if ((other->getLayerName() == plane->getLayerName()) &&
+          (&other->getNetSignal() != &plane->getNetSignal())) {
+        level = qMax(level, planeLevels.value(other) + 1);
+      }
+    }
+    planeLevels.insert(plane, level);
+    try {
+      BoardPlaneFragmentsBuilder::Snapshot snapshot =
+          BoardPlaneFragmentsBuilder::createSnapshot(
+              *plane, index, quality, mBoardAreaCache.data());  // can throw
+      QByteArray                           fingerprint =
+          BoardPlaneFragmentsBuilder::calcFingerprint(snapshot, fingerprints);
+      fingerprints.insert(plane->getUuid(), fingerprint);
+      // Note: The persistent builders of the planes only rebuild dirty tiles,
+      // which is fine for the editor. Fabrication data is always built from
+      // scratch to not depend on the state of the incremental builders.
+      std::shared_ptr<BoardPlaneFragmentsBuilder> builder = forFabrication
+          ? std::make_shared<BoardPlaneFragmentsBuilder>()
+          : plane->getFragmentsBuilder();
+      tasks.append(PlaneRebuildTask{level, snapshot, builder, fingerprint});
+    } catch (const Exception& e) {
+      qCritical() << "Failed to prepare plane rebuild:" << e.getMsg();
+    }
+  }
+
+  // sort by level, but keep the priority order within each level
+  std::stable_sort(tasks.begin(), tasks.end(),
+                   [](const PlaneRebuildTask& t1, const PlaneRebuildTask& t2) {
+                     return t1.level < t2.level;
+                   });
+  return tasks;
+}
+
+void Board::startPlanesRebuild(const QList<PlaneRebuildTask>& tasks,
+                               const PlaneFragments& fragments) noexcept {
+  // Note: The builders of the planes must not be used by multiple threads at
+  // the same time, thus the new rebuild depends on the canceled one. It is
+  // waited for in the worker thread to not block the caller.
+  std::shared_ptr<QAtomicInt> canceled = std::make_shared<QAtomicInt>(0);
+  QFuture<PlaneFragments>     previous = mPlanesRebuildWatcher.future();
+  QFuture<PlaneFragments>     future   = TaskScheduler::run(
+      TaskScheduler::Priority::Interactive, {QFuture<void>(previous)},
+      [tasks, fragments, canceled]() {
+        return buildPlanes(tasks, *canceled, fragments);
+      });
+  mPlanesRebuildCanceled     = canceled;
+  mPlanesRebuildFingerprints = getFingerprints(tasks);
+  mPlanesRebuildWatcher.setFuture(future);
+  emit planesRebuildRunningChanged(true);
+}
+
+void Board::planesRebuildFinished() noexcept {
+  if (mPlanesRebuildCanceled && (!mPlanesRebuildCanceled->load())) {
+    mPlanesRebuildCanceled.reset();
+    applyPlaneFragments(mPlanesRebuildWatcher.result(),
+                        mPlanesRebuildFingerprints);
+    triggerAirWiresRebuild();  // airwires depend on plane fragments
+    emit planesRebuildRunningChanged(false);
+  }
+}
+
+void Board::applyPlaneFragments(
+    const PlaneFragments&          fragments,
+    const QHash<Uuid, QByteArray>& fingerprints) noexcept {
+  foreach (BI_Plane* plane, mPlanes) {
+    auto it = fragments.find(plane->getUuid());
+    if (it != fragments.end()) {
+      plane->setFragments(*it);
+      mPlaneFingerprints.insert(plane->getUuid(),
+                                fingerprints.value(plane->getUuid()));
+    }
+  }
+}
+
+Board::PlaneFragments Board::buildPlanes(
+    const QList<PlaneRebuildTask>& tasks, const QAtomicInt& canceled,
+    const PlaneFragments& initialFragments) noexcept {
+  PlaneFragments fragments = initialFragments;
+  for (int first = 0; first < tasks.count();) {
+    if (canceled.load()) break;
+    int last = first;
+    while ((last + 1 < tasks.count()) &&
+           (tasks.at(last + 1).level == tasks.at(first).level)) {
+      ++last;
+    }
+    if (first == last) {
+      const PlaneRebuildTask& task = tasks.at(first);
+      fragments.insert(task.snapshot.uuid,
+                       task.builder->buildFragments(task.snapshot, fragments));
+    } else {
+      // Note: The fragments must not be modified until all futures are
+      // finished since they are read by the workers.
+      QList<QFuture<QVector<Path>>> futures;
+      for (int i = first; i <= last; ++i) {
+        const PlaneRebuildTask& task = tasks.at(i);
+        futures.append(TaskScheduler::run(
+            TaskScheduler::Priority::Interactive, [&task, &fragments]() {
+              return task.builder->buildFragments(task.snapshot, fragments);
+            }));
+      }
+      QList<QVector<Path>> results;
+      for (QFuture<QVector<Path>>& future : futures) {
+        results.append(future.result());
+      }
+      for (int i = first; i <= last; ++i) {
+        fragments.insert(tasks.at(i).snapshot.uuid, results.at(i - first));
+      }
+    }
+    first = last + 1;
+  }
+  return fragments;
+}
+
+QHash<Uuid, QByteArray> Board::getFingerprints(
+    const QList<PlaneRebuildTask>& tasks) noexcept {
+  QHash<Uuid, QByteArray> fingerprints;
+  foreach (const PlaneRebuildTask& task, tasks) {
+    fingerprints.insert(task.snapshot.uuid, task.fingerprint);
+  }
+  return fingerprints;
+}
+
+FilePath Board::getPlanesCacheFilePath() const noexcept {
+  QString cacheDir =
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (cacheDir.isEmpty()) {
+    return FilePath();
+  }
+  QByteArray key = QCryptographicHash::hash(
+      mDirectory->getAbsPath().toStr().toUtf8(), QCryptographicHash::Md5);
+  return FilePath(cacheDir).getPathTo(
+      QString("planes/%1.lp").arg(QString(key.toHex())));
+}
+
+void Board::rebuildAllPlanesFromCache() noexcept {
+  Profiler::Scope scope("board \'%1\': planes", *mName);
+  cancelPlanesRebuild();
+  mPlanesRebuildWatcher.waitForFinished();
+
+  // Load the fragments built before the board was saved the last time. The
+  // cache might be outdated or broken, so any error is ignored and the planes
+  // are just rebuilt.
+  PlaneFragments          cachedFragments;
+  QHash<Uuid, QByteArray> cachedFingerprints;
+  FilePath                fp = getPlanesCacheFilePath();
+  if ((!mPlanes.isEmpty()) && fp.isExistingFile()) {
+    try {
+      SExpression root =
+          SExpression::parse(FileUtils::readFile(fp), fp);  // can throw
+      if (root.getValueByPath<Version>("version") == qApp->getAppVersion()) {
+        foreach (const SExpression* node, root.getChildren("plane")) {
+          Uuid          uuid = node->getValueOfFirstChild<Uuid>(true);
+          QVector<Path> fragments;
+          foreach (const SExpression* child, node->getChildren("fragment")) {
+            fragments.append(Path(*child));
+          }
+          cachedFragments.insert(uuid, fragments);
+          cachedFingerprints.insert(
+              uuid, QByteArray::fromHex(
+                        node->getValueByPath<QString>("fingerprint").toUtf8()));
+        }
+      }
+    } catch (const Exception& e) {
+      qWarning() << "Could not load plane fragments cache:" << e.getMsg();
+      cachedFragments.clear();
+      cachedFingerprints.clear();
+    }
+  }
+
+  // Only rebuild planes whose inputs have changed since the cache was written.
+  // Since the fingerprint of a plane contains the fingerprints of all planes
+  // it depends on, dependent planes are rebuilt as well. Except in headless
+  // mode, they are rebuilt asynchronously to show the board as soon as
+  // possible, with the cached fragments already applied.
+  QList<PlaneRebuildTask> tasks        = createPlaneRebuildTasks(false);
+  QHash<Uuid, QByteArray> fingerprints = getFingerprints(tasks);
+  PlaneFragments          fragments;
+  for (int i = tasks.count() - 1; i >= 0; --i) {
+    const PlaneRebuildTask& task = tasks.at(i);
+    auto                    it   = cachedFingerprints.find(task.snapshot.uuid);
+    if ((it != cachedFingerprints.end()) && (*it == task.fingerprint)) {
+      fragments.insert(task.snapshot.uuid,
+                       cachedFragments.value(task.snapshot.uuid));
+      tasks.removeAt(i);
+    }
+  }
+  if (isHeadless()) {
+    applyPlaneFragments(buildPlanes(tasks, QAtomicInt(0), fragments),
+                        fingerprints);
+  } else {
+    applyPlaneFragments(fragments, fingerprints);
+    if (!tasks.isEmpty()) {
+      startPlanesRebuild(tasks, fragments);
+    }
+  }
+}
+
+void Board::savePlanesCache() noexcept {
+  FilePath fp = getPlanesCacheFilePath();
+  if (!fp.isValid()) {
+    return;
+  }
+
+  // Note: Failing to write the cache must not make saving the board fail.
+  try {
+    SExpression root = SExpression::createList("librepcb_board_planes_cache");
+    root.appendChild("version", qApp->getAppVersion(), true);
+    foreach (const BI_Plane* plane, mPlanes) {
+      auto it = mPlaneFingerprints.find(plane->getUuid());
+      if (it == mPlaneFingerprints.end()) {
+        continue;  // fragments are not built yet
+      }
+      SExpression& node = root.appendList("plane", true);
+      node.appendChild(plane->getUuid());
+      node.appendChild("fingerprint", QString(it->toHex()), true);
+      foreach (const Path& fragment, plane->getFragments()) {
+        fragment.serialize(node.appendList("fragment", true));  // can throw
+      }
+    }
+    FileUtils::writeFile(fp, root.toByteArray());  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Could not save plane fragments cache:" << e.getMsg();
+  }
+}
+
 void Board::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.appendChild("name", mName, true);
@@ -955,7 +1519,7 @@ void Board::serialize(SExpression& root) const {
 
 void Board::updateErcMessages() noexcept {
   // type: UnplacedComponent (ComponentInstances without DeviceInstance)
-  if (mIsAddedToProject) {
+  if (mIsAddedToProject && isLoaded()) {
     const QMap<Uuid, ComponentInstance*>& componentInstances =
         mProject.getCircuit().getComponentInstances();
     foreach (const ComponentInstance* component, componentInstances) {
@@ -994,7 +1558,15 @@ void Board::updateErcMessages() noexcept {
 Board* Board::create(Project&                                project,
                      std::unique_ptr<TransactionalDirectory> directory,
                      const ElementName&                      name) {
-  return new Board(project, std::move(directory), true, *name);
+  return new Board(project, std::move(directory), true, *name, nullptr);
+}
+
+SExpression Board::parseFile(const TransactionalDirectory& directory) {
+  // Note: Board files can become very large, thus they are parsed in parallel.
+  QString fileName = "board.lp";
+  return SExpression::parse(directory.read(fileName),
+                            directory.getAbsPath(fileName),
+                            true);  // can throw
 }
 
 /*******************************************************************************
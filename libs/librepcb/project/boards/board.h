@@ -31,6 +31,7 @@
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/geometry/path.h>
 #include <librepcb/common/units/all_length_units.h>
 #include <librepcb/common/uuid.h>
 
@@ -61,14 +62,18 @@ class BI_Via;
 class BI_NetSegment;
 class BI_NetPoint;
 class BI_NetLine;
+class BI_NetLineAnchor;
 class BI_Polygon;
 class BI_StrokeText;
 class BI_Hole;
 class BI_Plane;
-class BI_AirWire;
 class BoardLayerStack;
 class BoardFabricationOutputSettings;
 class BoardUserSettings;
+class BoardAirWiresBuilder;
+class BGI_AirWires;
+class BoardAreaCache;
+class BoardDesignRuleCheck;
 class BoardSelectionQuery;
 
 /*******************************************************************************
@@ -115,7 +120,7 @@ public:
     ZValue_TextsTop,  ///< Z value for librepcb::project::BI_StrokeText items
     ZValue_Vias,      ///< Z value for librepcb::project::BI_Via items
     ZValue_Texts,     ///< Z value for librepcb::project::BI_StrokeText items
-    ZValue_AirWires,  ///< Z value for librepcb::project::BI_AirWire items
+    ZValue_AirWires,  ///< Z value for librepcb::project::BGI_AirWires items
   };
 
   // Constructors / Destructor
@@ -123,8 +128,9 @@ public:
   Board(const Board& other) = delete;
   Board(const Board& other, std::unique_ptr<TransactionalDirectory> directory,
         const ElementName& name);
-  Board(Project& project, std::unique_ptr<TransactionalDirectory> directory)
-    : Board(project, std::move(directory), false, QString()) {}
+  Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
+        const SExpression& root, bool lazy = false)
+    : Board(project, std::move(directory), false, QString(), &root, lazy) {}
   ~Board() noexcept;
 
   // Getters: General
@@ -147,7 +153,57 @@ public:
       noexcept {
     return *mFabricationOutputSettings;
   }
+  BoardUserSettings& getUserSettings() noexcept { return *mUserSettings; }
+  const BoardUserSettings& getUserSettings() const noexcept {
+    return *mUserSettings;
+  }
   bool                isEmpty() const noexcept;
+
+  /**
+   * @brief Get the (estimated) memory usage of this board
+   *
+   * Counts all board items and their graphics items, including the
+   * calculated plane fragments. Library elements are not counted since they
+   * are owned by the project library.
+   *
+   * @return Memory usage in bytes
+   */
+  qint64 getMemoryUsage() const noexcept;
+
+  /**
+   * @brief Check whether all items of the board are loaded
+   *
+   * A board opened in lazy mode only loads its attributes and settings (name,
+   * layer stack, design rules, fabrication output settings etc.). All items
+   * (devices, netsegments, planes, ...) are loaded by #load() when the board
+   * is actually needed. Until then, the board doesn't contain any items and
+   * is not taken into account by the ERC.
+   *
+   * @return True if the items are loaded, false if #load() needs to be called
+   */
+  bool isLoaded() const noexcept { return !mUnloadedContent; }
+
+  /**
+   * @brief Check whether the board was opened in headless mode
+   *
+   * In headless mode (see librepcb::project::Project::isHeadless()), the
+   * board items don't create any graphics items, so the graphics scene of
+   * the board stays empty. This is useful if the board is only needed for
+   * exports or checks, but must not be used if the board is displayed.
+   *
+   * @return True if no graphics items are created
+   */
+  bool isHeadless() const noexcept;
+
+  /**
+   * @brief Check whether the board file needs to be written by #save()
+   *
+   * The flag is set by all modifications of the board and its items (which
+   * must be done with undo commands) and is cleared by #save().
+   *
+   * @return True if the board was modified since it was loaded or saved
+   */
+  bool isModified() const noexcept { return mIsModified; }
   QList<BI_Base*>     getItemsAtScenePos(const Point& pos) const noexcept;
   QList<BI_Via*>      getViasAtScenePos(const Point&     pos,
                                         const NetSignal* netsignal) const noexcept;
@@ -165,8 +221,60 @@ public:
       noexcept;
   QList<BI_Base*> getAllItems() const noexcept;
 
+  // Graphics Item Registration
+
+  /**
+   * @brief Register the graphics item of a board item
+   *
+   * This is used to find board items at a specific position through the
+   * spatial index of the graphics scene (see #getItemsAtScenePos()). It is
+   * called by librepcb::project::BI_Base when an item is added to the board.
+   *
+   * @param graphicsItem  The graphics item added to the scene
+   * @param item          The board item the graphics item belongs to
+   */
+  void registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                            BI_Base&             item) noexcept {
+    mItemsByGraphicsItem.insert(&graphicsItem, &item);
+  }
+  void unregisterGraphicsItem(const QGraphicsItem& graphicsItem) noexcept {
+    mItemsByGraphicsItem.remove(&graphicsItem);
+  }
+
+  /**
+   * @brief Get the registered graphics items of some board items
+   *
+   * @see #registerGraphicsItem()
+   *
+   * @param items   The board items to get the graphics items of
+   *
+   * @return The graphics items (in no particular order)
+   */
+  QList<QGraphicsItem*> getGraphicsItemsOf(
+      const QSet<BI_Base*>& items) const noexcept;
+
+  /**
+   * @brief Keep track of the selection state of a board item
+   *
+   * This is called by librepcb::project::BI_Base whenever the selection state
+   * of an item (which is added to the board) changes, so the selected items
+   * are known without iterating over the whole board (see
+   * #createSelectionQuery()).
+   *
+   * @param item      The board item
+   * @param selected  Whether the item is selected or not
+   */
+  void setItemSelected(BI_Base& item, bool selected) noexcept {
+    if (selected) {
+      mSelectedItems.insert(&item);
+    } else {
+      mSelectedItems.remove(&item);
+    }
+  }
+
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
+  void setModified() noexcept { mIsModified = true; }
 
   // Getters: Attributes
   const Uuid&        getUuid() const noexcept { return mUuid; }
@@ -196,7 +304,65 @@ public:
   const QList<BI_Plane*>& getPlanes() const noexcept { return mPlanes; }
   void                    addPlane(BI_Plane& plane);
   void                    removePlane(BI_Plane& plane);
-  void                    rebuildAllPlanes() noexcept;
+
+  /**
+   * @brief Rebuild the fragments of all planes synchronously
+   *
+   * The planes are built with the editing quality of the board user
+   * settings. A running asynchronous rebuild (see #scheduleAllPlanesRebuild())
+   * is canceled. Use this method if the fragments are needed immediately.
+   */
+  void rebuildAllPlanes() noexcept;
+
+  /**
+   * @brief Rebuild the fragments of all planes synchronously for fabrication
+   *
+   * Same as #rebuildAllPlanes(), but the planes are built with the fabrication
+   * quality of the board user settings, and always from scratch with new
+   * builders instead of incrementally. So the exported data never depends on
+   * the editing history. Use this method before exporting fabrication data.
+   */
+  void rebuildAllPlanesForFabrication() noexcept;
+
+  /**
+   * @brief Check the copper clearances of the board
+   *
+   * Only objects which were modified since the last call are checked again,
+   * see librepcb::project::BoardDesignRuleCheck. The plane fragments are
+   * checked as they are, so they should be rebuilt before.
+   *
+   * @return The check containing all violations of the board
+   */
+  const BoardDesignRuleCheck& runDesignRuleCheck() noexcept;
+
+  /**
+   * @brief Rebuild the fragments of all planes asynchronously
+   *
+   * The fragments are built in a worker thread from a snapshot of the board
+   * and applied as soon as they are finished. Until then, planes keep their
+   * previous fragments. If this method is called again before the rebuild
+   * finished, the running rebuild is canceled and a new one started.
+   *
+   * @note This requires a running event loop to apply the results.
+   */
+  void scheduleAllPlanesRebuild() noexcept;
+
+  /**
+   * @brief Check whether an asynchronous plane rebuild is running
+   *
+   * @return True between #scheduleAllPlanesRebuild() and the rebuild being
+   *         finished (or canceled)
+   */
+  bool isPlanesRebuildRunning() const noexcept {
+    return mPlanesRebuildCanceled != nullptr;
+  }
+
+  /**
+   * @brief Cancel a running asynchronous plane rebuild
+   *
+   * Planes which are not built yet keep their current fragments.
+   */
+  void cancelPlanesRebuild() noexcept;
 
   // Polygon Methods
   const QList<BI_Polygon*>& getPolygons() const noexcept { return mPolygons; }
@@ -216,13 +382,75 @@ public:
   void                   removeHole(BI_Hole& hole);
 
   // AirWire Methods
+
+  /**
+   * @brief Get the airwires of all net signals
+   *
+   * Airwires are not board items, they are only drawn by a single graphics
+   * item (librepcb::project::BGI_AirWires) for the whole board.
+   *
+   * @return The start and end points of all airwires by net signal
+   */
+  const QHash<NetSignal*, QVector<QPair<Point, Point>>>& getAirWires() const
+      noexcept {
+    return mAirWires;
+  }
   void scheduleAirWiresRebuild(NetSignal* netsignal) noexcept {
     mScheduledNetSignalsForAirWireRebuild.insert(netsignal);
   }
   void triggerAirWiresRebuild() noexcept;
   void forceAirWiresRebuild() noexcept;
+  void scheduleAllAirWiresRebuild() noexcept;
+
+  /**
+   * @brief Trigger the airwire rebuild as soon as the event loop is idle
+   *
+   * In contrast to #triggerAirWiresRebuild(), calling this multiple times in
+   * a row (e.g. on every mouse move event while dragging items) rebuilds the
+   * airwires only once, after all pending events are processed.
+   */
+  void triggerAirWiresRebuildDeferred() noexcept {
+    mAirWiresRebuildTimer.start();
+  }
+
+  /**
+   * @brief Build the airwires as if some anchors were moved by an offset
+   *
+   * Used to preview moving items (e.g. while dragging a selection) without
+   * modifying the board items. Only affects subsequent airwire rebuilds, so
+   * the net signals of the anchors need to be scheduled for a rebuild.
+   *
+   * @param anchors   The anchors to displace (empty to end the preview)
+   * @param offset    The offset to add to the positions of the anchors
+   */
+  void setAirWiresPreviewOffset(const QSet<const BI_NetLineAnchor*>& anchors,
+                                const Point& offset) noexcept {
+    mAirWiresPreviewAnchors = anchors;
+    mAirWiresPreviewOffset  = offset;
+  }
+  Point getAirWiresPreviewOffset(const BI_NetLineAnchor& anchor) const
+      noexcept {
+    return mAirWiresPreviewAnchors.contains(&anchor) ? mAirWiresPreviewOffset
+                                                     : Point(0, 0);
+  }
 
   // General Methods
+
+  /**
+   * @brief Load all items of a lazily opened board (see #isLoaded())
+   *
+   * Does nothing if the board is already loaded.
+   *
+   * @param buildPlanesAndAirWires  If false, the planes and airwires are not
+   *                                built after loading the items. Useful if
+   *                                only the devices are needed (e.g. for a
+   *                                BOM). Call #rebuildAllPlanes() and
+   *                                #forceAirWiresRebuild() to build them later.
+   *
+   * @throw Exception If the items could not be loaded. The board then stays
+   *                  unloaded.
+   */
+  void load(bool buildPlanesAndAirWires = true);
   void addToProject();
   void removeFromProject();
   void save();
@@ -251,6 +479,18 @@ public:
                        std::unique_ptr<TransactionalDirectory> directory,
                        const ElementName&                      name);
 
+  /**
+   * @brief Read and parse the board file of a board directory
+   *
+   * @note This method doesn't access any project data and thus can be called
+   *       from worker threads, as long as the directory is not modified.
+   *
+   * @param directory   The board directory
+   *
+   * @return The parsed file, to be passed to the constructor
+   */
+  static SExpression parseFile(const TransactionalDirectory& directory);
+
 signals:
 
   /// @copydoc AttributeProvider::attributesChanged()
@@ -259,11 +499,65 @@ signals:
   void deviceAdded(BI_Device& comp);
   void deviceRemoved(BI_Device& comp);
 
+  /**
+   * @brief Emitted when an asynchronous plane rebuild starts or ends
+   *
+   * @param running   See #isPlanesRebuildRunning()
+   */
+  void planesRebuildRunningChanged(bool running);
+
 private:
+  // Types
+  struct PlaneRebuildTask;
+  typedef QHash<Uuid, QVector<Path>> PlaneFragments;
+
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
-        bool create, const QString& newName);
+        bool create, const QString& newName, const SExpression* root,
+        bool lazy = false);
+  void loadItems(const SExpression& root);
   void updateIcon() noexcept;
   void updateErcMessages() noexcept;
+  QList<BI_Base*> getItemCandidatesAtScenePos(const Point& pos) const
+      noexcept;
+  static bool isSelectableByRect(const BI_Base& item) noexcept;
+
+  /**
+   * Returns whether the graphics scene only contains the items around the
+   * viewport (see librepcb::GraphicsScene::setCullingEnabled()). Can be
+   * disabled for debugging with the environment variable
+   * `LIBREPCB_DISABLE_SCENE_CULLING=1`.
+   */
+  static bool isSceneCullingEnabled() noexcept;
+
+  // Plane Rebuild Methods
+  QList<PlaneRebuildTask> createPlaneRebuildTasks(bool forFabrication) const
+      noexcept;
+  void startPlanesRebuild(const QList<PlaneRebuildTask>& tasks,
+                          const PlaneFragments&          fragments) noexcept;
+  void planesRebuildFinished() noexcept;
+  void applyPlaneFragments(
+      const PlaneFragments&          fragments,
+      const QHash<Uuid, QByteArray>& fingerprints) noexcept;
+  static PlaneFragments buildPlanes(
+      const QList<PlaneRebuildTask>& tasks, const QAtomicInt& canceled,
+      const PlaneFragments& fragments = PlaneFragments()) noexcept;
+  static QHash<Uuid, QByteArray> getFingerprints(
+      const QList<PlaneRebuildTask>& tasks) noexcept;
+
+  // Plane Cache Methods
+
+  /**
+   * @brief Get the file of the plane fragments cache
+   *
+   * The cache is stored in the cache directory of the application (one file
+   * per board directory), not in the project. So it is never added to
+   * version control or archives, even for projects without a gitignore file.
+   *
+   * @return The cache file (invalid if there is no cache directory)
+   */
+  FilePath getPlanesCacheFilePath() const noexcept;
+  void     rebuildAllPlanesFromCache() noexcept;
+  void     savePlanesCache() noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -272,6 +566,7 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool                                    mIsAddedToProject;
+  bool                                    mIsModified;
 
   QScopedPointer<GraphicsScene>                  mGraphicsScene;
   QScopedPointer<BoardLayerStack>                mLayerStack;
@@ -279,8 +574,21 @@ private:
   QScopedPointer<BoardDesignRules>               mDesignRules;
   QScopedPointer<BoardFabricationOutputSettings> mFabricationOutputSettings;
   QScopedPointer<BoardUserSettings>              mUserSettings;
+  QScopedPointer<BoardDesignRuleCheck>           mDesignRuleCheck;
+  QScopedPointer<BoardAreaCache>                 mBoardAreaCache;
   QRectF                                         mViewRect;
   QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+  QTimer mAirWiresRebuildTimer;  ///< See #triggerAirWiresRebuildDeferred()
+  std::unique_ptr<SExpression> mUnloadedContent;  ///< Items not loaded yet
+
+  // Asynchronous plane rebuild
+  QFutureWatcher<PlaneFragments> mPlanesRebuildWatcher;
+  std::shared_ptr<QAtomicInt>    mPlanesRebuildCanceled;
+  QHash<Uuid, QByteArray>        mPlanesRebuildFingerprints;
+
+  /// Fingerprints of the current plane fragments, see
+  /// librepcb::project::BoardPlaneFragmentsBuilder::calcFingerprint()
+  QHash<Uuid, QByteArray> mPlaneFingerprints;
 
   // Attributes
   Uuid        mUuid;
@@ -295,7 +603,23 @@ private:
   QList<BI_Polygon*>                  mPolygons;
   QList<BI_StrokeText*>               mStrokeTexts;
   QList<BI_Hole*>                     mHoles;
-  QMultiHash<NetSignal*, BI_AirWire*> mAirWires;
+
+  // Airwires and the graphics item drawing all of them
+  QHash<NetSignal*, QVector<QPair<Point, Point>>> mAirWires;
+  QScopedPointer<BGI_AirWires>                    mAirWiresGraphicsItem;
+
+  // Displaced anchors, see #setAirWiresPreviewOffset()
+  QSet<const BI_NetLineAnchor*> mAirWiresPreviewAnchors;
+  Point                         mAirWiresPreviewOffset;
+
+  // Board items by their graphics items
+  QHash<const QGraphicsItem*, BI_Base*> mItemsByGraphicsItem;
+
+  // All currently selected board items
+  QSet<BI_Base*> mSelectedItems;
+
+  // Builders of the airwires, keeping the state of their last build
+  QHash<NetSignal*, std::shared_ptr<BoardAirWiresBuilder>> mAirWiresBuilders;
 
   // ERC messages
   QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
@@ -37,112 +37,103 @@
 #include <delaunay-triangulation/delaunay.h>
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/library/pkg/footprintpad.h>
-#include <unordered_map>
 
 #include <QtCore>
 
+#include <algorithm>
+#include <vector>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
 namespace project {
 
-// adapted from horizon/kicad
-static QVector<QPair<Point, Point>> kruskalMst(
-    std::vector<delaunay::Edge<qreal>>&    aEdges,
-    std::vector<delaunay::Vector2<qreal>>& aNodes) noexcept {
-  unsigned int nodeNumber      = aNodes.size();
-  unsigned int mstExpectedSize = nodeNumber - 1;
-  unsigned int mstSize         = 0;
-  bool         ratsnestLines   = false;
-
-  // printf("mst nodes : %d edges : %d\n", aNodes.size(), aEdges.size () );
-  // The output
-  QVector<QPair<Point, Point>> mst;
+/**
+ * @brief Disjoint-set forest with path compression and union by rank
+ */
+class UnionFind final {
+public:
+  explicit UnionFind(int count) noexcept : mParents(count), mRanks(count, 0) {
+    for (int i = 0; i < count; ++i) {
+      mParents[i] = i;
+    }
+  }
 
-  // Set tags for marking cycles
-  std::unordered_map<int, int> tags;
-  unsigned int                 tag = 0;
+  int find(int node) noexcept {
+    int root = node;
+    while (mParents[root] != root) {
+      root = mParents[root];
+    }
+    while (mParents[node] != root) {  // path compression
+      int parent     = mParents[node];
+      mParents[node] = root;
+      node           = parent;
+    }
+    return root;
+  }
 
-  for (auto& node : aNodes) {
-    node.tag      = tag;
-    tags[node.id] = tag++;
+  bool unite(int a, int b) noexcept {
+    int rootA = find(a);
+    int rootB = find(b);
+    if (rootA == rootB) {
+      return false;  // already in the same set
+    }
+    if (mRanks[rootA] < mRanks[rootB]) {
+      std::swap(rootA, rootB);
+    }
+    mParents[rootB] = rootA;
+    if (mRanks[rootA] == mRanks[rootB]) {
+      ++mRanks[rootA];
+    }
+    return true;
   }
 
-  // Lists of nodes connected together (subtrees) to detect cycles in the
-  // graph
-  std::vector<std::list<int>> cycles(nodeNumber);
+private:
+  std::vector<int> mParents;
+  std::vector<int> mRanks;
+};
 
-  for (unsigned int i = 0; i < nodeNumber; ++i) cycles[i].push_back(i);
+/**
+ * @brief Determine the airwires with Kruskal's algorithm
+ *
+ * Edges with a negative weight are existing connections (e.g. netlines), all
+ * other edges are candidates for airwires. Since the edges are sorted by their
+ * weight, the existing connections are processed first. The Kruskal algorithm
+ * was originally adapted from horizon/kicad.
+ *
+ * @param edges   All edges, including the existing connections
+ * @param nodes   All nodes, their IDs must be equal to their indices
+ *
+ * @return The airwires (minimum spanning forest without existing connections)
+ */
+static QVector<QPair<Point, Point>> kruskalMst(
+    std::vector<delaunay::Edge<qreal>>&          edges,
+    const std::vector<delaunay::Vector2<qreal>>& nodes) noexcept {
+  QVector<QPair<Point, Point>> mst;
+  int                          components = static_cast<int>(nodes.size());
+  UnionFind                    sets(components);
 
   // Kruskal algorithm requires edges to be sorted by their weight
-  std::sort(aEdges.begin(), aEdges.end(),
+  std::sort(edges.begin(), edges.end(),
             [](const delaunay::Edge<qreal>& a, const delaunay::Edge<qreal>& b) {
-              return a.weight > b.weight;
+              return a.weight < b.weight;
             });
 
-  while (mstSize < mstExpectedSize && !aEdges.empty()) {
-    auto& dt = aEdges.back();
-
-    int srcTag = tags[dt.p1.id];
-    int trgTag = tags[dt.p2.id];
-    // printf("mstSize %d %d %f %d<>%d\n", mstSize, mstExpectedSize,
-    // dt.weight, srcTag, trgTag);
-
-    // Check if by adding this edge we are going to join two different
-    // forests
-    if (srcTag != trgTag) {
-      // Because edges are sorted by their weight, first we always process
-      // connected
-      // items (weight == 0). Once we stumble upon an edge with non-zero
-      // weight,
-      // it means that the rest of the lines are ratsnest.
-      if (!ratsnestLines && dt.weight >= 0) ratsnestLines = true;
-
-      // Update tags
-      if (ratsnestLines) {
-        for (auto it = cycles[trgTag].begin(); it != cycles[trgTag].end();
-             ++it) {
-          tags[aNodes[*it].id] = srcTag;
-        }
-
-        // Do a copy of edge, but make it RN_EDGE_MST. In contrary to
-        // RN_EDGE,
-        // RN_EDGE_MST saves both source and target node and does not
-        // require any other
-        // edges to exist for getting source/target nodes
-        // CN_EDGE newEdge ( dt.GetSourceNode(), dt.GetTargetNode(),
-        // dt.GetWeight() );
-
-        // assert( newEdge.GetSourceNode()->GetTag() !=
-        // newEdge.GetTargetNode()->GetTag() );
-        // assert(dt.p1.tag != dt.p2.tag);
-        mst.append(qMakePair(Point(dt.p1.x, dt.p1.y), Point(dt.p2.x, dt.p2.y)));
-        ++mstSize;
-      } else {
-        // for( it = cycles[trgTag].begin(), itEnd =
-        // cycles[trgTag].end(); it != itEnd; ++it )
-        // for( auto it : cycles[trgTag] )
-        for (auto it = cycles[trgTag].begin(); it != cycles[trgTag].end();
-             ++it) {
-          tags[aNodes[*it].id] = srcTag;
-          aNodes[*it].tag      = srcTag;
-        }
-
-        // Processing a connection, decrease the expected size of the
-        // ratsnest MST
-        --mstExpectedSize;
+  for (const delaunay::Edge<qreal>& edge : edges) {
+    if (components <= 1) {
+      break;  // all nodes are connected
+    }
+    Q_ASSERT(nodes[edge.p1.id].id == edge.p1.id);
+    Q_ASSERT(nodes[edge.p2.id].id == edge.p2.id);
+    if (sets.unite(edge.p1.id, edge.p2.id)) {
+      --components;
+      if (edge.weight >= 0) {
+        mst.append(qMakePair(Point(edge.p1.x, edge.p1.y),
+                             Point(edge.p2.x, edge.p2.y)));
       }
-
-      // Move nodes that were marked with old tag to the list marked with
-      // the new tag
-      cycles[srcTag].splice(cycles[srcTag].end(), cycles[trgTag]);
     }
-
-    // Remove the edge that was just processed
-    aEdges.pop_back();
   }
-
   return mst;
 }
 
@@ -150,9 +141,7 @@ static QVector<QPair<Point, Point>> kruskalMst(
  *  Constructors / Destructor
  ******************************************************************************/
 
-BoardAirWiresBuilder::BoardAirWiresBuilder(const Board&     board,
-                                           const NetSignal& netsignal) noexcept
-  : mBoard(board), mNetSignal(netsignal) {
+BoardAirWiresBuilder::BoardAirWiresBuilder() noexcept : mAirWiresValid(false) {
 }
 
 BoardAirWiresBuilder::~BoardAirWiresBuilder() noexcept {
@@ -162,92 +151,126 @@ BoardAirWiresBuilder::~BoardAirWiresBuilder() noexcept {
  *  General Methods
  ******************************************************************************/
 
-QVector<QPair<Point, Point>> BoardAirWiresBuilder::buildAirWires() const {
-  std::vector<delaunay::Vector2<qreal>> points;
-  QHash<const BI_NetLineAnchor*, int>   anchorMap;
-  QHash<int, QString>                   layerMap;
-  std::vector<delaunay::Edge<qreal>>    edges;
+bool BoardAirWiresBuilder::update(const Board&     board,
+                                  const NetSignal& netsignal) noexcept {
+  QVector<Anchor>                     anchors;
+  QVector<QPair<int, int>>            connections;
+  QVector<PlaneFragment>              planeFragments;
+  QHash<const BI_NetLineAnchor*, int> anchorMap;
 
   // pads
-  foreach (ComponentSignalInstance* cmpSig, mNetSignal.getComponentSignals()) {
+  foreach (ComponentSignalInstance* cmpSig, netsignal.getComponentSignals()) {
     Q_ASSERT(cmpSig);
     foreach (BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
-      if (&pad->getBoard() != &mBoard) continue;
-      int   id  = points.size();
-      Point pos = pad->getPosition();
-      points.emplace_back(pos.getX().toNm(), pos.getY().toNm(), id);
-      anchorMap[pad] = id;
+      if (&pad->getBoard() != &board) continue;
+      const Point offset = board.getAirWiresPreviewOffset(*pad);
+      anchorMap[pad]     = anchors.count();
       if (pad->getLibPad().getBoardSide() ==
           library::FootprintPad::BoardSide::THT) {
-        layerMap[id] = QString();  // on all layers
+        anchors.append(Anchor{pad->getPosition() + offset, QString()});
       } else {
-        layerMap[id] = pad->getLayerName();
+        anchors.append(
+            Anchor{pad->getPosition() + offset, pad->getLayerName()});
       }
     }
   }
 
   // vias, netpoints, netlines
-  foreach (const BI_NetSegment* netsegment, mNetSignal.getBoardNetSegments()) {
+  foreach (const BI_NetSegment* netsegment, netsignal.getBoardNetSegments()) {
     Q_ASSERT(netsegment);
-    if (&netsegment->getBoard() != &mBoard) continue;
+    if (&netsegment->getBoard() != &board) continue;
     foreach (const BI_Via* via, netsegment->getVias()) {
       Q_ASSERT(via);
-      int   id  = points.size();
-      Point pos = via->getPosition();
-      points.emplace_back(pos.getX().toNm(), pos.getY().toNm(), id);
-      anchorMap[via] = id;
-      layerMap[id]   = QString();  // on all layers
+      const Point offset = board.getAirWiresPreviewOffset(*via);
+      anchorMap[via]     = anchors.count();
+      anchors.append(Anchor{via->getPosition() + offset, QString()});
     }
     foreach (const BI_NetPoint* netpoint, netsegment->getNetPoints()) {
       Q_ASSERT(netpoint);
       if (const GraphicsLayer* layer = netpoint->getLayerOfLines()) {
-        int   id  = points.size();
-        Point pos = netpoint->getPosition();
-        points.emplace_back(pos.getX().toNm(), pos.getY().toNm(), id);
-        anchorMap[netpoint] = id;
-        layerMap[id]        = layer->getName();
+        const Point offset  = board.getAirWiresPreviewOffset(*netpoint);
+        anchorMap[netpoint] = anchors.count();
+        anchors.append(
+            Anchor{netpoint->getPosition() + offset, layer->getName()});
       }
     }
     foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
       Q_ASSERT(netline);
       Q_ASSERT(anchorMap.contains(&netline->getStartPoint()));
       Q_ASSERT(anchorMap.contains(&netline->getEndPoint()));
-      edges.emplace_back(points[anchorMap[&netline->getStartPoint()]],
-                         points[anchorMap[&netline->getEndPoint()]], -1);
+      connections.append(qMakePair(anchorMap[&netline->getStartPoint()],
+                                   anchorMap[&netline->getEndPoint()]));
     }
   }
 
-  // determine connections made by planes
-  foreach (const BI_Plane* plane, mNetSignal.getBoardPlanes()) {
+  // plane fragments
+  foreach (const BI_Plane* plane, netsignal.getBoardPlanes()) {
     Q_ASSERT(plane);
-    if (&plane->getBoard() != &mBoard) continue;
+    if (&plane->getBoard() != &board) continue;
     foreach (const Path& fragment, plane->getFragments()) {
-      int lastId = -1;
-      for (const auto& point : points) {
-        QString pointLayer = layerMap[point.id];
-        if (pointLayer.isNull() || (pointLayer == plane->getLayerName())) {
-          Point p(point.x, point.y);
-          if (fragment.toQPainterPathPx().contains(p.toPxQPointF())) {
-            if (lastId >= 0) {
-              edges.emplace_back(points[lastId], points[point.id], -1);
-            }
-            lastId = point.id;
-          }
-        }
-      }
+      planeFragments.append(PlaneFragment{*plane->getLayerName(), fragment});
     }
   }
 
+  // keep the last airwires if nothing has changed
+  if (mAirWiresValid && (anchors == mAnchors) &&
+      (connections == mConnections) && (planeFragments == mPlaneFragments)) {
+    return false;
+  }
+  if (planeFragments != mPlaneFragments) {
+    mPlaneFragments = planeFragments;
+    mPlaneFragmentIndices.clear();
+    foreach (const PlaneFragment& fragment, mPlaneFragments) {
+      QPainterPath path = fragment.outline.toQPainterPathPx();
+      mPlaneFragmentIndices.append(
+          PlaneFragmentIndex{path, path.boundingRect(), QHash<Point, bool>()});
+    }
+  }
+  mAnchors       = anchors;
+  mConnections   = connections;
+  mAirWiresValid = false;
+  return true;
+}
+
+BoardAirWiresBuilder::AirWires BoardAirWiresBuilder::buildAirWires() {
+  if (!mAirWiresValid) {
+    mAirWires      = calcAirWires();  // can throw
+    mAirWiresValid = true;
+  }
+  return mAirWires;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+BoardAirWiresBuilder::AirWires BoardAirWiresBuilder::calcAirWires(
+    const QVector<Point>& points, const QVector<QPair<int, int>>& connections) {
+  std::vector<delaunay::Vector2<qreal>> nodes;
+  std::vector<delaunay::Edge<qreal>>    edges;
+
+  // anchors
+  nodes.reserve(points.count());
+  for (int i = 0; i < points.count(); ++i) {
+    const Point& pos = points.at(i);
+    nodes.emplace_back(pos.getX().toNm(), pos.getY().toNm(), i);
+  }
+
+  // existing connections
+  foreach (const auto& connection, connections) {
+    edges.emplace_back(nodes[connection.first], nodes[connection.second], -1);
+  }
+
   // remember how many edges are already known as connected
   uint connectedEdges = edges.size();
 
   // determine additional edges between found points (candidates for airwires)
-  if (points.size() >= 3) {  // minimum 3 points needed for triangulation
+  if (nodes.size() >= 3) {  // minimum 3 points needed for triangulation
     delaunay::Delaunay<qreal> del;
-    del.triangulate(points);
+    del.triangulate(nodes);
     edges.insert(edges.end(), del.getEdges().begin(), del.getEdges().end());
-  } else if (points.size() == 2) {
-    edges.emplace_back(points[0], points[1], -1);
+  } else if (nodes.size() == 2) {
+    edges.emplace_back(nodes[0], nodes[1], -1);
   }
 
   // determine weights of these new edges
@@ -256,7 +279,53 @@ QVector<QPair<Point, Point>> BoardAirWiresBuilder::buildAirWires() const {
   }
 
   // find airwires in list of edges
-  return kruskalMst(edges, points);
+  return kruskalMst(edges, nodes);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+BoardAirWiresBuilder::AirWires BoardAirWiresBuilder::calcAirWires() {
+  QVector<Point>           points;
+  QVector<QPair<int, int>> connections = mConnections;  // netlines
+
+  // anchors
+  points.reserve(mAnchors.count());
+  foreach (const Anchor& anchor, mAnchors) {
+    points.append(anchor.position);
+  }
+
+  // determine connections made by planes
+  for (int i = 0; i < mPlaneFragments.count(); ++i) {
+    const PlaneFragment& fragment = mPlaneFragments.at(i);
+    int                  lastId   = -1;
+    for (int id = 0; id < mAnchors.count(); ++id) {
+      const Anchor& anchor = mAnchors.at(id);
+      if (anchor.layer.isNull() || (anchor.layer == fragment.layer)) {
+        if (planeFragmentContains(i, anchor.position)) {
+          if (lastId >= 0) {
+            connections.append(qMakePair(lastId, id));
+          }
+          lastId = id;
+        }
+      }
+    }
+  }
+
+  return calcAirWires(points, connections);  // can throw
+}
+
+bool BoardAirWiresBuilder::planeFragmentContains(int          index,
+                                                 const Point& pos) noexcept {
+  PlaneFragmentIndex& fragment = mPlaneFragmentIndices[index];
+  auto                it       = fragment.contains.find(pos);
+  if (it == fragment.contains.end()) {
+    QPointF p        = pos.toPxQPointF();
+    bool    contains = fragment.bounds.contains(p) && fragment.path.contains(p);
+    it               = fragment.contains.insert(pos, contains);
+  }
+  return *it;
 }
 
 /*******************************************************************************
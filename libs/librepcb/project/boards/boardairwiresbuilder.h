@@ -23,9 +23,11 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include <librepcb/common/geometry/path.h>
 #include <librepcb/common/units/point.h>
 
 #include <QtCore>
+#include <QtGui>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -42,24 +44,110 @@ class Board;
 
 /**
  * @brief The BoardAirWiresBuilder class
+ *
+ * #update() collects all data needed to build the airwires of a net signal
+ * from the board, so it must be called in the main thread. Afterwards the
+ * board is not accessed anymore, so #buildAirWires() can be called from any
+ * thread (e.g. to build the airwires of many net signals in parallel).
+ *
+ * The builder keeps the data and the airwires of the last build. If the same
+ * builder instance is used for subsequent builds of a net signal, the airwires
+ * are only calculated again if the collected data has actually changed. In
+ * addition, it caches which anchor positions are contained in which plane
+ * fragment until the plane fragments are modified, so moving anchors of a net
+ * with large planes does not require to test all anchors against all
+ * fragments again.
  */
 class BoardAirWiresBuilder final {
 public:
+  // Types
+  typedef QVector<QPair<Point, Point>> AirWires;
+
   // Constructors / Destructor
-  BoardAirWiresBuilder()                                  = delete;
   BoardAirWiresBuilder(const BoardAirWiresBuilder& other) = delete;
-  BoardAirWiresBuilder(const Board& board, const NetSignal& netsignal) noexcept;
+  BoardAirWiresBuilder() noexcept;
   ~BoardAirWiresBuilder() noexcept;
 
   // General Methods
-  QVector<QPair<Point, Point>> buildAirWires() const;
+
+  /**
+   * @brief Collect the data of a net signal from a board
+   *
+   * @param board       The board to build the airwires for
+   * @param netsignal   The net signal to build the airwires for
+   *
+   * @retval true   If the data has changed since the last call
+   * @retval false  If the data is unchanged, i.e. #buildAirWires() will return
+   *                the airwires of the last build without calculating them
+   */
+  bool update(const Board& board, const NetSignal& netsignal) noexcept;
+
+  /**
+   * @brief Build the airwires from the data collected by #update()
+   *
+   * @note This method can be called from any thread, but not from multiple
+   *       threads at the same time for the same builder.
+   *
+   * @return The airwires
+   */
+  AirWires buildAirWires();
+
+  // Static Methods
+
+  /**
+   * @brief Calculate the airwires between some points
+   *
+   * This is the calculation done by #buildAirWires() once the connections made
+   * by planes are known: The airwires are the minimum spanning forest of the
+   * Delaunay triangulation of all points, without the existing connections.
+   *
+   * @param points        Positions of all anchors
+   * @param connections   Pairs of indices of already connected points
+   *
+   * @return The airwires
+   */
+  static AirWires calcAirWires(const QVector<Point>&           points,
+                               const QVector<QPair<int, int>>& connections);
 
   // Operator Overloadings
   BoardAirWiresBuilder& operator=(const BoardAirWiresBuilder& rhs) = delete;
 
+private:  // Types
+  struct Anchor {
+    Point   position;
+    QString layer;  ///< Null means "on all layers"
+
+    bool operator==(const Anchor& rhs) const noexcept {
+      return (position == rhs.position) && (layer == rhs.layer);
+    }
+  };
+  struct PlaneFragment {
+    QString layer;
+    Path    outline;
+
+    bool operator==(const PlaneFragment& rhs) const noexcept {
+      return (layer == rhs.layer) && (outline == rhs.outline);
+    }
+  };
+  struct PlaneFragmentIndex {
+    QPainterPath       path;
+    QRectF             bounds;
+    QHash<Point, bool> contains;  ///< Cached results of containment tests
+  };
+
+private:  // Methods
+  AirWires calcAirWires();
+  bool     planeFragmentContains(int index, const Point& pos) noexcept;
+
 private:  // Data
-  const Board&     mBoard;
-  const NetSignal& mNetSignal;
+  QVector<Anchor>             mAnchors;
+  QVector<QPair<int, int>>    mConnections;  ///< Anchor indices of netlines
+  QVector<PlaneFragment>      mPlaneFragments;
+  QVector<PlaneFragmentIndex> mPlaneFragmentIndices;  ///< One per fragment
+
+  // Result of the last build
+  bool     mAirWiresValid;
+  AirWires mAirWires;
 };
 
 /*******************************************************************************
@@ -0,0 +1,164 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boardassemblyexport.h"
+
+#include "../circuit/circuit.h"
+#include "../circuit/componentinstance.h"
+#include "../project.h"
+#include "../settings/projectsettings.h"
+#include "board.h"
+#include "items/bi_device.h"
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/pkg/package.h>
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardAssemblyExport::BoardAssemblyExport(const Board& board) noexcept
+  : mBoard(board) {
+}
+
+BoardAssemblyExport::~BoardAssemblyExport() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QByteArray BoardAssemblyExport::generateBom() const noexcept {
+  const QStringList& localeOrder =
+      mBoard.getProject().getSettings().getLocaleOrder();
+
+  // Group the devices by library device and value. Since the devices are
+  // sorted by designator, the groups are sorted by their first designator.
+  QList<QList<const BI_Device*>>   groups;
+  QHash<QPair<Uuid, QString>, int> groupIndices;
+  foreach (const BI_Device* device, getSortedDevices()) {
+    auto key = qMakePair(device->getLibDevice().getUuid(),
+                         device->getComponentInstance().getValue(true));
+    if (!groupIndices.contains(key)) {
+      groupIndices.insert(key, groups.count());
+      groups.append(QList<const BI_Device*>());
+    }
+    groups[groupIndices.value(key)].append(device);
+  }
+
+  QByteArray out;
+  appendRow(out, {tr("Quantity"), tr("Designators"), tr("Value"), tr("Device"),
+                  tr("Package")});
+  foreach (const QList<const BI_Device*>& group, groups) {
+    const BI_Device* first = group.first();
+    QStringList      designators;
+    foreach (const BI_Device* device, group) {
+      designators.append(*device->getComponentInstance().getName());
+    }
+    appendRow(out, {QString::number(group.count()), designators.join(", "),
+                    first->getComponentInstance().getValue(true),
+                    *first->getLibDevice().getNames().value(localeOrder),
+                    *first->getLibPackage().getNames().value(localeOrder)});
+  }
+  return out;
+}
+
+QByteArray BoardAssemblyExport::generatePickPlace() const noexcept {
+  const QStringList& localeOrder =
+      mBoard.getProject().getSettings().getLocaleOrder();
+
+  QByteArray out;
+  appendRow(out, {tr("Designator"), tr("Value"), tr("Device"), tr("Package"),
+                  tr("Position X (mm)"), tr("Position Y (mm)"),
+                  tr("Rotation (deg)"), tr("Side")});
+  foreach (const BI_Device* device, getSortedDevices()) {
+    const ComponentInstance& cmp = device->getComponentInstance();
+    appendRow(out, {*cmp.getName(), cmp.getValue(true),
+                    *device->getLibDevice().getNames().value(localeOrder),
+                    *device->getLibPackage().getNames().value(localeOrder),
+                    device->getPosition().getX().toMmString(),
+                    device->getPosition().getY().toMmString(),
+                    device->getRotation().mappedTo0_360deg().toDegString(),
+                    device->getIsMirrored() ? "bottom" : "top"});
+  }
+  return out;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<const BI_Device*> BoardAssemblyExport::getSortedDevices() const
+    noexcept {
+  // Iterate over the component instances of the circuit since components
+  // without a device on this board are not assembled.
+  QList<const BI_Device*> devices;
+  foreach (const ComponentInstance* cmp,
+           mBoard.getProject().getCircuit().getComponentInstances()) {
+    if (const BI_Device* device =
+            mBoard.getDeviceInstanceByComponentUuid(cmp->getUuid())) {
+      devices.append(device);
+    }
+  }
+
+  // Sort by designator, with numbers compared by value (e.g. R2 < R10).
+  QCollator collator;
+  collator.setNumericMode(true);
+  collator.setCaseSensitivity(Qt::CaseInsensitive);
+  std::sort(devices.begin(), devices.end(),
+            [&collator](const BI_Device* lhs, const BI_Device* rhs) {
+              return collator(*lhs->getComponentInstance().getName(),
+                              *rhs->getComponentInstance().getName());
+            });
+  return devices;
+}
+
+void BoardAssemblyExport::appendRow(QByteArray&        out,
+                                    const QStringList& row) noexcept {
+  for (int i = 0; i < row.count(); ++i) {
+    if (i > 0) {
+      out.append(',');
+    }
+    QString field = row.at(i);
+    out.append('"');
+    out.append(field.replace('"', "\"\"").toUtf8());
+    out.append('"');
+  }
+  out.append('\n');
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
@@ -17,15 +17,13 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef LIBREPCB_PROJECT_BI_AIRWIRE_H
-#define LIBREPCB_PROJECT_BI_AIRWIRE_H
+
+#ifndef LIBREPCB_PROJECT_BOARDASSEMBLYEXPORT_H
+#define LIBREPCB_PROJECT_BOARDASSEMBLYEXPORT_H
 
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "../graphicsitems/bgi_airwire.h"
-#include "bi_base.h"
-
 #include <QtCore>
 
 /*******************************************************************************
@@ -34,51 +32,49 @@
 namespace librepcb {
 namespace project {
 
+class Board;
+class BI_Device;
+
 /*******************************************************************************
- *  Class BI_AirWire
+ *  Class BoardAssemblyExport
  ******************************************************************************/
 
 /**
- * @brief The BI_AirWire class
+ * @brief Generates the assembly data of a board as CSV files
+ *
+ * Two files are supported:
+ *   - The bill of materials (BOM) lists all devices of the board, grouped by
+ *     their library device and value.
+ *   - The pick&place file lists the position, rotation and side of each
+ *     device.
+ *
+ * Only the component instances of the circuit and the device instances of
+ * the board are needed, so the board can be loaded without building its
+ * planes and airwires (see librepcb::project::Board::load()).
  */
-class BI_AirWire final : public BI_Base {
-  Q_OBJECT
+class BoardAssemblyExport final {
+  Q_DECLARE_TR_FUNCTIONS(BoardAssemblyExport)
 
 public:
   // Constructors / Destructor
-  BI_AirWire()                        = delete;
-  BI_AirWire(const BI_AirWire& other) = delete;
-  BI_AirWire(Board& board, const NetSignal& netsignal, const Point& p1,
-             const Point& p2);
-  ~BI_AirWire() noexcept;
-
-  // Getters
-  const NetSignal& getNetSignal() const noexcept { return mNetSignal; }
-  const Point&     getP1() const noexcept { return mP1; }
-  const Point&     getP2() const noexcept { return mP2; }
-  bool             isVertical() const noexcept { return mP1 == mP2; }
+  BoardAssemblyExport()                                 = delete;
+  BoardAssemblyExport(const BoardAssemblyExport& other) = delete;
+  explicit BoardAssemblyExport(const Board& board) noexcept;
+  ~BoardAssemblyExport() noexcept;
 
   // General Methods
-  void addToBoard() override;
-  void removeFromBoard() override;
-
-  // Inherited from BI_Base
-  Type_t getType() const noexcept override { return BI_Base::Type_t::AirWire; }
-  const Point& getPosition() const noexcept override { return mP1; }
-  bool         getIsMirrored() const noexcept override { return false; }
-  QPainterPath getGrabAreaScenePx() const noexcept override;
-  void         setSelected(bool selected) noexcept override;
-  bool         isSelectable() const noexcept override;
+  QByteArray generateBom() const noexcept;
+  QByteArray generatePickPlace() const noexcept;
 
   // Operator Overloadings
-  BI_AirWire& operator=(const BI_AirWire& rhs) = delete;
+  BoardAssemblyExport& operator=(const BoardAssemblyExport& rhs) = delete;
+
+private:  // Methods
+  QList<const BI_Device*> getSortedDevices() const noexcept;
+  static void appendRow(QByteArray& out, const QStringList& row) noexcept;
 
-private:
-  QScopedPointer<BGI_AirWire> mGraphicsItem;
-  QMetaObject::Connection     mHighlightChangedConnection;
-  const NetSignal&            mNetSignal;
-  Point                       mP1;
-  Point                       mP2;
+private:  // Data
+  const Board& mBoard;
 };
 
 /*******************************************************************************
@@ -88,4 +84,4 @@ private:
 }  // namespace project
 }  // namespace librepcb
 
-#endif  // LIBREPCB_PROJECT_BI_AIRWIRE_H
+#endif  // LIBREPCB_PROJECT_BOARDASSEMBLYEXPORT_H
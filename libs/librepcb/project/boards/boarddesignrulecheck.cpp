@@ -0,0 +1,430 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boarddesignrulecheck.h"
+
+#include "../circuit/componentinstance.h"
+#include "../circuit/netsignal.h"
+#include "board.h"
+#include "boardlayerstack.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_netline.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_plane.h"
+#include "items/bi_via.h"
+
+#include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/utils/taskscheduler.h>
+#include <librepcb/library/pkg/packagepad.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardDesignRuleCheck::BoardDesignRuleCheck() noexcept
+  : mCheckedObjectsCount(0) {
+}
+
+BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+const QVector<BoardDesignRuleCheck::Violation>& BoardDesignRuleCheck::check(
+    const Snapshot& snapshot) noexcept {
+  // a modified clearance affects all pairs
+  if (mLastClearance != snapshot.clearance) {
+    mLastResults.clear();
+  }
+
+  // The layers are independent of each other and the snapshot is only read,
+  // so check them in parallel.
+  QList<QFuture<LayerResult>> futures;
+  foreach (const Layer& layer, snapshot.layers) {
+    auto               it = mLastResults.constFind(layer.name);
+    const LayerResult* previous =
+        (it != mLastResults.constEnd()) ? &(*it) : nullptr;
+    const Layer*   l         = &layer;
+    UnsignedLength clearance = snapshot.clearance;
+    futures.append(TaskScheduler::run(
+        TaskScheduler::Priority::Interactive, [l, clearance, previous]() {
+          return checkLayer(*l, clearance, previous);
+        }));
+  }
+  QHash<QString, LayerResult> results;
+  for (int i = 0; i < futures.count(); ++i) {
+    results.insert(snapshot.layers.at(i).name, futures.at(i).result());
+  }
+
+  // collect the results in the order of the layers
+  mViolations.clear();
+  mCheckedObjectsCount = 0;
+  foreach (const Layer& layer, snapshot.layers) {
+    const LayerResult& result = results[layer.name];
+    mViolations += result.violations;
+    mCheckedObjectsCount += result.checkedObjectsCount;
+  }
+  mLastResults   = results;
+  mLastClearance = snapshot.clearance;
+  return mViolations;
+}
+
+void BoardDesignRuleCheck::reset() noexcept {
+  mLastClearance = tl::nullopt;
+  mLastResults.clear();
+  mViolations.clear();
+  mCheckedObjectsCount = 0;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+BoardDesignRuleCheck::Snapshot BoardDesignRuleCheck::createSnapshot(
+    const Board& board) noexcept {
+  PositiveLength tolerance = maxArcTolerance();
+  Snapshot snapshot{board.getDesignRules().getCopperClearance(), {}};
+
+  QStringList layerNames;
+  layerNames.append(GraphicsLayer::sTopCopper);
+  for (int i = 1; i <= board.getLayerStack().getInnerLayerCount(); ++i) {
+    layerNames.append(GraphicsLayer::getInnerLayerName(i));
+  }
+  layerNames.append(GraphicsLayer::sBotCopper);
+
+  foreach (const QString& layerName, layerNames) {
+    Layer layer{layerName, {}};
+
+    // pads
+    foreach (const BI_Device* device, board.getDeviceInstances()) {
+      foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+        if (!pad->isOnLayer(layerName)) continue;
+        const NetSignal* netSignal = pad->getCompSigInstNetSignal();
+        addObject(
+            layer,
+            QString("pad:%1/%2").arg(device->getComponentInstanceUuid().toStr(),
+                                     pad->getLibPadUuid().toStr()),
+            tr("pad \"%1\" of \"%2\"")
+                .arg(*pad->getLibPackagePad().getName(),
+                     *device->getComponentInstance().getName()),
+            netSignal ? tl::make_optional(netSignal->getUuid()) : tl::nullopt,
+            pad->getClipperSceneOutline(Length(0), tolerance));
+      }
+    }
+
+    // vias and traces
+    foreach (const BI_NetSegment* netsegment, board.getNetSegments()) {
+      const NetSignal& netSignal = netsegment->getNetSignal();
+      foreach (const BI_Via* via, netsegment->getVias()) {
+        if (!via->isOnLayer(layerName)) continue;
+        addObject(layer, QString("via:%1").arg(via->getUuid().toStr()),
+                  tr("via of net \"%1\"").arg(*netSignal.getName()),
+                  netSignal.getUuid(),
+                  via->getClipperSceneOutline(Length(0), tolerance));
+      }
+      foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+        if (netline->getLayer().getName() != layerName) continue;
+        addObject(layer, QString("trace:%1").arg(netline->getUuid().toStr()),
+                  tr("trace of net \"%1\"").arg(*netSignal.getName()),
+                  netSignal.getUuid(),
+                  netline->getClipperSceneOutline(Length(0), tolerance));
+      }
+    }
+
+    // plane fragments
+    foreach (const BI_Plane* plane, board.getPlanes()) {
+      if (*plane->getLayerName() != layerName) continue;
+      const NetSignal& netSignal = plane->getNetSignal();
+      for (int i = 0; i < plane->getFragments().count(); ++i) {
+        addObject(
+            layer, QString("plane:%1/%2").arg(plane->getUuid().toStr()).arg(i),
+            tr("plane of net \"%1\"").arg(*netSignal.getName()),
+            netSignal.getUuid(),
+            ClipperHelpers::convert(plane->getFragments().at(i), tolerance));
+      }
+    }
+
+    std::sort(layer.objects.begin(), layer.objects.end(),
+              [](const Object& a, const Object& b) { return a.key < b.key; });
+    snapshot.layers.append(layer);
+  }
+  return snapshot;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+BoardDesignRuleCheck::LayerResult BoardDesignRuleCheck::checkLayer(
+    const Layer& layer, const UnsignedLength& clearance,
+    const LayerResult* previous) noexcept {
+  LayerResult result;
+  result.checkedObjectsCount = 0;
+
+  // determine new and modified objects
+  QVector<bool> dirty;
+  for (const Object& obj : layer.objects) {
+    QByteArray fingerprint = calcFingerprint(obj);
+    bool       isDirty     = (!previous) ||
+        (previous->fingerprints.value(obj.key) != fingerprint);
+    result.fingerprints.insert(obj.key, fingerprint);
+    dirty.append(isDirty);
+    if (isDirty) ++result.checkedObjectsCount;
+  }
+
+  // keep violations between unmodified objects
+  if (previous) {
+    QHash<QString, bool> isDirty;
+    for (int i = 0; i < layer.objects.count(); ++i) {
+      isDirty.insert(layer.objects.at(i).key, dirty.at(i));
+    }
+    foreach (const Violation& violation, previous->violations) {
+      if ((!isDirty.value(violation.object1, true)) &&
+          (!isDirty.value(violation.object2, true))) {
+        result.violations.append(violation);
+      }
+    }
+  }
+
+  // Sweep a line from left to right over the bounding boxes of all objects,
+  // only objects which are currently crossed by the line can be too close.
+  ClipperLib::cInt c = clearance->toNm();
+  QVector<int>     order;
+  for (int i = 0; i < layer.objects.count(); ++i) {
+    order.append(i);
+  }
+  std::sort(order.begin(), order.end(), [&layer](int a, int b) {
+    return layer.objects.at(a).bounds.left < layer.objects.at(b).bounds.left;
+  });
+  QVector<int> active;
+  foreach (int i, order) {
+    const Object& obj = layer.objects.at(i);
+    active.erase(std::remove_if(active.begin(), active.end(),
+                                [&](int j) {
+                                  return layer.objects.at(j).bounds.right + c <
+                                      obj.bounds.left;
+                                }),
+                 active.end());
+    foreach (int j, active) {
+      if ((!dirty.at(i)) && (!dirty.at(j))) continue;
+      const Object& other = layer.objects.at(j);
+      if ((obj.bounds.top > other.bounds.bottom + c) ||
+          (other.bounds.top > obj.bounds.bottom + c)) {
+        continue;
+      }
+      if (obj.netSignal && (obj.netSignal == other.netSignal)) continue;
+      Point position;
+      if (isTooClose(obj, other, static_cast<qreal>(c), position)) {
+        const Object& first  = (obj.key < other.key) ? obj : other;
+        const Object& second = (obj.key < other.key) ? other : obj;
+        result.violations.append(Violation{
+            layer.name, first.key, second.key,
+            tr("Clearance violation between %1 and %2")
+                .arg(first.description, second.description),
+            position});
+      }
+    }
+    active.append(i);
+  }
+
+  std::sort(result.violations.begin(), result.violations.end(),
+            [](const Violation& a, const Violation& b) {
+              return (a.object1 != b.object1) ? (a.object1 < b.object1)
+                                              : (a.object2 < b.object2);
+            });
+  return result;
+}
+
+static qreal cross(const ClipperLib::IntPoint& o, const ClipperLib::IntPoint& a,
+                   const ClipperLib::IntPoint& b) noexcept {
+  return static_cast<qreal>(a.X - o.X) * static_cast<qreal>(b.Y - o.Y) -
+      static_cast<qreal>(a.Y - o.Y) * static_cast<qreal>(b.X - o.X);
+}
+
+static qreal calcDistanceSq(const ClipperLib::IntPoint& p,
+                            const ClipperLib::IntPoint& a,
+                            const ClipperLib::IntPoint& b,
+                            QPointF&                    closest) noexcept {
+  qreal dx    = static_cast<qreal>(b.X - a.X);
+  qreal dy    = static_cast<qreal>(b.Y - a.Y);
+  qreal lenSq = dx * dx + dy * dy;
+  qreal t     = 0;
+  if (lenSq > 0) {
+    t = (static_cast<qreal>(p.X - a.X) * dx +
+         static_cast<qreal>(p.Y - a.Y) * dy) /
+        lenSq;
+    t = qBound(qreal(0), t, qreal(1));
+  }
+  closest  = QPointF(a.X + t * dx, a.Y + t * dy);
+  qreal ex = static_cast<qreal>(p.X) - closest.x();
+  qreal ey = static_cast<qreal>(p.Y) - closest.y();
+  return ex * ex + ey * ey;
+}
+
+static qreal calcDistanceSq(const ClipperLib::IntPoint& a1,
+                            const ClipperLib::IntPoint& a2,
+                            const ClipperLib::IntPoint& b1,
+                            const ClipperLib::IntPoint& b2,
+                            QPointF&                    position) noexcept {
+  // intersecting segments
+  qreal d1 = cross(b1, b2, a1);
+  qreal d2 = cross(b1, b2, a2);
+  qreal d3 = cross(a1, a2, b1);
+  qreal d4 = cross(a1, a2, b2);
+  if ((((d1 > 0) && (d2 < 0)) || ((d1 < 0) && (d2 > 0))) &&
+      (((d3 > 0) && (d4 < 0)) || ((d3 < 0) && (d4 > 0)))) {
+    qreal t  = d1 / (d1 - d2);
+    position = QPointF(a1.X + t * (a2.X - a1.X), a1.Y + t * (a2.Y - a1.Y));
+    return 0;
+  }
+
+  // otherwise the minimum distance is always at one of the end points
+  QPointF closest;
+  qreal   minDistSq = calcDistanceSq(a1, b1, b2, closest);
+  QPointF from      = QPointF(a1.X, a1.Y);
+  QPointF to        = closest;
+  qreal   distSq    = calcDistanceSq(a2, b1, b2, closest);
+  if (distSq < minDistSq) {
+    minDistSq = distSq;
+    from      = QPointF(a2.X, a2.Y);
+    to        = closest;
+  }
+  distSq = calcDistanceSq(b1, a1, a2, closest);
+  if (distSq < minDistSq) {
+    minDistSq = distSq;
+    from      = QPointF(b1.X, b1.Y);
+    to        = closest;
+  }
+  distSq = calcDistanceSq(b2, a1, a2, closest);
+  if (distSq < minDistSq) {
+    minDistSq = distSq;
+    from      = QPointF(b2.X, b2.Y);
+    to        = closest;
+  }
+  position = (from + to) / 2;
+  return minDistSq;
+}
+
+static QVector<int> getEdgesInRect(const ClipperLib::Path&    path,
+                                   const ClipperLib::IntRect& rect) noexcept {
+  QVector<int> edges;
+  for (std::size_t i = 0; i < path.size(); ++i) {
+    const ClipperLib::IntPoint& p1 = path.at(i);
+    const ClipperLib::IntPoint& p2 = path.at((i + 1) % path.size());
+    if ((qMax(p1.X, p2.X) >= rect.left) && (qMin(p1.X, p2.X) <= rect.right) &&
+        (qMax(p1.Y, p2.Y) >= rect.top) && (qMin(p1.Y, p2.Y) <= rect.bottom)) {
+      edges.append(static_cast<int>(i));
+    }
+  }
+  return edges;
+}
+
+bool BoardDesignRuleCheck::isTooClose(const Object& a, const Object& b,
+                                      qreal clearance,
+                                      Point& position) noexcept {
+  // one object contained in the other one
+  if (ClipperLib::PointInPolygon(b.outline.front(), a.outline) != 0) {
+    position = ClipperHelpers::convert(b.outline.front());
+    return true;
+  }
+  if (ClipperLib::PointInPolygon(a.outline.front(), b.outline) != 0) {
+    position = ClipperHelpers::convert(a.outline.front());
+    return true;
+  }
+
+  // Only edges near the other object need to be compared. This is important
+  // for large objects like plane fragments.
+  ClipperLib::cInt    c     = static_cast<ClipperLib::cInt>(clearance);
+  ClipperLib::IntRect rectA = {a.bounds.left - c, a.bounds.top - c,
+                               a.bounds.right + c, a.bounds.bottom + c};
+  ClipperLib::IntRect rectB = {b.bounds.left - c, b.bounds.top - c,
+                               b.bounds.right + c, b.bounds.bottom + c};
+  QVector<int> edgesA = getEdgesInRect(a.outline, rectB);
+  QVector<int> edgesB = getEdgesInRect(b.outline, rectA);
+  qreal        clearanceSq = clearance * clearance;
+  foreach (int i, edgesA) {
+    const ClipperLib::IntPoint& a1 = a.outline.at(i);
+    const ClipperLib::IntPoint& a2 = a.outline.at((i + 1) % a.outline.size());
+    foreach (int j, edgesB) {
+      const ClipperLib::IntPoint& b1 = b.outline.at(j);
+      const ClipperLib::IntPoint& b2 =
+          b.outline.at((j + 1) % b.outline.size());
+      QPointF pos;
+      qreal   distSq = calcDistanceSq(a1, a2, b1, b2, pos);
+      // Note: Touching objects are always a violation, even with a zero
+      // clearance.
+      if ((distSq < clearanceSq) || (distSq == 0)) {
+        position = Point(qRound64(pos.x()), qRound64(pos.y()));
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+QByteArray BoardDesignRuleCheck::calcFingerprint(const Object& obj) noexcept {
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  hash.addData(obj.description.toUtf8());
+  hash.addData(obj.netSignal ? obj.netSignal->toStr().toUtf8() : QByteArray());
+  hash.addData(reinterpret_cast<const char*>(obj.outline.data()),
+               static_cast<int>(obj.outline.size() *
+                                sizeof(ClipperLib::IntPoint)));
+  return hash.result();
+}
+
+void BoardDesignRuleCheck::addObject(Layer& layer, const QString& key,
+                                     const QString&            description,
+                                     const tl::optional<Uuid>& netSignal,
+                                     const ClipperLib::Path& outline) noexcept {
+  if (outline.empty()) return;
+  Object obj{key, description, netSignal, outline, {0, 0, 0, 0}};
+  obj.bounds = {outline.front().X, outline.front().Y, outline.front().X,
+                outline.front().Y};
+  for (const ClipperLib::IntPoint& p : outline) {
+    obj.bounds.left   = qMin(obj.bounds.left, p.X);
+    obj.bounds.top    = qMin(obj.bounds.top, p.Y);
+    obj.bounds.right  = qMax(obj.bounds.right, p.X);
+    obj.bounds.bottom = qMax(obj.bounds.bottom, p.Y);
+  }
+  layer.objects.append(obj);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
@@ -0,0 +1,183 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+#define LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <clipper/clipper.hpp>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+
+/*******************************************************************************
+ *  Class BoardDesignRuleCheck
+ ******************************************************************************/
+
+/**
+ * @brief Checks the copper clearances of a board against its design rules
+ *
+ * All pads, vias, traces and plane fragments of each copper layer are
+ * collected in a #Snapshot (which must be done in the main thread). Then
+ * #check() compares every pair of objects of different net signals which
+ * are closer than librepcb::BoardDesignRules::getCopperClearance():
+ *
+ *   - Candidate pairs are determined by a sweep line over the bounding boxes
+ *     of all objects of a layer.
+ *   - For the remaining pairs, the exact distance between the outlines is
+ *     calculated from their integer nanometer coordinates.
+ *   - Since the layers are independent of each other, they are checked in
+ *     parallel.
+ *
+ * The object keeps the results of the last check. Subsequent calls to
+ * #check() only compare pairs where at least one object has changed (or was
+ * added) since the last check, and reuse the results of all other pairs.
+ */
+class BoardDesignRuleCheck final {
+  Q_DECLARE_TR_FUNCTIONS(BoardDesignRuleCheck)
+
+public:
+  // Types
+  struct Object {
+    QString             key;          ///< Unique identifier of the object
+    QString             description;  ///< Human readable name
+    tl::optional<Uuid>  netSignal;    ///< None for unconnected pads
+    ClipperLib::Path    outline;      ///< Copper area [nm]
+    ClipperLib::IntRect bounds;       ///< Bounding box of #outline [nm]
+  };
+
+  struct Layer {
+    QString         name;
+    QVector<Object> objects;  ///< Sorted by Object::key
+  };
+
+  struct Snapshot {
+    UnsignedLength clearance;
+    QVector<Layer> layers;
+  };
+
+  struct Violation {
+    QString layer;
+    QString object1;  ///< Key of the first object (the lower one)
+    QString object2;  ///< Key of the second object (the higher one)
+    QString message;
+    Point   position;  ///< Location where the clearance is violated
+
+    bool operator==(const Violation& rhs) const noexcept {
+      return (layer == rhs.layer) && (object1 == rhs.object1) &&
+          (object2 == rhs.object2) && (message == rhs.message) &&
+          (position == rhs.position);
+    }
+  };
+
+  // Constructors / Destructor
+  BoardDesignRuleCheck() noexcept;
+  BoardDesignRuleCheck(const BoardDesignRuleCheck& other) = delete;
+  ~BoardDesignRuleCheck() noexcept;
+
+  // Getters
+  const QVector<Violation>& getViolations() const noexcept {
+    return mViolations;
+  }
+
+  /**
+   * @brief Get the number of objects compared in the last #check()
+   *
+   * @return Number of new or modified objects
+   */
+  int getCheckedObjectsCount() const noexcept { return mCheckedObjectsCount; }
+
+  // General Methods
+
+  /**
+   * @brief Check all objects of a snapshot
+   *
+   * @param snapshot  The copper objects to check
+   *
+   * @return All violations, ordered by layer and object keys (i.e. the result
+   *         does not depend on the order in which the layers were checked)
+   */
+  const QVector<Violation>& check(const Snapshot& snapshot) noexcept;
+
+  /**
+   * @brief Forget the results of the last check
+   *
+   * The next #check() will compare all objects again.
+   */
+  void reset() noexcept;
+
+  // Static Methods
+  static Snapshot createSnapshot(const Board& board) noexcept;
+
+  // Operator Overloadings
+  BoardDesignRuleCheck& operator=(const BoardDesignRuleCheck& rhs) = delete;
+
+private:  // Types
+  struct LayerResult {
+    QHash<QString, QByteArray> fingerprints;  ///< Per object key
+    QVector<Violation>         violations;    ///< Sorted by object keys
+    int                        checkedObjectsCount;
+  };
+
+private:  // Methods
+  static LayerResult checkLayer(const Layer&          layer,
+                                const UnsignedLength& clearance,
+                                const LayerResult*    previous) noexcept;
+  static bool       isTooClose(const Object& a, const Object& b,
+                               qreal clearance, Point& position) noexcept;
+  static QByteArray calcFingerprint(const Object& obj) noexcept;
+  static void       addObject(Layer& layer, const QString& key,
+                              const QString&            description,
+                              const tl::optional<Uuid>& netSignal,
+                              const ClipperLib::Path&   outline) noexcept;
+
+  /**
+   * Returns the maximum allowed arc tolerance when flattening arcs. Same as
+   * the tolerance used to build plane fragments for fabrication.
+   */
+  static PositiveLength maxArcTolerance() noexcept {
+    return PositiveLength(5000);  // 5um
+  }
+
+private:  // Data
+  tl::optional<UnsignedLength> mLastClearance;
+  QHash<QString, LayerResult>  mLastResults;  ///< Per layer name
+  QVector<Violation>           mViolations;
+  int                          mCheckedObjectsCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
@@ -56,8 +56,13 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings() noexcept
     mSilkscreenLayersBot(
         {GraphicsLayer::sBotPlacement, GraphicsLayer::sBotNames}),
     mMergeDrillFiles(false),
+    mMergeCopperAreas(false),
+    mRecoverCopperArcs(false),
     mEnableSolderPasteTop(false),
-    mEnableSolderPasteBot(false) {
+    mEnableSolderPasteBot(false),
+    mPanelColumns(1),
+    mPanelRows(1),
+    mPanelSpacing(2000000) {
 }
 
 BoardFabricationOutputSettings::BoardFabricationOutputSettings(
@@ -90,6 +95,23 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings(
   mMergeDrillFiles      = node.getValueByPath<bool>("drills/merge");
   mEnableSolderPasteTop = node.getValueByPath<bool>("solderpaste_top/create");
   mEnableSolderPasteBot = node.getValueByPath<bool>("solderpaste_bot/create");
+  if (const SExpression* child = node.tryGetChildByPath("copper_merge")) {
+    mMergeCopperAreas = child->getValueOfFirstChild<bool>();
+  }
+  if (const SExpression* child = node.tryGetChildByPath("copper_arcs")) {
+    mRecoverCopperArcs = child->getValueOfFirstChild<bool>();
+  }
+  if (const SExpression* child = node.tryGetChildByPath("panel")) {
+    mPanelColumns = child->getValueByPath<int>("columns");
+    mPanelRows    = child->getValueByPath<int>("rows");
+    mPanelSpacing = child->getValueByPath<UnsignedLength>("spacing");
+    if ((mPanelColumns < 1) || (mPanelRows < 1)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Invalid panel size: %1x%2"))
+                             .arg(mPanelColumns)
+                             .arg(mPanelRows));
+    }
+  }
 
   mSilkscreenLayersTop.clear();
   foreach (const SExpression& child,
@@ -121,6 +143,8 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const {
       .appendChild("suffix", mSuffixCopperInner, false);
   root.appendList("copper_bot", true)
       .appendChild("suffix", mSuffixCopperBot, false);
+  root.appendChild("copper_merge", mMergeCopperAreas, true);
+  root.appendChild("copper_arcs", mRecoverCopperArcs, true);
   root.appendList("soldermask_top", true)
       .appendChild("suffix", mSuffixSolderMaskTop, false);
   root.appendList("soldermask_bot", true)
@@ -153,6 +177,11 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const {
   SExpression& solderPasteBot = root.appendList("solderpaste_bot", true);
   solderPasteBot.appendChild("create", mEnableSolderPasteBot, false);
   solderPasteBot.appendChild("suffix", mSuffixSolderPasteBot, false);
+
+  SExpression& panel = root.appendList("panel", true);
+  panel.appendChild("columns", mPanelColumns, false);
+  panel.appendChild("rows", mPanelRows, false);
+  panel.appendChild("spacing", mPanelSpacing, false);
 }
 
 /*******************************************************************************
@@ -178,8 +207,13 @@ BoardFabricationOutputSettings& BoardFabricationOutputSettings::operator=(
   mSilkscreenLayersTop  = rhs.mSilkscreenLayersTop;
   mSilkscreenLayersBot  = rhs.mSilkscreenLayersBot;
   mMergeDrillFiles      = rhs.mMergeDrillFiles;
+  mMergeCopperAreas     = rhs.mMergeCopperAreas;
+  mRecoverCopperArcs    = rhs.mRecoverCopperArcs;
   mEnableSolderPasteTop = rhs.mEnableSolderPasteTop;
   mEnableSolderPasteBot = rhs.mEnableSolderPasteBot;
+  mPanelColumns         = rhs.mPanelColumns;
+  mPanelRows            = rhs.mPanelRows;
+  mPanelSpacing         = rhs.mPanelSpacing;
   return *this;
 }
 
@@ -202,8 +236,13 @@ bool BoardFabricationOutputSettings::operator==(
   if (mSilkscreenLayersTop != rhs.mSilkscreenLayersTop) return false;
   if (mSilkscreenLayersBot != rhs.mSilkscreenLayersBot) return false;
   if (mMergeDrillFiles != rhs.mMergeDrillFiles) return false;
+  if (mMergeCopperAreas != rhs.mMergeCopperAreas) return false;
+  if (mRecoverCopperArcs != rhs.mRecoverCopperArcs) return false;
   if (mEnableSolderPasteTop != rhs.mEnableSolderPasteTop) return false;
   if (mEnableSolderPasteBot != rhs.mEnableSolderPasteBot) return false;
+  if (mPanelColumns != rhs.mPanelColumns) return false;
+  if (mPanelRows != rhs.mPanelRows) return false;
+  if (mPanelSpacing != rhs.mPanelSpacing) return false;
   return true;
 }
 
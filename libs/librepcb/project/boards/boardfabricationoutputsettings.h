@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/units/length.h>
 
 #include <QtCore>
 
@@ -41,6 +42,8 @@ namespace project {
  * @brief The BoardFabricationOutputSettings class
  */
 class BoardFabricationOutputSettings final : public SerializableObject {
+  Q_DECLARE_TR_FUNCTIONS(BoardFabricationOutputSettings)
+
 public:
   // Constructors / Destructor
   BoardFabricationOutputSettings() noexcept;
@@ -93,12 +96,22 @@ public:
     return mSilkscreenLayersBot;
   }
   bool getMergeDrillFiles() const noexcept { return mMergeDrillFiles; }
+  bool getMergeCopperAreas() const noexcept { return mMergeCopperAreas; }
+  bool getRecoverCopperArcs() const noexcept { return mRecoverCopperArcs; }
   bool getEnableSolderPasteTop() const noexcept {
     return mEnableSolderPasteTop;
   }
   bool getEnableSolderPasteBot() const noexcept {
     return mEnableSolderPasteBot;
   }
+  int  getPanelColumns() const noexcept { return mPanelColumns; }
+  int  getPanelRows() const noexcept { return mPanelRows; }
+  bool isPanelized() const noexcept {
+    return (mPanelColumns > 1) || (mPanelRows > 1);
+  }
+  const UnsignedLength& getPanelSpacing() const noexcept {
+    return mPanelSpacing;
+  }
 
   // Setters
   void setOutputBasePath(const QString& p) noexcept { mOutputBasePath = p; }
@@ -136,8 +149,13 @@ public:
     mSilkscreenLayersBot = l;
   }
   void setMergeDrillFiles(bool m) noexcept { mMergeDrillFiles = m; }
+  void setMergeCopperAreas(bool m) noexcept { mMergeCopperAreas = m; }
+  void setRecoverCopperArcs(bool r) noexcept { mRecoverCopperArcs = r; }
   void setEnableSolderPasteTop(bool e) noexcept { mEnableSolderPasteTop = e; }
   void setEnableSolderPasteBot(bool e) noexcept { mEnableSolderPasteBot = e; }
+  void setPanelColumns(int c) noexcept { mPanelColumns = qMax(c, 1); }
+  void setPanelRows(int r) noexcept { mPanelRows = qMax(r, 1); }
+  void setPanelSpacing(const UnsignedLength& s) noexcept { mPanelSpacing = s; }
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -168,8 +186,16 @@ private:  // Data
   QStringList mSilkscreenLayersTop;
   QStringList mSilkscreenLayersBot;
   bool        mMergeDrillFiles;
+  bool        mMergeCopperAreas;   // union planes & polygons
+  bool        mRecoverCopperArcs;  // export flattened arcs as G02/G03
   bool        mEnableSolderPasteTop;
   bool        mEnableSolderPasteBot;
+
+  // Panel (the board is repeated in a grid of columns x rows, the spacing is
+  // the gap between the board outlines of neighbouring copies)
+  int            mPanelColumns;
+  int            mPanelRows;
+  UnsignedLength mPanelSpacing;
 };
 
 /*******************************************************************************
@@ -43,13 +43,22 @@
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/cam/excellongenerator.h>
 #include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/scopeguard.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/utils/performancecounters.h>
+#include <librepcb/common/utils/profiler.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -65,7 +74,8 @@ BoardGerberExport::BoardGerberExport(
   : mProject(board.getProject()),
     mBoard(board),
     mSettings(new BoardFabricationOutputSettings(settings)),
-    mCurrentInnerCopperLayer(0) {
+    mCurrentInnerCopperLayer(0),
+    mWriteFiles(true) {
 }
 
 BoardGerberExport::~BoardGerberExport() noexcept {
@@ -84,28 +94,43 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept {
  ******************************************************************************/
 
 void BoardGerberExport::exportAllLayers() const {
+  Profiler::Scope scope("board '%1': export", *mBoard.getName());
   mWrittenFiles.clear();
+  mNewFingerprints.clear();
+  loadManifest();
+  resolveDesignRules();
+  mWrittenFiles = runJobs(createJobs(), true);  // can throw
+  saveManifest();                               // can throw
+}
 
-  if (mSettings->getMergeDrillFiles()) {
-    exportDrills();
-  } else {
-    exportDrillsNpth();
-    exportDrillsPth();
-  }
-  exportLayerBoardOutlines();
-  exportLayerTopCopper();
-  exportLayerInnerCopper();
-  exportLayerBottomCopper();
-  exportLayerTopSolderMask();
-  exportLayerBottomSolderMask();
-  exportLayerTopSilkscreen();
-  exportLayerBottomSilkscreen();
-  if (mSettings->getEnableSolderPasteTop()) {
-    exportLayerTopSolderPaste();
-  }
-  if (mSettings->getEnableSolderPasteBot()) {
-    exportLayerBottomSolderPaste();
+QVector<FilePath> BoardGerberExport::verifyReproducibility() const {
+  Profiler::Scope scope("board '%1': verify", *mBoard.getName());
+  resolveDesignRules();
+  QVector<Job> jobs = createJobs();
+
+  // Only the fingerprints are needed, which cover everything written to the
+  // files except the creation date. So don't generate and write any files.
+  mWriteFiles = false;
+  auto sg     = scopeGuard([this]() {
+    mWriteFiles = true;
+    mNewFingerprints.clear();
+  });
+  mNewFingerprints.clear();
+  runJobs(jobs, false);  // can throw
+  QHash<QString, QByteArray> sequential = mNewFingerprints;
+  mNewFingerprints.clear();
+  runJobs(jobs, true);  // can throw
+  QHash<QString, QByteArray> parallel = mNewFingerprints;
+
+  QStringList keys = (sequential.keys() + parallel.keys()).toSet().toList();
+  std::sort(keys.begin(), keys.end());
+  QVector<FilePath> differences;
+  foreach (const QString& key, keys) {
+    if (sequential.value(key) != parallel.value(key)) {
+      differences.append(getOutputDirectory().getPathTo(key));
+    }
   }
+  return differences;
 }
 
 /*******************************************************************************
@@ -130,111 +155,220 @@ BoardGerberExport::getAttributeProviderParents() const noexcept {
  *  Private Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportDrills() const {
+QVector<BoardGerberExport::Job> BoardGerberExport::createJobs() const
+    noexcept {
+  // The file names of inner copper layers depend on the attribute provider
+  // state, thus they need to be determined before starting the export.
+  QVector<FilePath> innerCopperFiles;
+  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+    mCurrentInnerCopperLayer = i;  // used for attribute provider
+    innerCopperFiles.append(
+        getOutputFilePath(mSettings->getSuffixCopperInner()));
+  }
+  mCurrentInnerCopperLayer = 0;
+
+  QVector<Job> jobs;
+  if (mSettings->getMergeDrillFiles()) {
+    jobs.append([this]() { return exportDrills(); });
+  } else {
+    jobs.append([this]() { return exportDrillsNpth(); });
+    jobs.append([this]() { return exportDrillsPth(); });
+  }
+  jobs.append([this]() { return exportLayerBoardOutlines(); });
+  jobs.append([this]() { return exportLayerTopCopper(); });
+  for (int i = 0; i < innerCopperFiles.count(); ++i) {
+    FilePath fp = innerCopperFiles.at(i);
+    jobs.append([this, i, fp]() { return exportLayerInnerCopper(i + 1, fp); });
+  }
+  jobs.append([this]() { return exportLayerBottomCopper(); });
+  jobs.append([this]() { return exportLayerTopSolderMask(); });
+  jobs.append([this]() { return exportLayerBottomSolderMask(); });
+  jobs.append([this]() { return exportLayerTopSilkscreen(); });
+  jobs.append([this]() { return exportLayerBottomSilkscreen(); });
+  if (mSettings->getEnableSolderPasteTop()) {
+    jobs.append([this]() { return exportLayerTopSolderPaste(); });
+  }
+  if (mSettings->getEnableSolderPasteBot()) {
+    jobs.append([this]() { return exportLayerBottomSolderPaste(); });
+  }
+  return jobs;
+}
+
+QVector<FilePath> BoardGerberExport::runJobs(const QVector<Job>& jobs,
+                                             bool parallel) const {
+  auto runJob = [this](const Job& job) {
+    // The file name is not known before the job is done, so the duration is
+    // recorded manually instead of with a Profiler::Scope.
+    QElapsedTimer timer;
+    timer.start();
+    FilePath fp = job();  // can throw
+    if (Profiler::isEnabled() && fp.isValid()) {
+      Profiler::record(QString("board '%1': export '%2'")
+                           .arg(*mBoard.getName(), fp.getFilename()),
+                       timer.nsecsElapsed());
+    }
+    return fp;
+  };
+
+  QVector<FilePath> files;
+  if (!parallel) {
+    foreach (const Job& job, jobs) {
+      FilePath fp = runJob(job);  // can throw
+      if (fp.isValid()) {
+        files.append(fp);
+      }
+    }
+    return files;
+  }
+
+  // The layers are independent of each other and the board is only read, so
+  // export them in parallel. The synchronizer makes sure that all jobs are
+  // finished before leaving this method, even if one of them failed. The
+  // results are collected in the order of the jobs, not in the order they
+  // finish, to keep the output independent of the thread scheduling.
+  QFutureSynchronizer<FilePath> synchronizer;
+  QList<QFuture<FilePath>>      futures;
+  foreach (const Job& job, jobs) {
+    futures.append(TaskScheduler::run(TaskScheduler::Priority::Batch,
+                                      [runJob, job]() { return runJob(job); }));
+    synchronizer.addFuture(futures.last());
+  }
+  foreach (const QFuture<FilePath>& future, futures) {
+    FilePath fp = future.result();  // can throw
+    if (fp.isValid()) {
+      files.append(fp);
+    }
+  }
+  return files;
+}
+
+void BoardGerberExport::resolveDesignRules() const noexcept {
+  const BoardDesignRules& rules = mBoard.getDesignRules();
+  mResolvedRules                = ResolvedDesignRules();
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      Length size = qMin(*pad->getLibPad().getWidth(),
+                         *pad->getLibPad().getHeight());
+      if (!mResolvedRules.stopMaskClearances.contains(size)) {
+        mResolvedRules.stopMaskClearances.insert(
+            size, rules.calcStopMaskClearance(size));
+        mResolvedRules.creamMaskClearances.insert(
+            size, rules.calcCreamMaskClearance(size));
+      }
+    }
+  }
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      Length size = *via->getSize();
+      if (!mResolvedRules.stopMaskClearances.contains(size)) {
+        mResolvedRules.stopMaskClearances.insert(
+            size, rules.calcStopMaskClearance(size));
+      }
+      Length drill = *via->getDrillDiameter();
+      if (!mResolvedRules.viaRequiresStopMask.contains(drill)) {
+        mResolvedRules.viaRequiresStopMask.insert(
+            drill, rules.doesViaRequireStopMask(drill));
+      }
+    }
+  }
+}
+
+FilePath BoardGerberExport::exportDrills() const {
   FilePath          fp = getOutputFilePath(mSettings->getSuffixDrills());
   ExcellonGenerator gen;
+  gen.setOptimizeDrillOrder(true);
   drawPthDrills(gen);
   drawNpthDrills(gen);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportDrillsNpth() const {
+FilePath BoardGerberExport::exportDrillsNpth() const {
   FilePath          fp = getOutputFilePath(mSettings->getSuffixDrillsNpth());
   ExcellonGenerator gen;
-  int               count = drawNpthDrills(gen);
+  gen.setOptimizeDrillOrder(true);
+  int count = drawNpthDrills(gen);
   if (count > 0) {
     // Some PCB manufacturers don't like to have separate drill files for PTH
     // and NPTH. As many boards don't have non-plated holes anyway, we create
     // this file only if it's really needed. Maybe this avoids unnecessary
     // issues with manufacturers...
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    generateFile(gen, fp);  // can throw
+    return fp;
   }
+  return FilePath();
 }
 
-void BoardGerberExport::exportDrillsPth() const {
+FilePath BoardGerberExport::exportDrillsPth() const {
   FilePath          fp = getOutputFilePath(mSettings->getSuffixDrillsPth());
   ExcellonGenerator gen;
+  gen.setOptimizeDrillOrder(true);
   drawPthDrills(gen);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerBoardOutlines() const {
+FilePath BoardGerberExport::exportLayerBoardOutlines() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixOutlines());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBoardOutlines);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerTopCopper() const {
+FilePath BoardGerberExport::exportLayerTopCopper() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperTop());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopCopper);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerBottomCopper() const {
+FilePath BoardGerberExport::exportLayerBottomCopper() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperBot());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotCopper);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerInnerCopper() const {
-  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
-    mCurrentInnerCopperLayer = i;  // used for attribute provider
-    FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperInner());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-  mCurrentInnerCopperLayer = 0;
+FilePath BoardGerberExport::exportLayerInnerCopper(int             innerLayer,
+                                                   const FilePath& fp) const {
+  GerberGenerator gen(
+      mProject.getMetadata().getName() % " - " % mBoard.getName(),
+      mBoard.getUuid(), mProject.getMetadata().getVersion());
+  drawLayer(gen, GraphicsLayer::getInnerLayerName(innerLayer));
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerTopSolderMask() const {
+FilePath BoardGerberExport::exportLayerTopSolderMask() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderMaskTop());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopStopMask);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerBottomSolderMask() const {
+FilePath BoardGerberExport::exportLayerBottomSolderMask() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderMaskBot());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotStopMask);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerTopSilkscreen() const {
+FilePath BoardGerberExport::exportLayerTopSilkscreen() const {
   QStringList layers = mSettings->getSilkscreenLayersTop();
   if (layers.count() >
       0) {  // don't create silkscreen file if no layers selected
@@ -245,13 +379,13 @@ void BoardGerberExport::exportLayerTopSilkscreen() const {
     foreach (const QString& layer, layers) { drawLayer(gen, layer); }
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, GraphicsLayer::sTopStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    generateFile(gen, fp);  // can throw
+    return fp;
   }
+  return FilePath();
 }
 
-void BoardGerberExport::exportLayerBottomSilkscreen() const {
+FilePath BoardGerberExport::exportLayerBottomSilkscreen() const {
   QStringList layers = mSettings->getSilkscreenLayersBot();
   if (layers.count() >
       0) {  // don't create silkscreen file if no layers selected
@@ -262,32 +396,30 @@ void BoardGerberExport::exportLayerBottomSilkscreen() const {
     foreach (const QString& layer, layers) { drawLayer(gen, layer); }
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, GraphicsLayer::sBotStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    generateFile(gen, fp);  // can throw
+    return fp;
   }
+  return FilePath();
 }
 
-void BoardGerberExport::exportLayerTopSolderPaste() const {
+FilePath BoardGerberExport::exportLayerTopSolderPaste() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderPasteTop());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopSolderPaste);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
-void BoardGerberExport::exportLayerBottomSolderPaste() const {
+FilePath BoardGerberExport::exportLayerBottomSolderPaste() const {
   FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderPasteBot());
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotSolderPaste);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  generateFile(gen, fp);  // can throw
+  return fp;
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
@@ -303,7 +435,7 @@ int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
   }
 
   // board holes
-  foreach (const BI_Hole* hole, mBoard.getHoles()) {
+  foreach (const BI_Hole* hole, sortedByUuid(mBoard.getHoles())) {
     gen.drill(hole->getHole().getPosition(), hole->getHole().getDiameter());
     ++count;
   }
@@ -341,6 +473,22 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen,
                                   const QString&   layerName) const {
+  // Optionally merge all copper areas (planes and filled polygons) into as
+  // few regions as possible, as overlapping regions slow down CAM tools.
+  bool mergeAreas = mSettings->getMergeCopperAreas() &&
+                    GraphicsLayer::isCopperLayer(layerName);
+  QVector<Path> areas;
+
+  // Optionally export arcs which were flattened to line segments (e.g. the
+  // clearances of plane fragments) as real arcs. The tolerance is twice the
+  // arc tolerance of plane fragments to be robust against rounding errors.
+  if (mSettings->getRecoverCopperArcs() &&
+      GraphicsLayer::isCopperLayer(layerName)) {
+    gen.setArcRecoveryTolerance(PositiveLength(10000));  // 10um
+  } else {
+    gen.setArcRecoveryTolerance(tl::nullopt);
+  }
+
   // draw footprints incl. pads
   foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
     Q_ASSERT(device);
@@ -377,7 +525,11 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
     Q_ASSERT(plane);
     if (plane->getLayerName() == layerName) {
       foreach (const Path& fragment, plane->getFragments()) {
-        gen.drawPathArea(fragment);
+        if (mergeAreas) {
+          areas.append(fragment);
+        } else {
+          gen.drawPathArea(fragment);
+        }
       }
     }
   }
@@ -393,7 +545,11 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
       // board editor, and because Gerber expects area outlines as closed).
       if (polygon->getPolygon().isFilled() &&
           polygon->getPolygon().getPath().isClosed()) {
-        gen.drawPathArea(polygon->getPolygon().getPath());
+        if (mergeAreas) {
+          areas.append(polygon->getPolygon().getPath());
+        } else {
+          gen.drawPathArea(polygon->getPolygon().getPath());
+        }
       }
     }
   }
@@ -412,6 +568,13 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
       }
     }
   }
+
+  // draw merged copper areas
+  if (!areas.isEmpty()) {
+    foreach (const Path& area, mergeCopperAreas(areas)) {  // can throw
+      gen.drawPathArea(area);
+    }
+  }
 }
 
 void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
@@ -420,12 +583,13 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
   bool drawStopMask =
       (layerName == GraphicsLayer::sTopStopMask ||
        layerName == GraphicsLayer::sBotStopMask) &&
-      mBoard.getDesignRules().doesViaRequireStopMask(*via.getDrillDiameter());
+      mResolvedRules.viaRequiresStopMask.value(*via.getDrillDiameter());
   if (drawCopper || drawStopMask) {
     UnsignedLength outerDiameter = positiveToUnsigned(via.getSize());
     if (drawStopMask) {
-      outerDiameter += UnsignedLength(
-          mBoard.getDesignRules().calcStopMaskClearance(*via.getSize()) * 2);
+      UnsignedLength clearance = mResolvedRules.stopMaskClearances.value(
+          *via.getSize(), UnsignedLength(0));
+      outerDiameter += UnsignedLength(clearance * 2);
     }
     switch (via.getShape()) {
       case BI_Via::Shape::Round: {
@@ -538,12 +702,13 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator&       gen,
   if (isOnSolderMaskTop || isOnSolderMaskBottom) {
     Length         size = qMin(width, height);
     UnsignedLength clearance =
-        mBoard.getDesignRules().calcStopMaskClearance(size);
+        mResolvedRules.stopMaskClearances.value(size, UnsignedLength(0));
     width += clearance * 2;
     height += clearance * 2;
   } else if (isOnSolderPasteTop || isOnSolderPasteBottom) {
     Length size      = qMin(width, height);
-    Length clearance = -mBoard.getDesignRules().calcCreamMaskClearance(size);
+    Length clearance =
+        -mResolvedRules.creamMaskClearances.value(size, UnsignedLength(0));
     width += clearance * 2;
     height += clearance * 2;
   }
@@ -585,6 +750,105 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator&       gen,
   }
 }
 
+QVector<Path> BoardGerberExport::mergeCopperAreas(
+    const QVector<Path>& areas) const {
+  // Note: Use the same arc tolerance as for the plane fragments.
+  ClipperLib::Clipper clipper;
+  clipper.AddPaths(ClipperHelpers::convert(areas, PositiveLength(5000)),
+                   ClipperLib::ptSubject, true);
+  ClipperLib::PolyTree tree;
+  clipper.Execute(ClipperLib::ctUnion, tree, ClipperLib::pftNonZero,
+                  ClipperLib::pftNonZero);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
+  return ClipperHelpers::convert(
+      ClipperHelpers::flattenTree(tree));  // can throw
+}
+
+Point BoardGerberExport::calcPanelStep() const {
+  // The distance between two copies of the board is given by the extents of
+  // the board outline plus the configured spacing.
+  bool   found = false;
+  qint64 left = 0, bottom = 0, right = 0, top = 0;
+  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+    if (polygon->getPolygon().getLayerName() != GraphicsLayer::sBoardOutlines) {
+      continue;
+    }
+    ClipperLib::Path path = ClipperHelpers::convert(
+        polygon->getPolygon().getPath(), PositiveLength(5000));
+    foreach (const ClipperLib::IntPoint& p, path) {
+      left   = found ? qMin(left, p.X) : p.X;
+      right  = found ? qMax(right, p.X) : p.X;
+      bottom = found ? qMin(bottom, p.Y) : p.Y;
+      top    = found ? qMax(top, p.Y) : p.Y;
+      found  = true;
+    }
+  }
+  if (!found) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("The board has no outline, thus it cannot be panelized."));
+  }
+  qint64 spacing = mSettings->getPanelSpacing()->toNm();
+  return Point(right - left + spacing, top - bottom + spacing);
+}
+
+bool BoardGerberExport::isUpToDate(const FilePath&   fp,
+                                   const QByteArray& fingerprint) const
+    noexcept {
+  QString key = fp.toRelative(getOutputDirectory());
+  {
+    QMutexLocker lock(&mNewFingerprintsMutex);
+    mNewFingerprints.insert(key, fingerprint);
+  }
+  return fp.isExistingFile() && (mOldFingerprints.value(key) == fingerprint);
+}
+
+void BoardGerberExport::loadManifest() const noexcept {
+  mOldFingerprints.clear();
+  FilePath fp = getManifestFilePath();
+  if (!fp.isExistingFile()) {
+    return;
+  }
+  try {
+    SExpression root =
+        SExpression::parse(FileUtils::readFile(fp), fp);  // can throw
+    foreach (const SExpression* node, root.getChildren("file")) {
+      QString    key = node->getChildByIndex(0).getValue<QString>();
+      QByteArray fingerprint =
+          node->getChildByIndex(1).getValue<QString>().toLatin1();
+      mOldFingerprints.insert(key, fingerprint);
+    }
+  } catch (const Exception& e) {
+    // Not critical, all files will just be generated again.
+    qWarning() << "Ignoring invalid fabrication output manifest"
+               << fp.toNative() << ":" << e.getMsg();
+    mOldFingerprints.clear();
+  }
+}
+
+void BoardGerberExport::saveManifest() const {
+  // Keep the entries of other files since multiple boards may be exported to
+  // the same output directory.
+  QMap<QString, QByteArray> fingerprints;  // sorted to be reproducible
+  for (auto it = mOldFingerprints.constBegin();
+       it != mOldFingerprints.constEnd(); ++it) {
+    fingerprints.insert(it.key(), it.value());
+  }
+  for (auto it = mNewFingerprints.constBegin();
+       it != mNewFingerprints.constEnd(); ++it) {
+    fingerprints.insert(it.key(), it.value());
+  }
+  SExpression root = SExpression::createList("librepcb_fabrication_output");
+  for (auto it = fingerprints.constBegin(); it != fingerprints.constEnd();
+       ++it) {
+    SExpression& node = root.appendList("file", true);
+    node.appendChild(SExpression::createString(it.key()), false);
+    node.appendChild(SExpression::createString(QString::fromLatin1(it.value())),
+                     false);
+  }
+  FileUtils::writeFile(getManifestFilePath(), root.toByteArray());  // can throw
+}
+
 FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const
     noexcept {
   QString path = mSettings->getOutputBasePath() + suffix;
@@ -600,6 +864,10 @@ FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const
   }
 }
 
+FilePath BoardGerberExport::getManifestFilePath() const noexcept {
+  return getOutputDirectory().getPathTo(".librepcb-fabrication-output");
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
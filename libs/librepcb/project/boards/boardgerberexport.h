@@ -30,12 +30,14 @@
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
 
+class Path;
 class Polygon;
 class Circle;
 class ExcellonGenerator;
@@ -75,8 +77,36 @@ public:
   }
 
   // General Methods
+
+  /**
+   * @brief Export all enabled layers and drill files
+   *
+   * The files are generated in parallel on the global thread pool, so the
+   * board must not be modified while exporting.
+   *
+   * A fingerprint of every generated file is recorded in a manifest file in
+   * the output directory. Files whose fingerprint did not change since the
+   * last export are not generated and written again.
+   *
+   * @throw Exception if any of the files could not be exported
+   */
   void exportAllLayers() const;
 
+  /**
+   * @brief Check whether the parallel export is reproducible
+   *
+   * All files are generated once sequentially and once in parallel (like
+   * #exportAllLayers() does), without writing anything to the output
+   * directory. Then the fingerprints of the files are compared, which cover
+   * the whole file content except the creation date.
+   *
+   * @return The files whose content differs between the sequential and the
+   *         parallel export (empty if the export is reproducible)
+   *
+   * @throw Exception if any of the files could not be generated
+   */
+  QVector<FilePath> verifyReproducibility() const;
+
   // Inherited from AttributeProvider
   /// @copydoc librepcb::AttributeProvider::getBuiltInAttributeValue()
   QString getBuiltInAttributeValue(const QString& key) const noexcept override;
@@ -91,20 +121,39 @@ signals:
   void attributesChanged() override;
 
 private:
+  // Types
+  typedef std::function<FilePath()> Job;  ///< Generates one file
+
+  /**
+   * @brief Design rule values resolved for all pad and via sizes of the board
+   *
+   * Built once before exporting the layers in parallel, so the ratio/bounds
+   * calculations are not repeated for every pad and via of every layer.
+   */
+  struct ResolvedDesignRules {
+    QHash<Length, UnsignedLength> stopMaskClearances;   ///< Key: Pad size
+    QHash<Length, UnsignedLength> creamMaskClearances;  ///< Key: Pad size
+    QHash<Length, bool>           viaRequiresStopMask;  ///< Key: Drill dia.
+  };
+
   // Private Methods
-  void exportDrills() const;
-  void exportDrillsNpth() const;
-  void exportDrillsPth() const;
-  void exportLayerBoardOutlines() const;
-  void exportLayerTopCopper() const;
-  void exportLayerInnerCopper() const;
-  void exportLayerBottomCopper() const;
-  void exportLayerTopSolderMask() const;
-  void exportLayerBottomSolderMask() const;
-  void exportLayerTopSilkscreen() const;
-  void exportLayerBottomSilkscreen() const;
-  void exportLayerTopSolderPaste() const;
-  void exportLayerBottomSolderPaste() const;
+  QVector<Job>      createJobs() const noexcept;
+  QVector<FilePath> runJobs(const QVector<Job>& jobs, bool parallel) const;
+
+  void     resolveDesignRules() const noexcept;
+  FilePath exportDrills() const;
+  FilePath exportDrillsNpth() const;
+  FilePath exportDrillsPth() const;
+  FilePath exportLayerBoardOutlines() const;
+  FilePath exportLayerTopCopper() const;
+  FilePath exportLayerInnerCopper(int innerLayer, const FilePath& fp) const;
+  FilePath exportLayerBottomCopper() const;
+  FilePath exportLayerTopSolderMask() const;
+  FilePath exportLayerBottomSolderMask() const;
+  FilePath exportLayerTopSilkscreen() const;
+  FilePath exportLayerBottomSilkscreen() const;
+  FilePath exportLayerTopSolderPaste() const;
+  FilePath exportLayerBottomSolderPaste() const;
 
   int  drawNpthDrills(ExcellonGenerator& gen) const;
   int  drawPthDrills(ExcellonGenerator& gen) const;
@@ -115,8 +164,28 @@ private:
                      const QString& layerName) const;
   void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad,
                         const QString& layerName) const;
+  QVector<Path> mergeCopperAreas(const QVector<Path>& areas) const;
+  Point         calcPanelStep() const;
+
+  template <typename T>
+  void generateFile(T& gen, const FilePath& fp) const {
+    if (mSettings->isPanelized()) {
+      gen.setStepAndRepeat(mSettings->getPanelColumns(),
+                           mSettings->getPanelRows(),
+                           calcPanelStep());  // can throw
+    }
+    if (!isUpToDate(fp, gen.calcFingerprint()) && mWriteFiles) {
+      gen.generate();
+      gen.saveToFile(fp);  // can throw
+    }
+  }
+  bool isUpToDate(const FilePath& fp, const QByteArray& fingerprint) const
+      noexcept;
+  void loadManifest() const noexcept;
+  void saveManifest() const;
 
   FilePath getOutputFilePath(const QString& suffix) const noexcept;
+  FilePath getManifestFilePath() const noexcept;
 
   // Static Methods
   static UnsignedLength calcWidthOfLayer(const UnsignedLength& width,
@@ -137,6 +206,11 @@ private:
   QScopedPointer<const BoardFabricationOutputSettings> mSettings;
   mutable int                                          mCurrentInnerCopperLayer;
   mutable QVector<FilePath>                            mWrittenFiles;
+  mutable QHash<QString, QByteArray>                   mOldFingerprints;
+  mutable QHash<QString, QByteArray>                   mNewFingerprints;
+  mutable QMutex                                       mNewFingerprintsMutex;
+  mutable ResolvedDesignRules                          mResolvedRules;
+  mutable bool                                         mWriteFiles;
 };
 
 /*******************************************************************************
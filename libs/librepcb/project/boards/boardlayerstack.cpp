@@ -24,6 +24,8 @@
 
 #include "board.h"
 
+#include <librepcb/common/graphics/graphicsscene.h>
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -143,6 +145,10 @@ void BoardLayerStack::serialize(SExpression& root) const {
 
 void BoardLayerStack::layerAttributesChanged() noexcept {
   if (!mLayersChanged) {
+    // The board graphics items take colors and visibility from the layers
+    // when painting, so repainting the scene once is enough for all layer
+    // modifications since the last event loop iteration.
+    mBoard.getGraphicsScene().update();
     emit mBoard.attributesChanged();
     mLayersChanged = true;
   }
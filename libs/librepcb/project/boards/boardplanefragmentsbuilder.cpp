@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "boardplanefragmentsbuilder.h"
 
+#include "boardspatialindex.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
 #include "items/bi_footprintpad.h"
@@ -30,16 +31,17 @@
 #include "items/bi_netpoint.h"
 #include "items/bi_netsegment.h"
 #include "items/bi_plane.h"
-#include "items/bi_polygon.h"
 #include "items/bi_via.h"
 
-#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/utils/performancecounters.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
 #include <QtCore>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -50,8 +52,12 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BoardPlaneFragmentsBuilder::BoardPlaneFragmentsBuilder(BI_Plane& plane) noexcept
-  : mPlane(plane) {
+BoardPlaneFragmentsBuilder::BoardPlaneFragmentsBuilder() noexcept
+  : mTilesBounds{0, 0, 0, 0},
+    mTileWidth(1),
+    mTileHeight(1),
+    mTileColumns(0),
+    mTileRows(0) {
 }
 
 BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept {
@@ -61,147 +67,250 @@ BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept {
  *  General Methods
  ******************************************************************************/
 
-QVector<Path> BoardPlaneFragmentsBuilder::buildFragments() noexcept {
+QVector<Path> BoardPlaneFragmentsBuilder::buildFragments(
+    const Snapshot& snapshot, const PlaneFragments& planeFragments) noexcept {
+  PerformanceCounters::add(PerformanceCounters::Counter::PlaneRebuilds);
   try {
     mResult.clear();
-    addPlaneOutline();
-    clipToBoardOutline();
-    subtractOtherObjects();
-    ensureMinimumWidth();
+    addPlaneOutline(snapshot);
+    clipToBoardOutline(snapshot);
+    subtractOtherObjects(snapshot, planeFragments);
+    if (snapshot.quality != Quality::Draft) {
+      ensureMinimumWidth(snapshot);
+    }
     flattenResult();
-    if (!mPlane.getKeepOrphans()) {
-      removeOrphans();
+    if (!snapshot.keepOrphans) {
+      removeOrphans(snapshot);
     }
     return ClipperHelpers::convert(mResult);
   } catch (const Exception& e) {
     qCritical() << "Failed to build plane fragments! Leave plane empty...";
     qCritical() << "Inner error message:" << e.getMsg();
+    invalidateTiles();
     return QVector<Path>();
   }
 }
 
 /*******************************************************************************
- *  Private Methods
+ *  Static Methods
  ******************************************************************************/
 
-void BoardPlaneFragmentsBuilder::addPlaneOutline() {
-  mResult.push_back(
-      ClipperHelpers::convert(mPlane.getOutline(), maxArcTolerance()));
-}
+BoardPlaneFragmentsBuilder::Snapshot BoardPlaneFragmentsBuilder::createSnapshot(
+    const BI_Plane& plane, const BoardSpatialIndex& index, Quality quality,
+    BoardAreaCache* boardAreaCache) {
+  PositiveLength tolerance = getMaxArcTolerance(quality);
+  Snapshot       snapshot{plane.getUuid(),
+                          quality,
+                          tolerance,
+                          plane.getOutline(),
+                          plane.getMinWidth(),
+                          plane.getMinClearance(),
+                          plane.getKeepOrphans(),
+                          nullptr,
+                          QVector<Uuid>(),
+                          ClipperLib::Paths(),
+                          QVector<ClipperLib::IntRect>(),
+                          ClipperLib::Paths()};
+
+  // board area
+  if (boardAreaCache) {
+    snapshot.boardArea = boardAreaCache->get(
+        index.getBoardOutlines(), plane.getMinClearance(), tolerance);
+  } else {
+    snapshot.boardArea = std::make_shared<ClipperLib::Paths>(
+        calcBoardArea(index.getBoardOutlines(), plane.getMinClearance(),
+                      tolerance));  // can throw
+  }
 
-void BoardPlaneFragmentsBuilder::clipToBoardOutline() {
-  // determine board area
-  ClipperLib::Paths   boardArea;
-  ClipperLib::Clipper boardAreaClipper;
-  foreach (const BI_Polygon* polygon, mPlane.getBoard().getPolygons()) {
-    if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
-      ClipperLib::Path path = ClipperHelpers::convert(
-          polygon->getPolygon().getPath(), maxArcTolerance());
-      boardAreaClipper.AddPath(path, ClipperLib::ptSubject, true);
+  // other planes
+  foreach (const BI_Plane* other, plane.getBoard().getPlanes()) {
+    if (other == &plane) continue;
+    if (*other < plane) continue;  // ignore planes with lower priority
+    if (other->getLayerName() != plane.getLayerName()) continue;
+    if (&other->getNetSignal() == &plane.getNetSignal()) continue;
+    snapshot.otherPlanes.append(other->getUuid());
+  }
+
+  // holes, pads, vias and netlines overlapping with the plane
+  ClipperLib::IntRect rect =
+      getBounds(ClipperHelpers::convert(plane.getOutline(), tolerance));
+  rect.left -= plane.getMinClearance()->toNm();
+  rect.top -= plane.getMinClearance()->toNm();
+  rect.right += plane.getMinClearance()->toNm();
+  rect.bottom += plane.getMinClearance()->toNm();
+  int netLinesLayer = index.getNetLinesLayerIndex(*plane.getLayerName());
+  const BoardSpatialIndex::NetLines* netLines =
+      (netLinesLayer >= 0) ? &index.getNetLines().at(netLinesLayer) : nullptr;
+  foreach (const BoardSpatialIndex::Item* item, index.query(rect)) {
+    switch (item->type) {
+      case BoardSpatialIndex::ItemType::Hole: {
+        PositiveLength dia(item->diameter + (*plane.getMinClearance() * 2));
+        Path           path = Path::circle(dia).translated(item->position);
+        addCutOut(snapshot, ClipperHelpers::convert(path, tolerance));
+        break;
+      }
+      case BoardSpatialIndex::ItemType::Pad: {
+        const BI_FootprintPad& pad = *item->pad;
+        if (!pad.isOnLayer(*plane.getLayerName())) break;
+        if (pad.getCompSigInstNetSignal() == &plane.getNetSignal()) {
+          snapshot.connectedNetSignalAreas.push_back(
+              pad.getClipperSceneOutline(Length(0), tolerance));
+        }
+        addCutOut(snapshot, createPadCutOut(plane, pad, tolerance));
+        break;
+      }
+      case BoardSpatialIndex::ItemType::Via: {
+        const BI_Via& via = *item->via;
+        if (&via.getNetSignalOfNetSegment() == &plane.getNetSignal()) {
+          snapshot.connectedNetSignalAreas.push_back(
+              via.getClipperSceneOutline(Length(0), tolerance));
+        }
+        addCutOut(snapshot, createViaCutOut(plane, via, tolerance));
+        break;
+      }
+      case BoardSpatialIndex::ItemType::NetLine: {
+        if (item->layer != netLinesLayer) break;
+        const BI_NetLine& netline = *item->netLine;
+        if (netLines->netSignals.at(item->index) == &plane.getNetSignal()) {
+          snapshot.connectedNetSignalAreas.push_back(
+              netline.getClipperSceneOutline(Length(0), tolerance));
+        } else {
+          addCutOut(snapshot, netline.getClipperSceneOutline(
+                                  *plane.getMinClearance(), tolerance));
+        }
+        break;
+      }
+      default: { throw LogicError(__FILE__, __LINE__); }
     }
   }
-  boardAreaClipper.Execute(ClipperLib::ctXor, boardArea, ClipperLib::pftEvenOdd,
-                           ClipperLib::pftEvenOdd);
+  return snapshot;
+}
 
-  // perform clearance offset
-  ClipperHelpers::offset(boardArea, -mPlane.getMinClearance(),
-                         maxArcTolerance());  // can throw
+PositiveLength BoardPlaneFragmentsBuilder::getMaxArcTolerance(
+    Quality quality) noexcept {
+  switch (quality) {
+    case Quality::Draft:
+      return PositiveLength(50000);  // 50um
+    case Quality::Fabrication:
+    default:
+      return PositiveLength(5000);  // 5um
+  }
+}
+
+QByteArray BoardPlaneFragmentsBuilder::calcFingerprint(
+    const Snapshot&                snapshot,
+    const QHash<Uuid, QByteArray>& fingerprints) noexcept {
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  hash.addData(snapshot.uuid.toStr().toUtf8());
+  hash.addData(QByteArray::number(static_cast<int>(snapshot.quality)));
+  hash.addData(QByteArray::number(snapshot.maxArcTolerance->toNm()));
+  foreach (const Vertex& vertex, snapshot.outline.getVertices()) {
+    hash.addData(QByteArray::number(vertex.getPos().getX().toNm()));
+    hash.addData(QByteArray::number(vertex.getPos().getY().toNm()));
+    hash.addData(QByteArray::number(vertex.getAngle().toMicroDeg()));
+  }
+  hash.addData(QByteArray::number(snapshot.minWidth->toNm()));
+  hash.addData(QByteArray::number(snapshot.minClearance->toNm()));
+  hash.addData(QByteArray::number(snapshot.keepOrphans));
+  if (snapshot.boardArea) {
+    hash.addData(calcPathsHash(*snapshot.boardArea, false));
+  }
+  QVector<Uuid> otherPlanes = snapshot.otherPlanes;
+  std::sort(otherPlanes.begin(), otherPlanes.end());
+  foreach (const Uuid& uuid, otherPlanes) {
+    hash.addData(uuid.toStr().toUtf8());
+    hash.addData(fingerprints.value(uuid));
+  }
+  hash.addData(calcPathsHash(snapshot.cutOuts, true));
+  hash.addData(calcPathsHash(snapshot.connectedNetSignalAreas, true));
+  return hash.result();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
 
+void BoardPlaneFragmentsBuilder::addPlaneOutline(const Snapshot& snapshot) {
+  mResult.push_back(
+      ClipperHelpers::convert(snapshot.outline, snapshot.maxArcTolerance));
+}
+
+void BoardPlaneFragmentsBuilder::clipToBoardOutline(const Snapshot& snapshot) {
   // if we have no board area, abort here
-  if (boardArea.empty()) return;
+  if ((!snapshot.boardArea) || snapshot.boardArea->empty()) return;
 
   // clip result to board area
   ClipperLib::Clipper clip;
   clip.AddPaths(mResult, ClipperLib::ptSubject, true);
-  clip.AddPaths(boardArea, ClipperLib::ptClip, true);
+  clip.AddPaths(*snapshot.boardArea, ClipperLib::ptClip, true);
   clip.Execute(ClipperLib::ctIntersection, mResult, ClipperLib::pftNonZero,
                ClipperLib::pftNonZero);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
 }
 
-void BoardPlaneFragmentsBuilder::subtractOtherObjects() {
-  ClipperLib::Clipper c;
-  c.AddPaths(mResult, ClipperLib::ptSubject, true);
+void BoardPlaneFragmentsBuilder::subtractOtherObjects(
+    const Snapshot& snapshot, const PlaneFragments& planeFragments) {
+  collectCutOuts(snapshot, planeFragments);  // can throw
 
-  // subtract other planes
-  foreach (const BI_Plane* plane, mPlane.getBoard().getPlanes()) {
-    if (plane == &mPlane) continue;
-    if (*plane < mPlane) continue;  // ignore planes with lower priority
-    if (plane->getLayerName() != mPlane.getLayerName()) continue;
-    if (&plane->getNetSignal() == &mPlane.getNetSignal()) continue;
-    ClipperLib::Paths paths =
-        ClipperHelpers::convert(plane->getFragments(), maxArcTolerance());
-    ClipperHelpers::offset(paths, *mPlane.getMinClearance(),
-                           maxArcTolerance());  // can throw
-    c.AddPaths(paths, ClipperLib::ptClip, true);
-  }
-
-  // subtract holes and pads from devices
-  foreach (const BI_Device* device, mPlane.getBoard().getDeviceInstances()) {
-    for (const Hole& hole :
-         device->getFootprint().getLibFootprint().getHoles()) {
-      Point pos = device->getFootprint().mapToScene(hole.getPosition());
-      PositiveLength dia(hole.getDiameter() + mPlane.getMinClearance() * 2);
-      Path           path = Path::circle(dia).translated(pos);
-      c.AddPath(ClipperHelpers::convert(path, maxArcTolerance()),
-                ClipperLib::ptClip, true);
-    }
-    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
-      if (!pad->isOnLayer(*mPlane.getLayerName())) continue;
-      if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
-        ClipperLib::Path path =
-            ClipperHelpers::convert(pad->getSceneOutline(), maxArcTolerance());
-        mConnectedNetSignalAreas.push_back(path);
-      }
-      c.AddPath(createPadCutOut(*pad), ClipperLib::ptClip, true);
-    }
+  // if the plane area has changed, the tiles of the last build are obsolete
+  bool rebuildAll = mTileHashes.isEmpty() || (mResult != mArea);
+  if (rebuildAll) {
+    mArea = mResult;
+    initTiles();
   }
 
-  // subtract board holes
-  for (const BI_Hole* hole : mPlane.getBoard().getHoles()) {
-    PositiveLength dia(hole->getHole().getDiameter() +
-                       mPlane.getMinClearance() * 2);
-    Path path = Path::circle(dia).translated(hole->getHole().getPosition());
-    c.AddPath(ClipperHelpers::convert(path, maxArcTolerance()),
-              ClipperLib::ptClip, true);
-  }
-
-  // subtract net segment items
-  foreach (const BI_NetSegment* netsegment,
-           mPlane.getBoard().getNetSegments()) {
-    // subtract vias
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
-        ClipperLib::Path path =
-            ClipperHelpers::convert(via->getSceneOutline(), maxArcTolerance());
-        mConnectedNetSignalAreas.push_back(path);
-      }
-      c.AddPath(createViaCutOut(*via), ClipperLib::ptClip, true);
+  // determine tiles whose cut-outs have changed since the last build
+  QVector<QVector<int>> tileCutOuts = assignToTiles(mCutOutBounds);
+  QVector<QByteArray>   tileHashes;
+  QVector<int>          dirtyTiles;
+  for (int i = 0; i < tileCutOuts.count(); ++i) {
+    tileHashes.append(calcTileHash(tileCutOuts.at(i)));
+    if (rebuildAll || (tileHashes.last() != mTileHashes.at(i))) {
+      dirtyTiles.append(i);
     }
+  }
 
-    // subtract netlines
-    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      if (netline->getLayer().getName() != mPlane.getLayerName()) continue;
-      if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
-        ClipperLib::Path path = ClipperHelpers::convert(
-            netline->getSceneOutline(), maxArcTolerance());
-        mConnectedNetSignalAreas.push_back(path);
-      } else {
-        ClipperLib::Path path = ClipperHelpers::convert(
-            netline->getSceneOutline(*mPlane.getMinClearance()),
-            maxArcTolerance());
-        c.AddPath(path, ClipperLib::ptClip, true);
+  // if most of the tiles are dirty, subtracting all cut-outs at once is faster
+  if (rebuildAll || (dirtyTiles.count() * 2 > tileHashes.count())) {
+    QVector<int> cutOuts;
+    for (int i = 0; i < mCutOuts.size(); ++i) {
+      cutOuts.append(i);
+    }
+    mSubtracted = subtractCutOuts(mArea, cutOuts);  // can throw
+  } else if (!dirtyTiles.isEmpty()) {
+    // re-clip only the dirty tiles and keep the rest of the last result
+    ClipperLib::Paths dirtyArea;
+    QVector<int>      cutOuts;
+    QVector<bool>     cutOutAdded(mCutOuts.size(), false);
+    foreach (int tile, dirtyTiles) {
+      dirtyArea.push_back(getTileOutline(tile));
+      foreach (int index, tileCutOuts.at(tile)) {
+        if (!cutOutAdded.at(index)) {
+          cutOutAdded[index] = true;
+          cutOuts.append(index);
+        }
       }
     }
+    ClipperLib::Paths kept =
+        execute(mSubtracted, dirtyArea, ClipperLib::ctDifference,
+                ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+    ClipperLib::Paths area =
+        execute(mArea, dirtyArea, ClipperLib::ctIntersection,
+                ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    ClipperLib::Paths fresh = subtractCutOuts(area, cutOuts);  // can throw
+    mSubtracted = execute(kept, fresh, ClipperLib::ctUnion,
+                          ClipperLib::pftNonZero, ClipperLib::pftNonZero);
   }
-
-  c.Execute(ClipperLib::ctDifference, mResult, ClipperLib::pftEvenOdd,
-            ClipperLib::pftNonZero);
+  mTileHashes = tileHashes;
+  mResult     = mSubtracted;
 }
 
-void BoardPlaneFragmentsBuilder::ensureMinimumWidth() {
-  Length delta = mPlane.getMinWidth() / 2;
-  ClipperHelpers::offset(mResult, -delta, maxArcTolerance());  // can throw
-  ClipperHelpers::offset(mResult, delta, maxArcTolerance());   // can throw
+void BoardPlaneFragmentsBuilder::ensureMinimumWidth(const Snapshot& snapshot) {
+  Length delta = snapshot.minWidth / 2;
+  ClipperHelpers::offset(mResult, -delta,
+                         snapshot.maxArcTolerance);  // can throw
+  ClipperHelpers::offset(mResult, delta,
+                         snapshot.maxArcTolerance);  // can throw
 }
 
 void BoardPlaneFragmentsBuilder::flattenResult() {
@@ -211,57 +320,370 @@ void BoardPlaneFragmentsBuilder::flattenResult() {
   c.AddPaths(mResult, ClipperLib::ptSubject, true);
   c.Execute(ClipperLib::ctXor, tree, ClipperLib::pftEvenOdd,
             ClipperLib::pftEvenOdd);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
 
   // convert tree to simple paths with cut-ins
   mResult = ClipperHelpers::flattenTree(tree);  // can throw
 }
 
-void BoardPlaneFragmentsBuilder::removeOrphans() {
-  mResult.erase(std::remove_if(
-                    mResult.begin(), mResult.end(),
-                    [this](const ClipperLib::Path& p) {
-                      ClipperLib::Paths   intersections;
-                      ClipperLib::Clipper c;
-                      c.AddPaths(mConnectedNetSignalAreas,
-                                 ClipperLib::ptSubject, true);
-                      c.AddPath(p, ClipperLib::ptClip, true);
-                      c.Execute(ClipperLib::ctIntersection, intersections,
-                                ClipperLib::pftNonZero, ClipperLib::pftNonZero);
-                      return intersections.empty();
-                    }),
-                mResult.end());
+void BoardPlaneFragmentsBuilder::removeOrphans(const Snapshot& snapshot) {
+  // Note: The connected areas are assigned to the tiles by their bounding box
+  // to quickly find the candidates for each fragment. Also a fragment is
+  // kept as soon as the first connected area touching it has been found.
+  const ClipperLib::Paths&     areas = snapshot.connectedNetSignalAreas;
+  QVector<ClipperLib::IntRect> areaBounds;
+  areaBounds.reserve(static_cast<int>(areas.size()));
+  for (const ClipperLib::Path& area : areas) {
+    areaBounds.append(getBounds(area));
+  }
+  QVector<QVector<int>> tileAreas = assignToTiles(areaBounds);
+  QVector<int>          checkedBy(areaBounds.count(), -1);
+  int                   fragment = 0;
+  mResult.erase(
+      std::remove_if(
+          mResult.begin(), mResult.end(),
+          [&](const ClipperLib::Path& p) {
+            ClipperLib::IntRect bounds = getBounds(p);
+            foreach (int tile, getTilesInRect(bounds)) {
+              foreach (int index, tileAreas.at(tile)) {
+                if (checkedBy.at(index) == fragment) continue;
+                checkedBy[index] = fragment;
+                if (intersects(bounds, areaBounds.at(index)) &&
+                    intersects(p, areas.at(index))) {
+                  ++fragment;
+                  return false;
+                }
+              }
+            }
+            ++fragment;
+            return true;
+          }),
+      mResult.end());
+}
+
+/*******************************************************************************
+ *  Cut-Out Methods
+ ******************************************************************************/
+
+void BoardPlaneFragmentsBuilder::collectCutOuts(
+    const Snapshot& snapshot, const PlaneFragments& planeFragments) {
+  mCutOuts.clear();
+  mCutOutBounds.clear();
+
+  // other planes
+  QVector<ClipperLib::Paths> otherPlanes;
+  otherPlanes.reserve(snapshot.otherPlanes.count());
+  foreach (const Uuid& uuid, snapshot.otherPlanes) {
+    otherPlanes.append(ClipperHelpers::convert(planeFragments.value(uuid),
+                                               snapshot.maxArcTolerance));
+  }
+  ClipperHelpers::offset(otherPlanes, *snapshot.minClearance,
+                         snapshot.maxArcTolerance);  // can throw
+  for (ClipperLib::Paths& paths : otherPlanes) {
+    for (ClipperLib::Path& path : paths) {
+      addCutOut(std::move(path));
+    }
+  }
+
+  // all other objects
+  mCutOuts.reserve(mCutOuts.size() + snapshot.cutOuts.size());
+  mCutOuts.insert(mCutOuts.end(), snapshot.cutOuts.begin(),
+                  snapshot.cutOuts.end());
+  mCutOutBounds += snapshot.cutOutBounds;
+}
+
+void BoardPlaneFragmentsBuilder::addCutOut(ClipperLib::Path path) noexcept {
+  if (path.empty()) return;
+  mCutOutBounds.append(getBounds(path));
+  mCutOuts.push_back(std::move(path));
+}
+
+void BoardPlaneFragmentsBuilder::addCutOut(Snapshot&        snapshot,
+                                           ClipperLib::Path path) noexcept {
+  if (path.empty()) return;
+  snapshot.cutOutBounds.append(getBounds(path));
+  snapshot.cutOuts.push_back(std::move(path));
+}
+
+ClipperLib::Paths BoardPlaneFragmentsBuilder::subtractCutOuts(
+    const ClipperLib::Paths& area, const QVector<int>& cutOuts) const {
+  ClipperLib::Clipper c;
+  c.AddPaths(area, ClipperLib::ptSubject, true);
+  foreach (int index, cutOuts) {
+    c.AddPath(mCutOuts.at(index), ClipperLib::ptClip, true);
+  }
+  ClipperLib::Paths result;
+  c.Execute(ClipperLib::ctDifference, result, ClipperLib::pftEvenOdd,
+            ClipperLib::pftNonZero);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
+  return result;
+}
+
+/*******************************************************************************
+ *  Tile Methods
+ ******************************************************************************/
+
+void BoardPlaneFragmentsBuilder::initTiles() noexcept {
+  mTileHashes.clear();
+  if (mArea.empty()) {
+    mTilesBounds = ClipperLib::IntRect{0, 0, 0, 0};
+    mTileColumns = 0;
+    mTileRows    = 0;
+    return;
+  }
+  mTilesBounds = getBounds(mArea);
+  ClipperLib::cInt width  = mTilesBounds.right - mTilesBounds.left;
+  ClipperLib::cInt height = mTilesBounds.bottom - mTilesBounds.top;
+  mTileColumns = qBound(1, static_cast<int>(width / minTileSize()->toNm()),
+                        maxTilesPerDirection());
+  mTileRows    = qBound(1, static_cast<int>(height / minTileSize()->toNm()),
+                        maxTilesPerDirection());
+  mTileWidth   = (width / mTileColumns) + 1;
+  mTileHeight  = (height / mTileRows) + 1;
+}
+
+QVector<QVector<int>> BoardPlaneFragmentsBuilder::assignToTiles(
+    const QVector<ClipperLib::IntRect>& bounds) const noexcept {
+  QVector<QVector<int>> tiles(mTileColumns * mTileRows);
+  for (int i = 0; i < bounds.count(); ++i) {
+    foreach (int tile, getTilesInRect(bounds.at(i))) {
+      tiles[tile].append(i);
+    }
+  }
+  return tiles;
+}
+
+QVector<int> BoardPlaneFragmentsBuilder::getTilesInRect(
+    const ClipperLib::IntRect& rect) const noexcept {
+  // Note: The rect is enlarged by one unit to make sure that objects touching
+  // a tile border are assigned to both adjacent tiles.
+  const ClipperLib::IntRect& r = rect;
+  QVector<int>               tiles;
+  if ((mTileColumns == 0) || (mTileRows == 0) ||
+      (r.right + 1 < mTilesBounds.left) || (r.left - 1 > mTilesBounds.right) ||
+      (r.bottom + 1 < mTilesBounds.top) || (r.top - 1 > mTilesBounds.bottom)) {
+    return tiles;  // rect does not touch the plane area at all
+  }
+  int firstColumn = qBound<ClipperLib::cInt>(
+      0, (r.left - 1 - mTilesBounds.left) / mTileWidth, mTileColumns - 1);
+  int lastColumn = qBound<ClipperLib::cInt>(
+      0, (r.right + 1 - mTilesBounds.left) / mTileWidth, mTileColumns - 1);
+  int firstRow = qBound<ClipperLib::cInt>(
+      0, (r.top - 1 - mTilesBounds.top) / mTileHeight, mTileRows - 1);
+  int lastRow = qBound<ClipperLib::cInt>(
+      0, (r.bottom + 1 - mTilesBounds.top) / mTileHeight, mTileRows - 1);
+  for (int row = firstRow; row <= lastRow; ++row) {
+    for (int column = firstColumn; column <= lastColumn; ++column) {
+      tiles.append(row * mTileColumns + column);
+    }
+  }
+  return tiles;
+}
+
+QByteArray BoardPlaneFragmentsBuilder::calcTileHash(
+    const QVector<int>& cutOuts) const noexcept {
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  foreach (int index, cutOuts) {
+    const ClipperLib::Path& path = mCutOuts.at(index);
+    hash.addData(QByteArray::number(static_cast<qulonglong>(path.size())));
+    hash.addData(reinterpret_cast<const char*>(path.data()),
+                 static_cast<int>(path.size() * sizeof(ClipperLib::IntPoint)));
+  }
+  return hash.result();
+}
+
+ClipperLib::Path BoardPlaneFragmentsBuilder::getTileOutline(int index) const
+    noexcept {
+  int              column = index % mTileColumns;
+  int              row    = index / mTileColumns;
+  ClipperLib::cInt left   = mTilesBounds.left + column * mTileWidth;
+  ClipperLib::cInt top    = mTilesBounds.top + row * mTileHeight;
+  ClipperLib::cInt right  = (column == mTileColumns - 1) ? mTilesBounds.right
+                                                         : left + mTileWidth;
+  ClipperLib::cInt bottom = (row == mTileRows - 1) ? mTilesBounds.bottom
+                                                   : top + mTileHeight;
+  return ClipperLib::Path{
+      ClipperLib::IntPoint(left, top),
+      ClipperLib::IntPoint(right, top),
+      ClipperLib::IntPoint(right, bottom),
+      ClipperLib::IntPoint(left, bottom),
+  };
+}
+
+void BoardPlaneFragmentsBuilder::invalidateTiles() noexcept {
+  mArea.clear();
+  mSubtracted.clear();
+  mTileHashes.clear();
 }
 
 /*******************************************************************************
  *  Helper Methods
  ******************************************************************************/
 
+ClipperLib::Paths BoardPlaneFragmentsBuilder::calcBoardArea(
+    const QVector<Path>& boardOutlines, const UnsignedLength& clearance,
+    const PositiveLength& maxArcTolerance) {
+  ClipperLib::Paths   boardArea;
+  ClipperLib::Clipper boardAreaClipper;
+  foreach (const Path& outline, boardOutlines) {
+    ClipperLib::Path path = ClipperHelpers::convert(outline, maxArcTolerance);
+    boardAreaClipper.AddPath(path, ClipperLib::ptSubject, true);
+  }
+  boardAreaClipper.Execute(ClipperLib::ctXor, boardArea, ClipperLib::pftEvenOdd,
+                           ClipperLib::pftEvenOdd);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
+
+  // perform clearance offset
+  ClipperHelpers::offset(boardArea, -clearance,
+                         maxArcTolerance);  // can throw
+  return boardArea;
+}
+
+QByteArray BoardPlaneFragmentsBuilder::calcPathsHash(
+    const ClipperLib::Paths& paths, bool sorted) noexcept {
+  // Note: If sorted, the hashes of all paths are sorted before combining them
+  // to make the result independent of the order of the paths.
+  QVector<QByteArray> pathHashes;
+  pathHashes.reserve(static_cast<int>(paths.size()));
+  for (const ClipperLib::Path& path : paths) {
+    int size = static_cast<int>(path.size() * sizeof(ClipperLib::IntPoint));
+    pathHashes.append(QCryptographicHash::hash(
+        QByteArray(reinterpret_cast<const char*>(path.data()), size),
+        QCryptographicHash::Md5));
+  }
+  if (sorted) {
+    std::sort(pathHashes.begin(), pathHashes.end());
+  }
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  foreach (const QByteArray& pathHash, pathHashes) {
+    hash.addData(pathHash);
+  }
+  return hash.result();
+}
+
 ClipperLib::Path BoardPlaneFragmentsBuilder::createPadCutOut(
-    const BI_FootprintPad& pad) const noexcept {
+    const BI_Plane& plane, const BI_FootprintPad& pad,
+    const PositiveLength& maxArcTolerance) noexcept {
   bool differentNetSignal =
-      (pad.getCompSigInstNetSignal() != &mPlane.getNetSignal());
-  if ((mPlane.getConnectStyle() == BI_Plane::ConnectStyle::None) ||
+      (pad.getCompSigInstNetSignal() != &plane.getNetSignal());
+  if ((plane.getConnectStyle() == BI_Plane::ConnectStyle::None) ||
       differentNetSignal) {
-    return ClipperHelpers::convert(
-        pad.getSceneOutline(*mPlane.getMinClearance()), maxArcTolerance());
+    return pad.getClipperSceneOutline(*plane.getMinClearance(),
+                                      maxArcTolerance);
   } else {
     return ClipperLib::Path();
   }
 }
 
 ClipperLib::Path BoardPlaneFragmentsBuilder::createViaCutOut(
-    const BI_Via& via) const noexcept {
+    const BI_Plane& plane, const BI_Via& via,
+    const PositiveLength& maxArcTolerance) noexcept {
   bool differentNetSignal =
-      (&via.getNetSignalOfNetSegment() != &mPlane.getNetSignal());
-  if ((mPlane.getConnectStyle() == BI_Plane::ConnectStyle::None) ||
+      (&via.getNetSignalOfNetSegment() != &plane.getNetSignal());
+  if ((plane.getConnectStyle() == BI_Plane::ConnectStyle::None) ||
       differentNetSignal) {
-    return ClipperHelpers::convert(
-        via.getSceneOutline(*mPlane.getMinClearance()), maxArcTolerance());
+    return via.getClipperSceneOutline(*plane.getMinClearance(),
+                                      maxArcTolerance);
   } else {
     return ClipperLib::Path();
   }
 }
 
+ClipperLib::IntRect BoardPlaneFragmentsBuilder::getBounds(
+    const ClipperLib::Path& path) noexcept {
+  ClipperLib::IntRect rect{0, 0, 0, 0};
+  bool                first = true;
+  for (const ClipperLib::IntPoint& p : path) {
+    if (first || (p.X < rect.left)) rect.left = p.X;
+    if (first || (p.X > rect.right)) rect.right = p.X;
+    if (first || (p.Y < rect.top)) rect.top = p.Y;
+    if (first || (p.Y > rect.bottom)) rect.bottom = p.Y;
+    first = false;
+  }
+  return rect;
+}
+
+ClipperLib::IntRect BoardPlaneFragmentsBuilder::getBounds(
+    const ClipperLib::Paths& paths) noexcept {
+  ClipperLib::IntRect rect{0, 0, 0, 0};
+  bool                first = true;
+  for (const ClipperLib::Path& path : paths) {
+    for (const ClipperLib::IntPoint& p : path) {
+      if (first || (p.X < rect.left)) rect.left = p.X;
+      if (first || (p.X > rect.right)) rect.right = p.X;
+      if (first || (p.Y < rect.top)) rect.top = p.Y;
+      if (first || (p.Y > rect.bottom)) rect.bottom = p.Y;
+      first = false;
+    }
+  }
+  return rect;
+}
+
+bool BoardPlaneFragmentsBuilder::intersects(
+    const ClipperLib::IntRect& a, const ClipperLib::IntRect& b) noexcept {
+  return (a.left <= b.right) && (a.right >= b.left) && (a.top <= b.bottom) &&
+         (a.bottom >= b.top);
+}
+
+bool BoardPlaneFragmentsBuilder::intersects(const ClipperLib::Path& a,
+                                            const ClipperLib::Path& b) {
+  // Note: If a vertex of one path lies strictly inside the other path, the
+  // paths intersect for sure. This is the common case (e.g. a pad within a
+  // plane fragment), so the expensive polygon intersection is avoided mostly.
+  if ((!a.empty()) && (ClipperLib::PointInPolygon(a.front(), b) == 1)) {
+    return true;
+  }
+  if ((!b.empty()) && (ClipperLib::PointInPolygon(b.front(), a) == 1)) {
+    return true;
+  }
+  ClipperLib::Paths intersections =
+      execute(ClipperLib::Paths{a}, ClipperLib::Paths{b},
+              ClipperLib::ctIntersection, ClipperLib::pftNonZero,
+              ClipperLib::pftNonZero);
+  return !intersections.empty();
+}
+
+ClipperLib::Paths BoardPlaneFragmentsBuilder::execute(
+    const ClipperLib::Paths& subject, const ClipperLib::Paths& clip,
+    ClipperLib::ClipType type, ClipperLib::PolyFillType subjectFillType,
+    ClipperLib::PolyFillType clipFillType) {
+  ClipperLib::Clipper c;
+  c.AddPaths(subject, ClipperLib::ptSubject, true);
+  c.AddPaths(clip, ClipperLib::ptClip, true);
+  ClipperLib::Paths result;
+  c.Execute(type, result, subjectFillType, clipFillType);
+  PerformanceCounters::add(PerformanceCounters::Counter::ClipperExecutions);
+  return result;
+}
+
+/*******************************************************************************
+ *  Class BoardAreaCache
+ ******************************************************************************/
+
+BoardAreaCache::BoardAreaCache() noexcept : mMaxArcTolerance(0) {
+}
+
+BoardAreaCache::~BoardAreaCache() noexcept {
+}
+
+std::shared_ptr<const ClipperLib::Paths> BoardAreaCache::get(
+    const QVector<Path>& boardOutlines, const UnsignedLength& clearance,
+    const PositiveLength& maxArcTolerance) {
+  if ((boardOutlines != mBoardOutlines) ||
+      (*maxArcTolerance != mMaxArcTolerance)) {
+    mAreas.clear();
+    mBoardOutlines   = boardOutlines;
+    mMaxArcTolerance = *maxArcTolerance;
+  }
+  std::shared_ptr<const ClipperLib::Paths>& area = mAreas[clearance];
+  if (!area) {
+    area = std::make_shared<ClipperLib::Paths>(
+        BoardPlaneFragmentsBuilder::calcBoardArea(
+            boardOutlines, clearance, maxArcTolerance));  // can throw
+  }
+  return area;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
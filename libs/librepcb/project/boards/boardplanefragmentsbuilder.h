@@ -24,10 +24,15 @@
  *  Includes
  ******************************************************************************/
 #include <clipper/clipper.hpp>
+#include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/uuid.h>
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -37,6 +42,8 @@ namespace project {
 class BI_Plane;
 class BI_Via;
 class BI_FootprintPad;
+class BoardSpatialIndex;
+class BoardAreaCache;
 
 /*******************************************************************************
  *  Class BoardPlaneFragmentsBuilder
@@ -44,54 +51,310 @@ class BI_FootprintPad;
 
 /**
  * @brief The BoardPlaneFragmentsBuilder class
+ *
+ * The fragments are built from an immutable snapshot of the board (see
+ * #Snapshot), so they can be built in a worker thread. Only the objects which
+ * overlap with the plane are part of the snapshot (they are queried from a
+ * librepcb::project::BoardSpatialIndex), so small local planes are cheap to
+ * build even on large boards.
+ *
+ * The builder remembers the cut-outs (vias, pads, holes, netlines and other
+ * planes) of the last build, together with their bounding boxes. For that, the
+ * plane area is split into a grid of tiles and a hash of all cut-outs touching
+ * a tile is stored per tile. When building the fragments again, only the tiles
+ * whose cut-outs have changed since the last build are re-clipped, while the
+ * rest of the plane is taken over from the last build. So moving a single item
+ * does not require to subtract all objects of the board again.
+ *
+ * @note To benefit from this, the same builder instance needs to be used for
+ *       all builds of a plane (see librepcb::project::BI_Plane).
  */
 class BoardPlaneFragmentsBuilder final {
+  Q_DECLARE_TR_FUNCTIONS(BoardPlaneFragmentsBuilder)
+
 public:
+  // Types
+  typedef QHash<Uuid, QVector<Path>> PlaneFragments;
+
+  /**
+   * @brief Quality of the built fragments
+   */
+  enum class Quality {
+    Draft,        ///< Coarse arcs and no minimum width, for interactive editing
+    Fabrication,  ///< Exact fragments, e.g. for exporting fabrication data
+  };
+
+  /**
+   * @brief Immutable snapshot of all data needed to build a plane
+   *
+   * The snapshot is created in the main thread with #createSnapshot(). It
+   * does not reference any board items, so the fragments can be built from
+   * it in a worker thread even while the board is modified.
+   */
+  struct Snapshot {
+    Uuid                         uuid;
+    Quality                      quality;
+    PositiveLength               maxArcTolerance;  ///< Depends on ::quality
+    Path                         outline;
+    UnsignedLength               minWidth;
+    UnsignedLength               minClearance;
+    bool                         keepOrphans;
+    std::shared_ptr<const ClipperLib::Paths> boardArea;  ///< Incl. clearance
+    QVector<Uuid>                otherPlanes;   ///< Planes to subtract
+    ClipperLib::Paths            cutOuts;       ///< Cut-outs except planes
+    QVector<ClipperLib::IntRect> cutOutBounds;  ///< Bounds of ::cutOuts
+    ClipperLib::Paths            connectedNetSignalAreas;
+  };
+
   // Constructors / Destructor
-  BoardPlaneFragmentsBuilder()                                        = delete;
   BoardPlaneFragmentsBuilder(const BoardPlaneFragmentsBuilder& other) = delete;
-  BoardPlaneFragmentsBuilder(BI_Plane& plane) noexcept;
+  BoardPlaneFragmentsBuilder() noexcept;
   ~BoardPlaneFragmentsBuilder() noexcept;
 
   // General Methods
-  QVector<Path> buildFragments() noexcept;
+
+  /**
+   * @brief Build the plane fragments
+   *
+   * @note This method can be called from any thread, but not from multiple
+   *       threads at the same time for the same builder.
+   *
+   * @param snapshot        The snapshot of the plane to build
+   * @param planeFragments  The fragments of (at least) all planes listed in
+   *                        Snapshot::otherPlanes
+   *
+   * @return The fragments of the plane (empty on error)
+   */
+  QVector<Path> buildFragments(const Snapshot&       snapshot,
+                               const PlaneFragments& planeFragments) noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Create the snapshot of a plane
+   *
+   * Only the objects which overlap with the plane are taken into account.
+   *
+   * @param plane   The plane to create the snapshot of
+   * @param index   Spatial index of the plane's board
+   * @param quality The quality of the fragments to build
+   * @param boardAreaCache  If not `nullptr`, the board area is taken from
+   *                        (or added to) this cache instead of calculating
+   *                        it for each plane
+   *
+   * @return The created snapshot
+   */
+  static Snapshot createSnapshot(const BI_Plane&          plane,
+                                 const BoardSpatialIndex& index,
+                                 Quality                  quality,
+                                 BoardAreaCache* boardAreaCache = nullptr);
+
+  /**
+   * @brief Get the maximum allowed arc tolerance when flattening arcs
+   *
+   * @note Do not change the tolerance of Quality::Fabrication if you don't
+   *       know exactly what you're doing (it affects all planes in all existing
+   *       boards)!
+   *
+   * @param quality   The quality of the fragments
+   *
+   * @return The arc tolerance
+   */
+  static PositiveLength getMaxArcTolerance(Quality quality) noexcept;
+
+  /**
+   * @brief Calculate a fingerprint of all inputs of a plane
+   *
+   * Snapshots with the same fingerprint result in the same fragments, so the
+   * fingerprint allows to detect whether previously built fragments (e.g.
+   * loaded from a cache file) are still up to date. Since the fragments also
+   * depend on the fragments of other planes, their fingerprints are included
+   * as well. The order of the cut-outs does not matter.
+   *
+   * @param snapshot      The snapshot of the plane
+   * @param fingerprints  The fingerprints of (at least) all planes listed in
+   *                      Snapshot::otherPlanes
+   *
+   * @return The fingerprint of the plane
+   */
+  static QByteArray calcFingerprint(
+      const Snapshot&                snapshot,
+      const QHash<Uuid, QByteArray>& fingerprints) noexcept;
 
   // Operator Overloadings
   BoardPlaneFragmentsBuilder& operator=(const BoardPlaneFragmentsBuilder& rhs) =
       delete;
 
 private:  // Methods
-  void addPlaneOutline();
-  void clipToBoardOutline();
-  void subtractOtherObjects();
-  void ensureMinimumWidth();
+  void addPlaneOutline(const Snapshot& snapshot);
+  void clipToBoardOutline(const Snapshot& snapshot);
+  void subtractOtherObjects(const Snapshot&       snapshot,
+                            const PlaneFragments& planeFragments);
+  void ensureMinimumWidth(const Snapshot& snapshot);
   void flattenResult();
-  void removeOrphans();
+  void removeOrphans(const Snapshot& snapshot);
+
+  // Cut-Out Methods
+  void collectCutOuts(const Snapshot&       snapshot,
+                      const PlaneFragments& planeFragments);
+  void        addCutOut(ClipperLib::Path path) noexcept;
+  static void addCutOut(Snapshot& snapshot, ClipperLib::Path path) noexcept;
+  ClipperLib::Paths subtractCutOuts(const ClipperLib::Paths& area,
+                                    const QVector<int>&      cutOuts) const;
+
+  // Tile Methods
+  void                  initTiles() noexcept;
+  QVector<QVector<int>> assignToTiles(
+      const QVector<ClipperLib::IntRect>& bounds) const noexcept;
+  QVector<int> getTilesInRect(const ClipperLib::IntRect& rect) const noexcept;
+  QByteArray calcTileHash(const QVector<int>& cutOuts) const noexcept;
+  ClipperLib::Path      getTileOutline(int index) const noexcept;
+  void                  invalidateTiles() noexcept;
 
   // Helper Methods
-  ClipperLib::Path createPadCutOut(const BI_FootprintPad& pad) const noexcept;
-  ClipperLib::Path createViaCutOut(const BI_Via& via) const noexcept;
+  static ClipperLib::Paths   calcBoardArea(
+      const QVector<Path>& boardOutlines, const UnsignedLength& clearance,
+      const PositiveLength& maxArcTolerance);
+  static ClipperLib::Path    createPadCutOut(
+      const BI_Plane& plane, const BI_FootprintPad& pad,
+      const PositiveLength& maxArcTolerance) noexcept;
+  static ClipperLib::Path    createViaCutOut(
+      const BI_Plane& plane, const BI_Via& via,
+      const PositiveLength& maxArcTolerance) noexcept;
+  static QByteArray calcPathsHash(const ClipperLib::Paths& paths,
+                                  bool sorted) noexcept;
+  static ClipperLib::IntRect getBounds(const ClipperLib::Path& path) noexcept;
+  static ClipperLib::IntRect getBounds(const ClipperLib::Paths& paths) noexcept;
+  static bool                intersects(const ClipperLib::IntRect& a,
+                                        const ClipperLib::IntRect& b) noexcept;
+  static bool                intersects(const ClipperLib::Path& a,
+                                        const ClipperLib::Path& b);
+  static ClipperLib::Paths   execute(const ClipperLib::Paths& subject,
+                                     const ClipperLib::Paths& clip,
+                                     ClipperLib::ClipType     type,
+                                     ClipperLib::PolyFillType subjectFillType,
+                                     ClipperLib::PolyFillType clipFillType);
 
   /**
-   * Returns the maximum allowed arc tolerance when flattening arcs. Do not
-   * change this if you don't know exactly what you're doing (it affects all
-   * planes in all existing boards)!
+   * Returns the minimum size of a tile. Smaller tiles reduce the area to be
+   * re-clipped after a modification, but increase the overhead of building
+   * the whole plane.
    */
-  static PositiveLength maxArcTolerance() noexcept {
-    return PositiveLength(5000);
+  static PositiveLength minTileSize() noexcept {
+    return PositiveLength(2000000);  // 2mm
   }
 
+  /**
+   * Returns the maximum count of tiles in each direction.
+   */
+  static int maxTilesPerDirection() noexcept { return 16; }
+
 private:  // Data
-  BI_Plane&         mPlane;
-  ClipperLib::Paths mConnectedNetSignalAreas;
+  friend class BoardAreaCache;
+
   ClipperLib::Paths mResult;
+
+  // Cut-outs of the current build
+  ClipperLib::Paths            mCutOuts;
+  QVector<ClipperLib::IntRect> mCutOutBounds;
+
+  // State of the last build
+  ClipperLib::Paths   mArea;        ///< Plane outline clipped to the board
+  ClipperLib::Paths   mSubtracted;  ///< ::mArea minus all cut-outs
+  ClipperLib::IntRect mTilesBounds;
+  ClipperLib::cInt    mTileWidth;
+  ClipperLib::cInt    mTileHeight;
+  int                 mTileColumns;
+  int                 mTileRows;
+  QVector<QByteArray> mTileHashes;  ///< Hash of the cut-outs of each tile
 };
 
 /*******************************************************************************
- *  End of File
+ *  Non-Member Functions
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  Class BoardAreaCache
  ******************************************************************************/
 
+/**
+ * @brief Cache of the board area used by the plane fragments builder
+ *
+ * The board area (all board outlines XOR'ed, shrinked by the clearance of a
+ * plane) only depends on the board outlines, the clearance and the arc
+ * tolerance. So it is calculated only once per clearance value and shared by
+ * the snapshots of all planes. As soon as the board outlines or the arc
+ * tolerance change, the cache is cleared automatically.
+ *
+ * @note The cache is not thread-safe, but the returned areas are immutable
+ *       and can be used from any thread.
+ */
+class BoardAreaCache final {
+public:
+  // Constructors / Destructor
+  BoardAreaCache(const BoardAreaCache& other) = delete;
+  BoardAreaCache() noexcept;
+  ~BoardAreaCache() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get the board area
+   *
+   * @param boardOutlines     All paths on the board outlines layer
+   * @param clearance         Clearance to the board outlines
+   * @param maxArcTolerance   Arc tolerance for the conversion to polygons
+   *
+   * @return The (cached) board area
+   */
+  std::shared_ptr<const ClipperLib::Paths> get(
+      const QVector<Path>& boardOutlines, const UnsignedLength& clearance,
+      const PositiveLength& maxArcTolerance);
+
+  // Operator Overloadings
+  BoardAreaCache& operator=(const BoardAreaCache& rhs) = delete;
+
+private:  // Data
+  QVector<Path> mBoardOutlines;
+  Length        mMaxArcTolerance;
+  QHash<UnsignedLength, std::shared_ptr<const ClipperLib::Paths>> mAreas;
+};
+
 }  // namespace project
+
+template <>
+inline SExpression serializeToSExpression(
+    const project::BoardPlaneFragmentsBuilder::Quality& obj) {
+  switch (obj) {
+    case project::BoardPlaneFragmentsBuilder::Quality::Draft:
+      return SExpression::createToken("draft");
+    case project::BoardPlaneFragmentsBuilder::Quality::Fabrication:
+      return SExpression::createToken("fabrication");
+    default:
+      throw LogicError(__FILE__, __LINE__);
+  }
+}
+
+template <>
+inline project::BoardPlaneFragmentsBuilder::Quality deserializeFromSExpression(
+    const SExpression& sexpr, bool throwIfEmpty) {
+  QString str = sexpr.getStringOrToken(throwIfEmpty);
+  if (str == "draft")
+    return project::BoardPlaneFragmentsBuilder::Quality::Draft;
+  else if (str == "fabrication")
+    return project::BoardPlaneFragmentsBuilder::Quality::Fabrication;
+  else
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(project::BoardPlaneFragmentsBuilder::tr(
+                    "Unknown plane quality: \"%1\""))
+            .arg(str));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
 }  // namespace librepcb
 
 #endif  // LIBREPCB_PROJECT_BOARDPLANEFRAGMENTSBUILDER_H
@@ -34,6 +34,7 @@
 namespace librepcb {
 namespace project {
 
+class BI_Base;
 class BI_Device;
 class BI_Footprint;
 class BI_FootprintPad;
@@ -60,12 +61,8 @@ public:
   // Constructors / Destructor
   BoardSelectionQuery()                                 = delete;
   BoardSelectionQuery(const BoardSelectionQuery& other) = delete;
-  BoardSelectionQuery(const QMap<Uuid, BI_Device*>& deviceInstances,
-                      const QList<BI_NetSegment*>&  netsegments,
-                      const QList<BI_Plane*>&       planes,
-                      const QList<BI_Polygon*>&     polygons,
-                      const QList<BI_StrokeText*>&  strokeTexts,
-                      const QList<BI_Hole*>& holes, QObject* parent = nullptr);
+  BoardSelectionQuery(const QSet<BI_Base*>& selectedItems,
+                      QObject*              parent = nullptr);
   ~BoardSelectionQuery() noexcept;
 
   // Getters
@@ -106,13 +103,8 @@ public:
   BoardSelectionQuery& operator=(const BoardSelectionQuery& rhs) = delete;
 
 private:
-  // references to the Board object
-  const QMap<Uuid, BI_Device*>& mDevices;
-  const QList<BI_NetSegment*>&  mNetSegments;
-  const QList<BI_Plane*>&       mPlanes;
-  const QList<BI_Polygon*>&     mPolygons;
-  const QList<BI_StrokeText*>&  mStrokeTexts;
-  const QList<BI_Hole*>&        mHoles;
+  // reference to the Board object
+  const QSet<BI_Base*>& mSelectedItems;  ///< All selected items of the board
 
   // query result
   QSet<BI_Device*>     mResultDeviceInstances;
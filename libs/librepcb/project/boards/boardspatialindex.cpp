@@ -0,0 +1,248 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boardspatialindex.h"
+
+#include "board.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_hole.h"
+#include "items/bi_netline.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_polygon.h"
+#include "items/bi_via.h"
+
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/footprintpad.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardSpatialIndex::BoardSpatialIndex(const Board& board) noexcept
+  : mBounds{0, 0, 0, 0} {
+  // Note: The order of the items must be deterministic since the order of
+  // the query results depends on it.
+  foreach (const BI_Device* device, board.getDeviceInstances()) {
+    for (const Hole& hole :
+         device->getFootprint().getLibFootprint().getHoles()) {
+      addHole(device->getFootprint().mapToScene(hole.getPosition()),
+              *hole.getDiameter());
+    }
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      addPad(*pad);
+    }
+  }
+  foreach (const BI_Hole* hole, board.getHoles()) {
+    addHole(hole->getHole().getPosition(), *hole->getHole().getDiameter());
+  }
+  foreach (const BI_NetSegment* netsegment, board.getNetSegments()) {
+    foreach (const BI_Via* via, netsegment->getVias()) { addVia(*via); }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      addNetLine(*netline);
+    }
+  }
+  foreach (const BI_Polygon* polygon, board.getPolygons()) {
+    if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+      mBoardOutlines.append(polygon->getPolygon().getPath());
+    }
+  }
+}
+
+BoardSpatialIndex::~BoardSpatialIndex() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int BoardSpatialIndex::getNetLinesLayerIndex(const QString& layerName) const
+    noexcept {
+  for (int i = 0; i < mNetLines.count(); ++i) {
+    if (mNetLines.at(i).layerName == layerName) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+QVector<const BoardSpatialIndex::Item*> BoardSpatialIndex::query(
+    const ClipperLib::IntRect& rect) const noexcept {
+  QVector<const Item*> items;
+  if (mItems.isEmpty() || (rect.right < mBounds.left) ||
+      (rect.left > mBounds.right) || (rect.bottom < mBounds.top) ||
+      (rect.top > mBounds.bottom)) {
+    return items;
+  }
+
+  // only visit cells which can contain items at all
+  int firstX = getCellIndex(qMax(rect.left, mBounds.left));
+  int lastX  = getCellIndex(qMin(rect.right, mBounds.right));
+  int firstY = getCellIndex(qMax(rect.top, mBounds.top));
+  int lastY  = getCellIndex(qMin(rect.bottom, mBounds.bottom));
+  QVector<int> indices;
+  for (int x = firstX; x <= lastX; ++x) {
+    for (int y = firstY; y <= lastY; ++y) {
+      auto it = mCells.constFind(getCellKey(x, y));
+      if (it != mCells.constEnd()) {
+        indices += *it;
+      }
+    }
+  }
+
+  // remove duplicates (items spanning several cells) and restore board order
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  foreach (int index, indices) {
+    const Item& item = mItems.at(index);
+    if ((item.bounds.right >= rect.left) && (item.bounds.left <= rect.right) &&
+        (item.bounds.bottom >= rect.top) && (item.bounds.top <= rect.bottom)) {
+      items.append(&item);
+    }
+  }
+  return items;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BoardSpatialIndex::addHole(const Point&  position,
+                                const Length& diameter) noexcept {
+  Item item     = createItem(ItemType::Hole, position, position, diameter / 2);
+  item.position = position;
+  item.diameter = diameter;
+  addItem(item);
+}
+
+void BoardSpatialIndex::addPad(const BI_FootprintPad& pad) noexcept {
+  // Note: Half of width+height is always larger than the distance from the
+  // center to the corners, no matter how the pad is rotated.
+  Length radius =
+      (*pad.getLibPad().getWidth() + *pad.getLibPad().getHeight()) / 2;
+  Item item = createItem(ItemType::Pad, pad.getPosition(), pad.getPosition(),
+                         radius);
+  item.pad  = &pad;
+  addItem(item);
+}
+
+void BoardSpatialIndex::addVia(const BI_Via& via) noexcept {
+  Item item = createItem(ItemType::Via, via.getPosition(), via.getPosition(),
+                         *via.getSize() / 2);
+  item.via  = &via;
+  addItem(item);
+}
+
+void BoardSpatialIndex::addNetLine(const BI_NetLine& netLine) noexcept {
+  const QString& layerName = netLine.getLayer().getName();
+  const Point&   p1        = netLine.getStartPoint().getPosition();
+  const Point&   p2        = netLine.getEndPoint().getPosition();
+
+  Item item    = createItem(ItemType::NetLine, p1, p2, *netLine.getWidth() / 2);
+  item.netLine = &netLine;
+  item.layer   = getNetLinesLayerIndex(layerName);
+  if (item.layer < 0) {
+    item.layer = mNetLines.count();
+    mNetLines.append(NetLines{layerName, {}, {}, {}, {}, {}});
+  }
+  NetLines& lines = mNetLines[item.layer];
+  item.index      = lines.netLines.count();
+  lines.startPoints.append(
+      ClipperLib::IntPoint(p1.getX().toNm(), p1.getY().toNm()));
+  lines.endPoints.append(
+      ClipperLib::IntPoint(p2.getX().toNm(), p2.getY().toNm()));
+  lines.widths.append(netLine.getWidth()->toNm());
+  lines.netSignals.append(&netLine.getNetSignalOfNetSegment());
+  lines.netLines.append(&netLine);
+  addItem(item);
+}
+
+void BoardSpatialIndex::addItem(const Item& item) noexcept {
+  if (mItems.isEmpty()) {
+    mBounds = item.bounds;
+  } else {
+    mBounds.left   = qMin(mBounds.left, item.bounds.left);
+    mBounds.top    = qMin(mBounds.top, item.bounds.top);
+    mBounds.right  = qMax(mBounds.right, item.bounds.right);
+    mBounds.bottom = qMax(mBounds.bottom, item.bounds.bottom);
+  }
+  int index = mItems.count();
+  mItems.append(item);
+  for (int x = getCellIndex(item.bounds.left);
+       x <= getCellIndex(item.bounds.right); ++x) {
+    for (int y = getCellIndex(item.bounds.top);
+         y <= getCellIndex(item.bounds.bottom); ++y) {
+      mCells[getCellKey(x, y)].append(index);
+    }
+  }
+}
+
+BoardSpatialIndex::Item BoardSpatialIndex::createItem(
+    ItemType type, const Point& p1, const Point& p2,
+    const Length& radius) noexcept {
+  // Note: Add 1nm to be on the safe side regarding rounding errors.
+  ClipperLib::cInt r = radius.abs().toNm() + 1;
+  Item             item;
+  item.type          = type;
+  item.bounds.left   = qMin(p1.getX(), p2.getX()).toNm() - r;
+  item.bounds.top    = qMin(p1.getY(), p2.getY()).toNm() - r;
+  item.bounds.right  = qMax(p1.getX(), p2.getX()).toNm() + r;
+  item.bounds.bottom = qMax(p1.getY(), p2.getY()).toNm() + r;
+  item.pad           = nullptr;
+  item.via           = nullptr;
+  item.netLine       = nullptr;
+  item.layer         = -1;
+  item.index         = -1;
+  return item;
+}
+
+int BoardSpatialIndex::getCellIndex(ClipperLib::cInt coordinate) noexcept {
+  // Note: Round towards negative infinity to get correct indices for
+  // negative coordinates too.
+  ClipperLib::cInt size = cellSize()->toNm();
+  return static_cast<int>((coordinate >= 0) ? (coordinate / size)
+                                            : ((coordinate - size + 1) / size));
+}
+
+quint64 BoardSpatialIndex::getCellKey(int x, int y) noexcept {
+  return (static_cast<quint64>(static_cast<quint32>(x)) << 32) |
+         static_cast<quint32>(y);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
@@ -0,0 +1,175 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
+#define LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <clipper/clipper.hpp>
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/common/units/point.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class BI_FootprintPad;
+class BI_NetLine;
+class BI_Via;
+class NetSignal;
+
+/*******************************************************************************
+ *  Class BoardSpatialIndex
+ ******************************************************************************/
+
+/**
+ * @brief Grid based spatial index of the copper objects of a board
+ *
+ * The index contains all holes, pads, vias and netlines of a board at the time
+ * of creating the index, together with a conservative bounding box of each
+ * object. It allows to quickly determine the objects within a given area,
+ * for example to only consider objects overlapping a plane when building its
+ * fragments.
+ *
+ * The netlines are additionally stored per copper layer in contiguous arrays
+ * (see #NetLines), so passes over the netlines of a layer don't need to
+ * dereference the netline, netpoint and layer objects just to get their
+ * geometry, layer and net signal.
+ *
+ * In addition, the index holds the board outlines. Since librepcb::Path is
+ * implicitly shared, all users of the index (e.g. the snapshots of all planes
+ * of a board) share the same outline data instead of copying it.
+ *
+ * @warning The index is not updated when the board is modified, so it must
+ *          not be used anymore after adding, removing or moving any items.
+ *
+ * @note Since the index is immutable, it is safe to query it from multiple
+ *       threads at the same time.
+ */
+class BoardSpatialIndex final {
+public:
+  // Types
+  enum class ItemType { Hole, Pad, Via, NetLine };
+
+  struct Item {
+    ItemType               type;
+    ClipperLib::IntRect    bounds;    ///< Bounding box [nm]
+    Point                  position;  ///< Only valid for ItemType::Hole
+    Length                 diameter;  ///< Only valid for ItemType::Hole
+    const BI_FootprintPad* pad;       ///< Only valid for ItemType::Pad
+    const BI_Via*          via;       ///< Only valid for ItemType::Via
+    const BI_NetLine*      netLine;   ///< Only valid for ItemType::NetLine
+    int                    layer;     ///< Index of the #NetLines of the layer
+    int                    index;     ///< Index within the #NetLines
+  };
+
+  /**
+   * @brief The netlines of a copper layer, as structure of arrays
+   *
+   * All arrays have the same size, the same index refers to the same netline.
+   * For netlines, Item::layer and Item::index refer to these arrays.
+   */
+  struct NetLines {
+    QString                       layerName;
+    QVector<ClipperLib::IntPoint> startPoints;  ///< [nm]
+    QVector<ClipperLib::IntPoint> endPoints;    ///< [nm]
+    QVector<ClipperLib::cInt>     widths;       ///< [nm]
+    QVector<const NetSignal*>     netSignals;
+    QVector<const BI_NetLine*>    netLines;
+  };
+
+  // Constructors / Destructor
+  BoardSpatialIndex()                               = delete;
+  BoardSpatialIndex(const BoardSpatialIndex& other) = delete;
+  explicit BoardSpatialIndex(const Board& board) noexcept;
+  ~BoardSpatialIndex() noexcept;
+
+  // Getters
+  const QVector<Path>& getBoardOutlines() const noexcept {
+    return mBoardOutlines;
+  }
+  const QVector<NetLines>& getNetLines() const noexcept { return mNetLines; }
+
+  /**
+   * @brief Get the index of the #NetLines of a layer
+   *
+   * @param layerName   Name of the copper layer
+   *
+   * @return Index within #getNetLines(), or -1 if there are no netlines on
+   *         the given layer
+   */
+  int getNetLinesLayerIndex(const QString& layerName) const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get all items whose bounding box overlaps a given area
+   *
+   * @param rect  The area of interest [nm]
+   *
+   * @return All overlapping items, in the same order as they appear on the
+   *         board (i.e. the result is deterministic)
+   */
+  QVector<const Item*> query(const ClipperLib::IntRect& rect) const noexcept;
+
+  // Operator Overloadings
+  BoardSpatialIndex& operator=(const BoardSpatialIndex& rhs) = delete;
+
+private:  // Methods
+  void addHole(const Point& position, const Length& diameter) noexcept;
+  void addPad(const BI_FootprintPad& pad) noexcept;
+  void addVia(const BI_Via& via) noexcept;
+  void addNetLine(const BI_NetLine& netLine) noexcept;
+  void addItem(const Item& item) noexcept;
+  static Item    createItem(ItemType type, const Point& p1, const Point& p2,
+                            const Length& radius) noexcept;
+  static int     getCellIndex(ClipperLib::cInt coordinate) noexcept;
+  static quint64 getCellKey(int x, int y) noexcept;
+
+  /**
+   * Returns the size of the grid cells. Should be in the range of the size of
+   * typical board objects, or a bit larger.
+   */
+  static PositiveLength cellSize() noexcept {
+    return PositiveLength(5000000);  // 5mm
+  }
+
+private:  // Data
+  QVector<Item>                mItems;
+  QHash<quint64, QVector<int>> mCells;   ///< Item indices per grid cell
+  ClipperLib::IntRect          mBounds;  ///< Bounding box of all items
+  QVector<Path>                mBoardOutlines;
+  QVector<NetLines>            mNetLines;  ///< Sorted by first appearance
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
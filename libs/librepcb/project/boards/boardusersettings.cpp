@@ -45,20 +45,43 @@ BoardUserSettings::BoardUserSettings(Board& board) noexcept
   : QObject(&board),
     mBoard(board),
     mLayerSettings(
-        new GraphicsLayerStackAppearanceSettings(board.getLayerStack())) {
+        new GraphicsLayerStackAppearanceSettings(board.getLayerStack())),
+    mPlanesEditingQuality(BoardPlaneFragmentsBuilder::Quality::Draft),
+    mPlanesFabricationQuality(
+        BoardPlaneFragmentsBuilder::Quality::Fabrication),
+    mPlanesAutoRebuild(true) {
 }
 
 BoardUserSettings::BoardUserSettings(Board&                   board,
                                      const BoardUserSettings& other) noexcept
   : BoardUserSettings(board) {
-  *mLayerSettings = *other.mLayerSettings;
+  *mLayerSettings            = *other.mLayerSettings;
+  mPlanesEditingQuality     = other.mPlanesEditingQuality;
+  mPlanesFabricationQuality = other.mPlanesFabricationQuality;
+  mPlanesAutoRebuild        = other.mPlanesAutoRebuild;
 }
 
 BoardUserSettings::BoardUserSettings(Board& board, const SExpression& node)
   : QObject(&board),
     mBoard(board),
     mLayerSettings(
-        new GraphicsLayerStackAppearanceSettings(board.getLayerStack(), node)) {
+        new GraphicsLayerStackAppearanceSettings(board.getLayerStack(), node)),
+    mPlanesEditingQuality(BoardPlaneFragmentsBuilder::Quality::Draft),
+    mPlanesFabricationQuality(
+        BoardPlaneFragmentsBuilder::Quality::Fabrication),
+    mPlanesAutoRebuild(true) {
+  // Note: The plane settings are optional to stay compatible with older files.
+  if (const SExpression* child = node.tryGetChildByPath("planes_quality")) {
+    mPlanesEditingQuality =
+        child->getValueByPath<BoardPlaneFragmentsBuilder::Quality>("editing");
+    mPlanesFabricationQuality =
+        child->getValueByPath<BoardPlaneFragmentsBuilder::Quality>(
+            "fabrication");
+  }
+  if (const SExpression* child =
+          node.tryGetChildByPath("planes_auto_rebuild")) {
+    mPlanesAutoRebuild = child->getValueOfFirstChild<bool>();
+  }
 }
 
 BoardUserSettings::~BoardUserSettings() noexcept {
@@ -70,6 +93,10 @@ BoardUserSettings::~BoardUserSettings() noexcept {
 
 void BoardUserSettings::serialize(SExpression& root) const {
   mLayerSettings->serialize(root);
+  SExpression& planesQuality = root.appendList("planes_quality", true);
+  planesQuality.appendChild("editing", mPlanesEditingQuality, false);
+  planesQuality.appendChild("fabrication", mPlanesFabricationQuality, false);
+  root.appendChild("planes_auto_rebuild", mPlanesAutoRebuild, true);
 }
 
 /*******************************************************************************
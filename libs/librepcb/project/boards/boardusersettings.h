@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "boardplanefragmentsbuilder.h"
+
 #include <librepcb/common/fileio/serializableobject.h>
 
 #include <QtCore>
@@ -57,6 +59,41 @@ public:
   BoardUserSettings(Board& board, const SExpression& node);
   ~BoardUserSettings() noexcept;
 
+  // Getters
+
+  /**
+   * @brief Get the quality of planes built while editing the board
+   */
+  BoardPlaneFragmentsBuilder::Quality getPlanesEditingQuality() const noexcept {
+    return mPlanesEditingQuality;
+  }
+
+  /**
+   * @brief Get the quality of planes built for exporting fabrication data
+   */
+  BoardPlaneFragmentsBuilder::Quality getPlanesFabricationQuality() const
+      noexcept {
+    return mPlanesFabricationQuality;
+  }
+
+  /**
+   * @brief Check whether planes are rebuilt automatically after modifications
+   */
+  bool getPlanesAutoRebuild() const noexcept { return mPlanesAutoRebuild; }
+
+  // Setters
+  void setPlanesEditingQuality(
+      BoardPlaneFragmentsBuilder::Quality quality) noexcept {
+    mPlanesEditingQuality = quality;
+  }
+  void setPlanesFabricationQuality(
+      BoardPlaneFragmentsBuilder::Quality quality) noexcept {
+    mPlanesFabricationQuality = quality;
+  }
+  void setPlanesAutoRebuild(bool autoRebuild) noexcept {
+    mPlanesAutoRebuild = autoRebuild;
+  }
+
   // General Methods
 
   /// @copydoc librepcb::SerializableObject::serialize()
@@ -69,6 +106,11 @@ private:  // Methods
   // General
   Board&                                               mBoard;
   QScopedPointer<GraphicsLayerStackAppearanceSettings> mLayerSettings;
+
+  // Planes
+  BoardPlaneFragmentsBuilder::Quality mPlanesEditingQuality;
+  BoardPlaneFragmentsBuilder::Quality mPlanesFabricationQuality;
+  bool                                mPlanesAutoRebuild;
 };
 
 /*******************************************************************************
@@ -81,6 +81,7 @@ void CmdBoardAdd::performUndo() {
 
 void CmdBoardAdd::performRedo() {
   mProject.addBoard(*mBoard, mPageIndex);  // can throw
+  mBoard->setModified();
 }
 
 /*******************************************************************************
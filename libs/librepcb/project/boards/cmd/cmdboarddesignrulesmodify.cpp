@@ -62,11 +62,13 @@ bool CmdBoardDesignRulesModify::performExecute() {
 void CmdBoardDesignRulesModify::performUndo() {
   mBoard.getDesignRules() = mOldRules;
   emit mBoard.attributesChanged();
+  mBoard.setModified();
 }
 
 void CmdBoardDesignRulesModify::performRedo() {
   mBoard.getDesignRules() = mNewRules;
   emit mBoard.attributesChanged();
+  mBoard.setModified();
 }
 
 /*******************************************************************************
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "cmdboardnetlineedit.h"
 
+#include "../board.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -73,11 +75,13 @@ bool CmdBoardNetLineEdit::performExecute() {
 void CmdBoardNetLineEdit::performUndo() {
   mNetLine.setLayer(*mOldLayer);
   mNetLine.setWidth(mOldWidth);
+  mNetLine.getBoard().setModified();
 }
 
 void CmdBoardNetLineEdit::performRedo() {
   mNetLine.setLayer(*mNewLayer);
   mNetLine.setWidth(mNewWidth);
+  mNetLine.getBoard().setModified();
 }
 
 /*******************************************************************************
@@ -48,6 +48,14 @@ public:
   explicit CmdBoardNetLineEdit(BI_NetLine& netline) noexcept;
   ~CmdBoardNetLineEdit() noexcept;
 
+  // Getters
+
+  /// @copydoc UndoCommand::getMemoryUsage()
+  qint64 getMemoryUsage() const noexcept override {
+    return UndoCommand::getMemoryUsage() + sizeof(CmdBoardNetLineEdit) -
+           sizeof(UndoCommand);
+  }
+
   // Setters
   void setLayer(GraphicsLayer& layer) noexcept;
   void setWidth(const PositiveLength& width) noexcept;
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetpointedit.h"
 
+#include "../board.h"
 #include "../items/bi_netpoint.h"
 
 #include <QtCore>
@@ -79,10 +80,12 @@ bool CmdBoardNetPointEdit::performExecute() {
 
 void CmdBoardNetPointEdit::performUndo() {
   mNetPoint.setPosition(mOldPos);
+  mNetPoint.getBoard().setModified();
 }
 
 void CmdBoardNetPointEdit::performRedo() {
   mNetPoint.setPosition(mNewPos);
+  mNetPoint.getBoard().setModified();
 }
 
 /*******************************************************************************
@@ -49,6 +49,14 @@ public:
   explicit CmdBoardNetPointEdit(BI_NetPoint& point) noexcept;
   ~CmdBoardNetPointEdit() noexcept;
 
+  // Getters
+
+  /// @copydoc UndoCommand::getMemoryUsage()
+  qint64 getMemoryUsage() const noexcept override {
+    return UndoCommand::getMemoryUsage() + sizeof(CmdBoardNetPointEdit) -
+           sizeof(UndoCommand);
+  }
+
   // Setters
   void setPosition(const Point& pos, bool immediate) noexcept;
   void translate(const Point& deltaPos, bool immediate) noexcept;
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetsegmentedit.h"
 
+#include "../board.h"
 #include "../items/bi_netsegment.h"
 
 #include <QtCore>
@@ -68,10 +69,12 @@ bool CmdBoardNetSegmentEdit::performExecute() {
 
 void CmdBoardNetSegmentEdit::performUndo() {
   mNetSegment.setNetSignal(*mOldNetSignal);  // can throw
+  mNetSegment.getBoard().setModified();
 }
 
 void CmdBoardNetSegmentEdit::performRedo() {
   mNetSegment.setNetSignal(*mNewNetSignal);  // can throw
+  mNetSegment.getBoard().setModified();
 }
 
 /*******************************************************************************
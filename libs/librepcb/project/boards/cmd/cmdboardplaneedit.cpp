@@ -168,7 +168,8 @@ void CmdBoardPlaneEdit::performUndo() {
   mPlane.setKeepOrphans(mOldKeepOrphans);
 
   // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  if (mDoRebuildOnChanges) mPlane.getBoard().scheduleAllPlanesRebuild();
+  mPlane.getBoard().setModified();
 }
 
 void CmdBoardPlaneEdit::performRedo() {
@@ -182,7 +183,8 @@ void CmdBoardPlaneEdit::performRedo() {
   mPlane.setKeepOrphans(mNewKeepOrphans);
 
   // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  if (mDoRebuildOnChanges) mPlane.getBoard().scheduleAllPlanesRebuild();
+  mPlane.getBoard().setModified();
 }
 
 /*******************************************************************************
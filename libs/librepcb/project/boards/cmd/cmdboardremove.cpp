@@ -61,6 +61,7 @@ bool CmdBoardRemove::performExecute() {
 
 void CmdBoardRemove::performUndo() {
   mProject.addBoard(mBoard, mIndex);  // can throw
+  mBoard.setModified();
 }
 
 void CmdBoardRemove::performRedo() {
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardviaedit.h"
 
+#include "../board.h"
 #include "../items/bi_via.h"
 
 #include <QtCore>
@@ -110,6 +111,7 @@ void CmdBoardViaEdit::performUndo() {
   mVia.setShape(mOldShape);
   mVia.setSize(mOldSize);
   mVia.setDrillDiameter(mOldDrillDiameter);
+  mVia.getBoard().setModified();
 }
 
 void CmdBoardViaEdit::performRedo() {
@@ -117,6 +119,7 @@ void CmdBoardViaEdit::performRedo() {
   mVia.setShape(mNewShape);
   mVia.setSize(mNewSize);
   mVia.setDrillDiameter(mNewDrillDiameter);
+  mVia.getBoard().setModified();
 }
 
 /*******************************************************************************
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmddeviceinstanceedit.h"
 
+#include "../board.h"
 #include "../items/bi_device.h"
 
 #include <QtCore>
@@ -156,12 +157,14 @@ void CmdDeviceInstanceEdit::performUndo() {
   mDevice.setIsMirrored(mOldMirrored);  // can throw
   mDevice.setPosition(mOldPos);
   mDevice.setRotation(mOldRotation);
+  mDevice.getBoard().setModified();
 }
 
 void CmdDeviceInstanceEdit::performRedo() {
   mDevice.setIsMirrored(mNewMirrored);  // can throw
   mDevice.setPosition(mNewPos);
   mDevice.setRotation(mNewRotation);
+  mDevice.getBoard().setModified();
 }
 
 /*******************************************************************************
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdfootprintstroketextadd.h"
 
+#include "../board.h"
 #include "../items/bi_footprint.h"
 
 #include <QtCore>
@@ -56,10 +57,12 @@ bool CmdFootprintStrokeTextAdd::performExecute() {
 
 void CmdFootprintStrokeTextAdd::performUndo() {
   mFootprint.removeStrokeText(mText);  // can throw
+  mFootprint.getBoard().setModified();
 }
 
 void CmdFootprintStrokeTextAdd::performRedo() {
   mFootprint.addStrokeText(mText);  // can throw
+  mFootprint.getBoard().setModified();
 }
 
 /*******************************************************************************
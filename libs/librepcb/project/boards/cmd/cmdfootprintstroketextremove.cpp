@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdfootprintstroketextremove.h"
 
+#include "../board.h"
 #include "../items/bi_footprint.h"
 
 #include <QtCore>
@@ -58,10 +59,12 @@ bool CmdFootprintStrokeTextRemove::performExecute() {
 
 void CmdFootprintStrokeTextRemove::performUndo() {
   mFootprint.addStrokeText(mText);  // can throw
+  mFootprint.getBoard().setModified();
 }
 
 void CmdFootprintStrokeTextRemove::performRedo() {
   mFootprint.removeStrokeText(mText);  // can throw
+  mFootprint.getBoard().setModified();
 }
 
 /*******************************************************************************
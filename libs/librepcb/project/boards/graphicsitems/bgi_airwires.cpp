@@ -0,0 +1,187 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "bgi_airwires.h"
+
+#include "../../circuit/netsignal.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BGI_AirWires::BGI_AirWires(Board& board) noexcept
+  : BGI_Base(), mBoard(board), mLayer(nullptr) {
+  mLayer = getLayer(GraphicsLayer::sBoardAirWires);
+  setZValue(Board::ZValue_AirWires);
+  setAcceptedMouseButtons(Qt::NoButton);
+  setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
+  updateCacheAndRepaint();
+}
+
+BGI_AirWires::~BGI_AirWires() noexcept {
+  disconnectNetSignals();
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void BGI_AirWires::updateCacheAndRepaint() noexcept {
+  prepareGeometryChange();
+  disconnectNetSignals();
+  mLines.clear();
+  mCircles.clear();
+  mNetRanges.clear();
+  mBoundingRect = QRectF();
+
+  const Length size(200000);
+  for (auto it = mBoard.getAirWires().constBegin();
+       it != mBoard.getAirWires().constEnd(); ++it) {
+    NetRange range{it.key(), mLines.count(), 0, mCircles.count(), 0, QRectF()};
+    foreach (const auto& points, it.value()) {
+      if (points.first == points.second) {
+        // vertical airwire, drawn as a cross with a circle around it
+        Point p1 = points.first + Point(size, size);
+        Point p2 = points.first - Point(size, size);
+        Point p3 = points.first + Point(size, -size);
+        Point p4 = points.first - Point(size, -size);
+        mLines.append(QLineF(p1.toPxQPointF(), p2.toPxQPointF()));
+        mLines.append(QLineF(p3.toPxQPointF(), p4.toPxQPointF()));
+        mCircles.append(
+            QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized());
+        range.boundingRect |= mCircles.last();
+      } else {
+        mLines.append(QLineF(points.first.toPxQPointF(),
+                             points.second.toPxQPointF()));
+        // Note: Add 1px to avoid empty rects of horizontal or vertical lines.
+        range.boundingRect |=
+            QRectF(mLines.last().p1(), mLines.last().p2())
+                .normalized()
+                .adjusted(-1, -1, 1, 1);
+      }
+    }
+    range.linesCount   = mLines.count() - range.firstLine;
+    range.circlesCount = mCircles.count() - range.firstCircle;
+    if (range.linesCount > 0) {
+      mNetRanges.append(range);
+      mBoundingRect |= range.boundingRect;
+      mHighlightChangedConnections.append(
+          QObject::connect(it.key(), &NetSignal::highlightedChanged,
+                           [this]() { update(); }));
+    }
+  }
+  update();
+}
+
+void BGI_AirWires::paint(QPainter*                       painter,
+                         const QStyleOptionGraphicsItem* option,
+                         QWidget*                        widget) {
+  Q_UNUSED(widget);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  const QRectF& exposedRect = option->exposedRect;
+
+  // draw lines, highlighted airwires on top of the others
+  if (mLayer && mLayer->isVisible()) {
+    QVector<QLineF> lines;
+    lines.reserve(mLines.count());
+    for (int i = 0; i < 2; ++i) {
+      const bool highlight = (i == 1);
+      lines.clear();
+      painter->setBrush(Qt::NoBrush);
+      qreal width = highlight ? 3 / lod : 0;  // highlighted are thicker
+      painter->setPen(QPen(mLayer->getColor(highlight), width, Qt::SolidLine,
+                           Qt::RoundCap));
+      foreach (const NetRange& range, mNetRanges) {
+        if ((range.netSignal->isHighlighted() != highlight) ||
+            (!exposedRect.intersects(range.boundingRect))) {
+          continue;
+        }
+        for (int k = 0; k < range.linesCount; ++k) {
+          const QLineF& line = mLines.at(range.firstLine + k);
+          if ((qMax(line.x1(), line.x2()) >= exposedRect.left()) &&
+              (qMin(line.x1(), line.x2()) <= exposedRect.right()) &&
+              (qMax(line.y1(), line.y2()) >= exposedRect.top()) &&
+              (qMin(line.y1(), line.y2()) <= exposedRect.bottom())) {
+            lines.append(line);
+          }
+        }
+        for (int k = 0; k < range.circlesCount; ++k) {
+          const QRectF& circle = mCircles.at(range.firstCircle + k);
+          if (exposedRect.intersects(circle)) {
+            painter->drawEllipse(circle);
+          }
+        }
+      }
+      painter->drawLines(lines);
+    }
+  }
+
+#ifdef QT_DEBUG
+  GraphicsLayer* layer =
+      getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+  Q_ASSERT(layer);
+  if (layer && layer->isVisible()) {
+    // draw bounding rects of all net signals
+    painter->setPen(QPen(layer->getColor(false), 0));
+    painter->setBrush(Qt::NoBrush);
+    foreach (const NetRange& range, mNetRanges) {
+      painter->drawRect(range.boundingRect);
+    }
+  }
+#endif
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+GraphicsLayer* BGI_AirWires::getLayer(const QString& name) const noexcept {
+  return mBoard.getLayerStack().getLayer(name);
+}
+
+void BGI_AirWires::disconnectNetSignals() noexcept {
+  foreach (const QMetaObject::Connection& connection,
+           mHighlightChangedConnections) {
+    QObject::disconnect(connection);
+  }
+  mHighlightChangedConnections.clear();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
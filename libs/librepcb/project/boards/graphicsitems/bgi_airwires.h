@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BGI_AIRWIRES_H
+#define LIBREPCB_PROJECT_BGI_AIRWIRES_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "bgi_base.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+
+namespace project {
+
+class Board;
+class NetSignal;
+
+/*******************************************************************************
+ *  Class BGI_AirWires
+ ******************************************************************************/
+
+/**
+ * @brief A single graphics item drawing all airwires of a board
+ *
+ * Instead of one graphics item per airwire (which would put thousands of
+ * items into the scene index of a freshly imported netlist), the airwires of
+ * all net signals (see librepcb::project::Board::getAirWires()) are stored in
+ * one contiguous line buffer. Each net signal owns a range of this buffer, so
+ * the airwires of highlighted net signals can be drawn on top with a
+ * different pen, and ranges outside the exposed area are skipped cheaply.
+ *
+ * The item is not selectable and does not accept mouse events.
+ */
+class BGI_AirWires final : public BGI_Base {
+public:
+  // Constructors / Destructor
+  explicit BGI_AirWires(Board& board) noexcept;
+  ~BGI_AirWires() noexcept;
+
+  // Getters
+  int getLinesCount() const noexcept { return mLines.count(); }
+
+  // General Methods
+  void updateCacheAndRepaint() noexcept;
+
+  // Inherited from QGraphicsItem
+  QRectF       boundingRect() const { return mBoundingRect; }
+  QPainterPath shape() const { return QPainterPath(); }
+  void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                     QWidget* widget);
+
+private:
+  // Types
+  struct NetRange {
+    const NetSignal* netSignal;
+    int              firstLine;
+    int              linesCount;
+    int              firstCircle;
+    int              circlesCount;
+    QRectF           boundingRect;
+  };
+
+  // make some methods inaccessible...
+  BGI_AirWires()                          = delete;
+  BGI_AirWires(const BGI_AirWires& other) = delete;
+  BGI_AirWires& operator=(const BGI_AirWires& rhs) = delete;
+
+  // Private Methods
+  GraphicsLayer* getLayer(const QString& name) const noexcept;
+  void           disconnectNetSignals() noexcept;
+
+  // Attributes
+  Board&                         mBoard;
+  GraphicsLayer*                 mLayer;
+  QList<QMetaObject::Connection> mHighlightChangedConnections;
+
+  // Cached Attributes
+  QVector<QLineF>   mLines;    ///< Lines of all airwires
+  QVector<QRectF>   mCircles;  ///< Circles of vertical airwires
+  QVector<NetRange> mNetRanges;
+  QRectF            mBoundingRect;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECT_BGI_AIRWIRES_H
@@ -25,6 +25,7 @@
 #include "../board.h"
 
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/utils/performancecounters.h>
 
 #include <QtCore>
 
@@ -34,11 +35,20 @@
 namespace librepcb {
 namespace project {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+constexpr qreal BGI_Base::sLodMinItemSize;
+constexpr qreal BGI_Base::sLodMinDetailSize;
+constexpr qreal BGI_Base::sLodMinTextHeight;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 BGI_Base::BGI_Base() noexcept {
+  PerformanceCounters::add(PerformanceCounters::Counter::GraphicsItemsCreated);
 }
 
 BGI_Base::~BGI_Base() noexcept {
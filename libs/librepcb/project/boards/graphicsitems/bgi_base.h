@@ -50,6 +50,11 @@ public:
 protected:
   static qreal getZValueOfCopperLayer(const QString& name) noexcept;
 
+  // Level of detail thresholds in device pixels (not applied for printers)
+  static constexpr qreal sLodMinItemSize   = 2;  ///< Draw smaller as rect
+  static constexpr qreal sLodMinDetailSize = 8;  ///< Draw smaller w/o holes
+  static constexpr qreal sLodMinTextHeight = 4;  ///< Don't draw smaller texts
+
 private:
   // make some methods inaccessible...
   // BGI_Base() = delete;
@@ -49,6 +49,7 @@ BGI_Footprint::BGI_Footprint(BI_Footprint& footprint) noexcept
   : BGI_Base(),
     mFootprint(footprint),
     mLibFootprint(footprint.getLibFootprint()) {
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);  // see BGI_Plane
   updateCacheAndRepaint();
 }
 
@@ -123,13 +124,98 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
 void BGI_Footprint::paint(QPainter*                       painter,
                           const QStyleOptionGraphicsItem* option,
                           QWidget*                        widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
 
   const GraphicsLayer* layer    = 0;
   const bool           selected = mFootprint.isSelected();
   const bool           deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+
+  // draw all polygons and circles (they look the same for all devices with
+  // the same footprint and layer colors, so they are recorded only once and
+  // then replayed with the transformation of this item)
+  if (deviceIsPrinter) {
+    paintPolygonsAndCircles(*painter, selected);
+  } else {
+    QPicture picture = mLibFootprint.getPicture(
+        getPictureKey(selected), [this, selected](QPainter& p) {
+          paintPolygonsAndCircles(p, selected);
+        });
+    painter->drawPicture(0, 0, picture);
+  }
+
+  // draw all holes
+  for (const Hole& hole : mLibFootprint.getHoles()) {
+    // get layer
+    layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
+    if (!layer) continue;
+    if (!layer->isVisible()) continue;
+
+    // set pen/brush
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+
+    // draw hole (if it is not too small to be visible anyway)
+    qreal radius = (hole.getDiameter() / 2).toPx();
+    if ((!deviceIsPrinter) && (lod * radius * 2 < sLodMinItemSize)) continue;
+    painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+  }
+
+  // draw origin cross
+  layer = getLayer(GraphicsLayer::sTopReferences);
+  if (layer) {
+    if ((!deviceIsPrinter) && layer->isVisible()) {
+      qreal width = Length(700000).toPx();
+      painter->setPen(QPen(layer->getColor(selected), 0));
+      painter->drawLine(-width, 0, width, 0);
+      painter->drawLine(0, -width, 0, width);
+    }
+  }
+
+#ifdef QT_DEBUG
+  // draw bounding rect
+  layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+  if (layer) {
+    if (layer->isVisible()) {
+      painter->setPen(QPen(layer->getColor(selected), 0));
+      painter->setBrush(Qt::NoBrush);
+      painter->drawRect(mBoundingRect);
+    }
+  }
+#endif
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QByteArray BGI_Footprint::getPictureKey(bool selected) const noexcept {
+  QByteArray key;
+  auto       addLayer = [this, selected, &key](const QString& name) {
+    const GraphicsLayer* layer = getLayer(name);
+    if (layer) {
+      QRgb color = layer->getColor(selected).rgba();
+      key.append(layer->isVisible() ? 'v' : 'h');
+      key.append(reinterpret_cast<const char*>(&color), sizeof(color));
+    } else {
+      key.append('n');
+    }
+  };
+  addLayer(GraphicsLayer::sTopGrabAreas);
+  for (const Polygon& polygon : mLibFootprint.getPolygons()) {
+    addLayer(*polygon.getLayerName());
+  }
+  for (const Circle& circle : mLibFootprint.getCircles()) {
+    addLayer(*circle.getLayerName());
+  }
+  return key;
+}
+
+void BGI_Footprint::paintPolygonsAndCircles(QPainter& painter,
+                                            bool      selected) const noexcept {
+  const GraphicsLayer* layer = nullptr;
 
   // draw all polygons
   for (const Polygon& polygon : mLibFootprint.getPolygons()) {
@@ -140,11 +226,11 @@ void BGI_Footprint::paint(QPainter*                       painter,
 
     // set pen
     if (polygon.getLineWidth() > 0)
-      painter->setPen(QPen(layer->getColor(selected),
-                           polygon.getLineWidth()->toPx(), Qt::SolidLine,
-                           Qt::RoundCap, Qt::RoundJoin));
+      painter.setPen(QPen(layer->getColor(selected),
+                          polygon.getLineWidth()->toPx(), Qt::SolidLine,
+                          Qt::RoundCap, Qt::RoundJoin));
     else
-      painter->setPen(Qt::NoPen);
+      painter.setPen(Qt::NoPen);
 
     // set brush
     if ((!polygon.isFilled()) || (!polygon.getPath().isClosed())) {
@@ -155,15 +241,15 @@ void BGI_Footprint::paint(QPainter*                       painter,
     }
     if (layer) {
       if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+        painter.setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
       else
-        painter->setBrush(Qt::NoBrush);
+        painter.setBrush(Qt::NoBrush);
     } else {
-      painter->setBrush(Qt::NoBrush);
+      painter.setBrush(Qt::NoBrush);
     }
 
     // draw polygon
-    painter->drawPath(polygon.getPath().toQPainterPathPx());
+    painter.drawPath(polygon.getPath().toQPainterPathPx());
   }
 
   // draw all circles
@@ -175,11 +261,11 @@ void BGI_Footprint::paint(QPainter*                       painter,
 
     // set pen
     if (circle.getLineWidth() > 0)
-      painter->setPen(QPen(layer->getColor(selected),
-                           circle.getLineWidth()->toPx(), Qt::SolidLine,
-                           Qt::RoundCap, Qt::RoundJoin));
+      painter.setPen(QPen(layer->getColor(selected),
+                          circle.getLineWidth()->toPx(), Qt::SolidLine,
+                          Qt::RoundCap, Qt::RoundJoin));
     else
-      painter->setPen(Qt::NoPen);
+      painter.setPen(Qt::NoPen);
 
     // set brush
     if (!circle.isFilled()) {
@@ -190,64 +276,21 @@ void BGI_Footprint::paint(QPainter*                       painter,
     }
     if (layer) {
       if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+        painter.setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
       else
-        painter->setBrush(Qt::NoBrush);
+        painter.setBrush(Qt::NoBrush);
     } else {
-      painter->setBrush(Qt::NoBrush);
+      painter.setBrush(Qt::NoBrush);
     }
 
     // draw circle
-    painter->drawEllipse(circle.getCenter().toPxQPointF(),
-                         circle.getDiameter()->toPx() / 2,
-                         circle.getDiameter()->toPx() / 2);
+    painter.drawEllipse(circle.getCenter().toPxQPointF(),
+                        circle.getDiameter()->toPx() / 2,
+                        circle.getDiameter()->toPx() / 2);
     // TODO: rotation
   }
-
-  // draw all holes
-  for (const Hole& hole : mLibFootprint.getHoles()) {
-    // get layer
-    layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen/brush
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-
-    // draw hole
-    qreal radius = (hole.getDiameter() / 2).toPx();
-    painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
-  }
-
-  // draw origin cross
-  layer = getLayer(GraphicsLayer::sTopReferences);
-  if (layer) {
-    if ((!deviceIsPrinter) && layer->isVisible()) {
-      qreal width = Length(700000).toPx();
-      painter->setPen(QPen(layer->getColor(selected), 0));
-      painter->drawLine(-width, 0, width, 0);
-      painter->drawLine(0, -width, 0, width);
-    }
-  }
-
-#ifdef QT_DEBUG
-  // draw bounding rect
-  layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
-  if (layer) {
-    if (layer->isVisible()) {
-      painter->setPen(QPen(layer->getColor(selected), 0));
-      painter->setBrush(Qt::NoBrush);
-      painter->drawRect(mBoundingRect);
-    }
-  }
-#endif
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept {
   if (mFootprint.getIsMirrored())
     name = GraphicsLayer::getMirroredLayerName(name);
@@ -76,6 +76,9 @@ private:
   BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
   // Private Methods
+  QByteArray     getPictureKey(bool selected) const noexcept;
+  void           paintPolygonsAndCircles(QPainter& painter, bool selected) const
+      noexcept;
   GraphicsLayer* getLayer(QString name) const noexcept;
 
   // General Attributes
@@ -121,10 +121,10 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
       -mPad.getBoard().getDesignRules().calcCreamMaskClearance(*size);
 
   // set shapes and bounding rect
-  mShape        = mLibPad.getOutline().toQPainterPathPx();
+  mShape        = mLibPad.toOutlineQPainterPathPx();
   mCopper       = mLibPad.toQPainterPathPx();
-  mStopMask     = mLibPad.getOutline(stopMaskClearance).toQPainterPathPx();
-  mCreamMask    = mLibPad.getOutline(creamMaskClearance).toQPainterPathPx();
+  mStopMask     = mLibPad.toOutlineQPainterPathPx(stopMaskClearance);
+  mCreamMask    = mLibPad.toOutlineQPainterPathPx(creamMaskClearance);
   mBoundingRect = mStopMask.boundingRect();
 
   update();
@@ -137,16 +137,29 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 void BGI_FootprintPad::paint(QPainter*                       painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget*                        widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
-  // const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) !=
-  // 0); const qreal lod =
-  // option->levelOfDetailFromTransform(painter->worldTransform());
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  const QRectF shapeRect = mShape.boundingRect();
 
   const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
   bool             highlight =
       mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+  if ((!deviceIsPrinter) &&
+      (lod * qMax(shapeRect.width(), shapeRect.height()) < sLodMinItemSize)) {
+    // too small to see any details, so just draw a rect in the pad color
+    if (mPadLayer && mPadLayer->isVisible()) {
+      painter->fillRect(shapeRect, mPadLayer->getColor(highlight));
+    }
+    return;
+  }
+  const bool drawDetails =
+      deviceIsPrinter ||
+      (lod * qMin(shapeRect.width(), shapeRect.height()) >= sLodMinDetailSize);
+
   if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
     // draw bottom cream mask
     painter->setPen(Qt::NoPen);
@@ -165,12 +178,13 @@ void BGI_FootprintPad::paint(QPainter*                       painter,
     // draw pad
     painter->setPen(Qt::NoPen);
     painter->setBrush(mPadLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    painter->drawPath(drawDetails ? mCopper : mShape);  // w/o hole if small
     // draw pad text
-    painter->setFont(mFont);
-    painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      mPad.getDisplayText());
+    if (deviceIsPrinter || (lod * mFont.pixelSize() >= sLodMinTextHeight)) {
+      painter->setFont(mFont);
+      painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+      painter->drawText(shapeRect, Qt::AlignCenter, mPad.getDisplayText());
+    }
   }
 
   if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
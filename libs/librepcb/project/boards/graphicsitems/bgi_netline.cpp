@@ -44,7 +44,12 @@ namespace project {
  ******************************************************************************/
 
 BGI_NetLine::BGI_NetLine(BI_NetLine& netline) noexcept
-  : BGI_Base(), mNetLine(netline), mLayer(nullptr) {
+  : BGI_Base(),
+    mNetLine(netline),
+    mLayer(nullptr),
+    mStartOffset(0, 0),
+    mEndOffset(0, 0),
+    mGrabWidthPx(0) {
   updateCacheAndRepaint();
 }
 
@@ -74,40 +79,83 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept {
   mLayer = &mNetLine.getLayer();
   Q_ASSERT(mLayer);
 
-  mLineF.setP1(mNetLine.getStartPoint().getPosition().toPxQPointF());
-  mLineF.setP2(mNetLine.getEndPoint().getPosition().toPxQPointF());
+  Point p1 = mNetLine.getStartPoint().getPosition() + mStartOffset;
+  Point p2 = mNetLine.getEndPoint().getPosition() + mEndOffset;
+  mLineF.setP1(p1.toPxQPointF());
+  mLineF.setP2(p2.toPxQPointF());
+  // the grab area may be wider than the line, but must be within the bounding
+  // rect to be found by the index of the graphics scene
+  mGrabWidthPx = qMax(mNetLine.getWidth(), PositiveLength(100000))->toPx();
   mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
-  mBoundingRect.adjust(
-      -mNetLine.getWidth()->toPx() / 2, -mNetLine.getWidth()->toPx() / 2,
-      mNetLine.getWidth()->toPx() / 2, mNetLine.getWidth()->toPx() / 2);
+  mBoundingRect.adjust(-mGrabWidthPx / 2, -mGrabWidthPx / 2, mGrabWidthPx / 2,
+                       mGrabWidthPx / 2);
+  // Stroking the shape is expensive, so it is only built when needed (e.g.
+  // for the rubber band selection), not on every move of the line.
   mShape = QPainterPath();
-  mShape.moveTo(mNetLine.getStartPoint().getPosition().toPxQPointF());
-  mShape.lineTo(mNetLine.getEndPoint().getPosition().toPxQPointF());
-  QPainterPathStroker ps;
-  ps.setCapStyle(Qt::RoundCap);
-  PositiveLength width = qMax(mNetLine.getWidth(), PositiveLength(100000));
-  ps.setWidth(width->toPx());
-  mShape = ps.createStroke(mShape);
   update();
 }
 
+void BGI_NetLine::setAnchorOffsets(const Point& startOffset,
+                                   const Point& endOffset) noexcept {
+  if ((startOffset != mStartOffset) || (endOffset != mEndOffset)) {
+    mStartOffset = startOffset;
+    mEndOffset   = endOffset;
+    updateCacheAndRepaint();
+  }
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsItem
  ******************************************************************************/
 
+QPainterPath BGI_NetLine::shape() const noexcept {
+  if (mShape.isEmpty()) {
+    QPainterPath path;
+    path.moveTo(mLineF.p1());
+    path.lineTo(mLineF.p2());
+    QPainterPathStroker ps;
+    ps.setCapStyle(Qt::RoundCap);
+    ps.setWidth(mGrabWidthPx);
+    mShape = ps.createStroke(path);
+  }
+  return mShape;
+}
+
+bool BGI_NetLine::contains(const QPointF& point) const noexcept {
+  // The shape is a line with round caps, so it's much faster to check the
+  // distance to the line than to test the point against the stroked path.
+  QPointF delta     = mLineF.p2() - mLineF.p1();
+  qreal   lengthSqr = QPointF::dotProduct(delta, delta);
+  qreal   t         = 0;
+  if (lengthSqr > 0) {
+    t = QPointF::dotProduct(point - mLineF.p1(), delta) / lengthSqr;
+    t = qBound(qreal(0), t, qreal(1));
+  }
+  QPointF diff = point - (mLineF.p1() + delta * t);
+  return QPointF::dotProduct(diff, diff) <= (mGrabWidthPx * mGrabWidthPx / 4);
+}
+
 void BGI_NetLine::paint(QPainter*                       painter,
                         const QStyleOptionGraphicsItem* option,
                         QWidget*                        widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
 
   bool highlight = mNetLine.isSelected() ||
                    mNetLine.getNetSignalOfNetSegment().isHighlighted();
 
   // draw line
   if (mLayer->isVisible()) {
-    QPen pen(mLayer->getColor(highlight), mNetLine.getWidth()->toPx(),
-             Qt::SolidLine, Qt::RoundCap);
+    // Note: If the line is thinner than a few pixels, a cosmetic pen looks
+    // the same but is much faster to draw than a wide pen with round caps.
+    qreal width = mNetLine.getWidth()->toPx();
+    if ((!deviceIsPrinter) && (lod * width < sLodMinItemSize)) {
+      width = 0;
+    }
+    QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
     painter->setPen(pen);
     painter->drawLine(mLineF);
   }
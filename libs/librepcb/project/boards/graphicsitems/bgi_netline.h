@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/utils/objectpool.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -58,12 +60,33 @@ public:
   // General Methods
   void updateCacheAndRepaint() noexcept;
 
+  /**
+   * @brief Draw the line with displaced anchors, without modifying the line
+   *
+   * Used to preview moving some items, e.g. while dragging a selection, until
+   * the new positions are applied to the board items.
+   *
+   * @param startOffset   Offset to add to the start point position
+   * @param endOffset     Offset to add to the end point position
+   */
+  void setAnchorOffsets(const Point& startOffset,
+                        const Point& endOffset) noexcept;
+
   // Inherited from QGraphicsItem
   QRectF       boundingRect() const { return mBoundingRect; }
-  QPainterPath shape() const { return mShape; }
+  QPainterPath shape() const noexcept override;
+  bool         contains(const QPointF& point) const noexcept override;
   void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                      QWidget* widget);
 
+  // Operator Overloadings
+  static void* operator new(std::size_t size) {
+    return ObjectPool<BGI_NetLine>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<BGI_NetLine>::deallocate(p, size);
+  }
+
 private:
   // make some methods inaccessible...
   BGI_NetLine()                         = delete;
@@ -77,10 +100,14 @@ private:
   BI_NetLine&    mNetLine;
   GraphicsLayer* mLayer;
 
+  Point          mStartOffset;
+  Point          mEndOffset;
+
   // Cached Attributes
-  QLineF       mLineF;
-  QRectF       mBoundingRect;
-  QPainterPath mShape;
+  QLineF               mLineF;
+  qreal                mGrabWidthPx;
+  QRectF               mBoundingRect;
+  mutable QPainterPath mShape;  ///< Built on demand, see #shape()
 };
 
 /*******************************************************************************
@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/utils/objectpool.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -63,6 +65,14 @@ public:
   void   paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                QWidget* widget);
 
+  // Operator Overloadings
+  static void* operator new(std::size_t size) {
+    return ObjectPool<BGI_NetPoint>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<BGI_NetPoint>::deallocate(p, size);
+  }
+
 private:
   // make some methods inaccessible...
   BGI_NetPoint()                          = delete;
@@ -34,18 +34,26 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <cmath>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
 namespace project {
 
+constexpr int BGI_Plane::sFullDetailLodBucket;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept
   : BGI_Base(), mPlane(plane), mLayer(nullptr) {
+  // Painting the plane fragments is expensive, but they rarely change. So the
+  // rendered item is cached and just blitted while panning or while other
+  // items are modified on top of it.
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);
   updateCacheAndRepaint();
 }
 
@@ -81,8 +89,9 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
   // get areas
   mAreas.clear();
   for (const Path& r : mPlane.getFragments()) {
-    mAreas.append(r.toQPainterPathPx());
-    mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
+    QPainterPath path = r.toQPainterPathPx();
+    mAreas.append(Area{path, path.boundingRect(), QHash<int, QPainterPath>()});
+    mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect);
   }
 
   update();
@@ -97,11 +106,12 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
   Q_UNUSED(widget);
 
   const bool selected = mPlane.isSelected();
-  // const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) !=
-  // 0);
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != 0);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
-  Q_UNUSED(option);
+  const int lodBucket = deviceIsPrinter ? sFullDetailLodBucket
+                                        : getLodBucket(lod);
 
   if (mLayer && mLayer->isVisible()) {
     // draw outline
@@ -113,7 +123,21 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     // draw plane
     painter->setPen(Qt::NoPen);
     painter->setBrush(mLayer->getColor(selected));
-    foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+    for (Area& area : mAreas) {
+      if (lodBucket >= sFullDetailLodBucket) {
+        painter->drawPath(area.path);
+      } else if ((lod * area.boundingRect.width() >= sLodMinItemSize) ||
+                 (lod * area.boundingRect.height() >= sLodMinItemSize)) {
+        auto it = area.simplifiedPaths.find(lodBucket);
+        if (it == area.simplifiedPaths.end()) {
+          // tolerance of half a device pixel at the lowest zoom of the bucket
+          qreal tolerance = std::ldexp(qreal(0.5), -lodBucket);
+          it              = area.simplifiedPaths.insert(
+              lodBucket, simplifyPath(area.path, tolerance));
+        }
+        painter->drawPath(*it);
+      }
+    }
   }
 
 #ifdef QT_DEBUG
@@ -139,6 +163,35 @@ GraphicsLayer* BGI_Plane::getLayer(QString name) const noexcept {
   return mPlane.getBoard().getLayerStack().getLayer(name);
 }
 
+int BGI_Plane::getLodBucket(qreal lod) noexcept {
+  if (lod <= 0) return 0;  // should never happen
+  return qMax(-16, static_cast<int>(std::floor(std::log2(lod))));
+}
+
+QPainterPath BGI_Plane::simplifyPath(const QPainterPath& path,
+                                     qreal tolerance) noexcept {
+  QPainterPath simplified;
+  simplified.setFillRule(path.fillRule());
+  foreach (const QPolygonF& polygon, path.toSubpathPolygons()) {
+    // skip vertices closer than the tolerance to the last kept vertex
+    QPolygonF reduced;
+    reduced.reserve(polygon.count());
+    foreach (const QPointF& point, polygon) {
+      if (reduced.isEmpty() ||
+          (qAbs(point.x() - reduced.last().x()) >= tolerance) ||
+          (qAbs(point.y() - reduced.last().y()) >= tolerance)) {
+        reduced.append(point);
+      }
+    }
+    // polygons smaller than the tolerance are not visible anyway
+    if (reduced.count() > 2) {
+      simplified.addPolygon(reduced);
+      simplified.closeSubpath();
+    }
+  }
+  return simplified;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -47,6 +47,12 @@ class BI_Plane;
 
 /**
  * @brief The BGI_Plane class
+ *
+ * Big planes consist of many thousands of vertices (e.g. due to thermal relief
+ * cut-ins), which makes filling them expensive. So when zoomed out, simplified
+ * versions of the fragments (without vertices closer to each other than half a
+ * device pixel) are drawn instead. They are created lazily for each zoom level bucket
+ * (power of two) and kept until the fragments are rebuilt.
  */
 class BGI_Plane final : public BGI_Base {
 public:
@@ -72,8 +78,21 @@ private:
   BGI_Plane(const BGI_Plane& other) = delete;
   BGI_Plane& operator=(const BGI_Plane& rhs) = delete;
 
+  // Types
+  struct Area {
+    QPainterPath             path;  ///< Full detail
+    QRectF                   boundingRect;
+    QHash<int, QPainterPath> simplifiedPaths;  ///< Key: Zoom level bucket
+  };
+
   // Private Methods
-  GraphicsLayer* getLayer(QString name) const noexcept;
+  GraphicsLayer*      getLayer(QString name) const noexcept;
+  static int          getLodBucket(qreal lod) noexcept;
+  static QPainterPath simplifyPath(const QPainterPath& path,
+                                   qreal               tolerance) noexcept;
+
+  /// Zoom level buckets from which on the full detail paths are drawn
+  static constexpr int sFullDetailLodBucket = 4;
 
   // General Attributes
   BI_Plane& mPlane;
@@ -83,7 +102,7 @@ private:
   QRectF                mBoundingRect;
   QPainterPath          mShape;
   QPainterPath          mOutline;
-  QVector<QPainterPath> mAreas;
+  QVector<Area>         mAreas;
 };
 
 /*******************************************************************************
@@ -104,12 +104,25 @@ void BGI_Via::updateCacheAndRepaint() noexcept {
 
 void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                     QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  const qreal sizePx = lod * mVia.getSize()->toPx();
 
   NetSignal& netsignal = mVia.getNetSignalOfNetSegment();
   bool       highlight = mVia.isSelected() || (netsignal.isHighlighted());
 
+  if ((!deviceIsPrinter) && (sizePx < sLodMinItemSize)) {
+    // too small to see any details, so just draw a rect in the via color
+    if (mViaLayer && mViaLayer->isVisible()) {
+      painter->fillRect(mShape.boundingRect(), mViaLayer->getColor(highlight));
+    }
+    return;
+  }
+  const bool drawDetails = deviceIsPrinter || (sizePx >= sLodMinDetailSize);
+
   if (mDrawStopMask && mBottomStopMaskLayer &&
       mBottomStopMaskLayer->isVisible()) {
     // draw bottom stop mask
@@ -122,13 +135,15 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     // draw via
     painter->setPen(Qt::NoPen);
     painter->setBrush(mViaLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    painter->drawPath(drawDetails ? mCopper : mShape);  // w/o hole if small
 
     // draw netsignal name
-    painter->setFont(mFont);
-    painter->setPen(mViaLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      *netsignal.getName());
+    if (deviceIsPrinter || (lod * mFont.pixelSize() >= sLodMinTextHeight)) {
+      painter->setFont(mFont);
+      painter->setPen(mViaLayer->getColor(highlight).lighter(150));
+      painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
+                        *netsignal.getName());
+    }
   }
 
   if (mDrawStopMask && mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
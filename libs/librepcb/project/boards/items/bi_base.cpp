@@ -36,12 +36,23 @@
 namespace librepcb {
 namespace project {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+static QAtomicInt sCreatedItemsCount(0);
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 BI_Base::BI_Base(Board& board) noexcept
-  : QObject(&board), mBoard(board), mIsAddedToBoard(false), mIsSelected(false) {
+  : QObject(&board),
+    mBoard(board),
+    mGraphicsItemInScene(nullptr),
+    mIsAddedToBoard(false),
+    mIsSelected(false) {
+  sCreatedItemsCount.fetchAndAddRelaxed(1);
 }
 
 BI_Base::~BI_Base() noexcept {
@@ -66,6 +77,14 @@ Circuit& BI_Base::getCircuit() const noexcept {
 
 void BI_Base::setSelected(bool selected) noexcept {
   mIsSelected = selected;
+  if (mIsAddedToBoard) {
+    mBoard.setItemSelected(*this, selected);
+    if (mGraphicsItemInScene) {
+      // selected items are moved interactively, so keep them in the scene
+      mBoard.getGraphicsScene().setCulledItemPinned(*mGraphicsItemInScene,
+                                                    selected);
+    }
+  }
 }
 
 /*******************************************************************************
@@ -74,18 +93,61 @@ void BI_Base::setSelected(bool selected) noexcept {
 
 void BI_Base::addToBoard(QGraphicsItem* item) noexcept {
   Q_ASSERT(!mIsAddedToBoard);
-  if (item) {
+  if (item && isGraphicsItemCulled()) {
+    mBoard.getGraphicsScene().addCulledItem(*item);
+    if (mIsSelected) {
+      mBoard.getGraphicsScene().setCulledItemPinned(*item, true);
+    }
+  } else if (item) {
     mBoard.getGraphicsScene().addItem(*item);
   }
-  mIsAddedToBoard = true;
+  if (item) {
+    mBoard.registerGraphicsItem(*item, *this);
+  }
+  if (mIsSelected) {
+    mBoard.setItemSelected(*this, true);
+  }
+  mGraphicsItemInScene = item;
+  mIsAddedToBoard      = true;
 }
 
 void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept {
   Q_ASSERT(mIsAddedToBoard);
   if (item) {
+    mBoard.unregisterGraphicsItem(*item);
+  }
+  if (item && isGraphicsItemCulled()) {
+    mBoard.getGraphicsScene().removeCulledItem(*item);
+  } else if (item) {
     mBoard.getGraphicsScene().removeItem(*item);
   }
-  mIsAddedToBoard = false;
+  mBoard.setItemSelected(*this, false);
+  mGraphicsItemInScene = nullptr;
+  mIsAddedToBoard      = false;
+}
+
+void BI_Base::updateGraphicsItemBounds() noexcept {
+  if (mIsAddedToBoard && mGraphicsItemInScene) {
+    mBoard.getGraphicsScene().updateCulledItem(*mGraphicsItemInScene);
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool BI_Base::isGraphicsItemCulled() const noexcept {
+  // Planes are few, but large, and their fragments are rebuilt in the
+  // background. So they are always added to the scene.
+  return getType() != Type_t::Plane;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+int BI_Base::getCreatedItemsCount() noexcept {
+  return sCreatedItemsCount.load();
 }
 
 /*******************************************************************************
@@ -66,7 +66,6 @@ public:
     StrokeText,    ///< librepcb#project#BI_StrokeText
     Hole,          ///< librepcb#project#BI_Hole
     Plane,         ///< librepcb#project#BI_Plane
-    AirWire,       ///< librepcb#project#BI_AirWire
   };
 
   // Constructors / Destructor
@@ -87,6 +86,20 @@ public:
   virtual bool isSelectable() const noexcept = 0;
   virtual bool isSelected() const noexcept { return mIsSelected; }
 
+  /**
+   * @brief Check if a scene position is within the grab area of the item
+   *
+   * Same as `getGrabAreaScenePx().contains(pos)`, but items may provide a
+   * faster implementation.
+   *
+   * @param pos   The position to check (scene coordinates in pixels)
+   *
+   * @return Whether the position is within the grab area or not
+   */
+  virtual bool isInGrabAreaScenePx(const QPointF& pos) const noexcept {
+    return getGrabAreaScenePx().contains(pos);
+  }
+
   // Setters
   virtual void setSelected(bool selected) noexcept;
 
@@ -94,6 +107,15 @@ public:
   virtual void addToBoard()      = 0;
   virtual void removeFromBoard() = 0;
 
+  // Static Methods
+
+  /**
+   * @brief Get the total number of items created so far (e.g. for profiling)
+   *
+   * @return Number of created items, including already destroyed ones
+   */
+  static int getCreatedItemsCount() noexcept;
+
   // Operator Overloadings
   BI_Base& operator=(const BI_Base& rhs) = delete;
 
@@ -102,13 +124,26 @@ protected:
   void addToBoard(QGraphicsItem* item) noexcept;
   void removeFromBoard(QGraphicsItem* item) noexcept;
 
+  /**
+   * @brief Notify the graphics scene about a moved or resized graphics item
+   *
+   * Needs to be called after modifying the geometry of the graphics item,
+   * since the scene only tracks selected items and items located around the
+   * viewport (see librepcb::GraphicsScene).
+   */
+  void updateGraphicsItemBounds() noexcept;
+
 protected:
   Board& mBoard;
 
 private:
+  // Private Methods
+  bool isGraphicsItemCulled() const noexcept;
+
   // General Attributes
-  bool mIsAddedToBoard;
-  bool mIsSelected;
+  QGraphicsItem* mGraphicsItemInScene;  ///< Passed to #addToBoard()
+  bool           mIsAddedToBoard;
+  bool           mIsSelected;
 };
 
 /*******************************************************************************
@@ -59,8 +59,8 @@ BI_Footprint::BI_Footprint(BI_Device& device, const BI_Footprint& other)
 
 BI_Footprint::BI_Footprint(BI_Device& device, const SExpression& node)
   : BI_Base(device.getBoard()), mDevice(device) {
-  foreach (const SExpression& node, node.getChildren("stroke_text")) {
-    addStrokeText(*new BI_StrokeText(mBoard, node));  // can throw
+  foreach (const SExpression* node, node.getChildren("stroke_text")) {
+    addStrokeText(*new BI_StrokeText(mBoard, *node));  // can throw
   }
   init();
 }
@@ -73,8 +73,10 @@ BI_Footprint::BI_Footprint(BI_Device& device)
 
 void BI_Footprint::init() {
   // create graphics item
-  mGraphicsItem.reset(new BGI_Footprint(*this));
-  mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new BGI_Footprint(*this));
+    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+  }
   updateGraphicsItemTransform();
 
   // load pads
@@ -257,16 +259,17 @@ bool BI_Footprint::getIsMirrored() const noexcept {
 }
 
 QPainterPath BI_Footprint::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Footprint::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+  return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Footprint::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
   foreach (BI_FootprintPad* pad, mPads)
     pad->setSelected(selected);
   foreach (BI_StrokeText* text, mStrokeTexts)
@@ -278,13 +281,15 @@ void BI_Footprint::setSelected(bool selected) noexcept {
  ******************************************************************************/
 
 void BI_Footprint::deviceInstanceAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos) {
-  mGraphicsItem->setPos(pos.toPxQPointF());
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->setPos(pos.toPxQPointF());
+    mGraphicsItem->updateCacheAndRepaint();
+  }
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -295,7 +300,7 @@ void BI_Footprint::deviceInstanceMoved(const Point& pos) {
 void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
   Q_UNUSED(rot);
   updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -305,7 +310,7 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
 void BI_Footprint::deviceInstanceMirrored(bool mirrored) {
   Q_UNUSED(mirrored);
   updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -320,7 +325,7 @@ void BI_Footprint::updateGraphicsItemTransform() noexcept {
   QTransform t;
   if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
   t.rotate(-mDevice.getRotation().toDeg());
-  mGraphicsItem->setTransform(t);
+  if (mGraphicsItem) mGraphicsItem->setTransform(t);
 }
 
 /*******************************************************************************
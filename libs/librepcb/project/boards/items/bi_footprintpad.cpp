@@ -72,7 +72,9 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid)
             &BI_FootprintPad::componentSignalInstanceNetSignalChanged);
   }
 
-  mGraphicsItem.reset(new BGI_FootprintPad(*this));
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+  }
   updatePosition();
 
   // connect to the "attributes changed" signal of the footprint
@@ -179,9 +181,10 @@ void BI_FootprintPad::unregisterNetLine(BI_NetLine& netline) {
 void BI_FootprintPad::updatePosition() noexcept {
   mPosition = mFootprint.mapToScene(mFootprintPad->getPosition());
   mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
+  mClipperPathCache.invalidate();
+  if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
   updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_NetLine* netline, mRegisteredNetLines) { netline->updateLine(); }
 }
 
@@ -194,16 +197,17 @@ bool BI_FootprintPad::getIsMirrored() const noexcept {
 }
 
 QPainterPath BI_FootprintPad::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_FootprintPad::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+  return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_FootprintPad::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
 }
 
 Path BI_FootprintPad::getOutline(const Length& expansion) const noexcept {
@@ -211,7 +215,15 @@ Path BI_FootprintPad::getOutline(const Length& expansion) const noexcept {
 }
 
 Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept {
-  return getOutline(expansion).rotated(mRotation).translated(mPosition);
+  return getOutline(expansion).transform(mRotation, mPosition);
+}
+
+ClipperLib::Path BI_FootprintPad::getClipperSceneOutline(
+    const Length& expansion, const PositiveLength& maxArcTolerance) const
+    noexcept {
+  return mClipperPathCache.get(
+      expansion, maxArcTolerance,
+      [this](const Length& e) { return getSceneOutline(e); });
 }
 
 /*******************************************************************************
@@ -219,7 +231,7 @@ Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept {
  ******************************************************************************/
 
 void BI_FootprintPad::footprintAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from,
@@ -230,8 +242,9 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from,
   }
   if (to) {
     mHighlightChangedConnection =
-        connect(to, &NetSignal::highlightedChanged,
-                [this]() { mGraphicsItem->update(); });
+        connect(to, &NetSignal::highlightedChanged, [this]() {
+          if (mGraphicsItem) mGraphicsItem->update();
+        });
   }
   mBoard.scheduleAirWiresRebuild(from);
   mBoard.scheduleAirWiresRebuild(to);
@@ -245,7 +258,7 @@ void BI_FootprintPad::updateGraphicsItemTransform() noexcept {
   QTransform t;
   if (mFootprint.getIsMirrored()) t.scale(qreal(-1), qreal(1));
   t.rotate(-mRotation.toDeg());
-  mGraphicsItem->setTransform(t);
+  if (mGraphicsItem) mGraphicsItem->setTransform(t);
 }
 
 /*******************************************************************************
@@ -28,6 +28,7 @@
 #include "bi_base.h"
 
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/utils/clipperpathcache.h>
 
 #include <QtCore>
 
@@ -38,6 +39,7 @@ namespace librepcb {
 
 namespace library {
 class FootprintPad;
+class PackagePad;
 class ComponentSignal;
 }  // namespace library
 
@@ -73,6 +75,9 @@ public:
   const library::FootprintPad& getLibPad() const noexcept {
     return *mFootprintPad;
   }
+  const library::PackagePad& getLibPackagePad() const noexcept {
+    return *mPackagePad;
+  }
   ComponentSignalInstance* getComponentSignalInstance() const noexcept {
     return mComponentSignalInstance;
   }
@@ -81,6 +86,9 @@ public:
   bool isSelectable() const noexcept override;
   Path getOutline(const Length& expansion = Length(0)) const noexcept;
   Path getSceneOutline(const Length& expansion = Length(0)) const noexcept;
+  ClipperLib::Path getClipperSceneOutline(
+      const Length& expansion, const PositiveLength& maxArcTolerance) const
+      noexcept;
 
   // General Methods
   void addToBoard() override;
@@ -125,6 +133,7 @@ private:
   Point                            mPosition;
   Angle                            mRotation;
   QScopedPointer<BGI_FootprintPad> mGraphicsItem;
+  mutable ClipperPathCache         mClipperPathCache;
 
   // Registered Elements
   QSet<BI_NetLine*> mRegisteredNetLines;
@@ -41,23 +41,30 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Hole::BI_Hole(Board& board, const BI_Hole& other) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const BI_Hole& other)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(Uuid::createRandom(), *other.mHole));
   init();
 }
 
-BI_Hole::BI_Hole(Board& board, const SExpression& node) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const SExpression& node)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(node));
   init();
 }
 
-BI_Hole::BI_Hole(Board& board, const Hole& hole) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const Hole& hole)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(hole));
   init();
 }
 
 void BI_Hole::init() {
-  mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
+  mHole->onEdited.attach(mOnHoleEditedSlot);
+
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
+  }
 }
 
 BI_Hole::~BI_Hole() noexcept {
@@ -96,6 +103,7 @@ const Point& BI_Hole::getPosition() const noexcept {
 }
 
 QPainterPath BI_Hole::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -111,7 +119,19 @@ bool BI_Hole::isSelectable() const noexcept {
 
 void BI_Hole::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->setSelected(selected);
+  if (mGraphicsItem) mGraphicsItem->setSelected(selected);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Hole::holeEdited(const Hole& hole, Hole::Event event) noexcept {
+  Q_UNUSED(hole);
+  Q_UNUSED(event);
+  // The hole may be edited by generic undo commands which don't know the
+  // board, so the board must be marked as modified here.
+  mBoard.setModified();
 }
 
 /*******************************************************************************
@@ -88,6 +88,7 @@ BI_NetLine::BI_NetLine(BI_NetSegment& segment, const BI_NetLine& other,
   : BI_Base(segment.getBoard()),
     mNetSegment(segment),
     mPosition(other.mPosition),
+    mLength(other.mLength),
     mUuid(Uuid::createRandom()),
     mStartPoint(&startPoint),
     mEndPoint(&endPoint),
@@ -107,6 +108,7 @@ BI_NetLine::BI_NetLine(BI_NetSegment& segment, const SExpression& node)
   : BI_Base(segment.getBoard()),
     mNetSegment(segment),
     mPosition(),
+    mLength(0),
     mUuid(node.getChildByIndex(0).getValue<Uuid>()),
     mStartPoint(nullptr),
     mEndPoint(nullptr),
@@ -135,6 +137,7 @@ BI_NetLine::BI_NetLine(BI_NetSegment& segment, BI_NetLineAnchor& startPoint,
   : BI_Base(segment.getBoard()),
     mNetSegment(segment),
     mPosition(),
+    mLength(0),
     mUuid(Uuid::createRandom()),
     mStartPoint(&startPoint),
     mEndPoint(&endPoint),
@@ -159,7 +162,9 @@ void BI_NetLine::init() {
                      tr("BI_NetLine: both endpoints are the same."));
   }
 
-  mGraphicsItem.reset(new BGI_NetLine(*this));
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new BGI_NetLine(*this));
+  }
   updateLine();
 }
 
@@ -196,6 +201,14 @@ Path BI_NetLine::getSceneOutline(const Length& expansion) const noexcept {
   }
 }
 
+ClipperLib::Path BI_NetLine::getClipperSceneOutline(
+    const Length& expansion, const PositiveLength& maxArcTolerance) const
+    noexcept {
+  return mClipperPathCache.get(
+      expansion, maxArcTolerance,
+      [this](const Length& e) { return getSceneOutline(e); });
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -207,14 +220,15 @@ void BI_NetLine::setLayer(GraphicsLayer& layer) {
   }
   if (&layer != mLayer) {
     mLayer = &layer;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_NetLine::setWidth(const PositiveLength& width) noexcept {
   if (width != mWidth) {
     mWidth = width;
-    mGraphicsItem->updateCacheAndRepaint();
+    mClipperPathCache.invalidate();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
@@ -233,8 +247,11 @@ void BI_NetLine::addToBoard() {
 
   mHighlightChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
+              [this]() {
+                if (mGraphicsItem) mGraphicsItem->update();
+              });
   BI_Base::addToBoard(mGraphicsItem.data());
+  getNetSignalOfNetSegment().updateBoardRoutingStatistics(mBoard, mLength, 0);
   sg.dismiss();
 }
 
@@ -249,12 +266,22 @@ void BI_NetLine::removeFromBoard() {
 
   disconnect(mHighlightChangedConnection);
   BI_Base::removeFromBoard(mGraphicsItem.data());
+  getNetSignalOfNetSegment().updateBoardRoutingStatistics(mBoard, -mLength, 0);
   sg.dismiss();
 }
 
 void BI_NetLine::updateLine() noexcept {
   mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-  mGraphicsItem->updateCacheAndRepaint();
+  Length length =
+      (mEndPoint->getPosition() - mStartPoint->getPosition()).getLength();
+  if (isAddedToBoard()) {
+    getNetSignalOfNetSegment().updateBoardRoutingStatistics(
+        mBoard, length - mLength, 0);
+  }
+  mLength = length;
+  mClipperPathCache.invalidate();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+  updateGraphicsItemBounds();  // e.g. when dragging a connected footprint
 }
 
 void BI_NetLine::serialize(SExpression& root) const {
@@ -304,16 +331,21 @@ void BI_NetLine::serializeAnchor(SExpression&      root,
  ******************************************************************************/
 
 QPainterPath BI_NetLine::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->shape();
 }
 
+bool BI_NetLine::isInGrabAreaScenePx(const QPointF& pos) const noexcept {
+  return mGraphicsItem && mGraphicsItem->contains(pos);
+}
+
 bool BI_NetLine::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+  return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_NetLine::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*******************************************************************************
@@ -28,6 +28,8 @@
 
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/utils/clipperpathcache.h>
+#include <librepcb/common/utils/objectpool.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -98,6 +100,9 @@ public:
   NetSignal& getNetSignalOfNetSegment() const noexcept;
   bool       isSelectable() const noexcept override;
   Path getSceneOutline(const Length& expansion = Length(0)) const noexcept;
+  ClipperLib::Path getClipperSceneOutline(
+      const Length& expansion, const PositiveLength& maxArcTolerance) const
+      noexcept;
 
   // Setters
   void setLayer(GraphicsLayer& layer);
@@ -116,10 +121,17 @@ public:
   const Point& getPosition() const noexcept override { return mPosition; }
   bool         getIsMirrored() const noexcept override { return false; }
   QPainterPath getGrabAreaScenePx() const noexcept override;
+  bool         isInGrabAreaScenePx(const QPointF& pos) const noexcept override;
   void         setSelected(bool selected) noexcept override;
 
   // Operator Overloadings
   BI_NetLine& operator=(const BI_NetLine& rhs) = delete;
+  static void* operator new(std::size_t size) {
+    return ObjectPool<BI_NetLine>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<BI_NetLine>::deallocate(p, size);
+  }
 
 private:
   void              init();
@@ -131,6 +143,7 @@ private:
   BI_NetSegment&              mNetSegment;
   QScopedPointer<BGI_NetLine> mGraphicsItem;
   Point                   mPosition;  ///< the center of startpoint and endpoint
+  Length                  mLength;    ///< the length of the line
   QMetaObject::Connection mHighlightChangedConnection;
 
   // Attributes
@@ -139,6 +152,9 @@ private:
   BI_NetLineAnchor* mEndPoint;
   GraphicsLayer*    mLayer;
   PositiveLength    mWidth;
+
+  // Cached Attributes
+  mutable ClipperPathCache mClipperPathCache;
 };
 
 /*******************************************************************************
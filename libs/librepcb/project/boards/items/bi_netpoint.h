@@ -29,6 +29,7 @@
 #include "bi_base.h"
 
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/utils/objectpool.h>
 
 #include <QtCore>
 
@@ -97,6 +98,12 @@ public:
   BI_NetPoint& operator=(const BI_NetPoint& rhs) = delete;
   bool operator==(const BI_NetPoint& rhs) noexcept { return (this == &rhs); }
   bool operator!=(const BI_NetPoint& rhs) noexcept { return (this != &rhs); }
+  static void* operator new(std::size_t size) {
+    return ObjectPool<BI_NetPoint>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<BI_NetPoint>::deallocate(p, size);
+  }
 
 private:
   void init();
@@ -38,6 +38,8 @@
 
 #include <QtCore>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -48,20 +50,20 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
-                             const QHash<const BI_Device*, BI_Device*>& devMap)
+BI_NetSegment::BI_NetSegment(
+    Board& board, const BI_NetSegment& other,
+    const QHash<const BI_NetLineAnchor*, BI_NetLineAnchor*>& padMap)
   : BI_Base(board),
     mUuid(Uuid::createRandom()),
     mNetSignal(&other.getNetSignal()) {
-  // determine new pad anchors
+  // Note: The pads map is built only once for the whole board since it can be
+  // very large. The copied vias and netpoints are looked up in a separate map
+  // to avoid copying it for every netsegment.
   QHash<const BI_NetLineAnchor*, BI_NetLineAnchor*> anchorsMap;
-  for (auto it = devMap.begin(); it != devMap.end(); ++it) {
-    BI_Footprint& oldFp = it.key()->getFootprint();
-    BI_Footprint& newFp = it.value()->getFootprint();
-    foreach (const BI_FootprintPad* pad, oldFp.getPads()) {
-      anchorsMap.insert(pad, newFp.getPad(pad->getLibPadUuid()));
-    }
-  }
+  auto getCopiedAnchor = [&](const BI_NetLineAnchor& anchor) {
+    BI_NetLineAnchor* copy = anchorsMap.value(&anchor);
+    return copy ? copy : padMap.value(&anchor);
+  };
 
   // copy vias
   foreach (const BI_Via* via, other.mVias) {
@@ -78,9 +80,9 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
   }
   // copy netlines
   foreach (const BI_NetLine* netline, other.mNetLines) {
-    BI_NetLineAnchor* start = anchorsMap.value(&netline->getStartPoint());
+    BI_NetLineAnchor* start = getCopiedAnchor(netline->getStartPoint());
     Q_ASSERT(start);
-    BI_NetLineAnchor* end = anchorsMap.value(&netline->getEndPoint());
+    BI_NetLineAnchor* end = getCopiedAnchor(netline->getEndPoint());
     Q_ASSERT(end);
     BI_NetLine* copy = new BI_NetLine(*this, *netline, *start, *end);
     mNetLines.append(copy);
@@ -102,8 +104,8 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node)
     }
 
     // Load all vias
-    foreach (const SExpression& node, node.getChildren("via")) {
-      BI_Via* via = new BI_Via(*this, node);
+    foreach (const SExpression* node, node.getChildren("via")) {
+      BI_Via* via = new BI_Via(*this, *node);
       if (getViaByUuid(via->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -114,8 +116,8 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node)
     }
 
     // Load all netpoints
-    foreach (const SExpression& child, node.getChildren("junction")) {
-      BI_NetPoint* netpoint = new BI_NetPoint(*this, child);
+    foreach (const SExpression* child, node.getChildren("junction")) {
+      BI_NetPoint* netpoint = new BI_NetPoint(*this, *child);
       if (getNetPointByUuid(netpoint->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -126,9 +128,9 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node)
     }
 
     // Load all netlines
-    foreach (const SExpression& node,
+    foreach (const SExpression* node,
              node.getChildren("netline") + node.getChildren("trace")) {
-      BI_NetLine* netline = new BI_NetLine(*this, node);
+      BI_NetLine* netline = new BI_NetLine(*this, *node);
       if (getNetLineByUuid(netline->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -291,13 +293,31 @@ void BI_NetSegment::addElements(const QList<BI_Via*>&      vias,
     throw LogicError(__FILE__, __LINE__);
   }
 
-  ScopeGuardList sgl(netpoints.count() + netlines.count());
+  // Note: The UUIDs are collected in hash sets to check for duplicates in
+  // constant time. Otherwise adding many elements at once (e.g. when pasting
+  // traces) would have quadratic complexity. Elements which are already part
+  // of this segment are detected by their "added to board" state since all
+  // elements of this segment are added to the board.
+  QSet<Uuid> uuids;
+  foreach (const BI_Via* via, mVias) { uuids.insert(via->getUuid()); }
+  foreach (const BI_NetPoint* np, mNetPoints) { uuids.insert(np->getUuid()); }
+  foreach (const BI_NetLine* nl, mNetLines) { uuids.insert(nl->getUuid()); }
+
+  ScopeGuardList sgl(netpoints.count() + netlines.count() + 1);
+  QList<BI_Via*>      oldVias      = mVias;
+  QList<BI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<BI_NetLine*>  oldNetLines  = mNetLines;
+  sgl.add([this, oldVias, oldNetPoints, oldNetLines]() {
+    mVias      = oldVias;
+    mNetPoints = oldNetPoints;
+    mNetLines  = oldNetLines;
+  });
   foreach (BI_Via* via, vias) {
-    if ((mVias.contains(via)) || (&via->getNetSegment() != this)) {
+    if ((via->isAddedToBoard()) || (&via->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no via with the same uuid in the list
-    if (getViaByUuid(via->getUuid())) {
+    if (uuids.contains(via->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There is already a via with the UUID \"%1\"!"))
@@ -306,18 +326,15 @@ void BI_NetSegment::addElements(const QList<BI_Via*>&      vias,
     // add to board
     via->addToBoard();  // can throw
     mVias.append(via);
-    sgl.add([this, via]() {
-      via->removeFromBoard();
-      mVias.removeOne(via);
-    });
+    uuids.insert(via->getUuid());
+    sgl.add([via]() { via->removeFromBoard(); });
   }
   foreach (BI_NetPoint* netpoint, netpoints) {
-    if ((mNetPoints.contains(netpoint)) ||
-        (&netpoint->getNetSegment() != this)) {
+    if ((netpoint->isAddedToBoard()) || (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netpoint with the same uuid in the list
-    if (getNetPointByUuid(netpoint->getUuid())) {
+    if (uuids.contains(netpoint->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There is already a netpoint with the UUID \"%1\"!"))
@@ -326,17 +343,15 @@ void BI_NetSegment::addElements(const QList<BI_Via*>&      vias,
     // add to board
     netpoint->addToBoard();  // can throw
     mNetPoints.append(netpoint);
-    sgl.add([this, netpoint]() {
-      netpoint->removeFromBoard();
-      mNetPoints.removeOne(netpoint);
-    });
+    uuids.insert(netpoint->getUuid());
+    sgl.add([netpoint]() { netpoint->removeFromBoard(); });
   }
   foreach (BI_NetLine* netline, netlines) {
-    if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+    if ((netline->isAddedToBoard()) || (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netline with the same uuid in the list
-    if (getNetLineByUuid(netline->getUuid())) {
+    if (uuids.contains(netline->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There is already a netline with the UUID \"%1\"!"))
@@ -345,10 +360,8 @@ void BI_NetSegment::addElements(const QList<BI_Via*>&      vias,
     // add to board
     netline->addToBoard();  // can throw
     mNetLines.append(netline);
-    sgl.add([this, netline]() {
-      netline->removeFromBoard();
-      mNetLines.removeOne(netline);
-    });
+    uuids.insert(netline->getUuid());
+    sgl.add([netline]() { netline->removeFromBoard(); });
   }
 
   if (!areAllNetPointsConnectedTogether()) {
@@ -359,6 +372,7 @@ void BI_NetSegment::addElements(const QList<BI_Via*>&      vias,
   }
 
   sgl.dismiss();
+  mBoard.setModified();
 }
 
 void BI_NetSegment::removeElements(const QList<BI_Via*>&      vias,
@@ -368,43 +382,65 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>&      vias,
     throw LogicError(__FILE__, __LINE__);
   }
 
-  ScopeGuardList sgl(netpoints.count() + netlines.count());
+  // Note: The elements are removed from the lists in a single pass at the end
+  // to avoid quadratic complexity when removing many elements at once.
+  QSet<BI_Via*>      removedVias      = vias.toSet();
+  QSet<BI_NetPoint*> removedNetPoints = netpoints.toSet();
+  QSet<BI_NetLine*>  removedNetLines  = netlines.toSet();
+  if ((removedVias.count() != vias.count()) ||
+      (removedNetPoints.count() != netpoints.count()) ||
+      (removedNetLines.count() != netlines.count())) {
+    throw LogicError(__FILE__, __LINE__);  // duplicate elements
+  }
+
+  ScopeGuardList sgl(netpoints.count() + netlines.count() + 1);
+  QList<BI_Via*>      oldVias      = mVias;
+  QList<BI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<BI_NetLine*>  oldNetLines  = mNetLines;
+  sgl.add([this, oldVias, oldNetPoints, oldNetLines]() {
+    mVias      = oldVias;
+    mNetPoints = oldNetPoints;
+    mNetLines  = oldNetLines;
+  });
   foreach (BI_NetLine* netline, netlines) {
-    if (!mNetLines.contains(netline)) {
+    if ((!netline->isAddedToBoard()) || (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netline->removeFromBoard();  // can throw
-    mNetLines.removeOne(netline);
-    sgl.add([this, netline]() {
-      netline->addToBoard();
-      mNetLines.append(netline);
-    });
+    sgl.add([netline]() { netline->addToBoard(); });
   }
   foreach (BI_NetPoint* netpoint, netpoints) {
-    if (!mNetPoints.contains(netpoint)) {
+    if ((!netpoint->isAddedToBoard()) ||
+        (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netpoint->removeFromBoard();  // can throw
-    mNetPoints.removeOne(netpoint);
-    sgl.add([this, netpoint]() {
-      netpoint->addToBoard();
-      mNetPoints.append(netpoint);
-    });
+    sgl.add([netpoint]() { netpoint->addToBoard(); });
   }
   foreach (BI_Via* via, vias) {
-    if (!mVias.contains(via)) {
+    if ((!via->isAddedToBoard()) || (&via->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     via->removeFromBoard();  // can throw
-    mVias.removeOne(via);
-    sgl.add([this, via]() {
-      via->addToBoard();
-      mVias.append(via);
-    });
+    sgl.add([via]() { via->addToBoard(); });
   }
+  mNetLines.erase(std::remove_if(mNetLines.begin(), mNetLines.end(),
+                                 [&](BI_NetLine* netline) {
+                                   return removedNetLines.contains(netline);
+                                 }),
+                  mNetLines.end());
+  mNetPoints.erase(std::remove_if(mNetPoints.begin(), mNetPoints.end(),
+                                  [&](BI_NetPoint* netpoint) {
+                                    return removedNetPoints.contains(netpoint);
+                                  }),
+                   mNetPoints.end());
+  mVias.erase(std::remove_if(
+                  mVias.begin(), mVias.end(),
+                  [&](BI_Via* via) { return removedVias.contains(via); }),
+              mVias.end());
 
   if (!areAllNetPointsConnectedTogether()) {
     throw LogicError(
@@ -414,6 +450,7 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>&      vias,
   }
 
   sgl.dismiss();
+  mBoard.setModified();
 }
 
 /*******************************************************************************
@@ -548,55 +585,37 @@ bool BI_NetSegment::areAllNetPointsConnectedTogether() const noexcept {
                   // together" :)
   }
   Q_ASSERT(p);
-  QSet<const BI_Via*>          vias;
-  QSet<const BI_NetPoint*>     points;
-  QSet<const BI_FootprintPad*> pads;
-  findAllConnectedNetPoints(*p, vias, pads, points);
-  return (vias.count() == mVias.count()) &&
-         (points.count() == mNetPoints.count());
-}
 
-void BI_NetSegment::findAllConnectedNetPoints(
-    const BI_NetLineAnchor& p, QSet<const BI_Via*>& vias,
-    QSet<const BI_FootprintPad*>& pads, QSet<const BI_NetPoint*>& points) const
-    noexcept {
-  if (const BI_Via* via = dynamic_cast<const BI_Via*>(&p)) {
-    if (vias.contains(via)) return;
-    vias.insert(via);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == via) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == via) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
-      }
-    }
-  } else if (const BI_FootprintPad* pad =
-                 dynamic_cast<const BI_FootprintPad*>(&p)) {
-    if (pads.contains(pad)) return;
-    pads.insert(pad);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == pad) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == pad) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
-      }
+  // Note: The connections of all anchors are determined first to traverse the
+  // whole segment in linear time, instead of iterating over all netlines for
+  // each visited anchor.
+  QMultiHash<const BI_NetLineAnchor*, const BI_NetLineAnchor*> connections;
+  foreach (const BI_NetLine* netline, mNetLines) {
+    connections.insert(&netline->getStartPoint(), &netline->getEndPoint());
+    connections.insert(&netline->getEndPoint(), &netline->getStartPoint());
+  }
+  QSet<const BI_NetLineAnchor*>    visited;
+  QVector<const BI_NetLineAnchor*> pending;
+  int                              viaCount      = 0;
+  int                              netPointCount = 0;
+  visited.insert(p);
+  pending.append(p);
+  while (!pending.isEmpty()) {
+    const BI_NetLineAnchor* anchor = pending.takeLast();
+    if (dynamic_cast<const BI_Via*>(anchor)) {
+      ++viaCount;
+    } else if (dynamic_cast<const BI_NetPoint*>(anchor)) {
+      ++netPointCount;
     }
-  } else if (const BI_NetPoint* np = dynamic_cast<const BI_NetPoint*>(&p)) {
-    if (points.contains(np)) return;
-    points.insert(np);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == np) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == np) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
+    for (auto it = connections.find(anchor);
+         (it != connections.end()) && (it.key() == anchor); ++it) {
+      if (!visited.contains(it.value())) {
+        visited.insert(it.value());
+        pending.append(it.value());
       }
     }
-  } else {
-    Q_ASSERT(false);
   }
+  return (viaCount == mVias.count()) && (netPointCount == mNetPoints.count());
 }
 
 /*******************************************************************************
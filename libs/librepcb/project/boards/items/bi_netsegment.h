@@ -42,7 +42,6 @@ namespace project {
 class NetSignal;
 class BI_Device;
 class BI_Via;
-class BI_FootprintPad;
 class BI_NetPoint;
 class BI_NetLine;
 class BI_NetLineAnchor;
@@ -61,8 +60,9 @@ public:
   // Constructors / Destructor
   BI_NetSegment()                           = delete;
   BI_NetSegment(const BI_NetSegment& other) = delete;
-  BI_NetSegment(Board& board, const BI_NetSegment& other,
-                const QHash<const BI_Device*, BI_Device*>& devMap);
+  BI_NetSegment(
+      Board& board, const BI_NetSegment& other,
+      const QHash<const BI_NetLineAnchor*, BI_NetLineAnchor*>& padMap);
   BI_NetSegment(Board& board, const SExpression& node);
   BI_NetSegment(Board& board, NetSignal& signal);
   ~BI_NetSegment() noexcept;
@@ -133,11 +133,6 @@ public:
 private:
   bool checkAttributesValidity() const noexcept;
   bool areAllNetPointsConnectedTogether() const noexcept;
-  void findAllConnectedNetPoints(const BI_NetLineAnchor&       p,
-                                 QSet<const BI_Via*>&          vias,
-                                 QSet<const BI_FootprintPad*>& pads,
-                                 QSet<const BI_NetPoint*>&     points) const
-      noexcept;
 
   // Attributes
   Uuid       mUuid;
@@ -106,9 +106,12 @@ BI_Plane::BI_Plane(Board& board, const Uuid& uuid,
 }
 
 void BI_Plane::init() {
-  mGraphicsItem.reset(new BGI_Plane(*this));
-  mGraphicsItem->setPos(getPosition().toPxQPointF());
-  mGraphicsItem->setRotation(Angle::deg0().toDeg());
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new BGI_Plane(*this));
+    mGraphicsItem->setPos(getPosition().toPxQPointF());
+    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+  }
+  mFragmentsBuilder = std::make_shared<BoardPlaneFragmentsBuilder>();
 
   // connect to the "attributes changed" signal of the board
   connect(&mBoard, &Board::attributesChanged, this,
@@ -116,6 +119,7 @@ void BI_Plane::init() {
 }
 
 BI_Plane::~BI_Plane() noexcept {
+  mFragmentsBuilder.reset();
   mGraphicsItem.reset();
 }
 
@@ -126,14 +130,14 @@ BI_Plane::~BI_Plane() noexcept {
 void BI_Plane::setOutline(const Path& outline) noexcept {
   if (outline != mOutline) {
     mOutline = outline;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_Plane::setLayerName(const GraphicsLayerName& layerName) noexcept {
   if (layerName != mLayerName) {
     mLayerName = layerName;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
@@ -192,7 +196,9 @@ void BI_Plane::addToBoard() {
   }
   mNetSignal->registerBoardPlane(*this);  // can throw
   BI_Base::addToBoard(mGraphicsItem.data());
-  mGraphicsItem->updateCacheAndRepaint();  // TODO: remove this
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();  // TODO: remove this
+  }
   mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
@@ -207,13 +213,12 @@ void BI_Plane::removeFromBoard() {
 
 void BI_Plane::clear() noexcept {
   mFragments.clear();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
-void BI_Plane::rebuild() noexcept {
-  BoardPlaneFragmentsBuilder builder(*this);
-  mFragments = builder.buildFragments();
-  mGraphicsItem->updateCacheAndRepaint();
+void BI_Plane::setFragments(const QVector<Path>& fragments) noexcept {
+  mFragments = fragments;
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
@@ -236,16 +241,17 @@ void BI_Plane::serialize(SExpression& root) const {
  ******************************************************************************/
 
 QPainterPath BI_Plane::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Plane::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+  return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Plane::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*******************************************************************************
@@ -269,7 +275,7 @@ bool BI_Plane::operator<(const BI_Plane& rhs) const noexcept {
  ******************************************************************************/
 
 void BI_Plane::boardAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*******************************************************************************
@@ -32,6 +32,8 @@
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -42,6 +44,7 @@ class Project;
 class NetSignal;
 class Board;
 class BGI_Plane;
+class BoardPlaneFragmentsBuilder;
 
 /*******************************************************************************
  *  Class BI_Plane
@@ -102,7 +105,26 @@ public:
   void addToBoard() override;
   void removeFromBoard() override;
   void clear() noexcept;
-  void rebuild() noexcept;
+
+  /**
+   * @brief Get the fragments builder of this plane
+   *
+   * The builder keeps state between builds to speed up rebuilds, so always
+   * the same builder must be used for a plane. It is shared to allow
+   * rebuilding planes in a worker thread (see
+   * librepcb::project::Board::scheduleAllPlanesRebuild()).
+   */
+  const std::shared_ptr<BoardPlaneFragmentsBuilder>& getFragmentsBuilder()
+      const noexcept {
+    return mFragmentsBuilder;
+  }
+
+  /**
+   * @brief Apply fragments built by the fragments builder
+   *
+   * @param fragments   The new fragments
+   */
+  void setFragments(const QVector<Path>& fragments) noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -141,7 +163,8 @@ private:  // Data
   // Length mThermalGapWidth;
   // Length mThermalSpokeWidth;
   // style [round square miter] ?
-  QScopedPointer<BGI_Plane> mGraphicsItem;
+  QScopedPointer<BGI_Plane>                   mGraphicsItem;
+  std::shared_ptr<BoardPlaneFragmentsBuilder> mFragmentsBuilder;
 
   QVector<Path> mFragments;
 };
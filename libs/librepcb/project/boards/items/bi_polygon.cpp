@@ -42,17 +42,20 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other)
+  : BI_Base(board), mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(Uuid::createRandom(), *other.mPolygon));
   init();
 }
 
-BI_Polygon::BI_Polygon(Board& board, const SExpression& node) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const SExpression& node)
+  : BI_Base(board), mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(node));
   init();
 }
 
-BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon)
+  : BI_Base(board), mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(polygon));
   init();
 }
@@ -61,16 +64,21 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid,
                        const GraphicsLayerName& layerName,
                        const UnsignedLength& lineWidth, bool fill,
                        bool isGrabArea, const Path& path)
-  : BI_Base(board) {
+  : BI_Base(board), mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(
       new Polygon(uuid, layerName, lineWidth, fill, isGrabArea, path));
   init();
 }
 
 void BI_Polygon::init() {
-  mGraphicsItem.reset(
-      new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
-  mGraphicsItem->setZValue(Board::ZValue_Default);
+  mPolygon->onEdited.attach(mOnPolygonEditedSlot);
+
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(
+        new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
+    mGraphicsItem->setZValue(Board::ZValue_Default);
+    mGraphicsItem->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+  }
 
   // connect to the "attributes changed" signal of the board
   connect(&mBoard, &Board::attributesChanged, this,
@@ -109,6 +117,7 @@ void BI_Polygon::serialize(SExpression& root) const {
  ******************************************************************************/
 
 QPainterPath BI_Polygon::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -124,7 +133,7 @@ bool BI_Polygon::isSelectable() const noexcept {
 
 void BI_Polygon::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->setSelected(selected);
+  if (mGraphicsItem) mGraphicsItem->setSelected(selected);
 }
 
 /*******************************************************************************
@@ -132,7 +141,20 @@ void BI_Polygon::setSelected(bool selected) noexcept {
  ******************************************************************************/
 
 void BI_Polygon::boardAttributesChanged() {
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Polygon::polygonEdited(const Polygon& polygon,
+                               Polygon::Event event) noexcept {
+  Q_UNUSED(polygon);
+  Q_UNUSED(event);
+  // The polygon may be edited by generic undo commands which don't know the
+  // board, so the board must be marked as modified here.
+  mBoard.setModified();
 }
 
 /*******************************************************************************
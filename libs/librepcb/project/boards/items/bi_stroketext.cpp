@@ -75,9 +75,12 @@ void BI_StrokeText::init() {
   mText->setFont(&getProject().getStrokeFonts().getFont(
       mBoard.getDefaultFontName()));  // can throw
 
-  mGraphicsItem.reset(
-      new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
-  mAnchorGraphicsItem.reset(new LineGraphicsItem());
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(
+        new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
+    mGraphicsItem->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+    mAnchorGraphicsItem.reset(new LineGraphicsItem());
+  }
   updateGraphicsItems();
 
   // connect to the "attributes changed" signal of the board
@@ -105,6 +108,7 @@ void BI_StrokeText::updateGraphicsItems() noexcept {
   } else if (GraphicsLayer::isBottomLayer(*mText->getLayerName())) {
     zValue = Board::ZValue_TextsBottom;
   }
+  if (!mGraphicsItem) return;  // headless mode
   mGraphicsItem->setZValue(static_cast<qreal>(zValue));
   mAnchorGraphicsItem->setZValue(static_cast<qreal>(zValue));
 
@@ -124,7 +128,9 @@ void BI_StrokeText::addToBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
   BI_Base::addToBoard(mGraphicsItem.data());
-  mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
+  if (mAnchorGraphicsItem) {
+    mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
+  }
 }
 
 void BI_StrokeText::removeFromBoard() {
@@ -132,7 +138,9 @@ void BI_StrokeText::removeFromBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
   BI_Base::removeFromBoard(mGraphicsItem.data());
-  mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+  if (mAnchorGraphicsItem) {
+    mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+  }
 }
 
 void BI_StrokeText::serialize(SExpression& root) const {
@@ -148,6 +156,7 @@ const Point& BI_StrokeText::getPosition() const noexcept {
 }
 
 QPainterPath BI_StrokeText::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -163,7 +172,7 @@ bool BI_StrokeText::isSelectable() const noexcept {
 
 void BI_StrokeText::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->setSelected(selected);
+  if (mGraphicsItem) mGraphicsItem->setSelected(selected);
   updateGraphicsItems();
 }
 
@@ -172,7 +181,7 @@ void BI_StrokeText::setSelected(bool selected) noexcept {
  ******************************************************************************/
 
 void BI_StrokeText::boardAttributesChanged() {
-  mText->updatePaths();
+  mText->updateSubstitutedText();
 }
 
 /*******************************************************************************
@@ -190,6 +199,13 @@ void BI_StrokeText::strokeTextEdited(const StrokeText& text,
     default:
       break;
   }
+
+  // The text may be edited by generic undo commands which don't know the
+  // board, so the board must be marked as modified here. The paths are not
+  // serialized, they are only updated e.g. when attributes have changed.
+  if (event != StrokeText::Event::PathsChanged) {
+    mBoard.setModified();
+  }
 }
 
 /*******************************************************************************
@@ -74,8 +74,10 @@ BI_Via::BI_Via(BI_NetSegment& netsegment, const Point& position, Shape shape,
 
 void BI_Via::init() {
   // create the graphics item
-  mGraphicsItem.reset(new BGI_Via(*this));
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
+  if (!mBoard.isHeadless()) {
+    mGraphicsItem.reset(new BGI_Via(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+  }
 
   // connect to the "attributes changed" signal of the board
   connect(&mBoard, &Board::attributesChanged, this,
@@ -121,6 +123,14 @@ Path BI_Via::getSceneOutline(const Length& expansion) const noexcept {
   return getOutline(expansion).translated(mPosition);
 }
 
+ClipperLib::Path BI_Via::getClipperSceneOutline(
+    const Length& expansion, const PositiveLength& maxArcTolerance) const
+    noexcept {
+  return mClipperPathCache.get(
+      expansion, maxArcTolerance,
+      [this](const Length& e) { return getSceneOutline(e); });
+}
+
 QPainterPath BI_Via::toQPainterPathPx(const Length& expansion) const noexcept {
   QPainterPath p = getOutline(expansion).toQPainterPathPx();
   p.setFillRule(Qt::OddEvenFill);  // important to subtract the hole!
@@ -136,7 +146,9 @@ QPainterPath BI_Via::toQPainterPathPx(const Length& expansion) const noexcept {
 void BI_Via::setPosition(const Point& position) noexcept {
   if (position != mPosition) {
     mPosition = position;
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mClipperPathCache.invalidate();
+    if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemBounds();
     foreach (BI_NetLine* netline, mRegisteredNetLines) {
       netline->updateLine();
     }
@@ -147,21 +159,23 @@ void BI_Via::setPosition(const Point& position) noexcept {
 void BI_Via::setShape(Shape shape) noexcept {
   if (shape != mShape) {
     mShape = shape;
-    mGraphicsItem->updateCacheAndRepaint();
+    mClipperPathCache.invalidate();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_Via::setSize(const PositiveLength& size) noexcept {
   if (size != mSize) {
     mSize = size;
-    mGraphicsItem->updateCacheAndRepaint();
+    mClipperPathCache.invalidate();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_Via::setDrillDiameter(const PositiveLength& diameter) noexcept {
   if (diameter != mDrillDiameter) {
     mDrillDiameter = diameter;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
@@ -175,9 +189,12 @@ void BI_Via::addToBoard() {
   }
   mHighlightChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
+              [this]() {
+                if (mGraphicsItem) mGraphicsItem->update();
+              });
   BI_Base::addToBoard(mGraphicsItem.data());
   mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+  getNetSignalOfNetSegment().updateBoardRoutingStatistics(mBoard, Length(0), 1);
 }
 
 void BI_Via::removeFromBoard() {
@@ -187,6 +204,8 @@ void BI_Via::removeFromBoard() {
   disconnect(mHighlightChangedConnection);
   BI_Base::removeFromBoard(mGraphicsItem.data());
   mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+  getNetSignalOfNetSegment().updateBoardRoutingStatistics(mBoard, Length(0),
+                                                          -1);
 }
 
 void BI_Via::registerNetLine(BI_NetLine& netline) {
@@ -196,7 +215,7 @@ void BI_Via::registerNetLine(BI_NetLine& netline) {
   }
   mRegisteredNetLines.insert(&netline);
   netline.updateLine();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::unregisterNetLine(BI_NetLine& netline) {
@@ -205,7 +224,7 @@ void BI_Via::unregisterNetLine(BI_NetLine& netline) {
   }
   mRegisteredNetLines.remove(&netline);
   netline.updateLine();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::serialize(SExpression& root) const {
@@ -221,16 +240,17 @@ void BI_Via::serialize(SExpression& root) const {
  ******************************************************************************/
 
 QPainterPath BI_Via::getGrabAreaScenePx() const noexcept {
+  if (!mGraphicsItem) return QPainterPath();
   return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_Via::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+  return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Via::setSelected(bool selected) noexcept {
   BI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*******************************************************************************
@@ -238,7 +258,7 @@ void BI_Via::setSelected(bool selected) noexcept {
  ******************************************************************************/
 
 void BI_Via::boardAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*******************************************************************************
@@ -29,6 +29,7 @@
 
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/utils/clipperpathcache.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -78,6 +79,9 @@ public:
   bool isSelectable() const noexcept override;
   Path getOutline(const Length& expansion = Length(0)) const noexcept;
   Path getSceneOutline(const Length& expansion = Length(0)) const noexcept;
+  ClipperLib::Path getClipperSceneOutline(
+      const Length& expansion, const PositiveLength& maxArcTolerance) const
+      noexcept;
   QPainterPath toQPainterPathPx(const Length& expansion = Length(0)) const
       noexcept;
 
@@ -129,6 +133,9 @@ private:
   PositiveLength mSize;
   PositiveLength mDrillDiameter;
 
+  // Cached Attributes
+  mutable ClipperPathCache mClipperPathCache;
+
   // Registered Elements
   QSet<BI_NetLine*> mRegisteredNetLines;
 };
@@ -46,7 +46,9 @@ namespace project {
 Circuit::Circuit(Project& project, bool create)
   : QObject(&project),
     mProject(project),
-    mDirectory(new TransactionalDirectory(project.getDirectory(), "circuit")) {
+    mDirectory(new TransactionalDirectory(project.getDirectory(), "circuit")),
+    mIsModified(create),
+    mNextAutoNetSignalNumber(1) {
   qDebug() << "load circuit...";
 
   try {
@@ -60,22 +62,25 @@ Circuit::Circuit(Project& project, bool create)
       // OK - file is open --> now load the whole circuit stuff
 
       // Load all netclasses
-      foreach (const SExpression& node, root.getChildren("netclass")) {
-        NetClass* netclass = new NetClass(*this, node);
+      foreach (const SExpression* node, root.getChildren("netclass")) {
+        NetClass* netclass = new NetClass(*this, *node);
         addNetClass(*netclass);
       }
 
       // Load all netsignals
-      foreach (const SExpression& node, root.getChildren("net")) {
-        NetSignal* netsignal = new NetSignal(*this, node);
+      foreach (const SExpression* node, root.getChildren("net")) {
+        NetSignal* netsignal = new NetSignal(*this, *node);
         addNetSignal(*netsignal);
       }
 
       // Load all component instances
-      foreach (const SExpression& node, root.getChildren("component")) {
-        ComponentInstance* component = new ComponentInstance(*this, node);
+      foreach (const SExpression* node, root.getChildren("component")) {
+        ComponentInstance* component = new ComponentInstance(*this, *node);
         addComponentInstance(*component);
       }
+
+      // loading is not a modification, the file doesn't need to be rewritten
+      mIsModified = false;
     }
   } catch (...) {
     // free allocated memory (see comments in the destructor) and rethrow the
@@ -168,6 +173,7 @@ void Circuit::addNetClass(NetClass& netclass) {
   // add netclass to circuit
   netclass.addToCircuit();  // can throw
   mNetClasses.insert(netclass.getUuid(), &netclass);
+  mIsModified = true;
   emit netClassAdded(netclass);
 }
 
@@ -179,6 +185,7 @@ void Circuit::removeNetClass(NetClass& netclass) {
   // remove netclass from project
   netclass.removeFromCircuit();  // can throw
   mNetClasses.remove(netclass.getUuid());
+  mIsModified = true;
   emit netClassRemoved(netclass);
 }
 
@@ -196,6 +203,7 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName) {
   }
   // apply the new name
   netclass.setName(newName);  // can throw
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -204,24 +212,34 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName) {
 
 QString Circuit::generateAutoNetSignalName() const noexcept {
   QString name;
-  int     i = 1;
-  do {
-    name = QString("N%1").arg(i++);
-  } while (getNetSignalByName(name));
+  while (true) {
+    name = QString("N%1").arg(mNextAutoNetSignalNumber);
+    if (!mNetSignalsByName.contains(name)) {
+      break;
+    }
+    ++mNextAutoNetSignalNumber;
+  }
   return name;
 }
 
+QStringList Circuit::generateAutoNetSignalNames(int count) const noexcept {
+  QStringList names;
+  names.reserve(count);
+  for (int i = mNextAutoNetSignalNumber; names.count() < count; ++i) {
+    QString name = QString("N%1").arg(i);
+    if (!mNetSignalsByName.contains(name)) {
+      names.append(name);
+    }
+  }
+  return names;
+}
+
 NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept {
   return mNetSignals.value(uuid, nullptr);
 }
 
 NetSignal* Circuit::getNetSignalByName(const QString& name) const noexcept {
-  foreach (NetSignal* netsignal, mNetSignals) {
-    if (netsignal->getName() == name) {
-      return netsignal;
-    }
-  }
-  return nullptr;
+  return mNetSignalsByName.value(name, nullptr);
 }
 
 NetSignal* Circuit::getNetSignalWithMostElements() const noexcept {
@@ -256,6 +274,8 @@ void Circuit::addNetSignal(NetSignal& netsignal) {
   // add netsignal to circuit
   netsignal.addToCircuit();  // can throw
   mNetSignals.insert(netsignal.getUuid(), &netsignal);
+  mNetSignalsByName.insert(*netsignal.getName(), &netsignal);
+  mIsModified = true;
   emit netSignalAdded(netsignal);
 }
 
@@ -267,6 +287,8 @@ void Circuit::removeNetSignal(NetSignal& netsignal) {
   // remove netsignal from circuit
   netsignal.removeFromCircuit();  // can throw
   mNetSignals.remove(netsignal.getUuid());
+  releaseNetSignalName(*netsignal.getName());
+  mIsModified = true;
   emit netSignalRemoved(netsignal);
 }
 
@@ -285,12 +307,22 @@ void Circuit::setNetSignalName(NetSignal&               netsignal,
             .arg(*newName));
   }
   // apply the new name
+  QString oldName = *netsignal.getName();
   netsignal.setName(newName, isAutoName);  // can throw
+  releaseNetSignalName(oldName);
+  mNetSignalsByName.insert(*newName, &netsignal);
+  mIsModified = true;
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept {
-  foreach (NetSignal* netsignal, mNetSignals) {
-    netsignal->setHighlighted(signal == netsignal);
+  // Note: Only the old and the new highlighted net signal need to be updated,
+  // which then only repaint the graphics items connected to them.
+  if (mHighlightedNetSignal && (mHighlightedNetSignal != signal)) {
+    mHighlightedNetSignal->setHighlighted(false);
+  }
+  mHighlightedNetSignal = signal;
+  if (signal) {
+    signal->setHighlighted(true);
   }
 }
 
@@ -343,6 +375,7 @@ void Circuit::addComponentInstance(ComponentInstance& cmp) {
   // add to circuit
   cmp.addToCircuit();  // can throw
   mComponentInstances.insert(cmp.getUuid(), &cmp);
+  mIsModified = true;
   emit componentAdded(cmp);
 }
 
@@ -354,6 +387,7 @@ void Circuit::removeComponentInstance(ComponentInstance& cmp) {
   // remove from circuit
   cmp.removeFromCircuit();  // can throw
   mComponentInstances.remove(cmp.getUuid());
+  mIsModified = true;
   emit componentRemoved(cmp);
 }
 
@@ -372,6 +406,7 @@ void Circuit::setComponentInstanceName(ComponentInstance&       cmp,
   }
   // apply the new name
   cmp.setName(newName);  // can throw
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -379,8 +414,11 @@ void Circuit::setComponentInstanceName(ComponentInstance&       cmp,
  ******************************************************************************/
 
 void Circuit::save() {
-  SExpression doc(serializeToDomElement("librepcb_circuit"));  // can throw
-  mDirectory->write("circuit.lp", doc.toByteArray());          // can throw
+  if (mIsModified) {
+    SExpression doc(serializeToDomElement("librepcb_circuit"));  // can throw
+    mDirectory->write("circuit.lp", doc.toByteArray());          // can throw
+    mIsModified = false;
+  }
 }
 
 /*******************************************************************************
@@ -397,6 +435,26 @@ void Circuit::serialize(SExpression& root) const {
   root.appendLineBreak();
 }
 
+int Circuit::getAutoNetSignalNumber(const QString& name) noexcept {
+  if (!name.startsWith('N')) {
+    return 0;
+  }
+  bool ok     = false;
+  int  number = name.mid(1).toInt(&ok);
+  if ((!ok) || (number < 1) || (QString("N%1").arg(number) != name)) {
+    return 0;  // e.g. "N0" or "N01"
+  }
+  return number;
+}
+
+void Circuit::releaseNetSignalName(const QString& name) noexcept {
+  mNetSignalsByName.remove(name);
+  int number = getAutoNetSignalNumber(name);
+  if ((number > 0) && (number < mNextAutoNetSignalNumber)) {
+    mNextAutoNetSignalNumber = number;  // this name is free again
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -82,6 +82,19 @@ public:
   // Getters
   Project& getProject() const noexcept { return mProject; }
 
+  /**
+   * @brief Check whether the circuit file needs to be written by #save()
+   *
+   * The flag is set by all modifications of the circuit (which must be done
+   * with undo commands) and is cleared by #save().
+   *
+   * @return True if the circuit was modified since it was loaded or saved
+   */
+  bool isModified() const noexcept { return mIsModified; }
+
+  // Setters
+  void setModified() noexcept { mIsModified = true; }
+
   // NetClass Methods
   const QMap<Uuid, NetClass*>& getNetClasses() const noexcept {
     return mNetClasses;
@@ -93,7 +106,21 @@ public:
   void      setNetClassName(NetClass& netclass, const ElementName& newName);
 
   // NetSignal Methods
-  QString                       generateAutoNetSignalName() const noexcept;
+  QString generateAutoNetSignalName() const noexcept;
+
+  /**
+   * @brief Generate unique names for many new net signals at once
+   *
+   * Returns the same names as calling #generateAutoNetSignalName() and adding
+   * a net signal with the returned name after each call, but without adding
+   * the net signals. Useful to create many net signals in linear time.
+   *
+   * @param count   Number of names to generate
+   *
+   * @return The generated names (distinct and not used yet)
+   */
+  QStringList generateAutoNetSignalNames(int count) const noexcept;
+
   const QMap<Uuid, NetSignal*>& getNetSignals() const noexcept {
     return mNetSignals;
   }
@@ -142,13 +169,34 @@ private:
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
+  /**
+   * @brief Get the number of an auto generated net signal name
+   *
+   * @param name    A net signal name
+   *
+   * @return The number of names like "N42", or 0 for all other names
+   */
+  static int getAutoNetSignalNumber(const QString& name) noexcept;
+  void       releaseNetSignalName(const QString& name) noexcept;
+
   // General
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   QScopedPointer<TransactionalDirectory> mDirectory;
+  bool                                   mIsModified;
 
   QMap<Uuid, NetClass*>          mNetClasses;
   QMap<Uuid, NetSignal*>         mNetSignals;
   QMap<Uuid, ComponentInstance*> mComponentInstances;
+
+  /// Index of #mNetSignals by name, for fast lookups and uniqueness checks
+  QHash<QString, NetSignal*> mNetSignalsByName;
+
+  /// All auto names "N1".."N<n-1>" are in use, so #generateAutoNetSignalName()
+  /// starts searching at this number
+  mutable int mNextAutoNetSignalNumber;
+
+  /// The currently highlighted net signal (nullptr if none)
+  QPointer<NetSignal> mHighlightedNetSignal;
 };
 
 /*******************************************************************************
@@ -90,12 +90,14 @@ void CmdComponentInstanceEdit::performUndo() {
   mCircuit.setComponentInstanceName(mComponentInstance, mOldName);  // can throw
   mComponentInstance.setValue(mOldValue);
   mComponentInstance.setAttributes(mOldAttributes);
+  mCircuit.setModified();
 }
 
 void CmdComponentInstanceEdit::performRedo() {
   mCircuit.setComponentInstanceName(mComponentInstance, mNewName);  // can throw
   mComponentInstance.setValue(mNewValue);
   mComponentInstance.setAttributes(mNewAttributes);
+  mCircuit.setModified();
 }
 
 /*******************************************************************************
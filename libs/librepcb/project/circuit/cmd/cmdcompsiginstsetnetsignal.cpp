@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdcompsiginstsetnetsignal.h"
 
+#include "../circuit.h"
 #include "../componentsignalinstance.h"
 
 #include <QtCore>
@@ -59,10 +60,12 @@ bool CmdCompSigInstSetNetSignal::performExecute() {
 
 void CmdCompSigInstSetNetSignal::performUndo() {
   mComponentSignalInstance.setNetSignal(mOldNetSignal);  // can throw
+  mComponentSignalInstance.getCircuit().setModified();
 }
 
 void CmdCompSigInstSetNetSignal::performRedo() {
   mComponentSignalInstance.setNetSignal(mNetSignal);  // can throw
+  mComponentSignalInstance.getCircuit().setModified();
 }
 
 /*******************************************************************************
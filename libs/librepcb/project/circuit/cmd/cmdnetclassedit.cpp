@@ -42,7 +42,9 @@ CmdNetClassEdit::CmdNetClassEdit(Circuit& circuit, NetClass& netclass) noexcept
     mCircuit(circuit),
     mNetClass(netclass),
     mOldName(netclass.getName()),
-    mNewName(mOldName) {
+    mNewName(mOldName),
+    mOldAirWiresPolicy(netclass.getAirWiresPolicy()),
+    mNewAirWiresPolicy(mOldAirWiresPolicy) {
 }
 
 CmdNetClassEdit::~CmdNetClassEdit() noexcept {
@@ -57,6 +59,12 @@ void CmdNetClassEdit::setName(const ElementName& name) noexcept {
   mNewName = name;
 }
 
+void CmdNetClassEdit::setAirWiresPolicy(
+    NetClass::AirWiresPolicy policy) noexcept {
+  Q_ASSERT(!wasEverExecuted());
+  mNewAirWiresPolicy = policy;
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -69,10 +77,14 @@ bool CmdNetClassEdit::performExecute() {
 
 void CmdNetClassEdit::performUndo() {
   mCircuit.setNetClassName(mNetClass, mOldName);  // can throw
+  mNetClass.setAirWiresPolicy(mOldAirWiresPolicy);
+  mCircuit.setModified();
 }
 
 void CmdNetClassEdit::performRedo() {
   mCircuit.setNetClassName(mNetClass, mNewName);  // can throw
+  mNetClass.setAirWiresPolicy(mNewAirWiresPolicy);
+  mCircuit.setModified();
 }
 
 /*******************************************************************************
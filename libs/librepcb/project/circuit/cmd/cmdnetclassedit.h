@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../netclass.h"
+
 #include <librepcb/common/elementname.h>
 #include <librepcb/common/undocommand.h>
 
@@ -35,7 +37,6 @@ namespace librepcb {
 namespace project {
 
 class Circuit;
-class NetClass;
 
 /*******************************************************************************
  *  Class CmdNetClassEdit
@@ -52,6 +53,7 @@ public:
 
   // Setters
   void setName(const ElementName& name) noexcept;
+  void setAirWiresPolicy(NetClass::AirWiresPolicy policy) noexcept;
 
 private:
   // Private Methods
@@ -72,8 +74,10 @@ private:
   NetClass& mNetClass;
 
   // General Attributes
-  ElementName mOldName;
-  ElementName mNewName;
+  ElementName              mOldName;
+  ElementName              mNewName;
+  NetClass::AirWiresPolicy mOldAirWiresPolicy;
+  NetClass::AirWiresPolicy mNewAirWiresPolicy;
 };
 
 /*******************************************************************************
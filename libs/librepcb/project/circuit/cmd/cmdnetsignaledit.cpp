@@ -74,10 +74,12 @@ bool CmdNetSignalEdit::performExecute() {
 
 void CmdNetSignalEdit::performUndo() {
   mCircuit.setNetSignalName(mNetSignal, mOldName, mOldIsAutoName);  // can throw
+  mCircuit.setModified();
 }
 
 void CmdNetSignalEdit::performRedo() {
   mCircuit.setNetSignalName(mNetSignal, mNewName, mNewIsAutoName);  // can throw
+  mCircuit.setModified();
 }
 
 /*******************************************************************************
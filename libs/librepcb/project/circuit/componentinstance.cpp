@@ -76,10 +76,10 @@ ComponentInstance::ComponentInstance(Circuit& circuit, const SExpression& node)
   mAttributes.reset(new AttributeList(node));  // can throw
 
   // load all signal instances
-  foreach (const SExpression& node,
+  foreach (const SExpression* node,
            node.getChildren("sig") + node.getChildren("signal")) {
     ComponentSignalInstance* signal =
-        new ComponentSignalInstance(mCircuit, *this, node);
+        new ComponentSignalInstance(mCircuit, *this, *node);
     if (mSignals.contains(signal->getCompSignal().getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
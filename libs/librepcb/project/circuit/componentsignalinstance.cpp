@@ -24,6 +24,7 @@
 
 #include "../boards/items/bi_footprintpad.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../schematics/items/si_symbolpin.h"
 #include "../settings/projectsettings.h"
@@ -108,7 +109,7 @@ void ComponentSignalInstance::init() {
 
   // register to component attributes changed
   connect(&mComponentInstance, &ComponentInstance::attributesChanged, this,
-          &ComponentSignalInstance::updateErcMessages);
+          &ComponentSignalInstance::scheduleErcMessagesUpdate);
 
   // register to net signal name changed
   if (mNetSignal) {
@@ -123,6 +124,7 @@ ComponentSignalInstance::~ComponentSignalInstance() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
   Q_ASSERT(!isUsed());
   Q_ASSERT(!arePinsOrPadsUsed());
+  mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
 }
 
 /*******************************************************************************
@@ -201,7 +203,7 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) {
   }
   NetSignal* old = mNetSignal;
   mNetSignal     = netsignal;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
   sgl.dismiss();
   emit netSignalChanged(old, mNetSignal);
 }
@@ -218,7 +220,7 @@ void ComponentSignalInstance::addToCircuit() {
     mNetSignal->registerComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::removeFromCircuit() {
@@ -235,7 +237,7 @@ void ComponentSignalInstance::removeFromCircuit() {
     mNetSignal->unregisterComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin) {
@@ -287,16 +289,6 @@ bool ComponentSignalInstance::checkAttributesValidity() const noexcept {
   return true;
 }
 
-/*******************************************************************************
- *  Private Slots
- ******************************************************************************/
-
-void ComponentSignalInstance::netSignalNameChanged(
-    const CircuitIdentifier& newName) noexcept {
-  Q_UNUSED(newName);
-  updateErcMessages();
-}
-
 void ComponentSignalInstance::updateErcMessages() noexcept {
   mErcMsgUnconnectedRequiredSignal->setMsg(
       QString(tr("Unconnected component signal: \"%1\" from \"%2\""))
@@ -316,6 +308,20 @@ void ComponentSignalInstance::updateErcMessages() noexcept {
                   : false));
 }
 
+/*******************************************************************************
+ *  Private Slots
+ ******************************************************************************/
+
+void ComponentSignalInstance::netSignalNameChanged(
+    const CircuitIdentifier& newName) noexcept {
+  Q_UNUSED(newName);
+  scheduleErcMessagesUpdate();
+}
+
+void ComponentSignalInstance::scheduleErcMessagesUpdate() noexcept {
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -45,7 +45,12 @@ NetClass::NetClass(Circuit& circuit, const SExpression& node)
     mCircuit(circuit),
     mIsAddedToCircuit(false),
     mUuid(node.getChildByIndex(0).getValue<Uuid>()),
-    mName(node.getValueByPath<ElementName>("name")) {
+    mName(node.getValueByPath<ElementName>("name")),
+    mAirWiresPolicy(AirWiresPolicy::Always) {
+  if (const SExpression* child = node.tryGetChildByPath("airwires")) {
+    mAirWiresPolicy =
+        child->getValueOfFirstChild<AirWiresPolicy>();  // can throw
+  }
 }
 
 NetClass::NetClass(Circuit& circuit, const ElementName& name)
@@ -53,7 +58,8 @@ NetClass::NetClass(Circuit& circuit, const ElementName& name)
     mCircuit(circuit),
     mIsAddedToCircuit(false),
     mUuid(Uuid::createRandom()),
-    mName(name) {
+    mName(name),
+    mAirWiresPolicy(AirWiresPolicy::Always) {
 }
 
 NetClass::~NetClass() noexcept {
@@ -73,6 +79,16 @@ void NetClass::setName(const ElementName& name) noexcept {
   updateErcMessages();
 }
 
+void NetClass::setAirWiresPolicy(AirWiresPolicy policy) noexcept {
+  if (policy == mAirWiresPolicy) {
+    return;
+  }
+  mAirWiresPolicy = policy;
+  foreach (NetSignal* signal, mRegisteredNetSignals) {
+    signal->scheduleAirWiresRebuild();
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -121,6 +137,10 @@ void NetClass::unregisterNetSignal(NetSignal& signal) {
 void NetClass::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.appendChild("name", mName, false);
+  // Note: Only written if not default to keep existing files unmodified.
+  if (mAirWiresPolicy != AirWiresPolicy::Always) {
+    root.appendChild("airwires", mAirWiresPolicy, false);
+  }
 }
 
 /*******************************************************************************
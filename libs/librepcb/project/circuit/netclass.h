@@ -56,6 +56,20 @@ class NetClass final : public QObject,
   DECLARE_ERC_MSG_CLASS_NAME(NetClass)
 
 public:
+  // Types
+
+  /**
+   * @brief When to calculate and show the airwires of the net signals
+   *
+   * Calculating airwires is expensive for big nets, so nets which don't need
+   * them (e.g. power nets which get connected by planes) can be excluded.
+   */
+  enum class AirWiresPolicy {
+    Always,       ///< Airwires are always shown
+    OnHighlight,  ///< Airwires are only shown while the net is highlighted
+    Never,        ///< Airwires are never shown
+  };
+
   // Constructors / Destructor
   NetClass()                      = delete;
   NetClass(const NetClass& other) = delete;
@@ -71,10 +85,21 @@ public:
     return mRegisteredNetSignals.count();
   }
   bool isUsed() const noexcept { return (getNetSignalCount() > 0); }
+  AirWiresPolicy getAirWiresPolicy() const noexcept { return mAirWiresPolicy; }
 
   // Setters
   void setName(const ElementName& name) noexcept;
 
+  /**
+   * @brief Set the airwires policy
+   *
+   * The airwires of all net signals of this net class get rebuilt on all
+   * boards.
+   *
+   * @param policy  The new policy
+   */
+  void setAirWiresPolicy(AirWiresPolicy policy) noexcept;
+
   // General Methods
   void addToCircuit();
   void removeFromCircuit();
@@ -95,8 +120,9 @@ private:
   bool     mIsAddedToCircuit;
 
   // Attributes
-  Uuid        mUuid;
-  ElementName mName;
+  Uuid           mUuid;
+  ElementName    mName;
+  AirWiresPolicy mAirWiresPolicy;
 
   // Registered Elements
   /// @brief all registered netsignals
@@ -108,10 +134,48 @@ private:
 };
 
 /*******************************************************************************
- *  End of File
+ *  Non-Member Functions
  ******************************************************************************/
 
 }  // namespace project
+
+template <>
+inline SExpression serializeToSExpression(
+    const project::NetClass::AirWiresPolicy& obj) {
+  switch (obj) {
+    case project::NetClass::AirWiresPolicy::Always:
+      return SExpression::createToken("always");
+    case project::NetClass::AirWiresPolicy::OnHighlight:
+      return SExpression::createToken("highlighted");
+    case project::NetClass::AirWiresPolicy::Never:
+      return SExpression::createToken("never");
+    default:
+      throw LogicError(__FILE__, __LINE__);
+  }
+}
+
+template <>
+inline project::NetClass::AirWiresPolicy deserializeFromSExpression(
+    const SExpression& sexpr, bool throwIfEmpty) {
+  QString str = sexpr.getStringOrToken(throwIfEmpty);
+  if (str == "always") {
+    return project::NetClass::AirWiresPolicy::Always;
+  } else if (str == "highlighted") {
+    return project::NetClass::AirWiresPolicy::OnHighlight;
+  } else if (str == "never") {
+    return project::NetClass::AirWiresPolicy::Never;
+  } else {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(project::NetClass::tr("Unknown airwires policy: \"%1\""))
+            .arg(str));
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
 }  // namespace librepcb
 
 #endif  // LIBREPCB_PROJECT_NETCLASS_H
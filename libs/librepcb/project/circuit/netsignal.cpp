@@ -22,9 +22,12 @@
  ******************************************************************************/
 #include "netsignal.h"
 
+#include "../boards/board.h"
 #include "../boards/items/bi_netsegment.h"
 #include "../boards/items/bi_plane.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "../schematics/items/si_netsegment.h"
 #include "circuit.h"
 #include "componentsignalinstance.h"
@@ -80,6 +83,7 @@ NetSignal::NetSignal(Circuit& circuit, NetClass& netclass,
 NetSignal::~NetSignal() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
   Q_ASSERT(!isUsed());
+  mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
 }
 
 /*******************************************************************************
@@ -99,8 +103,14 @@ bool NetSignal::isUsed() const noexcept {
   return (getRegisteredElementsCount() > 0);
 }
 
+NetSignal::RoutingStatistics NetSignal::getBoardRoutingStatistics(
+    const Board& board) const noexcept {
+  return mBoardRoutingStatistics.value(&board, RoutingStatistics{});
+}
+
 bool NetSignal::isNameForced() const noexcept {
-  foreach (const ComponentSignalInstance* cmp, mRegisteredComponentSignals) {
+  foreach (const ComponentSignalInstance* cmp,
+           mRegisteredComponentSignals.values()) {
     if (cmp->isNetSignalNameForced()) {
       return true;
     }
@@ -108,6 +118,17 @@ bool NetSignal::isNameForced() const noexcept {
   return false;
 }
 
+bool NetSignal::areAirWiresShown() const noexcept {
+  switch (mNetClass->getAirWiresPolicy()) {
+    case NetClass::AirWiresPolicy::OnHighlight:
+      return mIsHighlighted;
+    case NetClass::AirWiresPolicy::Never:
+      return false;
+    default:
+      return true;
+  }
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -119,13 +140,17 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName        = name;
   mHasAutoName = isAutoName;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
   emit nameChanged(mName);
 }
 
 void NetSignal::setHighlighted(bool hl) noexcept {
   if (hl != mIsHighlighted) {
     mIsHighlighted = hl;
+    if (mNetClass->getAirWiresPolicy() ==
+        NetClass::AirWiresPolicy::OnHighlight) {
+      scheduleAirWiresRebuild();
+    }
     emit highlightedChanged(mIsHighlighted);
   }
 }
@@ -140,7 +165,7 @@ void NetSignal::addToCircuit() {
   }
   mNetClass->registerNetSignal(*this);  // can throw
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::removeFromCircuit() {
@@ -155,7 +180,7 @@ void NetSignal::removeFromCircuit() {
   }
   mNetClass->unregisterNetSignal(*this);  // can throw
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
@@ -164,7 +189,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.append(&signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
@@ -172,8 +197,8 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
       (!mRegisteredComponentSignals.contains(&signal))) {
     throw LogicError(__FILE__, __LINE__);
   }
-  mRegisteredComponentSignals.removeOne(&signal);
-  updateErcMessages();
+  mRegisteredComponentSignals.remove(&signal);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -183,7 +208,7 @@ void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -191,8 +216,8 @@ void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
       (!mRegisteredSchematicNetSegments.contains(&netsegment))) {
     throw LogicError(__FILE__, __LINE__);
   }
-  mRegisteredSchematicNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mRegisteredSchematicNetSegments.remove(&netsegment);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
@@ -202,7 +227,7 @@ void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
@@ -210,8 +235,28 @@ void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
       (!mRegisteredBoardNetSegments.contains(&netsegment))) {
     throw LogicError(__FILE__, __LINE__);
   }
-  mRegisteredBoardNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mRegisteredBoardNetSegments.remove(&netsegment);
+  scheduleErcMessagesUpdate();
+}
+
+void NetSignal::updateBoardRoutingStatistics(const Board&  board,
+                                             const Length& trackLengthDelta,
+                                             int viaCountDelta) noexcept {
+  if ((trackLengthDelta == 0) && (viaCountDelta == 0)) {
+    return;
+  }
+  auto it = mBoardRoutingStatistics.find(&board);
+  if (it == mBoardRoutingStatistics.end()) {
+    it = mBoardRoutingStatistics.insert(&board, RoutingStatistics{});
+  }
+  it->trackLength += trackLengthDelta;
+  it->viaCount += viaCountDelta;
+  Q_ASSERT((it->trackLength >= 0) && (it->viaCount >= 0));
+  if ((it->trackLength == 0) && (it->viaCount == 0)) {
+    // don't keep entries of boards which are removed or deleted
+    mBoardRoutingStatistics.erase(it);
+  }
+  emit boardRoutingStatisticsChanged(board);
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane) {
@@ -220,15 +265,22 @@ void NetSignal::registerBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.append(&plane);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
   if ((!mIsAddedToCircuit) || (!mRegisteredBoardPlanes.contains(&plane))) {
     throw LogicError(__FILE__, __LINE__);
   }
-  mRegisteredBoardPlanes.removeOne(&plane);
-  updateErcMessages();
+  mRegisteredBoardPlanes.remove(&plane);
+  scheduleErcMessagesUpdate();
+}
+
+void NetSignal::scheduleAirWiresRebuild() noexcept {
+  foreach (Board* board, mCircuit.getProject().getBoards()) {
+    board->scheduleAirWiresRebuild(this);
+    board->triggerAirWiresRebuildDeferred();
+  }
 }
 
 void NetSignal::serialize(SExpression& root) const {
@@ -249,6 +301,10 @@ bool NetSignal::checkAttributesValidity() const noexcept {
   return true;
 }
 
+void NetSignal::scheduleErcMessagesUpdate() noexcept {
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void NetSignal::updateErcMessages() noexcept {
   if (mIsAddedToCircuit && (!isUsed())) {
     if (!mErcMsgUnusedNetSignal) {
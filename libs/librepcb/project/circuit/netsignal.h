@@ -28,6 +28,8 @@
 #include <librepcb/common/circuitidentifier.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/units/length.h>
+#include <librepcb/common/utils/indexedlist.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -40,6 +42,7 @@ namespace project {
 
 class Circuit;
 class NetClass;
+class Board;
 class ComponentSignalInstance;
 class SI_NetSegment;
 class BI_NetSegment;
@@ -60,6 +63,18 @@ class NetSignal final : public QObject,
   DECLARE_ERC_MSG_CLASS_NAME(NetSignal)
 
 public:
+  // Types
+
+  /**
+   * @brief Routing statistics of a net signal on a single board
+   *
+   * @see #getBoardRoutingStatistics()
+   */
+  struct RoutingStatistics {
+    Length trackLength;  ///< Total length of all net lines
+    int    viaCount;     ///< Number of vias
+  };
+
   // Constructors / Destructor
   NetSignal()                       = delete;
   NetSignal(const NetSignal& other) = delete;
@@ -78,22 +93,48 @@ public:
   // Getters: General
   Circuit& getCircuit() const noexcept { return mCircuit; }
   const QList<ComponentSignalInstance*>& getComponentSignals() const noexcept {
-    return mRegisteredComponentSignals;
+    return mRegisteredComponentSignals.values();
   }
   const QList<SI_NetSegment*>& getSchematicNetSegments() const noexcept {
-    return mRegisteredSchematicNetSegments;
+    return mRegisteredSchematicNetSegments.values();
   }
   const QList<BI_NetSegment*>& getBoardNetSegments() const noexcept {
-    return mRegisteredBoardNetSegments;
+    return mRegisteredBoardNetSegments.values();
   }
   const QList<BI_Plane*>& getBoardPlanes() const noexcept {
-    return mRegisteredBoardPlanes;
+    return mRegisteredBoardPlanes.values();
   }
   int  getRegisteredElementsCount() const noexcept;
   bool isUsed() const noexcept;
+
+  /**
+   * @brief Get the routing statistics of this net signal on a board
+   *
+   * The statistics are not calculated on demand but maintained incrementally
+   * by #updateBoardRoutingStatistics() while net lines and vias are added,
+   * removed or moved, so this is cheap enough to be called while routing.
+   *
+   * @param board   The board to get the statistics of
+   *
+   * @return Track length and via count (zero if nothing is routed)
+   */
+  RoutingStatistics getBoardRoutingStatistics(const Board& board) const
+      noexcept;
   bool isNameForced() const noexcept;
   bool isAddedToCircuit() const noexcept { return mIsAddedToCircuit; }
 
+  /**
+   * @brief Check whether the airwires of this net signal are shown
+   *
+   * Depends on the airwires policy of the net class (see
+   * librepcb::project::NetClass::getAirWiresPolicy()) and on whether this
+   * net signal is highlighted. Boards don't calculate airwires which are not
+   * shown.
+   *
+   * @return Whether the airwires are shown or not
+   */
+  bool areAirWiresShown() const noexcept;
+
   // Setters
   void setName(const CircuitIdentifier& name, bool isAutoName) noexcept;
   void setHighlighted(bool hl) noexcept;
@@ -110,6 +151,28 @@ public:
   void registerBoardPlane(BI_Plane& plane);
   void unregisterBoardPlane(BI_Plane& plane);
 
+  /**
+   * @brief Rebuild the airwires of this net signal on all boards
+   *
+   * Called when #areAirWiresShown() has changed, since the boards don't keep
+   * airwires of net signals which are not shown.
+   */
+  void scheduleAirWiresRebuild() noexcept;
+
+  /**
+   * @brief Add the length or via count difference of a board item
+   *
+   * Called by librepcb::project::BI_NetLine and librepcb::project::BI_Via of
+   * the net segments registered with #registerBoardNetSegment().
+   *
+   * @param board             The board of the item
+   * @param trackLengthDelta  Length to add (negative to subtract)
+   * @param viaCountDelta     Number of vias to add (negative to subtract)
+   */
+  void updateBoardRoutingStatistics(const Board&  board,
+                                    const Length& trackLengthDelta,
+                                    int           viaCountDelta) noexcept;
+
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
@@ -122,10 +185,12 @@ signals:
 
   void nameChanged(const CircuitIdentifier& newName);
   void highlightedChanged(bool isHighlighted);
+  void boardRoutingStatisticsChanged(const Board& board);
 
 private:
   bool checkAttributesValidity() const noexcept;
-  void updateErcMessages() noexcept;
+  void scheduleErcMessagesUpdate() noexcept;
+  void updateErcMessages() noexcept override;
 
   // General
   Circuit& mCircuit;
@@ -139,10 +204,13 @@ private:
   NetClass*         mNetClass;
 
   // Registered Elements of this NetSignal
-  QList<ComponentSignalInstance*> mRegisteredComponentSignals;
-  QList<SI_NetSegment*>           mRegisteredSchematicNetSegments;
-  QList<BI_NetSegment*>           mRegisteredBoardNetSegments;
-  QList<BI_Plane*>                mRegisteredBoardPlanes;
+  IndexedList<ComponentSignalInstance> mRegisteredComponentSignals;
+  IndexedList<SI_NetSegment>           mRegisteredSchematicNetSegments;
+  IndexedList<BI_NetSegment>           mRegisteredBoardNetSegments;
+  IndexedList<BI_Plane>                mRegisteredBoardPlanes;
+
+  /// Routing statistics of the registered board net segments, by board
+  QHash<const Board*, RoutingStatistics> mBoardRoutingStatistics;
 
   // ERC Messages
   /// @brief the ERC message for unused netsignals
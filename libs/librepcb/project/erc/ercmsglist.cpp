@@ -41,11 +41,15 @@ namespace project {
  ******************************************************************************/
 
 ErcMsgList::ErcMsgList(Project& project)
-  : QObject(&project), mProject(project) {
+  : QObject(&project), mProject(project), mIsModified(true) {
+  mUpdateTimer.setSingleShot(true);
+  mUpdateTimer.setInterval(0);
+  connect(&mUpdateTimer, &QTimer::timeout, this, &ErcMsgList::updateScheduled);
 }
 
 ErcMsgList::~ErcMsgList() noexcept {
   Q_ASSERT(mItems.isEmpty());
+  Q_ASSERT(mScheduledProviders.isEmpty());
 }
 
 /*******************************************************************************
@@ -56,7 +60,8 @@ void ErcMsgList::add(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(!mItems.contains(ercMsg));
   Q_ASSERT(!ercMsg->isIgnored());
-  mItems.append(ercMsg);
+  mItems.insert(ercMsg);
+  mIsModified = true;
   emit ercMsgAdded(ercMsg);
 }
 
@@ -64,7 +69,8 @@ void ErcMsgList::remove(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(mItems.contains(ercMsg));
   Q_ASSERT(!ercMsg->isIgnored());
-  mItems.removeOne(ercMsg);
+  mItems.remove(ercMsg);
+  mIsModified = true;
   emit ercMsgRemoved(ercMsg);
 }
 
@@ -72,39 +78,71 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(mItems.contains(ercMsg));
   Q_ASSERT(ercMsg->isVisible());
+  mIsModified = true;
   emit ercMsgChanged(ercMsg);
 }
 
 void ErcMsgList::restoreIgnoreState() {
+  updateScheduled();  // make sure all messages exist
   QString fp = "circuit/erc.lp";
   if (mProject.getDirectory().fileExists(fp)) {
     SExpression root =
         SExpression::parse(mProject.getDirectory().read(fp),
                            mProject.getDirectory().getAbsPath(fp));
 
-    // reset all ignore attributes
-    foreach (ErcMsg* ercMsg, mItems)
-      ercMsg->setIgnored(false);
-
-    // scan approved items and set ignore attributes
-    foreach (const SExpression& node, root.getChildren("approved")) {
-      foreach (ErcMsg* ercMsg, mItems) {
-        if ((ercMsg->getOwner().getErcMsgOwnerClassName() ==
-             node.getValueByPath<QString>("class")) &&
-            (ercMsg->getOwnerKey() ==
-             node.getValueByPath<QString>("instance")) &&
-            (ercMsg->getMsgKey() == node.getValueByPath<QString>("message"))) {
-          ercMsg->setIgnored(true);
-        }
-      }
+    // collect all approved messages
+    QSet<QString> approved;
+    foreach (const SExpression* node, root.getChildren("approved")) {
+      approved.insert(
+          buildIgnoreKey(node->getValueByPath<QString>("class"),
+                         node->getValueByPath<QString>("instance"),
+                         node->getValueByPath<QString>("message")));
     }
+
+    // set ignore attributes
+    foreach (ErcMsg* ercMsg, mItems) {
+      ercMsg->setIgnored(approved.contains(
+          buildIgnoreKey(ercMsg->getOwner().getErcMsgOwnerClassName(),
+                         ercMsg->getOwnerKey(), ercMsg->getMsgKey())));
+    }
+
+    // the ignore state now matches the file
+    mIsModified = false;
   }
 }
 
 void ErcMsgList::save() {
-  SExpression doc(serializeToDomElement("librepcb_erc"));  // can throw
-  mProject.getDirectory().write("circuit/erc.lp",
-                                doc.toByteArray());  // can throw
+  updateScheduled();  // make sure all messages are up to date
+  if (mIsModified) {
+    SExpression doc(serializeToDomElement("librepcb_erc"));  // can throw
+    mProject.getDirectory().write("circuit/erc.lp",
+                                  doc.toByteArray());  // can throw
+    mIsModified = false;
+  }
+}
+
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept {
+  if (!mScheduledProvidersSet.contains(&provider)) {
+    mScheduledProvidersSet.insert(&provider);
+    mScheduledProviders.append(&provider);
+  }
+  mUpdateTimer.start();
+}
+
+void ErcMsgList::unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept {
+  if (mScheduledProvidersSet.remove(&provider)) {
+    mScheduledProviders.removeOne(&provider);
+  }
+}
+
+void ErcMsgList::updateScheduled() noexcept {
+  mUpdateTimer.stop();
+  QVector<IF_ErcMsgProvider*> providers;
+  providers.swap(mScheduledProviders);
+  mScheduledProvidersSet.clear();
+  foreach (IF_ErcMsgProvider* provider, providers) {
+    provider->updateErcMessages();
+  }
 }
 
 /*******************************************************************************
@@ -112,15 +150,29 @@ void ErcMsgList::save() {
  ******************************************************************************/
 
 void ErcMsgList::serialize(SExpression& root) const {
-  foreach (ErcMsg* ercMsg, mItems) {
+  // sort messages to get a deterministic file content
+  QMap<QString, const ErcMsg*> ignored;
+  foreach (const ErcMsg* ercMsg, mItems) {
     if (ercMsg->isIgnored()) {
-      SExpression& itemNode = root.appendList("approved", true);
-      itemNode.appendChild<QString>(
-          "class", ercMsg->getOwner().getErcMsgOwnerClassName(), true);
-      itemNode.appendChild("instance", ercMsg->getOwnerKey(), true);
-      itemNode.appendChild("message", ercMsg->getMsgKey(), true);
+      ignored.insert(
+          buildIgnoreKey(ercMsg->getOwner().getErcMsgOwnerClassName(),
+                         ercMsg->getOwnerKey(), ercMsg->getMsgKey()),
+          ercMsg);
     }
   }
+  foreach (const ErcMsg* ercMsg, ignored) {
+    SExpression& itemNode = root.appendList("approved", true);
+    itemNode.appendChild<QString>(
+        "class", ercMsg->getOwner().getErcMsgOwnerClassName(), true);
+    itemNode.appendChild("instance", ercMsg->getOwnerKey(), true);
+    itemNode.appendChild("message", ercMsg->getMsgKey(), true);
+  }
+}
+
+QString ErcMsgList::buildIgnoreKey(const QString& ownerClass,
+                                   const QString& ownerKey,
+                                   const QString& msgKey) noexcept {
+  return ownerClass % QChar('\n') % ownerKey % QChar('\n') % msgKey;
 }
 
 /*******************************************************************************
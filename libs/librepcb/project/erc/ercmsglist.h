@@ -37,6 +37,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*******************************************************************************
  *  Class ErcMsgList
@@ -57,7 +58,11 @@ public:
   ~ErcMsgList() noexcept;
 
   // Getters
-  const QList<ErcMsg*>& getItems() const noexcept { return mItems; }
+  const QSet<ErcMsg*>& getItems() const noexcept { return mItems; }
+  bool                 isModified() const noexcept { return mIsModified; }
+
+  // Setters
+  void setModified() noexcept { mIsModified = true; }
 
   // General Methods
   void add(ErcMsg* ercMsg) noexcept;
@@ -66,6 +71,25 @@ public:
   void restoreIgnoreState();
   void save();
 
+  /**
+   * @brief Schedule a deferred re-evaluation of the messages of a provider
+   *
+   * Many modifications (e.g. of a command group) mark the same providers as
+   * dirty over and over again. Instead of re-evaluating the messages after
+   * each of them, the dirty providers are collected and evaluated once when
+   * the event loop is entered again (or on #updateScheduled()).
+   *
+   * @param provider    The provider whose messages need to be updated. It
+   *                    must call #unscheduleUpdate() before it is destroyed.
+   */
+  void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+  void unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+
+  /**
+   * @brief Immediately update all providers scheduled with #scheduleUpdate()
+   */
+  void updateScheduled() noexcept;
+
   // Operator Overloadings
   ErcMsgList& operator=(const ErcMsgList& rhs) = delete;
 
@@ -78,12 +102,21 @@ signals:
 private:  // Methods
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
+  static QString buildIgnoreKey(const QString& ownerClass,
+                                const QString& ownerKey,
+                                const QString& msgKey) noexcept;
 
   // General
   Project& mProject;
 
   // Misc
-  QList<ErcMsg*> mItems;  ///< contains all visible ERC messages
+  QSet<ErcMsg*> mItems;       ///< contains all visible ERC messages
+  bool          mIsModified;  ///< whether #save() needs to write the file
+
+  // Deferred Updates
+  QVector<IF_ErcMsgProvider*> mScheduledProviders;  ///< in scheduling order
+  QSet<IF_ErcMsgProvider*>    mScheduledProvidersSet;
+  QTimer                      mUpdateTimer;
 };
 
 /*******************************************************************************
@@ -64,6 +64,14 @@ public:
 
   // Getters
   virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+  /**
+   * @brief Re-evaluate all ERC messages of this provider
+   *
+   * Called by librepcb::project::ErcMsgList for providers which scheduled a
+   * deferred update with librepcb::project::ErcMsgList::scheduleUpdate().
+   */
+  virtual void updateErcMessages() noexcept {}
 };
 
 /*******************************************************************************
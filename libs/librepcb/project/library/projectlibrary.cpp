@@ -49,15 +49,15 @@ using namespace library;
 
 ProjectLibrary::ProjectLibrary(
     std::unique_ptr<TransactionalDirectory> directory)
-  : mDirectory(std::move(directory)) {
+  : mDirectory(std::move(directory)), mUpgradePendingElements(true) {
   qDebug() << "load project library...";
 
   try {
-    // Load all library elements
-    loadElements<Symbol>("sym", "symbols", mSymbols);
-    loadElements<Package>("pkg", "packages", mPackages);
-    loadElements<Component>("cmp", "components", mComponents);
-    loadElements<Device>("dev", "devices", mDevices);
+    // Index all library elements, they are loaded when they are needed
+    indexElements<Symbol>("sym", "symbols", mSymbols);
+    indexElements<Package>("pkg", "packages", mPackages);
+    indexElements<Component>("cmp", "components", mComponents);
+    indexElements<Device>("dev", "devices", mDevices);
   } catch (const Exception&) {
     qDeleteAll(mAllElements);
     mAllElements.clear();
@@ -74,14 +74,51 @@ ProjectLibrary::~ProjectLibrary() noexcept {
   mElementsToUpgrade.clear();
 }
 
+/*******************************************************************************
+ *  Getters: Library Elements
+ ******************************************************************************/
+
+const QHash<Uuid, library::Symbol*>& ProjectLibrary::getSymbols() const {
+  return getAllElements(mSymbols);  // can throw
+}
+
+const QHash<Uuid, library::Package*>& ProjectLibrary::getPackages() const {
+  return getAllElements(mPackages);  // can throw
+}
+
+const QHash<Uuid, library::Component*>& ProjectLibrary::getComponents()
+    const {
+  return getAllElements(mComponents);  // can throw
+}
+
+const QHash<Uuid, library::Device*>& ProjectLibrary::getDevices() const {
+  return getAllElements(mDevices);  // can throw
+}
+
+library::Symbol* ProjectLibrary::getSymbol(const Uuid& uuid) const {
+  return getElement(mSymbols, uuid);  // can throw
+}
+
+library::Package* ProjectLibrary::getPackage(const Uuid& uuid) const {
+  return getElement(mPackages, uuid);  // can throw
+}
+
+library::Component* ProjectLibrary::getComponent(const Uuid& uuid) const {
+  return getElement(mComponents, uuid);  // can throw
+}
+
+library::Device* ProjectLibrary::getDevice(const Uuid& uuid) const {
+  return getElement(mDevices, uuid);  // can throw
+}
+
 /*******************************************************************************
  *  Getters: Special Queries
  ******************************************************************************/
 
 QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(
-    const Uuid& compUuid) const noexcept {
+    const Uuid& compUuid) const {
   QHash<Uuid, library::Device*> list;
-  foreach (library::Device* device, mDevices) {
+  foreach (library::Device* device, getDevices()) {  // can throw
     if (device->getComponentUuid() == compUuid) {
       list.insert(device->getUuid(), device);
     }
@@ -89,6 +126,14 @@ QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(
   return list;
 }
 
+qint64 ProjectLibrary::getMemoryUsage() const noexcept {
+  qint64 usage = sizeof(ProjectLibrary);
+  foreach (const library::LibraryBaseElement* element, mAllElements) {
+    usage += element->getMemoryUsage();
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  Add/Remove Methods
  ******************************************************************************/
@@ -136,6 +181,13 @@ void ProjectLibrary::save() {
     element->save();  // can throw
     mElementsToUpgrade.remove(element);
   }
+  if (mUpgradePendingElements) {
+    upgradePendingElements(mSymbols);     // can throw
+    upgradePendingElements(mPackages);    // can throw
+    upgradePendingElements(mComponents);  // can throw
+    upgradePendingElements(mDevices);     // can throw
+    mUpgradePendingElements = false;
+  }
 }
 
 /*******************************************************************************
@@ -143,44 +195,108 @@ void ProjectLibrary::save() {
  ******************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList) {
+void ProjectLibrary::indexElements(const QString& dirname, const QString& type,
+                                   Elements<ElementType>& elements) {
   // search all subdirectories which have a valid UUID as directory name
+  QStringList unnamedDirs;
   foreach (const QString& sub, mDirectory->getDirs(dirname)) {
-    std::unique_ptr<TransactionalDirectory> dir(
-        new TransactionalDirectory(*mDirectory, dirname % "/" % sub));
+    QString dirpath = dirname % "/" % sub;
 
     // check if directory is a valid library element
-    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
+    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*mDirectory,
+                                                                  dirpath)) {
       qWarning() << "Found an invalid directory in the library:"
-                 << dir->getAbsPath().toNative();
+                 << mDirectory->getAbsPath(dirpath).toNative();
       continue;
     }
 
-    // load the library element
+    // Elements are stored in directories named by their UUID, so they don't
+    // need to be loaded to know their UUID.
+    if (tl::optional<Uuid> uuid = Uuid::tryFromString(sub)) {
+      elements.pending.insert(*uuid, dirpath);
+    } else {
+      unnamedDirs.append(dirpath);
+    }
+  }
+
+  // directories with another name need to be loaded to get their UUID
+  foreach (const QString& dirpath, unnamedDirs) {
     QScopedPointer<ElementType> element(
-        new ElementType(std::move(dir)));  // can throw
-    if (elementList.contains(element->getUuid())) {
+        loadElement<ElementType>(dirpath));  // can throw
+    if (elements.loaded.contains(element->getUuid()) ||
+        elements.pending.contains(element->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There are multiple library elements with the same "
                      "UUID in the directory \"%1\""))
-              .arg(dir->getAbsPath().toNative()));
+              .arg(mDirectory->getAbsPath(dirpath).toNative()));
     }
-
-    // everything is ok -> update members
-    elementList.insert(element->getUuid(), element.data());
+    elements.loaded.insert(element->getUuid(), element.data());
     mElementsToUpgrade.insert(element.data());
     mAllElements.insert(element.take());  // Take object from smart pointer!
   }
 
-  qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
+  qDebug() << "successfully indexed"
+           << (elements.loaded.count() + elements.pending.count())
+           << qPrintable(type);
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::getElement(Elements<ElementType>& elements,
+                                        const Uuid&            uuid) const {
+  auto it = elements.pending.find(uuid);
+  if (it != elements.pending.end()) {
+    QScopedPointer<ElementType> element(
+        loadElement<ElementType>(*it));  // can throw
+    if (element->getUuid() != uuid) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("The library element in the directory \"%1\" has a "
+                     "different UUID than its directory name."))
+              .arg(mDirectory->getAbsPath(*it).toNative()));
+    }
+    elements.pending.erase(it);
+    elements.loaded.insert(uuid, element.data());
+    if (mUpgradePendingElements) {
+      mElementsToUpgrade.insert(element.data());
+    }
+    mAllElements.insert(element.take());  // Take object from smart pointer!
+  }
+  return elements.loaded.value(uuid);
+}
+
+template <typename ElementType>
+const QHash<Uuid, ElementType*>& ProjectLibrary::getAllElements(
+    Elements<ElementType>& elements) const {
+  foreach (const Uuid& uuid, elements.pending.keys()) {
+    getElement(elements, uuid);  // can throw
+  }
+  return elements.loaded;
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::loadElement(const QString& dirpath) const {
+  return new ElementType(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(*mDirectory, dirpath)));  // can throw
+}
+
+template <typename ElementType>
+void ProjectLibrary::upgradePendingElements(
+    const Elements<ElementType>& elements) {
+  // Only load the elements temporarily to keep the memory usage low if they
+  // are not used anyway.
+  foreach (const QString& dirpath, elements.pending) {
+    ElementType element(std::unique_ptr<TransactionalDirectory>(
+        new TransactionalDirectory(*mDirectory, dirpath)));  // can throw
+    element.save();                                          // can throw
+  }
 }
 
 template <typename ElementType>
-void ProjectLibrary::addElement(ElementType&               element,
-                                QHash<Uuid, ElementType*>& elementList) {
-  if (elementList.contains(element.getUuid())) {
+void ProjectLibrary::addElement(ElementType&           element,
+                                Elements<ElementType>& elements) {
+  if (elements.loaded.contains(element.getUuid()) ||
+      elements.pending.contains(element.getUuid())) {
     throw LogicError(__FILE__, __LINE__,
                      QString(tr("There is already an element with the same "
                                 "UUID in the project's library: %1"))
@@ -188,19 +304,19 @@ void ProjectLibrary::addElement(ElementType&               element,
   }
   TransactionalDirectory dir(*mDirectory, element.getShortElementName());
   element.saveIntoParentDirectory(dir);  // can throw
-  elementList.insert(element.getUuid(), &element);
+  elements.loaded.insert(element.getUuid(), &element);
   mAllElements.insert(&element);
 }
 
 template <typename ElementType>
-void ProjectLibrary::removeElement(ElementType&               element,
-                                   QHash<Uuid, ElementType*>& elementList) {
-  Q_ASSERT(elementList.value(element.getUuid()) == &element);
+void ProjectLibrary::removeElement(ElementType&           element,
+                                   Elements<ElementType>& elements) {
+  Q_ASSERT(elements.loaded.value(element.getUuid()) == &element);
   Q_ASSERT(mAllElements.contains(&element));
   TransactionalDirectory dir(
       TransactionalFileSystem::openRW(FilePath::getRandomTempPath()));
   element.moveIntoParentDirectory(dir);  // can throw
-  elementList.remove(element.getUuid());
+  elements.loaded.remove(element.getUuid());
 }
 
 /*******************************************************************************
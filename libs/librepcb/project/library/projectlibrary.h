@@ -54,6 +54,11 @@ class Project;
 
 /**
  * @brief The ProjectLibrary class
+ *
+ * When opening a project, only the directories of its library elements are
+ * indexed. An element is parsed the first time it is requested, so the time
+ * to open a project and its memory usage depend only on the elements which
+ * are actually used.
  */
 class ProjectLibrary final : public QObject {
   Q_OBJECT
@@ -64,34 +69,59 @@ public:
   ~ProjectLibrary() noexcept;
 
   // Getters: Library Elements
-  const QHash<Uuid, library::Symbol*>& getSymbols() const noexcept {
-    return mSymbols;
-  }
-  const QHash<Uuid, library::Package*>& getPackages() const noexcept {
-    return mPackages;
-  }
-  const QHash<Uuid, library::Component*>& getComponents() const noexcept {
-    return mComponents;
-  }
-  const QHash<Uuid, library::Device*>& getDevices() const noexcept {
-    return mDevices;
-  }
-  library::Symbol* getSymbol(const Uuid& uuid) const noexcept {
-    return mSymbols.value(uuid);
-  }
-  library::Package* getPackage(const Uuid& uuid) const noexcept {
-    return mPackages.value(uuid);
-  }
-  library::Component* getComponent(const Uuid& uuid) const noexcept {
-    return mComponents.value(uuid);
-  }
-  library::Device* getDevice(const Uuid& uuid) const noexcept {
-    return mDevices.value(uuid);
+
+  /**
+   * @brief Get all library elements of a specific type
+   *
+   * @note These methods load all elements which are not loaded yet, so they
+   *       should only be used if really all elements are needed.
+   *
+   * @return All elements of the corresponding type
+   *
+   * @throw Exception if an element could not be loaded
+   */
+  const QHash<Uuid, library::Symbol*>&    getSymbols() const;
+  const QHash<Uuid, library::Package*>&   getPackages() const;
+  const QHash<Uuid, library::Component*>& getComponents() const;
+  const QHash<Uuid, library::Device*>&    getDevices() const;
+
+  /**
+   * @brief Get all symbols which are already loaded
+   *
+   * Same as #getSymbols(), but without loading any symbols.
+   *
+   * @return All loaded symbols
+   */
+  const QHash<Uuid, library::Symbol*>& getLoadedSymbols() const noexcept {
+    return mSymbols.loaded;
   }
 
+  /**
+   * @brief Get a library element by its UUID
+   *
+   * The element is loaded on the first call.
+   *
+   * @param uuid  UUID of the element
+   *
+   * @return The element, or nullptr if there is no such element
+   *
+   * @throw Exception if the element could not be loaded
+   */
+  library::Symbol*    getSymbol(const Uuid& uuid) const;
+  library::Package*   getPackage(const Uuid& uuid) const;
+  library::Component* getComponent(const Uuid& uuid) const;
+  library::Device*    getDevice(const Uuid& uuid) const;
+
   // Getters: Special Queries
   QHash<Uuid, library::Device*> getDevicesOfComponent(
-      const Uuid& compUuid) const noexcept;
+      const Uuid& compUuid) const;
+
+  /**
+   * @brief Get the (estimated) memory usage of all loaded library elements
+   *
+   * @return Memory usage in bytes
+   */
+  qint64 getMemoryUsage() const noexcept;
 
   // Add/Remove Methods
   void addSymbol(library::Symbol& s);
@@ -112,27 +142,46 @@ private:
   ProjectLibrary(const ProjectLibrary& other);
   ProjectLibrary& operator=(const ProjectLibrary& rhs);
 
+  // Private Types
+  template <typename ElementType>
+  struct Elements {
+    QHash<Uuid, ElementType*> loaded;
+    QHash<Uuid, QString>      pending;  ///< Directories of unloaded elements
+  };
+
   // Private Methods
   template <typename ElementType>
-  void loadElements(const QString& dirname, const QString& type,
-                    QHash<Uuid, ElementType*>& elementList);
+  void indexElements(const QString& dirname, const QString& type,
+                     Elements<ElementType>& elements);
+  template <typename ElementType>
+  ElementType* getElement(Elements<ElementType>& elements,
+                          const Uuid&            uuid) const;
   template <typename ElementType>
-  void addElement(ElementType& element, QHash<Uuid, ElementType*>& elementList);
+  const QHash<Uuid, ElementType*>& getAllElements(
+      Elements<ElementType>& elements) const;
   template <typename ElementType>
-  void removeElement(ElementType&               element,
-                     QHash<Uuid, ElementType*>& elementList);
+  ElementType* loadElement(const QString& dirpath) const;
+  template <typename ElementType>
+  void upgradePendingElements(const Elements<ElementType>& elements);
+  template <typename ElementType>
+  void addElement(ElementType& element, Elements<ElementType>& elements);
+  template <typename ElementType>
+  void removeElement(ElementType& element, Elements<ElementType>& elements);
 
   // General
   std::unique_ptr<TransactionalDirectory> mDirectory;
 
-  // The currently added library elements
-  QHash<Uuid, library::Symbol*>    mSymbols;
-  QHash<Uuid, library::Package*>   mPackages;
-  QHash<Uuid, library::Component*> mComponents;
-  QHash<Uuid, library::Device*>    mDevices;
+  // The currently added library elements (loaded on demand, thus mutable)
+  mutable Elements<library::Symbol>    mSymbols;
+  mutable Elements<library::Package>   mPackages;
+  mutable Elements<library::Component> mComponents;
+  mutable Elements<library::Device>    mDevices;
+
+  mutable QSet<library::LibraryBaseElement*> mAllElements;
+  mutable QSet<library::LibraryBaseElement*> mElementsToUpgrade;
 
-  QSet<library::LibraryBaseElement*> mAllElements;
-  QSet<library::LibraryBaseElement*> mElementsToUpgrade;
+  /// Whether the pending elements still need a file format upgrade
+  bool mUpgradePendingElements;
 };
 
 /*******************************************************************************
@@ -36,8 +36,12 @@
 #include <librepcb/common/fileio/directorylock.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/fileio/versionfile.h>
 #include <librepcb/common/font/strokefontpool.h>
+#include <librepcb/common/scopeguard.h>
+#include <librepcb/common/utils/profiler.h>
+#include <librepcb/common/utils/taskscheduler.h>
 
 #include <QPrinter>
 #include <QtCore>
@@ -53,11 +57,14 @@ namespace project {
  ******************************************************************************/
 
 Project::Project(std::unique_ptr<TransactionalDirectory> directory,
-                 const QString& filename, bool create)
+                 const QString& filename, bool create, bool lazyBoards,
+                 bool headless)
   : QObject(nullptr),
     AttributeProvider(),
     mDirectory(std::move(directory)),
-    mFilename(filename) {
+    mFilename(filename),
+    mHeadless(headless) {
+  Profiler::Scope scope("project '%1': load", mFilename);
   qDebug() << (create ? "create project:" : "open project:")
            << getFilepath().toNative();
 
@@ -67,6 +74,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
                        tr("The suffix of the project file must be \"lpp\"!"));
   }
 
+  bool upgradeFileFormat = false;
   if (create) {
     // Check if there isn't already a project in the selected directory
     if (mDirectory->fileExists(".librepcb-project") ||
@@ -104,6 +112,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
               .arg(version.toPrettyStr(3))
               .arg(getFilepath().toNative()));
     }
+    upgradeFileFormat = (version < qApp->getFileFormatVersion());
   }
 
   // OK - the project is locked (or read-only) and can be opened!
@@ -144,9 +153,62 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
       mProjectMetadata.reset(new ProjectMetadata(root));
     }
 
+    // Start reading and parsing all schematic and board files in worker
+    // threads, this is independent of the other project data loaded below.
+    // The directories are owned by this thread until the objects get created,
+    // and the scope guard makes sure no worker accesses them after they have
+    // been destroyed (e.g. if an exception is thrown in the meantime).
+    std::vector<std::unique_ptr<TransactionalDirectory>> schematicDirs;
+    std::vector<std::unique_ptr<TransactionalDirectory>> boardDirs;
+    QList<QFuture<SExpression>>                          schematicFutures;
+    QList<QFuture<SExpression>>                          boardFutures;
+    auto waitForFutures = scopeGuard([&]() {
+      foreach (QFuture<SExpression> future, schematicFutures + boardFutures) {
+        try {
+          future.waitForFinished();
+        } catch (...) {
+          // errors are handled where the result is used
+        }
+      }
+    });
+    if (!create) {
+      QString     fp = "schematics/schematics.lp";
+      SExpression schRoot =
+          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
+      foreach (const SExpression* node, schRoot.getChildren("schematic")) {
+        FilePath fp = FilePath::fromRelative(
+            getPath(), node->getValueOfFirstChild<QString>());
+        TransactionalDirectory* dir = new TransactionalDirectory(
+            *mDirectory, fp.getParentDir().toRelative(getPath()));
+        schematicDirs.emplace_back(dir);
+        schematicFutures.append(
+            TaskScheduler::run(TaskScheduler::Priority::Background,
+                               [dir]() { return Schematic::parseFile(*dir); }));
+      }
+    }
+    if (!create) {
+      QString     fp = "boards/boards.lp";
+      SExpression brdRoot =
+          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
+      foreach (const SExpression* node, brdRoot.getChildren("board")) {
+        FilePath fp = FilePath::fromRelative(
+            getPath(), node->getValueOfFirstChild<QString>());
+        TransactionalDirectory* dir = new TransactionalDirectory(
+            *mDirectory, fp.getParentDir().toRelative(getPath()));
+        boardDirs.emplace_back(dir);
+        boardFutures.append(
+            TaskScheduler::run(TaskScheduler::Priority::Background,
+                               [dir]() { return Board::parseFile(*dir); }));
+      }
+    }
+
     // Create all needed objects
-    connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged, this,
+    mAttributesChangedTimer.setSingleShot(true);
+    mAttributesChangedTimer.setInterval(0);
+    connect(&mAttributesChangedTimer, &QTimer::timeout, this,
             &Project::attributesChanged);
+    connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged, this,
+            &Project::scheduleAttributesChanged);
     mProjectSettings.reset(new ProjectSettings(*this, create));
     mProjectLibrary.reset(
         new ProjectLibrary(std::unique_ptr<TransactionalDirectory>(
@@ -157,33 +219,23 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     // Load all schematic layers
     mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
 
-    // Load all schematics
+    // Load all schematics (in the same order as listed in the file)
     if (!create) {
-      QString     fp = "schematics/schematics.lp";
-      SExpression schRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
-      foreach (const SExpression& node, schRoot.getChildren("schematic")) {
-        FilePath fp = FilePath::fromRelative(
-            getPath(), node.getValueOfFirstChild<QString>());
-        std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
-            *mDirectory, fp.getParentDir().toRelative(getPath())));
-        Schematic* schematic = new Schematic(*this, std::move(dir));
+      for (int i = 0; i < schematicFutures.count(); ++i) {
+        SExpression root = schematicFutures[i].result();  // can throw
+        Schematic*  schematic =
+            new Schematic(*this, std::move(schematicDirs[i]), root);
         addSchematic(*schematic);
       }
       qDebug() << mSchematics.count() << "schematics successfully loaded!";
     }
 
-    // Load all boards
+    // Load all boards (in the same order as listed in the file)
     if (!create) {
-      QString     fp = "boards/boards.lp";
-      SExpression brdRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
-      foreach (const SExpression& node, brdRoot.getChildren("board")) {
-        FilePath fp = FilePath::fromRelative(
-            getPath(), node.getValueOfFirstChild<QString>());
-        std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
-            *mDirectory, fp.getParentDir().toRelative(getPath())));
-        Board* board = new Board(*this, std::move(dir));
+      for (int i = 0; i < boardFutures.count(); ++i) {
+        SExpression root  = boardFutures[i].result();  // can throw
+        Board*      board =
+            new Board(*this, std::move(boardDirs[i]), root, lazyBoards);
         addBoard(*board);
       }
       qDebug() << mBoards.count() << "boards successfully loaded!";
@@ -195,6 +247,9 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     // the file.
     mErcMsgList->restoreIgnoreState();  // can throw
 
+    // files of an older file format must all be written on the next save
+    if (upgradeFileFormat) setAllModified();
+
     if (create) save();  // write all files to file system
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
@@ -310,7 +365,7 @@ void Project::addSchematic(Schematic& schematic, int newIndex) {
   }
 
   emit schematicAdded(newIndex);
-  emit attributesChanged();
+  scheduleAttributesChanged();
 }
 
 void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
@@ -332,7 +387,7 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
   mSchematics.removeAt(index);
 
   emit schematicRemoved(index);
-  emit attributesChanged();
+  scheduleAttributesChanged();
 
   if (deleteSchematic) {
     delete &schematic;
@@ -363,8 +418,10 @@ void Project::printSchematicPages(QPrinter& printer, QList<int>& pages) {
   if (pages.isEmpty())
     throw RuntimeError(__FILE__, __LINE__, tr("No schematic pages selected."));
 
-  QPainter painter(&printer);
-
+  // Note: QGraphicsScene::render() is only supported in the GUI thread, so the
+  // pages are rendered one after another.
+  const QRectF target(0, 0, printer.width(), printer.height());
+  QPainter     painter(&printer);
   for (int i = 0; i < pages.count(); i++) {
     Schematic* schematic = getSchematicByIndex(pages[i]);
     if (!schematic) {
@@ -373,8 +430,11 @@ void Project::printSchematicPages(QPrinter& printer, QList<int>& pages) {
           QString(tr("No schematic page with the index %1 found."))
               .arg(pages[i]));
     }
+    Profiler::Scope scope("schematic '%1': print page", *schematic->getName());
+    schematic->buildGraphicsItems();
     schematic->clearSelection();
-    schematic->renderToQPainter(painter);
+    schematic->renderToQPainter(painter, target,
+                                schematic->getGraphicsItemsBoundingRect());
 
     if (i != pages.count() - 1) {
       if (!printer.newPage()) {
@@ -470,7 +530,7 @@ void Project::addBoard(Board& board, int newIndex) {
   }
 
   emit boardAdded(newIndex);
-  emit attributesChanged();
+  scheduleAttributesChanged();
 }
 
 void Project::removeBoard(Board& board, bool deleteBoard) {
@@ -485,7 +545,7 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
   mBoards.removeAt(index);
 
   emit boardRemoved(index);
-  emit attributesChanged();
+  scheduleAttributesChanged();
 
   if (deleteBoard) {
     delete &board;
@@ -498,9 +558,12 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
  *  General Methods
  ******************************************************************************/
 
-void Project::save() {
+void Project::save(bool all) {
+  Profiler::Scope scope("project '%1': serialize", mFilename);
   qDebug() << "Save project files to transactional file system...";
 
+  if (all) setAllModified();
+
   // Save version file
   mDirectory->write(
       ".librepcb-project",
@@ -566,6 +629,38 @@ void Project::save() {
   mProjectMetadata->updateLastModified();
 }
 
+QList<QPair<QString, qint64>> Project::getMemoryUsage() const noexcept {
+  QList<QPair<QString, qint64>> usage;
+  usage.append(qMakePair(tr("File System"),
+                         mDirectory->getFileSystem()->getMemoryUsage()));
+  usage.append(qMakePair(tr("Library"), mProjectLibrary->getMemoryUsage()));
+  foreach (const Schematic* schematic, mSchematics) {
+    usage.append(qMakePair(tr("Schematic '%1'").arg(*schematic->getName()),
+                           schematic->getMemoryUsage()));
+  }
+  foreach (const Board* board, mBoards) {
+    usage.append(qMakePair(tr("Board '%1'").arg(*board->getName()),
+                           board->getMemoryUsage()));
+  }
+  return usage;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void Project::setAllModified() noexcept {
+  mProjectSettings->setModified();
+  mCircuit->setModified();
+  mErcMsgList->setModified();
+  foreach (Schematic* schematic, mSchematics) { schematic->setModified(); }
+  foreach (Board* board, mBoards) { board->setModified(); }
+}
+
+void Project::scheduleAttributesChanged() noexcept {
+  mAttributesChangedTimer.start();  // restarting does not emit twice
+}
+
 /*******************************************************************************
  *  Inherited from AttributeProvider
  ******************************************************************************/
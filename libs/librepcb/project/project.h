@@ -90,12 +90,22 @@ public:
    * @param filepath      The filepath to the an existing *.lpp project file
    * @param readOnly      It true, the project will be opened in read-only mode
    * @param interactive   If true, message boxes may be shown.
+   * @param lazyBoards    If true, the items of the boards are not loaded until
+   *                      Board::load() is called (see Board::isLoaded()).
+   *                      This speeds up opening projects with many boards if
+   *                      only some of them are needed. But the project must
+   *                      not be modified as long as there are unloaded boards.
+   * @param headless      If true, no graphics items are created for the items
+   *                      of the boards (see Board::isHeadless()). This saves
+   *                      a lot of time and memory if the boards are not
+   *                      displayed at all, e.g. for exporting Gerber files.
    *
    * @throw Exception     If the project could not be opened successfully
    */
   Project(std::unique_ptr<TransactionalDirectory> directory,
-          const QString&                          filename)
-    : Project(std::move(directory), filename, false) {}
+          const QString& filename, bool lazyBoards = false,
+          bool headless = false)
+    : Project(std::move(directory), filename, false, lazyBoards, headless) {}
 
   /**
    * @brief The destructor will close the whole project (without saving!)
@@ -126,6 +136,13 @@ public:
 
   TransactionalDirectory& getDirectory() noexcept { return *mDirectory; }
 
+  /**
+   * @brief Check whether the project was opened in headless mode
+   *
+   * @return True if boards don't create any graphics items
+   */
+  bool isHeadless() const noexcept { return mHeadless; }
+
   /**
    * @brief Get the StrokeFontPool which contains all stroke fonts of the
    * project
@@ -382,9 +399,28 @@ public:
   /**
    * @brief Save the project to the transactional file system
    *
+   * Schematics, boards, the circuit, the ERC messages and the settings keep
+   * track of whether they were modified since the last save, and only the
+   * files of modified objects are serialized again.
+   *
+   * @param all           If true, all files are written, even those of
+   *                      unmodified objects (e.g. to upgrade them to the
+   *                      current file format).
+   *
    * @throw Exception     If an error occured.
    */
-  void save();
+  void save(bool all = false);
+
+  /**
+   * @brief Get the (estimated) memory usage of the parts of this project
+   *
+   * The estimates are intended for diagnostics only, e.g. to find out which
+   * part of a big project needs most memory. Removed schematics and boards
+   * (which are only kept for undo) are not listed.
+   *
+   * @return Pairs of a (translated) part name and its memory usage in bytes
+   */
+  QList<QPair<QString, qint64>> getMemoryUsage() const noexcept;
 
   // Inherited from AttributeProvider
   /// @copydoc librepcb::AttributeProvider::getUserDefinedAttributeValue()
@@ -401,7 +437,7 @@ public:
 
   static Project* create(std::unique_ptr<TransactionalDirectory> directory,
                          const QString&                          filename) {
-    return new Project(std::move(directory), filename, true);
+    return new Project(std::move(directory), filename, true, false, false);
   }
 
   static bool    isFilePathInsideProjectDirectory(const FilePath& fp) noexcept;
@@ -461,10 +497,26 @@ private:
    * @todo Remove interactive message boxes, should be done at a higher layer!
    */
   explicit Project(std::unique_ptr<TransactionalDirectory> directory,
-                   const QString& filename, bool create);
+                   const QString& filename, bool create, bool lazyBoards,
+                   bool headless);
+
+  /**
+   * @brief Mark all files as modified, so the next #save() writes all of them
+   */
+  void setAllModified() noexcept;
+
+  /**
+   * @brief Emit #attributesChanged() once in the next event loop iteration
+   *
+   * Since this signal updates all texts of all boards and schematics, calling
+   * this function several times (e.g. for every modified metadata property
+   * of an undo command) leads to only one update.
+   */
+  void scheduleAttributesChanged() noexcept;
 
   std::unique_ptr<TransactionalDirectory> mDirectory;
   QString mFilename;  ///< the name of the *.lpp project file
+  bool    mHeadless;  ///< no graphics items for board items
 
   // General
   QScopedPointer<StrokeFontPool>
@@ -490,7 +542,8 @@ private:
   QList<Board*> mBoards;                  ///< All boards of this project
   QList<Board*> mRemovedBoards;  ///< All removed boards of this project
   QScopedPointer<AttributeList>
-      mAttributes;  ///< all attributes in a specific order
+         mAttributes;  ///< all attributes in a specific order
+  QTimer mAttributesChangedTimer;  ///< see #scheduleAttributesChanged()
 };
 
 /*******************************************************************************
@@ -10,7 +10,7 @@ TARGET = librepcbproject
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -22,11 +22,14 @@ INCLUDEPATH += \
 SOURCES += \
     boards/board.cpp \
     boards/boardairwiresbuilder.cpp \
+    boards/boardassemblyexport.cpp \
+    boards/boarddesignrulecheck.cpp \
     boards/boardfabricationoutputsettings.cpp \
     boards/boardgerberexport.cpp \
     boards/boardlayerstack.cpp \
     boards/boardplanefragmentsbuilder.cpp \
     boards/boardselectionquery.cpp \
+    boards/boardspatialindex.cpp \
     boards/boardusersettings.cpp \
     boards/cmd/cmdboardadd.cpp \
     boards/cmd/cmdboarddesignrulesmodify.cpp \
@@ -56,7 +59,7 @@ SOURCES += \
     boards/cmd/cmdfootprintstroketextadd.cpp \
     boards/cmd/cmdfootprintstroketextremove.cpp \
     boards/cmd/cmdfootprintstroketextsreset.cpp \
-    boards/graphicsitems/bgi_airwire.cpp \
+    boards/graphicsitems/bgi_airwires.cpp \
     boards/graphicsitems/bgi_base.cpp \
     boards/graphicsitems/bgi_footprint.cpp \
     boards/graphicsitems/bgi_footprintpad.cpp \
@@ -64,7 +67,6 @@ SOURCES += \
     boards/graphicsitems/bgi_netpoint.cpp \
     boards/graphicsitems/bgi_plane.cpp \
     boards/graphicsitems/bgi_via.cpp \
-    boards/items/bi_airwire.cpp \
     boards/items/bi_base.cpp \
     boards/items/bi_device.cpp \
     boards/items/bi_footprint.cpp \
@@ -137,11 +139,14 @@ SOURCES += \
 HEADERS += \
     boards/board.h \
     boards/boardairwiresbuilder.h \
+    boards/boardassemblyexport.h \
+    boards/boarddesignrulecheck.h \
     boards/boardfabricationoutputsettings.h \
     boards/boardgerberexport.h \
     boards/boardlayerstack.h \
     boards/boardplanefragmentsbuilder.h \
     boards/boardselectionquery.h \
+    boards/boardspatialindex.h \
     boards/boardusersettings.h \
     boards/cmd/cmdboardadd.h \
     boards/cmd/cmdboarddesignrulesmodify.h \
@@ -171,7 +176,7 @@ HEADERS += \
     boards/cmd/cmdfootprintstroketextadd.h \
     boards/cmd/cmdfootprintstroketextremove.h \
     boards/cmd/cmdfootprintstroketextsreset.h \
-    boards/graphicsitems/bgi_airwire.h \
+    boards/graphicsitems/bgi_airwires.h \
     boards/graphicsitems/bgi_base.h \
     boards/graphicsitems/bgi_footprint.h \
     boards/graphicsitems/bgi_footprintpad.h \
@@ -179,7 +184,6 @@ HEADERS += \
     boards/graphicsitems/bgi_netpoint.h \
     boards/graphicsitems/bgi_plane.h \
     boards/graphicsitems/bgi_via.h \
-    boards/items/bi_airwire.h \
     boards/items/bi_base.h \
     boards/items/bi_device.h \
     boards/items/bi_footprint.h \
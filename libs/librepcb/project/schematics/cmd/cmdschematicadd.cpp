@@ -67,6 +67,7 @@ void CmdSchematicAdd::performUndo() {
 
 void CmdSchematicAdd::performRedo() {
   mProject.addSchematic(*mSchematic, mPageIndex);  // can throw
+  mSchematic->setModified();
 }
 
 /*******************************************************************************
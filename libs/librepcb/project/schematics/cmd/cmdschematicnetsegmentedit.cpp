@@ -23,6 +23,7 @@
 #include "cmdschematicnetsegmentedit.h"
 
 #include "../items/si_netsegment.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -68,10 +69,12 @@ bool CmdSchematicNetSegmentEdit::performExecute() {
 
 void CmdSchematicNetSegmentEdit::performUndo() {
   mNetSegment.setNetSignal(*mOldNetSignal);  // can throw
+  mNetSegment.getSchematic().setModified();
 }
 
 void CmdSchematicNetSegmentEdit::performRedo() {
   mNetSegment.setNetSignal(*mNewNetSignal);  // can throw
+  mNetSegment.getSchematic().setModified();
 }
 
 /*******************************************************************************
@@ -62,6 +62,7 @@ bool CmdSchematicRemove::performExecute() {
 
 void CmdSchematicRemove::performUndo() {
   mProject.addSchematic(mSchematic, mPageIndex);  // can throw
+  mSchematic.setModified();
 }
 
 void CmdSchematicRemove::performRedo() {
@@ -22,6 +22,9 @@
  ******************************************************************************/
 #include "sgi_base.h"
 
+#include <librepcb/common/utils/performancecounters.h>
+
+#include <QPrinter>
 #include <QtCore>
 
 /*******************************************************************************
@@ -35,11 +38,25 @@ namespace project {
  ******************************************************************************/
 
 SGI_Base::SGI_Base() noexcept {
+  PerformanceCounters::add(PerformanceCounters::Counter::GraphicsItemsCreated);
 }
 
 SGI_Base::~SGI_Base() noexcept {
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+bool SGI_Base::isPrinting(const QPainter& painter) noexcept {
+  return (dynamic_cast<QPrinter*>(painter.device()) != nullptr);
+}
+
+bool SGI_Base::isInvisible(const QPainter& painter) noexcept {
+  return (painter.pen().style() == Qt::NoPen) &&
+         (painter.brush().style() == Qt::NoBrush);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -47,6 +47,30 @@ public:
   explicit SGI_Base() noexcept;
   virtual ~SGI_Base() noexcept;
 
+  // Static Methods
+
+  /**
+   * @brief Check whether a painter paints a printed page (e.g. a PDF export)
+   *
+   * @param painter   The painter passed to QGraphicsItem::paint()
+   *
+   * @return True if the painter paints a printed page
+   */
+  static bool isPrinting(const QPainter& painter) noexcept;
+
+  /**
+   * @brief Check whether the current pen and brush of a painter are both empty
+   *
+   * Drawing primitives with such a painter has no visible effect, but still
+   * produces output on vector devices like PDF files or QPictures, thus such
+   * primitives should be skipped.
+   *
+   * @param painter   The painter to check
+   *
+   * @return True if neither outlines nor areas would be visible
+   */
+  static bool isInvisible(const QPainter& painter) noexcept;
+
 private:
   // make some methods inaccessible...
   // SGI_Base() = delete;
@@ -117,7 +117,7 @@ void SGI_NetLabel::paint(QPainter*                       painter,
                          const QStyleOptionGraphicsItem* option,
                          QWidget*                        widget) {
   Q_UNUSED(widget);
-  bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  bool deviceIsPrinter = isPrinting(*painter);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
 
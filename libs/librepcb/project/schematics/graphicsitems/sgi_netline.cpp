@@ -80,6 +80,9 @@ void SGI_NetLine::updateCacheAndRepaint() noexcept {
   UnsignedLength width = qMax(mNetLine.getWidth(), UnsignedLength(1270000));
   ps.setWidth(width->toPx());
   mShape = ps.createStroke(mShape);
+  // the grab area may be wider than the line, but must be within the bounding
+  // rect to be found by the index of the graphics scene
+  mBoundingRect = mBoundingRect.united(mShape.boundingRect());
   update();
 }
 
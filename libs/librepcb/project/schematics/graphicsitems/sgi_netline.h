@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "sgi_base.h"
 
+#include <librepcb/common/utils/objectpool.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -61,6 +63,14 @@ public:
   void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                      QWidget* widget);
 
+  // Operator Overloadings
+  static void* operator new(std::size_t size) {
+    return ObjectPool<SGI_NetLine>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<SGI_NetLine>::deallocate(p, size);
+  }
+
 private:
   // make some methods inaccessible...
   SGI_NetLine()                         = delete;
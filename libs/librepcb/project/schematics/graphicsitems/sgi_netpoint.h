@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "sgi_base.h"
 
+#include <librepcb/common/utils/objectpool.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -60,6 +62,14 @@ public:
   void   paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                QWidget* widget);
 
+  // Operator Overloadings
+  static void* operator new(std::size_t size) {
+    return ObjectPool<SGI_NetPoint>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<SGI_NetPoint>::deallocate(p, size);
+  }
+
 private:
   // make some methods inaccessible...
   SGI_NetPoint()                          = delete;
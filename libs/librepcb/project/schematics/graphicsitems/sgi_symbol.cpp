@@ -34,6 +34,7 @@
 #include <librepcb/library/sym/symbol.h>
 
 #include <QPrinter>
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -64,116 +65,25 @@ SGI_Symbol::~SGI_Symbol() noexcept {
  ******************************************************************************/
 
 void SGI_Symbol::updateCacheAndRepaint() noexcept {
-  prepareGeometryChange();
-
-  mBoundingRect = QRectF();
-
-  mShape = QPainterPath();
-  mShape.setFillRule(Qt::WindingFill);
-
-  // cross rect
-  QRectF crossRect(-4, -4, 8, 8);
-  mBoundingRect = mBoundingRect.united(crossRect);
-  mShape.addRect(crossRect);
-
-  // polygons
-  for (const Polygon& polygon : mLibSymbol.getPolygons()) {
-    // query polygon path and line width
-    QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
-    qreal        w           = polygon.getLineWidth()->toPx() / 2;
-
-    // update bounding rectangle
-    mBoundingRect =
-        mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
+  applyCache(calcCache(getCacheInput()));
+}
 
-    // update shape
-    if (polygon.isGrabArea()) {
-      QPainterPathStroker stroker;
-      stroker.setCapStyle(Qt::RoundCap);
-      stroker.setJoinStyle(Qt::RoundJoin);
-      stroker.setWidth(2 * w);
-      // add polygon area
-      mShape = mShape.united(polygonPath);
-      // add stroke area
-      mShape = mShape.united(stroker.createStroke(polygonPath));
-    }
+void SGI_Symbol::updateCachesAndRepaint(
+    const QList<SGI_Symbol*>& items) noexcept {
+  // Note: Only the (expensive) geometry calculations are done in parallel,
+  // while the required data of the project and library elements get
+  // collected and the results get applied in the GUI thread since these
+  // objects are not thread-safe.
+  QVector<CacheInput> inputs;
+  inputs.reserve(items.count());
+  foreach (const SGI_Symbol* item, items) {
+    inputs.append(item->getCacheInput());
   }
-
-  // circles
-  for (const Circle& circle : mLibSymbol.getCircles()) {
-    // get circle radius, including compensation for the stroke width
-    qreal w = circle.getLineWidth()->toPx() / 2;
-    qreal r = circle.getDiameter()->toPx() / 2 + w;
-
-    // get the bounding rectangle for the circle
-    QPointF center = circle.getCenter().toPxQPointF();
-    QRectF  boundingRect =
-        QRectF(QPointF(center.x() - r, center.y() - r), QSizeF(r * 2, r * 2));
-
-    // update bounding rectangle
-    mBoundingRect = mBoundingRect.united(boundingRect);
-
-    // update shape
-    if (circle.isGrabArea()) {
-      mShape.addEllipse(circle.getCenter().toPxQPointF(), r, r);
-    }
+  QVector<Cache> caches = QtConcurrent::blockingMapped(
+      inputs, [](const CacheInput& input) { return calcCache(input); });
+  for (int i = 0; i < items.count(); ++i) {
+    items.at(i)->applyCache(caches.at(i));
   }
-
-  // texts
-  mCachedTextProperties.clear();
-  for (const Text& text : mLibSymbol.getTexts()) {
-    // create static text properties
-    CachedTextProperties_t props;
-
-    // get the text to display
-    props.text = AttributeSubstitutor::substitute(text.getText(), &mSymbol);
-
-    // calculate font metrics
-    props.fontPixelSize = qCeil(text.getHeight()->toPx());
-    mFont.setPixelSize(props.fontPixelSize);
-    QFontMetricsF metrics(mFont);
-    props.scaleFactor = text.getHeight()->toPx() / metrics.height();
-    props.textRect    = metrics.boundingRect(
-        QRectF(), text.getAlign().toQtAlign() | Qt::TextDontClip, props.text);
-    QRectF scaledTextRect =
-        QRectF(props.textRect.topLeft() * props.scaleFactor,
-               props.textRect.bottomRight() * props.scaleFactor);
-
-    // check rotation
-    Angle absAngle = text.getRotation() + mSymbol.getRotation();
-    absAngle.mapTo180deg();
-    props.mirrored = mSymbol.getMirrored();
-    if (!props.mirrored)
-      props.rotate180 =
-          (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
-    else
-      props.rotate180 =
-          (absAngle < -Angle::deg90() || absAngle >= Angle::deg90());
-
-    // calculate text position
-    scaledTextRect.translate(text.getPosition().toPxQPointF());
-
-    // text alignment
-    if (props.rotate180)
-      props.flags = text.getAlign().mirrored().toQtAlign();
-    else
-      props.flags = text.getAlign().toQtAlign();
-
-    // calculate text bounding rect
-    mBoundingRect  = mBoundingRect.united(scaledTextRect);
-    props.textRect = QRectF(scaledTextRect.topLeft() / props.scaleFactor,
-                            scaledTextRect.bottomRight() / props.scaleFactor);
-    if (props.rotate180) {
-      props.textRect = QRectF(-props.textRect.x(), -props.textRect.y(),
-                              -props.textRect.width(), -props.textRect.height())
-                           .normalized();
-    }
-
-    // save properties
-    mCachedTextProperties.insert(&text, props);
-  }
-
-  update();
 }
 
 /*******************************************************************************
@@ -185,10 +95,9 @@ void SGI_Symbol::paint(QPainter*                       painter,
                        QWidget*                        widget) {
   Q_UNUSED(widget);
 
-  const GraphicsLayer* layer    = 0;
-  const bool           selected = mSymbol.isSelected();
-  const bool           deviceIsPrinter =
-      (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const GraphicsLayer* layer           = 0;
+  const bool           selected        = mSymbol.isSelected();
+  const bool           deviceIsPrinter = isPrinting(*painter);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
 
@@ -218,8 +127,9 @@ void SGI_Symbol::paint(QPainter*                       painter,
                           ? QBrush(layer->getColor(selected), Qt::SolidPattern)
                           : Qt::NoBrush);
 
-    // draw polygon
-    painter->drawPath(polygon.getPath().toQPainterPathPx());
+    // draw polygon (skip invisible ones to keep exported files small)
+    if (isInvisible(*painter)) continue;
+    painter->drawPath(mCachedPolygonPaths.value(&polygon));
   }
 
   // draw all circles
@@ -248,7 +158,8 @@ void SGI_Symbol::paint(QPainter*                       painter,
                           ? QBrush(layer->getColor(selected), Qt::SolidPattern)
                           : Qt::NoBrush);
 
-    // draw circle
+    // draw circle (skip invisible ones to keep exported files small)
+    if (isInvisible(*painter)) continue;
     painter->drawEllipse(circle.getCenter().toPxQPointF(),
                          circle.getDiameter()->toPx() / 2,
                          circle.getDiameter()->toPx() / 2);
@@ -349,6 +260,150 @@ void SGI_Symbol::paint(QPainter*                       painter,
  *  Private Methods
  ******************************************************************************/
 
+SGI_Symbol::CacheInput SGI_Symbol::getCacheInput() const noexcept {
+  CacheInput input{&mLibSymbol, mFont, mSymbol.getRotation(),
+                   mSymbol.getMirrored(), {}, {}};
+  for (const Polygon& polygon : mLibSymbol.getPolygons()) {
+    // Note: QPainterPath caches its bounds lazily even in const methods, so
+    // worker threads must not access paths shared with other threads.
+    QPainterPath path;
+    path.addPath(polygon.getPath().toQPainterPathPx());  // deep copy
+    input.polygonPaths.insert(&polygon, path);
+  }
+  for (const Text& text : mLibSymbol.getTexts()) {
+    input.texts.insert(
+        &text, AttributeSubstitutor::substitute(text.getText(), &mSymbol));
+  }
+  return input;
+}
+
+SGI_Symbol::Cache SGI_Symbol::calcCache(const CacheInput& input) noexcept {
+  const library::Symbol& libSymbol = *input.libSymbol;
+  QFont                  font      = input.font;
+  Cache                  cache;
+
+  cache.shape.setFillRule(Qt::WindingFill);
+
+  // cross rect
+  QRectF crossRect(-4, -4, 8, 8);
+  cache.boundingRect = cache.boundingRect.united(crossRect);
+  cache.shape.addRect(crossRect);
+
+  // polygons
+  for (const Polygon& polygon : libSymbol.getPolygons()) {
+    // get polygon path and line width
+    QPainterPath polygonPath = input.polygonPaths.value(&polygon);
+    qreal        w           = polygon.getLineWidth()->toPx() / 2;
+
+    // update bounding rectangle
+    cache.boundingRect = cache.boundingRect.united(
+        polygonPath.boundingRect().adjusted(-w, -w, w, w));
+
+    // update shape
+    if (polygon.isGrabArea()) {
+      QPainterPathStroker stroker;
+      stroker.setCapStyle(Qt::RoundCap);
+      stroker.setJoinStyle(Qt::RoundJoin);
+      stroker.setWidth(2 * w);
+      // add polygon area
+      cache.shape = cache.shape.united(polygonPath);
+      // add stroke area
+      cache.shape = cache.shape.united(stroker.createStroke(polygonPath));
+    }
+  }
+
+  // circles
+  for (const Circle& circle : libSymbol.getCircles()) {
+    // get circle radius, including compensation for the stroke width
+    qreal w = circle.getLineWidth()->toPx() / 2;
+    qreal r = circle.getDiameter()->toPx() / 2 + w;
+
+    // get the bounding rectangle for the circle
+    QPointF center = circle.getCenter().toPxQPointF();
+    QRectF  boundingRect =
+        QRectF(QPointF(center.x() - r, center.y() - r), QSizeF(r * 2, r * 2));
+
+    // update bounding rectangle
+    cache.boundingRect = cache.boundingRect.united(boundingRect);
+
+    // update shape
+    if (circle.isGrabArea()) {
+      cache.shape.addEllipse(circle.getCenter().toPxQPointF(), r, r);
+    }
+  }
+
+  // texts
+  for (const Text& text : libSymbol.getTexts()) {
+    // create static text properties
+    CachedTextProperties_t props;
+
+    // get the text to display
+    props.text = input.texts.value(&text);
+
+    // calculate font metrics
+    props.fontPixelSize = qCeil(text.getHeight()->toPx());
+    font.setPixelSize(props.fontPixelSize);
+    QFontMetricsF metrics(font);
+    props.scaleFactor = text.getHeight()->toPx() / metrics.height();
+    props.textRect    = metrics.boundingRect(
+        QRectF(), text.getAlign().toQtAlign() | Qt::TextDontClip, props.text);
+    QRectF scaledTextRect =
+        QRectF(props.textRect.topLeft() * props.scaleFactor,
+               props.textRect.bottomRight() * props.scaleFactor);
+
+    // check rotation
+    Angle absAngle = text.getRotation() + input.rotation;
+    absAngle.mapTo180deg();
+    props.mirrored = input.mirrored;
+    if (!props.mirrored)
+      props.rotate180 =
+          (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+    else
+      props.rotate180 =
+          (absAngle < -Angle::deg90() || absAngle >= Angle::deg90());
+
+    // calculate text position
+    scaledTextRect.translate(text.getPosition().toPxQPointF());
+
+    // text alignment
+    if (props.rotate180)
+      props.flags = text.getAlign().mirrored().toQtAlign();
+    else
+      props.flags = text.getAlign().toQtAlign();
+
+    // calculate text bounding rect
+    cache.boundingRect = cache.boundingRect.united(scaledTextRect);
+
+    // calculate text rect in unscaled coordinates
+    props.textRect = QRectF(scaledTextRect.topLeft() / props.scaleFactor,
+                            scaledTextRect.bottomRight() / props.scaleFactor);
+    if (props.rotate180) {
+      props.textRect = QRectF(-props.textRect.x(), -props.textRect.y(),
+                              -props.textRect.width(), -props.textRect.height())
+                           .normalized();
+    }
+
+    // save properties
+    cache.textProperties.insert(&text, props);
+  }
+
+  return cache;
+}
+
+void SGI_Symbol::applyCache(const Cache& cache) noexcept {
+  prepareGeometryChange();
+  mBoundingRect = cache.boundingRect;
+  mShape        = cache.shape;
+  mCachedPolygonPaths.clear();
+  for (const Polygon& polygon : mLibSymbol.getPolygons()) {
+    // implicitly shared with the path, in contrast to the copies used for
+    // calculating the cache
+    mCachedPolygonPaths.insert(&polygon, polygon.getPath().toQPainterPathPx());
+  }
+  mCachedTextProperties = cache.textProperties;
+  update();
+}
+
 GraphicsLayer* SGI_Symbol::getLayer(const QString& name) const noexcept {
   return mSymbol.getProject().getLayers().getLayer(name);
 }
@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "sgi_base.h"
 
+#include <librepcb/common/units/angle.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -33,6 +35,7 @@
  ******************************************************************************/
 namespace librepcb {
 
+class Polygon;
 class Text;
 class GraphicsLayer;
 
@@ -60,6 +63,18 @@ public:
   // General Methods
   void updateCacheAndRepaint() noexcept;
 
+  // Static Methods
+
+  /**
+   * @brief Same as #updateCacheAndRepaint(), but for many items at once
+   *
+   * The geometry of the items is calculated in parallel on the global thread
+   * pool, and then applied to all items in the GUI thread.
+   *
+   * @param items   The items to update
+   */
+  static void updateCachesAndRepaint(const QList<SGI_Symbol*>& items) noexcept;
+
   // Inherited from QGraphicsItem
   QRectF       boundingRect() const noexcept { return mBoundingRect; }
   QPainterPath shape() const noexcept { return mShape; }
@@ -72,9 +87,6 @@ private:
   SGI_Symbol(const SGI_Symbol& other) = delete;
   SGI_Symbol& operator=(const SGI_Symbol& rhs) = delete;
 
-  // Private Methods
-  GraphicsLayer* getLayer(const QString& name) const noexcept;
-
   // Types
 
   struct CachedTextProperties_t {
@@ -87,6 +99,29 @@ private:
     QRectF  textRect;  // not scaled
   };
 
+  /// All data required to calculate the cache, see #getCacheInput()
+  struct CacheInput {
+    const library::Symbol*              libSymbol;
+    QFont                               font;
+    Angle                               rotation;
+    bool                                mirrored;
+    QHash<const Polygon*, QPainterPath> polygonPaths;  ///< Deep copies
+    QHash<const Text*, QString>         texts;         ///< Substituted texts
+  };
+
+  /// The result of #calcCache()
+  struct Cache {
+    QRectF                                     boundingRect;
+    QPainterPath                               shape;
+    QHash<const Text*, CachedTextProperties_t> textProperties;
+  };
+
+  // Private Methods
+  CacheInput     getCacheInput() const noexcept;
+  static Cache   calcCache(const CacheInput& input) noexcept;  // thread-safe
+  void           applyCache(const Cache& cache) noexcept;
+  GraphicsLayer* getLayer(const QString& name) const noexcept;
+
   // General Attributes
   SI_Symbol&             mSymbol;
   const library::Symbol& mLibSymbol;
@@ -95,6 +130,7 @@ private:
   // Cached Attributes
   QRectF                                     mBoundingRect;
   QPainterPath                               mShape;
+  QHash<const Polygon*, QPainterPath>        mCachedPolygonPaths;
   QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
 };
 
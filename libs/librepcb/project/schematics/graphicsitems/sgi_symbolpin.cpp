@@ -140,8 +140,7 @@ void SGI_SymbolPin::paint(QPainter*                       painter,
                           const QStyleOptionGraphicsItem* option,
                           QWidget*                        widget) {
   Q_UNUSED(widget);
-  const bool deviceIsPrinter =
-      (dynamic_cast<QPrinter*>(painter->device()) != 0);
+  const bool deviceIsPrinter = isPrinting(*painter);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
 
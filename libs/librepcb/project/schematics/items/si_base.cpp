@@ -36,6 +36,12 @@
 namespace librepcb {
 namespace project {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+static QAtomicInt sCreatedItemsCount(0);
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -45,6 +51,7 @@ SI_Base::SI_Base(Schematic& schematic) noexcept
     mSchematic(schematic),
     mIsAddedToSchematic(false),
     mIsSelected(false) {
+  sCreatedItemsCount.fetchAndAddRelaxed(1);
 }
 
 SI_Base::~SI_Base() noexcept {
@@ -77,20 +84,43 @@ void SI_Base::setSelected(bool selected) noexcept {
 
 void SI_Base::addToSchematic(SGI_Base* item) noexcept {
   Q_ASSERT(!mIsAddedToSchematic);
+  mIsAddedToSchematic = true;
   if (item) {
-    mSchematic.getGraphicsScene().addItem(*item);
+    addGraphicsItem(*item);
   }
-  mIsAddedToSchematic = true;
 }
 
 void SI_Base::removeFromSchematic(SGI_Base* item) noexcept {
   Q_ASSERT(mIsAddedToSchematic);
   if (item) {
-    mSchematic.getGraphicsScene().removeItem(*item);
+    removeGraphicsItem(*item);
   }
   mIsAddedToSchematic = false;
 }
 
+void SI_Base::addGraphicsItem(SGI_Base& item) noexcept {
+  // Note: Items which are not added to the schematic are not in the scene.
+  if (mIsAddedToSchematic) {
+    mSchematic.getGraphicsScene().addItem(item);
+    mSchematic.registerGraphicsItem(item, *this);
+  }
+}
+
+void SI_Base::removeGraphicsItem(SGI_Base& item) noexcept {
+  if (mIsAddedToSchematic) {
+    mSchematic.unregisterGraphicsItem(item);
+    mSchematic.getGraphicsScene().removeItem(item);
+  }
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+int SI_Base::getCreatedItemsCount() noexcept {
+  return sCreatedItemsCount.load();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
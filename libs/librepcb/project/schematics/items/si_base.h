@@ -88,6 +88,31 @@ public:
   virtual void addToSchematic()      = 0;
   virtual void removeFromSchematic() = 0;
 
+  /**
+   * @brief Create the graphics item(s) of this item (if not done yet)
+   *
+   * Graphics items only exist while the schematic needs them, see
+   * librepcb::project::Schematic::buildGraphicsItems().
+   */
+  virtual void buildGraphicsItems() noexcept = 0;
+
+  /**
+   * @brief Destroy the graphics item(s) of this item
+   *
+   * Until #buildGraphicsItems() is called again, the item is not visible and
+   * has an empty grab area.
+   */
+  virtual void releaseGraphicsItems() noexcept = 0;
+
+  // Static Methods
+
+  /**
+   * @brief Get the total number of items created so far (e.g. for profiling)
+   *
+   * @return Number of created items, including already destroyed ones
+   */
+  static int getCreatedItemsCount() noexcept;
+
   // Operator Overloadings
   SI_Base& operator=(const SI_Base& rhs) = delete;
 
@@ -95,6 +120,8 @@ protected:
   // General Methods
   void addToSchematic(SGI_Base* item) noexcept;
   void removeFromSchematic(SGI_Base* item) noexcept;
+  void addGraphicsItem(SGI_Base& item) noexcept;
+  void removeGraphicsItem(SGI_Base& item) noexcept;
 
 protected:
   Schematic& mSchematic;
@@ -64,9 +64,9 @@ SI_NetLabel::SI_NetLabel(SI_NetSegment& segment, const Point& position,
 
 void SI_NetLabel::init() {
   // create the graphics item
-  mGraphicsItem.reset(new SGI_NetLabel(*this));
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
-  mGraphicsItem->setRotation(-mRotation.toDeg());
+  if (mSchematic.hasGraphicsItems()) {
+    buildGraphicsItems();
+  }
 }
 
 SI_NetLabel::~SI_NetLabel() noexcept {
@@ -82,7 +82,11 @@ NetSignal& SI_NetLabel::getNetSignalOfNetSegment() const noexcept {
 }
 
 Length SI_NetLabel::getApproximateWidth() noexcept {
-  return Length::fromPx(mGraphicsItem->boundingRect().right());
+  if (mGraphicsItem) {
+    return Length::fromPx(mGraphicsItem->boundingRect().right());
+  } else {
+    return Length::fromPx(SGI_NetLabel(*this).boundingRect().right());
+  }
 }
 
 /*******************************************************************************
@@ -92,7 +96,9 @@ Length SI_NetLabel::getApproximateWidth() noexcept {
 void SI_NetLabel::setPosition(const Point& position) noexcept {
   if (position != mPosition) {
     mPosition = position;
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mGraphicsItem) {
+      mGraphicsItem->setPos(mPosition.toPxQPointF());
+    }
     updateAnchor();
   }
 }
@@ -100,8 +106,10 @@ void SI_NetLabel::setPosition(const Point& position) noexcept {
 void SI_NetLabel::setRotation(const Angle& rotation) noexcept {
   if (rotation != mRotation) {
     mRotation = rotation;
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+      mGraphicsItem->setRotation(-mRotation.toDeg());
+      mGraphicsItem->updateCacheAndRepaint();
+    }
     updateAnchor();
   }
 }
@@ -111,7 +119,9 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept {
  ******************************************************************************/
 
 void SI_NetLabel::updateAnchor() noexcept {
-  mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
+  if (mGraphicsItem) {
+    mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
+  }
 }
 
 void SI_NetLabel::addToSchematic() {
@@ -120,12 +130,22 @@ void SI_NetLabel::addToSchematic() {
   }
   mNameChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::nameChanged,
-              [this]() { mGraphicsItem->updateCacheAndRepaint(); });
+              [this]() {
+                if (mGraphicsItem) {
+                  mGraphicsItem->updateCacheAndRepaint();
+                }
+              });
   mHighlightChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
+              [this]() {
+                if (mGraphicsItem) {
+                  mGraphicsItem->update();
+                }
+              });
   SI_Base::addToSchematic(mGraphicsItem.data());
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
   updateAnchor();
 }
 
@@ -148,13 +168,38 @@ void SI_NetLabel::serialize(SExpression& root) const {
  *  Inherited from SI_Base
  ******************************************************************************/
 
+void SI_NetLabel::buildGraphicsItems() noexcept {
+  if (!mGraphicsItem) {
+    mGraphicsItem.reset(new SGI_NetLabel(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    if (isAddedToSchematic()) {
+      updateAnchor();
+    }
+    addGraphicsItem(*mGraphicsItem);
+  }
+}
+
+void SI_NetLabel::releaseGraphicsItems() noexcept {
+  if (mGraphicsItem) {
+    removeGraphicsItem(*mGraphicsItem);
+    mGraphicsItem.reset();
+  }
+}
+
 QPainterPath SI_NetLabel::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  if (mGraphicsItem) {
+    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  } else {
+    return QPainterPath();
+  }
 }
 
 void SI_NetLabel::setSelected(bool selected) noexcept {
   SI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) {
+    mGraphicsItem->update();
+  }
 }
 
 /*******************************************************************************
@@ -75,6 +75,8 @@ public:
   void updateAnchor() noexcept;
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -81,8 +81,10 @@ void SI_NetLine::init() {
                      tr("SI_NetLine: both endpoints are the same."));
   }
 
-  mGraphicsItem.reset(new SGI_NetLine(*this));
   updateLine();
+  if (mSchematic.hasGraphicsItems()) {
+    buildGraphicsItems();
+  }
 }
 
 SI_NetLine::~SI_NetLine() noexcept {
@@ -115,7 +117,9 @@ NetSignal& SI_NetLine::getNetSignalOfNetSegment() const noexcept {
 void SI_NetLine::setWidth(const UnsignedLength& width) noexcept {
   if (width != mWidth) {
     mWidth = width;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+      mGraphicsItem->updateCacheAndRepaint();
+    }
   }
 }
 
@@ -134,7 +138,11 @@ void SI_NetLine::addToSchematic() {
 
   mHighlightChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
+              [this]() {
+                if (mGraphicsItem) {
+                  mGraphicsItem->update();
+                }
+              });
   SI_Base::addToSchematic(mGraphicsItem.data());
   sg.dismiss();
 }
@@ -155,7 +163,9 @@ void SI_NetLine::removeFromSchematic() {
 
 void SI_NetLine::updateLine() noexcept {
   mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 void SI_NetLine::serialize(SExpression& root) const {
@@ -197,13 +207,33 @@ void SI_NetLine::serializeAnchor(SExpression&      root,
  *  Inherited from SI_Base
  ******************************************************************************/
 
+void SI_NetLine::buildGraphicsItems() noexcept {
+  if (!mGraphicsItem) {
+    mGraphicsItem.reset(new SGI_NetLine(*this));
+    addGraphicsItem(*mGraphicsItem);
+  }
+}
+
+void SI_NetLine::releaseGraphicsItems() noexcept {
+  if (mGraphicsItem) {
+    removeGraphicsItem(*mGraphicsItem);
+    mGraphicsItem.reset();
+  }
+}
+
 QPainterPath SI_NetLine::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->shape();
+  if (mGraphicsItem) {
+    return mGraphicsItem->shape();
+  } else {
+    return QPainterPath();
+  }
 }
 
 void SI_NetLine::setSelected(bool selected) noexcept {
   SI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) {
+    mGraphicsItem->update();
+  }
 }
 
 /*******************************************************************************
@@ -27,6 +27,7 @@
 #include "si_base.h"
 
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/utils/objectpool.h>
 
 #include <QtCore>
 
@@ -89,6 +90,8 @@ public:
   // General Methods
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
   void updateLine() noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
@@ -102,6 +105,12 @@ public:
 
   // Operator Overloadings
   SI_NetLine& operator=(const SI_NetLine& rhs) = delete;
+  static void* operator new(std::size_t size) {
+    return ObjectPool<SI_NetLine>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<SI_NetLine>::deallocate(p, size);
+  }
 
 private:
   void              init();
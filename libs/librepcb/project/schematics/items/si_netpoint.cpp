@@ -56,8 +56,9 @@ SI_NetPoint::SI_NetPoint(SI_NetSegment& segment, const Point& position)
 
 void SI_NetPoint::init() {
   // create the graphics item
-  mGraphicsItem.reset(new SGI_NetPoint(*this));
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
+  if (mSchematic.hasGraphicsItems()) {
+    buildGraphicsItems();
+  }
 
   // create ERC messages
   mErcMsgDeadNetPoint.reset(
@@ -95,7 +96,9 @@ NetSignal& SI_NetPoint::getNetSignalOfNetSegment() const noexcept {
 void SI_NetPoint::setPosition(const Point& position) noexcept {
   if (position != mPosition) {
     mPosition = position;
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mGraphicsItem) {
+      mGraphicsItem->setPos(mPosition.toPxQPointF());
+    }
     foreach (SI_NetLine* line, mRegisteredNetLines) { line->updateLine(); }
   }
 }
@@ -110,7 +113,11 @@ void SI_NetPoint::addToSchematic() {
   }
   mHighlightChangedConnection =
       connect(&getNetSignalOfNetSegment(), &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
+              [this]() {
+                if (mGraphicsItem) {
+                  mGraphicsItem->update();
+                }
+              });
   mErcMsgDeadNetPoint->setVisible(true);
   SI_Base::addToSchematic(mGraphicsItem.data());
 }
@@ -131,7 +138,9 @@ void SI_NetPoint::registerNetLine(SI_NetLine& netline) {
   }
   mRegisteredNetLines.insert(&netline);
   netline.updateLine();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
   mErcMsgDeadNetPoint->setVisible(mRegisteredNetLines.isEmpty());
 }
 
@@ -141,7 +150,9 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline) {
   }
   mRegisteredNetLines.remove(&netline);
   netline.updateLine();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
   mErcMsgDeadNetPoint->setVisible(mRegisteredNetLines.isEmpty());
 }
 
@@ -154,13 +165,34 @@ void SI_NetPoint::serialize(SExpression& root) const {
  *  Inherited from SI_Base
  ******************************************************************************/
 
+void SI_NetPoint::buildGraphicsItems() noexcept {
+  if (!mGraphicsItem) {
+    mGraphicsItem.reset(new SGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addGraphicsItem(*mGraphicsItem);
+  }
+}
+
+void SI_NetPoint::releaseGraphicsItems() noexcept {
+  if (mGraphicsItem) {
+    removeGraphicsItem(*mGraphicsItem);
+    mGraphicsItem.reset();
+  }
+}
+
 QPainterPath SI_NetPoint::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
+  if (mGraphicsItem) {
+    return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
+  } else {
+    return QPainterPath();
+  }
 }
 
 void SI_NetPoint::setSelected(bool selected) noexcept {
   SI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) {
+    mGraphicsItem->update();
+  }
 }
 
 /*******************************************************************************
@@ -29,6 +29,7 @@
 #include "si_base.h"
 
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/utils/objectpool.h>
 
 #include <QtCore>
 
@@ -75,6 +76,8 @@ public:
   // General Methods
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -96,6 +99,12 @@ public:
   SI_NetPoint& operator=(const SI_NetPoint& rhs) = delete;
   bool operator==(const SI_NetPoint& rhs) noexcept { return (this == &rhs); }
   bool operator!=(const SI_NetPoint& rhs) noexcept { return (this != &rhs); }
+  static void* operator new(std::size_t size) {
+    return ObjectPool<SI_NetPoint>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<SI_NetPoint>::deallocate(p, size);
+  }
 
 private:
   void init();
@@ -38,6 +38,8 @@
 
 #include <QtCore>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -63,8 +65,8 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node)
     }
 
     // Load all netpoints
-    foreach (const SExpression& child, node.getChildren("junction")) {
-      SI_NetPoint* netpoint = new SI_NetPoint(*this, child);
+    foreach (const SExpression* child, node.getChildren("junction")) {
+      SI_NetPoint* netpoint = new SI_NetPoint(*this, *child);
       if (getNetPointByUuid(netpoint->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -75,9 +77,9 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node)
     }
 
     // Load all netlines
-    foreach (const SExpression& child,
+    foreach (const SExpression* child,
              node.getChildren("netline") + node.getChildren("line")) {
-      SI_NetLine* netline = new SI_NetLine(*this, child);
+      SI_NetLine* netline = new SI_NetLine(*this, *child);
       if (getNetLineByUuid(netline->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -88,9 +90,9 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node)
     }
 
     // Load all netlabels
-    foreach (const SExpression& child,
+    foreach (const SExpression* child,
              node.getChildren("netlabel") + node.getChildren("label")) {
-      SI_NetLabel* netlabel = new SI_NetLabel(*this, child);
+      SI_NetLabel* netlabel = new SI_NetLabel(*this, *child);
       if (getNetLabelByUuid(netlabel->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -100,6 +102,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node)
       mNetLabels.append(netlabel);
     }
 
+    rebuildConnectivity();
     if (!areAllNetPointsConnectedTogether()) {
       throw RuntimeError(
           __FILE__, __LINE__,
@@ -296,14 +299,30 @@ void SI_NetSegment::addNetPointsAndNetLines(
     throw LogicError(__FILE__, __LINE__);
   }
 
-  ScopeGuardList sgl(netpoints.count() + netlines.count());
+  // Note: The UUIDs are collected in hash sets to check for duplicates in
+  // constant time. Otherwise adding many elements at once (e.g. when pasting)
+  // would have quadratic complexity. Elements which are already part of this
+  // segment are detected by their "added to schematic" state since all
+  // elements of this segment are added to the schematic.
+  QSet<Uuid> uuids;
+  foreach (const SI_NetPoint* np, mNetPoints) { uuids.insert(np->getUuid()); }
+  foreach (const SI_NetLine* nl, mNetLines) { uuids.insert(nl->getUuid()); }
+
+  ScopeGuardList sgl(netpoints.count() + netlines.count() + 1);
+  QList<SI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<SI_NetLine*>  oldNetLines  = mNetLines;
+  sgl.add([this, oldNetPoints, oldNetLines]() {
+    mNetPoints = oldNetPoints;
+    mNetLines  = oldNetLines;
+    rebuildConnectivity();
+  });
   foreach (SI_NetPoint* netpoint, netpoints) {
-    if ((mNetPoints.contains(netpoint)) ||
+    if ((netpoint->isAddedToSchematic()) ||
         (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netpoint with the same uuid in the list
-    if (getNetPointByUuid(netpoint->getUuid())) {
+    if (uuids.contains(netpoint->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There is already a netpoint with the UUID \"%1\"!"))
@@ -312,17 +331,16 @@ void SI_NetSegment::addNetPointsAndNetLines(
     // add to schematic
     netpoint->addToSchematic();  // can throw
     mNetPoints.append(netpoint);
-    sgl.add([this, netpoint]() {
-      netpoint->removeFromSchematic();
-      mNetPoints.removeOne(netpoint);
-    });
+    uuids.insert(netpoint->getUuid());
+    sgl.add([netpoint]() { netpoint->removeFromSchematic(); });
   }
   foreach (SI_NetLine* netline, netlines) {
-    if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+    if ((netline->isAddedToSchematic()) ||
+        (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netline with the same uuid in the list
-    if (getNetLineByUuid(netline->getUuid())) {
+    if (uuids.contains(netline->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There is already a netline with the UUID \"%1\"!"))
@@ -331,12 +349,11 @@ void SI_NetSegment::addNetPointsAndNetLines(
     // add to schematic
     netline->addToSchematic();  // can throw
     mNetLines.append(netline);
-    sgl.add([this, netline]() {
-      netline->removeFromSchematic();
-      mNetLines.removeOne(netline);
-    });
+    uuids.insert(netline->getUuid());
+    sgl.add([netline]() { netline->removeFromSchematic(); });
   }
 
+  addToConnectivity(netpoints, netlines);
   if (!areAllNetPointsConnectedTogether()) {
     throw LogicError(
         __FILE__, __LINE__,
@@ -347,6 +364,7 @@ void SI_NetSegment::addNetPointsAndNetLines(
   updateAllNetLabelAnchors();
 
   sgl.dismiss();
+  mSchematic.setModified();
 }
 
 void SI_NetSegment::removeNetPointsAndNetLines(
@@ -355,32 +373,53 @@ void SI_NetSegment::removeNetPointsAndNetLines(
     throw LogicError(__FILE__, __LINE__);
   }
 
-  ScopeGuardList sgl(netpoints.count() + netlines.count());
+  // Note: The elements are removed from the lists in a single pass at the end
+  // to avoid quadratic complexity when removing many elements at once.
+  QSet<SI_NetPoint*> removedNetPoints = netpoints.toSet();
+  QSet<SI_NetLine*>  removedNetLines  = netlines.toSet();
+  if ((removedNetPoints.count() != netpoints.count()) ||
+      (removedNetLines.count() != netlines.count())) {
+    throw LogicError(__FILE__, __LINE__);  // duplicate elements
+  }
+
+  ScopeGuardList sgl(netpoints.count() + netlines.count() + 1);
+  QList<SI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<SI_NetLine*>  oldNetLines  = mNetLines;
+  sgl.add([this, oldNetPoints, oldNetLines]() {
+    mNetPoints = oldNetPoints;
+    mNetLines  = oldNetLines;
+    rebuildConnectivity();
+  });
   foreach (SI_NetLine* netline, netlines) {
-    if (!mNetLines.contains(netline)) {
+    if ((!netline->isAddedToSchematic()) ||
+        (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netline->removeFromSchematic();  // can throw
-    mNetLines.removeOne(netline);
-    sgl.add([this, netline]() {
-      netline->addToSchematic();
-      mNetLines.append(netline);
-    });
+    sgl.add([netline]() { netline->addToSchematic(); });
   }
   foreach (SI_NetPoint* netpoint, netpoints) {
-    if (!mNetPoints.contains(netpoint)) {
+    if ((!netpoint->isAddedToSchematic()) ||
+        (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netpoint->removeFromSchematic();  // can throw
-    mNetPoints.removeOne(netpoint);
-    sgl.add([this, netpoint]() {
-      netpoint->addToSchematic();
-      mNetPoints.append(netpoint);
-    });
+    sgl.add([netpoint]() { netpoint->addToSchematic(); });
   }
-
+  mNetLines.erase(std::remove_if(mNetLines.begin(), mNetLines.end(),
+                                 [&](SI_NetLine* netline) {
+                                   return removedNetLines.contains(netline);
+                                 }),
+                  mNetLines.end());
+  mNetPoints.erase(std::remove_if(mNetPoints.begin(), mNetPoints.end(),
+                                  [&](SI_NetPoint* netpoint) {
+                                    return removedNetPoints.contains(netpoint);
+                                  }),
+                   mNetPoints.end());
+
+  rebuildConnectivity();
   if (!areAllNetPointsConnectedTogether()) {
     throw LogicError(
         __FILE__, __LINE__,
@@ -391,6 +430,7 @@ void SI_NetSegment::removeNetPointsAndNetLines(
   updateAllNetLabelAnchors();
 
   sgl.dismiss();
+  mSchematic.setModified();
 }
 
 /*******************************************************************************
@@ -419,6 +459,7 @@ void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel) {
   // add to schematic
   netlabel.addToSchematic();  // can throw
   mNetLabels.append(&netlabel);
+  mSchematic.setModified();
 }
 
 void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel) {
@@ -428,6 +469,7 @@ void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel) {
   // remove from schematic
   netlabel.removeFromSchematic();  // can throw
   mNetLabels.removeOne(&netlabel);
+  mSchematic.setModified();
 }
 
 void SI_NetSegment::updateAllNetLabelAnchors() noexcept {
@@ -490,6 +532,26 @@ void SI_NetSegment::removeFromSchematic() {
   sgl.dismiss();
 }
 
+void SI_NetSegment::buildGraphicsItems() noexcept {
+  foreach (SI_NetPoint* netpoint, mNetPoints) {
+    netpoint->buildGraphicsItems();
+  }
+  foreach (SI_NetLine* netline, mNetLines) { netline->buildGraphicsItems(); }
+  foreach (SI_NetLabel* netlabel, mNetLabels) {
+    netlabel->buildGraphicsItems();
+  }
+}
+
+void SI_NetSegment::releaseGraphicsItems() noexcept {
+  foreach (SI_NetLabel* netlabel, mNetLabels) {
+    netlabel->releaseGraphicsItems();
+  }
+  foreach (SI_NetLine* netline, mNetLines) { netline->releaseGraphicsItems(); }
+  foreach (SI_NetPoint* netpoint, mNetPoints) {
+    netpoint->releaseGraphicsItems();
+  }
+}
+
 void SI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept {
   foreach (SI_NetPoint* netpoint, mNetPoints)
     netpoint->setSelected(netpoint->getGrabAreaScenePx().intersects(rectPx));
@@ -548,47 +610,26 @@ bool SI_NetSegment::checkAttributesValidity() const noexcept {
   return true;
 }
 
-bool SI_NetSegment::areAllNetPointsConnectedTogether() const noexcept {
-  if (mNetPoints.count() > 1) {
-    const SI_NetPoint*        firstPoint = mNetPoints.first();
-    QSet<const SI_SymbolPin*> pins;
-    QSet<const SI_NetPoint*>  points;
-    findAllConnectedNetPoints(*firstPoint, pins, points);
-    return (points.count() == mNetPoints.count());
-  } else {
-    return true;  // there is only 0 or 1 netpoint => must be "connected
-                  // together" :)
+void SI_NetSegment::addToConnectivity(
+    const QList<SI_NetPoint*>& netpoints,
+    const QList<SI_NetLine*>&  netlines) noexcept {
+  foreach (const SI_NetPoint* netpoint, netpoints) {
+    mConnectivity.insert(netpoint, true);
+  }
+  foreach (const SI_NetLine* netline, netlines) {
+    // Note: Pins are added implicitly as not counted elements, i.e. only the
+    // netpoints need to be connected together.
+    mConnectivity.unite(&netline->getStartPoint(), &netline->getEndPoint());
   }
 }
 
-void SI_NetSegment::findAllConnectedNetPoints(
-    const SI_NetLineAnchor& p, QSet<const SI_SymbolPin*>& pins,
-    QSet<const SI_NetPoint*>& points) const noexcept {
-  if (const SI_SymbolPin* pin = dynamic_cast<const SI_SymbolPin*>(&p)) {
-    if (pins.contains(pin)) return;
-    pins.insert(pin);
-    foreach (const SI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == pin) {
-        findAllConnectedNetPoints(netline->getEndPoint(), pins, points);
-      }
-      if (&netline->getEndPoint() == pin) {
-        findAllConnectedNetPoints(netline->getStartPoint(), pins, points);
-      }
-    }
-  } else if (const SI_NetPoint* np = dynamic_cast<const SI_NetPoint*>(&p)) {
-    if (points.contains(np)) return;
-    points.insert(np);
-    foreach (const SI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == np) {
-        findAllConnectedNetPoints(netline->getEndPoint(), pins, points);
-      }
-      if (&netline->getEndPoint() == np) {
-        findAllConnectedNetPoints(netline->getStartPoint(), pins, points);
-      }
-    }
-  } else {
-    Q_ASSERT(false);
-  }
+void SI_NetSegment::rebuildConnectivity() noexcept {
+  mConnectivity.clear();
+  addToConnectivity(mNetPoints, mNetLines);
+}
+
+bool SI_NetSegment::areAllNetPointsConnectedTogether() const noexcept {
+  return mConnectivity.getCount() <= 1;
 }
 
 /*******************************************************************************
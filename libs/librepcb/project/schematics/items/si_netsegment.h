@@ -26,6 +26,7 @@
 #include "si_base.h"
 
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/utils/disjointsets.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -109,6 +110,8 @@ public:
   // General Methods
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
   void setSelectionRect(const QRectF rectPx) noexcept;
   void clearSelection() const noexcept;
 
@@ -134,11 +137,10 @@ public:
 
 private:
   bool checkAttributesValidity() const noexcept;
+  void addToConnectivity(const QList<SI_NetPoint*>& netpoints,
+                         const QList<SI_NetLine*>&  netlines) noexcept;
+  void rebuildConnectivity() noexcept;
   bool areAllNetPointsConnectedTogether() const noexcept;
-  void findAllConnectedNetPoints(const SI_NetLineAnchor&    p,
-                                 QSet<const SI_SymbolPin*>& pins,
-                                 QSet<const SI_NetPoint*>&  points) const
-      noexcept;
 
   // Attributes
   Uuid       mUuid;
@@ -148,6 +150,12 @@ private:
   QList<SI_NetPoint*> mNetPoints;
   QList<SI_NetLine*>  mNetLines;
   QList<SI_NetLabel*> mNetLabels;
+
+  /// All netpoints and pins, partitioned into sets of connected anchors
+  ///
+  /// Updated incrementally when adding netpoints and netlines, so the
+  /// cohesion of the segment can be checked without traversing it.
+  DisjointSets<SI_NetLineAnchor> mConnectivity;
 };
 
 /*******************************************************************************
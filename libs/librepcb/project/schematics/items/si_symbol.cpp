@@ -96,9 +96,9 @@ void SI_Symbol::init(const Uuid& symbVarItemUuid) {
                            .arg(mSymbVarItem->getSymbolUuid().toStr()));
   }
 
-  mGraphicsItem.reset(new SGI_Symbol(*this));
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
-  updateGraphicsItemTransform();
+  if (mSchematic.hasGraphicsItems()) {
+    buildGraphicsItems();  // pins create their graphics items themselves
+  }
 
   for (const library::SymbolPin& libPin : mSymbol->getPins()) {
     SI_SymbolPin* pin = new SI_SymbolPin(*this, libPin.getUuid());  // can throw
@@ -151,8 +151,10 @@ QString SI_Symbol::getName() const noexcept {
 void SI_Symbol::setPosition(const Point& newPos) noexcept {
   if (newPos != mPosition) {
     mPosition = newPos;
-    mGraphicsItem->setPos(newPos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+      mGraphicsItem->setPos(newPos.toPxQPointF());
+      mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
   }
 }
@@ -161,7 +163,9 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept {
   if (newRotation != mRotation) {
     mRotation = newRotation;
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+      mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
   }
 }
@@ -170,7 +174,9 @@ void SI_Symbol::setMirrored(bool newMirrored) noexcept {
   if (newMirrored != mMirrored) {
     mMirrored = newMirrored;
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+      mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
   }
 }
@@ -209,6 +215,24 @@ void SI_Symbol::removeFromSchematic() {
   sgl.dismiss();
 }
 
+void SI_Symbol::buildGraphicsItems() noexcept {
+  if (!mGraphicsItem) {
+    mGraphicsItem.reset(new SGI_Symbol(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    addGraphicsItem(*mGraphicsItem);
+  }
+  foreach (SI_SymbolPin* pin, mPins) { pin->buildGraphicsItems(); }
+}
+
+void SI_Symbol::releaseGraphicsItems() noexcept {
+  foreach (SI_SymbolPin* pin, mPins) { pin->releaseGraphicsItems(); }
+  if (mGraphicsItem) {
+    removeGraphicsItem(*mGraphicsItem);
+    mGraphicsItem.reset();
+  }
+}
+
 void SI_Symbol::serialize(SExpression& root) const {
   if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 
@@ -256,21 +280,49 @@ QVector<const AttributeProvider*> SI_Symbol::getAttributeProviderParents() const
  ******************************************************************************/
 
 QPainterPath SI_Symbol::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  if (mGraphicsItem) {
+    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  } else {
+    return QPainterPath();
+  }
 }
 
 void SI_Symbol::setSelected(bool selected) noexcept {
   SI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) {
+    mGraphicsItem->update();
+  }
   foreach (SI_SymbolPin* pin, mPins) { pin->setSelected(selected); }
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void SI_Symbol::updateGraphicsItems(const QList<SI_Symbol*>& symbols) noexcept {
+  QList<SGI_Symbol*> items;
+  foreach (SI_Symbol* symbol, symbols) {
+    if (symbol->mGraphicsItem) {
+      items.append(symbol->mGraphicsItem.data());
+    }
+  }
+  SGI_Symbol::updateCachesAndRepaint(items);
+}
+
 /*******************************************************************************
  *  Private Slots
  ******************************************************************************/
 
 void SI_Symbol::schematicOrComponentAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  // Note: Modifying attributes often affects all symbols (e.g. project
+  // attributes), thus the graphics items are updated together.
+  if (!mGraphicsItem) {
+    return;  // will be up to date when it gets created
+  } else if (isAddedToSchematic()) {
+    mSchematic.scheduleSymbolGraphicsItemUpdate(*this);
+  } else {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 /*******************************************************************************
@@ -281,7 +333,9 @@ void SI_Symbol::updateGraphicsItemTransform() noexcept {
   QTransform t;
   if (mMirrored) t.scale(qreal(-1), qreal(1));
   t.rotate(-mRotation.toDeg());
-  mGraphicsItem->setTransform(t);
+  if (mGraphicsItem) {
+    mGraphicsItem->setTransform(t);
+  }
 }
 
 bool SI_Symbol::checkAttributesValidity() const noexcept {
@@ -95,6 +95,8 @@ public:
   // General Methods
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -118,6 +120,17 @@ public:
   // Operator Overloadings
   SI_Symbol& operator=(const SI_Symbol& rhs) = delete;
 
+  // Static Methods
+
+  /**
+   * @brief Update the graphics items of many symbols at once
+   *
+   * @param symbols   The symbols to update
+   *
+   * @see librepcb::project::SGI_Symbol::updateCachesAndRepaint()
+   */
+  static void updateGraphicsItems(const QList<SI_Symbol*>& symbols) noexcept;
+
 private slots:
 
   void schematicOrComponentAttributesChanged();
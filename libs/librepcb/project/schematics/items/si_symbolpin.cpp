@@ -62,8 +62,10 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid)
     mComponentSignalInstance =
         mSymbol.getComponentInstance().getSignalInstance(*cmpSignalUuid);
 
-  mGraphicsItem.reset(new SGI_SymbolPin(*this));
   updatePosition();
+  if (mSchematic.hasGraphicsItems()) {
+    buildGraphicsItems();
+  }
 
   // create ERC messages
   mErcMsgUnconnectedRequiredPin.reset(new ErcMsg(
@@ -154,11 +156,17 @@ void SI_SymbolPin::addToSchematic() {
   if (getCompSigInstNetSignal()) {
     mHighlightChangedConnection =
         connect(getCompSigInstNetSignal(), &NetSignal::highlightedChanged,
-                [this]() { mGraphicsItem->update(); });
+                [this]() {
+                  if (mGraphicsItem) {
+                    mGraphicsItem->update();
+                  }
+                });
   }
   SI_Base::addToSchematic(mGraphicsItem.data());
   updateErcMessages();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 void SI_SymbolPin::removeFromSchematic() {
@@ -175,6 +183,22 @@ void SI_SymbolPin::removeFromSchematic() {
   updateErcMessages();
 }
 
+void SI_SymbolPin::buildGraphicsItems() noexcept {
+  if (!mGraphicsItem) {
+    mGraphicsItem.reset(new SGI_SymbolPin(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    addGraphicsItem(*mGraphicsItem);
+  }
+}
+
+void SI_SymbolPin::releaseGraphicsItems() noexcept {
+  if (mGraphicsItem) {
+    removeGraphicsItem(*mGraphicsItem);
+    mGraphicsItem.reset();
+  }
+}
+
 void SI_SymbolPin::registerNetLine(SI_NetLine& netline) {
   if ((!isAddedToSchematic()) || (mRegisteredNetLines.contains(&netline)) ||
       (netline.getSchematic() != mSchematic) ||
@@ -189,8 +213,10 @@ void SI_SymbolPin::registerNetLine(SI_NetLine& netline) {
   mRegisteredNetLines.insert(&netline);
   netline.updateLine();
   updateErcMessages();
-  mGraphicsItem
-      ->updateCacheAndRepaint();  // re-check whether to fill the circle or not
+  if (mGraphicsItem) {
+    // re-check whether to fill the circle or not
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 void SI_SymbolPin::unregisterNetLine(SI_NetLine& netline) {
@@ -200,16 +226,20 @@ void SI_SymbolPin::unregisterNetLine(SI_NetLine& netline) {
   mRegisteredNetLines.remove(&netline);
   netline.updateLine();
   updateErcMessages();
-  mGraphicsItem
-      ->updateCacheAndRepaint();  // re-check whether to fill the circle or not
+  if (mGraphicsItem) {
+    // re-check whether to fill the circle or not
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 void SI_SymbolPin::updatePosition() noexcept {
   mPosition = mSymbol.mapToScene(mSymbolPin->getPosition());
   mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
-  mGraphicsItem->setPos(mPosition.toPxQPointF());
-  updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mGraphicsItem) {
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    mGraphicsItem->updateCacheAndRepaint();
+  }
   foreach (SI_NetLine* netline, mRegisteredNetLines) { netline->updateLine(); }
 }
 
@@ -218,12 +248,18 @@ void SI_SymbolPin::updatePosition() noexcept {
  ******************************************************************************/
 
 QPainterPath SI_SymbolPin::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  if (mGraphicsItem) {
+    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+  } else {
+    return QPainterPath();
+  }
 }
 
 void SI_SymbolPin::setSelected(bool selected) noexcept {
   SI_Base::setSelected(selected);
-  mGraphicsItem->update();
+  if (mGraphicsItem) {
+    mGraphicsItem->update();
+  }
 }
 
 /*******************************************************************************
@@ -248,7 +284,9 @@ void SI_SymbolPin::updateGraphicsItemTransform() noexcept {
   QTransform t;
   if (mSymbol.getMirrored()) t.scale(qreal(-1), qreal(1));
   t.rotate(-mRotation.toDeg());
-  mGraphicsItem->setTransform(t);
+  if (mGraphicsItem) {
+    mGraphicsItem->setTransform(t);
+  }
 }
 
 /*******************************************************************************
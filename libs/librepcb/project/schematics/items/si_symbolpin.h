@@ -86,6 +86,8 @@ public:
   // General Methods
   void addToSchematic() override;
   void removeFromSchematic() override;
+  void buildGraphicsItems() noexcept override;
+  void releaseGraphicsItems() noexcept override;
   void updatePosition() noexcept;
 
   // Inherited from SI_Base
@@ -23,6 +23,11 @@
 #include "schematic.h"
 
 #include "../project.h"
+#include "graphicsitems/sgi_netlabel.h"
+#include "graphicsitems/sgi_netline.h"
+#include "graphicsitems/sgi_netpoint.h"
+#include "graphicsitems/sgi_symbol.h"
+#include "graphicsitems/sgi_symbolpin.h"
 #include "items/si_netlabel.h"
 #include "items/si_netline.h"
 #include "items/si_netpoint.h"
@@ -36,6 +41,7 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/common/scopeguardlist.h>
 #include <librepcb/library/sym/symbolpin.h>
 
@@ -53,14 +59,28 @@ namespace project {
 
 Schematic::Schematic(Project&                                project,
                      std::unique_ptr<TransactionalDirectory> directory,
-                     bool create, const QString& newName)
+                     bool create, const QString& newName,
+                     const SExpression* root)
   : QObject(&project),
     AttributeProvider(),
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(create),
+    mHasGraphicsItems(false),
     mUuid(Uuid::createRandom()),
     mName("New Page") {
+  mSymbolGraphicsItemUpdateTimer.setSingleShot(true);
+  mSymbolGraphicsItemUpdateTimer.setInterval(0);
+  connect(&mSymbolGraphicsItemUpdateTimer, &QTimer::timeout, this,
+          &Schematic::updateScheduledSymbolGraphicsItems);
+
+  // Release the graphics items of pages which were not shown for a while.
+  mGraphicsItemsReleaseTimer.setSingleShot(true);
+  mGraphicsItemsReleaseTimer.setInterval(60000);
+  connect(&mGraphicsItemsReleaseTimer, &QTimer::timeout, this,
+          &Schematic::releaseGraphicsItemsIfHidden);
+
   try {
     mGraphicsScene.reset(new GraphicsScene());
 
@@ -72,21 +92,20 @@ Schematic::Schematic(Project&                                project,
       // load default grid properties
       mGridProperties.reset(new GridProperties());
     } else {
-      SExpression root = SExpression::parse(
-          mDirectory->read(getFilePath().getFilename()), getFilePath());
+      Q_ASSERT(root);
 
       // the schematic seems to be ready to open, so we will create all needed
       // objects
 
-      mUuid = root.getChildByIndex(0).getValue<Uuid>();
-      mName = root.getValueByPath<ElementName>("name");
+      mUuid = root->getChildByIndex(0).getValue<Uuid>();
+      mName = root->getValueByPath<ElementName>("name");
 
       // Load grid properties
-      mGridProperties.reset(new GridProperties(root.getChildByPath("grid")));
+      mGridProperties.reset(new GridProperties(root->getChildByPath("grid")));
 
       // Load all symbols
-      foreach (const SExpression& node, root.getChildren("symbol")) {
-        SI_Symbol* symbol = new SI_Symbol(*this, node);
+      foreach (const SExpression* node, root->getChildren("symbol")) {
+        SI_Symbol* symbol = new SI_Symbol(*this, *node);
         if (getSymbolByUuid(symbol->getUuid())) {
           throw RuntimeError(
               __FILE__, __LINE__,
@@ -97,8 +116,8 @@ Schematic::Schematic(Project&                                project,
       }
 
       // Load all netsegments
-      foreach (const SExpression& node, root.getChildren("netsegment")) {
-        SI_NetSegment* netsegment = new SI_NetSegment(*this, node);
+      foreach (const SExpression* node, root->getChildren("netsegment")) {
+        SI_NetSegment* netsegment = new SI_NetSegment(*this, *node);
         if (getNetSegmentByUuid(netsegment->getUuid())) {
           throw RuntimeError(
               __FILE__, __LINE__,
@@ -149,8 +168,35 @@ bool Schematic::isEmpty() const noexcept {
   return (mSymbols.isEmpty() && mNetSegments.isEmpty());
 }
 
+qint64 Schematic::getMemoryUsage() const noexcept {
+  qint64 usage = sizeof(Schematic) + sizeof(GraphicsScene) +
+      sizeof(GridProperties) +
+      mItemsByGraphicsItem.count() * 2 * sizeof(void*);
+  foreach (const SI_Symbol* symbol, mSymbols) {
+    usage += sizeof(SI_Symbol);
+    usage += symbol->getPins().count() * sizeof(SI_SymbolPin);
+    if (mHasGraphicsItems) {
+      usage += sizeof(SGI_Symbol);
+      usage += symbol->getPins().count() * sizeof(SGI_SymbolPin);
+    }
+  }
+  foreach (const SI_NetSegment* netsegment, mNetSegments) {
+    int netpoints = netsegment->getNetPoints().count();
+    int netlines  = netsegment->getNetLines().count();
+    int netlabels = netsegment->getNetLabels().count();
+    usage += sizeof(SI_NetSegment) + netpoints * sizeof(SI_NetPoint) +
+        netlines * sizeof(SI_NetLine) + netlabels * sizeof(SI_NetLabel);
+    if (mHasGraphicsItems) {
+      usage += netpoints * sizeof(SGI_NetPoint) +
+          netlines * sizeof(SGI_NetLine) + netlabels * sizeof(SGI_NetLabel);
+    }
+  }
+  return usage;
+}
+
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
-  QPointF scenePosPx = pos.toPxQPointF();
+  QPointF         scenePosPx = pos.toPxQPointF();
+  QList<SI_Base*> candidates = getItemCandidatesAtScenePos(pos);
   QList<SI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
@@ -176,12 +222,16 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
   foreach (SI_NetLabel* netlabel, getNetLabelsAtScenePos(pos)) {
     list.append(netlabel);
   }
-  // symbols & pins
-  foreach (SI_Symbol* symbol, mSymbols) {
-    foreach (SI_SymbolPin* pin, symbol->getPins()) {
-      if (pin->getGrabAreaScenePx().contains(scenePosPx)) list.append(pin);
+  // pins & symbols
+  QList<SI_Base::Type_t> types = {SI_Base::Type_t::SymbolPin,
+                                  SI_Base::Type_t::Symbol};
+  foreach (SI_Base::Type_t type, types) {
+    foreach (SI_Base* item, candidates) {
+      if ((item->getType() == type) &&
+          item->getGrabAreaScenePx().contains(scenePosPx)) {
+        list.append(item);
+      }
     }
-    if (symbol->getGrabAreaScenePx().contains(scenePosPx)) list.append(symbol);
   }
   return list;
 }
@@ -189,8 +239,11 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const
     noexcept {
   QList<SI_NetPoint*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetPointsAtScenePos(pos, list);
+  foreach (SI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if ((item->getType() == SI_Base::Type_t::NetPoint) &&
+        item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+      list.append(static_cast<SI_NetPoint*>(item));
+    }
   }
   return list;
 }
@@ -198,8 +251,11 @@ QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const
     noexcept {
   QList<SI_NetLine*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLinesAtScenePos(pos, list);
+  foreach (SI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if ((item->getType() == SI_Base::Type_t::NetLine) &&
+        item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+      list.append(static_cast<SI_NetLine*>(item));
+    }
   }
   return list;
 }
@@ -207,8 +263,11 @@ QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const
 QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const
     noexcept {
   QList<SI_NetLabel*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLabelsAtScenePos(pos, list);
+  foreach (SI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if ((item->getType() == SI_Base::Type_t::NetLabel) &&
+        item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+      list.append(static_cast<SI_NetLabel*>(item));
+    }
   }
   return list;
 }
@@ -216,10 +275,10 @@ QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const
     noexcept {
   QList<SI_SymbolPin*> list;
-  foreach (SI_Symbol* symbol, mSymbols) {
-    foreach (SI_SymbolPin* pin, symbol->getPins()) {
-      if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-        list.append(pin);
+  foreach (SI_Base* item, getItemCandidatesAtScenePos(pos)) {
+    if ((item->getType() == SI_Base::Type_t::SymbolPin) &&
+        item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+      list.append(static_cast<SI_SymbolPin*>(item));
     }
   }
   return list;
@@ -231,6 +290,7 @@ QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const
 
 void Schematic::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -258,7 +318,13 @@ void Schematic::addSymbol(SI_Symbol& symbol) {
   }
   // add to schematic
   symbol.addToSchematic();  // can throw
+  if (mHasGraphicsItems) {
+    symbol.buildGraphicsItems();
+  } else {
+    symbol.releaseGraphicsItems();
+  }
   mSymbols.append(&symbol);
+  mIsModified = true;
 }
 
 void Schematic::removeSymbol(SI_Symbol& symbol) {
@@ -268,6 +334,13 @@ void Schematic::removeSymbol(SI_Symbol& symbol) {
   // remove from schematic
   symbol.removeFromSchematic();  // can throw
   mSymbols.removeOne(&symbol);
+  mScheduledSymbolGraphicsItemUpdates.remove(&symbol);
+  mIsModified = true;
+}
+
+void Schematic::scheduleSymbolGraphicsItemUpdate(SI_Symbol& symbol) noexcept {
+  mScheduledSymbolGraphicsItemUpdates.insert(&symbol);
+  mSymbolGraphicsItemUpdateTimer.start();
 }
 
 /*******************************************************************************
@@ -295,7 +368,13 @@ void Schematic::addNetSegment(SI_NetSegment& netsegment) {
   }
   // add to schematic
   netsegment.addToSchematic();  // can throw
+  if (mHasGraphicsItems) {
+    netsegment.buildGraphicsItems();
+  } else {
+    netsegment.releaseGraphicsItems();
+  }
   mNetSegments.append(&netsegment);
+  mIsModified = true;
 }
 
 void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
@@ -305,6 +384,7 @@ void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
   // remove from schematic
   netsegment.removeFromSchematic();  // can throw
   mNetSegments.removeOne(&netsegment);
+  mIsModified = true;
 }
 
 /*******************************************************************************
@@ -316,6 +396,9 @@ void Schematic::addToProject() {
     throw LogicError(__FILE__, __LINE__);
   }
 
+  mGraphicsScene->beginBulkChanges();
+  auto bulkGuard = scopeGuard([this]() { mGraphicsScene->endBulkChanges(); });
+
   ScopeGuardList sgl(mSymbols.count() + mNetSegments.count());
   foreach (SI_Symbol* symbol, mSymbols) {
     symbol->addToSchematic();  // can throw
@@ -336,6 +419,9 @@ void Schematic::removeFromProject() {
     throw LogicError(__FILE__, __LINE__);
   }
 
+  mGraphicsScene->beginBulkChanges();
+  auto bulkGuard = scopeGuard([this]() { mGraphicsScene->endBulkChanges(); });
+
   ScopeGuardList sgl(mSymbols.count() + mNetSegments.count());
   foreach (SI_NetSegment* segment, mNetSegments) {
     segment->removeFromSchematic();  // can throw
@@ -352,19 +438,62 @@ void Schematic::removeFromProject() {
 
 void Schematic::save() {
   if (mIsAddedToProject) {
-    // save schematic file
-    SExpression doc(serializeToDomElement("librepcb_schematic"));  // can throw
-    mDirectory->write(getFilePath().getFilename(),
-                      doc.toByteArray());  // can throw
+    // save schematic file (only if modified since it is expensive)
+    if (mIsModified) {
+      SExpression doc(
+          serializeToDomElement("librepcb_schematic"));  // can throw
+      mDirectory->write(getFilePath().getFilename(),
+                        doc.toByteArray());  // can throw
+    }
   } else {
     mDirectory->removeDirRecursively();  // can throw
   }
+  mIsModified = false;
+}
+
+void Schematic::buildGraphicsItems() noexcept {
+  if (!mHasGraphicsItems) {
+    mGraphicsScene->beginBulkChanges();
+    foreach (SI_Symbol* symbol, mSymbols) { symbol->buildGraphicsItems(); }
+    foreach (SI_NetSegment* segment, mNetSegments) {
+      segment->buildGraphicsItems();
+    }
+    mGraphicsScene->endBulkChanges();
+    mHasGraphicsItems = true;
+  }
+  if (mGraphicsScene->views().isEmpty()) {
+    mGraphicsItemsReleaseTimer.start();
+  }
+}
+
+void Schematic::releaseGraphicsItems() noexcept {
+  mGraphicsItemsReleaseTimer.stop();
+  if (mHasGraphicsItems) {
+    mGraphicsScene->beginBulkChanges();
+    foreach (SI_NetSegment* segment, mNetSegments) {
+      segment->releaseGraphicsItems();
+    }
+    foreach (SI_Symbol* symbol, mSymbols) { symbol->releaseGraphicsItems(); }
+    mGraphicsScene->endBulkChanges();
+    mHasGraphicsItems = false;
+  }
 }
 
 void Schematic::showInView(GraphicsView& view) noexcept {
+  buildGraphicsItems();
+  mGraphicsItemsReleaseTimer.stop();
   view.setScene(mGraphicsScene.data());
 }
 
+void Schematic::hideFromView(GraphicsView& view) noexcept {
+  if (view.scene() == mGraphicsScene.data()) {
+    view.setScene(nullptr);
+  }
+  if (mHasGraphicsItems && mGraphicsScene->views().isEmpty()) {
+    mGraphicsItemsReleaseTimer.start();
+  }
+}
+
 void Schematic::setSelectionRect(const Point& p1, const Point& p2,
                                  bool updateItems) noexcept {
   mGraphicsScene->setSelectionRect(p1, p2);
@@ -395,10 +524,13 @@ void Schematic::updateAllNetLabelAnchors() noexcept {
   }
 }
 
-void Schematic::renderToQPainter(QPainter& painter) const noexcept {
-  mGraphicsScene->render(&painter, QRectF(),
-                         mGraphicsScene->itemsBoundingRect(),
-                         Qt::KeepAspectRatio);
+QRectF Schematic::getGraphicsItemsBoundingRect() const noexcept {
+  return mGraphicsScene->itemsBoundingRect();
+}
+
+void Schematic::renderToQPainter(QPainter& painter, const QRectF& target,
+                                 const QRectF& source) const noexcept {
+  mGraphicsScene->render(&painter, target, source, Qt::KeepAspectRatio);
 }
 
 std::unique_ptr<SchematicSelectionQuery> Schematic::createSelectionQuery() const
@@ -431,7 +563,42 @@ QVector<const AttributeProvider*> Schematic::getAttributeProviderParents() const
  ******************************************************************************/
 
 void Schematic::updateIcon() noexcept {
+  // Note: While loading a project, the graphics items are released right after
+  // rendering the icon to keep only the shown page in memory.
+  bool release = !mHasGraphicsItems;
+  buildGraphicsItems();
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
+  if (release) {
+    releaseGraphicsItems();
+  }
+}
+
+void Schematic::releaseGraphicsItemsIfHidden() noexcept {
+  if (mGraphicsScene->views().isEmpty()) {
+    releaseGraphicsItems();
+  }
+}
+
+void Schematic::updateScheduledSymbolGraphicsItems() noexcept {
+  QList<SI_Symbol*> symbols = mScheduledSymbolGraphicsItemUpdates.toList();
+  mScheduledSymbolGraphicsItemUpdates.clear();
+  SI_Symbol::updateGraphicsItems(symbols);
+}
+
+QList<SI_Base*> Schematic::getItemCandidatesAtScenePos(const Point& pos) const
+    noexcept {
+  // Note: Same as in Board, the BSP tree of the graphics scene is used to avoid
+  // iterating over all schematic items.
+  QList<SI_Base*> items;
+  foreach (QGraphicsItem* graphicsItem,
+           mGraphicsScene->items(pos.toPxQPointF(),
+                                 Qt::IntersectsItemBoundingRect,
+                                 Qt::DescendingOrder)) {
+    if (SI_Base* item = mItemsByGraphicsItem.value(graphicsItem)) {
+      items.append(item);
+    }
+  }
+  return items;
 }
 
 void Schematic::serialize(SExpression& root) const {
@@ -452,7 +619,13 @@ void Schematic::serialize(SExpression& root) const {
 Schematic* Schematic::create(Project&                                project,
                              std::unique_ptr<TransactionalDirectory> directory,
                              const ElementName&                      name) {
-  return new Schematic(project, std::move(directory), true, *name);
+  return new Schematic(project, std::move(directory), true, *name, nullptr);
+}
+
+SExpression Schematic::parseFile(const TransactionalDirectory& directory) {
+  QString fileName = "schematic.lp";
+  return SExpression::parse(directory.read(fileName),
+                            directory.getAbsPath(fileName));  // can throw
 }
 
 /*******************************************************************************
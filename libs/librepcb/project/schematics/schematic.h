@@ -111,8 +111,9 @@ public:
   // Constructors / Destructor
   Schematic()                       = delete;
   Schematic(const Schematic& other) = delete;
-  Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory)
-    : Schematic(project, std::move(directory), false, QString()) {}
+  Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
+            const SExpression& root)
+    : Schematic(project, std::move(directory), false, QString(), &root) {}
   ~Schematic() noexcept;
 
   // Getters: General
@@ -123,14 +124,69 @@ public:
   }
   GraphicsScene&  getGraphicsScene() const noexcept { return *mGraphicsScene; }
   bool            isEmpty() const noexcept;
+
+  /**
+   * @brief Check whether the graphics items of all schematic items exist
+   *
+   * Methods which depend on the graphics scene (e.g. #getItemsAtScenePos()
+   * or #renderToQPainter()) require the graphics items to be built with
+   * #buildGraphicsItems() first.
+   *
+   * @return True if the graphics items exist, false if they were released
+   */
+  bool hasGraphicsItems() const noexcept { return mHasGraphicsItems; }
+
+  /**
+   * @brief Get the (estimated) memory usage of this schematic
+   *
+   * Counts all schematic items and, if they currently exist, their graphics
+   * items. Library elements are not counted since they are owned by the
+   * project library.
+   *
+   * @return Memory usage in bytes
+   */
+  qint64 getMemoryUsage() const noexcept;
+
   QList<SI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
   QList<SI_NetPoint*>  getNetPointsAtScenePos(const Point& pos) const noexcept;
   QList<SI_NetLine*>   getNetLinesAtScenePos(const Point& pos) const noexcept;
   QList<SI_NetLabel*>  getNetLabelsAtScenePos(const Point& pos) const noexcept;
   QList<SI_SymbolPin*> getPinsAtScenePos(const Point& pos) const noexcept;
 
+  // Graphics Item Registration
+
+  /**
+   * @brief Register the graphics item of a schematic item
+   *
+   * This is used to find schematic items at a specific position through the
+   * spatial index of the graphics scene (see #getItemsAtScenePos()). It is
+   * called by librepcb::project::SI_Base when an item is added to the
+   * schematic.
+   *
+   * @param graphicsItem  The graphics item added to the scene
+   * @param item          The schematic item the graphics item belongs to
+   */
+  void registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                            SI_Base&             item) noexcept {
+    mItemsByGraphicsItem.insert(&graphicsItem, &item);
+  }
+  void unregisterGraphicsItem(const QGraphicsItem& graphicsItem) noexcept {
+    mItemsByGraphicsItem.remove(&graphicsItem);
+  }
+
+  /**
+   * @brief Check whether the schematic file needs to be written by #save()
+   *
+   * The flag is set by all modifications of the schematic and its items (which
+   * must be done with undo commands) and is cleared by #save().
+   *
+   * @return True if the schematic was modified since it was loaded or saved
+   */
+  bool isModified() const noexcept { return mIsModified; }
+
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
+  void setModified() noexcept { mIsModified = true; }
 
   // Getters: Attributes
   const Uuid&        getUuid() const noexcept { return mUuid; }
@@ -143,6 +199,18 @@ public:
   void              addSymbol(SI_Symbol& symbol);
   void              removeSymbol(SI_Symbol& symbol);
 
+  /**
+   * @brief Update the graphics item of a symbol as soon as the event loop is
+   *        idle
+   *
+   * All symbols scheduled until then (e.g. all symbols after modifying a
+   * project attribute) are updated together, see
+   * librepcb::project::SI_Symbol::updateGraphicsItems().
+   *
+   * @param symbol  A symbol which is added to this schematic
+   */
+  void scheduleSymbolGraphicsItemUpdate(SI_Symbol& symbol) noexcept;
+
   // NetSegment Methods
   SI_NetSegment* getNetSegmentByUuid(const Uuid& uuid) const noexcept;
   void           addNetSegment(SI_NetSegment& netsegment);
@@ -152,14 +220,35 @@ public:
   void addToProject();
   void removeFromProject();
   void save();
+
+  /**
+   * @brief Create the graphics items of all schematic items (if not done yet)
+   *
+   * Graphics items are only created on demand since only one schematic page
+   * is shown at a time. If the schematic is not shown in a view, the graphics
+   * items are released again automatically after some time.
+   */
+  void buildGraphicsItems() noexcept;
+
+  /**
+   * @brief Destroy the graphics items of all schematic items
+   *
+   * Only the schematic items are kept, which is enough for everything except
+   * showing, exporting or picking items.
+   */
+  void releaseGraphicsItems() noexcept;
+
   void showInView(GraphicsView& view) noexcept;
+  void hideFromView(GraphicsView& view) noexcept;
   void saveViewSceneRect(const QRectF& rect) noexcept { mViewRect = rect; }
   const QRectF& restoreViewSceneRect() const noexcept { return mViewRect; }
   void          setSelectionRect(const Point& p1, const Point& p2,
                                  bool updateItems) noexcept;
   void          clearSelection() const noexcept;
   void          updateAllNetLabelAnchors() noexcept;
-  void          renderToQPainter(QPainter& painter) const noexcept;
+  QRectF        getGraphicsItemsBoundingRect() const noexcept;
+  void          renderToQPainter(QPainter& painter, const QRectF& target,
+                                 const QRectF& source) const noexcept;
   std::unique_ptr<SchematicSelectionQuery> createSelectionQuery() const
       noexcept;
 
@@ -180,6 +269,18 @@ public:
                            std::unique_ptr<TransactionalDirectory> directory,
                            const ElementName&                      name);
 
+  /**
+   * @brief Read and parse the schematic file of a schematic directory
+   *
+   * @note This method doesn't access any project data and thus can be called
+   *       from worker threads, as long as the directory is not modified.
+   *
+   * @param directory   The schematic directory
+   *
+   * @return The parsed file, to be passed to the constructor
+   */
+  static SExpression parseFile(const TransactionalDirectory& directory);
+
 signals:
 
   /// @copydoc AttributeProvider::attributesChanged()
@@ -187,8 +288,12 @@ signals:
 
 private:
   Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
-            bool create, const QString& newName);
-  void updateIcon() noexcept;
+            bool create, const QString& newName, const SExpression* root);
+  void            updateIcon() noexcept;
+  void            updateScheduledSymbolGraphicsItems() noexcept;
+  void            releaseGraphicsItemsIfHidden() noexcept;
+  QList<SI_Base*> getItemCandidatesAtScenePos(const Point& pos) const
+      noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -197,10 +302,13 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool                                    mIsAddedToProject;
+  bool                                    mIsModified;
 
   QScopedPointer<GraphicsScene>  mGraphicsScene;
   QScopedPointer<GridProperties> mGridProperties;
   QRectF                         mViewRect;
+  bool                           mHasGraphicsItems;
+  QTimer                         mGraphicsItemsReleaseTimer;
 
   // Attributes
   Uuid        mUuid;
@@ -209,6 +317,13 @@ private:
 
   QList<SI_Symbol*>     mSymbols;
   QList<SI_NetSegment*> mNetSegments;
+
+  // Symbols whose graphics items need to be updated
+  QSet<SI_Symbol*> mScheduledSymbolGraphicsItemUpdates;
+  QTimer           mSymbolGraphicsItemUpdateTimer;
+
+  // Schematic items by their graphics items
+  QHash<const QGraphicsItem*, SI_Base*> mItemsByGraphicsItem;
 };
 
 /*******************************************************************************
@@ -39,7 +39,7 @@ namespace project {
  ******************************************************************************/
 
 ProjectSettings::ProjectSettings(Project& project, bool create)
-  : QObject(nullptr), mProject(project) {
+  : QObject(nullptr), mProject(project), mIsModified(create) {
   qDebug() << "load settings...";
 
   // restore all default values
@@ -66,6 +66,7 @@ ProjectSettings::ProjectSettings(Project& project, bool create)
       mNormOrder.append(node.getValueOfFirstChild<QString>(true));
     }
   }
+  mIsModified = create;
 
   triggerSettingsChanged();
 
@@ -82,6 +83,7 @@ ProjectSettings::~ProjectSettings() noexcept {
 void ProjectSettings::restoreDefaults() noexcept {
   mLocaleOrder.clear();
   mNormOrder.clear();
+  mIsModified = true;
 }
 
 void ProjectSettings::triggerSettingsChanged() noexcept {
@@ -89,10 +91,13 @@ void ProjectSettings::triggerSettingsChanged() noexcept {
 }
 
 void ProjectSettings::save() {
-  SExpression doc(
-      serializeToDomElement("librepcb_project_settings"));  // can throw
-  mProject.getDirectory().write("project/settings.lp",
-                                doc.toByteArray());  // can throw
+  if (mIsModified) {
+    SExpression doc(
+        serializeToDomElement("librepcb_project_settings"));  // can throw
+    mProject.getDirectory().write("project/settings.lp",
+                                  doc.toByteArray());  // can throw
+    mIsModified = false;
+  }
 }
 
 /*******************************************************************************
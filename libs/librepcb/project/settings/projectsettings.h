@@ -57,12 +57,18 @@ public:
   // Getters: Settings
   const QStringList& getLocaleOrder() const noexcept { return mLocaleOrder; }
   const QStringList& getNormOrder() const noexcept { return mNormOrder; }
+  bool               isModified() const noexcept { return mIsModified; }
 
   // Setters: Settings
   void setLocaleOrder(const QStringList& locales) noexcept {
     mLocaleOrder = locales;
+    mIsModified  = true;
   }
-  void setNormOrder(const QStringList& norms) noexcept { mNormOrder = norms; }
+  void setNormOrder(const QStringList& norms) noexcept {
+    mNormOrder  = norms;
+    mIsModified = true;
+  }
+  void setModified() noexcept { mIsModified = true; }
 
   // General Methods
   void restoreDefaults() noexcept;
@@ -91,6 +97,7 @@ private:
   QStringList
               mLocaleOrder;  ///< The list of locales (like "de_CH") in the right order
   QStringList mNormOrder;  ///< the list of norms in the right order
+  bool        mIsModified;  ///< whether #save() needs to write the file
 };
 
 /*******************************************************************************
@@ -29,6 +29,7 @@
 #include "boardlayerstacksetupdialog.h"
 #include "fabricationoutputdialog.h"
 #include "fsm/bes_fsm.h"
+#include "routingstatisticsdock.h"
 #include "ui_boardeditor.h"
 #include "unplacedcomponentsdock.h"
 
@@ -37,12 +38,15 @@
 #include <librepcb/common/dialogs/boarddesignrulesdialog.h>
 #include <librepcb/common/dialogs/filedialog.h>
 #include <librepcb/common/dialogs/gridsettingsdialog.h>
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/common/undostack.h>
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
+#include <librepcb/project/boards/boardusersettings.h>
 #include <librepcb/project/boards/cmd/cmdboardadd.h>
 #include <librepcb/project/boards/cmd/cmdboarddesignrulesmodify.h>
 #include <librepcb/project/boards/cmd/cmdboardremove.h>
@@ -76,9 +80,12 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
     mGraphicsView(nullptr),
     mActiveBoard(nullptr),
     mBoardListActionGroup(this),
+    mPlanesRebuildLabel(nullptr),
+    mPlanesRebuildCancelButton(nullptr),
     mErcMsgDock(nullptr),
     mUnplacedComponentsDock(nullptr),
     mBoardLayersDock(nullptr),
+    mRoutingStatisticsDock(nullptr),
     mFsm(nullptr) {
   mUi->setupUi(this);
   mUi->lblUnplacedComponentsNote->hide();
@@ -107,6 +114,9 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mErcMsgDock = new ErcMsgDock(mProject);
   addDockWidget(Qt::RightDockWidgetArea, mErcMsgDock, Qt::Vertical);
   tabifyDockWidget(mBoardLayersDock, mErcMsgDock);
+  mRoutingStatisticsDock = new RoutingStatisticsDock(mProject);
+  addDockWidget(Qt::RightDockWidgetArea, mRoutingStatisticsDock, Qt::Vertical);
+  tabifyDockWidget(mErcMsgDock, mRoutingStatisticsDock);
   mUnplacedComponentsDock->raise();
 
   // add graphics view as central widget
@@ -153,6 +163,8 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
           [this]() { mProjectEditor.execNetClassesEditorDialog(this); });
   connect(mUi->actionProjectSettings, &QAction::triggered,
           [this]() { mProjectEditor.execProjectSettingsDialog(this); });
+  connect(mUi->actionMemoryUsage, &QAction::triggered,
+          [this]() { mProjectEditor.execMemoryUsageDialog(this); });
   connect(mUi->actionExportLppz, &QAction::triggered,
           [this]() { mProjectEditor.execLppzExportDialog(this); });
 
@@ -220,6 +232,16 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
     mFsm->processEvent(new BEE_Base(BEE_Base::Edit_Remove), true);
   });
 
+  // rebuild planes automatically after modifications of the board (deferred to
+  // not start a new rebuild for every single move event while routing)
+  mPlanesRebuildTimer.setSingleShot(true);
+  mPlanesRebuildTimer.setInterval(300);
+  connect(&mPlanesRebuildTimer, &QTimer::timeout, [this]() {
+    if (mActiveBoard) mActiveBoard->scheduleAllPlanesRebuild();
+  });
+  connect(&mProjectEditor.getUndoStack(), &UndoStack::stateModified, this,
+          &BoardEditor::undoStackStateModified);
+
   // setup status bar
   mUi->statusbar->setFields(StatusBar::AbsolutePosition |
                             StatusBar::ProgressBar);
@@ -230,6 +252,19 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
           mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
 
+  // show a cancelable indicator while planes are rebuilt in the background
+  mPlanesRebuildLabel = new QLabel(tr("Rebuilding planes..."));
+  mUi->statusbar->addPermanentWidget(mPlanesRebuildLabel);
+  mPlanesRebuildCancelButton = new QToolButton();
+  mPlanesRebuildCancelButton->setIcon(QIcon(":/img/actions/stop.png"));
+  mPlanesRebuildCancelButton->setToolTip(tr("Cancel rebuilding planes"));
+  mPlanesRebuildCancelButton->setAutoRaise(true);
+  mUi->statusbar->addPermanentWidget(mPlanesRebuildCancelButton);
+  connect(mPlanesRebuildCancelButton, &QToolButton::clicked, [this]() {
+    if (mActiveBoard) mActiveBoard->cancelPlanesRebuild();
+  });
+  updatePlanesRebuildIndicator();
+
   // Restore Window Geometry
   QSettings clientSettings;
   restoreGeometry(
@@ -258,6 +293,8 @@ BoardEditor::~BoardEditor() {
   mFsm = nullptr;
   qDeleteAll(mBoardListActions);
   mBoardListActions.clear();
+  delete mRoutingStatisticsDock;
+  mRoutingStatisticsDock = nullptr;
   delete mBoardLayersDock;
   mBoardLayersDock = nullptr;
   delete mUnplacedComponentsDock;
@@ -282,30 +319,51 @@ void BoardEditor::setActiveBoardIndex(int index) noexcept {
       // stop airwire rebuild on every project modification (for performance
       // reasons)
       disconnect(&mProjectEditor.getUndoStack(), &UndoStack::stateModified,
-                 mActiveBoard.data(), &Board::triggerAirWiresRebuild);
+                 mActiveBoard.data(), &Board::triggerAirWiresRebuildDeferred);
+      disconnect(mActiveBoard.data(), &Board::planesRebuildRunningChanged,
+                 this, &BoardEditor::updatePlanesRebuildIndicator);
       // save current view scene rect
       mActiveBoard->saveViewSceneRect(mGraphicsView->getVisibleSceneRect());
     }
     mActiveBoard = newBoard;
     if (mActiveBoard) {
+      // load the board items if the board was opened lazily
+      try {
+        mActiveBoard->load();  // can throw
+      } catch (const Exception& e) {
+        QMessageBox::critical(this, tr("Error"), e.getMsg());
+      }
       // show scene, restore view scene rect, set grid properties
+      mActiveBoard->getGraphicsScene().invalidateCulledItems();
       mActiveBoard->showInView(*mGraphicsView);
       mGraphicsView->setVisibleSceneRect(mActiveBoard->restoreViewSceneRect());
       mGraphicsView->setGridProperties(mActiveBoard->getGridProperties());
-      // force airwire rebuild immediately and on every project modification
-      mActiveBoard->triggerAirWiresRebuild();
+      // rebuild airwires as soon as the editor is shown and after project
+      // modifications (deferred, so a command group appending many child
+      // commands in a row rebuilds the airwires only once)
+      mActiveBoard->triggerAirWiresRebuildDeferred();
       connect(&mProjectEditor.getUndoStack(), &UndoStack::stateModified,
-              mActiveBoard.data(), &Board::triggerAirWiresRebuild);
+              mActiveBoard.data(), &Board::triggerAirWiresRebuildDeferred);
+      connect(mActiveBoard.data(), &Board::planesRebuildRunningChanged, this,
+              &BoardEditor::updatePlanesRebuildIndicator);
     } else {
       mGraphicsView->setScene(nullptr);
     }
 
+    // the pending plane rebuild belongs to the previous board
+    mPlanesRebuildTimer.stop();
+
     // update dock widgets
     mUnplacedComponentsDock->setBoard(mActiveBoard);
     mBoardLayersDock->setActiveBoard(mActiveBoard);
+    mRoutingStatisticsDock->setBoard(mActiveBoard);
   }
 
   // update GUI
+  updatePlanesRebuildIndicator();
+  mUi->actionAutoRebuildPlanes->setEnabled(!mActiveBoard.isNull());
+  mUi->actionAutoRebuildPlanes->setChecked(
+      mActiveBoard && mActiveBoard->getUserSettings().getPlanesAutoRebuild());
   mUi->tabBar->setCurrentIndex(index);
   for (int i = 0; i < mBoardListActions.count(); ++i) {
     mBoardListActions.at(i)->setChecked(i == index);
@@ -514,11 +572,51 @@ void BoardEditor::on_actionModifyDesignRules_triggered() {
 void BoardEditor::on_actionRebuildPlanes_triggered() {
   Board* board = getActiveBoard();
   if (board) {
-    board->rebuildAllPlanes();
+    board->scheduleAllPlanesRebuild();
     board->forceAirWiresRebuild();
   }
 }
 
+void BoardEditor::on_actionAutoRebuildPlanes_triggered(bool checked) {
+  Board* board = getActiveBoard();
+  if (board) {
+    board->getUserSettings().setPlanesAutoRebuild(checked);
+    if (checked) board->scheduleAllPlanesRebuild();
+  }
+}
+
+void BoardEditor::on_actionRunDesignRuleCheck_triggered() {
+  Board* board = getActiveBoard();
+  if (!board) return;
+
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  // check the same copper as the fabrication output and the CLI
+  board->rebuildAllPlanesForFabrication();
+  const BoardDesignRuleCheck& drc = board->runDesignRuleCheck();
+  QApplication::restoreOverrideCursor();
+
+  const QVector<BoardDesignRuleCheck::Violation>& violations =
+      drc.getViolations();
+  if (violations.isEmpty()) {
+    QMessageBox::information(this, tr("Design Rule Check"),
+                             tr("No clearance violations found."));
+    return;
+  }
+  QStringList lines;
+  foreach (const BoardDesignRuleCheck::Violation& violation, violations) {
+    lines.append(QString("%1: %2 (%3, %4)")
+                     .arg(violation.layer, violation.message,
+                          violation.position.getX().toMmString(),
+                          violation.position.getY().toMmString()));
+  }
+  QMessageBox box(QMessageBox::Warning, tr("Design Rule Check"),
+                  QString(tr("%1 clearance violation(s) found."))
+                      .arg(violations.count()),
+                  QMessageBox::Ok, this);
+  box.setDetailedText(lines.join("\n"));
+  box.exec();
+}
+
 void BoardEditor::on_tabBar_currentChanged(int index) {
   setActiveBoardIndex(index);
 }
@@ -577,6 +675,22 @@ void BoardEditor::unplacedComponentsCountChanged(int count) noexcept {
   mUi->lblUnplacedComponentsNote->setVisible(count > 0);
 }
 
+void BoardEditor::undoStackStateModified() noexcept {
+  if (mActiveBoard) {
+    // items outside the viewport might have been modified
+    mActiveBoard->getGraphicsScene().invalidateCulledItems();
+  }
+  if (mActiveBoard && mActiveBoard->getUserSettings().getPlanesAutoRebuild()) {
+    mPlanesRebuildTimer.start();  // restarts the timer if already running
+  }
+}
+
+void BoardEditor::updatePlanesRebuildIndicator() noexcept {
+  bool running = mActiveBoard && mActiveBoard->isPlanesRebuildRunning();
+  mPlanesRebuildLabel->setVisible(running);
+  mPlanesRebuildCancelButton->setVisible(running);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -51,6 +51,7 @@ class ProjectEditor;
 class ErcMsgDock;
 class UnplacedComponentsDock;
 class BoardLayersDock;
+class RoutingStatisticsDock;
 class BES_FSM;
 
 namespace Ui {
@@ -107,6 +108,8 @@ private slots:
   void on_actionLayerStackSetup_triggered();
   void on_actionModifyDesignRules_triggered();
   void on_actionRebuildPlanes_triggered();
+  void on_actionAutoRebuildPlanes_triggered(bool checked);
+  void on_actionRunDesignRuleCheck_triggered();
   void on_tabBar_currentChanged(int index);
   void on_lblUnplacedComponentsNote_linkActivated();
   void boardListActionGroupTriggered(QAction* action);
@@ -121,6 +124,8 @@ private:
   bool graphicsViewEventHandler(QEvent* event);
   void toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
   void unplacedComponentsCountChanged(int count) noexcept;
+  void undoStackStateModified() noexcept;
+  void updatePlanesRebuildIndicator() noexcept;
 
   // General Attributes
   ProjectEditor&                       mProjectEditor;
@@ -134,11 +139,15 @@ private:
   QPointer<Board> mActiveBoard;
   QList<QAction*> mBoardListActions;
   QActionGroup    mBoardListActionGroup;
+  QTimer          mPlanesRebuildTimer;
+  QLabel*         mPlanesRebuildLabel;         ///< Owned by the status bar
+  QToolButton*    mPlanesRebuildCancelButton;  ///< Owned by the status bar
 
   // Docks
   ErcMsgDock*             mErcMsgDock;
   UnplacedComponentsDock* mUnplacedComponentsDock;
   BoardLayersDock*        mBoardLayersDock;
+  RoutingStatisticsDock*  mRoutingStatisticsDock;
 
   // Finite State Machine
   BES_FSM* mFsm;
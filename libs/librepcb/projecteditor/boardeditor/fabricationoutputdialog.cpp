@@ -77,8 +77,13 @@ FabricationOutputDialog::FabricationOutputDialog(Board& board, QWidget* parent)
   mUi->edtSuffixSolderPasteTop->setText(s.getSuffixSolderPasteTop());
   mUi->edtSuffixSolderPasteBot->setText(s.getSuffixSolderPasteBot());
   mUi->cbxDrillsMerge->setChecked(s.getMergeDrillFiles());
+  mUi->cbxCopperMergeAreas->setChecked(s.getMergeCopperAreas());
+  mUi->cbxCopperRecoverArcs->setChecked(s.getRecoverCopperArcs());
   mUi->cbxSolderPasteTop->setChecked(s.getEnableSolderPasteTop());
   mUi->cbxSolderPasteBot->setChecked(s.getEnableSolderPasteBot());
+  mUi->spbxPanelColumns->setValue(s.getPanelColumns());
+  mUi->spbxPanelRows->setValue(s.getPanelRows());
+  mUi->spbxPanelSpacing->setValue(s.getPanelSpacing()->toMm());
 
   QStringList topSilkscreen = s.getSilkscreenLayersTop();
   mUi->cbxSilkTopPlacement->setChecked(
@@ -143,7 +148,7 @@ void FabricationOutputDialog::on_btnProtelSuffixes_clicked() {
 void FabricationOutputDialog::on_btnGenerate_clicked() {
   try {
     // rebuild planes because they may be outdated!
-    mBoard.rebuildAllPlanes();
+    mBoard.rebuildAllPlanesForFabrication();
 
     // update fabrication output settings if modified
     BoardFabricationOutputSettings s = mBoard.getFabricationOutputSettings();
@@ -164,10 +169,17 @@ void FabricationOutputDialog::on_btnGenerate_clicked() {
     s.setSilkscreenLayersTop(getTopSilkscreenLayers());
     s.setSilkscreenLayersBot(getBotSilkscreenLayers());
     s.setMergeDrillFiles(mUi->cbxDrillsMerge->isChecked());
+    s.setMergeCopperAreas(mUi->cbxCopperMergeAreas->isChecked());
+    s.setRecoverCopperArcs(mUi->cbxCopperRecoverArcs->isChecked());
     s.setEnableSolderPasteTop(mUi->cbxSolderPasteTop->isChecked());
     s.setEnableSolderPasteBot(mUi->cbxSolderPasteBot->isChecked());
+    s.setPanelColumns(mUi->spbxPanelColumns->value());
+    s.setPanelRows(mUi->spbxPanelRows->value());
+    s.setPanelSpacing(
+        UnsignedLength(Length::fromMm(mUi->spbxPanelSpacing->value())));
     if (s != mBoard.getFabricationOutputSettings()) {
       mBoard.getFabricationOutputSettings() = s;  // TODO: use undo command
+      mBoard.setModified();
     }
 
     // generate files
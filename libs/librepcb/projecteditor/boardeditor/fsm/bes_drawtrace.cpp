@@ -655,9 +655,9 @@ void BES_DrawTrace::updateNetpointPositions(const Point& cursorPos) noexcept {
       mFixedStartAnchor->getPosition(), cursorPos, mCurrentWireMode));
   mPositioningNetPoint2->setPosition(cursorPos);
 
-  // Force updating airwires immediately as they are important for creating
-  // traces.
-  mPositioningNetPoint2->getBoard().triggerAirWiresRebuild();
+  // Update airwires as soon as possible as they are important for creating
+  // traces (but only once per burst of mouse move events).
+  mPositioningNetPoint2->getBoard().triggerAirWiresRebuildDeferred();
 }
 
 void BES_DrawTrace::layerComboBoxIndexChanged(int index) noexcept {
@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "routingstatisticsdock.h"
+
+#include "ui_routingstatisticsdock.h"
+
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+RoutingStatisticsDock::RoutingStatisticsDock(Project& project) noexcept
+  : QDockWidget(nullptr),
+    mProject(project),
+    mUi(new Ui::RoutingStatisticsDock),
+    mBoard(nullptr),
+    mItems(),
+    mScheduledNetSignals(),
+    mUpdateTimer() {
+  mUi->setupUi(this);
+  mUi->treeWidget->sortByColumn(0, Qt::AscendingOrder);
+
+  mUpdateTimer.setSingleShot(true);
+  mUpdateTimer.setInterval(100);
+  connect(&mUpdateTimer, &QTimer::timeout, this,
+          &RoutingStatisticsDock::updateScheduledItems);
+
+  Circuit& circuit = mProject.getCircuit();
+  connect(&circuit, &Circuit::netSignalAdded, this,
+          &RoutingStatisticsDock::addNetSignal);
+  connect(&circuit, &Circuit::netSignalRemoved, this,
+          &RoutingStatisticsDock::removeNetSignal);
+  foreach (NetSignal* netsignal, circuit.getNetSignals()) {
+    addNetSignal(*netsignal);
+  }
+}
+
+RoutingStatisticsDock::~RoutingStatisticsDock() noexcept {
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void RoutingStatisticsDock::setBoard(Board* board) noexcept {
+  if (board != mBoard) {
+    mBoard = board;
+    mScheduledNetSignals.clear();
+    mUpdateTimer.stop();
+    for (auto it = mItems.constBegin(); it != mItems.constEnd(); ++it) {
+      updateItem(*it.key());
+    }
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void RoutingStatisticsDock::addNetSignal(NetSignal& netsignal) noexcept {
+  Q_ASSERT(!mItems.contains(&netsignal));
+  mItems.insert(&netsignal, new QTreeWidgetItem(mUi->treeWidget));
+  updateItem(netsignal);
+  connect(&netsignal, &NetSignal::nameChanged, this,
+          [this, &netsignal]() { scheduleUpdate(netsignal); });
+  connect(&netsignal, &NetSignal::boardRoutingStatisticsChanged, this,
+          [this, &netsignal](const Board& board) {
+            if (&board == mBoard) {
+              scheduleUpdate(netsignal);
+            }
+          });
+}
+
+void RoutingStatisticsDock::removeNetSignal(NetSignal& netsignal) noexcept {
+  disconnect(&netsignal, nullptr, this, nullptr);
+  mScheduledNetSignals.remove(&netsignal);
+  delete mItems.take(&netsignal);
+}
+
+void RoutingStatisticsDock::scheduleUpdate(NetSignal& netsignal) noexcept {
+  mScheduledNetSignals.insert(&netsignal);
+  if (!mUpdateTimer.isActive()) {
+    mUpdateTimer.start();
+  }
+}
+
+void RoutingStatisticsDock::updateScheduledItems() noexcept {
+  mUi->treeWidget->setSortingEnabled(false);  // keep rows stable meanwhile
+  foreach (const NetSignal* netsignal, mScheduledNetSignals) {
+    updateItem(*netsignal);
+  }
+  mScheduledNetSignals.clear();
+  mUi->treeWidget->setSortingEnabled(true);
+}
+
+void RoutingStatisticsDock::updateItem(const NetSignal& netsignal) noexcept {
+  QTreeWidgetItem* item = mItems.value(&netsignal);
+  if (!item) {
+    return;
+  }
+  NetSignal::RoutingStatistics stats = mBoard
+      ? netsignal.getBoardRoutingStatistics(*mBoard)
+      : NetSignal::RoutingStatistics{};
+  item->setText(0, *netsignal.getName());
+  item->setData(1, Qt::DisplayRole, stats.trackLength.toMm());
+  item->setData(2, Qt::DisplayRole, stats.viaCount);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace project
+}  // namespace librepcb
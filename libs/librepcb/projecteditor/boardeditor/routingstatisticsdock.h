@@ -0,0 +1,98 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_ROUTINGSTATISTICSDOCK_H
+#define LIBREPCB_PROJECT_ROUTINGSTATISTICSDOCK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Project;
+class Board;
+class NetSignal;
+
+namespace editor {
+
+namespace Ui {
+class RoutingStatisticsDock;
+}
+
+/*******************************************************************************
+ *  Class RoutingStatisticsDock
+ ******************************************************************************/
+
+/**
+ * @brief Shows the track length and via count of each net of a board
+ *
+ * The values are taken from librepcb::project::NetSignal::
+ * getBoardRoutingStatistics(), which are maintained incrementally. Changes
+ * are collected and applied to the affected rows with a short delay, so
+ * moving traces does not update the list for every mouse move event.
+ */
+class RoutingStatisticsDock final : public QDockWidget {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  RoutingStatisticsDock()                                   = delete;
+  RoutingStatisticsDock(const RoutingStatisticsDock& other) = delete;
+  explicit RoutingStatisticsDock(Project& project) noexcept;
+  ~RoutingStatisticsDock() noexcept;
+
+  // Setters
+  void setBoard(Board* board) noexcept;
+
+  // Operator Overloadings
+  RoutingStatisticsDock& operator=(const RoutingStatisticsDock& rhs) = delete;
+
+private:  // Methods
+  void addNetSignal(NetSignal& netsignal) noexcept;
+  void removeNetSignal(NetSignal& netsignal) noexcept;
+  void scheduleUpdate(NetSignal& netsignal) noexcept;
+  void updateScheduledItems() noexcept;
+  void updateItem(const NetSignal& netsignal) noexcept;
+
+private:  // Data
+  Project&                                  mProject;
+  QScopedPointer<Ui::RoutingStatisticsDock> mUi;
+  Board*                                    mBoard;
+  QHash<const NetSignal*, QTreeWidgetItem*> mItems;
+  QSet<NetSignal*>                          mScheduledNetSignals;
+  QTimer                                    mUpdateTimer;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECT_ROUTINGSTATISTICSDOCK_H
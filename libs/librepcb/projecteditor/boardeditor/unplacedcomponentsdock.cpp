@@ -184,27 +184,17 @@ void UnplacedComponentsDock::on_lstUnplacedComponents_currentItemChanged(
 void UnplacedComponentsDock::on_cbxSelectedDevice_currentIndexChanged(
     int index) {
   try {
+    // Note: The file paths were already looked up when filling the combobox.
     tl::optional<Uuid> deviceUuid = Uuid::tryFromString(
         mUi->cbxSelectedDevice->itemData(index, Qt::UserRole).toString());
-    FilePath devFp;
-    if (deviceUuid)
-      devFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestDevice(
-          *deviceUuid);
-    if (devFp.isValid()) {
-      const library::Device* device = new library::Device(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(devFp))));
-      FilePath pkgFp =
-          mProjectEditor.getWorkspace().getLibraryDb().getLatestPackage(
-              device->getPackageUuid());
-      if (pkgFp.isValid()) {
-        const library::Package* package = new library::Package(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(pkgFp))));
-        setSelectedDeviceAndPackage(device, package);
-      } else {
-        setSelectedDeviceAndPackage(nullptr, nullptr);
-      }
+    QPair<FilePath, FilePath> fps;
+    if (deviceUuid) fps = mDeviceFilePaths.value(*deviceUuid);
+    if (fps.first.isValid() && fps.second.isValid()) {
+      QScopedPointer<const library::Device> device(new library::Device(
+          library::Library::openElementDirectory(fps.first)));  // can throw
+      const library::Package* package = new library::Package(
+          library::Library::openElementDirectory(fps.second));  // can throw
+      setSelectedDeviceAndPackage(device.take(), package);
     } else {
       setSelectedDeviceAndPackage(nullptr, nullptr);
     }
@@ -256,7 +246,8 @@ void UnplacedComponentsDock::on_pushButton_clicked() {
 void UnplacedComponentsDock::on_btnAddAll_clicked() {
   if (!mBoard) return;
 
-  beginUndoCmdGroup();
+  QList<ComponentInstance*> components;
+  QSet<Uuid>                libComponents;
   for (int i = 0; i < mUi->lstUnplacedComponents->count(); i++) {
     tl::optional<Uuid> componentUuid = Uuid::tryFromString(
         mUi->lstUnplacedComponents->item(i)->data(Qt::UserRole).toString());
@@ -264,17 +255,28 @@ void UnplacedComponentsDock::on_btnAddAll_clicked() {
     ComponentInstance* component =
         mProject.getCircuit().getComponentInstanceByUuid(*componentUuid);
     if (component) {
-      try {
-        QList<Uuid> devices =
-            mProjectEditor.getWorkspace()
-                .getLibraryDb()
-                .getDevicesOfComponent(component->getLibComponent().getUuid())
-                .toList();
-        if (devices.count() > 0)
-          addNextDeviceToCmdGroup(*component, devices.first(), tl::nullopt);
-      } catch (const Exception& e) {
-        qCritical() << e.getMsg();
-      }
+      components.append(component);
+      libComponents.insert(component->getLibComponent().getUuid());
+    }
+  }
+
+  // Note: Many components typically share the same library component, so
+  // query the devices of all library components at once.
+  QMultiHash<Uuid, Uuid> devicesOfComponents;
+  try {
+    devicesOfComponents =
+        mProjectEditor.getWorkspace().getLibraryDb().getDevicesOfComponents(
+            libComponents);  // can throw
+  } catch (const Exception& e) {
+    qCritical() << e.getMsg();
+  }
+
+  beginUndoCmdGroup();
+  foreach (ComponentInstance* component, components) {
+    auto it = devicesOfComponents.constFind(
+        component->getLibComponent().getUuid());
+    if (it != devicesOfComponents.constEnd()) {
+      addNextDeviceToCmdGroup(*component, it.value(), tl::nullopt);
     }
   }
   commitUndoCmdGroup();
@@ -291,6 +293,7 @@ void UnplacedComponentsDock::updateComponentsList() noexcept {
 
   int selectedIndex = mUi->lstUnplacedComponents->currentRow();
   setSelectedComponentInstance(nullptr);
+  mUi->lstUnplacedComponents->setUpdatesEnabled(false);
   mUi->lstUnplacedComponents->clear();
 
   if (mBoard) {
@@ -317,6 +320,7 @@ void UnplacedComponentsDock::updateComponentsList() noexcept {
       mUi->lstUnplacedComponents->setCurrentRow(index);
     }
   }
+  mUi->lstUnplacedComponents->setUpdatesEnabled(true);
 
   setWindowTitle(QString(tr("Place Devices [%1]"))
                      .arg(mUi->lstUnplacedComponents->count()));
@@ -329,47 +333,50 @@ void UnplacedComponentsDock::setSelectedComponentInstance(
   mUi->lblNoDeviceFound->hide();
   mUi->cbxSelectedDevice->clear();
   mUi->cbxSelectedDevice->show();
+  mDeviceFilePaths.clear();
   mSelectedComponent = cmp;
 
   if (mBoard && mSelectedComponent) {
     QStringList localeOrder = mProject.getSettings().getLocaleOrder();
-    QSet<Uuid>  devices =
-        mProjectEditor.getWorkspace().getLibraryDb().getDevicesOfComponent(
-            mSelectedComponent->getLibComponent().getUuid());
-    foreach (const Uuid& deviceUuid, devices) {
-      // get device metadata
-      FilePath devFp =
-          mProjectEditor.getWorkspace().getLibraryDb().getLatestDevice(
-              deviceUuid);
-      if (!devFp.isValid()) continue;
-      QString devName;
-      mProjectEditor.getWorkspace()
-          .getLibraryDb()
-          .getElementTranslations<library::Device>(devFp, localeOrder,
-                                                   &devName);
-      Uuid pkgUuid =
-          Uuid::createRandom();  // only for initialization, will be overwritten
-      mProjectEditor.getWorkspace().getLibraryDb().getDeviceMetadata(devFp,
-                                                                     &pkgUuid);
-
-      // get package metadata
-      FilePath pkgFp =
-          mProjectEditor.getWorkspace().getLibraryDb().getLatestPackage(
-              pkgUuid);
-      if (!pkgFp.isValid()) continue;
-      QString pkgName;
-      mProjectEditor.getWorkspace()
-          .getLibraryDb()
-          .getElementTranslations<library::Package>(pkgFp, localeOrder,
-                                                    &pkgName);
-
-      if (devName.contains(pkgName, Qt::CaseInsensitive)) {
-        // Package name is already contained in device name, no need to show it.
-        mUi->cbxSelectedDevice->addItem(devName, deviceUuid.toStr());
-      } else {
-        QString text = QString("%1 [%2]").arg(devName, pkgName);
-        mUi->cbxSelectedDevice->addItem(text, deviceUuid.toStr());
+    try {
+      // Note: Batch lookups are used to get all information with only a few
+      // database queries, independent of the number of devices.
+      const workspace::WorkspaceLibraryDb& db =
+          mProjectEditor.getWorkspace().getLibraryDb();
+      QSet<Uuid> devices = db.getDevicesOfComponent(
+          mSelectedComponent->getLibComponent().getUuid());  // can throw
+      QHash<Uuid, FilePath> devFps =
+          db.getLatestElements<library::Device>(devices);  // can throw
+      QHash<FilePath, QString> devNames = db.getElementNames<library::Device>(
+          devFps.values(), localeOrder);  // can throw
+      QHash<FilePath, Uuid> devPkgUuids;
+      db.getDevicesMetadata(devFps.values(), &devPkgUuids);  // can throw
+      QHash<Uuid, FilePath> pkgFps = db.getLatestElements<library::Package>(
+          devPkgUuids.values().toSet());  // can throw
+      QHash<FilePath, QString> pkgNames = db.getElementNames<library::Package>(
+          pkgFps.values(), localeOrder);  // can throw
+
+      for (auto it = devFps.constBegin(); it != devFps.constEnd(); ++it) {
+        const Uuid&     deviceUuid = it.key();
+        const FilePath& devFp      = it.value();
+        auto            pkgUuidIt  = devPkgUuids.find(devFp);
+        if (pkgUuidIt == devPkgUuids.end()) continue;
+        FilePath pkgFp = pkgFps.value(*pkgUuidIt);
+        if (!pkgFp.isValid()) continue;
+        mDeviceFilePaths.insert(deviceUuid, qMakePair(devFp, pkgFp));
+
+        QString devName = devNames.value(devFp);
+        QString pkgName = pkgNames.value(pkgFp);
+        if (devName.contains(pkgName, Qt::CaseInsensitive)) {
+          // Package name is already contained in device name, don't show it.
+          mUi->cbxSelectedDevice->addItem(devName, deviceUuid.toStr());
+        } else {
+          QString text = QString("%1 [%2]").arg(devName, pkgName);
+          mUi->cbxSelectedDevice->addItem(text, deviceUuid.toStr());
+        }
       }
+    } catch (const Exception& e) {
+      qCritical() << e.getMsg();
     }
     if (mUi->cbxSelectedDevice->count() > 0) {
       mUi->cbxSelectedDevice->model()->sort(0);
@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/units/all_length_units.h>
 #include <librepcb/common/uuid.h>
 
@@ -136,6 +137,9 @@ private:
   bool                                         mDisableListUpdate;
   QHash<Uuid, Uuid>                            mLastDeviceOfComponent;
   QHash<Uuid, tl::optional<Uuid>>              mLastFootprintOfDevice;
+
+  /// Device and package file paths of the devices of the selected component
+  QHash<Uuid, QPair<FilePath, FilePath>> mDeviceFilePaths;
   QScopedPointer<UndoCommandGroup>             mCurrentUndoCmdGroup;
 };
 
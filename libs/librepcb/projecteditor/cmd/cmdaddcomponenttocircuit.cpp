@@ -24,6 +24,7 @@
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/library/cmp/component.h>
+#include <librepcb/library/library.h>
 #include <librepcb/project/circuit/cmd/cmdcomponentinstanceadd.h>
 #include <librepcb/project/library/cmd/cmdprojectlibraryaddelement.h>
 #include <librepcb/project/library/projectlibrary.h>
@@ -87,8 +88,7 @@ bool CmdAddComponentToCircuit::performExecute() {
               .arg(mComponentUuid.toStr()));
     }
     library::Component* cmp = new library::Component(
-        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-            TransactionalFileSystem::openRO(cmpFp))));
+        library::Library::openElementDirectory(cmpFp));
     CmdProjectLibraryAddElement<library::Component>* cmdAddToLibrary =
         new CmdProjectLibraryAddElement<library::Component>(
             mProject.getLibrary(), *cmp);
@@ -26,6 +26,7 @@
 #include <librepcb/common/scopeguard.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/dev/device.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/cmd/cmddeviceinstanceadd.h>
@@ -91,8 +92,7 @@ bool CmdAddDeviceToBoard::performExecute() {
                      "workspace library!"))
               .arg(mDeviceUuid.toStr()));
     }
-    dev = new library::Device(std::unique_ptr<TransactionalDirectory>(
-        new TransactionalDirectory(TransactionalFileSystem::openRO(devFp))));
+    dev = new library::Device(library::Library::openElementDirectory(devFp));
     CmdProjectLibraryAddElement<library::Device>* cmdAddToLibrary =
         new CmdProjectLibraryAddElement<library::Device>(
             mBoard.getProject().getLibrary(), *dev);
@@ -113,8 +113,7 @@ bool CmdAddDeviceToBoard::performExecute() {
                      "workspace library!"))
               .arg(pkgUuid.toStr()));
     }
-    pkg = new library::Package(std::unique_ptr<TransactionalDirectory>(
-        new TransactionalDirectory(TransactionalFileSystem::openRO(pkgFp))));
+    pkg = new library::Package(library::Library::openElementDirectory(pkgFp));
     CmdProjectLibraryAddElement<library::Package>* cmdAddToLibrary =
         new CmdProjectLibraryAddElement<library::Package>(
             mBoard.getProject().getLibrary(), *pkg);
@@ -25,6 +25,7 @@
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/scopeguard.h>
 #include <librepcb/library/cmp/component.h>
+#include <librepcb/library/library.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/project/circuit/componentinstance.h>
 #include <librepcb/project/library/cmd/cmdprojectlibraryaddelement.h>
@@ -92,8 +93,7 @@ bool CmdAddSymbolToSchematic::performExecute() {
               .arg(symbolUuid.toStr()));
     }
     library::Symbol* sym = new library::Symbol(
-        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-            TransactionalFileSystem::openRO(symFp))));
+        library::Library::openElementDirectory(symFp));
     CmdProjectLibraryAddElement<library::Symbol>* cmdAddToLibrary =
         new CmdProjectLibraryAddElement<library::Symbol>(
             mSchematic.getProject().getLibrary(), *sym);
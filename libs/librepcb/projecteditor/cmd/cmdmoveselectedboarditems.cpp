@@ -32,10 +32,15 @@
 #include <librepcb/project/boards/cmd/cmdboardplaneedit.h>
 #include <librepcb/project/boards/cmd/cmdboardviaedit.h>
 #include <librepcb/project/boards/cmd/cmddeviceinstanceedit.h>
+#include <librepcb/project/boards/graphicsitems/bgi_netline.h>
 #include <librepcb/project/boards/items/bi_device.h>
 #include <librepcb/project/boards/items/bi_footprint.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
 #include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_netline.h>
 #include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
 #include <librepcb/project/boards/items/bi_polygon.h>
 #include <librepcb/project/boards/items/bi_stroketext.h>
 #include <librepcb/project/boards/items/bi_via.h>
@@ -59,7 +64,8 @@ CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(
   : UndoCommandGroup(tr("Move Board Elements")),
     mBoard(board),
     mStartPos(startPos),
-    mDeltaPos(0, 0) {
+    mDeltaPos(0, 0),
+    mPreviewOffset(0, 0) {
   // get all selected items
   std::unique_ptr<BoardSelectionQuery> query(mBoard.createSelectionQuery());
   query->addDeviceInstancesOfSelectedFootprints();
@@ -72,45 +78,75 @@ CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(
   query->addSelectedBoardStrokeTexts();
   query->addSelectedFootprintStrokeTexts();
   query->addSelectedHoles();
+  mDevices     = query->getDeviceInstances().toList();
+  mVias        = query->getVias().toList();
+  mNetPoints   = query->getNetPoints().toList();
+  mPlanes      = query->getPlanes().toList();
+  mPolygons    = query->getPolygons().toList();
+  mStrokeTexts = query->getStrokeTexts().toList();
+  mHoles       = query->getHoles().toList();
 
-  foreach (BI_Device* device, query->getDeviceInstances()) {
-    Q_ASSERT(device);
-    CmdDeviceInstanceEdit* cmd = new CmdDeviceInstanceEdit(*device);
-    mDeviceEditCmds.append(cmd);
+  // determine all items whose graphics items need to be moved
+  QSet<BI_Base*> movedItems;
+  foreach (BI_Device* device, mDevices) {
+    movedItems.insert(&device->getFootprint());
+    foreach (BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      movedItems.insert(pad);
+      mMovedAnchors.insert(pad);
+      if (NetSignal* netsignal = pad->getCompSigInstNetSignal()) {
+        mMovedNetSignals.insert(netsignal);
+      }
+    }
   }
-  foreach (BI_Via* via, query->getVias()) {
-    Q_ASSERT(via);
-    CmdBoardViaEdit* cmd = new CmdBoardViaEdit(*via);
-    mViaEditCmds.append(cmd);
+  foreach (BI_Via* via, mVias) {
+    movedItems.insert(via);
+    mMovedAnchors.insert(via);
+    mMovedNetSignals.insert(&via->getNetSegment().getNetSignal());
   }
-  foreach (BI_NetPoint* netpoint, query->getNetPoints()) {
-    Q_ASSERT(netpoint);
-    CmdBoardNetPointEdit* cmd = new CmdBoardNetPointEdit(*netpoint);
-    mNetPointEditCmds.append(cmd);
+  foreach (BI_NetPoint* netpoint, mNetPoints) {
+    movedItems.insert(netpoint);
+    mMovedAnchors.insert(netpoint);
+    mMovedNetSignals.insert(&netpoint->getNetSegment().getNetSignal());
   }
-  foreach (BI_Plane* plane, query->getPlanes()) {
-    Q_ASSERT(plane);
-    CmdBoardPlaneEdit* cmd = new CmdBoardPlaneEdit(*plane, false);
-    mPlaneEditCmds.append(cmd);
+  foreach (BI_Plane* plane, mPlanes) { movedItems.insert(plane); }
+  foreach (BI_Polygon* polygon, mPolygons) { movedItems.insert(polygon); }
+  foreach (BI_StrokeText* text, mStrokeTexts) { movedItems.insert(text); }
+  foreach (BI_Hole* hole, mHoles) { movedItems.insert(hole); }
+
+  // net lines are moved if both anchors are moved, or stretched otherwise
+  QSet<BI_Base*> stretchedStart;
+  QSet<BI_Base*> stretchedEnd;
+  foreach (const BI_NetLineAnchor* anchor, mMovedAnchors) {
+    foreach (BI_NetLine* netline, anchor->getNetLines()) {
+      bool start = mMovedAnchors.contains(&netline->getStartPoint());
+      bool end   = mMovedAnchors.contains(&netline->getEndPoint());
+      if (start && end) {
+        movedItems.insert(netline);
+      } else if (start) {
+        stretchedStart.insert(netline);
+      } else {
+        stretchedEnd.insert(netline);
+      }
+    }
   }
-  foreach (BI_Polygon* polygon, query->getPolygons()) {
-    Q_ASSERT(polygon);
-    CmdPolygonEdit* cmd = new CmdPolygonEdit(polygon->getPolygon());
-    mPolygonEditCmds.append(cmd);
+  foreach (QGraphicsItem* item, mBoard.getGraphicsItemsOf(movedItems)) {
+    mMovedGraphicsItems.append(qMakePair(item, item->pos()));
   }
-  foreach (BI_StrokeText* text, query->getStrokeTexts()) {
-    Q_ASSERT(text);
-    CmdStrokeTextEdit* cmd = new CmdStrokeTextEdit(text->getText());
-    mStrokeTextEditCmds.append(cmd);
+  foreach (QGraphicsItem* item, mBoard.getGraphicsItemsOf(stretchedStart)) {
+    if (BGI_NetLine* line = dynamic_cast<BGI_NetLine*>(item)) {
+      mStretchedNetLinesStart.append(line);
+    }
   }
-  foreach (BI_Hole* hole, query->getHoles()) {
-    Q_ASSERT(hole);
-    CmdHoleEdit* cmd = new CmdHoleEdit(hole->getHole());
-    mHoleEditCmds.append(cmd);
+  foreach (QGraphicsItem* item, mBoard.getGraphicsItemsOf(stretchedEnd)) {
+    if (BGI_NetLine* line = dynamic_cast<BGI_NetLine*>(item)) {
+      mStretchedNetLinesEnd.append(line);
+    }
   }
 }
 
 CmdMoveSelectedBoardItems::~CmdMoveSelectedBoardItems() noexcept {
+  // if the command was not executed, restore the original graphics items
+  setPreviewOffset(Point(0, 0));
 }
 
 /*******************************************************************************
@@ -122,33 +158,10 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept {
   delta.mapToGrid(mBoard.getGridProperties().getInterval());
 
   if (delta != mDeltaPos) {
-    // move selected elements
-    foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardViaEdit* cmd, mViaEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardNetPointEdit* cmd, mNetPointEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardPlaneEdit* cmd, mPlaneEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdPolygonEdit* cmd, mPolygonEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdStrokeTextEdit* cmd, mStrokeTextEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
+    // Only move the graphics items and airwires, the board items are modified
+    // once when executing the command.
+    setPreviewOffset(delta);
     mDeltaPos = delta;
-
-    // Force updating airwires immediately as they are important while moving
-    // items.
-    mBoard.triggerAirWiresRebuild();
   }
 }
 
@@ -157,44 +170,50 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept {
  ******************************************************************************/
 
 bool CmdMoveSelectedBoardItems::performExecute() {
+  // restore the graphics items, they get updated by the child commands
+  setPreviewOffset(Point(0, 0));
+  mMovedGraphicsItems.clear();
+  mStretchedNetLinesStart.clear();
+  mStretchedNetLinesEnd.clear();
+
   if (mDeltaPos.isOrigin()) {
-    // no movement required --> discard all move commands
-    qDeleteAll(mDeviceEditCmds);
-    mDeviceEditCmds.clear();
-    qDeleteAll(mViaEditCmds);
-    mViaEditCmds.clear();
-    qDeleteAll(mNetPointEditCmds);
-    mNetPointEditCmds.clear();
-    qDeleteAll(mPlaneEditCmds);
-    mPlaneEditCmds.clear();
-    qDeleteAll(mPolygonEditCmds);
-    mPolygonEditCmds.clear();
-    qDeleteAll(mStrokeTextEditCmds);
-    mStrokeTextEditCmds.clear();
-    qDeleteAll(mHoleEditCmds);
-    mHoleEditCmds.clear();
+    // no movement required --> no child commands needed
     return false;
   }
 
-  foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
+  foreach (BI_Device* device, mDevices) {
+    CmdDeviceInstanceEdit* cmd = new CmdDeviceInstanceEdit(*device);
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdBoardViaEdit* cmd, mViaEditCmds) {
+  foreach (BI_Via* via, mVias) {
+    CmdBoardViaEdit* cmd = new CmdBoardViaEdit(*via);
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdBoardNetPointEdit* cmd, mNetPointEditCmds) {
+  foreach (BI_NetPoint* netpoint, mNetPoints) {
+    CmdBoardNetPointEdit* cmd = new CmdBoardNetPointEdit(*netpoint);
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdBoardPlaneEdit* cmd, mPlaneEditCmds) {
+  foreach (BI_Plane* plane, mPlanes) {
+    CmdBoardPlaneEdit* cmd = new CmdBoardPlaneEdit(*plane, false);
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdPolygonEdit* cmd, mPolygonEditCmds) {
+  foreach (BI_Polygon* polygon, mPolygons) {
+    CmdPolygonEdit* cmd = new CmdPolygonEdit(polygon->getPolygon());
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdStrokeTextEdit* cmd, mStrokeTextEditCmds) {
+  foreach (BI_StrokeText* text, mStrokeTexts) {
+    CmdStrokeTextEdit* cmd = new CmdStrokeTextEdit(text->getText());
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
-  foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
+  foreach (BI_Hole* hole, mHoles) {
+    CmdHoleEdit* cmd = new CmdHoleEdit(hole->getHole());
+    cmd->translate(mDeltaPos, false);
     appendChild(cmd);  // can throw
   }
 
@@ -202,6 +221,38 @@ bool CmdMoveSelectedBoardItems::performExecute() {
   return UndoCommandGroup::performExecute();  // can throw
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void CmdMoveSelectedBoardItems::setPreviewOffset(const Point& offset) noexcept {
+  if (offset == mPreviewOffset) {
+    return;
+  }
+  QPointF offsetPx = offset.toPxQPointF();
+  for (const auto& pair : mMovedGraphicsItems) {
+    pair.first->setPos(pair.second + offsetPx);
+  }
+  foreach (BGI_NetLine* line, mStretchedNetLinesStart) {
+    line->setAnchorOffsets(offset, Point(0, 0));
+  }
+  foreach (BGI_NetLine* line, mStretchedNetLinesEnd) {
+    line->setAnchorOffsets(Point(0, 0), offset);
+  }
+
+  // Update airwires as soon as possible as they are important while moving
+  // items. But it is deferred until all pending mouse move events are
+  // processed, to rebuild them only once per burst of movements.
+  mBoard.setAirWiresPreviewOffset(
+      offset.isOrigin() ? QSet<const BI_NetLineAnchor*>() : mMovedAnchors,
+      offset);
+  foreach (NetSignal* netsignal, mMovedNetSignals) {
+    mBoard.scheduleAirWiresRebuild(netsignal);
+  }
+  mBoard.triggerAirWiresRebuildDeferred();
+  mPreviewOffset = offset;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -27,23 +27,25 @@
 #include <librepcb/common/units/all_length_units.h>
 
 #include <QtCore>
+#include <QtWidgets>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
-
-class CmdPolygonEdit;
-class CmdStrokeTextEdit;
-class CmdHoleEdit;
-
 namespace project {
 
 class Board;
-class CmdDeviceInstanceEdit;
-class CmdBoardViaEdit;
-class CmdBoardNetPointEdit;
-class CmdBoardPlaneEdit;
+class NetSignal;
+class BI_Device;
+class BI_Via;
+class BI_NetPoint;
+class BI_Plane;
+class BI_Polygon;
+class BI_StrokeText;
+class BI_Hole;
+class BI_NetLineAnchor;
+class BGI_NetLine;
 
 namespace editor {
 
@@ -53,6 +55,14 @@ namespace editor {
 
 /**
  * @brief The CmdMoveSelectedBoardItems class
+ *
+ * While dragging (i.e. calling #setCurrentPosition()), the board items are not
+ * modified at all. Instead, only their graphics items are moved by the current
+ * offset, and net lines with only one moved anchor are drawn stretched. So a
+ * mouse move costs only a few cheap graphics item updates, even for huge
+ * selections. The airwires of the affected net signals are rebuilt deferred
+ * from the preview positions. The new positions are applied to the board items
+ * only once when executing the command, which then also updates the planes.
  */
 class CmdMoveSelectedBoardItems final : public UndoCommandGroup {
 public:
@@ -69,19 +79,34 @@ private:
   /// @copydoc UndoCommand::performExecute()
   bool performExecute() override;
 
+  /**
+   * @brief Move the graphics items and airwires of all moved items
+   *
+   * @param offset  Offset relative to the original positions of the items
+   */
+  void setPreviewOffset(const Point& offset) noexcept;
+
   // Private Member Variables
   Board& mBoard;
   Point  mStartPos;
   Point  mDeltaPos;
 
-  // Move commands
-  QList<CmdDeviceInstanceEdit*> mDeviceEditCmds;
-  QList<CmdBoardViaEdit*>       mViaEditCmds;
-  QList<CmdBoardNetPointEdit*>  mNetPointEditCmds;
-  QList<CmdBoardPlaneEdit*>     mPlaneEditCmds;
-  QList<CmdPolygonEdit*>        mPolygonEditCmds;
-  QList<CmdStrokeTextEdit*>     mStrokeTextEditCmds;
-  QList<CmdHoleEdit*>           mHoleEditCmds;
+  // Items to move
+  QList<BI_Device*>     mDevices;
+  QList<BI_Via*>        mVias;
+  QList<BI_NetPoint*>   mNetPoints;
+  QList<BI_Plane*>      mPlanes;
+  QList<BI_Polygon*>    mPolygons;
+  QList<BI_StrokeText*> mStrokeTexts;
+  QList<BI_Hole*>       mHoles;
+
+  // Preview while dragging
+  Point                                 mPreviewOffset;
+  QList<QPair<QGraphicsItem*, QPointF>> mMovedGraphicsItems;  ///< Orig. pos
+  QList<BGI_NetLine*> mStretchedNetLinesStart;  ///< Start anchor moved
+  QList<BGI_NetLine*> mStretchedNetLinesEnd;    ///< End anchor moved
+  QSet<const BI_NetLineAnchor*> mMovedAnchors;
+  QSet<NetSignal*>              mMovedNetSignals;  ///< Of moved anchors
 };
 
 /*******************************************************************************
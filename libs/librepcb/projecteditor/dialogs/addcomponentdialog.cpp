@@ -29,10 +29,13 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/library/cat/componentcategory.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/cmp/componentsymbolvariant.h>
 #include <librepcb/library/dev/device.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/library/pkg/footprintpreviewgraphicsitem.h>
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/library/sym/symbol.h>
@@ -71,6 +74,7 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace,
     mComponentPreviewScene(nullptr),
     mDevicePreviewScene(nullptr),
     mCategoryTreeModel(nullptr),
+    mLibraryElementCache(workspace.getLibraryElementCache()),
     mSelectedComponent(nullptr),
     mSelectedSymbVar(nullptr),
     mSelectedDevice(nullptr),
@@ -91,6 +95,8 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace,
           &AddComponentDialog::treeComponents_currentItemChanged);
   connect(mUi->treeComponents, &QTreeWidget::itemDoubleClicked, this,
           &AddComponentDialog::treeComponents_itemDoubleClicked);
+  connect(&mSearchWatcher, &QFutureWatcherBase::resultsReadyAt, this,
+          &AddComponentDialog::searchResultsReady);
 
   mComponentPreviewScene = new GraphicsScene();
   mUi->viewComponent->setScene(mComponentPreviewScene);
@@ -117,6 +123,8 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace,
 }
 
 AddComponentDialog::~AddComponentDialog() noexcept {
+  mSearchWatcher.cancel();
+  mSearchWatcher.waitForFinished();
   delete mPreviewFootprintGraphicsItem;
   mPreviewFootprintGraphicsItem = nullptr;
   qDeleteAll(mPreviewSymbolGraphicsItems);
@@ -206,18 +214,15 @@ void AddComponentDialog::treeComponents_currentItemChanged(
       if ((!mSelectedComponent) ||
           (mSelectedComponent->getDirectory().getAbsPath() != cmpFp)) {
         library::Component* component = new library::Component(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(cmpFp))));
+            library::Library::openElementDirectory(cmpFp));
         setSelectedComponent(component);
       }
       if (current->parent()) {
         FilePath devFp = FilePath(current->data(0, Qt::UserRole).toString());
         if ((!mSelectedDevice) ||
             (mSelectedDevice->getDirectory().getAbsPath() != devFp)) {
-          library::Device* device =
-              new library::Device(std::unique_ptr<TransactionalDirectory>(
-                  new TransactionalDirectory(
-                      TransactionalFileSystem::openRO(devFp))));
+          library::Device* device = new library::Device(
+              library::Library::openElementDirectory(devFp));
           setSelectedDevice(device);
         }
       } else {
@@ -254,164 +259,175 @@ void AddComponentDialog::on_cbxSymbVar_currentIndexChanged(int index) noexcept {
   }
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
-void AddComponentDialog::searchComponents(const QString& input) {
-  setSelectedComponent(nullptr);
-  mUi->treeComponents->clear();
-
-  // min. 2 chars to avoid freeze on entering first character due to huge result
-  if (input.length() > 1) {
-    SearchResult result = searchComponentsAndDevices(input);
-    QHashIterator<FilePath, SearchResultComponent> cmpIt(result);
-    while (cmpIt.hasNext()) {
-      cmpIt.next();
+void AddComponentDialog::searchResultsReady(int begin, int end) noexcept {
+  for (int i = begin; i < end; ++i) {
+    SearchResult result = mSearchWatcher.resultAt(i);
+    if (!result.error.isEmpty()) {
+      QMessageBox::critical(this, tr("Error"), result.error);
+    }
+    foreach (const SearchResultComponent& cmp, result.components) {
       QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
-      cmpItem->setText(0, cmpIt.value().name);
-      cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
-      QHashIterator<FilePath, SearchResultDevice> devIt(cmpIt.value().devices);
-      while (devIt.hasNext()) {
-        devIt.next();
+      cmpItem->setText(0, cmp.name);
+      cmpItem->setData(0, Qt::UserRole, cmp.fp.toStr());
+      foreach (const SearchResultDevice& dev, cmp.devices) {
         QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
-        devItem->setText(0, devIt.value().name);
-        devItem->setData(0, Qt::UserRole, devIt.key().toStr());
-        devItem->setText(1, devIt.value().pkgName);
+        devItem->setText(0, dev.name);
+        devItem->setData(0, Qt::UserRole, dev.fp.toStr());
+        devItem->setText(1, dev.pkgName);
         devItem->setTextAlignment(1, Qt::AlignRight);
       }
-      cmpItem->setText(1, QString("[%1]").arg(cmpIt.value().devices.count()));
+      cmpItem->setText(1, QString("[%1]").arg(cmp.devices.count()));
       cmpItem->setTextAlignment(1, Qt::AlignRight);
-      cmpItem->setExpanded(!cmpIt.value().match);
+      cmpItem->setExpanded(!cmp.match);
     }
   }
 
   mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
 }
 
-AddComponentDialog::SearchResult AddComponentDialog::searchComponentsAndDevices(
-    const QString& input) {
-  SearchResult       result;
-  const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
 
-  // add matching devices and their corresponding components
-  QList<Uuid> devices =
-      mWorkspace.getLibraryDb().getElementsBySearchKeyword<library::Device>(
-          input);  // can throw
-  foreach (const Uuid& devUuid, devices) {
-    FilePath devFp =
-        mWorkspace.getLibraryDb().getLatestDevice(devUuid);  // can throw
-    if (!devFp.isValid()) continue;
-    Uuid cmpUuid = Uuid::createRandom();
-    Uuid pkgUuid = Uuid::createRandom();
-    mWorkspace.getLibraryDb().getDeviceMetadata(devFp, &pkgUuid,
-                                                &cmpUuid);  // can throw
-    FilePath cmpFp =
-        mWorkspace.getLibraryDb().getLatestComponent(cmpUuid);  // can throw
-    if (!cmpFp.isValid()) continue;
-    FilePath pkgFp =
-        mWorkspace.getLibraryDb().getLatestPackage(pkgUuid);  // can throw
-    SearchResultDevice& resDev = result[cmpFp].devices[devFp];
-    resDev.pkgFp               = pkgFp;
-    resDev.match               = true;
+void AddComponentDialog::searchComponents(const QString& input) {
+  // The results of a running search are outdated, so abort it. Results it
+  // may still report are discarded by the canceled future.
+  mSearchWatcher.cancel();
+  setSelectedComponent(nullptr);
+  mUi->treeComponents->clear();
+  if (input.isEmpty()) {
+    return;
   }
 
-  // add matching components and all their devices
-  QList<Uuid> components =
-      mWorkspace.getLibraryDb().getElementsBySearchKeyword<library::Component>(
-          input);  // can throw
-  foreach (const Uuid& cmpUuid, components) {
-    FilePath cmpFp =
-        mWorkspace.getLibraryDb().getLatestComponent(cmpUuid);  // can throw
-    if (!cmpFp.isValid()) continue;
-    QSet<Uuid> devices =
-        mWorkspace.getLibraryDb().getDevicesOfComponent(cmpUuid);  // can throw
-    SearchResultComponent& resCmp = result[cmpFp];
-    resCmp.match                  = true;
-    foreach (const Uuid& devUuid, devices) {
-      FilePath devFp =
-          mWorkspace.getLibraryDb().getLatestDevice(devUuid);  // can throw
-      if (!devFp.isValid()) continue;
-      if (resCmp.devices.contains(devFp)) continue;
-      Uuid pkgUuid = Uuid::createRandom();
-      mWorkspace.getLibraryDb().getDeviceMetadata(devFp, &pkgUuid,
-                                                  nullptr);  // can throw
-      FilePath pkgFp =
-          mWorkspace.getLibraryDb().getLatestPackage(pkgUuid);  // can throw
-      SearchResultDevice& resDev = resCmp.devices[devFp];
-      resDev.pkgFp               = pkgFp;
+  // Only capture copies since the job runs in a worker thread.
+  const workspace::WorkspaceLibraryDb& db =
+      mWorkspace.getLibraryDb();  // thread-safe
+  QStringList localeOrder = mProject.getSettings().getLocaleOrder();
+  QFutureInterface<SearchResult> future;
+  future.reportStarted();
+  mSearchWatcher.setFuture(future.future());
+  TaskScheduler::run(TaskScheduler::Priority::Interactive,
+                     [&db, input, localeOrder, future]() mutable {
+                       searchComponentsAndDevices(db, input, localeOrder,
+                                                  future);
+                       future.reportFinished();
+                     });
+}
+
+void AddComponentDialog::searchComponentsAndDevices(
+    const workspace::WorkspaceLibraryDb& db, const QString& input,
+    const QStringList&              localeOrder,
+    QFutureInterface<SearchResult>& future) noexcept {
+  try {
+    // get all matching components and devices with a single query
+    QList<workspace::WorkspaceLibraryDb::ComponentSearchResult> rows =
+        db.searchComponentsAndDevices(input);  // can throw
+    QList<SearchResultComponent> components;
+    QHash<FilePath, int>         componentIndices;
+    foreach (const auto& row, rows) {
+      auto it = componentIndices.find(row.component);
+      if (it == componentIndices.end()) {
+        it = componentIndices.insert(row.component, components.count());
+        components.append(SearchResultComponent{
+            row.component, QString(), {}, row.componentMatch});
+      }
+      if (row.device.isValid()) {
+        components[*it].devices.append(SearchResultDevice{
+            row.device, QString(), row.package, QString(), row.deviceMatch});
+      }
     }
-  }
 
-  // get name of elements
-  QMutableHashIterator<FilePath, SearchResultComponent> resultIt(result);
-  while (resultIt.hasNext()) {
-    resultIt.next();
-    mWorkspace.getLibraryDb().getElementTranslations<library::Component>(
-        resultIt.key(), localeOrder, &resultIt.value().name);
-    QMutableHashIterator<FilePath, SearchResultDevice> devIt(
-        resultIt.value().devices);
-    while (devIt.hasNext()) {
-      devIt.next();
-      mWorkspace.getLibraryDb().getElementTranslations<library::Device>(
-          devIt.key(), localeOrder, &devIt.value().name);
-      if (devIt.value().pkgFp.isValid()) {
-        mWorkspace.getLibraryDb().getElementTranslations<library::Package>(
-            devIt.value().pkgFp, localeOrder, &devIt.value().pkgName);
+    // Look up the names in batches and report each batch as soon as it is
+    // complete, so the first results are shown quickly even if there are
+    // thousands of them.
+    const int batchSize = 100;
+    for (int first = 0; first < components.count(); first += batchSize) {
+      if (future.isCanceled()) {
+        return;
       }
+      SearchResult    result{components.mid(first, batchSize), QString()};
+      QList<FilePath> cmpFps, devFps, pkgFps;
+      foreach (const SearchResultComponent& cmp, result.components) {
+        cmpFps.append(cmp.fp);
+        foreach (const SearchResultDevice& dev, cmp.devices) {
+          devFps.append(dev.fp);
+          if (dev.pkgFp.isValid()) pkgFps.append(dev.pkgFp);
+        }
+      }
+      QHash<FilePath, QString> cmpNames =
+          db.getElementNames<library::Component>(cmpFps,
+                                                 localeOrder);  // can throw
+      QHash<FilePath, QString> devNames =
+          db.getElementNames<library::Device>(devFps,
+                                              localeOrder);  // can throw
+      QHash<FilePath, QString> pkgNames =
+          db.getElementNames<library::Package>(pkgFps,
+                                               localeOrder);  // can throw
+      for (SearchResultComponent& cmp : result.components) {
+        cmp.name = cmpNames.value(cmp.fp);
+        for (SearchResultDevice& dev : cmp.devices) {
+          dev.name    = devNames.value(dev.fp);
+          dev.pkgName = pkgNames.value(dev.pkgFp);
+        }
+      }
+      future.reportResult(result);
     }
+  } catch (const Exception& e) {
+    future.reportResult(SearchResult{{}, e.getMsg()});
   }
-
-  return result;
 }
 
 void AddComponentDialog::setSelectedCategory(
     const tl::optional<Uuid>& categoryUuid) {
+  mSearchWatcher.cancel();  // discard results of a running search
   setSelectedComponent(nullptr);
   mUi->treeComponents->clear();
 
   const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
 
-  mSelectedCategoryUuid = categoryUuid;
-  QSet<Uuid> components =
-      mWorkspace.getLibraryDb().getComponentsByCategory(categoryUuid);
-  foreach (const Uuid& cmpUuid, components) {
+  // Note: Batch lookups are used to get all information with only a few
+  // database queries, since a category may contain thousands of elements.
+  const workspace::WorkspaceLibraryDb& db = mWorkspace.getLibraryDb();
+  mSelectedCategoryUuid                   = categoryUuid;
+  QSet<Uuid> components = db.getComponentsByCategory(categoryUuid);
+  QHash<Uuid, FilePath> cmpFps =
+      db.getLatestElements<library::Component>(components);
+  QHash<FilePath, QString> cmpNames =
+      db.getElementNames<library::Component>(cmpFps.values(), localeOrder);
+  QMultiHash<Uuid, Uuid> cmpDevices =
+      db.getDevicesOfComponents(cmpFps.keys().toSet());
+  QHash<Uuid, FilePath> devFps =
+      db.getLatestElements<library::Device>(cmpDevices.values().toSet());
+  QHash<FilePath, QString> devNames =
+      db.getElementNames<library::Device>(devFps.values(), localeOrder);
+  QHash<FilePath, Uuid> devPkgUuids;
+  db.getDevicesMetadata(devFps.values(), &devPkgUuids);
+  QHash<Uuid, FilePath> pkgFps =
+      db.getLatestElements<library::Package>(devPkgUuids.values().toSet());
+  QHash<FilePath, QString> pkgNames =
+      db.getElementNames<library::Package>(pkgFps.values(), localeOrder);
+
+  for (auto cmpIt = cmpFps.constBegin(); cmpIt != cmpFps.constEnd(); ++cmpIt) {
     // component
-    FilePath cmpFp = mWorkspace.getLibraryDb().getLatestComponent(cmpUuid);
-    if (!cmpFp.isValid()) continue;
-    QString cmpName;
-    mWorkspace.getLibraryDb().getElementTranslations<library::Component>(
-        cmpFp, localeOrder, &cmpName);
+    const FilePath&  cmpFp   = cmpIt.value();
     QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
-    cmpItem->setText(0, cmpName);
+    cmpItem->setText(0, cmpNames.value(cmpFp));
     cmpItem->setData(0, Qt::UserRole, cmpFp.toStr());
     // devices
-    QSet<Uuid> devices =
-        mWorkspace.getLibraryDb().getDevicesOfComponent(cmpUuid);
+    QList<Uuid> devices = cmpDevices.values(cmpIt.key());
     foreach (const Uuid& devUuid, devices) {
-      try {
-        FilePath devFp = mWorkspace.getLibraryDb().getLatestDevice(devUuid);
-        if (!devFp.isValid()) continue;
-        QString devName;
-        mWorkspace.getLibraryDb().getElementTranslations<library::Device>(
-            devFp, localeOrder, &devName);
-        QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
-        devItem->setText(0, devName);
-        devItem->setData(0, Qt::UserRole, devFp.toStr());
-        // package
-        Uuid pkgUuid = Uuid::createRandom();  // only for initialization, will
-                                              // be overwritten
-        mWorkspace.getLibraryDb().getDeviceMetadata(devFp, &pkgUuid);
-        FilePath pkgFp = mWorkspace.getLibraryDb().getLatestPackage(pkgUuid);
-        if (pkgFp.isValid()) {
-          QString pkgName;
-          mWorkspace.getLibraryDb().getElementTranslations<library::Package>(
-              pkgFp, localeOrder, &pkgName);
-          devItem->setText(1, pkgName);
-          devItem->setTextAlignment(1, Qt::AlignRight);
-        }
-      } catch (const Exception& e) {
-        // what could we do here?
+      FilePath devFp = devFps.value(devUuid);
+      if (!devFp.isValid()) continue;
+      QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
+      devItem->setText(0, devNames.value(devFp));
+      devItem->setData(0, Qt::UserRole, devFp.toStr());
+      // package
+      auto pkgUuidIt = devPkgUuids.find(devFp);
+      if (pkgUuidIt == devPkgUuids.end()) continue;
+      FilePath pkgFp = pkgFps.value(*pkgUuidIt);
+      if (pkgFp.isValid()) {
+        devItem->setText(1, pkgNames.value(pkgFp));
+        devItem->setTextAlignment(1, Qt::AlignRight);
       }
     }
     cmpItem->setText(1, QString("[%1]").arg(devices.count()));
@@ -440,6 +456,17 @@ void AddComponentDialog::setSelectedComponent(const library::Component* cmp) {
 
     mSelectedComponent = cmp;
 
+    // load the symbols of all variants in the background
+    QList<Uuid> symbols;
+    for (const library::ComponentSymbolVariant& symbVar :
+         cmp->getSymbolVariants()) {
+      for (const library::ComponentSymbolVariantItem& item :
+           symbVar.getSymbolItems()) {
+        symbols.append(item.getSymbolUuid());
+      }
+    }
+    mLibraryElementCache->prefetchSymbols(symbols);
+
     for (const library::ComponentSymbolVariant& symbVar :
          cmp->getSymbolVariants()) {
       QString text = *symbVar.getNames().value(localeOrder);
@@ -472,13 +499,9 @@ void AddComponentDialog::setSelectedSymbVar(
     const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
     for (const library::ComponentSymbolVariantItem& item :
          symbVar->getSymbolItems()) {
-      FilePath symbolFp =
-          mWorkspace.getLibraryDb().getLatestSymbol(item.getSymbolUuid());
-      if (!symbolFp.isValid()) continue;  // TODO: show warning
-      const library::Symbol* symbol =
-          new library::Symbol(std::unique_ptr<TransactionalDirectory>(
-              new TransactionalDirectory(TransactionalFileSystem::openRO(
-                  symbolFp))));  // TODO: fix memory leak...
+      std::shared_ptr<const library::Symbol> symbol =
+          mLibraryElementCache->getSymbol(item.getSymbolUuid());
+      if (!symbol) continue;  // TODO: show warning
       library::SymbolPreviewGraphicsItem* graphicsItem =
           new library::SymbolPreviewGraphicsItem(
               *mGraphicsLayerProvider, localeOrder, *symbol, mSelectedComponent,
@@ -510,8 +533,7 @@ void AddComponentDialog::setSelectedDevice(const library::Device* dev) {
         mSelectedDevice->getPackageUuid());
     if (pkgFp.isValid()) {
       mSelectedPackage = new library::Package(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(pkgFp))));
+          library::Library::openElementDirectory(pkgFp));
       QString devName = *mSelectedDevice->getNames().value(localeOrder);
       QString pkgName = *mSelectedPackage->getNames().value(localeOrder);
       if (devName.contains(pkgName, Qt::CaseInsensitive)) {
@@ -31,6 +31,8 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -48,11 +50,13 @@ class ComponentSymbolVariant;
 class Symbol;
 class SymbolPreviewGraphicsItem;
 class ComponentCategory;
+class LibraryElementCache;
 }  // namespace library
 
 namespace workspace {
 class Workspace;
-}
+class WorkspaceLibraryDb;
+}  // namespace workspace
 
 namespace project {
 
@@ -76,19 +80,25 @@ class AddComponentDialog final : public QDialog {
 
   // Types
   struct SearchResultDevice {
+    FilePath fp;
     QString  name;
     FilePath pkgFp;
     QString  pkgName;
-    bool     match = false;
+    bool     match;
   };
 
   struct SearchResultComponent {
-    QString                             name;
-    QHash<FilePath, SearchResultDevice> devices;
-    bool                                match = false;
+    FilePath                  fp;
+    QString                   name;
+    QList<SearchResultDevice> devices;
+    bool                      match;
   };
 
-  typedef QHash<FilePath, SearchResultComponent> SearchResult;
+  /// A batch of search results, reported by the search worker
+  struct SearchResult {
+    QList<SearchResultComponent> components;
+    QString                      error;
+  };
 
 public:
   // Constructors / Destructor
@@ -110,25 +120,33 @@ private slots:
   void treeComponents_itemDoubleClicked(QTreeWidgetItem* item,
                                         int              column) noexcept;
   void on_cbxSymbVar_currentIndexChanged(int index) noexcept;
+  void searchResultsReady(int begin, int end) noexcept;
 
 private:
   // Private Methods
-  void         searchComponents(const QString& input);
-  SearchResult searchComponentsAndDevices(const QString& input);
-  void         setSelectedCategory(const tl::optional<Uuid>& categoryUuid);
-  void         setSelectedComponent(const library::Component* cmp);
+  void searchComponents(const QString& input);
+  static void searchComponentsAndDevices(
+      const workspace::WorkspaceLibraryDb& db, const QString& input,
+      const QStringList&              localeOrder,
+      QFutureInterface<SearchResult>& future) noexcept;
+  void setSelectedCategory(const tl::optional<Uuid>& categoryUuid);
+  void setSelectedComponent(const library::Component* cmp);
   void setSelectedSymbVar(const library::ComponentSymbolVariant* symbVar);
   void setSelectedDevice(const library::Device* dev);
   void accept() noexcept;
 
   // General
-  workspace::Workspace&                        mWorkspace;
-  Project&                                     mProject;
-  Ui::AddComponentDialog*                      mUi;
-  GraphicsScene*                               mComponentPreviewScene;
-  GraphicsScene*                               mDevicePreviewScene;
-  QScopedPointer<DefaultGraphicsLayerProvider> mGraphicsLayerProvider;
-  workspace::ComponentCategoryTreeModel*       mCategoryTreeModel;
+  workspace::Workspace&                         mWorkspace;
+  Project&                                      mProject;
+  Ui::AddComponentDialog*                       mUi;
+  GraphicsScene*                                mComponentPreviewScene;
+  GraphicsScene*                                mDevicePreviewScene;
+  QScopedPointer<DefaultGraphicsLayerProvider>  mGraphicsLayerProvider;
+  workspace::ComponentCategoryTreeModel*        mCategoryTreeModel;
+  std::shared_ptr<library::LibraryElementCache> mLibraryElementCache;
+
+  // The search runs in a worker thread and reports the results in batches.
+  QFutureWatcher<SearchResult> mSearchWatcher;
 
   // Attributes
   tl::optional<Uuid>                         mSelectedCategoryUuid;
@@ -72,6 +72,7 @@ EditNetClassesDialog::EditNetClassesDialog(Circuit&   circuit,
                   qVariantFromValue(static_cast<void*>(netclass)));
     mUi->tableWidget->setVerticalHeaderItem(row, uuid);
     mUi->tableWidget->setItem(row, 0, name);
+    addAirWiresPolicyComboBox(row, *netclass);
     row++;
   }
 
@@ -149,6 +150,7 @@ void EditNetClassesDialog::on_btnAdd_clicked() {
         qVariantFromValue(static_cast<void*>(cmd->getNetClass())));
     mUi->tableWidget->setVerticalHeaderItem(row, uuidItem);
     mUi->tableWidget->setItem(row, 0, nameItem);
+    addAirWiresPolicyComboBox(row, *cmd->getNetClass());
   } catch (Exception& e) {
     QMessageBox::critical(this, tr("Could not add netclass"), e.getMsg());
   }
@@ -173,6 +175,43 @@ void EditNetClassesDialog::on_btnRemove_clicked() {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void EditNetClassesDialog::addAirWiresPolicyComboBox(
+    int row, NetClass& netclass) noexcept {
+  QComboBox* cbx = new QComboBox();
+  cbx->addItem(tr("Always"),
+               static_cast<int>(NetClass::AirWiresPolicy::Always));
+  cbx->addItem(tr("When Highlighted"),
+               static_cast<int>(NetClass::AirWiresPolicy::OnHighlight));
+  cbx->addItem(tr("Never"), static_cast<int>(NetClass::AirWiresPolicy::Never));
+  cbx->setCurrentIndex(
+      cbx->findData(static_cast<int>(netclass.getAirWiresPolicy())));
+  connect(cbx, static_cast<void (QComboBox::*)(int)>(
+                   &QComboBox::currentIndexChanged),
+          this, [this, cbx, &netclass](int index) {
+            NetClass::AirWiresPolicy policy =
+                static_cast<NetClass::AirWiresPolicy>(
+                    cbx->itemData(index).toInt());
+            if (policy == netclass.getAirWiresPolicy()) {
+              return;
+            }
+            try {
+              auto cmd = new CmdNetClassEdit(mCircuit, netclass);
+              cmd->setAirWiresPolicy(policy);
+              mUndoStack.appendToCmdGroup(cmd);  // can throw
+            } catch (Exception& e) {
+              QMessageBox::critical(this, tr("Could not change airwires"),
+                                    e.getMsg());
+              cbx->setCurrentIndex(cbx->findData(
+                  static_cast<int>(netclass.getAirWiresPolicy())));
+            }
+          });
+  mUi->tableWidget->setCellWidget(row, 1, cbx);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -38,6 +38,7 @@ class UndoStack;
 namespace project {
 
 class Circuit;
+class NetClass;
 
 namespace editor {
 
@@ -73,6 +74,9 @@ private:
   EditNetClassesDialog(const EditNetClassesDialog& other);
   EditNetClassesDialog& operator=(const EditNetClassesDialog& rhs);
 
+  // Private Methods
+  void addAirWiresPolicyComboBox(int row, NetClass& netclass) noexcept;
+
   // General Attributes
   Circuit&                  mCircuit;
   Ui::EditNetClassesDialog* mUi;
@@ -17,76 +17,68 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "bi_airwire.h"
+#include "memoryusagedialog.h"
+
+#include "ui_memoryusagedialog.h"
 
-#include "../../circuit/netsignal.h"
+#include <librepcb/common/undostack.h>
+#include <librepcb/project/project.h>
 
 #include <QtCore>
+#include <QtWidgets>
 
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
 namespace project {
+namespace editor {
 
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_AirWire::BI_AirWire(Board& board, const NetSignal& netsignal,
-                       const Point& p1, const Point& p2)
-  : BI_Base(board), mNetSignal(netsignal), mP1(p1), mP2(p2) {
-  mGraphicsItem.reset(new BGI_AirWire(*this));
-}
+MemoryUsageDialog::MemoryUsageDialog(const Project&   project,
+                                     const UndoStack& undoStack,
+                                     QWidget*         parent) noexcept
+  : QDialog(parent), mUi(new Ui::MemoryUsageDialog), mTotal(0) {
+  mUi->setupUi(this);
 
-BI_AirWire::~BI_AirWire() noexcept {
-}
-
-/*******************************************************************************
- *  General Methods
- ******************************************************************************/
-
-void BI_AirWire::addToBoard() {
-  if (isAddedToBoard()) {
-    throw LogicError(__FILE__, __LINE__);
+  typedef QPair<QString, qint64> MemoryUsage;
+  foreach (const MemoryUsage& usage, project.getMemoryUsage()) {
+    addRow(usage.first, usage.second);
   }
-  mHighlightChangedConnection =
-      connect(&mNetSignal, &NetSignal::highlightedChanged,
-              [this]() { mGraphicsItem->update(); });
-  BI_Base::addToBoard(mGraphicsItem.data());
+  addRow(tr("Undo Stack"), undoStack.getMemoryUsage());
+  mUi->lblTotal->setText(tr("Total: %1 MB").arg(mTotal / 1e6, 0, 'f', 1));
+  mUi->tableWidget->resizeColumnsToContents();
 }
 
-void BI_AirWire::removeFromBoard() {
-  if (!isAddedToBoard()) {
-    throw LogicError(__FILE__, __LINE__);
-  }
-  disconnect(mHighlightChangedConnection);
-  BI_Base::removeFromBoard(mGraphicsItem.data());
+MemoryUsageDialog::~MemoryUsageDialog() noexcept {
 }
 
 /*******************************************************************************
- *  Inherited from BI_Base
+ *  Private Methods
  ******************************************************************************/
 
-QPainterPath BI_AirWire::getGrabAreaScenePx() const noexcept {
-  return mGraphicsItem->shape();
-}
-
-void BI_AirWire::setSelected(bool selected) noexcept {
-  BI_Base::setSelected(selected);
-  mGraphicsItem->update();
-}
-
-bool BI_AirWire::isSelectable() const noexcept {
-  return mGraphicsItem->isSelectable();
+void MemoryUsageDialog::addRow(const QString& name, qint64 bytes) noexcept {
+  int row = mUi->tableWidget->rowCount();
+  mUi->tableWidget->insertRow(row);
+  QTableWidgetItem* size =
+      new QTableWidgetItem(QString("%1 MB").arg(bytes / 1e6, 0, 'f', 1));
+  size->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+  mUi->tableWidget->setItem(row, 0, new QTableWidgetItem(name));
+  mUi->tableWidget->setItem(row, 1, size);
+  mTotal += bytes;
 }
 
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
 
+}  // namespace editor
 }  // namespace project
 }  // namespace librepcb
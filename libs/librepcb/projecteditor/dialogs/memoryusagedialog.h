@@ -17,14 +17,13 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef LIBREPCB_PROJECT_BGI_AIRWIRE_H
-#define LIBREPCB_PROJECT_BGI_AIRWIRE_H
+
+#ifndef LIBREPCB_PROJECT_MEMORYUSAGEDIALOG_H
+#define LIBREPCB_PROJECT_MEMORYUSAGEDIALOG_H
 
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "bgi_base.h"
-
 #include <QtCore>
 #include <QtWidgets>
 
@@ -33,61 +32,57 @@
  ******************************************************************************/
 namespace librepcb {
 
-class GraphicsLayer;
+class UndoStack;
 
 namespace project {
 
-class BI_AirWire;
+class Project;
+
+namespace editor {
+
+namespace Ui {
+class MemoryUsageDialog;
+}
 
 /*******************************************************************************
- *  Class BGI_AirWire
+ *  Class MemoryUsageDialog
  ******************************************************************************/
 
 /**
- * @brief The BGI_AirWire class
+ * @brief Displays the estimated memory usage of the parts of a project
+ *
+ * The values are only rough estimates (see
+ * librepcb::project::Project::getMemoryUsage()) to find out which part of a
+ * big project needs most memory.
  */
-class BGI_AirWire final : public BGI_Base {
+class MemoryUsageDialog final : public QDialog {
+  Q_OBJECT
+
 public:
   // Constructors / Destructor
-  explicit BGI_AirWire(BI_AirWire& airwire) noexcept;
-  ~BGI_AirWire() noexcept;
-
-  // Getters
-  bool isSelectable() const noexcept;
-
-  // General Methods
-  void updateCacheAndRepaint() noexcept;
-
-  // Inherited from QGraphicsItem
-  QRectF       boundingRect() const { return mBoundingRect; }
-  QPainterPath shape() const { return mShape; }
-  void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
-                     QWidget* widget);
-
-private:
-  // make some methods inaccessible...
-  BGI_AirWire()                         = delete;
-  BGI_AirWire(const BGI_AirWire& other) = delete;
-  BGI_AirWire& operator=(const BGI_AirWire& rhs) = delete;
-
-  // Private Methods
-  GraphicsLayer* getLayer(const QString& name) const noexcept;
-
-  // Attributes
-  BI_AirWire&    mAirWire;
-  GraphicsLayer* mLayer;
-
-  // Cached Attributes
-  QVector<QLineF> mLines;
-  QRectF          mBoundingRect;
-  QPainterPath    mShape;
+  MemoryUsageDialog()                               = delete;
+  MemoryUsageDialog(const MemoryUsageDialog& other) = delete;
+  MemoryUsageDialog(const Project& project, const UndoStack& undoStack,
+                    QWidget* parent = nullptr) noexcept;
+  ~MemoryUsageDialog() noexcept;
+
+  // Operator Overloadings
+  MemoryUsageDialog& operator=(const MemoryUsageDialog& rhs) = delete;
+
+private:  // Methods
+  void addRow(const QString& name, qint64 bytes) noexcept;
+
+private:  // Data
+  QScopedPointer<Ui::MemoryUsageDialog> mUi;
+  qint64                                mTotal;
 };
 
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
 
+}  // namespace editor
 }  // namespace project
 }  // namespace librepcb
 
-#endif  // LIBREPCB_PROJECT_BGI_AIRWIRE_H
+#endif  // LIBREPCB_PROJECT_MEMORYUSAGEDIALOG_H
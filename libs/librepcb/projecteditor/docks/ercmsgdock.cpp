@@ -50,6 +50,14 @@ ErcMsgDock::ErcMsgDock(Project& project)
     mUi(new Ui::ErcMsgDock) {
   mUi->setupUi(this);
 
+  // ERC messages are often added or removed in bursts (e.g. when removing many
+  // items at once), thus the counters are updated only once the event loop is
+  // idle
+  mUpdateTimer.setSingleShot(true);
+  mUpdateTimer.setInterval(0);
+  connect(&mUpdateTimer, &QTimer::timeout, this,
+          &ErcMsgDock::updateTopLevelItemTexts);
+
   // add top-level items
   mTopLevelItems.insert(static_cast<int>(ErcMsg::ErcMsgType_t::CircuitError),
                         new QTreeWidgetItem(mUi->treeWidget));
@@ -104,21 +112,7 @@ ErcMsgDock::ErcMsgDock(Project& project)
 
   // add all already existing ERC messages
   foreach (ErcMsg* ercMsg, mProject.getErcMsgList().getItems()) {
-    QTreeWidgetItem* parent;
-    if (!ercMsg->isIgnored())
-      parent = mTopLevelItems.value(static_cast<int>(ercMsg->getMsgType()), 0);
-    else
-      parent = mTopLevelItems.value(
-          static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
-    Q_ASSERT(parent);
-    if (!parent) continue;
-    QTreeWidgetItem* child =
-        new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
-    child->setData(
-        0, Qt::UserRole,
-        QVariant::fromValue(reinterpret_cast<void*>(ercMsg)));  // ugly...
-    child->setToolTip(0, ercMsg->getMsg());
-    mErcMsgItems.insert(ercMsg, child);
+    addItem(*ercMsg);
   }
 
   // connect to ErcMsgList signals
@@ -142,29 +136,17 @@ ErcMsgDock::~ErcMsgDock() {
  ******************************************************************************/
 
 void ErcMsgDock::ercMsgAdded(ErcMsg* ercMsg) noexcept {
-  QTreeWidgetItem* parent;
   Q_ASSERT(ercMsg);
   Q_ASSERT(!mErcMsgItems.contains(ercMsg));
-  if (!ercMsg->isIgnored())
-    parent = mTopLevelItems.value(static_cast<int>(ercMsg->getMsgType()), 0);
-  else
-    parent =
-        mTopLevelItems.value(static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
-  Q_ASSERT(parent);
-  if (!parent) return;
-  QTreeWidgetItem* child =
-      new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
-  child->setToolTip(0, ercMsg->getMsg());
-  parent->sortChildren(0, Qt::AscendingOrder);
-  mErcMsgItems.insert(ercMsg, child);
-  updateTopLevelItemTexts();
+  addItem(*ercMsg);
+  scheduleUpdate();
 }
 
 void ErcMsgDock::ercMsgRemoved(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(mErcMsgItems.contains(ercMsg));
   delete mErcMsgItems.take(ercMsg);
-  updateTopLevelItemTexts();
+  scheduleUpdate();
 }
 
 void ErcMsgDock::ercMsgChanged(ErcMsg* ercMsg) noexcept {
@@ -181,7 +163,7 @@ void ErcMsgDock::on_treeWidget_itemSelectionChanged() {
   bool allIgnored   = true;
 
   foreach (QTreeWidgetItem* item, mUi->treeWidget->selectedItems()) {
-    ErcMsg* ercMsg = mErcMsgItems.key(item, nullptr);
+    ErcMsg* ercMsg = getErcMsg(*item);
     if (!ercMsg) {
       allDisplayed = false;
       allIgnored   = false;
@@ -199,7 +181,7 @@ void ErcMsgDock::on_treeWidget_itemSelectionChanged() {
 
 void ErcMsgDock::on_btnIgnore_clicked(bool checked) {
   foreach (QTreeWidgetItem* item, mUi->treeWidget->selectedItems()) {
-    ErcMsg* ercMsg = mErcMsgItems.key(item, nullptr);
+    ErcMsg* ercMsg = getErcMsg(*item);
     if (!ercMsg) continue;
     ercMsg->setIgnored(checked);
     // TODO: set "project modified" flag
@@ -210,6 +192,48 @@ void ErcMsgDock::on_btnIgnore_clicked(bool checked) {
  *  Private Methods
  ******************************************************************************/
 
+void ErcMsgDock::addItem(ErcMsg& ercMsg) noexcept {
+  QTreeWidgetItem* parent;
+  if (!ercMsg.isIgnored())
+    parent = mTopLevelItems.value(static_cast<int>(ercMsg.getMsgType()), 0);
+  else
+    parent =
+        mTopLevelItems.value(static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
+  Q_ASSERT(parent);
+  if (!parent) return;
+
+  // The children are kept sorted by inserting new items at the right position
+  // (binary search), which is much cheaper than sorting all children again
+  // after each added message.
+  int first = 0;
+  int last  = parent->childCount();
+  while (first < last) {
+    int middle = (first + last) / 2;
+    if (ercMsg.getMsg() < parent->child(middle)->text(0)) {
+      last = middle;
+    } else {
+      first = middle + 1;
+    }
+  }
+
+  QTreeWidgetItem* child = new QTreeWidgetItem(QStringList(ercMsg.getMsg()));
+  child->setData(0, Qt::UserRole,
+                 QVariant::fromValue(reinterpret_cast<void*>(&ercMsg)));
+  child->setToolTip(0, ercMsg.getMsg());
+  parent->insertChild(first, child);
+  mErcMsgItems.insert(&ercMsg, child);
+}
+
+ErcMsg* ErcMsgDock::getErcMsg(const QTreeWidgetItem& item) const noexcept {
+  ErcMsg* ercMsg =
+      reinterpret_cast<ErcMsg*>(item.data(0, Qt::UserRole).value<void*>());
+  return (ercMsg && (mErcMsgItems.value(ercMsg) == &item)) ? ercMsg : nullptr;
+}
+
+void ErcMsgDock::scheduleUpdate() noexcept {
+  mUpdateTimer.start();
+}
+
 void ErcMsgDock::updateTopLevelItemTexts() noexcept {
   int              countOfNonIgnoredErcMessages = 0;
   QTreeWidgetItem* item;
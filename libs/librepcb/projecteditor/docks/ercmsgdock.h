@@ -71,7 +71,10 @@ private slots:
 
 private:
   // Private Methods
-  void updateTopLevelItemTexts() noexcept;
+  void    addItem(ErcMsg& ercMsg) noexcept;
+  ErcMsg* getErcMsg(const QTreeWidgetItem& item) const noexcept;
+  void    scheduleUpdate() noexcept;
+  void    updateTopLevelItemTexts() noexcept;
 
   // make some methods inaccessible...
   ErcMsgDock();
@@ -84,6 +87,9 @@ private:
   Ui::ErcMsgDock*                  mUi;
   QHash<int, QTreeWidgetItem*>     mTopLevelItems;
   QHash<ErcMsg*, QTreeWidgetItem*> mErcMsgItems;
+
+  /// Delays updates to process many added/removed messages at once
+  QTimer mUpdateTimer;
 };
 
 /*******************************************************************************
@@ -24,12 +24,14 @@
 
 #include "boardeditor/boardeditor.h"
 #include "dialogs/editnetclassesdialog.h"
+#include "dialogs/memoryusagedialog.h"
 #include "dialogs/projectsettingsdialog.h"
 #include "schematiceditor/schematiceditor.h"
 
 #include <librepcb/common/dialogs/filedialog.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/undostack.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/project/project.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
@@ -53,7 +55,8 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
     mProject(project),
     mUndoStack(nullptr),
     mSchematicEditor(nullptr),
-    mBoardEditor(nullptr) {
+    mBoardEditor(nullptr),
+    mLibraryElementCache(workspace.getLibraryElementCache()) {
   try {
     mUndoStack = new UndoStack();
 
@@ -177,14 +180,20 @@ void ProjectEditor::execLppzExportDialog(QWidget* parent) noexcept {
     if (!filename.endsWith(".lppz")) filename.append(".lppz");
     FilePath fp(filename);
     qDebug() << "Export project to *.lppz:" << fp.toNative();
-    mProject.save();                                           // can throw
-    mProject.getDirectory().getFileSystem()->exportToZip(fp);  // can throw
+    mProject.save();  // can throw
+    mProject.getDirectory().getFileSystem()->exportToZip(
+        fp, true);  // can throw
     qDebug() << "Project successfully exported.";
   } catch (const Exception& e) {
     QMessageBox::critical(parent, tr("Error"), e.getMsg());
   }
 }
 
+void ProjectEditor::execMemoryUsageDialog(QWidget* parent) noexcept {
+  MemoryUsageDialog d(mProject, *mUndoStack, parent);
+  d.exec();
+}
+
 bool ProjectEditor::saveProject() noexcept {
   try {
     qDebug() << "Save project...";
@@ -218,10 +227,11 @@ bool ProjectEditor::autosaveProject() noexcept {
   }
 
   try {
+    // Only serialize the project in the GUI thread, the files are written to
+    // the autosave directory by a worker thread.
     qDebug() << "Autosave project...";
-    mProject.save();                                      // can throw
-    mProject.getDirectory().getFileSystem()->autosave();  // can throw
-    qDebug() << "Project successfully autosaved";
+    mProject.save();                                           // can throw
+    mProject.getDirectory().getFileSystem()->startAutosave();  // can throw
     return true;
   } catch (Exception& exc) {
     return false;
@@ -39,6 +39,10 @@ namespace librepcb {
 
 class UndoStack;
 
+namespace library {
+class LibraryElementCache;
+}
+
 namespace workspace {
 class Workspace;
 }
@@ -157,6 +161,13 @@ public slots:
    */
   void execLppzExportDialog(QWidget* parent = nullptr) noexcept;
 
+  /**
+   * @brief Execute the memory usage dialog (blocking!)
+   *
+   * @param parent    parent widget of the dialog (optional)
+   */
+  void execMemoryUsageDialog(QWidget* parent = nullptr) noexcept;
+
   /**
    * @brief Save the whole project to the harddisc
    *
@@ -170,8 +181,10 @@ public slots:
    * @brief Make a automatic backup of the project (save to temporary files)
    *
    * @note The whole save procedere is described in @ref doc_project_save.
+   *       The backup files are written asynchronously, see
+   *       librepcb::TransactionalFileSystem::startAutosave().
    *
-   * @return true on success, false on failure
+   * @return true if the backup was started, false on failure
    */
   bool autosaveProject() noexcept;
 
@@ -219,6 +232,10 @@ private:  // Data
   UndoStack*       mUndoStack;        ///< See @ref doc_project_undostack
   SchematicEditor* mSchematicEditor;  ///< The schematic editor (GUI)
   BoardEditor*     mBoardEditor;      ///< The board editor (GUI)
+
+  /// Keeps the workspace library element cache alive while the project is
+  /// open (see librepcb::workspace::Workspace::getLibraryElementCache())
+  std::shared_ptr<library::LibraryElementCache> mLibraryElementCache;
 };
 
 /*******************************************************************************
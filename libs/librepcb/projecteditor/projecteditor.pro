@@ -10,7 +10,7 @@ TARGET = librepcbprojecteditor
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -38,6 +38,7 @@ SOURCES += \
     boardeditor/fsm/bes_fsm.cpp \
     boardeditor/fsm/bes_select.cpp \
     boardeditor/fsm/boardeditorevent.cpp \
+    boardeditor/routingstatisticsdock.cpp \
     boardeditor/unplacedcomponentsdock.cpp \
     cmd/cmdaddcomponenttocircuit.cpp \
     cmd/cmdadddevicetoboard.cpp \
@@ -60,6 +61,7 @@ SOURCES += \
     cmd/cmdrotateselectedschematicitems.cpp \
     dialogs/addcomponentdialog.cpp \
     dialogs/editnetclassesdialog.cpp \
+    dialogs/memoryusagedialog.cpp \
     dialogs/projectpropertieseditordialog.cpp \
     dialogs/projectsettingsdialog.cpp \
     docks/ercmsgdock.cpp \
@@ -99,6 +101,7 @@ HEADERS += \
     boardeditor/fsm/bes_fsm.h \
     boardeditor/fsm/bes_select.h \
     boardeditor/fsm/boardeditorevent.h \
+    boardeditor/routingstatisticsdock.h \
     boardeditor/unplacedcomponentsdock.h \
     cmd/cmdaddcomponenttocircuit.h \
     cmd/cmdadddevicetoboard.h \
@@ -121,6 +124,7 @@ HEADERS += \
     cmd/cmdrotateselectedschematicitems.h \
     dialogs/addcomponentdialog.h \
     dialogs/editnetclassesdialog.h \
+    dialogs/memoryusagedialog.h \
     dialogs/projectpropertieseditordialog.h \
     dialogs/projectsettingsdialog.h \
     docks/ercmsgdock.h \
@@ -149,9 +153,11 @@ FORMS += \
     boardeditor/boardviapropertiesdialog.ui \
     boardeditor/deviceinstancepropertiesdialog.ui \
     boardeditor/fabricationoutputdialog.ui \
+    boardeditor/routingstatisticsdock.ui \
     boardeditor/unplacedcomponentsdock.ui \
     dialogs/addcomponentdialog.ui \
     dialogs/editnetclassesdialog.ui \
+    dialogs/memoryusagedialog.ui \
     dialogs/projectpropertieseditordialog.ui \
     dialogs/projectsettingsdialog.ui \
     docks/ercmsgdock.ui \
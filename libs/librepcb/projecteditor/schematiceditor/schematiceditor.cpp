@@ -128,6 +128,8 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
           [this]() { mProjectEditor.execNetClassesEditorDialog(this); });
   connect(mUi->actionProjectSettings, &QAction::triggered,
           [this]() { mProjectEditor.execProjectSettingsDialog(this); });
+  connect(mUi->actionMemoryUsage, &QAction::triggered,
+          [this]() { mProjectEditor.execMemoryUsageDialog(this); });
   connect(mUi->actionExportLppz, &QAction::triggered,
           [this]() { mProjectEditor.execLppzExportDialog(this); });
 
@@ -264,6 +266,7 @@ bool SchematicEditor::setActiveSchematicIndex(int index) noexcept {
   if (schematic) {
     // save current view scene rect
     schematic->saveViewSceneRect(mGraphicsView->getVisibleSceneRect());
+    schematic->hideFromView(*mGraphicsView);
   }
   schematic = mProject.getSchematicByIndex(index);
   if (schematic) {
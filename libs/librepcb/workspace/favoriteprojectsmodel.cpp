@@ -48,9 +48,8 @@ FavoriteProjectsModel::FavoriteProjectsModel(
     if (mFilePath.isExistingFile()) {
       SExpression root =
           SExpression::parse(FileUtils::readFile(mFilePath), mFilePath);
-      const QList<SExpression>& childs = root.getChildren("project");
-      foreach (const SExpression& child, childs) {
-        QString  path    = child.getValueOfFirstChild<QString>(true);
+      foreach (const SExpression* child, root.getChildren("project")) {
+        QString  path    = child->getValueOfFirstChild<QString>(true);
         FilePath absPath = FilePath::fromRelative(mWorkspace.getPath(), path);
         mAllProjects.append(absPath);
       }
@@ -93,11 +92,13 @@ void FavoriteProjectsModel::removeFavoriteProject(
 void FavoriteProjectsModel::updateVisibleProjects() noexcept {
   beginResetModel();
   mVisibleProjects.clear();
+  QSet<FilePath> processed;  // check every project only once
   foreach (const FilePath& fp, mAllProjects) {
-    if ((!mVisibleProjects.contains(fp)) && fp.isExistingFile()) {
+    if ((!processed.contains(fp)) && fp.isExistingFile()) {
       // show only existing projects
       mVisibleProjects.append(fp);
     }
+    processed.insert(fp);
   }
   endResetModel();
 }
@@ -47,13 +47,36 @@ namespace workspace {
 
 using namespace library;
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+// Read-only connections of the current thread, by WorkspaceLibraryDb instance
+// ID. Since the storage is thread local, each connection is closed in the
+// thread which has opened it, at latest when the thread exits.
+typedef QHash<int, std::shared_ptr<SQLiteDatabase>> ReadConnections;
+static QThreadStorage<ReadConnections> sReadConnections;
+
+// IDs of all existing WorkspaceLibraryDb objects, to detect connections of
+// already destroyed objects.
+static QSet<int>  sAliveInstances;
+static QMutex     sAliveInstancesMutex;
+static QAtomicInt sNextInstanceId(1);
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws)
-  : QObject(nullptr), mWorkspace(ws) {
+  : QObject(nullptr),
+    mWorkspace(ws),
+    mHasFullTextSearch(false),
+    mInstanceId(sNextInstanceId.fetchAndAddRelaxed(1)) {
   qDebug("Load workspace library database...");
+  {
+    QMutexLocker lock(&sAliveInstancesMutex);
+    sAliveInstances.insert(mInstanceId);
+  }
 
   // open SQLite database
   mFilePath = ws.getLibrariesPath().getPathTo(
@@ -72,6 +95,10 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws)
     createAllTables();                         // can throw
     setDbVersion(sCurrentDbVersion);           // can throw
   }
+  mHasFullTextSearch = hasFullTextSearchTables();  // can throw
+  if (!mHasFullTextSearch) {
+    qWarning() << "SQLite FTS5 not available, library search will be slow.";
+  }
 
   // create library scanner object
   mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace, mFilePath));
@@ -82,17 +109,40 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws)
           &WorkspaceLibraryDb::scanLibraryListUpdated, Qt::QueuedConnection);
   connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::scanProgressUpdate,
           this, &WorkspaceLibraryDb::scanProgressUpdate, Qt::QueuedConnection);
+  connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::elementsModified,
+          this, &WorkspaceLibraryDb::invalidateElementTranslations,
+          Qt::QueuedConnection);
   connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::scanSucceeded, this,
           &WorkspaceLibraryDb::scanSucceeded, Qt::QueuedConnection);
+  // Note: Must be connected before anyone else can connect to scanSucceeded()
+  // to make sure they don't get outdated file paths from the index.
+  connect(this, &WorkspaceLibraryDb::scanSucceeded, this,
+          &WorkspaceLibraryDb::clearLatestElementsIndex);
   connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::scanFailed, this,
           &WorkspaceLibraryDb::scanFailed, Qt::QueuedConnection);
   connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::scanFinished, this,
           &WorkspaceLibraryDb::scanFinished, Qt::QueuedConnection);
 
+  // rescan libraries automatically when they are modified
+  mRescanTimer.setSingleShot(true);
+  mRescanTimer.setInterval(sRescanDelayMs);
+  connect(&mRescanTimer, &QTimer::timeout, this,
+          &WorkspaceLibraryDb::startLibraryRescan);
+  connect(&mWatcher, &QFileSystemWatcher::directoryChanged, &mRescanTimer,
+          static_cast<void (QTimer::*)()>(&QTimer::start));
+  connect(this, &WorkspaceLibraryDb::scanSucceeded, this,
+          &WorkspaceLibraryDb::updateWatchedDirectories);
+  updateWatchedDirectories();
+
   qDebug("Workspace library database successfully loaded!");
 }
 
 WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
+  // Note: Read-only connections of other threads must not be closed here, but
+  // in their own threads. They get closed on their next call to getDb() of any
+  // WorkspaceLibraryDb object, or when the thread exits.
+  QMutexLocker lock(&sAliveInstancesMutex);
+  sAliveInstances.remove(mInstanceId);
 }
 
 /*******************************************************************************
@@ -101,8 +151,8 @@ WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
 
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getLibraries() const {
   QSqlQuery query =
-      mDb->prepareQuery("SELECT version, filepath FROM libraries");
-  mDb->exec(query);
+      getDb().prepareQuery("SELECT version, filepath FROM libraries");
+  getDb().exec(query);
 
   QMultiMap<Version, FilePath> libraries;
   while (query.next()) {
@@ -163,32 +213,32 @@ QMultiMap<Version, FilePath> WorkspaceLibraryDb::getDevices(
  ******************************************************************************/
 
 FilePath WorkspaceLibraryDb::getLatestLibrary(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getLibraries(uuid));
+  return getLatestElement("libraries", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestComponentCategory(
     const Uuid& uuid) const {
-  return getLatestVersionFilePath(getComponentCategories(uuid));
+  return getLatestElement("component_categories", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestPackageCategory(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getPackageCategories(uuid));
+  return getLatestElement("package_categories", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestSymbol(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getSymbols(uuid));
+  return getLatestElement("symbols", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestPackage(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getPackages(uuid));
+  return getLatestElement("packages", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestComponent(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getComponents(uuid));
+  return getLatestElement("components", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestDevice(const Uuid& uuid) const {
-  return getLatestVersionFilePath(getDevices(uuid));
+  return getLatestElement("devices", uuid);
 }
 
 /*******************************************************************************
@@ -197,44 +247,142 @@ FilePath WorkspaceLibraryDb::getLatestDevice(const Uuid& uuid) const {
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Library>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("libraries", "lib_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("libraries", "lib_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<ComponentCategory>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("component_categories", "cat_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("component_categories", "cat_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<PackageCategory>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("package_categories", "cat_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("package_categories", "cat_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Symbol>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("symbols", "symbol_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("symbols", "symbol_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Package>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("packages", "package_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("packages", "package_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Component>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("components", "component_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("components", "component_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Device>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("devices", "device_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("devices", "device_id", keyword, limit,
+                                    offset);
+}
+
+QList<WorkspaceLibraryDb::ComponentSearchResult>
+    WorkspaceLibraryDb::searchComponentsAndDevices(
+        const QString& keyword) const {
+  QString ftsQuery = buildFullTextQuery(keyword);
+  bool    fullText = mHasFullTextSearch && (!ftsQuery.isEmpty());
+
+  // Note: Matching components are joined with all their devices, matching
+  // devices with their component. Elements are matched by UUID, so all their
+  // versions are returned and the latest ones are picked afterwards.
+  QString columns(
+      "SELECT components.uuid, components.version, components.filepath, "
+      "devices.uuid, devices.version, devices.filepath, "
+      "packages.uuid, packages.version, packages.filepath, "
+      "components.uuid IN matching_components, "
+      "devices.uuid IN matching_devices ");
+  QSqlQuery query = getDb().prepareQuery(
+      "WITH matching_components AS (" %
+      buildSearchKeywordSubquery("components", "component_id", fullText) %
+      "), matching_devices AS (" %
+      buildSearchKeywordSubquery("devices", "device_id", fullText) % ") " %
+      columns %
+      "FROM components "
+      "LEFT JOIN devices ON devices.component_uuid = components.uuid "
+      "LEFT JOIN packages ON packages.uuid = devices.package_uuid "
+      "WHERE components.uuid IN matching_components "
+      "UNION ALL " %
+      columns %
+      "FROM devices "
+      "INNER JOIN components ON components.uuid = devices.component_uuid "
+      "LEFT JOIN packages ON packages.uuid = devices.package_uuid "
+      "WHERE devices.uuid IN matching_devices");
+  if (fullText) {
+    query.bindValue(":query", ftsQuery);
+  } else {
+    query.bindValue(":keyword", "%" + keyword + "%");
+  }
+  getDb().exec(query);  // can throw
+
+  // determine the latest version of each element
+  struct LatestVersions {
+    QHash<QString, Version> versions;
+    QHash<QString, QString> filepaths;
+  };
+  LatestVersions components, devices, packages;
+  auto updateLatest = [&query](LatestVersions& latest, int column) {
+    QString uuid = query.value(column).toString();
+    if (uuid.isNull()) return;
+    Version version =
+        Version::fromString(query.value(column + 1).toString());  // can throw
+    auto it = latest.versions.find(uuid);
+    if ((it == latest.versions.end()) || (version > *it)) {
+      latest.versions.insert(uuid, version);
+      latest.filepaths.insert(uuid, query.value(column + 2).toString());
+    }
+  };
+  QVector<QVector<QVariant>> rows;
+  while (query.next()) {
+    updateLatest(components, 0);  // can throw
+    updateLatest(devices, 3);     // can throw
+    updateLatest(packages, 6);    // can throw
+    QVector<QVariant> row;
+    for (int i = 0; i < 11; ++i) {
+      row.append(query.value(i));
+    }
+    rows.append(row);
+  }
+
+  // return only the rows of the latest components and devices
+  auto toFilePath = [this](const QString& relativePath) -> FilePath {
+    if (relativePath.isEmpty()) return FilePath();
+    return FilePath::fromRelative(mWorkspace.getLibrariesPath(), relativePath);
+  };
+  QList<ComponentSearchResult> results;
+  QSet<QString>                added;
+  foreach (const QVector<QVariant>& row, rows) {
+    QString cmpUuid = row.at(0).toString();
+    QString devUuid = row.at(3).toString();
+    if ((row.at(2).toString() != components.filepaths.value(cmpUuid)) ||
+        (row.at(5).toString() != devices.filepaths.value(devUuid)) ||
+        (added.contains(cmpUuid % devUuid))) {
+      continue;
+    }
+    added.insert(cmpUuid % devUuid);
+    results.append(ComponentSearchResult{
+        toFilePath(row.at(2).toString()), toFilePath(row.at(5).toString()),
+        toFilePath(packages.filepaths.value(row.at(6).toString())),
+        row.at(9).toBool(), row.at(10).toBool()});
+  }
+  return results;
 }
 
 /*******************************************************************************
@@ -338,62 +486,69 @@ void WorkspaceLibraryDb::getElementTranslations<Device>(
 }
 
 template <>
-void WorkspaceLibraryDb::getElementMetadata<Library>(const FilePath elemDir,
-                                                     Uuid*          uuid,
-                                                     Version* version) const {
-  return getElementMetadata("libraries", elemDir, uuid, version);
+void WorkspaceLibraryDb::getElementMetadata<Library>(
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  // Note: Libraries have no content hash.
+  if (contentHash) *contentHash = QByteArray();
+  return getElementMetadata("libraries", elemDir, uuid, version, nullptr);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementMetadata<ComponentCategory>(
-    const FilePath elemDir, Uuid* uuid, Version* version) const {
-  return getElementMetadata("component_categories", elemDir, uuid, version);
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("component_categories", elemDir, uuid, version,
+                            contentHash);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementMetadata<PackageCategory>(
-    const FilePath elemDir, Uuid* uuid, Version* version) const {
-  return getElementMetadata("package_categories", elemDir, uuid, version);
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("package_categories", elemDir, uuid, version,
+                            contentHash);
 }
 
 template <>
-void WorkspaceLibraryDb::getElementMetadata<Symbol>(const FilePath elemDir,
-                                                    Uuid*          uuid,
-                                                    Version* version) const {
-  return getElementMetadata("symbols", elemDir, uuid, version);
+void WorkspaceLibraryDb::getElementMetadata<Symbol>(
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("symbols", elemDir, uuid, version, contentHash);
 }
 
 template <>
-void WorkspaceLibraryDb::getElementMetadata<Package>(const FilePath elemDir,
-                                                     Uuid*          uuid,
-                                                     Version* version) const {
-  return getElementMetadata("packages", elemDir, uuid, version);
+void WorkspaceLibraryDb::getElementMetadata<Package>(
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("packages", elemDir, uuid, version, contentHash);
 }
 
 template <>
-void WorkspaceLibraryDb::getElementMetadata<Component>(const FilePath elemDir,
-                                                       Uuid*          uuid,
-                                                       Version* version) const {
-  return getElementMetadata("components", elemDir, uuid, version);
+void WorkspaceLibraryDb::getElementMetadata<Component>(
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("components", elemDir, uuid, version, contentHash);
 }
 
 template <>
-void WorkspaceLibraryDb::getElementMetadata<Device>(const FilePath elemDir,
-                                                    Uuid*          uuid,
-                                                    Version* version) const {
-  return getElementMetadata("devices", elemDir, uuid, version);
+void WorkspaceLibraryDb::getElementMetadata<Device>(
+    const FilePath elemDir, Uuid* uuid, Version* version,
+    QByteArray* contentHash) const {
+  return getElementMetadata("devices", elemDir, uuid, version, contentHash);
 }
 
 void WorkspaceLibraryDb::getLibraryMetadata(const FilePath libDir,
                                             QPixmap*       icon) const {
-  QSqlQuery query = mDb->prepareQuery(
+  QSqlQuery query = getDb().prepareQuery(
       "SELECT icon_png FROM libraries WHERE filepath = :filepath");
   query.bindValue(":filepath",
                   libDir.toRelative(mWorkspace.getLibrariesPath()));
-  mDb->exec(query);
+  getDb().exec(query);
 
   if (query.first()) {
     QByteArray blob = query.value(0).toByteArray();
+    query.finish();
     if (icon) icon->loadFromData(blob, "png");
   } else {
     throw RuntimeError(
@@ -405,17 +560,20 @@ void WorkspaceLibraryDb::getLibraryMetadata(const FilePath libDir,
 
 void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir,
                                            Uuid* pkgUuid, Uuid* cmpUuid) const {
-  QSqlQuery query = mDb->prepareQuery(
+  QSqlQuery query = getDb().prepareQuery(
       "SELECT package_uuid, component_uuid "
       "FROM devices WHERE filepath = :filepath");
   query.bindValue(":filepath",
                   devDir.toRelative(mWorkspace.getLibrariesPath()));
-  mDb->exec(query);
+  getDb().exec(query);
 
   if (query.first()) {
-    Uuid uuid = Uuid::fromString(query.value(0).toString());  // can throw
+    const QString pkg = query.value(0).toString();
+    const QString cmp = query.value(1).toString();
+    query.finish();
+    Uuid uuid = Uuid::fromString(pkg);  // can throw
     if (pkgUuid) *pkgUuid = uuid;
-    uuid = Uuid::fromString(query.value(1).toString());  // can throw
+    uuid = Uuid::fromString(cmp);  // can throw
     if (cmpUuid) *cmpUuid = uuid;
   } else {
     throw RuntimeError(
@@ -425,6 +583,117 @@ void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir,
   }
 }
 
+/*******************************************************************************
+ *  Getters: Batch Lookups
+ ******************************************************************************/
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<Library>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("libraries", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<ComponentCategory>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("component_categories", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<PackageCategory>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("package_categories", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<Symbol>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("symbols", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<Package>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("packages", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<Component>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("components", uuids);
+}
+
+template <>
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements<Device>(
+    const QSet<Uuid>& uuids) const {
+  return getLatestElements("devices", uuids);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<Library>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("libraries", "lib_id", elemDirs, localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<ComponentCategory>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("component_categories", "cat_id", elemDirs,
+                         localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<PackageCategory>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("package_categories", "cat_id", elemDirs, localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<Symbol>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("symbols", "symbol_id", elemDirs, localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<Package>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("packages", "package_id", elemDirs, localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<Component>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("components", "component_id", elemDirs, localeOrder);
+}
+
+template <>
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames<Device>(
+    const QList<FilePath>& elemDirs, const QStringList& localeOrder) const {
+  return getElementNames("devices", "device_id", elemDirs, localeOrder);
+}
+
+void WorkspaceLibraryDb::getDevicesMetadata(
+    const QList<FilePath>& devDirs, QHash<FilePath, Uuid>* pkgUuids,
+    QHash<FilePath, Uuid>* cmpUuids) const {
+  QStringList paths;
+  foreach (const FilePath& fp, devDirs) {
+    paths.append(fp.toRelative(mWorkspace.getLibrariesPath()));
+  }
+  execForEachValue(
+      "SELECT filepath, package_uuid, component_uuid FROM devices "
+      "WHERE filepath IN (%1)",
+      paths, [&](const QSqlQuery& query) {
+        FilePath fp = FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                             query.value(0).toString());
+        Uuid     pkgUuid =
+            Uuid::fromString(query.value(1).toString());  // can throw
+        Uuid cmpUuid =
+            Uuid::fromString(query.value(2).toString());  // can throw
+        if (pkgUuids) pkgUuids->insert(fp, pkgUuid);
+        if (cmpUuids) cmpUuids->insert(fp, cmpUuid);
+      });  // can throw
+}
+
 /*******************************************************************************
  *  Getters: Special
  ******************************************************************************/
@@ -499,10 +768,10 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesByCategory(
 
 QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(
     const Uuid& component) const {
-  QSqlQuery query = mDb->prepareQuery(
+  QSqlQuery query = getDb().prepareQuery(
       "SELECT uuid FROM devices WHERE component_uuid = :uuid");
   query.bindValue(":uuid", component.toStr());
-  mDb->exec(query);
+  getDb().exec(query);
 
   QSet<Uuid> elements;
   while (query.next()) {
@@ -511,6 +780,22 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(
   return elements;
 }
 
+QMultiHash<Uuid, Uuid> WorkspaceLibraryDb::getDevicesOfComponents(
+    const QSet<Uuid>& components) const {
+  QStringList uuids;
+  foreach (const Uuid& uuid, components) {
+    uuids.append(uuid.toStr());
+  }
+  QMultiHash<Uuid, Uuid> elements;
+  execForEachValue(
+      "SELECT component_uuid, uuid FROM devices WHERE component_uuid IN (%1)",
+      uuids, [&elements](const QSqlQuery& query) {
+        elements.insert(Uuid::fromString(query.value(0).toString()),
+                        Uuid::fromString(query.value(1).toString()));
+      });  // can throw
+  return elements;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -529,59 +814,134 @@ void WorkspaceLibraryDb::getElementTranslations(const QString&     table,
                                                 const QStringList& localeOrder,
                                                 QString* name, QString* desc,
                                                 QString* keywords) const {
-  QSqlQuery query = mDb->prepareQuery(
-      "SELECT locale, name, description, keywords FROM " % table %
-      "_tr "
-      "INNER JOIN " %
-      table % " ON " % table % ".id=" % table % "_tr." % idRow %
-      " "
-      "WHERE " %
-      table % ".filepath = :filepath");
-  query.bindValue(":filepath",
-                  elemDir.toRelative(mWorkspace.getLibrariesPath()));
-  mDb->exec(query);
+  // Note: The translations are looked up very often (e.g. for every item of
+  // the category trees), thus they are cached. On the first lookup of a
+  // table with a locale order, the translations of all its elements are
+  // loaded at once. The cache entries of modified elements are removed
+  // after every library scan (see #invalidateElementTranslations()).
+  QString      filepath  = elemDir.toRelative(mWorkspace.getLibrariesPath());
+  QString      localeKey = localeOrder.join(",");
+  QMutexLocker lock(&mTranslationsMutex);
+  QHash<QString, QHash<QString, Translations>>& tableCache =
+      mTranslations[table];
+  auto localeIt = tableCache.find(localeKey);
+  if (localeIt == tableCache.end()) {
+    localeIt = tableCache.insert(
+        localeKey, loadElementTranslations(table, idRow, QString(),
+                                           localeOrder));  // can throw
+  }
+  auto it = localeIt->find(filepath);
+  if (it == localeIt->end()) {
+    // Not loaded yet, or modified by the last scan. Elements which don't
+    // exist in the database are cached too, with the default values.
+    QHash<QString, Translations> loaded = loadElementTranslations(
+        table, idRow, filepath, localeOrder);  // can throw
+    it = localeIt->insert(
+        filepath,
+        loaded.value(filepath, Translations{"unknown", "unknown", "unknown"}));
+  }
 
-  LocalizedNameMap        nameMap(ElementName("unknown"));
-  LocalizedDescriptionMap descriptionMap("unknown");
-  LocalizedKeywordsMap    keywordsMap("unknown");
+  if (name) *name = it->name;
+  if (desc) *desc = it->description;
+  if (keywords) *keywords = it->keywords;
+}
+
+QHash<QString, WorkspaceLibraryDb::Translations>
+    WorkspaceLibraryDb::loadElementTranslations(
+        const QString& table, const QString& idRow, const QString& filepath,
+        const QStringList& localeOrder) const {
+  QString queryStr = "SELECT " % table %
+      ".filepath, locale, name, description, keywords FROM " % table %
+      "_tr INNER JOIN " % table % " ON " % table % ".id=" % table % "_tr." %
+      idRow;
+  if (!filepath.isNull()) {
+    queryStr += " WHERE " % table % ".filepath = :filepath";
+  }
+  QSqlQuery query = getDb().prepareQuery(queryStr);
+  if (!filepath.isNull()) {
+    query.bindValue(":filepath", filepath);
+  }
+  getDb().exec(query);
+
+  struct Maps {
+    LocalizedNameMap        names;
+    LocalizedDescriptionMap descriptions;
+    LocalizedKeywordsMap    keywords;
+    Maps()
+      : names(ElementName("unknown")),
+        descriptions("unknown"),
+        keywords("unknown") {}
+  };
+  QHash<QString, Maps> maps;
   while (query.next()) {
-    QString locale      = query.value(0).toString();
-    QString name        = query.value(1).toString();
-    QString description = query.value(2).toString();
-    QString keywords    = query.value(3).toString();
-    if (!name.isNull()) nameMap.insert(locale, ElementName(name));  // can throw
-    if (!description.isNull()) descriptionMap.insert(locale, description);
-    if (!keywords.isNull()) keywordsMap.insert(locale, keywords);
+    Maps&   elementMaps = maps[query.value(0).toString()];
+    QString locale      = query.value(1).toString();
+    QString name        = query.value(2).toString();
+    QString description = query.value(3).toString();
+    QString keywords    = query.value(4).toString();
+    if (!name.isNull()) {
+      elementMaps.names.insert(locale, ElementName(name));  // can throw
+    }
+    if (!description.isNull()) {
+      elementMaps.descriptions.insert(locale, description);
+    }
+    if (!keywords.isNull()) {
+      elementMaps.keywords.insert(locale, keywords);
+    }
   }
 
-  if (name) *name = *nameMap.value(localeOrder);
-  if (desc) *desc = descriptionMap.value(localeOrder);
-  if (keywords) *keywords = keywordsMap.value(localeOrder);
+  QHash<QString, Translations> translations;
+  for (auto it = maps.constBegin(); it != maps.constEnd(); ++it) {
+    translations.insert(it.key(),
+                        Translations{*it->names.value(localeOrder),
+                                     it->descriptions.value(localeOrder),
+                                     it->keywords.value(localeOrder)});
+  }
+  return translations;
+}
+
+void WorkspaceLibraryDb::invalidateElementTranslations(
+    const QStringList& filepaths) noexcept {
+  QMutexLocker lock(&mTranslationsMutex);
+  // Library metadata is updated on every scan, so just reload all of them.
+  mTranslations.remove("libraries");
+  for (auto tableIt = mTranslations.begin(); tableIt != mTranslations.end();
+       ++tableIt) {
+    for (auto localeIt = tableIt->begin(); localeIt != tableIt->end();
+         ++localeIt) {
+      foreach (const QString& filepath, filepaths) {
+        localeIt->remove(filepath);
+      }
+    }
+  }
 }
 
 void WorkspaceLibraryDb::getElementMetadata(const QString& table,
                                             const FilePath elemDir, Uuid* uuid,
-                                            Version* version) const {
-  QSqlQuery query = mDb->prepareQuery("SELECT uuid, version FROM " % table %
-                                      " WHERE filepath = :filepath");
+                                            Version*    version,
+                                            QByteArray* contentHash) const {
+  QSqlQuery query = getDb().prepareQuery(
+      "SELECT uuid, version" % QString(contentHash ? ", file_hash" : "") %
+      " FROM " % table % " WHERE filepath = :filepath");
   query.bindValue(":filepath",
                   elemDir.toRelative(mWorkspace.getLibrariesPath()));
-  mDb->exec(query);
+  getDb().exec(query);
 
   while (query.next()) {
     QString uuidStr    = query.value(0).toString();
     QString versionStr = query.value(1).toString();
     if (uuid) *uuid = Uuid::fromString(uuidStr);              // can throw
     if (version) *version = Version::fromString(versionStr);  // can throw
+    if (contentHash) *contentHash = query.value(2).toByteArray();
   }
 }
 
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
     const QString& tablename, const Uuid& uuid) const {
-  QSqlQuery query = mDb->prepareQuery("SELECT version, filepath FROM " %
-                                      tablename % " WHERE uuid = :uuid");
+  QSqlQuery query = getDb().prepareQuery("SELECT version, filepath FROM " %
+                                         tablename % " WHERE uuid = :uuid");
   query.bindValue(":uuid", uuid.toStr());
-  mDb->exec(query);
+  getDb().exec(query);
 
   QMultiMap<Version, FilePath> elements;
   while (query.next()) {
@@ -598,21 +958,125 @@ QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
   return elements;
 }
 
-FilePath WorkspaceLibraryDb::getLatestVersionFilePath(
-    const QMultiMap<Version, FilePath>& list) const noexcept {
-  if (list.isEmpty())
-    return FilePath();
-  else
-    return list.last();  // highest version number
+FilePath WorkspaceLibraryDb::getLatestElement(const QString& tablename,
+                                              const Uuid&    uuid) const {
+  QMutexLocker lock(&mLatestElementsMutex);
+  return getLatestElementsIndex(tablename).value(uuid);  // can throw
+}
+
+QHash<Uuid, FilePath> WorkspaceLibraryDb::getLatestElements(
+    const QString& tablename, const QSet<Uuid>& uuids) const {
+  QMutexLocker                 lock(&mLatestElementsMutex);
+  const QHash<Uuid, FilePath>& index =
+      getLatestElementsIndex(tablename);  // can throw
+  QHash<Uuid, FilePath> elements;
+  foreach (const Uuid& uuid, uuids) {
+    auto it = index.find(uuid);
+    if (it != index.end()) {
+      elements.insert(uuid, *it);
+    }
+  }
+  return elements;
+}
+
+const QHash<Uuid, FilePath>& WorkspaceLibraryDb::getLatestElementsIndex(
+    const QString& tablename) const {
+  auto indexIt = mLatestElements.find(tablename);
+  if (indexIt != mLatestElements.end()) {
+    return *indexIt;
+  }
+
+  QSqlQuery query = getDb().prepareQuery(
+      "SELECT uuid, version, filepath FROM " % tablename);
+  getDb().exec(query);  // can throw
+
+  QHash<Uuid, FilePath> elements;
+  QHash<Uuid, Version>  versions;
+  while (query.next()) {
+    Uuid    uuid = Uuid::fromString(query.value(0).toString());  // can throw
+    Version version =
+        Version::fromString(query.value(1).toString());  // can throw
+    FilePath filepath(FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                             query.value(2).toString()));
+    if (!filepath.isValid()) {
+      throw LogicError(__FILE__, __LINE__);
+    }
+    auto it = versions.find(uuid);
+    if ((it == versions.end()) || (version > *it)) {
+      versions.insert(uuid, version);
+      elements.insert(uuid, filepath);
+    }
+  }
+  return *mLatestElements.insert(tablename, elements);
+}
+
+void WorkspaceLibraryDb::clearLatestElementsIndex() noexcept {
+  QMutexLocker lock(&mLatestElementsMutex);
+  mLatestElements.clear();
+}
+
+QHash<FilePath, QString> WorkspaceLibraryDb::getElementNames(
+    const QString& table, const QString& idRow, const QList<FilePath>& elemDirs,
+    const QStringList& localeOrder) const {
+  QStringList paths;
+  foreach (const FilePath& fp, elemDirs) {
+    paths.append(fp.toRelative(mWorkspace.getLibrariesPath()));
+  }
+  QHash<QString, QList<QPair<QString, QString>>> translations;
+  execForEachValue(QString("SELECT %1.filepath, locale, name FROM %1_tr "
+                           "INNER JOIN %1 ON %1.id = %1_tr.%2 "
+                           "WHERE %1.filepath IN (%3)")
+                       .arg(table, idRow, "%1"),
+                   paths, [&translations](const QSqlQuery& query) {
+                     QString name = query.value(2).toString();
+                     if (!name.isNull()) {
+                       translations[query.value(0).toString()].append(
+                           qMakePair(query.value(1).toString(), name));
+                     }
+                   });  // can throw
+
+  QHash<FilePath, QString> names;
+  for (auto it = translations.begin(); it != translations.end(); ++it) {
+    LocalizedNameMap nameMap(ElementName("unknown"));
+    foreach (const auto& pair, it.value()) {
+      nameMap.insert(pair.first, ElementName(pair.second));  // can throw
+    }
+    FilePath fp =
+        FilePath::fromRelative(mWorkspace.getLibrariesPath(), it.key());
+    names.insert(fp, *nameMap.value(localeOrder));
+  }
+  return names;
+}
+
+void WorkspaceLibraryDb::execForEachValue(
+    const QString& queryStr, const QStringList& values,
+    const std::function<void(const QSqlQuery&)>& rowHandler) const {
+  for (int first = 0; first < values.count(); first += sMaxValuesPerQuery) {
+    QStringList chunk = values.mid(first, sMaxValuesPerQuery);
+    // The number of placeholders is rounded up to the next power of two to
+    // get only a few different queries, so they can be cached. The padding
+    // repeats the last value, which doesn't affect the result of "IN".
+    int placeholders = 1;
+    while (placeholders < chunk.count()) placeholders *= 2;
+    QSqlQuery query = getDb().prepareQuery(
+        queryStr.arg(QString("?, ").repeated(placeholders - 1) % "?"));
+    for (int i = 0; i < placeholders; ++i) {
+      query.bindValue(i, chunk.at(qMin(i, chunk.count() - 1)));
+    }
+    getDb().exec(query);  // can throw
+    while (query.next()) {
+      rowHandler(query);  // can throw
+    }
+  }
 }
 
 QSet<Uuid> WorkspaceLibraryDb::getCategoryChilds(
     const QString& tablename, const tl::optional<Uuid>& categoryUuid) const {
-  QSqlQuery query = mDb->prepareQuery(
+  QSqlQuery query = getDb().prepareQuery(
       "SELECT uuid FROM " % tablename % " WHERE parent_uuid " %
-      (categoryUuid ? "= '" % categoryUuid->toStr() % "'"
-                    : QString("IS NULL")));
-  mDb->exec(query);
+      (categoryUuid ? QString("= :uuid") : QString("IS NULL")));
+  if (categoryUuid) query.bindValue(":uuid", categoryUuid->toStr());
+  getDb().exec(query);
 
   QSet<Uuid> elements;
   while (query.next()) {
@@ -640,13 +1104,15 @@ QList<Uuid> WorkspaceLibraryDb::getCategoryParents(const QString& tablename,
 
 tl::optional<Uuid> WorkspaceLibraryDb::getCategoryParent(
     const QString& tablename, const Uuid& category) const {
-  QSqlQuery query = mDb->prepareQuery(
-      "SELECT parent_uuid FROM " % tablename % " WHERE uuid = '" %
-      category.toStr() % "'" % " ORDER BY version DESC" % " LIMIT 1");
-  mDb->exec(query);
+  QSqlQuery query = getDb().prepareQuery(
+      "SELECT parent_uuid FROM " % tablename %
+      " WHERE uuid = :uuid ORDER BY version DESC LIMIT 1");
+  query.bindValue(":uuid", category.toStr());
+  getDb().exec(query);
 
   if (query.next()) {
     QVariant value = query.value(0);
+    query.finish();
     if (!value.isNull()) {
       return Uuid::fromString(value.toString());  // can throw
     } else {
@@ -663,36 +1129,50 @@ tl::optional<Uuid> WorkspaceLibraryDb::getCategoryParent(
 
 int WorkspaceLibraryDb::getCategoryChildCount(
     const QString& tablename, const tl::optional<Uuid>& category) const {
-  QSqlQuery query = mDb->prepareQuery(
+  QSqlQuery query = getDb().prepareQuery(
       "SELECT COUNT(*) FROM " % tablename % " WHERE parent_uuid " %
-      (category ? "= '" % category->toStr() % "'" : QString("IS NULL")));
-  return mDb->count(query);
+      (category ? QString("= :uuid") : QString("IS NULL")));
+  if (category) query.bindValue(":uuid", category->toStr());
+  return getDb().count(query);
 }
 
 int WorkspaceLibraryDb::getCategoryElementCount(
     const QString& tablename, const QString& idrowname,
     const tl::optional<Uuid>& category) const {
-  QSqlQuery query = mDb->prepareQuery(
-      "SELECT COUNT(*) FROM " % tablename % " LEFT JOIN " % tablename % "_cat" %
-      " ON " % tablename % ".id=" % tablename % "_cat." % idrowname %
-      " WHERE category_uuid " %
-      (category ? "= '" % category->toStr() % "'" : QString("IS NULL")));
-  return mDb->count(query);
+  // Note: Elements without category are looked up with NOT EXISTS instead of
+  // a LEFT JOIN to allow using the index of the category table.
+  QSqlQuery query;
+  if (category) {
+    query = getDb().prepareQuery("SELECT COUNT(*) FROM " % tablename %
+                                 "_cat WHERE category_uuid = :uuid");
+    query.bindValue(":uuid", category->toStr());
+  } else {
+    query = getDb().prepareQuery(
+        QString("SELECT COUNT(*) FROM %1 WHERE NOT EXISTS "
+                "(SELECT 1 FROM %1_cat WHERE %1_cat.%2 = %1.id)")
+            .arg(tablename, idrowname));
+  }
+  return getDb().count(query);
 }
 
 QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(
     const QString& tablename, const QString& idrowname,
     const tl::optional<Uuid>& categoryUuid) const {
-  QSqlQuery query = mDb->prepareQuery(
-      "SELECT uuid FROM " % tablename % " LEFT JOIN " % tablename %
-      "_cat "
-      "ON " %
-      tablename % ".id=" % tablename % "_cat." % idrowname %
-      " "
-      "WHERE category_uuid " %
-      (categoryUuid ? "= '" % categoryUuid->toStr() % "'"
-                    : QString("IS NULL")));
-  mDb->exec(query);
+  QSqlQuery query;
+  if (categoryUuid) {
+    query = getDb().prepareQuery(
+        QString("SELECT %1.uuid FROM %1_cat "
+                "INNER JOIN %1 ON %1.id = %1_cat.%2 "
+                "WHERE %1_cat.category_uuid = :uuid")
+            .arg(tablename, idrowname));
+    query.bindValue(":uuid", categoryUuid->toStr());
+  } else {
+    query = getDb().prepareQuery(
+        QString("SELECT uuid FROM %1 WHERE NOT EXISTS "
+                "(SELECT 1 FROM %1_cat WHERE %1_cat.%2 = %1.id)")
+            .arg(tablename, idrowname));
+  }
+  getDb().exec(query);
 
   QSet<Uuid> elements;
   while (query.next()) {
@@ -702,38 +1182,97 @@ QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(
 }
 
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword(
-    const QString& tablename, const QString& idrowname,
-    const QString& keyword) const {
-  QSqlQuery query = mDb->prepareQuery(QString("SELECT %1.uuid FROM %1, %1_tr "
-                                              "ON %1.id=%1_tr.%2 "
-                                              "WHERE %1_tr.name LIKE :keyword "
-                                              "OR %1_tr.keywords LIKE :keyword "
-                                              "ORDER BY %1_tr.name ASC ")
-                                          .arg(tablename, idrowname));
-  query.bindValue(":keyword", "%" + keyword + "%");
-  mDb->exec(query);
+    const QString& tablename, const QString& idrowname, const QString& keyword,
+    int limit, int offset) const {
+  QString   ftsQuery = buildFullTextQuery(keyword);
+  QSqlQuery query;
+  if (mHasFullTextSearch && (!ftsQuery.isEmpty())) {
+    // Note: An element may match with several translations, so the results
+    // are grouped by element and sorted by their best match.
+    query = getDb().prepareQuery(
+        QString("SELECT %1.uuid FROM ("
+                "SELECT rowid, rank FROM %1_fts WHERE %1_fts MATCH :query"
+                ") AS matches "
+                "INNER JOIN %1_tr ON %1_tr.id = matches.rowid "
+                "INNER JOIN %1 ON %1.id = %1_tr.%2 "
+                "GROUP BY %1.uuid "
+                "ORDER BY MIN(matches.rank) ASC, MIN(%1_tr.name) ASC "
+                "LIMIT :limit OFFSET :offset")
+            .arg(tablename, idrowname));
+    query.bindValue(":query", ftsQuery);
+  } else {
+    query = getDb().prepareQuery(QString("SELECT %1.uuid FROM %1, %1_tr "
+                                         "ON %1.id=%1_tr.%2 "
+                                         "WHERE %1_tr.name LIKE :keyword "
+                                         "OR %1_tr.keywords LIKE :keyword "
+                                         "GROUP BY %1.uuid "
+                                         "ORDER BY MIN(%1_tr.name) ASC "
+                                         "LIMIT :limit OFFSET :offset")
+                                     .arg(tablename, idrowname));
+    query.bindValue(":keyword", "%" + keyword + "%");
+  }
+  query.bindValue(":limit", limit);
+  query.bindValue(":offset", offset);
+  getDb().exec(query);
 
   QList<Uuid> elements;
-  elements.reserve(query.size());
   while (query.next()) {
     elements.append(Uuid::fromString(query.value(0).toString()));  // can throw
   }
   return elements;
 }
 
+QString WorkspaceLibraryDb::buildFullTextQuery(
+    const QString& keyword) noexcept {
+  // Quote every word to avoid interpreting FTS5 operators, and append "*" to
+  // get prefix matches. Multiple words are implicitly AND-ed by FTS5. Words
+  // without any letters or digits are skipped since the tokenizer would drop
+  // them anyway.
+  QStringList terms;
+  foreach (QString word, keyword.split(QRegularExpression("\\s+"),
+                                       QString::SkipEmptyParts)) {
+    if (!word.contains(QRegularExpression("[\\p{L}\\p{N}]"))) continue;
+    word.replace('"', "\"\"");
+    terms.append('"' % word % "\"*");
+  }
+  return terms.join(' ');
+}
+
+QString WorkspaceLibraryDb::buildSearchKeywordSubquery(
+    const QString& tablename, const QString& idrowname,
+    bool fullText) noexcept {
+  // Returns the UUIDs of all elements matching the bound ":query" (full-text
+  // search) or ":keyword" (substring search).
+  if (fullText) {
+    return QString(
+               "SELECT %1.uuid FROM %1 WHERE %1.id IN ("
+               "SELECT %1_tr.%2 FROM %1_tr WHERE %1_tr.id IN ("
+               "SELECT rowid FROM %1_fts WHERE %1_fts MATCH :query))")
+        .arg(tablename, idrowname);
+  } else {
+    return QString(
+               "SELECT %1.uuid FROM %1 WHERE %1.id IN ("
+               "SELECT %1_tr.%2 FROM %1_tr "
+               "WHERE %1_tr.name LIKE :keyword "
+               "OR %1_tr.keywords LIKE :keyword)")
+        .arg(tablename, idrowname);
+  }
+}
+
 int WorkspaceLibraryDb::getLibraryId(const FilePath& lib) const {
   QString   relativeLibraryPath = lib.toRelative(mWorkspace.getLibrariesPath());
-  QSqlQuery query               = mDb->prepareQuery(
+  QSqlQuery query               = getDb().prepareQuery(
       "SELECT id FROM libraries "
       "WHERE filepath = '" %
       relativeLibraryPath %
       "'"
       "LIMIT 1");
-  mDb->exec(query);
+  getDb().exec(query);
 
   if (query.next()) {
     bool ok = false;
     int  id = query.value(0).toInt(&ok);
+    query.finish();
     if (!ok) throw LogicError(__FILE__, __LINE__);
     return id;
   } else {
@@ -747,10 +1286,10 @@ int WorkspaceLibraryDb::getLibraryId(const FilePath& lib) const {
 
 QList<FilePath> WorkspaceLibraryDb::getLibraryElements(
     const FilePath& lib, const QString& tablename) const {
-  QSqlQuery query = mDb->prepareQuery("SELECT filepath FROM " % tablename %
-                                      " WHERE lib_id = :lib_id");
+  QSqlQuery query = getDb().prepareQuery("SELECT filepath FROM " % tablename %
+                                         " WHERE lib_id = :lib_id");
   query.bindValue(":lib_id", getLibraryId(lib));
-  mDb->exec(query);
+  getDb().exec(query);
 
   QList<FilePath> elements;
   while (query.next()) {
@@ -808,7 +1347,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`filepath` TEXT UNIQUE NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
-      "`parent_uuid` TEXT"
+      "`parent_uuid` TEXT, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS component_categories_tr ("
@@ -830,7 +1372,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`filepath` TEXT UNIQUE NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
-      "`parent_uuid` TEXT"
+      "`parent_uuid` TEXT, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS package_categories_tr ("
@@ -851,7 +1396,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
       "`uuid` TEXT NOT NULL, "
-      "`version` TEXT NOT NULL"
+      "`version` TEXT NOT NULL, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS symbols_tr ("
@@ -880,7 +1428,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
       "`uuid` TEXT NOT NULL, "
-      "`version` TEXT NOT NULL "
+      "`version` TEXT NOT NULL, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS packages_tr ("
@@ -909,7 +1460,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
       "`uuid` TEXT NOT NULL, "
-      "`version` TEXT NOT NULL"
+      "`version` TEXT NOT NULL, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS components_tr ("
@@ -940,7 +1494,10 @@ void WorkspaceLibraryDb::createAllTables() {
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
       "`component_uuid` TEXT NOT NULL, "
-      "`package_uuid` TEXT NOT NULL"
+      "`package_uuid` TEXT NOT NULL, "
+      "`file_modified` INTEGER, "
+      "`file_size` INTEGER, "
+      "`file_hash` BLOB"
       ")");
   queries << QString(
       "CREATE TABLE IF NOT EXISTS devices_tr ("
@@ -962,11 +1519,117 @@ void WorkspaceLibraryDb::createAllTables() {
       "UNIQUE(device_id, category_uuid)"
       ")");
 
+  // indexes
+  // Note: The indexes are chosen to cover the lookups of the getters (i.e. to
+  // contain all columns they read), so these queries never need to touch the
+  // tables themselves. The translation tables and the (element, category)
+  // lookups are already covered by their UNIQUE constraints.
+  QStringList elementTables = {"component_categories", "package_categories",
+                               "symbols",              "packages",
+                               "components",           "devices"};
+  foreach (const QString& table, elementTables) {
+    queries << QString(
+                   "CREATE INDEX IF NOT EXISTS %1_uuid_index "
+                   "ON %1 (uuid, version, filepath)")
+                   .arg(table);
+    queries << QString(
+                   "CREATE INDEX IF NOT EXISTS %1_lib_id_index "
+                   "ON %1 (lib_id, filepath)")
+                   .arg(table);
+  }
+  foreach (const QString& table,
+           QStringList{"component_categories", "package_categories"}) {
+    queries << QString(
+                   "CREATE INDEX IF NOT EXISTS %1_parent_uuid_index "
+                   "ON %1 (parent_uuid, uuid)")
+                   .arg(table);
+  }
+  QList<QPair<QString, QString>> categorizedTables = {
+      {"symbols", "symbol_id"},
+      {"packages", "package_id"},
+      {"components", "component_id"},
+      {"devices", "device_id"}};
+  foreach (const auto& table, categorizedTables) {
+    queries << QString(
+                   "CREATE INDEX IF NOT EXISTS %1_cat_category_uuid_index "
+                   "ON %1_cat (category_uuid, %2)")
+                   .arg(table.first, table.second);
+  }
+  queries << QString(
+      "CREATE INDEX IF NOT EXISTS devices_component_uuid_index "
+      "ON devices (component_uuid, uuid)");
+
   // execute queries
   foreach (const QString& string, queries) {
     QSqlQuery query = mDb->prepareQuery(string);  // can throw
     mDb->exec(query);                             // can throw
   }
+
+  // full-text search tables are optional, search falls back to LIKE
+  try {
+    createFullTextSearchTables();  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Failed to create full-text search tables:" << e.getMsg();
+  }
+}
+
+void WorkspaceLibraryDb::createFullTextSearchTables() {
+  // The FTS5 tables index the translation tables ("external content"), and
+  // triggers keep them up to date while the library scanner modifies the
+  // translations. Note that triggers are also fired on cascaded deletes, so
+  // removed elements are removed from the index as well.
+  QStringList tables = {"libraries",          "component_categories",
+                        "package_categories", "symbols",
+                        "packages",           "components",
+                        "devices"};
+  QStringList queries;
+  foreach (const QString& table, tables) {
+    queries << QString(
+                   "CREATE VIRTUAL TABLE IF NOT EXISTS %1_fts USING fts5("
+                   "name, keywords, content='%1_tr', content_rowid='id', "
+                   "prefix='2 3')")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER IF NOT EXISTS %1_tr_ai "
+                   "AFTER INSERT ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(rowid, name, keywords) "
+                   "VALUES (new.id, new.name, new.keywords); "
+                   "END")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER IF NOT EXISTS %1_tr_ad "
+                   "AFTER DELETE ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(%1_fts, rowid, name, keywords) "
+                   "VALUES ('delete', old.id, old.name, old.keywords); "
+                   "END")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER IF NOT EXISTS %1_tr_au "
+                   "AFTER UPDATE ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(%1_fts, rowid, name, keywords) "
+                   "VALUES ('delete', old.id, old.name, old.keywords); "
+                   "INSERT INTO %1_fts(rowid, name, keywords) "
+                   "VALUES (new.id, new.name, new.keywords); "
+                   "END")
+                   .arg(table);
+  }
+
+  SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDb);  // can throw
+  foreach (const QString& string, queries) {
+    QSqlQuery query = mDb->prepareQuery(string);  // can throw
+    mDb->exec(query);                             // can throw
+  }
+  transactionGuard.commit();  // can throw
+}
+
+bool WorkspaceLibraryDb::hasFullTextSearchTables() const {
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT COUNT(*) FROM sqlite_master "
+      "WHERE type = 'table' AND name = 'devices_fts'");
+  mDb->exec(query);  // can throw
+  const bool exists = query.next() && (query.value(0).toInt() > 0);
+  query.finish();
+  return exists;
 }
 
 int WorkspaceLibraryDb::getDbVersion() const noexcept {
@@ -977,6 +1640,7 @@ int WorkspaceLibraryDb::getDbVersion() const noexcept {
     if (query.next()) {
       bool ok      = false;
       int  version = query.value(0).toInt(&ok);
+      query.finish();
       if (!ok) throw LogicError(__FILE__, __LINE__);
       return version;
     } else {
@@ -995,6 +1659,94 @@ void WorkspaceLibraryDb::setDbVersion(int version) {
   mDb->insert(query);  // can throw
 }
 
+SQLiteDatabase& WorkspaceLibraryDb::getDb() const {
+  if (QThread::currentThread() == thread()) {
+    return *mDb;
+  }
+
+  closeOrphanedReadConnections();
+  ReadConnections&                connections = sReadConnections.localData();
+  std::shared_ptr<SQLiteDatabase> db          = connections.value(mInstanceId);
+  if (!db) {
+    db = std::make_shared<SQLiteDatabase>(mFilePath);  // can throw
+    db->exec("PRAGMA query_only = ON");                // can throw
+    connections.insert(mInstanceId, db);
+  }
+  return *db;
+}
+
+void WorkspaceLibraryDb::closeOrphanedReadConnections() noexcept {
+  if (!sReadConnections.hasLocalData()) {
+    return;
+  }
+  ReadConnections& connections = sReadConnections.localData();
+  QMutexLocker     lock(&sAliveInstancesMutex);
+  for (auto it = connections.begin(); it != connections.end();) {
+    if (sAliveInstances.contains(it.key())) {
+      ++it;
+    } else {
+      it = connections.erase(it);  // closes the connection in this thread
+    }
+  }
+}
+
+void WorkspaceLibraryDb::updateWatchedDirectories() noexcept {
+  // Note: The libraries directory itself is not watched since it contains the
+  // database, which would lead to endless rescans.
+  const QStringList elementTypeDirs = {
+      ComponentCategory::getShortElementName(),
+      PackageCategory::getShortElementName(),
+      Symbol::getShortElementName(),
+      Package::getShortElementName(),
+      Component::getShortElementName(),
+      Device::getShortElementName(),
+  };
+  QSet<QString> dirs;
+  dirs.insert(mWorkspace.getLocalLibrariesPath().toStr());
+  dirs.insert(mWorkspace.getRemoteLibrariesPath().toStr());
+  try {
+    foreach (const FilePath& lib, getLibraries()) {
+      QList<FilePath> elements;
+      elements += getLibraryElements<ComponentCategory>(lib);  // can throw
+      elements += getLibraryElements<PackageCategory>(lib);    // can throw
+      elements += getLibraryElements<Symbol>(lib);             // can throw
+      elements += getLibraryElements<Package>(lib);            // can throw
+      elements += getLibraryElements<Component>(lib);          // can throw
+      elements += getLibraryElements<Device>(lib);             // can throw
+      dirs.insert(lib.toStr());
+      foreach (const QString& typeDir, elementTypeDirs) {
+        dirs.insert(lib.getPathTo(typeDir).toStr());
+      }
+      foreach (const FilePath& element, elements) {
+        dirs.insert(element.toStr());
+      }
+    }
+  } catch (const Exception& e) {
+    qWarning() << "Failed to get library directories to watch:" << e.getMsg();
+  }
+
+  // only add/remove the differences to avoid re-registering all directories
+  QSet<QString> watchedDirs = mWatcher.directories().toSet();
+  QStringList   obsoleteDirs = (watchedDirs - dirs).toList();
+  QStringList   newDirs;
+  foreach (const QString& dir, dirs - watchedDirs) {
+    if (QFileInfo(dir).isDir()) {
+      newDirs.append(dir);
+    }
+  }
+  if (!obsoleteDirs.isEmpty()) {
+    mWatcher.removePaths(obsoleteDirs);
+  }
+  if (!newDirs.isEmpty()) {
+    QStringList failedDirs = mWatcher.addPaths(newDirs);
+    if (!failedDirs.isEmpty()) {
+      qWarning() << "Could not watch" << failedDirs.count()
+                 << "library directories, modifications of them will not be "
+                    "detected automatically.";
+    }
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
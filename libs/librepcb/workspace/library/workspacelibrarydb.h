@@ -29,9 +29,14 @@
 
 #include <QtCore>
 
+#include <functional>
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
+class QSqlQuery;
+
 namespace librepcb {
 
 class Version;
@@ -48,11 +53,41 @@ class WorkspaceLibraryScanner;
 
 /**
  * @brief The WorkspaceLibraryDb class
+ *
+ * All getters are thread-safe: Every thread other than the one owning this
+ * object gets its own read-only database connection, which is closed when
+ * the thread finishes. Together with the WAL journal mode of the database,
+ * readers therefore neither block each other nor wait for the library
+ * scanner which writes to the database through yet another connection.
+ *
+ * The directories of all libraries and their elements are watched for
+ * modifications (e.g. by an external editor or by pulling a library with
+ * git). A rescan is then started automatically, delayed by
+ * #sRescanDelayMs to handle bursts of modifications at once. Since the
+ * scanner is incremental, only the modified elements are parsed again.
+ *
+ * The file paths of the latest version of all elements are kept in memory
+ * (see #mLatestElements), so the frequently used `getLatest*()` getters don't
+ * need to query the database.
  */
 class WorkspaceLibraryDb final : public QObject {
   Q_OBJECT
 
 public:
+  // Types
+
+  /**
+   * @brief A device (or a component without devices) found by
+   *        #searchComponentsAndDevices()
+   */
+  struct ComponentSearchResult {
+    FilePath component;
+    FilePath device;          ///< Invalid if the component has no devices
+    FilePath package;         ///< Invalid if the package does not exist
+    bool     componentMatch;  ///< Whether the component matches the keyword
+    bool     deviceMatch;     ///< Whether the device matches the keyword
+  };
+
   // Constructors / Destructor
   WorkspaceLibraryDb()                                = delete;
   WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -93,8 +128,40 @@ public:
   FilePath getLatestDevice(const Uuid& uuid) const;
 
   // Getters: Library elements by search keyword
+
+  /**
+   * @brief Search library elements by name or keywords
+   *
+   * Every word of the keyword is matched as a prefix against the names and
+   * keywords of all translations, and the results are sorted by relevance.
+   * If the SQLite library has no FTS5 support, a (slower) substring search
+   * is performed instead, sorted by name.
+   *
+   * @param keyword   The search term
+   * @param limit     Maximum number of results (-1 for unlimited)
+   * @param offset    Number of results to skip (for paging)
+   *
+   * @return UUIDs of the matching elements
+   */
   template <typename ElementType>
-  QList<Uuid> getElementsBySearchKeyword(const QString& keyword) const;
+  QList<Uuid> getElementsBySearchKeyword(const QString& keyword,
+                                         int limit = -1, int offset = 0) const;
+
+  /**
+   * @brief Search components and devices by name or keywords
+   *
+   * Matches components and devices like #getElementsBySearchKeyword(), and
+   * additionally looks up all devices of matching components, the
+   * components of matching devices and the packages of all these devices.
+   * Everything is fetched with a single (joined) query.
+   *
+   * @param keyword   The search term
+   *
+   * @return The latest versions of the found elements, one entry per device
+   *         (or per component without devices), in no particular order
+   */
+  QList<ComponentSearchResult> searchComponentsAndDevices(
+      const QString& keyword) const;
 
   // Getters: Library elements of a specified library
   template <typename ElementType>
@@ -108,11 +175,42 @@ public:
                               QString* keywords = nullptr) const;
   template <typename ElementType>
   void getElementMetadata(const FilePath elemDir, Uuid* uuid = nullptr,
-                          Version* version = nullptr) const;
+                          Version*    version     = nullptr,
+                          QByteArray* contentHash = nullptr) const;
   void getLibraryMetadata(const FilePath libDir, QPixmap* icon = nullptr) const;
   void getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid = nullptr,
                          Uuid* cmpUuid = nullptr) const;
 
+  // Getters: Batch Lookups
+  // Note: These methods do the same as the corresponding methods above, but
+  // for many elements at once with only a few database queries.
+
+  /**
+   * @brief Get the latest versions of many library elements
+   *
+   * @param uuids   UUIDs of the elements to look up
+   *
+   * @return Filepaths of the latest versions of all found elements (elements
+   *         which don't exist in the database are not contained)
+   */
+  template <typename ElementType>
+  QHash<Uuid, FilePath> getLatestElements(const QSet<Uuid>& uuids) const;
+
+  /**
+   * @brief Get the names of many library elements
+   *
+   * @param elemDirs      Directories of the elements to look up
+   * @param localeOrder   Order of preferred locales
+   *
+   * @return Names of all found elements
+   */
+  template <typename ElementType>
+  QHash<FilePath, QString> getElementNames(
+      const QList<FilePath>& elemDirs, const QStringList& localeOrder) const;
+  void getDevicesMetadata(const QList<FilePath>& devDirs,
+                          QHash<FilePath, Uuid>* pkgUuids = nullptr,
+                          QHash<FilePath, Uuid>* cmpUuids = nullptr) const;
+
   // Getters: Special
   QSet<Uuid> getComponentCategoryChilds(const tl::optional<Uuid>& parent) const;
   QSet<Uuid> getPackageCategoryChilds(const tl::optional<Uuid>& parent) const;
@@ -128,6 +226,8 @@ public:
   QSet<Uuid> getComponentsByCategory(const tl::optional<Uuid>& category) const;
   QSet<Uuid> getDevicesByCategory(const tl::optional<Uuid>& category) const;
   QSet<Uuid> getDevicesOfComponent(const Uuid& component) const;
+  QMultiHash<Uuid, Uuid> getDevicesOfComponents(
+      const QSet<Uuid>& components) const;
 
   // General Methods
 
@@ -149,17 +249,29 @@ signals:
   void scanFinished();
 
 private:
+  // Types
+
+  /// Name, description and keywords of an element, resolved for a locale order
+  struct Translations {
+    QString name;
+    QString description;
+    QString keywords;
+  };
+
   // Private Methods
   void getElementTranslations(const QString& table, const QString& idRow,
                               const FilePath&    elemDir,
                               const QStringList& localeOrder, QString* name,
                               QString* desc, QString* keywords) const;
+  QHash<QString, Translations> loadElementTranslations(
+      const QString& table, const QString& idRow, const QString& filepath,
+      const QStringList& localeOrder) const;
+  void invalidateElementTranslations(const QStringList& filepaths) noexcept;
   void getElementMetadata(const QString& table, const FilePath elemDir,
-                          Uuid* uuid, Version* version) const;
+                          Uuid* uuid, Version* version,
+                          QByteArray* contentHash) const;
   QMultiMap<Version, FilePath> getElementFilePathsFromDb(
       const QString& tablename, const Uuid& uuid) const;
-  FilePath getLatestVersionFilePath(
-      const QMultiMap<Version, FilePath>& list) const noexcept;
   QSet<Uuid>         getCategoryChilds(const QString&            tablename,
                                        const tl::optional<Uuid>& categoryUuid) const;
   QList<Uuid>        getCategoryParents(const QString& tablename,
@@ -174,24 +286,67 @@ private:
   QSet<Uuid>         getElementsByCategory(
               const QString& tablename, const QString& idrowname,
               const tl::optional<Uuid>& categoryUuid) const;
+  FilePath              getLatestElement(const QString& tablename,
+                                         const Uuid&    uuid) const;
+  QHash<Uuid, FilePath> getLatestElements(const QString&    tablename,
+                                          const QSet<Uuid>& uuids) const;
+  const QHash<Uuid, FilePath>& getLatestElementsIndex(
+      const QString& tablename) const;
+  void clearLatestElementsIndex() noexcept;
+  QHash<FilePath, QString> getElementNames(
+      const QString& table, const QString& idRow,
+      const QList<FilePath>& elemDirs, const QStringList& localeOrder) const;
+  void            execForEachValue(
+                 const QString& queryStr, const QStringList& values,
+                 const std::function<void(const QSqlQuery&)>& rowHandler) const;
   QList<Uuid>     getElementsBySearchKeyword(const QString& tablename,
                                              const QString& idrowname,
-                                             const QString& keyword) const;
+                                             const QString& keyword, int limit,
+                                             int offset) const;
+  static QString  buildFullTextQuery(const QString& keyword) noexcept;
+  static QString  buildSearchKeywordSubquery(const QString& tablename,
+                                             const QString& idrowname,
+                                             bool           fullText) noexcept;
   int             getLibraryId(const FilePath& lib) const;
   QList<FilePath> getLibraryElements(const FilePath& lib,
                                      const QString&  tablename) const;
   void            createAllTables();
+  void            createFullTextSearchTables();
+  bool            hasFullTextSearchTables() const;
   void            setDbVersion(int version);
   int             getDbVersion() const noexcept;
+  SQLiteDatabase& getDb() const;
+  static void     closeOrphanedReadConnections() noexcept;
+  void            updateWatchedDirectories() noexcept;
 
   // Attributes
   Workspace&                     mWorkspace;
   FilePath                       mFilePath;  ///< path to the SQLite database
   QScopedPointer<SQLiteDatabase> mDb;        ///< the SQLite database
   QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+  bool mHasFullTextSearch;  ///< whether the FTS5 tables are available
+  QFileSystemWatcher mWatcher;      ///< see #updateWatchedDirectories()
+  QTimer             mRescanTimer;  ///< delays rescans after modifications
+
+  /// Identifies the read-only connections of this object in the thread local
+  /// storage of other threads (see #getDb())
+  int mInstanceId;
+
+  /// Latest version of each element by UUID, lazily loaded per table name
+  /// and discarded after every successful library scan
+  mutable QHash<QString, QHash<Uuid, FilePath>> mLatestElements;
+  mutable QMutex mLatestElementsMutex;  ///< protects #mLatestElements
+
+  /// Resolved translations by table name, locale order and element path,
+  /// see #getElementTranslations()
+  mutable QHash<QString, QHash<QString, QHash<QString, Translations>>>
+                 mTranslations;
+  mutable QMutex mTranslationsMutex;  ///< protects #mTranslations
 
   // Constants
-  static const int sCurrentDbVersion = 2;
+  static const int sCurrentDbVersion = 5;
+  static const int sMaxValuesPerQuery = 512;  ///< see #execForEachValue()
+  static const int sRescanDelayMs     = 1000;  ///< see #mRescanTimer
 };
 
 /*******************************************************************************
@@ -25,8 +25,13 @@
 #include "../workspace.h"
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/common/toolbox.h>
+#include <librepcb/common/utils/profiler.h>
+#include <librepcb/common/utils/taskscheduler.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementmetadata.h>
 
 #include <QtCore>
 
@@ -104,6 +109,7 @@ void WorkspaceLibraryScanner::run() noexcept {
 }
 
 void WorkspaceLibraryScanner::scan() noexcept {
+  Profiler::Scope scope(QStringLiteral("workspace library scan"));
   try {
     QElapsedTimer timer;
     timer.start();
@@ -113,6 +119,14 @@ void WorkspaceLibraryScanner::scan() noexcept {
 
     // open SQLite database
     SQLiteDatabase db(mDbFilePath);  // can throw
+    mPendingRows.clear();  // in case the previous scan failed
+    mModifiedElements.clear();
+
+    // Begin database transaction. The whole scan is written in a single
+    // transaction, so readers keep seeing the state of the previous scan
+    // (thanks to the WAL journal mode without being blocked) until it is
+    // committed, and an aborted or crashed scan leaves the database untouched.
+    SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
 
     // update list of libraries
     std::shared_ptr<TransactionalFileSystem> fs =
@@ -121,16 +135,23 @@ void WorkspaceLibraryScanner::scan() noexcept {
     getLibrariesOfDirectory(fs, "local", libraries);
     getLibrariesOfDirectory(fs, "remote", libraries);
     QHash<QString, int> libIds = updateLibraries(db, libraries);  // can throw
-    emit                scanLibraryListUpdated(libIds.count());
     emit                scanProgressUpdate(1);
     qDebug() << "Workspace libraries indexed:" << libIds.count()
              << "libraries in" << timer.elapsed() << "ms";
 
-    // begin database transaction
-    SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
-
-    // clear all tables
-    clearAllTables(db);
+    // get the state of all elements in the DB, to only update modified ones
+    QHash<QString, ElementState> cmpCatStates =
+        getElementStates(db, "component_categories");  // can throw
+    QHash<QString, ElementState> pkgCatStates =
+        getElementStates(db, "package_categories");  // can throw
+    QHash<QString, ElementState> symStates =
+        getElementStates(db, "symbols");  // can throw
+    QHash<QString, ElementState> pkgStates =
+        getElementStates(db, "packages");  // can throw
+    QHash<QString, ElementState> cmpStates =
+        getElementStates(db, "components");  // can throw
+    QHash<QString, ElementState> devStates =
+        getElementStates(db, "devices");  // can throw
 
     // scan all libraries
     int   count   = 0;
@@ -140,43 +161,55 @@ void WorkspaceLibraryScanner::scan() noexcept {
       int                             libId = libIds[fp];
       const std::shared_ptr<Library>& lib   = libraries[fp];
       Q_ASSERT(lib);
+      // packed libraries have their own file system
+      std::shared_ptr<TransactionalFileSystem> libFs =
+          lib->getDirectory().getFileSystem();
       if (mAbort || (mSemaphore.available() > 0)) break;
       count += addCategoriesToDb<ComponentCategory>(
-          db, fs, fp, lib->searchForElements<ComponentCategory>(),
-          "component_categories", "cat_id", libId);
+          db, libFs, fp, lib->searchForElements<ComponentCategory>(),
+          "component_categories", "cat_id", libId, cmpCatStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
       if (mAbort || (mSemaphore.available() > 0)) break;
       count += addCategoriesToDb<PackageCategory>(
-          db, fs, fp, lib->searchForElements<PackageCategory>(),
-          "package_categories", "cat_id", libId);
+          db, libFs, fp, lib->searchForElements<PackageCategory>(),
+          "package_categories", "cat_id", libId, pkgCatStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
       if (mAbort || (mSemaphore.available() > 0)) break;
-      count +=
-          addElementsToDb<Symbol>(db, fs, fp, lib->searchForElements<Symbol>(),
-                                  "symbols", "symbol_id", libId);
+      count += addElementsToDb<Symbol>(
+          db, libFs, fp, lib->searchForElements<Symbol>(), "symbols",
+          "symbol_id", libId, symStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
       if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addElementsToDb<Package>(db, fs, fp,
-                                        lib->searchForElements<Package>(),
-                                        "packages", "package_id", libId);
+      count += addElementsToDb<Package>(
+          db, libFs, fp, lib->searchForElements<Package>(), "packages",
+          "package_id", libId, pkgStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
       if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addElementsToDb<Component>(db, fs, fp,
-                                          lib->searchForElements<Component>(),
-                                          "components", "component_id", libId);
+      count += addElementsToDb<Component>(
+          db, libFs, fp, lib->searchForElements<Component>(), "components",
+          "component_id", libId, cmpStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
       if (mAbort || (mSemaphore.available() > 0)) break;
-      count +=
-          addElementsToDb<Device>(db, fs, fp, lib->searchForElements<Device>(),
-                                  "devices", "device_id", libId);
+      count += addElementsToDb<Device>(
+          db, libFs, fp, lib->searchForElements<Device>(), "devices",
+          "device_id", libId, devStates);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
     }
 
     // commit transaction
     if ((!mAbort) && (mSemaphore.available() == 0)) {
+      // remove elements which no longer exist (i.e. were not visited above)
+      removeElementsFromDb(db, "component_categories", cmpCatStates);
+      removeElementsFromDb(db, "package_categories", pkgCatStates);
+      removeElementsFromDb(db, "symbols", symStates);
+      removeElementsFromDb(db, "packages", pkgStates);
+      removeElementsFromDb(db, "components", cmpStates);
+      removeElementsFromDb(db, "devices", devStates);
       transactionGuard.commit();  // can throw
+      emit scanLibraryListUpdated(libIds.count());
       qDebug() << "Workspace library scan succeeded:" << count << "elements in"
                << timer.elapsed() << "ms";
+      emit elementsModified(mModifiedElements);
       emit scanSucceeded(count);
     } else {
       qDebug() << "Workspace library scan aborted after" << timer.elapsed()
@@ -210,12 +243,35 @@ void WorkspaceLibraryScanner::getLibrariesOfDirectory(
                  << fs->getAbsPath(dirpath).toNative();
     }
   }
+  foreach (const QString& name, fs->getFiles(root)) {
+    if (!name.endsWith("." % Library::getPackedLibrarySuffix())) {
+      continue;
+    }
+    QString filepath = root % "/" % name;
+    try {
+      // Load the archive into a separate file system with the same root, so
+      // the paths of its elements look like those of a library directory.
+      std::shared_ptr<TransactionalFileSystem> packedFs =
+          TransactionalFileSystem::openRO(fs->getAbsPath());      // can throw
+      packedFs->loadFromZip(fs->getAbsPath(filepath), filepath);  // can throw
+      std::unique_ptr<TransactionalDirectory> dir(
+          new TransactionalDirectory(packedFs, filepath));
+      if (Library::isValidElementDirectory<Library>(*dir, "")) {
+        libs.insert(filepath, std::make_shared<Library>(std::move(dir)));
+      } else {
+        qWarning() << "File is not a valid packed library:"
+                   << fs->getAbsPath(filepath).toNative();
+      }
+    } catch (Exception& e) {
+      qCritical() << "Could not open packed workspace library!";
+      qCritical() << "Library:" << fs->getAbsPath(filepath).toNative();
+      qCritical() << "Error:" << e.getMsg();
+    }
+  }
 }
 
 QHash<QString, int> WorkspaceLibraryScanner::updateLibraries(
     SQLiteDatabase& db, const QHash<QString, std::shared_ptr<Library>>& libs) {
-  SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
-
   // get IDs of libraries in DB
   QHash<QString, int> dbLibIds;
   QSqlQuery query = db.prepareQuery("SELECT id, filepath FROM libraries");
@@ -295,121 +351,256 @@ QHash<QString, int> WorkspaceLibraryScanner::updateLibraries(
     }
   }
 
-  transactionGuard.commit();  // can throw
   return dbLibIds;
 }
 
-void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db) {
-  // component categories
-  db.clearTable("component_categories_tr");
-  db.clearTable("component_categories");
-
-  // package categories
-  db.clearTable("package_categories_tr");
-  db.clearTable("package_categories");
-
-  // symbols
-  db.clearTable("symbols_tr");
-  db.clearTable("symbols_cat");
-  db.clearTable("symbols");
-
-  // packages
-  db.clearTable("packages_tr");
-  db.clearTable("packages_cat");
-  db.clearTable("packages");
-
-  // components
-  db.clearTable("components_tr");
-  db.clearTable("components_cat");
-  db.clearTable("components");
-
-  // devices
-  db.clearTable("devices_tr");
-  db.clearTable("devices_cat");
-  db.clearTable("devices");
+QHash<QString, WorkspaceLibraryScanner::ElementState>
+    WorkspaceLibraryScanner::getElementStates(SQLiteDatabase& db,
+                                              const QString&  table) {
+  QHash<QString, ElementState> states;
+  QSqlQuery                    query = db.prepareQuery(
+      "SELECT id, lib_id, filepath, file_modified, file_size, file_hash FROM " %
+      table);
+  db.exec(query);
+  while (query.next()) {
+    ElementState state;
+    state.id       = query.value(0).toInt();
+    state.libId    = query.value(1).toInt();
+    state.modified = query.value(3).toLongLong();
+    state.size     = query.value(4).toLongLong();
+    state.hash     = query.value(5).toByteArray();
+    states.insert(query.value(2).toString(), state);
+  }
+  return states;
+}
+
+WorkspaceLibraryScanner::ElementState WorkspaceLibraryScanner::getElementState(
+    std::shared_ptr<TransactionalFileSystem> fs, const QString& path,
+    int libId) noexcept {
+  ElementState state;
+  state.id       = -1;
+  state.libId    = libId;
+  state.modified = 0;
+  state.size     = 0;
+  FilePath packedFp = Library::getPackedLibraryFilePath(fs->getAbsPath(path));
+  if (packedFp.isValid()) {
+    // The files of packed libraries are not on the disk, so use the state of
+    // the archive instead. If it is replaced, the hash of every element is
+    // checked, but only really modified elements are parsed again.
+    QFileInfo info(packedFp.toStr());
+    state.modified = info.lastModified().toMSecsSinceEpoch();
+    state.size     = info.size();
+    return state;
+  }
+  foreach (const QString& filename, Toolbox::sorted(fs->getFiles(path))) {
+    QFileInfo info(fs->getAbsPath(path % "/" % filename).toStr());
+    state.modified =
+        qMax(state.modified, info.lastModified().toMSecsSinceEpoch());
+    state.size += info.size();
+  }
+  return state;
+}
+
+QByteArray WorkspaceLibraryScanner::calcElementHash(
+    std::shared_ptr<TransactionalFileSystem> fs, const QString& path) {
+  TransactionalDirectory dir(fs, path);
+  return LibraryBaseElement::calcContentHash(dir);  // can throw
+}
+
+bool WorkspaceLibraryScanner::updateElementState(
+    SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
+    const QString& table, const QString& path, ElementState& state,
+    QHash<QString, ElementState>& dbStates) {
+  if (!dbStates.contains(path)) {
+    state.hash = calcElementHash(fs, path);  // can throw
+    mModifiedElements.append(path);
+    return false;  // new element
+  }
+
+  // remove the element from the list to mark it as still existing
+  ElementState dbState = dbStates.take(path);
+  if ((dbState.libId == state.libId) && (dbState.modified == state.modified) &&
+      (dbState.size == state.size)) {
+    return true;  // unmodified
+  }
+
+  // Files are touched, check whether their content has changed too. If not,
+  // just update the file state in the DB to avoid hashing them again.
+  state.hash = calcElementHash(fs, path);  // can throw
+  if ((dbState.libId == state.libId) && (dbState.hash == state.hash)) {
+    state.id = dbState.id;
+    setElementStateInDb(db, table, state);  // can throw
+    return true;
+  }
+
+  // element is modified, remove it (and its translations and categories)
+  QSqlQuery query = db.prepareQuery("DELETE FROM " % table % " WHERE id = :id");
+  query.bindValue(":id", dbState.id);
+  db.exec(query);  // can throw
+  mModifiedElements.append(path);
+  return false;
+}
+
+void WorkspaceLibraryScanner::setElementStateInDb(SQLiteDatabase&     db,
+                                                  const QString&      table,
+                                                  const ElementState& state) {
+  QSqlQuery query = db.prepareQuery(
+      "UPDATE " % table %
+      " SET file_modified = :modified, file_size = :size, file_hash = :hash "
+      "WHERE id = :id");
+  query.bindValue(":modified", state.modified);
+  query.bindValue(":size", state.size);
+  query.bindValue(":hash", state.hash);
+  query.bindValue(":id", state.id);
+  db.exec(query);  // can throw
+}
+
+void WorkspaceLibraryScanner::removeElementsFromDb(
+    SQLiteDatabase& db, const QString& table,
+    const QHash<QString, ElementState>& states) {
+  for (auto it = states.constBegin(); it != states.constEnd(); ++it) {
+    QSqlQuery query =
+        db.prepareQuery("DELETE FROM " % table % " WHERE id = :id");
+    query.bindValue(":id", it.value().id);
+    db.exec(query);  // can throw
+    mModifiedElements.append(it.key());
+  }
 }
 
 template <typename ElementType>
 int WorkspaceLibraryScanner::addCategoriesToDb(
     SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
     const QString& libPath, const QStringList& dirs, const QString& table,
-    const QString& idColumn, int libId) {
-  int count = 0;
-  foreach (const QString& dirpath, dirs) {
-    if (mAbort || (mSemaphore.available() > 0)) break;
-    QString fullPath = libPath % "/" % dirpath;
-    try {
-      std::unique_ptr<TransactionalDirectory> dir(
-          new TransactionalDirectory(fs, fullPath));  // can throw
-      ElementType element(std::move(dir));            // can throw
-      QSqlQuery   query = db.prepareQuery(
-          "INSERT INTO " % table %
-          " "
-          "(lib_id, filepath, uuid, version, parent_uuid) VALUES "
-          "(:lib_id, :filepath, :uuid, :version, :parent_uuid)");
-      query.bindValue(":lib_id", libId);
-      query.bindValue(":filepath", fullPath);
-      query.bindValue(":uuid", element.getUuid().toStr());
-      query.bindValue(":version", element.getVersion().toStr());
-      query.bindValue(":parent_uuid", element.getParentUuid()
-                                          ? element.getParentUuid()->toStr()
-                                          : QVariant(QVariant::String));
-      int id = db.insert(query);
-      foreach (const QString& locale, element.getAllAvailableLocales()) {
-        QSqlQuery query = db.prepareQuery(
-            "INSERT INTO " % table %
-            "_tr "
-            "(" %
-            idColumn %
-            ", locale, name, description, keywords) VALUES "
-            "(:element_id, :locale, :name, :description, :keywords)");
-        query.bindValue(":element_id", id);
-        query.bindValue(":locale", locale);
-        query.bindValue(":name",
-                        optionalToVariant(element.getNames().tryGet(locale)));
-        query.bindValue(
-            ":description",
-            optionalToVariant(element.getDescriptions().tryGet(locale)));
-        query.bindValue(":keywords", optionalToVariant(
-                                         element.getKeywords().tryGet(locale)));
-        db.insert(query);
-      }
-      count++;
-    } catch (const Exception& e) {
-      qWarning() << "Failed to open library element:" << fullPath;
-    }
-  }
-  return count;
+    const QString& idColumn, int libId,
+    QHash<QString, ElementState>& dbStates) {
+  return addToDb<ElementType>(
+      db, fs, libPath, dirs, table, libId, dbStates,
+      [&](const QString& path, const LibraryElementMetadata& element) {
+        return addCategoryToDb(db, table, idColumn, libId, path,
+                               element);  // can throw
+      });
 }
 
 template <typename ElementType>
 int WorkspaceLibraryScanner::addElementsToDb(
     SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
     const QString& libPath, const QStringList& dirs, const QString& table,
-    const QString& idColumn, int libId) {
+    const QString& idColumn, int libId,
+    QHash<QString, ElementState>& dbStates) {
+  return addToDb<ElementType>(
+      db, fs, libPath, dirs, table, libId, dbStates,
+      [&](const QString& path, const LibraryElementMetadata& element) {
+        return addElementToDb<ElementType>(db, table, idColumn, libId, path,
+                                           element);  // can throw
+      });
+}
+
+template <typename ElementType>
+int WorkspaceLibraryScanner::addToDb(
+    SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
+    const QString& libPath, const QStringList& dirs, const QString& table,
+    int libId, QHash<QString, ElementState>& dbStates,
+    const std::function<int(const QString&, const LibraryElementMetadata&)>&
+        addFunc) {
+  // Reading the metadata is done by a pool of worker threads while this
+  // thread writes them in their original order to the database. The number of
+  // elements in flight is limited to keep the memory usage low.
+  struct Job {
+    QString                                                path;
+    ElementState                                           state;
+    QFuture<std::shared_ptr<const LibraryElementMetadata>> future;
+  };
+  QQueue<Job> jobs;
+  auto        waitForJobs = scopeGuard([&]() {
+    foreach (Job job, jobs) { job.future.waitForFinished(); }
+  });
+  const int maxJobs = qMax(QThread::idealThreadCount(), 1) * 8;
+
   int count = 0;
-  foreach (const QString& dirpath, dirs) {
+  int index = 0;
+  while ((index < dirs.count()) || (!jobs.isEmpty())) {
     if (mAbort || (mSemaphore.available() > 0)) break;
-    QString fullPath = libPath % "/" % dirpath;
-    try {
-      std::unique_ptr<TransactionalDirectory> dir(
-          new TransactionalDirectory(fs, fullPath));  // can throw
-      ElementType element(std::move(dir));            // can throw
-      addElementToDb(db, table, idColumn, libId, fullPath, element);
-      count++;
-    } catch (const Exception& e) {
-      qWarning() << "Failed to open library element:" << fullPath;
+
+    // start parsing modified elements
+    while ((index < dirs.count()) && (jobs.count() < maxJobs)) {
+      QString fullPath = libPath % "/" % dirs.at(index++);
+      try {
+        ElementState state = getElementState(fs, fullPath, libId);
+        if (updateElementState(db, fs, table, fullPath, state,
+                               dbStates)) {  // can throw
+          count++;
+          continue;  // element is up to date
+        }
+        auto parse = [fs, fullPath]() {
+          return readMetadata<ElementType>(fs, fullPath);
+        };
+        jobs.enqueue(Job{fullPath, state,
+                         TaskScheduler::run(TaskScheduler::Priority::Background,
+                                            parse)});
+      } catch (const Exception& e) {
+        qWarning() << "Failed to open library element:" << fullPath;
+      }
+    }
+
+    // write the next parsed element to the database
+    if (!jobs.isEmpty()) {
+      Job job = jobs.dequeue();
+      try {
+        if (std::shared_ptr<const LibraryElementMetadata> element =
+                job.future.result()) {
+          job.state.id = addFunc(job.path, *element);  // can throw
+          setElementStateInDb(db, table, job.state);   // can throw
+          count++;
+        }
+      } catch (const Exception& e) {
+        qWarning() << "Failed to add library element to database:" << job.path;
+      }
     }
   }
+  flushRowsToDb(db);  // can throw
   return count;
 }
 
 template <typename ElementType>
-void WorkspaceLibraryScanner::addElementToDb(SQLiteDatabase& db,
-                                             const QString&  table,
-                                             const QString& idColumn, int libId,
-                                             const QString&     path,
-                                             const ElementType& element) {
+std::shared_ptr<const LibraryElementMetadata>
+    WorkspaceLibraryScanner::readMetadata(
+        std::shared_ptr<TransactionalFileSystem> fs,
+        const QString&                           path) noexcept {
+  try {
+    // Only the metadata is needed, so don't load the whole element.
+    TransactionalDirectory dir(fs, path);  // can throw
+    return std::make_shared<const LibraryElementMetadata>(
+        LibraryElementMetadata::read<ElementType>(dir));  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Failed to open library element:" << path;
+    return nullptr;
+  }
+}
+
+int WorkspaceLibraryScanner::addCategoryToDb(
+    SQLiteDatabase& db, const QString& table, const QString& idColumn,
+    int libId, const QString& path, const LibraryElementMetadata& element) {
+  QSqlQuery query = db.prepareQuery(
+      "INSERT INTO " % table %
+      " "
+      "(lib_id, filepath, uuid, version, parent_uuid) VALUES "
+      "(:lib_id, :filepath, :uuid, :version, :parent_uuid)");
+  query.bindValue(":lib_id", libId);
+  query.bindValue(":filepath", path);
+  query.bindValue(":uuid", element.getUuid().toStr());
+  query.bindValue(":version", element.getVersion().toStr());
+  query.bindValue(":parent_uuid", element.getParentUuid()
+                                      ? element.getParentUuid()->toStr()
+                                      : QVariant(QVariant::String));
+  int id = db.insert(query);
+  addElementTranslationsToDb(db, table % "_tr", idColumn, id, element);
+  return id;
+}
+
+template <typename ElementType>
+int WorkspaceLibraryScanner::addElementToDb(
+    SQLiteDatabase& db, const QString& table, const QString& idColumn,
+    int libId, const QString& path, const LibraryElementMetadata& element) {
   QSqlQuery query = db.prepareQuery("INSERT INTO " % table %
                                     " (lib_id, filepath, uuid, version) VALUES "
                                     "(:lib_id, :filepath, :uuid, :version)");
@@ -421,12 +612,17 @@ void WorkspaceLibraryScanner::addElementToDb(SQLiteDatabase& db,
   addElementTranslationsToDb(db, table % "_tr", idColumn, id, element);
   addElementCategoriesToDb(db, table % "_cat", idColumn, id,
                            element.getCategories());
+  return id;
 }
 
 template <>
-void WorkspaceLibraryScanner::addElementToDb<Device>(
+int WorkspaceLibraryScanner::addElementToDb<Device>(
     SQLiteDatabase& db, const QString& table, const QString& idColumn,
-    int libId, const QString& path, const Device& element) {
+    int libId, const QString& path, const LibraryElementMetadata& element) {
+  if ((!element.getComponentUuid()) || (!element.getPackageUuid())) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       "Device does not reference a component and package.");
+  }
   QSqlQuery query = db.prepareQuery("INSERT INTO " % table %
                                     " "
                                     "(lib_id, filepath, uuid, version, "
@@ -437,46 +633,55 @@ void WorkspaceLibraryScanner::addElementToDb<Device>(
   query.bindValue(":filepath", path);
   query.bindValue(":uuid", element.getUuid().toStr());
   query.bindValue(":version", element.getVersion().toStr());
-  query.bindValue(":component_uuid", element.getComponentUuid().toStr());
-  query.bindValue(":package_uuid", element.getPackageUuid().toStr());
+  query.bindValue(":component_uuid", element.getComponentUuid()->toStr());
+  query.bindValue(":package_uuid", element.getPackageUuid()->toStr());
   int id = db.insert(query);
   addElementTranslationsToDb(db, table % "_tr", idColumn, id, element);
   addElementCategoriesToDb(db, table % "_cat", idColumn, id,
                            element.getCategories());
+  return id;
 }
 
-template <typename ElementType>
 void WorkspaceLibraryScanner::addElementTranslationsToDb(
     SQLiteDatabase& db, const QString& table, const QString& idColumn, int id,
-    const ElementType& element) {
+    const LibraryElementMetadata& element) {
+  QStringList columns = {idColumn, "locale", "name", "description", "keywords"};
   foreach (const QString& locale, element.getAllAvailableLocales()) {
-    QSqlQuery query = db.prepareQuery(
-        "INSERT INTO " % table % " (" % idColumn %
-        ", locale, name, description, keywords) VALUES "
-        "(:element_id, :locale, :name, :description, :keywords)");
-    query.bindValue(":element_id", id);
-    query.bindValue(":locale", locale);
-    query.bindValue(":name",
-                    optionalToVariant(element.getNames().tryGet(locale)));
-    query.bindValue(
-        ":description",
-        optionalToVariant(element.getDescriptions().tryGet(locale)));
-    query.bindValue(":keywords",
-                    optionalToVariant(element.getKeywords().tryGet(locale)));
-    db.insert(query);
+    addRowToDb(db, table, columns,
+               {id, locale,
+                optionalToVariant(element.getNames().tryGet(locale)),
+                optionalToVariant(element.getDescriptions().tryGet(locale)),
+                optionalToVariant(
+                    element.getKeywords().tryGet(locale))});  // can throw
   }
 }
 
 void WorkspaceLibraryScanner::addElementCategoriesToDb(
     SQLiteDatabase& db, const QString& table, const QString& idColumn, int id,
     const QSet<Uuid>& categories) {
+  QStringList columns = {idColumn, "category_uuid"};
   foreach (const Uuid& categoryUuid, categories) {
-    QSqlQuery query = db.prepareQuery("INSERT INTO " % table % " (" % idColumn %
-                                      ", category_uuid) VALUES "
-                                      "(:element_id, :category_uuid)");
-    query.bindValue(":element_id", id);
-    query.bindValue(":category_uuid", categoryUuid.toStr());
-    db.insert(query);
+    addRowToDb(db, table, columns, {id, categoryUuid.toStr()});  // can throw
+  }
+}
+
+void WorkspaceLibraryScanner::addRowToDb(SQLiteDatabase&     db,
+                                         const QString&      table,
+                                         const QStringList&  columns,
+                                         const QVariantList& values) {
+  PendingRows& pending = mPendingRows[table];
+  pending.columns      = columns;
+  pending.rows.append(values);
+  if (pending.rows.count() >= sRowBatchSize) {
+    db.insertRows(table, pending.columns, pending.rows);  // can throw
+    pending.rows.clear();
+  }
+}
+
+void WorkspaceLibraryScanner::flushRowsToDb(SQLiteDatabase& db) {
+  foreach (const QString& table, mPendingRows.keys()) {
+    PendingRows pending = mPendingRows.take(table);
+    db.insertRows(table, pending.columns, pending.rows);  // can throw
   }
 }
 
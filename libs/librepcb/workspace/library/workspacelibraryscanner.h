@@ -27,6 +27,7 @@
 
 #include <QtCore>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -41,6 +42,7 @@ class TransactionalFileSystem;
 
 namespace library {
 class Library;
+class LibraryElementMetadata;
 }
 
 namespace workspace {
@@ -54,6 +56,17 @@ class Workspace;
 /**
  * @brief The WorkspaceLibraryScanner class
  *
+ * Scans all workspace libraries and updates the library database. The scan
+ * is incremental: For every element, the modification time and size of its
+ * files are stored in the database, and only elements with modified files
+ * are parsed again (or even only their hash is updated if the files were
+ * just touched without changing their content). Modified elements are parsed
+ * in parallel on the global thread pool, while this thread writes them to
+ * the database.
+ *
+ * All modifications of a scan are written in a single transaction, so
+ * readers of the database only see the result of completed scans.
+ *
  * @warning Be very careful with dependencies to other objects as the #run()
  * method is executed in a separate thread! Keep the number of dependencies as
  * small as possible and consider thread synchronization and object lifetimes.
@@ -78,17 +91,54 @@ signals:
   void scanStarted();
   void scanLibraryListUpdated(int libraryCount);
   void scanProgressUpdate(int percent);
+  /**
+   * @brief Emitted after a successful scan, before #scanSucceeded()
+   *
+   * @param paths   Paths (relative to the libraries directory) of all
+   *                elements which were added, modified or removed
+   */
+  void elementsModified(QStringList paths);
   void scanSucceeded(int elementCount);
   void scanFailed(QString errorMsg);
   void scanFinished();
 
+private:  // Types
+  /// Database ID and file state of a library element, to detect modifications
+  struct ElementState {
+    int        id;        ///< Database ID (-1 if not added to the DB yet)
+    int        libId;     ///< Database ID of the library
+    qint64     modified;  ///< Latest modification time of its files [ms]
+    qint64     size;      ///< Total size of its files [bytes]
+    QByteArray hash;      ///< SHA-256 of its files (empty if not known)
+  };
+
+  /// Rows of a table which are not inserted into the database yet
+  struct PendingRows {
+    QStringList         columns;
+    QList<QVariantList> rows;
+  };
+
 private:  // Methods
   void                run() noexcept override;
   void                scan() noexcept;
   QHash<QString, int> updateLibraries(
       SQLiteDatabase&                                          db,
       const QHash<QString, std::shared_ptr<library::Library>>& libs);
-  void clearAllTables(SQLiteDatabase& db);
+  QHash<QString, ElementState> getElementStates(SQLiteDatabase& db,
+                                                const QString&  table);
+  ElementState getElementState(std::shared_ptr<TransactionalFileSystem> fs,
+                               const QString& path, int libId) noexcept;
+  QByteArray   calcElementHash(std::shared_ptr<TransactionalFileSystem> fs,
+                               const QString& path);
+  bool updateElementState(SQLiteDatabase&                          db,
+                          std::shared_ptr<TransactionalFileSystem> fs,
+                          const QString& table, const QString& path,
+                          ElementState&                 state,
+                          QHash<QString, ElementState>& dbStates);
+  void setElementStateInDb(SQLiteDatabase& db, const QString& table,
+                           const ElementState& state);
+  void removeElementsFromDb(SQLiteDatabase& db, const QString& table,
+                            const QHash<QString, ElementState>& states);
   void getLibrariesOfDirectory(
       std::shared_ptr<TransactionalFileSystem> fs, const QString& root,
       QHash<QString, std::shared_ptr<library::Library>>& libs) noexcept;
@@ -97,23 +147,41 @@ private:  // Methods
                         std::shared_ptr<TransactionalFileSystem> fs,
                         const QString& libPath, const QStringList& dirs,
                         const QString& table, const QString& idColumn,
-                        int libId);
+                        int libId, QHash<QString, ElementState>& dbStates);
   template <typename ElementType>
   int addElementsToDb(SQLiteDatabase&                          db,
                       std::shared_ptr<TransactionalFileSystem> fs,
                       const QString& libPath, const QStringList& dirs,
-                      const QString& table, const QString& idColumn, int libId);
+                      const QString& table, const QString& idColumn, int libId,
+                      QHash<QString, ElementState>& dbStates);
+  template <typename ElementType>
+  int addToDb(
+      SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
+      const QString& libPath, const QStringList& dirs, const QString& table,
+      int libId, QHash<QString, ElementState>& dbStates,
+      const std::function<int(const QString&,
+                              const library::LibraryElementMetadata&)>&
+          addFunc);
   template <typename ElementType>
-  void addElementToDb(SQLiteDatabase& db, const QString& table,
+  static std::shared_ptr<const library::LibraryElementMetadata> readMetadata(
+      std::shared_ptr<TransactionalFileSystem> fs,
+      const QString&                           path) noexcept;
+  int addCategoryToDb(SQLiteDatabase& db, const QString& table,
                       const QString& idColumn, int libId, const QString& path,
-                      const ElementType& element);
+                      const library::LibraryElementMetadata& element);
   template <typename ElementType>
-  void addElementTranslationsToDb(SQLiteDatabase& db, const QString& table,
-                                  const QString& idColumn, int id,
-                                  const ElementType& element);
+  int addElementToDb(SQLiteDatabase& db, const QString& table,
+                     const QString& idColumn, int libId, const QString& path,
+                     const library::LibraryElementMetadata& element);
+  void addElementTranslationsToDb(
+      SQLiteDatabase& db, const QString& table, const QString& idColumn,
+      int id, const library::LibraryElementMetadata& element);
   void addElementCategoriesToDb(SQLiteDatabase& db, const QString& table,
                                 const QString& idColumn, int id,
                                 const QSet<Uuid>& categories);
+  void addRowToDb(SQLiteDatabase& db, const QString& table,
+                  const QStringList& columns, const QVariantList& values);
+  void flushRowsToDb(SQLiteDatabase& db);
   template <typename T>
   static QVariant optionalToVariant(const T& opt) noexcept;
 
@@ -122,6 +190,15 @@ private:  // Data
   FilePath      mDbFilePath;
   QSemaphore    mSemaphore;
   volatile bool mAbort;
+
+  /// Translations and categories of elements, inserted in batches
+  QHash<QString, PendingRows> mPendingRows;
+
+  /// Elements added, modified or removed by the current scan
+  QStringList mModifiedElements;
+
+  // Constants
+  static const int sRowBatchSize = 500;  ///< Max. number of pending rows
 };
 
 /*******************************************************************************
@@ -47,9 +47,8 @@ RecentProjectsModel::RecentProjectsModel(const Workspace& workspace) noexcept
     if (mFilePath.isExistingFile()) {
       SExpression root =
           SExpression::parse(FileUtils::readFile(mFilePath), mFilePath);
-      const QList<SExpression>& childs = root.getChildren("project");
-      foreach (const SExpression& child, childs) {
-        QString  path    = child.getValueOfFirstChild<QString>(true);
+      foreach (const SExpression* child, root.getChildren("project")) {
+        QString  path    = child->getValueOfFirstChild<QString>(true);
         FilePath absPath = FilePath::fromRelative(mWorkspace.getPath(), path);
         mAllProjects.append(absPath);
       }
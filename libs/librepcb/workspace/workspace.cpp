@@ -33,8 +33,10 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexpressioncache.h>
 #include <librepcb/common/fileio/versionfile.h>
 #include <librepcb/library/library.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/libraryeditor/libraryeditor.h>
 #include <librepcb/project/project.h>
 
@@ -116,6 +118,10 @@ Workspace::Workspace(const FilePath& wsPath)
   // load workspace settings
   mWorkspaceSettings.reset(new WorkspaceSettings(*this));
 
+  // cache parsed library elements to speed up loading them
+  LibraryBaseElement::setParseCache(std::make_shared<SExpressionCache>(
+      mMetadataPath.getPathTo("cache/elements")));
+
   // load library database
   mLibraryDb.reset(new WorkspaceLibraryDb(*this));  // can throw
 
@@ -126,6 +132,7 @@ Workspace::Workspace(const FilePath& wsPath)
 }
 
 Workspace::~Workspace() noexcept {
+  LibraryBaseElement::setParseCache(nullptr);
 }
 
 /*******************************************************************************
@@ -144,6 +151,17 @@ FavoriteProjectsModel& Workspace::getFavoriteProjectsModel() const noexcept {
   return *mFavoriteProjectsModel;
 }
 
+std::shared_ptr<LibraryElementCache> Workspace::getLibraryElementCache() const
+    noexcept {
+  std::shared_ptr<LibraryElementCache> cache = mLibraryElementCache.lock();
+  if (!cache) {
+    cache = std::make_shared<LibraryElementCache>(*mLibraryDb,
+                                                  sLibraryElementCacheSize);
+    mLibraryElementCache = cache;
+  }
+  return cache;
+}
+
 /*******************************************************************************
  *  Project Management
  ******************************************************************************/
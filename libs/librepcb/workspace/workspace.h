@@ -28,6 +28,8 @@
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -35,6 +37,7 @@ namespace librepcb {
 
 namespace library {
 class Library;
+class LibraryElementCache;
 }
 
 namespace project {
@@ -134,6 +137,20 @@ public:
    */
   WorkspaceLibraryDb& getLibraryDb() const { return *mLibraryDb; }
 
+  /**
+   * @brief Get the library element cache shared by all editors
+   *
+   * All open project editors, library editors and their dialogs use the same
+   * cache, so workspace library elements are loaded only once even if
+   * several of them are open. The cache is reference counted: It is created
+   * on the first call and destroyed as soon as nobody holds a reference to
+   * it anymore.
+   *
+   * @return The shared cache
+   */
+  std::shared_ptr<library::LibraryElementCache> getLibraryElementCache() const
+      noexcept;
+
   // Project Management
 
   /**
@@ -261,6 +278,9 @@ private:  // Data
   /// the library database
   QScopedPointer<WorkspaceLibraryDb> mLibraryDb;
 
+  /// see #getLibraryElementCache()
+  mutable std::weak_ptr<library::LibraryElementCache> mLibraryElementCache;
+
   /// a tree model for the whole projects directory
   QScopedPointer<ProjectTreeModel> mProjectTreeModel;
 
@@ -269,6 +289,9 @@ private:  // Data
 
   /// a list model of all favorite projects
   QScopedPointer<FavoriteProjectsModel> mFavoriteProjectsModel;
+
+  /// maximum number of elements in the #mLibraryElementCache
+  static const int sLibraryElementCacheSize = 1000;
 };
 
 /*******************************************************************************
@@ -9,8 +9,7 @@ SUBDIRS = \
     librepcb \
     optional \
     parseagle \
-    quazip \
-    sexpresso
+    quazip
 
 librepcb.depends = \
     clipper \
@@ -20,5 +19,4 @@ librepcb.depends = \
     parseagle \
     hoedown \
     quazip \
-    sexpresso \
 
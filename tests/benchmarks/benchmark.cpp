@@ -0,0 +1,101 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+Benchmark::Benchmark(const QString& name, int size,
+                     qint64 minNanoseconds) noexcept
+  : mName(name),
+    mSize(size),
+    mMinNanoseconds(minNanoseconds),
+    mResult{name, size, 0, 0},
+    mSink(nullptr) {
+}
+
+Benchmark::~Benchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void Benchmark::measure(const std::function<void()>& func) {
+  func();  // warm up, e.g. to fill caches and allocate memory pools
+
+  // Double the number of iterations per round to keep the overhead of the
+  // time measurement low for very fast operations.
+  QElapsedTimer timer;
+  timer.start();
+  qint64 iterations = 0;
+  qint64 round      = 1;
+  while (timer.nsecsElapsed() < mMinNanoseconds) {
+    for (qint64 i = 0; i < round; ++i) {
+      func();
+    }
+    iterations += round;
+    round *= 2;
+  }
+  mResult = Result{mName, mSize, iterations, timer.nsecsElapsed()};
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+int Benchmark::registerBenchmark(const QString& name, Function func) noexcept {
+  getRegistry().append(qMakePair(name, func));
+  return getRegistry().count();
+}
+
+const Benchmark::Registry& Benchmark::getRegisteredBenchmarks() noexcept {
+  return getRegistry();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+Benchmark::Registry& Benchmark::getRegistry() noexcept {
+  // Note: Function-local to be constructed before the first registration,
+  // which happens during static initialization.
+  static Registry registry;
+  return registry;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
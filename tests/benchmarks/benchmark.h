@@ -0,0 +1,152 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARK_H
+#define LIBREPCB_BENCHMARKS_BENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+/**
+ * @brief A minimal harness to measure the duration of an operation
+ *
+ * Benchmarks are defined with #LIBREPCB_BENCHMARK and receive a Benchmark
+ * object. They prepare their input data with the size returned by #getSize()
+ * and then pass the operation to measure to #measure(), which executes it
+ * repeatedly until the minimum measurement time is reached:
+ *
+ * @code
+ * LIBREPCB_BENCHMARK(UuidFromString) {
+ *   QVector<QString> input = ...;  // getSize() elements
+ *   b.measure([&]() {
+ *     foreach (const QString& str, input) {
+ *       b.keep(Uuid::fromString(str));
+ *     }
+ *   });
+ * }
+ * @endcode
+ */
+class Benchmark final {
+public:
+  // Types
+  typedef std::function<void(Benchmark&)> Function;
+  typedef QList<QPair<QString, Function>> Registry;
+
+  struct Result {
+    QString name;
+    int     size;
+    qint64  iterations;
+    qint64  nanoseconds;  ///< Total duration of all iterations
+  };
+
+  // Constructors / Destructor
+  Benchmark()                       = delete;
+  Benchmark(const Benchmark& other) = delete;
+  Benchmark(const QString& name, int size, qint64 minNanoseconds) noexcept;
+  ~Benchmark() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Get the number of elements the input data should consist of
+   */
+  int getSize() const noexcept { return mSize; }
+
+  /**
+   * @brief Get the result of the last call to #measure()
+   */
+  const Result& getResult() const noexcept { return mResult; }
+
+  // General Methods
+
+  /**
+   * @brief Execute an operation repeatedly and measure its average duration
+   *
+   * @param func  The operation to measure. Exceptions are not caught, so the
+   *              benchmark fails if it throws.
+   */
+  void measure(const std::function<void()>& func);
+
+  /**
+   * @brief Prevent the compiler from optimizing away a calculated value
+   *
+   * @param value   The value to keep
+   */
+  template <typename T>
+  void keep(const T& value) noexcept {
+    mSink = static_cast<const void*>(&value);
+  }
+
+  // Static Methods
+  static int             registerBenchmark(const QString& name,
+                                           Function       func) noexcept;
+  static const Registry& getRegisteredBenchmarks() noexcept;
+
+  // Operator Overloadings
+  Benchmark& operator=(const Benchmark& rhs) = delete;
+
+private:  // Methods
+  static Registry& getRegistry() noexcept;
+
+private:  // Data
+  QString              mName;
+  int                  mSize;
+  qint64               mMinNanoseconds;
+  Result               mResult;
+  const void* volatile mSink;
+};
+
+/*******************************************************************************
+ *  Macros
+ ******************************************************************************/
+
+/**
+ * @brief Define a benchmark function which gets registered automatically
+ *
+ * The function body has access to the librepcb::benchmarks::Benchmark object
+ * named `b`.
+ */
+#define LIBREPCB_BENCHMARK(name)                                         \
+  static void      name(::librepcb::benchmarks::Benchmark& b);           \
+  static const int name##Registered =                                    \
+      ::librepcb::benchmarks::Benchmark::registerBenchmark(#name, name); \
+  static void name(::librepcb::benchmarks::Benchmark& b)
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_BENCHMARK_H
@@ -0,0 +1,256 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../benchmark.h"
+
+#include <librepcb/common/attributes/attributeprovider.h>
+#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/circuitidentifier.h>
+#include <librepcb/common/elementname.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/toolbox.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Helper Functions
+ ******************************************************************************/
+
+static SExpression createSExpression(int size) {
+  SExpression root = SExpression::createList("librepcb_benchmark");
+  for (int i = 0; i < size; ++i) {
+    SExpression& child = root.appendList("netline", true);
+    child.appendChild(Uuid::createRandom());
+    child.appendChild("width", Length(200000 + i), false);
+    Point(Length(i * 1000), Length(0)).serialize(
+        child.appendList("from", false));
+    Point(Length(0), Length(i * 1000)).serialize(
+        child.appendList("to", false));
+  }
+  return root;
+}
+
+static Path createPath(int size) {
+  Path path;
+  for (int i = 0; i < size; ++i) {
+    Angle angle = Angle::fromDeg(360.0 * i / size);
+    path.addVertex(Point::fromMm(10, 0).rotated(angle),
+                   (i % 4 == 0) ? Angle::deg45() : Angle::deg0());
+  }
+  path.close();
+  return path;
+}
+
+/*******************************************************************************
+ *  Class AttributeProviderBenchmark
+ ******************************************************************************/
+
+class AttributeProviderBenchmark final : public AttributeProvider {
+public:
+  explicit AttributeProviderBenchmark(int size) noexcept {
+    for (int i = 0; i < size; ++i) {
+      mAttributes.insert(QString("KEY_%1").arg(i), QString("Value %1").arg(i));
+    }
+  }
+  ~AttributeProviderBenchmark() noexcept {}
+
+  QString getUserDefinedAttributeValue(const QString& key) const
+      noexcept override {
+    return mAttributes.value(key);
+  }
+
+signals:
+  void attributesChanged() override {}
+
+private:
+  QHash<QString, QString> mAttributes;
+};
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(SExpressionParse) {
+  QByteArray content = createSExpression(b.getSize()).toByteArray();
+  FilePath   fp("/benchmark.lp");
+  b.measure([&]() { b.keep(SExpression::parse(content, fp)); });
+}
+
+LIBREPCB_BENCHMARK(SExpressionToByteArray) {
+  SExpression root = createSExpression(b.getSize());
+  b.measure([&]() { b.keep(root.toByteArray()); });
+}
+
+LIBREPCB_BENCHMARK(UuidFromString) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(Uuid::createRandom().toStr());
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(Uuid::fromString(str));  // can throw
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(LengthFromMm) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString::number(i * 0.0254, 'f', 4));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(Length::fromMm(str));  // can throw
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(PathTransform) {
+  Path path = createPath(b.getSize());
+  b.measure([&]() {
+    b.keep(path.translated(Point(Length(100000), Length(200000)))
+               .rotated(Angle::fromDeg(33))
+               .mirrored(Qt::Horizontal));
+  });
+}
+
+LIBREPCB_BENCHMARK(PathSerialize) {
+  Path path = createPath(b.getSize());
+  b.measure([&]() { b.keep(path.serializeToDomElement("outline")); });
+}
+
+LIBREPCB_BENCHMARK(ClipperHelpersOffset) {
+  ClipperLib::Paths input = {
+      ClipperHelpers::convert(createPath(b.getSize()), PositiveLength(5000))};
+  b.measure([&]() {
+    ClipperLib::Paths paths = input;
+    ClipperHelpers::offset(paths, Length(100000),
+                           PositiveLength(5000));  // can throw
+    b.keep(paths);
+  });
+}
+
+LIBREPCB_BENCHMARK(GerberGeneratorGenerate) {
+  Uuid uuid = Uuid::createRandom();
+  Path path = createPath(50);
+  b.measure([&]() {
+    GerberGenerator gen("Benchmark", uuid, "1");
+    for (int i = 0; i < b.getSize(); ++i) {
+      Point pos(Length(i * 100000), Length((i % 100) * 100000));
+      gen.flashCircle(pos, UnsignedLength(500000), UnsignedLength(0));
+      gen.drawLine(pos, pos + Point(Length(1000000), Length(0)),
+                   UnsignedLength(200000));
+      if (i % 100 == 0) {
+        gen.drawPathArea(path.translated(pos));
+      }
+    }
+    gen.generate();  // can throw
+    b.keep(gen.toByteArray());
+  });
+}
+
+LIBREPCB_BENCHMARK(AttributeSubstitutorSubstitute) {
+  AttributeProviderBenchmark ap(b.getSize());
+  QString                    text;
+  for (int i = 0; i < b.getSize(); ++i) {
+    text += QString("Text {{KEY_%1}} {{UNKNOWN or KEY_%1}} ").arg(i);
+  }
+  b.measure([&]() { b.keep(AttributeSubstitutor::substitute(text, &ap)); });
+}
+
+LIBREPCB_BENCHMARK(CircuitIdentifierConstruct) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString("NET_%1").arg(i));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(CircuitIdentifier(str));  // can throw
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(CleanCircuitIdentifier) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString(" Net %1 (old) ").arg(i));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(cleanCircuitIdentifier(str));
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(ElementNameConstruct) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString("Element %1").arg(i));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(ElementName(str));  // can throw
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(ToolboxIncrementNumberInString) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString("X%1_A").arg(i));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(Toolbox::incrementNumberInString(str));
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(ToolboxExpandRangesInString) {
+  QVector<QString> input;
+  for (int i = 0; i < b.getSize(); ++i) {
+    input.append(QString("X%1_1..4").arg(i));
+  }
+  b.measure([&]() {
+    foreach (const QString& str, input) {
+      b.keep(Toolbox::expandRangesInString(str));
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,115 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/exceptions.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // many classes rely on a QApplication instance, so we create it here
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB-Benchmarks");
+
+  // disable the whole debug output (it would affect the measurements)
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+  QCommandLineParser parser;
+  parser.addHelpOption();
+  QCommandLineOption filterOption(
+      "filter", "Only run benchmarks whose name matches the given regex.",
+      "regex");
+  parser.addOption(filterOption);
+  QCommandLineOption sizeOption(
+      "size", "Number of elements of the synthetic input data (default: 1000).",
+      "n", "1000");
+  parser.addOption(sizeOption);
+  QCommandLineOption minTimeOption(
+      "min-time", "Minimum measurement time per benchmark (default: 500).",
+      "ms", "500");
+  parser.addOption(minTimeOption);
+  QCommandLineOption jsonOption(
+      "json", "Write the results as JSON to the given file.", "file");
+  parser.addOption(jsonOption);
+  parser.process(app);
+
+  QRegularExpression filter(parser.value(filterOption));
+  int                size    = qMax(parser.value(sizeOption).toInt(), 1);
+  qint64             minTime = parser.value(minTimeOption).toLongLong() * 1e6;
+
+  QTextStream out(stdout);
+  QJsonArray  results;
+  bool        success = true;
+  foreach (const auto& entry, Benchmark::getRegisteredBenchmarks()) {
+    if (!filter.match(entry.first).hasMatch()) {
+      continue;
+    }
+    try {
+      Benchmark b(entry.first, size, minTime);
+      entry.second(b);  // can throw
+      const Benchmark::Result& result = b.getResult();
+      qreal nsPerIteration = qreal(result.nanoseconds) / result.iterations;
+      out << QString("%1 %2 ns (%3 iterations)")
+                 .arg(result.name.leftJustified(40))
+                 .arg(nsPerIteration, 15, 'f', 0)
+                 .arg(result.iterations)
+          << endl;
+      QJsonObject obj;
+      obj.insert("name", result.name);
+      obj.insert("size", result.size);
+      obj.insert("iterations", result.iterations);
+      obj.insert("ns_per_iteration", nsPerIteration);
+      results.append(obj);
+    } catch (const Exception& e) {
+      out << entry.first.leftJustified(40) << " FAILED: " << e.getMsg() << endl;
+      success = false;
+    }
+  }
+
+  if (parser.isSet(jsonOption)) {
+    QFile file(parser.value(jsonOption));
+    if ((!file.open(QIODevice::WriteOnly)) ||
+        (file.write(QJsonDocument(results).toJson()) < 0)) {
+      out << "Failed to write " << file.fileName() << ": "
+          << file.errorString() << endl;
+      success = false;
+    }
+  }
+
+  return success ? 0 : 1;
+}
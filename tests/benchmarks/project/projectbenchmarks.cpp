@@ -0,0 +1,158 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../benchmark.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardairwiresbuilder.h>
+#include <librepcb/project/boards/boardplanefragmentsbuilder.h>
+#include <librepcb/project/boards/boardspatialindex.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace benchmarks {
+
+using librepcb::benchmarks::Benchmark;
+
+/*******************************************************************************
+ *  Helper Functions
+ ******************************************************************************/
+
+/**
+ * @brief Open the project used for the board benchmarks
+ *
+ * @note The project is not synthetic, so these benchmarks ignore the
+ *       configured input size.
+ */
+static std::unique_ptr<Project> openProject() {
+  FilePath projectFp(TEST_DATA_DIR
+                     "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest"
+                     "/test_project/test_project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());  // can throw
+  return std::unique_ptr<Project>(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));  // can throw
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(BoardPlaneFragmentsBuilderBuild) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board*                   board   = project->getBoards().first();
+
+  // build the planes in the order of their priority, like the board does
+  QList<BI_Plane*> planes = board->getPlanes();
+  std::sort(planes.begin(), planes.end(),
+            [](const BI_Plane* p1, const BI_Plane* p2) {
+              return !(*p1 < *p2);
+            });
+  BoardSpatialIndex                             index(*board);
+  QVector<BoardPlaneFragmentsBuilder::Snapshot> snapshots;
+  foreach (const BI_Plane* plane, planes) {
+    snapshots.append(BoardPlaneFragmentsBuilder::createSnapshot(
+        *plane, index,
+        BoardPlaneFragmentsBuilder::Quality::Fabrication));  // can throw
+  }
+
+  b.measure([&]() {
+    // use new builders to not measure their caches
+    BoardPlaneFragmentsBuilder::PlaneFragments fragments;
+    foreach (const BoardPlaneFragmentsBuilder::Snapshot& snapshot, snapshots) {
+      BoardPlaneFragmentsBuilder builder;
+      fragments.insert(snapshot.uuid,
+                       builder.buildFragments(snapshot, fragments));
+    }
+    b.keep(fragments);
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardCopy) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board*                   board   = project->getBoards().first();
+
+  b.measure([&]() {
+    std::unique_ptr<Board> copy(
+        project->createBoard(*board, ElementName("copy")));  // can throw
+    b.keep(copy->getNetSegments().count());
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardAirWiresBuilderBuild) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board*                   board   = project->getBoards().first();
+  board->rebuildAllPlanes();  // airwires depend on plane fragments
+
+  b.measure([&]() {
+    // use new builders to not measure their caches
+    foreach (const NetSignal* netsignal,
+             project->getCircuit().getNetSignals()) {
+      BoardAirWiresBuilder builder;
+      builder.update(*board, *netsignal);
+      b.keep(builder.buildAirWires());
+    }
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardAirWiresBuilderHugeNet) {
+  // A huge net like GND of a BGA: Pads in a (slightly irregular) grid, with
+  // the pads of every second row already connected by traces.
+  const int                columns = qMax(qCeil(qSqrt(b.getSize())), 1);
+  QVector<Point>           points;
+  QVector<QPair<int, int>> connections;
+  for (int i = 0; i < b.getSize(); ++i) {
+    const int column = i % columns;
+    const int row    = i / columns;
+    points.append(Point(Length(column * 800000 + (i * 7919) % 1000),
+                        Length(row * 800000 + (i * 104729) % 1000)));
+    if ((column > 0) && (row % 2 == 0)) {
+      connections.append(qMakePair(i - 1, i));
+    }
+  }
+
+  b.measure([&]() {
+    b.keep(BoardAirWiresBuilder::calcAirWires(points, connections));
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace project
+}  // namespace librepcb
@@ -49,10 +49,13 @@ class CliExecutor(object):
     def abspath(self, relpath):
         return os.path.join(self.tmpdir, relpath)
 
+    def start(self, *args):
+        return subprocess.Popen([self.executable] + list(args), cwd=self.tmpdir,
+                                stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                                universal_newlines=True, env=self._env())
+
     def run(self, *args):
-        p = subprocess.Popen([self.executable] + list(args), cwd=self.tmpdir,
-                             stdout=subprocess.PIPE, stderr=subprocess.PIPE,
-                             universal_newlines=True, env=self._env())
+        p = self.start(*args)
         stdout, stderr = p.communicate()
         # output to stdout/stderr because it helps debugging failed tests
         sys.stdout.write(stdout)
@@ -0,0 +1,54 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+
+"""
+Test command "import-eagle"
+"""
+
+EAGLE_LIBRARY = os.path.join(os.path.dirname(__file__), '..', '..', 'data',
+                             'unittests', 'eagleimport', 'resistor.lbr')
+
+
+def test_help(cli):
+    code, stdout, stderr = cli.run('import-eagle', '--help')
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 10
+
+
+def test_import_library(cli):
+    output = cli.abspath('output.lplib')
+    code, stdout, stderr = cli.run('import-eagle', output,
+                                   os.path.abspath(EAGLE_LIBRARY))
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[-1] == 'SUCCESS'
+    assert len(os.listdir(os.path.join(output, 'sym'))) == 1
+
+
+def test_reimport_with_uuid_db_keeps_uuids(cli):
+    output = cli.abspath('output.lplib')
+    uuid_db = cli.abspath('uuids.ini')
+    for i in range(2):
+        code, stdout, stderr = cli.run('import-eagle', '--uuid-db', uuid_db,
+                                       output, os.path.abspath(EAGLE_LIBRARY))
+        assert code == 0
+        assert stdout[-1] == 'SUCCESS'
+    assert os.path.exists(uuid_db)
+    assert len(os.listdir(os.path.join(output, 'sym'))) == 1
+
+
+def test_nonexistent_library(cli):
+    code, stdout, stderr = cli.run('import-eagle', cli.abspath('output'),
+                                   cli.abspath('nonexistent.lbr'))
+    assert code == 1
+    assert len(stderr) > 0
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_missing_arguments(cli):
+    code, stdout, stderr = cli.run('import-eagle', cli.abspath('output'))
+    assert code == 1
+    assert 'Wrong argument count.' in stderr[0]
@@ -10,10 +10,10 @@ Test command "open-project" with all available options
 
 
 @pytest.mark.parametrize("project_name,project_suffix,gerber_count", [
-    ('Empty Project', 'lpp', 8),
-    ('Empty Project', 'lppz', 8),
-    ('Project With Two Boards', 'lpp', 16),
-    ('Project With Two Boards', 'lppz', 16),
+    ('Empty Project', 'lpp', 9),
+    ('Empty Project', 'lppz', 9),
+    ('Project With Two Boards', 'lpp', 17),
+    ('Project With Two Boards', 'lppz', 17),
 ], ids=[
     'EmptyProject.lpp',
     'EmptyProject.lppz',
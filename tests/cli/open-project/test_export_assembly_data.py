@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import pytest
+
+"""
+Test command "open-project --export-bom --export-pnp"
+"""
+
+PROJECT_DIR_1 = 'data/Empty Project'
+PROJECT_PATH_1 = PROJECT_DIR_1 + '/Empty Project.lpp'
+
+PROJECT_DIR_2 = 'data/Project With Two Boards'
+PROJECT_PATH_2 = PROJECT_DIR_2 + '.lppz'
+
+
+@pytest.mark.parametrize("option", [
+    '--export-bom',
+    '--export-pnp',
+])
+def test_export_project_with_one_board(cli, option):
+    path = cli.abspath('assembly.csv')
+    assert not os.path.exists(path)
+    code, stdout, stderr = cli.run('open-project',
+                                   '{}={}'.format(option, path),
+                                   PROJECT_PATH_1)
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 0
+    assert stdout[-1] == 'SUCCESS'
+    assert os.path.exists(path)
+
+
+@pytest.mark.parametrize("option", [
+    '--export-bom',
+    '--export-pnp',
+])
+def test_export_project_with_two_boards_to_same_file_fails(cli, option):
+    path = cli.abspath('assembly.csv')
+    code, stdout, stderr = cli.run('open-project',
+                                   '{}={}'.format(option, path),
+                                   PROJECT_PATH_2)
+    assert code == 1
+    assert len(stderr) == 1
+    assert 'was written multiple times' in stderr[0]
+    assert stdout[-1] == 'Finished with errors!'
+
+
+@pytest.mark.parametrize("option", [
+    '--export-bom',
+    '--export-pnp',
+])
+def test_export_project_with_two_boards_by_board_name(cli, option):
+    path = cli.abspath('assembly_{{BOARD}}.csv')
+    code, stdout, stderr = cli.run('open-project',
+                                   '{}={}'.format(option, path),
+                                   PROJECT_PATH_2)
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[-1] == 'SUCCESS'
+    assert os.path.exists(cli.abspath('assembly_default.csv'))
+    assert os.path.exists(cli.abspath('assembly_copy.csv'))
@@ -63,7 +63,7 @@ def test_export_project_with_one_board_implicit(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 8
+    assert len(os.listdir(dir)) == 9
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -85,7 +85,32 @@ def test_export_project_with_one_board_explicit(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 8
+    assert len(os.listdir(dir)) == 9
+
+
+@pytest.mark.parametrize("project,output_dir", [
+    (PROJECT_PATH_1_LPP, OUTPUT_DIR_1_LPP),
+    (PROJECT_PATH_1_LPPZ, OUTPUT_DIR_1_LPPZ),
+], ids=[
+    'EmptyProject.lpp',
+    'EmptyProject.lppz',
+])
+def test_export_again_does_not_modify_files(cli, project, output_dir):
+    dir = cli.abspath(output_dir)
+    for i in range(2):
+        code, stdout, stderr = cli.run('open-project',
+                                       '--export-pcb-fabrication-data',
+                                       project)
+        assert code == 0
+        assert len(stderr) == 0
+        assert stdout[-1] == 'SUCCESS'
+        if i == 0:
+            files = [f for f in os.listdir(dir) if not f.startswith('.')]
+            for f in files:  # make modifications detectable
+                os.utime(os.path.join(dir, f), (0, 0))
+    assert len(os.listdir(dir)) == 9
+    for f in files:
+        assert os.path.getmtime(os.path.join(dir, f)) == 0
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -128,7 +153,7 @@ def test_export_project_with_two_boards_implicit(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 16
+    assert len(os.listdir(dir)) == 17
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -150,7 +175,7 @@ def test_export_project_with_two_boards_explicit_one(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 8
+    assert len(os.listdir(dir)) == 9
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -173,7 +198,7 @@ def test_export_project_with_two_boards_explicit_two(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 16
+    assert len(os.listdir(dir)) == 17
 
 
 def test_export_project_with_two_conflicting_boards_fails(cli):
@@ -209,7 +234,7 @@ def test_export_project_with_two_conflicting_boards_succeeds_explicit(cli):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 8
+    assert len(os.listdir(dir)) == 9
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -257,7 +282,7 @@ def test_export_with_custom_settings(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
     assert os.path.exists(dir)
-    assert len(os.listdir(dir)) == 10
+    assert len(os.listdir(dir)) == 11
 
 
 @pytest.mark.parametrize("project,output_dir", [
@@ -304,3 +329,23 @@ def test_if_export_with_invalid_settings_fails(cli, project, output_dir):
     assert len(stdout) > 0
     assert stdout[-1] == 'Finished with errors!'
     assert not os.path.exists(dir)
+
+
+@pytest.mark.parametrize("project,output_dir", [
+    (PROJECT_PATH_1_LPP, OUTPUT_DIR_1_LPP),
+    (PROJECT_PATH_2_LPPZ, OUTPUT_DIR_2_LPPZ),
+], ids=[
+    'EmptyProject.lpp',
+    'ProjectWithTwoBoards.lppz',
+])
+def test_verify_pcb_fabrication_data(cli, project, output_dir):
+    dir = cli.abspath(output_dir)
+    code, stdout, stderr = cli.run('open-project',
+                                   '--verify-pcb-fabrication-data',
+                                   project)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Verify PCB fabrication data...' in stdout
+    assert 'Parallel export is reproducible.' in [s.strip() for s in stdout]
+    assert stdout[-1] == 'SUCCESS'
+    assert not os.path.exists(dir)  # nothing was written
@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 # -*- coding: utf-8 -*-
 
+import json
 import pytest
 
 """
@@ -55,3 +56,75 @@ def test_open_project_verbose(cli, project):
     assert len(stderr) > 0  # logging messages are on stderr
     assert len(stdout) > 0
     assert stdout[-1] == 'SUCCESS'
+
+
+def test_open_multiple_projects(cli):
+    code, stdout, stderr = cli.run('open-project', PROJECT_LPP, PROJECT_LPPZ,
+                                   'data/Project With Two Boards.lppz')
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[-5] == 'Summary:'
+    assert stdout[-4] == '  [OK] ' + PROJECT_LPP
+    assert stdout[-3] == '  [OK] ' + PROJECT_LPPZ
+    assert stdout[-2] == '  [OK] data/Project With Two Boards.lppz'
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_open_project_list_with_failing_project(cli):
+    with open(cli.abspath('data/projects.txt'), 'w') as f:
+        f.write('# comment\nEmpty Project/Empty Project.lpp\n\nfoo.lpp\n')
+    code, stdout, stderr = cli.run('open-project',
+                                   '--project-list=data/projects.txt')
+    assert code == 1
+    assert len(stderr) > 0
+    assert stdout[-3] == '  [OK] data/Empty Project/Empty Project.lpp'
+    assert stdout[-2] == '  [FAILED] data/foo.lpp'
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_profile(cli):
+    code, stdout, stderr = cli.run('open-project', '--profile', PROJECT_LPP)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Profile:' in stdout
+    assert '  Performance counters:' in stdout
+    assert any(line.endswith("project '{}': open".format(PROJECT_LPP))
+               for line in stdout)
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_profile_json(cli):
+    report = cli.abspath('profile.json')
+    code, stdout, stderr = cli.run('open-project', '--profile-json', report,
+                                   PROJECT_LPP)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Profile:' not in stdout
+    with open(report) as f:
+        data = json.load(f)
+    names = [entry['name'] for entry in data['timings']]
+    assert "project '{}': open".format(PROJECT_LPP) in names
+    assert data['peak_memory_usage'] > 0
+    assert data['created_schematic_items'] >= 0
+    assert data['created_board_items'] >= 0
+    memory = {entry['name']: entry['bytes'] for entry in data['memory_usage']}
+    assert memory["project '{}': Library".format(PROJECT_LPP)] > 0
+    assert all(bytes > 0 for bytes in memory.values())
+    counters = data['performance_counters']
+    assert counters['sexpression nodes parsed'] > 0
+    assert all(value >= 0 for value in counters.values())
+
+
+def test_profile_trace(cli):
+    trace = cli.abspath('trace.json')
+    code, stdout, stderr = cli.run('open-project', '--profile-trace', trace,
+                                   PROJECT_LPP)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Profile:' not in stdout
+    with open(trace) as f:
+        data = json.load(f)
+    events = [e for e in data['traceEvents'] if e['ph'] == 'X']
+    names = [e['name'] for e in events]
+    assert "project '{}': open".format(PROJECT_LPP) in names
+    assert all(e['dur'] >= 0 for e in events)
@@ -0,0 +1,29 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+Test command "open-project --routing-statistics"
+"""
+
+PROJECT_DIR = 'data/Project With Two Boards/'
+PROJECT_PATH = PROJECT_DIR + 'Project With Two Boards.lpp'
+
+
+def test_print_routing_statistics(cli):
+    code, stdout, stderr = cli.run('open-project', '--routing-statistics',
+                                   PROJECT_PATH)
+    assert code == 0
+    assert len(stderr) == 0
+    assert "  Board 'default':" in stdout
+    assert "  Board 'copy':" in stdout
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_print_routing_statistics_of_one_board(cli):
+    code, stdout, stderr = cli.run('open-project', '--routing-statistics',
+                                   '--board=copy', PROJECT_PATH)
+    assert code == 0
+    assert len(stderr) == 0
+    assert "  Board 'default':" not in stdout
+    assert "  Board 'copy':" in stdout
+    assert stdout[-1] == 'SUCCESS'
@@ -0,0 +1,40 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+Test command "open-project --drc"
+"""
+
+PROJECT_DIR = 'data/Empty Project/'
+PROJECT_PATH = PROJECT_DIR + 'Empty Project.lpp'
+
+
+def test_project_without_violations(cli):
+    code, stdout, stderr = cli.run('open-project', '--drc', PROJECT_PATH)
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 0
+    assert any(['0 clearance violation(s)' in line for line in stdout])
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_project_without_boards(cli):
+    # remove all boards first
+    with open(cli.abspath(PROJECT_DIR + 'boards/boards.lp'), 'w') as f:
+        f.write('(librepcb_boards)')
+    code, stdout, stderr = cli.run('open-project', '--drc', PROJECT_PATH)
+    assert code == 0
+    assert len(stderr) == 0
+    assert not any(['clearance violation' in line for line in stdout])
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_drc_of_one_board(cli):
+    project_path = 'data/Project With Two Boards/Project With Two Boards.lpp'
+    code, stdout, stderr = cli.run('open-project', '--drc', '--board=copy',
+                                   project_path)
+    assert code == 0
+    assert len(stderr) == 0
+    assert not any(["Board 'default'" in line for line in stdout])
+    assert any(["Board 'copy'" in line for line in stdout])
+    assert stdout[-1] == 'SUCCESS'
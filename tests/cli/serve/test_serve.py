@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import pytest
+
+"""
+Test command "serve" and option "--server"
+"""
+
+PROJECT_LPP = 'data/Empty Project/Empty Project.lpp'
+
+
+@pytest.fixture
+def server(cli):
+    name = 'librepcb-cli-test-{}'.format(os.getpid())
+    p = cli.start('serve', name)
+    assert p.stdout.readline().startswith('Listening on')
+    yield name
+    p.terminate()
+    p.wait()
+
+
+def test_help(cli):
+    code, stdout, stderr = cli.run('serve', '--help')
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 10
+
+
+def test_forward_version(cli, server):
+    code, stdout, stderr = cli.run('--server', server, '--version')
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) == 4
+    assert stdout[0].startswith('LibrePCB CLI Version')
+
+
+def test_forward_open_project_relative_path(cli, server):
+    for i in range(3):  # the server must be reusable
+        code, stdout, stderr = cli.run('--server', server, 'open-project',
+                                       PROJECT_LPP)
+        assert code == 0
+        assert len(stderr) == 0
+        assert stdout[0] == "Open project '{}'...".format(PROJECT_LPP)
+        assert stdout[-1] == 'SUCCESS'
+
+
+def test_forward_failing_command(cli, server):
+    code, stdout, stderr = cli.run('--server', server, 'open-project',
+                                   'nonexistent.lpp')
+    assert code == 1
+    assert len(stderr) > 0
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_no_server_running(cli):
+    code, stdout, stderr = cli.run('--server', 'librepcb-cli-nonexistent',
+                                   '--version')
+    assert code == 1
+    assert len(stderr) == 1
+    assert len(stdout) == 0
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectgenerator.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::testdatagenerator;
+
+/*******************************************************************************
+ *  The Test Data Generator Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // many classes rely on a QApplication instance, so we create it here
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB-TestDataGenerator");
+
+  ProjectGenerator::Options defaults;
+  QCommandLineParser        parser;
+  parser.addHelpOption();
+  QCommandLineOption elementsOption(
+      "elements", "Number of library devices (default: 10).", "n",
+      QString::number(defaults.libraryElements));
+  parser.addOption(elementsOption);
+  QCommandLineOption componentsOption(
+      "components", "Number of components (default: 100).", "n",
+      QString::number(defaults.components));
+  parser.addOption(componentsOption);
+  QCommandLineOption schematicsOption(
+      "schematics", "Number of schematic pages (default: 1).", "n",
+      QString::number(defaults.schematics));
+  parser.addOption(schematicsOption);
+  QCommandLineOption planesOption("planes", "Number of planes (default: 2).",
+                                  "n", QString::number(defaults.planes));
+  parser.addOption(planesOption);
+  QCommandLineOption segmentsOption(
+      "segments", "Number of net lines per board trace (default: 3).", "n",
+      QString::number(defaults.traceSegments));
+  parser.addOption(segmentsOption);
+  QCommandLineOption seedOption(
+      "seed", "Seed for the generated data (default: LibrePCB).", "text",
+      defaults.seed);
+  parser.addOption(seedOption);
+  parser.addPositionalArgument(
+      "output", "Empty directory to write the library and the project to.");
+  parser.process(app);
+
+  QTextStream out(stdout);
+  if (parser.positionalArguments().count() != 1) {
+    out << "Exactly one output directory must be specified." << endl;
+    return 1;
+  }
+
+  ProjectGenerator::Options options;
+  options.libraryElements = parser.value(elementsOption).toInt();
+  options.components      = parser.value(componentsOption).toInt();
+  options.schematics      = parser.value(schematicsOption).toInt();
+  options.planes          = parser.value(planesOption).toInt();
+  options.traceSegments   = parser.value(segmentsOption).toInt();
+  options.seed            = parser.value(seedOption);
+
+  try {
+    FilePath outputDir(
+        QFileInfo(parser.positionalArguments().first()).absoluteFilePath());
+    ProjectGenerator generator(options);
+    generator.generate(outputDir);  // can throw
+    const ProjectGenerator::Statistics& stats = generator.getStatistics();
+    out << "Net signals:         " << stats.netSignals << endl;
+    out << "Schematic net lines: " << stats.schematicNetLines << endl;
+    out << "Board net lines:     " << stats.boardNetLines << endl;
+    out << "SUCCESS" << endl;
+    return 0;
+  } catch (const Exception& e) {
+    out << "ERROR: " << e.getMsg() << endl;
+    return 1;
+  }
+}
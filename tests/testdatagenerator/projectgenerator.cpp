@@ -0,0 +1,474 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectgenerator.h"
+
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/version.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/boards/items/bi_footprint.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/componentinstance.h>
+#include <librepcb/project/circuit/componentsignalinstance.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/library/projectlibrary.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/items/si_netline.h>
+#include <librepcb/project/schematics/items/si_netsegment.h>
+#include <librepcb/project/schematics/items/si_symbol.h>
+#include <librepcb/project/schematics/items/si_symbolpin.h>
+#include <librepcb/project/schematics/schematic.h>
+
+#include <QtCore>
+
+#include <cmath>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace testdatagenerator {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ProjectGenerator::ProjectGenerator(const Options& options) noexcept
+  : mOptions(options), mStatistics(), mRandom() {
+  mOptions.libraryElements = qMax(mOptions.libraryElements, 1);
+  mOptions.components      = qMax(mOptions.components, 1);
+  mOptions.planes          = qMax(mOptions.planes, 0);
+  mOptions.traceSegments   = qMax(mOptions.traceSegments, 1);
+
+  // at most one schematic page per component
+  mOptions.schematics = qBound(1, mOptions.schematics, mOptions.components);
+}
+
+ProjectGenerator::~ProjectGenerator() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ProjectGenerator::generate(const FilePath& outputDir) {
+  if (outputDir.isExistingFile() ||
+      (outputDir.isExistingDir() && (!outputDir.isEmptyDir()))) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString("The output directory is not empty: %1")
+            .arg(outputDir.toNative()));
+  }
+
+  // reset the state of a previous run
+  // Note: Don't use qHash() since its seed is randomized for each process.
+  QByteArray hash = QCryptographicHash::hash(mOptions.seed.toUtf8(),
+                                             QCryptographicHash::Sha256);
+  const uchar* data = reinterpret_cast<const uchar*>(hash.constData());
+  mRandom.seed(qFromBigEndian<quint32>(data));
+  mStatistics = Statistics();
+  mElements.clear();
+  mComponents.clear();
+  mNetSignals.clear();
+  mNetSignalPins.clear();
+
+  // create the library
+  std::shared_ptr<TransactionalFileSystem> libFs =
+      TransactionalFileSystem::openRW(
+          outputDir.getPathTo("Generated Library.lplib"));  // can throw
+  TransactionalDirectory libDir(libFs);
+
+  QScopedPointer<library::Library> lib(new library::Library(
+      createUuid("library"), Version::fromString("0.1"), "LibrePCB",
+      ElementName("Generated Library"), "Synthetic library for scale testing.",
+      QString("")));  // can throw
+  lib->moveTo(libDir);  // can throw
+
+  // create the project
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRW(
+          outputDir.getPathTo("Generated Project"));  // can throw
+  QScopedPointer<Project> project(Project::create(
+      std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(projectFs)),
+      "Generated Project.lpp"));  // can throw
+  project->getMetadata().setAuthor("LibrePCB");
+
+
+  generateLibrary(libDir, *project);  // can throw
+  generateCircuit(*project);          // can throw
+  generateSchematics(*project);       // can throw
+  generateBoard(*project);            // can throw
+
+  // save everything to the filesystem
+  libFs->save();      // can throw
+  project->save();    // can throw
+  projectFs->save();  // can throw
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void ProjectGenerator::generateLibrary(TransactionalDirectory& dir,
+                                       Project&                project) {
+  const Version version = Version::fromString("0.1");
+  const Length  grid    = Length(2540000);
+
+  for (int i = 0; i < mOptions.libraryElements; ++i) {
+    const QString prefix   = QString("element/%1/").arg(i);
+    const int     pinCount = 2 * (1 + (i % 4));
+    const int     rowCount = pinCount / 2;
+    const ElementName name(QString("Generated %1-Pin Device %2")
+                               .arg(pinCount)
+                               .arg(i + 1));
+    QList<Uuid> pins, pads, cmpSignals;
+    for (int k = 0; k < pinCount; ++k) {
+      pins.append(createUuid(prefix % QString("pin/%1").arg(k)));
+      pads.append(createUuid(prefix % QString("pad/%1").arg(k)));
+      cmpSignals.append(createUuid(prefix % QString("signal/%1").arg(k)));
+    }
+    Element e{createUuid(prefix % "symbol"),
+              createUuid(prefix % "package"),
+              createUuid(prefix % "footprint"),
+              createUuid(prefix % "component"),
+              createUuid(prefix % "symbol_variant"),
+              createUuid(prefix % "symbol_item"),
+              createUuid(prefix % "device"),
+              pins,
+              pads,
+              cmpSignals};
+
+    // symbol with the pins on the left and right side of a rectangle
+    std::unique_ptr<library::Symbol> symbol(new library::Symbol(
+        e.symbol, version, "LibrePCB", name, "", ""));  // can throw
+    for (int k = 0; k < pinCount; ++k) {
+      bool  left = (k < rowCount);
+      Point pos(left ? (grid * -3) : (grid * 3), grid * -(k % rowCount));
+      symbol->getPins().append(std::make_shared<library::SymbolPin>(
+          e.pins.at(k), CircuitIdentifier(QString::number(k + 1)), pos,
+          UnsignedLength(grid), left ? Angle::deg0() : Angle::deg180()));
+    }
+    symbol->getPolygons().append(std::make_shared<Polygon>(
+        createUuid(prefix % "symbol_outline"),
+        GraphicsLayerName(GraphicsLayer::sSymbolOutlines),
+        UnsignedLength(254000), false, true,
+        Path::rect(Point(grid * -2, grid), Point(grid * 2, grid * -rowCount))));
+
+    // package with two rows of SMT pads
+    std::unique_ptr<library::Package> package(new library::Package(
+        e.package, version, "LibrePCB", name, "", ""));  // can throw
+    std::shared_ptr<library::Footprint> footprint =
+        std::make_shared<library::Footprint>(e.footprint,
+                                             ElementName("default"), "");
+    for (int k = 0; k < pinCount; ++k) {
+      package->getPads().append(std::make_shared<library::PackagePad>(
+          e.pads.at(k), CircuitIdentifier(QString::number(k + 1))));
+      Point pos(Length(635000) * (2 * (k % rowCount) - (rowCount - 1)),
+                Length((k < rowCount) ? -2000000 : 2000000));
+      footprint->getPads().append(std::make_shared<library::FootprintPad>(
+          e.pads.at(k), pos, Angle::deg0(), library::FootprintPad::Shape::RECT,
+          PositiveLength(600000), PositiveLength(1500000), UnsignedLength(0),
+          library::FootprintPad::BoardSide::TOP));
+    }
+    package->getFootprints().append(footprint);
+
+    // component with one signal per pin
+    std::unique_ptr<library::Component> component(new library::Component(
+        e.component, version, "LibrePCB", name, "", ""));  // can throw
+    component->setPrefixes(
+        library::NormDependentPrefixMap(library::ComponentPrefix("U")));
+    std::shared_ptr<library::ComponentSymbolVariantItem> item =
+        std::make_shared<library::ComponentSymbolVariantItem>(
+            e.symbolItem, e.symbol, Point(0, 0), Angle::deg0(), true,
+            library::ComponentSymbolVariantItemSuffix(""));
+    for (int k = 0; k < pinCount; ++k) {
+      component->getSignals().append(std::make_shared<library::ComponentSignal>(
+          e.cmpSignals.at(k), CircuitIdentifier(QString::number(k + 1)),
+          SignalRole::passive(), QString(), false, false, false));
+      item->getPinSignalMap().append(
+          std::make_shared<library::ComponentPinSignalMapItem>(
+              e.pins.at(k), e.cmpSignals.at(k),
+              library::CmpSigPinDisplayType::componentSignal()));
+    }
+    std::shared_ptr<library::ComponentSymbolVariant> variant =
+        std::make_shared<library::ComponentSymbolVariant>(
+            e.symbolVariant, "", ElementName("default"), "");
+    variant->getSymbolItems().append(item);
+    component->getSymbolVariants().append(variant);
+
+    // device connecting each pad to the corresponding signal
+    std::unique_ptr<library::Device> device(
+        new library::Device(e.device, version, "LibrePCB", name, "", "",
+                            e.component, e.package));  // can throw
+    for (int k = 0; k < pinCount; ++k) {
+      device->getPadSignalMap().append(
+          std::make_shared<library::DevicePadSignalMapItem>(
+              e.pads.at(k), e.cmpSignals.at(k)));
+    }
+
+    // save the elements into the library and add them to the project
+    TransactionalDirectory symDir(dir, symbol->getShortElementName());
+    symbol->saveIntoParentDirectory(symDir);  // can throw
+    project.getLibrary().addSymbol(*symbol);  // can throw
+    symbol.release();
+    TransactionalDirectory pkgDir(dir, package->getShortElementName());
+    package->saveIntoParentDirectory(pkgDir);   // can throw
+    project.getLibrary().addPackage(*package);  // can throw
+    package.release();
+    TransactionalDirectory cmpDir(dir, component->getShortElementName());
+    component->saveIntoParentDirectory(cmpDir);     // can throw
+    project.getLibrary().addComponent(*component);  // can throw
+    component.release();
+    TransactionalDirectory devDir(dir, device->getShortElementName());
+    device->saveIntoParentDirectory(devDir);  // can throw
+    project.getLibrary().addDevice(*device);  // can throw
+    device.release();
+
+    mElements.append(e);
+  }
+}
+
+void ProjectGenerator::generateCircuit(Project& project) {
+  Circuit&  circuit  = project.getCircuit();
+  NetClass& netclass = *circuit.getNetClasses().first();
+
+  // about three pins per net signal
+  int pinCount = 0;
+  for (int i = 0; i < mOptions.components; ++i) {
+    pinCount += mElements.at(i % mElements.count()).cmpSignals.count();
+  }
+  int         netSignalCount = qMax(pinCount / 3, 1);
+  QStringList names = circuit.generateAutoNetSignalNames(netSignalCount);
+  for (int i = 0; i < netSignalCount; ++i) {
+    NetSignal* netsignal = new NetSignal(
+        circuit, netclass, CircuitIdentifier(names.at(i)), true);  // can throw
+    circuit.addNetSignal(*netsignal);  // can throw
+    mNetSignals.append(netsignal);
+  }
+  mNetSignalPins.resize(netSignalCount);
+  mStatistics.netSignals = netSignalCount;
+
+  for (int i = 0; i < mOptions.components; ++i) {
+    const Element&      e      = mElements.at(i % mElements.count());
+    library::Component* libCmp = project.getLibrary().getComponent(e.component);
+    Q_ASSERT(libCmp);
+    ComponentInstance* cmp = new ComponentInstance(
+        circuit, *libCmp, e.symbolVariant,
+        CircuitIdentifier(QString("U%1").arg(i + 1)), e.device);  // can throw
+    circuit.addComponentInstance(*cmp);  // can throw
+    mComponents.append(cmp);
+    for (int k = 0; k < e.cmpSignals.count(); ++k) {
+      int index = static_cast<int>(mRandom() % netSignalCount);
+      cmp->getSignalInstance(e.cmpSignals.at(k))
+          ->setNetSignal(mNetSignals.at(index));  // can throw
+      mNetSignalPins[index].append(Pin{i, k});
+    }
+  }
+}
+
+void ProjectGenerator::generateSchematics(Project& project) {
+  const Length grid = Length(2540000);
+
+  // place the symbols in a grid on each page
+  QVector<Schematic*> schematics;
+  QVector<SI_Symbol*> symbols;
+  QVector<int>        pages;
+  for (int i = 0; i < mOptions.schematics; ++i) {
+    Schematic* schematic = project.createSchematic(
+        ElementName(QString("Page %1").arg(i + 1)));  // can throw
+    project.addSchematic(*schematic);                 // can throw
+    schematics.append(schematic);
+  }
+  int perPage = (mOptions.components + mOptions.schematics - 1) /
+                mOptions.schematics;
+  int columns = qCeil(std::sqrt(perPage));
+  for (int i = 0; i < mComponents.count(); ++i) {
+    int        page      = i / perPage;
+    int        index     = i % perPage;
+    Schematic* schematic = schematics.at(page);
+    Point      pos(grid * 12 * (index % columns),
+                   grid * -8 * (index / columns));
+    SI_Symbol* symbol =
+        new SI_Symbol(*schematic, *mComponents.at(i),
+                      mElements.at(i % mElements.count()).symbolItem, pos,
+                      Angle::deg0(), false);  // can throw
+    schematic->addSymbol(*symbol);            // can throw
+    symbols.append(symbol);
+    pages.append(page);
+  }
+
+  // connect all pins of a net signal on the same page in a chain
+  for (int n = 0; n < mNetSignals.count(); ++n) {
+    QMap<int, QVector<Pin>> pinsPerPage;
+    foreach (const Pin& pin, mNetSignalPins.at(n)) {
+      pinsPerPage[pages.at(pin.component)].append(pin);
+    }
+    foreach (int page, pinsPerPage.keys()) {
+      const QVector<Pin>& pins = pinsPerPage[page];
+      if (pins.count() < 2) {
+        continue;
+      }
+      SI_NetSegment* segment =
+          new SI_NetSegment(*schematics.at(page), *mNetSignals.at(n));
+      schematics.at(page)->addNetSegment(*segment);  // can throw
+      QList<SI_NetLine*> netlines;
+      for (int i = 1; i < pins.count(); ++i) {
+        const Pin&    a     = pins.at(i - 1);
+        const Pin&    b     = pins.at(i);
+        SI_SymbolPin* start = symbols.at(a.component)->getPin(
+            mElements.at(a.component % mElements.count()).pins.at(a.index));
+        SI_SymbolPin* end = symbols.at(b.component)->getPin(
+            mElements.at(b.component % mElements.count()).pins.at(b.index));
+        Q_ASSERT(start && end);
+        netlines.append(new SI_NetLine(*segment, *start, *end,
+                                       UnsignedLength(158750)));  // can throw
+      }
+      segment->addNetPointsAndNetLines({}, netlines);  // can throw
+      mStatistics.schematicNetLines += netlines.count();
+    }
+  }
+}
+
+void ProjectGenerator::generateBoard(Project& project) {
+  const Length pitch = Length(10000000);
+
+  Board* board =
+      project.createBoard(ElementName("Generated Board"));  // can throw
+  project.addBoard(*board);                                 // can throw
+
+  // place the devices in a grid and resize the board outline accordingly
+  int   columns = qCeil(std::sqrt(mComponents.count()));
+  int   rows    = (mComponents.count() + columns - 1) / columns;
+  Point size(pitch * columns, pitch * rows);
+  board->getPolygons().first()->getPolygon().setPath(
+      Path::rect(Point(0, 0), size));
+  QVector<BI_Device*> devices;
+  for (int i = 0; i < mComponents.count(); ++i) {
+    const Element& e = mElements.at(i % mElements.count());
+    Point pos((pitch * (i % columns)) + (pitch / 2),
+              (pitch * (i / columns)) + (pitch / 2));
+    BI_Device* device =
+        new BI_Device(*board, *mComponents.at(i), e.device, e.footprint, pos,
+                      Angle::deg0(), false);  // can throw
+    board->addDeviceInstance(*device);        // can throw
+    devices.append(device);
+  }
+
+  // connect all pads of a net signal in a chain of traces
+  GraphicsLayer* layer =
+      board->getLayerStack().getLayer(GraphicsLayer::sTopCopper);
+  Q_ASSERT(layer);
+  for (int n = 0; n < mNetSignals.count(); ++n) {
+    const QVector<Pin>& pins = mNetSignalPins.at(n);
+    if (pins.count() < 2) {
+      continue;
+    }
+    BI_NetSegment* segment = new BI_NetSegment(*board, *mNetSignals.at(n));
+    board->addNetSegment(*segment);  // can throw
+    QList<BI_NetPoint*> netpoints;
+    QList<BI_NetLine*>  netlines;
+    for (int i = 1; i < pins.count(); ++i) {
+      const Pin&       a     = pins.at(i - 1);
+      const Pin&       b     = pins.at(i);
+      BI_FootprintPad* start = devices.at(a.component)->getFootprint().getPad(
+          mElements.at(a.component % mElements.count()).pads.at(a.index));
+      BI_FootprintPad* end = devices.at(b.component)->getFootprint().getPad(
+          mElements.at(b.component % mElements.count()).pads.at(b.index));
+      Q_ASSERT(start && end);
+      Point             delta    = end->getPosition() - start->getPosition();
+      BI_NetLineAnchor* previous = start;
+      for (int s = 1; s < mOptions.traceSegments; ++s) {
+        BI_NetPoint* netpoint = new BI_NetPoint(
+            *segment, start->getPosition() +
+                          (delta * s / mOptions.traceSegments));  // can throw
+        netpoints.append(netpoint);
+        netlines.append(new BI_NetLine(*segment, *previous, *netpoint, *layer,
+                                       PositiveLength(200000)));  // can throw
+        previous = netpoint;
+      }
+      netlines.append(new BI_NetLine(*segment, *previous, *end, *layer,
+                                     PositiveLength(200000)));  // can throw
+    }
+    segment->addElements({}, netpoints, netlines);  // can throw
+    mStatistics.boardNetLines += netlines.count();
+  }
+
+  generatePlanes(*board, size);  // can throw
+}
+
+void ProjectGenerator::generatePlanes(Board& board, const Point& boardSize) {
+  int innerLayers = qMin(mOptions.planes, GraphicsLayer::getInnerLayerCount());
+  board.getLayerStack().setInnerLayerCount(innerLayers);
+  Path outline = Path::rect(Point(1000000, 1000000),
+                            boardSize - Point(1000000, 1000000));
+  for (int i = 0; i < mOptions.planes; ++i) {
+    GraphicsLayerName layer(
+        GraphicsLayer::getInnerLayerName((i % innerLayers) + 1));
+    BI_Plane* plane =
+        new BI_Plane(board, createUuid(QString("plane/%1").arg(i)), layer,
+                     *mNetSignals.at(i % mNetSignals.count()),
+                     outline);  // can throw
+    board.addPlane(*plane);     // can throw
+  }
+}
+
+Uuid ProjectGenerator::createUuid(const QString& name) const noexcept {
+  // Derive a version 4 UUID (with DCE variant) from the seed and the name.
+  QByteArray bytes = QCryptographicHash::hash(
+                         (mOptions.seed % ":" % name).toUtf8(),
+                         QCryptographicHash::Sha256)
+                         .left(16);
+  bytes[6] = (bytes.at(6) & 0x0F) | 0x40;
+  bytes[8] = (bytes.at(8) & 0x3F) | 0x80;
+  QString hex = bytes.toHex();
+  QString str = QString("%1-%2-%3-%4-%5")
+                    .arg(hex.mid(0, 8), hex.mid(8, 4), hex.mid(12, 4),
+                         hex.mid(16, 4), hex.mid(20, 12));
+  return Uuid::fromString(str);  // cannot throw since the string is valid
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace testdatagenerator
+}  // namespace librepcb
@@ -0,0 +1,159 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_TESTDATAGENERATOR_PROJECTGENERATOR_H
+#define LIBREPCB_TESTDATAGENERATOR_PROJECTGENERATOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+#include <random>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class FilePath;
+class Point;
+class TransactionalDirectory;
+
+namespace project {
+class Board;
+class ComponentInstance;
+class NetSignal;
+class Project;
+}  // namespace project
+
+namespace testdatagenerator {
+
+/*******************************************************************************
+ *  Class ProjectGenerator
+ ******************************************************************************/
+
+/**
+ * @brief Generates large synthetic libraries and projects for scale testing
+ *
+ * The generated library consists of a configurable number of elements (each
+ * one a symbol, package, component and device with 2 to 8 pins). The project
+ * contains a configurable number of components which are spread over the
+ * schematic pages, placed on a single board and connected together with
+ * randomly chosen net signals. On the board, each connection between two
+ * pads is drawn as a trace with the configured number of net lines, and the
+ * planes are distributed over the inner copper layers.
+ *
+ * The generated data only depends on the options (including the seed), so
+ * the same options always lead to the same circuit and geometry. The UUIDs
+ * of library elements and planes are derived from the seed as well, all
+ * other UUIDs are random since they are created by the project classes.
+ */
+class ProjectGenerator final {
+public:
+  // Types
+  struct Options {
+    int     libraryElements = 10;  ///< Number of library devices
+    int     components      = 100;
+    int     schematics      = 1;  ///< Number of schematic pages
+    int     planes          = 2;
+    int     traceSegments   = 3;  ///< Number of net lines per board trace
+    QString seed            = "LibrePCB";
+  };
+
+  struct Statistics {
+    int netSignals        = 0;
+    int schematicNetLines = 0;
+    int boardNetLines     = 0;
+  };
+
+  // Constructors / Destructor
+  ProjectGenerator()                              = delete;
+  ProjectGenerator(const ProjectGenerator& other) = delete;
+  explicit ProjectGenerator(const Options& options) noexcept;
+  ~ProjectGenerator() noexcept;
+
+  // Getters
+  const Statistics& getStatistics() const noexcept { return mStatistics; }
+
+  // General Methods
+
+  /**
+   * @brief Generate the library and the project
+   *
+   * @param outputDir   Empty or not existing directory where the library
+   *                    ("Generated Library.lplib") and the project
+   *                    ("Generated Project/Generated Project.lpp") are
+   *                    written to.
+   *
+   * @throw Exception if the output directory is not empty or if the files
+   *                  could not be written.
+   */
+  void generate(const FilePath& outputDir);
+
+  // Operator Overloadings
+  ProjectGenerator& operator=(const ProjectGenerator& rhs) = delete;
+
+private:  // Types
+  struct Element {
+    Uuid        symbol;
+    Uuid        package;
+    Uuid        footprint;
+    Uuid        component;
+    Uuid        symbolVariant;
+    Uuid        symbolItem;
+    Uuid        device;
+    QList<Uuid> pins;        ///< Symbol pins
+    QList<Uuid> pads;        ///< Package pads
+    QList<Uuid> cmpSignals;  ///< Component signals
+  };
+
+  struct Pin {
+    int component;
+    int index;
+  };
+
+private:  // Methods
+  void generateLibrary(TransactionalDirectory& dir, project::Project& project);
+  void generateCircuit(project::Project& project);
+  void generateSchematics(project::Project& project);
+  void generateBoard(project::Project& project);
+  void generatePlanes(project::Board& board, const Point& boardSize);
+  Uuid createUuid(const QString& name) const noexcept;
+
+private:  // Data
+  Options                              mOptions;
+  Statistics                           mStatistics;
+  std::mt19937                         mRandom;
+  QList<Element>                       mElements;
+  QVector<project::ComponentInstance*> mComponents;
+  QVector<project::NetSignal*>         mNetSignals;
+  QVector<QVector<Pin>>                mNetSignalPins;  ///< Pins of each net
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace testdatagenerator
+}  // namespace librepcb
+
+#endif  // LIBREPCB_TESTDATAGENERATOR_PROJECTGENERATOR_H
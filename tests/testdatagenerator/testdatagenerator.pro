@@ -0,0 +1,51 @@
+#-------------------------------------------------
+#
+# Project created 2026-10-14
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-testdatagenerator
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets network printsupport xml opengl sql concurrent
+
+CONFIG += console
+CONFIG -= app_bundle
+
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbproject \
+    -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
+    -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
+    -lclipper \
+    -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs \
+    ../../libs/quazip \
+    ../../libs/type_safe/include \
+    ../../libs/type_safe/external/debug_assert \
+
+DEPENDPATH += \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/quazip \
+    ../../libs/clipper \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a \
+    $${DESTDIR}/libclipper.a \
+
+SOURCES += \
+    main.cpp \
+    projectgenerator.cpp \
+
+HEADERS += \
+    projectgenerator.h \
@@ -72,6 +72,7 @@ using ASTD = AttributeSubstitutorTestData;
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(AttributeSubstitutorTest, AttributeSubstitutorTest, ::testing::Values(
     ASTD({"",                                   ""}),
+    ASTD({"No variables { at } all",            "No variables { at } all"}),
     ASTD({"Hello { World! }} {{",               "Hello { World! }} {{"}),
     ASTD({"{{NONEXISTENT}}",                    ""}),
     ASTD({"{{KEY}}",                            ""}),
@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/camnumberformatter.h>
+#include <librepcb/common/toolbox.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Data Type
+ ******************************************************************************/
+
+typedef qint64 CamNumberFormatterTestData;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class CamNumberFormatterTest
+  : public ::testing::TestWithParam<CamNumberFormatterTestData> {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_P(CamNumberFormatterTest, testAppendInteger) {
+  const CamNumberFormatterTestData& data = GetParam();
+
+  QByteArray output = "X";
+  CamNumberFormatter::appendInteger(output, data);
+  EXPECT_EQ("X" + QByteArray::number(data), output);
+}
+
+TEST_P(CamNumberFormatterTest, testAppendDecimal) {
+  const CamNumberFormatterTestData& data = GetParam();
+
+  for (int pointPos : {1, 3, 6}) {
+    QByteArray output = "X";
+    CamNumberFormatter::appendDecimal(output, data, pointPos);
+    EXPECT_EQ(
+        "X" + Toolbox::decimalFixedPointToString<qint64>(data, pointPos),
+        QString::fromLatin1(output));
+  }
+}
+
+/*******************************************************************************
+ *  Test Data
+ ******************************************************************************/
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(CamNumberFormatterTest, CamNumberFormatterTest, ::testing::Values(
+    CamNumberFormatterTestData(0),
+    CamNumberFormatterTestData(1),
+    CamNumberFormatterTestData(-1),
+    CamNumberFormatterTestData(10),
+    CamNumberFormatterTestData(-500),
+    CamNumberFormatterTestData(1000000),
+    CamNumberFormatterTestData(1500000),
+    CamNumberFormatterTestData(-1234567890123),
+    CamNumberFormatterTestData(std::numeric_limits<qint64>::max()),
+    CamNumberFormatterTestData(std::numeric_limits<qint64>::min())
+));
+// clang-format on
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,125 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/excellongenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ExcellonGeneratorTest : public ::testing::Test {
+protected:
+  static QList<QByteArray> getHits(const ExcellonGenerator& gen) noexcept {
+    QList<QByteArray> hits;
+    foreach (const QByteArray& line, gen.toByteArray().split('\n')) {
+      if (line.startsWith('X') || line.startsWith('T')) {
+        hits.append(line);
+      }
+    }
+    return hits;
+  }
+
+  static QByteArray hit(int x, int y) noexcept {
+    return QString("X%1.0Y%2.0").arg(x).arg(y).toLatin1();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ExcellonGeneratorTest, testOptimizedDrillOrder) {
+  ExcellonGenerator gen;
+  gen.setOptimizeDrillOrder(true);
+  foreach (int x, QList<int>({3, 1, 4, 2, 0})) {
+    gen.drill(Point::fromMm(x, 0), PositiveLength(1000000));
+  }
+  foreach (int x, QList<int>({0, 5})) {
+    gen.drill(Point::fromMm(x, 1), PositiveLength(2000000));
+  }
+  gen.generate();
+
+  // The first tool starts at the origin, the second one at the last hit of
+  // the first tool.
+  QList<QByteArray> expected;
+  expected << "T1C1.0"
+           << "T2C2.0";
+  expected << "T1" << hit(0, 0) << hit(1, 0) << hit(2, 0) << hit(3, 0)
+           << hit(4, 0);
+  expected << "T2" << hit(5, 1) << hit(0, 1);
+  expected << "T0";
+  EXPECT_EQ(expected, getHits(gen));
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizedDrillOrderKeepsAllHits) {
+  ExcellonGenerator unordered;
+  ExcellonGenerator optimized;
+  optimized.setOptimizeDrillOrder(true);
+  for (int i = 0; i < 1000; ++i) {
+    Point          pos(Length((i * 7919) % 1000) * 100000,
+                       Length((i * 4567) % 1000) * 100000);
+    PositiveLength dia((1 + (i % 3)) * 300000);
+    unordered.drill(pos, dia);
+    optimized.drill(pos, dia);
+    if (i % 100 == 0) {
+      unordered.drill(pos, dia);  // duplicate hit
+      optimized.drill(pos, dia);
+    }
+  }
+  unordered.generate();
+  optimized.generate();
+  QList<QByteArray> unorderedHits = getHits(unordered);
+  QList<QByteArray> optimizedHits = getHits(optimized);
+  EXPECT_NE(unorderedHits, optimizedHits);
+  std::sort(unorderedHits.begin(), unorderedHits.end());
+  std::sort(optimizedHits.begin(), optimizedHits.end());
+  EXPECT_EQ(unorderedHits, optimizedHits);
+}
+
+TEST_F(ExcellonGeneratorTest, testStepAndRepeat) {
+  ExcellonGenerator gen;
+  gen.setStepAndRepeat(2, 2, Point::fromMm(10, 20));
+  gen.drill(Point::fromMm(1, 1), PositiveLength(1000000));
+  gen.generate();
+
+  QList<QByteArray> expected;
+  expected << "T1C1.0";
+  expected << "T1" << hit(1, 1) << hit(11, 1) << hit(1, 21) << hit(11, 21);
+  expected << "T0";
+  EXPECT_EQ(expected, getHits(gen));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,125 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/pathtrie.h>
+#include <librepcb/common/toolbox.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST(PathTrieTest, testInsertAndRemove) {
+  PathTrie trie;
+  EXPECT_TRUE(trie.isEmpty());
+  EXPECT_TRUE(trie.insert("a/b/c.txt"));
+  EXPECT_FALSE(trie.insert("a//b/c.txt/"));  // same path
+  EXPECT_TRUE(trie.insert("a/d.txt"));
+  EXPECT_EQ(2, trie.count());
+  EXPECT_TRUE(trie.contains("a/b/c.txt"));
+  EXPECT_FALSE(trie.contains("a/b"));  // only a parent directory
+  EXPECT_FALSE(trie.contains("a/b/c"));
+
+  EXPECT_FALSE(trie.remove("a/b"));
+  EXPECT_TRUE(trie.remove("a/b/c.txt"));
+  EXPECT_FALSE(trie.contains("a/b/c.txt"));
+  EXPECT_EQ(QStringList(), trie.getDirs("a"));  // empty "b" is pruned
+  EXPECT_TRUE(trie.remove("a/d.txt"));
+  EXPECT_TRUE(trie.isEmpty());
+  EXPECT_EQ(QStringList(), trie.getPaths());
+}
+
+TEST(PathTrieTest, testContainsPathOrParent) {
+  PathTrie trie;
+  EXPECT_FALSE(trie.containsPathOrParent("a"));
+  trie.insert("a/b");
+  EXPECT_FALSE(trie.containsPathOrParent("a"));
+  EXPECT_TRUE(trie.containsPathOrParent("a/b"));
+  EXPECT_TRUE(trie.containsPathOrParent("a/b/"));
+  EXPECT_TRUE(trie.containsPathOrParent("a/b/c/d.txt"));
+  EXPECT_FALSE(trie.containsPathOrParent("a/bc"));
+  EXPECT_FALSE(trie.containsPathOrParent("x/a/b"));
+
+  // the root directory contains everything
+  trie.insert("");
+  EXPECT_TRUE(trie.containsPathOrParent("x/a/b"));
+  EXPECT_TRUE(trie.containsPathOrParent(""));
+}
+
+TEST(PathTrieTest, testListing) {
+  PathTrie trie;
+  trie.insert("1.txt");
+  trie.insert("a/2.txt");
+  trie.insert("a/b/3.txt");
+  trie.insert("a/c/4.txt");
+  EXPECT_EQ(QStringList({"a"}), Toolbox::sorted(trie.getDirs("")));
+  EXPECT_EQ(QStringList({"1.txt"}), Toolbox::sorted(trie.getFiles("")));
+  EXPECT_EQ(QStringList({"b", "c"}), Toolbox::sorted(trie.getDirs("a/")));
+  EXPECT_EQ(QStringList({"2.txt"}), Toolbox::sorted(trie.getFiles("a/")));
+  EXPECT_EQ(QStringList(), trie.getDirs("x"));
+  EXPECT_EQ(QStringList(), trie.getFiles("x"));
+  EXPECT_EQ(QStringList({"a/2.txt", "a/b/3.txt", "a/c/4.txt"}),
+            Toolbox::sorted(trie.getPaths("a")));
+}
+
+TEST(PathTrieTest, testRemoveRecursively) {
+  PathTrie trie;
+  trie.insert("1.txt");
+  trie.insert("a/2.txt");
+  trie.insert("a/b/3.txt");
+  trie.insert("ab/4.txt");
+  EXPECT_EQ(QStringList({"a/2.txt", "a/b/3.txt"}),
+            Toolbox::sorted(trie.removeRecursively("a")));
+  EXPECT_EQ(QStringList({"1.txt", "ab/4.txt"}),
+            Toolbox::sorted(trie.getPaths()));
+  EXPECT_EQ(2, trie.count());
+  EXPECT_EQ(QStringList({"1.txt", "ab/4.txt"}),
+            Toolbox::sorted(trie.removeRecursively("")));
+  EXPECT_TRUE(trie.isEmpty());
+}
+
+TEST(PathTrieTest, testCopiesAreIndependent) {
+  PathTrie trie;
+  trie.insert("a/1.txt");
+  PathTrie copy(trie);
+  trie.insert("a/2.txt");
+  copy.remove("a/1.txt");
+  EXPECT_EQ(QStringList({"a/1.txt", "a/2.txt"}),
+            Toolbox::sorted(trie.getPaths()));
+  EXPECT_TRUE(copy.isEmpty());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -161,6 +161,51 @@ TEST_F(SerializableObjectListTest, testIndexOfName) {
   EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfInBigList) {
+  List l;
+  for (int i = 0; i < 100; ++i) {
+    l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+  }
+  std::shared_ptr<Mock> obj = l.value(50);
+  EXPECT_EQ(50, l.indexOf(obj.get()));
+  EXPECT_EQ(50, l.indexOf(obj->mUuid));
+  EXPECT_EQ(50, l.indexOf(QString("50")));
+  EXPECT_EQ(-1, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(-1, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(-1, l.indexOf(QString("foo")));
+
+  // append
+  l.append(mMocks[0]);
+  EXPECT_EQ(100, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(100, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(100, l.indexOf(mMocks[0]->mName));
+
+  // insert
+  l.insert(10, mMocks[1]);
+  EXPECT_EQ(10, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(51, l.indexOf(obj.get()));
+  EXPECT_EQ(51, l.indexOf(obj->mUuid));
+  EXPECT_EQ(51, l.indexOf(QString("50")));
+
+  // remove
+  l.remove(0);
+  EXPECT_EQ(9, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(50, l.indexOf(obj->mUuid));
+
+  // swap
+  l.swap(9, 50);
+  EXPECT_EQ(50, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(9, l.indexOf(obj->mUuid));
+
+  // duplicate names return the first element
+  l.append(mMocks[2]);
+  mMocks[2]->mName = "foo";
+  mMocks[2]->onEdited.notify();
+  EXPECT_EQ(l.indexOf(mMocks[0].get()), l.indexOf(QString("foo")));
+  l.remove(mMocks[0].get());
+  EXPECT_EQ(l.count() - 1, l.indexOf(QString("foo")));
+}
+
 TEST_F(SerializableObjectListTest, testContainsPointer) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   EXPECT_TRUE(l.contains(mMocks[0].get()));
@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexpressioncache.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SExpressionCacheTest : public ::testing::Test {
+protected:
+  FilePath                                 mTmpDir;
+  std::shared_ptr<TransactionalFileSystem> mFileSystem;
+  QScopedPointer<SExpressionCache>         mCache;
+
+  SExpressionCacheTest() {
+    mTmpDir = FilePath::getRandomTempPath();
+    FileUtils::writeFile(mTmpDir.getPathTo("files/a.lp"), "(root (value 1))");
+    mFileSystem = TransactionalFileSystem::openRO(mTmpDir.getPathTo("files"));
+    mCache.reset(new SExpressionCache(mTmpDir.getPathTo("cache")));
+  }
+
+  virtual ~SExpressionCacheTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  int parseValue() const {
+    TransactionalDirectory dir(mFileSystem);
+    return mCache->parse(dir, "a.lp").getValueByPath<int>("value");
+  }
+
+  int countCacheFiles() const noexcept {
+    int          count = 0;
+    QDirIterator it(mCache->getDirectory().toStr(), QDir::Files,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+      it.next();
+      ++count;
+    }
+    return count;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SExpressionCacheTest, testParseCachedFile) {
+  EXPECT_EQ(1, parseValue());
+  EXPECT_EQ(1, countCacheFiles());
+  EXPECT_EQ(1, parseValue());
+  EXPECT_EQ(1, countCacheFiles());
+}
+
+TEST_F(SExpressionCacheTest, testModifiedFileReplacesCacheFile) {
+  EXPECT_EQ(1, parseValue());
+  FileUtils::writeFile(mTmpDir.getPathTo("files/a.lp"), "(root (value 22))");
+  EXPECT_EQ(22, parseValue());
+  EXPECT_EQ(1, countCacheFiles());
+}
+
+TEST_F(SExpressionCacheTest, testFileModifiedInMemory) {
+  EXPECT_EQ(1, parseValue());
+  mFileSystem->write("a.lp", "(root (value 3))");
+  EXPECT_EQ(3, parseValue());
+  EXPECT_EQ(1, countCacheFiles());
+}
+
+TEST_F(SExpressionCacheTest, testInvalidCacheFile) {
+  EXPECT_EQ(1, parseValue());
+  QDirIterator it(mCache->getDirectory().toStr(), QDir::Files,
+                  QDirIterator::Subdirectories);
+  ASSERT_TRUE(it.hasNext());
+  FileUtils::writeFile(FilePath(it.next()), "invalid");
+  EXPECT_EQ(1, parseValue());
+  EXPECT_EQ(1, parseValue());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
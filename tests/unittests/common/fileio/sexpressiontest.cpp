@@ -0,0 +1,323 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexpression.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SExpressionTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SExpressionTest, testParseNestedLists) {
+  QByteArray  content = "(root foo\n (child \"bar\" 42)\n (other)\n)\n";
+  SExpression root    = SExpression::parse(content, FilePath());
+  EXPECT_TRUE(root.isList());
+  EXPECT_EQ("root", root.getName());
+  ASSERT_EQ(3, root.getChildren().count());
+  EXPECT_TRUE(root.getChildByIndex(0).isToken());
+  EXPECT_EQ("foo", root.getChildByIndex(0).getStringOrToken());
+  EXPECT_EQ(1, root.getChildren("child").count());
+  EXPECT_EQ(0, root.getChildByPath("other").getChildren().count());
+  const SExpression& child = root.getChildByPath("child");
+  ASSERT_EQ(2, child.getChildren().count());
+  EXPECT_TRUE(child.getChildByIndex(0).isString());
+  EXPECT_EQ("bar", child.getValueOfFirstChild<QString>());
+  EXPECT_EQ(42, child.getChildByIndex(1).getValue<int>());
+}
+
+TEST_F(SExpressionTest, testParseComments) {
+  QByteArray  content = "; comment\n(root ; another comment\n foo)\n";
+  SExpression root    = SExpression::parse(content, FilePath());
+  EXPECT_EQ("root", root.getName());
+  ASSERT_EQ(1, root.getChildren().count());
+  EXPECT_EQ("foo", root.getValueOfFirstChild<QString>());
+}
+
+TEST_F(SExpressionTest, testParseUtf8AndEscapeSequences) {
+  QByteArray  content = "(root \"\xC3\xA4 \\\"x\\\" \\\\ \\n \\t\")";
+  SExpression root    = SExpression::parse(content, FilePath());
+  EXPECT_EQ(QString::fromUtf8("\xC3\xA4 \"x\" \\ \n \t"),
+            root.getValueOfFirstChild<QString>());
+}
+
+TEST_F(SExpressionTest, testSerializeAndParseAgain) {
+  QString     value = QString::fromUtf8("\xC3\xA4 \"x\" \\ ( ) ; \n \t");
+  SExpression root  = SExpression::createList("root");
+  root.appendChild("child", value, true);
+  root.appendChild("token", 42, true);
+  SExpression parsed = SExpression::parse(root.toByteArray(), FilePath());
+  EXPECT_EQ(value, parsed.getValueByPath<QString>("child"));
+  EXPECT_EQ(42, parsed.getValueByPath<int>("token"));
+}
+
+TEST_F(SExpressionTest, testSerialize) {
+  SExpression root = SExpression::createList("root");
+  root.appendChild("name", QString("Foo \"Bar\""), false);
+  SExpression& child = root.appendList("child", true);
+  child.appendChild("pos", SExpression::createToken("1.5"), false);
+  child.appendChild("sub", SExpression::createToken("x"), true);
+  root.appendList("empty", true);
+  root.appendLineBreak();
+  root.appendLineBreak();
+  EXPECT_EQ(
+      "(root (name \"Foo \\\"Bar\\\"\")\n"
+      " (child (pos 1.5)\n"
+      "  (sub x)\n"
+      " )\n"
+      " (empty)\n"
+      "\n"
+      ")\n",
+      root.toByteArray().toStdString());
+}
+
+TEST_F(SExpressionTest, testSerializeEscapeSequences) {
+  QString     value = QString::fromUtf8("\xC3\xA4 \"x\" \\ 'y'? \n \t");
+  SExpression root  = SExpression::createList("root");
+  root.appendChild(value);
+  QByteArray content = root.toByteArray();
+  EXPECT_EQ("(root \"\xC3\xA4 \\\"x\\\" \\\\ \\'y\\'\\? \\n \\t\")\n",
+            content.toStdString());
+
+  // parse again
+  SExpression parsed = SExpression::parse(content, FilePath());
+  EXPECT_EQ(value, parsed.getValueOfFirstChild<QString>());
+}
+
+TEST_F(SExpressionTest, testSerializeInvalidToken) {
+  SExpression root = SExpression::createList("root");
+  root.appendChild(SExpression::createToken("foo bar"), false);
+  EXPECT_THROW(root.toByteArray(), LogicError);
+}
+
+TEST_F(SExpressionTest, testGetChildrenByNameWithManyChildren) {
+  SExpression root = SExpression::createList("root");
+  for (int i = 0; i < 50; ++i) {
+    root.appendChild((i % 2) ? "odd" : "even", i, true);
+  }
+  QList<const SExpression*> odd = root.getChildren("odd");
+  ASSERT_EQ(25, odd.count());
+  EXPECT_EQ(1, odd.first()->getValueOfFirstChild<int>());
+  EXPECT_EQ(49, odd.last()->getValueOfFirstChild<int>());
+  EXPECT_EQ(48, root.getValueByPath<int>("even"));  // last one wins
+  EXPECT_EQ(nullptr, root.tryGetChildByPath("none"));
+
+  // modifying the node must update the index
+  root.appendChild("none", 42, true);
+  EXPECT_EQ(42, root.getValueByPath<int>("none"));
+  EXPECT_EQ(25, root.getChildren("even").count());
+  root.removeLineBreaks();
+  EXPECT_EQ(42, root.getValueByPath<int>("none"));
+  EXPECT_EQ(25, root.getChildren("odd").count());
+}
+
+TEST_F(SExpressionTest, testConcurrentLookupsInSharedNode) {
+  QByteArray content = "(root\n";
+  for (int i = 0; i < 100; ++i) {
+    content += QString(" (child%1 %1)\n").arg(i % 10).toUtf8();
+  }
+  content += ")\n";
+  const SExpression parsed = SExpression::parse(content, FilePath());
+
+  // copies share their children, so lookups in all threads read the very same
+  // nodes and their indices
+  QList<QFuture<int>> futures;
+  for (int i = 0; i < 8; ++i) {
+    const SExpression copy = parsed;
+    futures.append(QtConcurrent::run([copy]() {
+      int count = 0;
+      for (int k = 0; k < 1000; ++k) {
+        count += copy.getChildren(QString("child%1").arg(k % 10)).count();
+      }
+      return count;
+    }));
+  }
+  for (QFuture<int>& future : futures) {
+    EXPECT_EQ(10000, future.result());
+  }
+  EXPECT_EQ(99, parsed.getValueByPath<int>("child9"));
+}
+
+TEST_F(SExpressionTest, testAppendMovedChild) {
+  SExpression child = SExpression::createList("child");
+  child.appendChild("value", 42, false);
+  const QString* name     = &child.getChildByIndex(0).getName();
+  SExpression    root     = SExpression::createList("root");
+  SExpression&   appended = root.appendChild(std::move(child), true);
+  EXPECT_EQ(name, &appended.getChildByIndex(0).getName());  // not copied
+  EXPECT_EQ(42, root.getValueByPath<int>("child/value"));
+  EXPECT_EQ("(root\n (child (value 42))\n)\n",
+            root.toByteArray().toStdString());
+}
+
+TEST_F(SExpressionTest, testGetChildByNestedPath) {
+  SExpression root = SExpression::parse("(a (b (c 1)) (b (c 2)))", FilePath());
+  EXPECT_EQ(2, root.getValueByPath<int>("b/c"));
+  EXPECT_EQ(nullptr, root.tryGetChildByPath("b/d"));
+  EXPECT_EQ(nullptr, root.tryGetChildByPath("b/"));
+}
+
+TEST_F(SExpressionTest, testParseInternsNamesAndTokens) {
+  SExpression root1 = SExpression::parse("(root (layer top))", FilePath());
+  SExpression root2 = SExpression::parse("(root (layer top))", FilePath());
+  const SExpression& layer1 = root1.getChildByPath("layer");
+  const SExpression& layer2 = root2.getChildByPath("layer");
+  EXPECT_EQ(layer1.getName().constData(), layer2.getName().constData());
+  EXPECT_EQ(layer1.getChildByIndex(0).getStringOrToken().constData(),
+            layer2.getChildByIndex(0).getStringOrToken().constData());
+  EXPECT_EQ(layer1.getName().constData(),
+            SExpression::intern("layer").constData());
+}
+
+TEST_F(SExpressionTest, testBinaryRoundTrip) {
+  QByteArray content =
+      "(root foo\n (child \"b\\\"a\\\\r\" 42)\n (child \"\")\n (other)\n)\n";
+  SExpression root   = SExpression::parse(content, FilePath());
+  SExpression parsed = SExpression::parseBinary(root.toBinary(), FilePath());
+  EXPECT_EQ(root.toByteArray().toStdString(),
+            parsed.toByteArray().toStdString());
+  EXPECT_TRUE(parsed.getChildByIndex(0).isToken());
+  EXPECT_TRUE(parsed.getChildByPath("child").getChildByIndex(0).isString());
+}
+
+TEST_F(SExpressionTest, testParseInvalidBinary) {
+  SExpression root   = SExpression::parse("(root (child 42))", FilePath());
+  QByteArray  binary = root.toBinary();
+  EXPECT_THROW(SExpression::parseBinary(QByteArray(), FilePath()),
+               FileParseError);
+  EXPECT_THROW(SExpression::parseBinary(binary.left(binary.size() - 1),
+                                        FilePath()),
+               FileParseError);
+  EXPECT_THROW(SExpression::parseBinary(binary + "x", FilePath()),
+               FileParseError);
+}
+
+TEST_F(SExpressionTest, testParseEmptyContent) {
+  EXPECT_THROW(SExpression::parse("", FilePath()), FileParseError);
+  EXPECT_THROW(SExpression::parse(" \n ", FilePath()), FileParseError);
+}
+
+TEST_F(SExpressionTest, testParseMultipleRootNodes) {
+  EXPECT_THROW(SExpression::parse("(foo) (bar)", FilePath()), FileParseError);
+}
+
+TEST_F(SExpressionTest, testParseListWithoutName) {
+  EXPECT_THROW(SExpression::parse("(root ())", FilePath()), FileParseError);
+}
+
+TEST_F(SExpressionTest, testParseInvalidEscapeSequence) {
+  EXPECT_THROW(SExpression::parse("(root \"\\x\")", FilePath()),
+               FileParseError);
+}
+
+TEST_F(SExpressionTest, testParseErrorContainsLineAndColumn) {
+  try {
+    SExpression::parse("(root\n  (child\n    \"unterminated)\n)", FilePath());
+    FAIL() << "No exception thrown.";
+  } catch (const FileParseError& e) {
+    EXPECT_TRUE(e.getMsg().contains("Line,Column: 3,5")) << qPrintable(
+        e.getMsg());
+  }
+}
+
+TEST_F(SExpressionTest, testParseUnclosedListReportsOpeningPosition) {
+  try {
+    SExpression::parse("(root\n  (child foo)\n", FilePath());
+    FAIL() << "No exception thrown.";
+  } catch (const FileParseError& e) {
+    EXPECT_TRUE(e.getMsg().contains("Line,Column: 1,1")) << qPrintable(
+        e.getMsg());
+  }
+}
+
+TEST_F(SExpressionTest, testParseParallel) {
+  QByteArray content = "(root\n";
+  for (int i = 0; content.size() < 3 * 1024 * 1024; ++i) {
+    content += " (child " + QByteArray::number(i) +
+        " \"(str\\\"ing)\" ; comment (\n  (nested (a) (b \"\n\")))\n";
+  }
+  content += ")\n";
+  SExpression sequential = SExpression::parse(content, FilePath());
+  SExpression parallel   = SExpression::parse(content, FilePath(), true);
+  EXPECT_EQ(sequential.toByteArray().toStdString(),
+            parallel.toByteArray().toStdString());
+}
+
+TEST_F(SExpressionTest, testParseParallelErrorContainsLineAndColumn) {
+  QByteArray content = "(root\n";
+  for (int i = 0; content.size() < 3 * 1024 * 1024; ++i) {
+    content += " (child " + QByteArray::number(i) + ")\n";
+  }
+  content += " (child \"\\x\")\n)\n";
+  int line = content.count('\n') - 1;
+  try {
+    SExpression::parse(content, FilePath(), true);
+    FAIL() << "No exception thrown.";
+  } catch (const FileParseError& e) {
+    EXPECT_TRUE(e.getMsg().contains(QString("Line,Column: %1,11").arg(line)))
+        << qPrintable(e.getMsg());
+  }
+}
+
+TEST_F(SExpressionTest, testParsePartially) {
+  QByteArray content =
+      "(root 42 \"str\"\n"
+      " (keep 1)\n"
+      " (skip (nested \"(\\\"\") ; comment (\n ))\n"
+      " (keep 2 (nested 3))\n"
+      ")\n";
+  SExpression root = SExpression::parsePartially(content, FilePath(), {"keep"});
+  ASSERT_EQ(4, root.getChildren().count());
+  EXPECT_EQ(42, root.getChildByIndex(0).getValue<int>());
+  EXPECT_EQ("str", root.getChildByIndex(1).getValue<QString>());
+  EXPECT_EQ(2, root.getChildren("keep").count());
+  EXPECT_EQ(0, root.getChildren("skip").count());
+  EXPECT_EQ(3, root.getValueByPath<int>("keep/nested"));
+}
+
+TEST_F(SExpressionTest, testParsePartiallyUnclosedSkippedList) {
+  EXPECT_THROW(SExpression::parsePartially("(root (skip (a)", FilePath(),
+                                           {"keep"}),
+               FileParseError);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
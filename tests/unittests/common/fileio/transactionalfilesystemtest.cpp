@@ -25,6 +25,9 @@
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -155,6 +158,71 @@ TEST_F(TransactionalFileSystemTest, testWriteIsDelayedUntilSave) {
   EXPECT_EQ("content", FileUtils::readFile(fp));
 }
 
+TEST_F(TransactionalFileSystemTest, testMapReadOnly) {
+  TransactionalFileSystem fs(mPopulatedDir, false);
+  std::unique_ptr<const MappedFile> file = fs.map("1/1a.txt");
+  EXPECT_TRUE(file->isMapped());
+  EXPECT_EQ("1a", file->getContent());
+  EXPECT_THROW(fs.map("nonexisting.txt"), Exception);
+}
+
+TEST_F(TransactionalFileSystemTest, testMapWritable) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1/1a.txt", "modified");
+  fs.removeFile("1/1b.txt");
+  std::unique_ptr<const MappedFile> file = fs.map("1/1a.txt");
+  EXPECT_FALSE(file->isMapped());
+  EXPECT_EQ("modified", file->getContent());
+  EXPECT_EQ("4", fs.map("1/2/3/4.txt")->getContent());
+  EXPECT_THROW(fs.map("1/1b.txt"), Exception);
+}
+
+TEST_F(TransactionalFileSystemTest, testWriteUnmodifiedContentIsDropped) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("1", fs.read("1.txt"));
+  fs.write("1.txt", "modified");
+  fs.write("1.txt", "1");  // same content as on disk
+  fs.write("2.txt", "modified");
+  fs.autosave();
+  QByteArray index =
+      FileUtils::readFile(mPopulatedDir.getPathTo(".autosave/autosave.lp"));
+  EXPECT_FALSE(index.contains("\"1.txt\"")) << index.toStdString();
+  EXPECT_TRUE(index.contains("\"2.txt\"")) << index.toStdString();
+  EXPECT_EQ("1", fs.read("1.txt"));
+
+  // after saving, the saved content is known to be on disk
+  fs.save();
+  fs.write("2.txt", "modified");
+  fs.autosave();
+  index = FileUtils::readFile(mPopulatedDir.getPathTo(".autosave/autosave.lp"));
+  EXPECT_FALSE(index.contains("\"2.txt\"")) << index.toStdString();
+}
+
+TEST_F(TransactionalFileSystemTest, testBigModifiedFilesAreCompressed) {
+  QByteArray content;
+  for (int i = 0; i < 10000; ++i) {
+    content.append(QString(" (vertex (position %1 0.0) (angle 0.0))\n")
+                       .arg(i)
+                       .toUtf8());
+  }
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("big.lp", content);
+  fs.write("small.lp", "(small)");
+  EXPECT_LT(fs.getMemoryUsage(), content.size() / 2);
+  EXPECT_EQ(content, fs.read("big.lp"));
+  EXPECT_EQ(content, fs.map("big.lp")->getContent());
+  EXPECT_EQ("(small)", fs.read("small.lp"));
+
+  // the autosave backup and the saved files contain the uncompressed content
+  fs.autosave();
+  TransactionalFileSystem restored(mPopulatedDir, false,
+                                   TransactionalFileSystem::RestoreMode::YES);
+  EXPECT_EQ(content, restored.read("big.lp"));
+  fs.save();
+  EXPECT_EQ(content, FileUtils::readFile(mPopulatedDir.getPathTo("big.lp")));
+  EXPECT_EQ(content, fs.read("big.lp"));
+}
+
 TEST_F(TransactionalFileSystemTest, testRemoveExistingFile) {
   FilePath                fp = mPopulatedDir.getPathTo("1/1a.txt");
   TransactionalFileSystem fs(mPopulatedDir, true);
@@ -434,6 +502,25 @@ TEST_F(TransactionalFileSystemTest, testAutosaveIsRemovedInDestructor) {
   EXPECT_FALSE(fp.isExistingDir());
 }
 
+TEST_F(TransactionalFileSystemTest, testStartAutosaveUsesSnapshot) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "snapshot");
+  QFuture<void> future = fs.startAutosave();
+  fs.write("1.txt", "modified");  // must not affect the running autosave
+  fs.write("new.txt", "new");     // must not affect the running autosave
+  future.waitForFinished();
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              TransactionalFileSystem::RestoreMode::YES);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_EQ("snapshot", fs2.read("1.txt"));
+  EXPECT_FALSE(fs2.fileExists("new.txt"));
+}
+
 TEST_F(TransactionalFileSystemTest, testRestoreAutosave) {
   TransactionalFileSystem fs(mPopulatedDir, true);
 
@@ -598,6 +685,103 @@ TEST_F(TransactionalFileSystemTest, testExportToZip) {
   EXPECT_TRUE(zipFp.isExistingFile());
 }
 
+TEST_F(TransactionalFileSystemTest, testLoadFromZip) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem(mPopulatedDir, false).exportToZip(zipFp);
+
+  TransactionalFileSystem fs(mEmptyDir, false);
+  fs.loadFromZip(zipFp);
+  EXPECT_TRUE(fs.fileExists("1/2/3/4.txt"));
+  EXPECT_TRUE(fs.getDirs().contains("foo dir"));
+  EXPECT_TRUE(fs.getFiles("foo dir").contains("bar dir.txt"));
+  EXPECT_EQ("bar", fs.read("foo dir/bar dir.txt"));
+  EXPECT_EQ("4", fs.map("1/2/3/4.txt")->getContent());
+  EXPECT_FALSE(fs.fileExists(".dot/file.txt"));  // dotdirs are not exported
+  EXPECT_FALSE(mEmptyDir.getPathTo("1.txt").isExistingFile());
+}
+
+TEST_F(TransactionalFileSystemTest, testExportToZipParallel) {
+  FilePath                zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem srcFs(mPopulatedDir, false);
+  srcFs.write("1/1a.txt", QByteArray(100000, 'x'));
+  srcFs.write("1/empty.txt", QByteArray());
+  srcFs.exportToZip(zipFp, true);
+
+  TransactionalFileSystem fs(mEmptyDir, false);
+  fs.loadFromZip(zipFp);
+  EXPECT_EQ(QByteArray(100000, 'x'), fs.read("1/1a.txt"));
+  EXPECT_EQ(QByteArray(), fs.read("1/empty.txt"));
+  EXPECT_EQ("1b", fs.read("1/1b.txt"));
+  EXPECT_EQ("X", fs.read("foo dir/bar dir/X"));
+}
+
+TEST_F(TransactionalFileSystemTest, testExportToLoadedZip) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem(mPopulatedDir, false).exportToZip(zipFp);
+
+  {
+    TransactionalFileSystem fs(mEmptyDir, false);
+    fs.loadFromZip(zipFp);
+    fs.write("1.txt", "modified");
+    fs.removeDirRecursively("a");
+    fs.exportToZip(zipFp);  // overwrites the loaded ZIP file
+  }
+
+  TransactionalFileSystem fs(mEmptyDir, false);
+  fs.loadFromZip(zipFp);
+  EXPECT_EQ("modified", fs.read("1.txt"));
+  EXPECT_EQ("2", fs.read("2.txt"));  // copied without recompressing
+  EXPECT_EQ("X", fs.read("foo dir/bar dir/X"));
+  EXPECT_FALSE(fs.fileExists("a/b/c"));
+  EXPECT_FALSE(mTmpDir.getPathTo("export.zip.tmp").isExistingFile());
+}
+
+TEST_F(TransactionalFileSystemTest, testReadAfterExportToLoadedZip) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem(mPopulatedDir, false).exportToZip(zipFp);
+
+  TransactionalFileSystem fs(mEmptyDir, false);
+  fs.loadFromZip(zipFp);
+  fs.write("1.txt", "modified");
+  fs.exportToZip(zipFp);  // entries are at different positions afterwards
+  EXPECT_EQ("modified", fs.read("1.txt"));
+  EXPECT_EQ("2", fs.read("2.txt"));
+  EXPECT_EQ("X", fs.read("foo dir/bar dir/X"));
+}
+
+TEST_F(TransactionalFileSystemTest, testLoadFromZipIntoDirectory) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem(mPopulatedDir, false).exportToZip(zipFp);
+
+  TransactionalFileSystem fs(mPopulatedDir, false);
+  fs.loadFromZip(zipFp, "foo dir/zip");
+  EXPECT_EQ("4", fs.read("foo dir/zip/1/2/3/4.txt"));
+  EXPECT_EQ("bar", fs.read("foo dir/zip/foo dir/bar dir.txt"));
+  EXPECT_EQ("bar", fs.read("foo dir/bar dir.txt"));  // file on disk
+  EXPECT_TRUE(fs.getDirs("foo dir").contains("zip"));
+  EXPECT_TRUE(fs.getFiles("foo dir/zip").contains("1.txt"));
+}
+
+TEST_F(TransactionalFileSystemTest, testLoadFromZipReadInParallel) {
+  FilePath                zipFp = mTmpDir.getPathTo("export.zip");
+  TransactionalFileSystem srcFs(mEmptyDir, false);
+  for (int i = 0; i < 100; ++i) {
+    srcFs.write(QString("dir/%1.txt").arg(i), QByteArray::number(i));
+  }
+  srcFs.exportToZip(zipFp);
+
+  TransactionalFileSystem fs(mEmptyDir, false);
+  fs.loadFromZip(zipFp);
+  QList<QFuture<QByteArray>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.append(QtConcurrent::run(
+        [&fs, i]() { return fs.read(QString("dir/%1.txt").arg(i)); }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(QByteArray::number(i), futures[i].result());
+  }
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
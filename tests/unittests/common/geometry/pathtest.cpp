@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/toolbox.h>
 
 /*******************************************************************************
  *  Namespace
@@ -77,6 +78,139 @@ TEST_F(PathTest, testCircle) {
   EXPECT_TRUE(path.isClosed());
 }
 
+TEST_F(PathTest, testRotateIsSameAsRotatingEachVertex) {
+  Path  path = Path::obround(PositiveLength(3000000), PositiveLength(1000000));
+  Point center(Length(123456), Length(-654321));
+  QVector<Angle> angles = {Angle::deg0(),  Angle::deg90(), -Angle::deg90(),
+                           Angle::deg180(), Angle::deg270(), Angle(12345678),
+                           Angle(-98765432)};
+  foreach (const Angle& angle, angles) {
+    Path rotated = path.rotated(angle, center);
+    ASSERT_EQ(path.getVertices().count(), rotated.getVertices().count());
+    for (int i = 0; i < path.getVertices().count(); ++i) {
+      EXPECT_EQ(path.getVertices().at(i).getPos().rotated(angle, center),
+                rotated.getVertices().at(i).getPos());
+    }
+  }
+}
+
+TEST_F(PathTest, testFlatArcIsSameAsRotatingStartPoint) {
+  Point          p1(Length(1000000), Length(500000));
+  Point          p2(Length(-2000000), Length(-300000));
+  PositiveLength tolerance(5000);
+  QVector<Angle> angles = {Angle::deg90(), -Angle::deg180(), Angle(12345678),
+                           Angle(-98765432)};
+  foreach (const Angle& angle, angles) {
+    // calculate twice to test both the uncached and the cached version
+    for (int run = 0; run < 2; ++run) {
+      Path  path   = Path::flatArc(p1, p2, angle, tolerance);
+      Point center = Toolbox::arcCenter(p1, p2, angle);
+      int   steps  = path.getVertices().count() - 1;
+      ASSERT_GT(steps, 1);
+      EXPECT_EQ(p1, path.getVertices().first().getPos());
+      EXPECT_EQ(p2, path.getVertices().last().getPos());
+      qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
+      for (int i = 1; i < steps; ++i) {
+        EXPECT_EQ(p1.rotated(Angle(angleDelta * i), center),
+                  path.getVertices().at(i).getPos());
+      }
+    }
+  }
+}
+
+TEST_F(PathTest, testRecoverArcsFromFlatArc) {
+  Point          p0(Length(3000000), Length(0));
+  Point          p1(Length(1000000), Length(500000));
+  Point          p2(Length(-2000000), Length(-300000));
+  PositiveLength tolerance(5000);
+  QVector<Angle> angles = {Angle::deg90(), -Angle::deg180(), Angle::deg270(),
+                           Angle(-98765432)};
+  foreach (const Angle& angle, angles) {
+    Path path;
+    path.addVertex(p0);
+    foreach (const Vertex& v, Path::flatArc(p1, p2, angle, tolerance)
+                                  .getVertices()) {
+      path.addVertex(v);
+    }
+    path.addVertex(p0);
+    ASSERT_GT(path.getVertices().count(), 10);
+
+    // flattened segments may deviate slightly more due to rounding
+    Path recovered = Path::recoverArcs(path, PositiveLength(10000));
+    ASSERT_EQ(4, recovered.getVertices().count());
+    EXPECT_EQ(Vertex(p0), recovered.getVertices().at(0));
+    EXPECT_EQ(p1, recovered.getVertices().at(1).getPos());
+    EXPECT_NEAR(angle.toDeg(), recovered.getVertices().at(1).getAngle().toDeg(),
+                0.01);
+    EXPECT_EQ(Vertex(p2), recovered.getVertices().at(2));
+    EXPECT_EQ(Vertex(p0), recovered.getVertices().at(3));
+  }
+}
+
+TEST_F(PathTest, testRecoverArcsKeepsPolygonsAndArcs) {
+  PositiveLength tolerance(5000);
+  QVector<Path>  paths = {
+      Path::octagon(PositiveLength(1000000), PositiveLength(1000000)),
+      Path::rect(Point(0, 0), Point(Length(1000000), Length(2000000))),
+      Path::circle(PositiveLength(1000000)),
+      Path(QVector<Vertex>{Vertex(Point(0, 0)), Vertex(Point(Length(1), 0)),
+                           Vertex(Point(Length(2), 0)),
+                           Vertex(Point(Length(3), 0)),
+                           Vertex(Point(Length(4), 0))}),
+  };
+  foreach (const Path& path, paths) {
+    EXPECT_EQ(path, Path::recoverArcs(path, tolerance));
+  }
+}
+
+TEST_F(PathTest, testTransformIsSameAsRotateAndTranslate) {
+  Path  path = Path::obround(PositiveLength(3000000), PositiveLength(1000000));
+  Point offset(Length(-5555555), Length(7777777));
+  QVector<Angle> angles = {Angle::deg0(), Angle::deg90(), Angle::deg180(),
+                           Angle::deg270(), Angle(12345678)};
+  foreach (const Angle& angle, angles) {
+    EXPECT_EQ(path.rotated(angle).translated(offset),
+              path.transformed(angle, offset));
+  }
+}
+
+TEST_F(PathTest, testCopiesShareVerticesUntilModified) {
+  auto data = [](const Path& p) { return p.getVertices().constData(); };
+  Path path = Path::obround(PositiveLength(3000000), PositiveLength(1000000));
+  Path copy(path);
+  EXPECT_EQ(data(path), data(copy));
+
+  // transformations without effect don't detach the copy
+  path.translate(Point(0, 0));
+  path.rotate(Angle::deg0());
+  path.transform(Angle::deg0(), Point(0, 0));
+  EXPECT_EQ(data(path), data(copy));
+
+  // modifications detach the copy
+  path.translate(Point(Length(100), Length(200)));
+  EXPECT_NE(data(path), data(copy));
+  EXPECT_EQ(copy.translated(Point(Length(100), Length(200))), path);
+}
+
+TEST_F(PathTest, testTransformingTemporariesDoesNotCopy) {
+  auto data = [](const Path& p) { return p.getVertices().constData(); };
+  Path path = Path::obround(PositiveLength(3000000), PositiveLength(1000000));
+  Point offset(Length(100), Length(200));
+  Path  expected = path.translated(offset).rotated(Angle::deg90());
+
+  // the detached temporary is rotated in place
+  Path          temporary = path.translated(offset);
+  const Vertex* vertices  = data(temporary);
+  Path          result    = std::move(temporary).rotated(Angle::deg90());
+  EXPECT_EQ(vertices, data(result));
+  EXPECT_EQ(expected, result);
+
+  // moving a path doesn't copy its vertices
+  Path moved(std::move(result));
+  EXPECT_EQ(vertices, data(moved));
+  EXPECT_EQ(expected, moved);
+}
+
 /*******************************************************************************
  *  Parametrized obround(width, height) Tests
  ******************************************************************************/
@@ -0,0 +1,169 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsSceneTest : public ::testing::Test {
+protected:
+  GraphicsScene                                    mScene;
+  std::vector<std::unique_ptr<QGraphicsRectItem>> mItems;
+
+  virtual ~GraphicsSceneTest() {
+    // the scene would delete all populated items otherwise
+    for (const auto& item : mItems) {
+      mScene.removeCulledItem(*item);
+    }
+  }
+
+  QGraphicsRectItem& addItem(qreal x, qreal y) {
+    mItems.emplace_back(new QGraphicsRectItem(x, y, 10, 10));
+    mScene.addCulledItem(*mItems.back());
+    return *mItems.back();
+  }
+
+  bool isPopulated(const QGraphicsItem& item) const {
+    return item.scene() == &mScene;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsSceneTest, testCullingDisabled) {
+  QGraphicsRectItem& item = addItem(100000, 100000);
+  EXPECT_TRUE(isPopulated(item));
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  EXPECT_TRUE(isPopulated(item));
+}
+
+TEST_F(GraphicsSceneTest, testPopulateAroundViewport) {
+  mScene.setCullingEnabled(true);
+  QGraphicsRectItem& visible = addItem(50, 50);
+  QGraphicsRectItem& near    = addItem(120, 50);   // within hysteresis
+  QGraphicsRectItem& far     = addItem(1000, 50);  // outside
+  EXPECT_FALSE(isPopulated(visible));  // no viewport yet
+
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  EXPECT_TRUE(isPopulated(visible));
+  EXPECT_TRUE(isPopulated(near));
+  EXPECT_FALSE(isPopulated(far));
+
+  // panning within the populated area doesn't change anything
+  mScene.setCullingViewport(QRectF(40, 0, 100, 100));
+  EXPECT_TRUE(isPopulated(visible));
+  EXPECT_FALSE(isPopulated(far));
+
+  // panning far away populates other items
+  mScene.setCullingViewport(QRectF(950, 0, 100, 100));
+  EXPECT_FALSE(isPopulated(visible));
+  EXPECT_FALSE(isPopulated(near));
+  EXPECT_TRUE(isPopulated(far));
+
+  // all items are taken into account for the bounding rect
+  EXPECT_EQ(QRectF(50, 50, 960, 10), mScene.getItemsBoundingRect().adjusted(
+                                         0.5, 0.5, -0.5, -0.5));  // pen width
+}
+
+TEST_F(GraphicsSceneTest, testToggleCulling) {
+  QGraphicsRectItem& visible = addItem(50, 50);
+  QGraphicsRectItem& far     = addItem(1000, 50);
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  mScene.setCullingEnabled(true);
+  EXPECT_TRUE(isPopulated(visible));
+  EXPECT_FALSE(isPopulated(far));
+  mScene.setCullingEnabled(false);
+  EXPECT_TRUE(isPopulated(visible));
+  EXPECT_TRUE(isPopulated(far));
+}
+
+TEST_F(GraphicsSceneTest, testPinnedItem) {
+  mScene.setCullingEnabled(true);
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  QGraphicsRectItem& item = addItem(1000, 50);
+  EXPECT_FALSE(isPopulated(item));
+  mScene.setCulledItemPinned(item, true);
+  EXPECT_TRUE(isPopulated(item));
+
+  // moving a pinned item into the viewport keeps it populated after unpinning
+  item.setPos(-1000, 0);
+  mScene.setCulledItemPinned(item, false);
+  EXPECT_TRUE(isPopulated(item));
+}
+
+TEST_F(GraphicsSceneTest, testUpdateCulledItem) {
+  mScene.setCullingEnabled(true);
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  QGraphicsRectItem& item = addItem(1000, 50);
+  item.setPos(-1000, 0);
+  EXPECT_FALSE(isPopulated(item));  // not tracked automatically
+  mScene.updateCulledItem(item);
+  EXPECT_TRUE(isPopulated(item));
+  item.setPos(0, 0);
+  mScene.updateCulledItem(item);
+  EXPECT_FALSE(isPopulated(item));
+}
+
+TEST_F(GraphicsSceneTest, testInvalidateCulledItems) {
+  mScene.setCullingEnabled(true);
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  QGraphicsRectItem& item = addItem(1000, 50);
+  item.setPos(-1000, 0);
+  mScene.invalidateCulledItems();
+  EXPECT_FALSE(isPopulated(item));  // deferred
+  qApp->processEvents();
+  EXPECT_TRUE(isPopulated(item));
+}
+
+TEST_F(GraphicsSceneTest, testRemoveCulledItem) {
+  mScene.setCullingEnabled(true);
+  mScene.setCullingViewport(QRectF(0, 0, 100, 100));
+  QGraphicsRectItem& item = addItem(50, 50);
+  EXPECT_TRUE(isPopulated(item));
+  mScene.removeCulledItem(item);
+  EXPECT_FALSE(isPopulated(item));
+  mItems.pop_back();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
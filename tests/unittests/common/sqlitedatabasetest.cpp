@@ -164,6 +164,64 @@ TEST_F(SQLiteDatabaseTest, testInsert) {
   }
 }
 
+TEST_F(SQLiteDatabaseTest, testInsertRows) {
+  SQLiteDatabase db(mTempDbFilePath);
+  db.exec("CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
+  QList<QVariantList> rows;
+  for (int i = 0; i < 1200; ++i) {  // more rows than bound variables allowed
+    rows.append(QVariantList{i + 1, QString("row %1").arg(i)});
+  }
+  db.insertRows("test", {"id", "name"}, rows);
+  QSqlQuery query = db.prepareQuery("SELECT COUNT(*) FROM test");
+  EXPECT_EQ(1200, db.count(query));
+  query = db.prepareQuery("SELECT name FROM test WHERE id = 1200");
+  db.exec(query);
+  ASSERT_TRUE(query.next());
+  EXPECT_EQ("row 1199", query.value(0).toString());
+  EXPECT_THROW(db.insertRows("test", {"id", "name"}, {QVariantList{1}}),
+               Exception);
+}
+
+TEST_F(SQLiteDatabaseTest, testCachedQuerySeesModificationsOfOtherConnection) {
+  SQLiteDatabase db1(mTempDbFilePath);
+  SQLiteDatabase db2(mTempDbFilePath);
+  db1.exec(
+      "CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
+  db1.exec("INSERT INTO test (name) VALUES ('hello')");
+  for (int i = 1; i <= 3; ++i) {
+    // the same query is prepared again, but only partially iterated
+    QSqlQuery query = db1.prepareQuery("SELECT COUNT(*) FROM test");
+    EXPECT_EQ(i, db1.count(query));
+    db2.exec("INSERT INTO test (name) VALUES ('hello')");
+  }
+}
+
+TEST_F(SQLiteDatabaseTest, testNestedIterationOfCachedQueries) {
+  SQLiteDatabase db(mTempDbFilePath);
+  db.exec("CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
+  db.insertRows("test", {"id", "name"},
+                {QVariantList{1, "a"}, QVariantList{2, "b"},
+                 QVariantList{3, "c"}});
+  QStringList pairs;
+  QSqlQuery outer = db.prepareQuery("SELECT id FROM test ORDER BY id");
+  db.exec(outer);
+  while (outer.next()) {
+    // the same query is executed again while the outer one is iterated, and
+    // a lookup query is executed for every row of the inner one
+    QSqlQuery inner = db.prepareQuery("SELECT id FROM test ORDER BY id");
+    db.exec(inner);
+    while (inner.next()) {
+      QSqlQuery name = db.prepareQuery("SELECT name FROM test WHERE id = :id");
+      name.bindValue(":id", inner.value(0));
+      db.exec(name);
+      ASSERT_TRUE(name.next());
+      pairs.append(outer.value(0).toString() + name.value(0).toString());
+    }
+  }
+  EXPECT_EQ(QStringList({"1a", "1b", "1c", "2a", "2b", "2c", "3a", "3b", "3c"}),
+            pairs);
+}
+
 TEST_F(SQLiteDatabaseTest, testClearExistingTable) {
   SQLiteDatabase db(mTempDbFilePath);
   db.exec("CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
@@ -150,6 +150,11 @@ TEST_F(SystemInfoTest, testGetProcessNameByPid) {
   }
 }
 
+TEST_F(SystemInfoTest, testGetPeakMemoryUsage) {
+  // every process needs at least a few kilobytes of memory
+  EXPECT_GT(SystemInfo::getPeakMemoryUsage(), 0);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
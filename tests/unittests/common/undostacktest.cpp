@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undocommand.h>
+#include <librepcb/common/undostack.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class UndoStackTest : public ::testing::Test {
+protected:
+  class Cmd final : public UndoCommand {
+  public:
+    Cmd(int& value, int newValue, qint64 memoryUsage = 0) noexcept
+      : UndoCommand(QString::number(newValue)),
+        mValue(value),
+        mOldValue(value),
+        mNewValue(newValue),
+        mMemoryUsage(memoryUsage) {}
+    qint64 getMemoryUsage() const noexcept override { return mMemoryUsage; }
+
+  private:
+    bool performExecute() override {
+      performRedo();
+      return true;
+    }
+    void performUndo() override { mValue = mOldValue; }
+    void performRedo() override { mValue = mNewValue; }
+
+    int&   mValue;
+    int    mOldValue;
+    int    mNewValue;
+    qint64 mMemoryUsage;
+  };
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(UndoStackTest, testUnlimited) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(0);
+  for (int i = 1; i <= 100; ++i) {
+    stack.execCmd(new Cmd(value, i, 1000));
+  }
+  EXPECT_EQ(100, stack.getCommandCount());
+  EXPECT_EQ(100000, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testMaxDepth) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxDepth(3);
+  for (int i = 1; i <= 5; ++i) {
+    stack.execCmd(new Cmd(value, i));
+  }
+  EXPECT_EQ(3, stack.getCommandCount());
+  while (stack.canUndo()) {
+    stack.undo();
+  }
+  EXPECT_EQ(2, value);  // the oldest two commands were dropped
+}
+
+TEST_F(UndoStackTest, testMaxMemoryUsage) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(250);
+  for (int i = 1; i <= 5; ++i) {
+    stack.execCmd(new Cmd(value, i, 100));
+  }
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(200, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testNewestCommandIsAlwaysKept) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(10);
+  stack.execCmd(new Cmd(value, 1, 100));
+  stack.execCmd(new Cmd(value, 2, 100));
+  EXPECT_EQ(1, stack.getCommandCount());
+  stack.undo();
+  EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testCommandGroupMemoryUsage) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(0);
+  stack.beginCmdGroup("group");
+  stack.appendToCmdGroup(new Cmd(value, 1, 100));
+  stack.appendToCmdGroup(new Cmd(value, 2, 100));
+  stack.commitCmdGroup();
+  EXPECT_EQ(1, stack.getCommandCount());
+  EXPECT_GE(stack.getMemoryUsage(), 200);
+}
+
+TEST_F(UndoStackTest, testCleanStateOfDroppedCommand) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMaxDepth(2);
+  stack.setClean();
+  stack.execCmd(new Cmd(value, 1));
+  stack.execCmd(new Cmd(value, 2));
+  stack.execCmd(new Cmd(value, 3));
+  while (stack.canUndo()) {
+    stack.undo();
+  }
+  EXPECT_FALSE(stack.isClean());  // the clean state is no longer reachable
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
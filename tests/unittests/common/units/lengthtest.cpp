@@ -103,6 +103,10 @@ INSTANTIATE_TEST_SUITE_P(LengthTest, LengthTest, ::testing::Values(
     LengthTestData({true,  "0.00009",        Length(90),          "0.00009"     }),
     LengthTestData({true,  "0.000099",       Length(99),          "0.000099"    }),
     LengthTestData({true,  "0.000009",       Length(9),           "0.000009"    }),
+    LengthTestData({true,  "+1",             Length(1000000),     "1.0"         }),
+    LengthTestData({true,  "-0",             Length(0),           "0.0"         }),
+    LengthTestData({true,  "001.500",        Length(1500000),     "1.5"         }),
+    LengthTestData({true,  "-2147.483648",   Length(-2147483648), "-2147.483648"}),
 
     // invalid cases
     LengthTestData({false, "",               Length(),            QString()     }),
@@ -112,6 +116,9 @@ INSTANTIATE_TEST_SUITE_P(LengthTest, LengthTest, ::testing::Values(
     LengthTestData({false, "0e-",            Length(),            QString()     }),
     LengthTestData({false, "0.0000001",      Length(),            QString()     }),
     LengthTestData({false, "1e-7",           Length(),            QString()     }),
+    LengthTestData({false, "1.2.3",          Length(),            QString()     }),
+    LengthTestData({false, "--1",            Length(),            QString()     }),
+    LengthTestData({false, "1 ",             Length(),            QString()     }),
     LengthTestData({false, "1e1000",         Length(),            QString()     })
 ));
 // clang-format on
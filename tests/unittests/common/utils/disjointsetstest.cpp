@@ -0,0 +1,117 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/disjointsets.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST(DisjointSetsTest, testInsert) {
+  int               a = 0, b = 0;
+  DisjointSets<int> sets;
+  EXPECT_EQ(0, sets.getCount());
+  EXPECT_TRUE(sets.insert(&a, true));
+  EXPECT_FALSE(sets.insert(&a, true));
+  EXPECT_TRUE(sets.insert(&b, false));
+  EXPECT_TRUE(sets.contains(&a));
+  EXPECT_TRUE(sets.contains(&b));
+  EXPECT_EQ(1, sets.getCount());
+  EXPECT_EQ(&a, sets.find(&a));
+  EXPECT_EQ(&b, sets.find(&b));
+}
+
+TEST(DisjointSetsTest, testUnite) {
+  int               a = 0, b = 0, c = 0, d = 0;
+  DisjointSets<int> sets;
+  sets.insert(&a, true);
+  sets.insert(&b, true);
+  sets.insert(&c, true);
+  EXPECT_EQ(3, sets.getCount());
+  EXPECT_TRUE(sets.unite(&a, &b));
+  EXPECT_EQ(2, sets.getCount());
+  EXPECT_FALSE(sets.unite(&b, &a));
+  EXPECT_EQ(2, sets.getCount());
+  EXPECT_EQ(sets.find(&a), sets.find(&b));
+  EXPECT_NE(sets.find(&a), sets.find(&c));
+
+  // not yet contained elements are added as not counted elements
+  EXPECT_TRUE(sets.unite(&c, &d));
+  EXPECT_TRUE(sets.contains(&d));
+  EXPECT_EQ(2, sets.getCount());
+  EXPECT_TRUE(sets.unite(&d, &a));
+  EXPECT_EQ(1, sets.getCount());
+  EXPECT_EQ(sets.find(&a), sets.find(&d));
+}
+
+TEST(DisjointSetsTest, testNotCountedElements) {
+  int               pin1 = 0, pin2 = 0, point = 0;
+  DisjointSets<int> sets;
+  EXPECT_TRUE(sets.unite(&pin1, &pin2));
+  EXPECT_EQ(0, sets.getCount());
+  sets.insert(&point, true);
+  EXPECT_EQ(1, sets.getCount());
+  EXPECT_TRUE(sets.unite(&pin2, &point));
+  EXPECT_EQ(1, sets.getCount());
+}
+
+TEST(DisjointSetsTest, testManyElements) {
+  QVector<int>      elements(10000);
+  DisjointSets<int> sets;
+  for (const int& element : elements) {
+    sets.insert(&element, true);
+  }
+  // connect all even and all odd elements as two chains
+  for (int i = 2; i < elements.count(); ++i) {
+    sets.unite(&elements.at(i - 2), &elements.at(i));
+  }
+  EXPECT_EQ(2, sets.getCount());
+  EXPECT_EQ(sets.find(&elements.first()), sets.find(&elements.at(9998)));
+  EXPECT_EQ(sets.find(&elements.at(1)), sets.find(&elements.last()));
+  EXPECT_NE(sets.find(&elements.first()), sets.find(&elements.last()));
+}
+
+TEST(DisjointSetsTest, testClear) {
+  int               a = 0, b = 0, c = 0;
+  DisjointSets<int> sets;
+  sets.unite(&a, &b);
+  sets.insert(&c, true);
+  sets.clear();
+  EXPECT_FALSE(sets.contains(&a));
+  EXPECT_EQ(0, sets.getCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
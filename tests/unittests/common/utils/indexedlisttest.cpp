@@ -0,0 +1,80 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/indexedlist.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class IndexedListTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(IndexedListTest, testAppend) {
+  int              a = 1, b = 2;
+  IndexedList<int> list;
+  EXPECT_TRUE(list.isEmpty());
+  EXPECT_TRUE(list.append(&a));
+  EXPECT_TRUE(list.append(&b));
+  EXPECT_FALSE(list.append(&a));
+  EXPECT_EQ(2, list.count());
+  EXPECT_EQ((QList<int*>{&a, &b}), list.values());
+  EXPECT_TRUE(list.contains(&a));
+  EXPECT_TRUE(list.contains(&b));
+}
+
+TEST_F(IndexedListTest, testRemove) {
+  int              a = 1, b = 2, c = 3;
+  IndexedList<int> list;
+  list.append(&a);
+  list.append(&b);
+  list.append(&c);
+  EXPECT_TRUE(list.remove(&a));
+  EXPECT_FALSE(list.remove(&a));
+  EXPECT_FALSE(list.contains(&a));
+  EXPECT_EQ((QList<int*>{&c, &b}), list.values());  // last moved to front
+  EXPECT_TRUE(list.remove(&b));
+  EXPECT_EQ((QList<int*>{&c}), list.values());
+  EXPECT_TRUE(list.remove(&c));
+  EXPECT_TRUE(list.isEmpty());
+  EXPECT_TRUE(list.append(&b));
+  EXPECT_TRUE(list.contains(&b));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,103 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/objectpool.h>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Data Type
+ ******************************************************************************/
+
+class PooledObject {
+public:
+  explicit PooledObject(int value) noexcept : mValue(value) {}
+  virtual ~PooledObject() noexcept {}
+  int getValue() const noexcept { return mValue; }
+
+  static void* operator new(std::size_t size) {
+    return ObjectPool<PooledObject>::allocate(size);
+  }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    ObjectPool<PooledObject>::deallocate(p, size);
+  }
+
+private:
+  qint64 mValue;
+};
+
+class DerivedPooledObject final : public PooledObject {
+public:
+  explicit DerivedPooledObject(int value) noexcept
+    : PooledObject(value), mPadding{} {}
+
+private:
+  char mPadding[100];
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST(ObjectPoolTest, testFreedMemoryIsReused) {
+  PooledObject* obj     = new PooledObject(42);
+  void*         address = obj;
+  delete obj;
+  obj = new PooledObject(43);
+  EXPECT_EQ(address, static_cast<void*>(obj));
+  EXPECT_EQ(43, obj->getValue());
+  delete obj;
+}
+
+TEST(ObjectPoolTest, testManyObjects) {
+  QVector<PooledObject*> objects;
+  for (int i = 0; i < 10000; ++i) {
+    objects.append(new PooledObject(i));
+  }
+  QSet<PooledObject*> addresses = objects.toList().toSet();
+  EXPECT_EQ(objects.count(), addresses.count());
+  for (int i = 0; i < objects.count(); ++i) {
+    EXPECT_EQ(i, objects.at(i)->getValue());
+  }
+  qDeleteAll(objects);
+}
+
+TEST(ObjectPoolTest, testDerivedClass) {
+  std::unique_ptr<PooledObject> obj(new DerivedPooledObject(42));
+  EXPECT_EQ(42, obj->getValue());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,117 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/utils/performancecounters.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PerformanceCountersTest : public ::testing::Test {
+protected:
+  typedef PerformanceCounters::Counter Counter;
+
+  virtual void TearDown() override {
+    PerformanceCounters::setEnabled(false);
+    PerformanceCounters::reset();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PerformanceCountersTest, testDisabledByDefault) {
+  EXPECT_FALSE(PerformanceCounters::isEnabled());
+  PerformanceCounters::add(Counter::PlaneRebuilds);
+  EXPECT_EQ(0, PerformanceCounters::get(Counter::PlaneRebuilds));
+}
+
+TEST_F(PerformanceCountersTest, testAdd) {
+  PerformanceCounters::setEnabled(true);
+  PerformanceCounters::add(Counter::PlaneRebuilds);
+  PerformanceCounters::add(Counter::PlaneRebuilds, 5);
+  EXPECT_EQ(6, PerformanceCounters::get(Counter::PlaneRebuilds));
+  EXPECT_EQ(0, PerformanceCounters::get(Counter::AirWireRebuilds));
+}
+
+TEST_F(PerformanceCountersTest, testReset) {
+  PerformanceCounters::setEnabled(true);
+  PerformanceCounters::add(Counter::SqlQueries, 3);
+  PerformanceCounters::reset();
+  EXPECT_EQ(0, PerformanceCounters::get(Counter::SqlQueries));
+  EXPECT_TRUE(PerformanceCounters::isEnabled());
+}
+
+TEST_F(PerformanceCountersTest, testEntries) {
+  PerformanceCounters::setEnabled(true);
+  PerformanceCounters::add(Counter::ClipperExecutions, 2);
+  QList<PerformanceCounters::Entry> entries = PerformanceCounters::getEntries();
+  ASSERT_EQ(static_cast<int>(Counter::_COUNT), entries.count());
+  foreach (const PerformanceCounters::Entry& entry, entries) {
+    EXPECT_FALSE(entry.name.isEmpty());
+    EXPECT_EQ(entry.counter == Counter::ClipperExecutions ? 2 : 0,
+              entry.value);
+  }
+}
+
+TEST_F(PerformanceCountersTest, testMultipleThreads) {
+  PerformanceCounters::setEnabled(true);
+  QList<QFuture<void>> futures;
+  for (int i = 0; i < 4; ++i) {
+    futures.append(QtConcurrent::run([]() {
+      for (int k = 0; k < 1000; ++k) {
+        PerformanceCounters::add(Counter::UndoCommandsExecuted);
+      }
+    }));
+  }
+  for (QFuture<void>& future : futures) {
+    future.waitForFinished();
+  }
+  EXPECT_EQ(4000, PerformanceCounters::get(Counter::UndoCommandsExecuted));
+}
+
+TEST_F(PerformanceCountersTest, testSExpressionNodesParsed) {
+  PerformanceCounters::setEnabled(true);
+  SExpression root = SExpression::parse("(root (foo \"bar\") baz)", FilePath());
+  EXPECT_EQ(4, PerformanceCounters::get(Counter::SExpressionNodesParsed));
+  SExpression::parseBinary(root.toBinary(), FilePath());
+  EXPECT_EQ(8, PerformanceCounters::get(Counter::SExpressionNodesParsed));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/profiler.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ProfilerTest : public ::testing::Test {
+protected:
+  virtual void TearDown() override {
+    Profiler::setEnabled(false);
+    Profiler::clear();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ProfilerTest, testDisabledByDefault) {
+  EXPECT_FALSE(Profiler::isEnabled());
+  { Profiler::Scope scope("foo"); }
+  EXPECT_EQ(0, Profiler::getEntries().count());
+}
+
+TEST_F(ProfilerTest, testScopesAreAccumulated) {
+  Profiler::setEnabled(true);
+  { Profiler::Scope scope("foo"); }
+  { Profiler::Scope scope("bar"); }
+  { Profiler::Scope scope("foo"); }
+  QList<Profiler::Entry> entries = Profiler::getEntries();
+  ASSERT_EQ(2, entries.count());
+  EXPECT_EQ("foo", entries.at(0).name.toStdString());
+  EXPECT_EQ(2, entries.at(0).count);
+  EXPECT_EQ("bar", entries.at(1).name.toStdString());
+  EXPECT_EQ(1, entries.at(1).count);
+}
+
+TEST_F(ProfilerTest, testScopesWithArguments) {
+  { Profiler::Scope scope("foo '%1'", QString("bar")); }  // disabled
+  EXPECT_EQ(0, Profiler::getEntries().count());
+  Profiler::setEnabled(true);
+  { Profiler::Scope scope("foo '%1'", QString("bar")); }
+  { Profiler::Scope scope("foo '%1' '%2'", QString("bar"), QString("baz")); }
+  QList<Profiler::Entry> entries = Profiler::getEntries();
+  ASSERT_EQ(2, entries.count());
+  EXPECT_EQ("foo 'bar'", entries.at(0).name.toStdString());
+  EXPECT_EQ("foo 'bar' 'baz'", entries.at(1).name.toStdString());
+}
+
+TEST_F(ProfilerTest, testStopScope) {
+  Profiler::setEnabled(true);
+  {
+    Profiler::Scope scope("foo");
+    scope.stop();
+    EXPECT_EQ(1, Profiler::getEntries().count());
+  }
+  ASSERT_EQ(1, Profiler::getEntries().count());
+  EXPECT_EQ(1, Profiler::getEntries().first().count);  // not recorded twice
+}
+
+TEST_F(ProfilerTest, testRecord) {
+  Profiler::record("foo", 1000);
+  Profiler::record("foo", 500);
+  QList<Profiler::Entry> entries = Profiler::getEntries();
+  ASSERT_EQ(1, entries.count());
+  EXPECT_EQ(2, entries.at(0).count);
+  EXPECT_EQ(1500, entries.at(0).nanoseconds);
+}
+
+TEST_F(ProfilerTest, testChromeTrace) {
+  Profiler::setEnabled(true);
+  {
+    Profiler::Scope outer("outer");
+    { Profiler::Scope inner("inner"); }
+  }
+  QJsonDocument doc    = QJsonDocument::fromJson(Profiler::getChromeTrace());
+  QJsonArray    events = doc.object().value("traceEvents").toArray();
+  QJsonObject   inner, outer;
+  foreach (const QJsonValue& value, events) {
+    QJsonObject obj = value.toObject();
+    if (obj.value("ph").toString() != "X") {
+      continue;  // metadata
+    } else if (obj.value("name").toString() == "inner") {
+      inner = obj;
+    } else if (obj.value("name").toString() == "outer") {
+      outer = obj;
+    }
+  }
+  ASSERT_FALSE(inner.isEmpty());
+  ASSERT_FALSE(outer.isEmpty());
+  EXPECT_EQ(inner.value("tid").toInt(), outer.value("tid").toInt());
+  EXPECT_LE(outer.value("ts").toDouble(), inner.value("ts").toDouble());
+  EXPECT_GE(outer.value("ts").toDouble() + outer.value("dur").toDouble(),
+            inner.value("ts").toDouble() + inner.value("dur").toDouble());
+}
+
+TEST_F(ProfilerTest, testRecordFromOtherThread) {
+  Profiler::record("foo", 1000);
+  QtConcurrent::run([]() { Profiler::record("foo", 500); }).waitForFinished();
+  QList<Profiler::Entry> entries = Profiler::getEntries();
+  ASSERT_EQ(1, entries.count());
+  EXPECT_EQ(2, entries.at(0).count);
+  EXPECT_EQ(1500, entries.at(0).nanoseconds);
+}
+
+TEST_F(ProfilerTest, testClear) {
+  Profiler::record("foo", 1000);
+  Profiler::clear();
+  EXPECT_EQ(0, Profiler::getEntries().count());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
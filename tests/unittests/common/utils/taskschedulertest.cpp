@@ -0,0 +1,106 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/utils/taskscheduler.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST(TaskSchedulerTest, testResult) {
+  QFuture<int> future =
+      TaskScheduler::run(TaskScheduler::Priority::Batch, []() { return 42; });
+  EXPECT_EQ(42, future.result());
+}
+
+TEST(TaskSchedulerTest, testVoidFunction) {
+  QAtomicInt    called(0);
+  QFuture<void> future = TaskScheduler::run(
+      TaskScheduler::Priority::Interactive, [&called]() { called.store(1); });
+  future.waitForFinished();
+  EXPECT_TRUE(future.isFinished());
+  EXPECT_EQ(1, called.load());
+}
+
+TEST(TaskSchedulerTest, testDependenciesAreFinishedFirst) {
+  QAtomicInt    dependencyFinished(0);
+  QFuture<void> dependency =
+      TaskScheduler::run(TaskScheduler::Priority::Background, [&]() {
+        QThread::msleep(50);
+        dependencyFinished.store(1);
+      });
+  QFuture<int> future = TaskScheduler::run(
+      TaskScheduler::Priority::Interactive, {dependency},
+      [&dependencyFinished]() { return dependencyFinished.load(); });
+  EXPECT_EQ(1, future.result());
+}
+
+TEST(TaskSchedulerTest, testCanceledTaskIsNotExecuted) {
+  // Block the task with a dependency to cancel it before it is executed.
+  QSemaphore    semaphore;
+  QAtomicInt    called(0);
+  QFuture<void> dependency = TaskScheduler::run(
+      TaskScheduler::Priority::Batch, [&semaphore]() { semaphore.acquire(); });
+  QFuture<void> future =
+      TaskScheduler::run(TaskScheduler::Priority::Batch, {dependency},
+                         [&called]() { called.store(1); });
+  future.cancel();
+  semaphore.release();
+  future.waitForFinished();
+  dependency.waitForFinished();
+  EXPECT_TRUE(future.isCanceled());
+  EXPECT_EQ(0, called.load());
+}
+
+TEST(TaskSchedulerTest, testExceptionIsRethrown) {
+  QFuture<int> future =
+      TaskScheduler::run(TaskScheduler::Priority::Batch, []() -> int {
+        throw RuntimeError(__FILE__, __LINE__, "foo");
+      });
+  EXPECT_THROW(future.result(), RuntimeError);
+}
+
+TEST(TaskSchedulerTest, testCancellationTokenIsShared) {
+  TaskScheduler::CancellationToken token;
+  TaskScheduler::CancellationToken copy = token;
+  EXPECT_FALSE(copy.isCanceled());
+  token.cancel();
+  EXPECT_TRUE(copy.isCanceled());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
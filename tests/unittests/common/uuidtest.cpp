@@ -144,12 +144,28 @@ TEST_P(UuidTest, testOperatorComparisons) {
   }
 }
 
+TEST_P(UuidTest, testQHash) {
+  const UuidTestData& data = GetParam();
+
+  if (data.valid) {
+    Uuid uuid1 = Uuid::fromString(data.uuid);
+    Uuid uuid2 = Uuid::fromString(data.uuid);
+    EXPECT_EQ(qHash(uuid1, 0), qHash(uuid2, 0));
+    EXPECT_EQ(qHash(uuid1, 42), qHash(uuid2, 42));
+  }
+}
+
+TEST(UuidTest, testSizeOf) {
+  EXPECT_EQ(16U, sizeof(Uuid));
+}
+
 TEST(UuidTest, testCreateRandom) {
   for (int i = 0; i < 1000; i++) {
     Uuid uuid = Uuid::createRandom();
     EXPECT_FALSE(uuid.toStr().isEmpty());
     EXPECT_EQ(QUuid::DCE, QUuid(uuid.toStr()).variant());
     EXPECT_EQ(QUuid::Random, QUuid(uuid.toStr()).version());
+    EXPECT_EQ(uuid, Uuid::fromString(uuid.toStr()));
   }
 }
 
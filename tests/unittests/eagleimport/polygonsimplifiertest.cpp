@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/eagleimport/polygonsimplifier.h>
+#include <librepcb/library/sym/symbol.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PolygonSimplifierTest : public ::testing::Test {
+protected:
+  static std::unique_ptr<library::Symbol> createSymbol() {
+    return std::unique_ptr<library::Symbol>(new library::Symbol(
+        Uuid::createRandom(), Version::fromString("0.1"), "test",
+        ElementName("test"), "", ""));
+  }
+
+  static void addLine(library::Symbol& symbol, const Point& p1,
+                      const Point& p2, const Length& width = Length(200000)) {
+    symbol.getPolygons().append(std::make_shared<Polygon>(
+        Uuid::createRandom(), GraphicsLayerName(GraphicsLayer::sSymbolOutlines),
+        UnsignedLength(width), false, false, Path::line(p1, p2)));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PolygonSimplifierTest, testLinesToRect) {
+  std::unique_ptr<library::Symbol> symbol = createSymbol();
+  addLine(*symbol, Point(0, 0), Point(1000000, 0));
+  addLine(*symbol, Point(0, 2000000), Point(0, 0));
+  addLine(*symbol, Point(1000000, 2000000), Point(1000000, 0));
+  addLine(*symbol, Point(1000000, 2000000), Point(0, 2000000));
+  addLine(*symbol, Point(5000000, 0), Point(6000000, 0));  // not connected
+
+  PolygonSimplifier<library::Symbol> simplifier(*symbol);
+  simplifier.convertLineRectsToPolygonRects(true, true);
+
+  ASSERT_EQ(2, symbol->getPolygons().count());
+  EXPECT_EQ(2, symbol->getPolygons().at(0)->getPath().getVertices().count());
+  const Polygon& rect = *symbol->getPolygons().at(1);
+  EXPECT_EQ(5, rect.getPath().getVertices().count());
+  EXPECT_TRUE(rect.getPath().isClosed());
+  EXPECT_TRUE(rect.isFilled());
+  EXPECT_EQ(UnsignedLength(200000), rect.getLineWidth());
+  QSet<Point> vertices;
+  for (const Vertex& vertex : rect.getPath().getVertices()) {
+    vertices.insert(vertex.getPos());
+  }
+  EXPECT_EQ((QSet<Point>{Point(0, 0), Point(1000000, 0),
+                         Point(1000000, 2000000), Point(0, 2000000)}),
+            vertices);
+}
+
+TEST_F(PolygonSimplifierTest, testMultipleRects) {
+  std::unique_ptr<library::Symbol> symbol = createSymbol();
+  for (int i = 0; i < 100; ++i) {
+    Length x(i * 2000000);
+    addLine(*symbol, Point(x, 0), Point(x + 1000000, 0));
+    addLine(*symbol, Point(x + 1000000, 0), Point(x + 1000000, 1000000));
+    addLine(*symbol, Point(x + 1000000, 1000000), Point(x, 1000000));
+    addLine(*symbol, Point(x, 1000000), Point(x, 0));
+  }
+
+  PolygonSimplifier<library::Symbol> simplifier(*symbol);
+  simplifier.convertLineRectsToPolygonRects(false, true);
+
+  ASSERT_EQ(100, symbol->getPolygons().count());
+  for (const Polygon& polygon : symbol->getPolygons()) {
+    EXPECT_EQ(5, polygon.getPath().getVertices().count());
+    EXPECT_FALSE(polygon.isFilled());
+  }
+}
+
+TEST_F(PolygonSimplifierTest, testLinesOfDifferentWidthAreKept) {
+  std::unique_ptr<library::Symbol> symbol = createSymbol();
+  addLine(*symbol, Point(0, 0), Point(1000000, 0));
+  addLine(*symbol, Point(1000000, 0), Point(1000000, 1000000));
+  addLine(*symbol, Point(1000000, 1000000), Point(0, 1000000), Length(100000));
+  addLine(*symbol, Point(0, 1000000), Point(0, 0));
+
+  PolygonSimplifier<library::Symbol> simplifier(*symbol);
+  simplifier.convertLineRectsToPolygonRects(false, true);
+
+  EXPECT_EQ(4, symbol->getPolygons().count());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace eagleimport
+}  // namespace librepcb
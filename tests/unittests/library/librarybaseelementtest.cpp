@@ -92,6 +92,24 @@ TEST_F(LibraryBaseElementTest, testMoveToEmptyDirectory) {
   EXPECT_TRUE(dest.getPathTo("symbol.lp").isExistingFile());
 }
 
+TEST_F(LibraryBaseElementTest, testCalcContentHash) {
+  std::shared_ptr<TransactionalFileSystem> fs1 =
+      TransactionalFileSystem::openRW(mTempDir.getPathTo("1"));
+  std::shared_ptr<TransactionalFileSystem> fs2 =
+      TransactionalFileSystem::openRW(mTempDir.getPathTo("2"));
+  TransactionalDirectory dir1(fs1);
+  TransactionalDirectory dir2(fs2);
+  mNewElement->saveTo(dir1);
+  mNewElement->saveTo(dir2);
+  QByteArray hash = LibraryBaseElement::calcContentHash(dir1);
+  EXPECT_FALSE(hash.isEmpty());
+  EXPECT_EQ(hash, LibraryBaseElement::calcContentHash(dir2));
+
+  // modifying any file must change the hash
+  dir2.write("symbol.lp", dir2.read("symbol.lp") + "\n");
+  EXPECT_NE(hash, LibraryBaseElement::calcContentHash(dir2));
+}
+
 // Currently disabled because of the file system refactoring, and not sure if
 // this behavior is really what we want...
 //
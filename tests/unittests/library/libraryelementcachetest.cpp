@@ -0,0 +1,170 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/libraryelementcache.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryElementCacheTest : public ::testing::Test {
+protected:
+  FilePath                                 mWsDir;
+  QScopedPointer<workspace::Workspace>     mWs;
+  std::shared_ptr<TransactionalFileSystem> mLibFs;
+
+  LibraryElementCacheTest() {
+    mWsDir = FilePath::getRandomTempPath();
+    workspace::Workspace::createNewWorkspace(mWsDir);
+    mWs.reset(new workspace::Workspace(mWsDir));
+
+    // create an empty local library
+    mLibFs = TransactionalFileSystem::openRW(
+        mWs->getLocalLibrariesPath().getPathTo("Test.lplib"));
+    TransactionalDirectory libDir(mLibFs);
+    Library lib(Uuid::createRandom(), Version::fromString("0.1"), "test",
+                ElementName("Test"), "", "");
+    lib.saveTo(libDir);
+  }
+
+  virtual ~LibraryElementCacheTest() {
+    mLibFs.reset();
+    mWs.reset();
+    QDir(mWsDir.toStr()).removeRecursively();
+  }
+
+  QList<Uuid> addSymbols(int count) {
+    QList<Uuid>            uuids;
+    TransactionalDirectory dir(mLibFs, "sym");
+    for (int i = 0; i < count; ++i) {
+      Symbol sym(Uuid::createRandom(), Version::fromString("0.1"), "test",
+                 ElementName(QString("Symbol %1").arg(i)), "", "");
+      sym.saveIntoParentDirectory(dir);
+      uuids.append(sym.getUuid());
+    }
+    mLibFs->save();
+    return uuids;
+  }
+
+  void scanLibraries() {
+    QEventLoop loop;
+    QObject::connect(&mWs->getLibraryDb(),
+                     &workspace::WorkspaceLibraryDb::scanFinished, &loop,
+                     &QEventLoop::quit);
+    QTimer::singleShot(60000, &loop, &QEventLoop::quit);  // timeout
+    mWs->getLibraryDb().startLibraryRescan();
+    loop.exec();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryElementCacheTest, testCachedElementsAreShared) {
+  QList<Uuid> uuids = addSymbols(1);
+  scanLibraries();
+
+  LibraryElementCache           cache(mWs->getLibraryDb());
+  std::shared_ptr<const Symbol> sym1 = cache.getSymbol(uuids.first());
+  std::shared_ptr<const Symbol> sym2 = cache.getSymbol(uuids.first());
+  ASSERT_NE(nullptr, sym1);
+  EXPECT_EQ(sym1.get(), sym2.get());
+  EXPECT_EQ(1, cache.getEntryCount());
+  EXPECT_EQ(1u, cache.getMissCount());
+  EXPECT_EQ(1u, cache.getHitCount());
+  EXPECT_EQ(nullptr, cache.getSymbol(Uuid::createRandom()));
+  EXPECT_EQ(1, cache.getEntryCount());
+}
+
+TEST_F(LibraryElementCacheTest, testUsedElementsAreNotEvicted) {
+  QList<Uuid> uuids = addSymbols(3);
+  scanLibraries();
+
+  LibraryElementCache                  cache(mWs->getLibraryDb(), 2);
+  QList<std::shared_ptr<const Symbol>> used;
+  foreach (const Uuid& uuid, uuids) { used.append(cache.getSymbol(uuid)); }
+  EXPECT_EQ(3, cache.getEntryCount());  // limit exceeded since all are used
+
+  // releasing the elements allows to evict them on the next insertion
+  used.clear();
+  cache.setMaxEntries(1);
+  EXPECT_EQ(1, cache.getEntryCount());
+  EXPECT_EQ(3u, cache.getMissCount());
+  cache.getSymbol(uuids.last());  // the most recently used one is kept
+  EXPECT_EQ(3u, cache.getMissCount());
+}
+
+TEST_F(LibraryElementCacheTest, testEvictionAtLimitOfWorkspaceCache) {
+  const int   limit = 1000;
+  QList<Uuid> uuids = addSymbols(limit + 1);
+  scanLibraries();
+
+  std::shared_ptr<LibraryElementCache> cache = mWs->getLibraryElementCache();
+  EXPECT_EQ(limit, cache->getMaxEntries());
+
+  // keep a reference to the first element, release all other ones
+  std::shared_ptr<const Symbol> first = cache->getSymbol(uuids.at(0));
+  ASSERT_NE(nullptr, first);
+  for (int i = 1; i < uuids.count(); ++i) {
+    ASSERT_NE(nullptr, cache->getSymbol(uuids.at(i)));
+  }
+  EXPECT_EQ(limit, cache->getEntryCount());
+  EXPECT_EQ(quint64(limit + 1), cache->getMissCount());
+
+  // the used element is still cached, although it is the oldest one
+  EXPECT_EQ(first.get(), cache->getSymbol(uuids.at(0)).get());
+  EXPECT_EQ(quint64(limit + 1), cache->getMissCount());
+
+  // the least recently used unused element was evicted
+  EXPECT_NE(nullptr, cache->getSymbol(uuids.at(1)));
+  EXPECT_EQ(quint64(limit + 2), cache->getMissCount());
+  EXPECT_EQ(limit, cache->getEntryCount());
+
+  // the most recently used element was not evicted
+  cache->getSymbol(uuids.last());
+  EXPECT_EQ(quint64(limit + 2), cache->getMissCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,142 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/libraryelementcheckcache.h>
+#include <librepcb/library/msg/msgmissingauthor.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryElementCheckCacheTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+  FilePath mCacheFp;
+
+  LibraryElementCheckCacheTest() {
+    mTempDir = FilePath::getRandomTempPath();
+    QDir().mkpath(mTempDir.toStr());
+    mCacheFp = mTempDir.getPathTo("cache.sqlite");
+  }
+
+  virtual ~LibraryElementCheckCacheTest() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  QByteArray calculateKey(const QHash<QString, QByteArray>& files) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(
+            mTempDir.getPathTo(Uuid::createRandom().toStr()));
+    TransactionalDirectory dir(fs);
+    for (auto it = files.constBegin(); it != files.constEnd(); ++it) {
+      dir.write(it.key(), it.value());
+    }
+    return LibraryElementCheckCache::calculateKey(dir);
+  }
+
+  static LibraryElementCheckMessageList createMessages() {
+    return LibraryElementCheckMessageList{
+        std::make_shared<MsgMissingAuthor>()};
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryElementCheckCacheTest, testKeyDependsOnContent) {
+  QByteArray key = calculateKey({{"a.lp", "foo"}, {"sub/b.lp", "bar"}});
+  EXPECT_EQ(key, calculateKey({{"a.lp", "foo"}, {"sub/b.lp", "bar"}}));
+  EXPECT_NE(key, calculateKey({{"a.lp", "foo"}, {"sub/b.lp", "baz"}}));
+  EXPECT_NE(key, calculateKey({{"a.lp", "foo"}, {"b.lp", "bar"}}));
+  EXPECT_NE(key, calculateKey({{"a.lp", "foob"}, {"sub/b.lp", "ar"}}));
+}
+
+TEST_F(LibraryElementCheckCacheTest, testKeyIgnoresHiddenDirectories) {
+  QByteArray key = calculateKey({{"a.lp", "foo"}, {".librepcb-pkg", "1"}});
+  EXPECT_EQ(key, calculateKey({{"a.lp", "foo"},
+                               {".librepcb-pkg", "1"},
+                               {".git/HEAD", "master"}}));
+  EXPECT_NE(key, calculateKey({{"a.lp", "foo"}, {".librepcb-pkg", "2"}}));
+}
+
+TEST_F(LibraryElementCheckCacheTest, testFindInsertedEntry) {
+  LibraryElementCheckCache       cache(mCacheFp, "1");
+  LibraryElementCheckMessageList messages = createMessages();
+  EXPECT_FALSE(cache.find("key"));
+  cache.insert("key", messages);
+  tl::optional<LibraryElementCheckMessageList> cached = cache.find("key");
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(messages, *cached);
+  EXPECT_EQ(1U, cache.getHitCount());
+  EXPECT_EQ(1U, cache.getMissCount());
+}
+
+TEST_F(LibraryElementCheckCacheTest, testSaveAndReopen) {
+  LibraryElementCheckMessageList messages = createMessages();
+  {
+    LibraryElementCheckCache cache(mCacheFp, "1");
+    cache.insert("key", messages);
+    cache.insert("empty", LibraryElementCheckMessageList());
+    cache.save();
+  }
+  LibraryElementCheckCache cache(mCacheFp, "1");
+  EXPECT_EQ(2, cache.getEntryCount());
+  tl::optional<LibraryElementCheckMessageList> cached = cache.find("key");
+  ASSERT_TRUE(cached);
+  ASSERT_EQ(1, cached->count());
+  EXPECT_EQ(*messages.first(), *cached->first());
+  cached = cache.find("empty");
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(0, cached->count());
+}
+
+TEST_F(LibraryElementCheckCacheTest, testOtherVersionIsDiscarded) {
+  {
+    LibraryElementCheckCache cache(mCacheFp, "1");
+    cache.insert("key", createMessages());
+    cache.save();
+  }
+  LibraryElementCheckCache cache(mCacheFp, "2");
+  EXPECT_EQ(0, cache.getEntryCount());
+  EXPECT_FALSE(cache.find("key"));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/libraryelementmetadata.h>
+#include <librepcb/library/pkg/package.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryElementMetadataTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+
+  LibraryElementMetadataTest() { mTempDir = FilePath::getRandomTempPath(); }
+
+  virtual ~LibraryElementMetadataTest() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  std::shared_ptr<TransactionalFileSystem> save(LibraryBaseElement& element) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(
+            mTempDir.getPathTo(element.getUuid().toStr()));
+    TransactionalDirectory dir(fs);
+    element.saveTo(dir);
+    return fs;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryElementMetadataTest, testPackage) {
+  Package pkg(Uuid::createRandom(), Version::fromString("1.2"), "author",
+              ElementName("Package"), "description", "keywords");
+  pkg.getNames().insert("de_DE", ElementName("Gehäuse"));
+  pkg.setCategories({Uuid::createRandom(), Uuid::createRandom()});
+  pkg.getFootprints().append(std::make_shared<Footprint>(
+      Uuid::createRandom(), ElementName("Footprint"), "footprint"));
+  std::shared_ptr<TransactionalFileSystem> fs = save(pkg);
+
+  TransactionalDirectory dir(fs);
+  LibraryElementMetadata metadata = LibraryElementMetadata::read<Package>(dir);
+  EXPECT_EQ(pkg.getUuid(), metadata.getUuid());
+  EXPECT_EQ(pkg.getVersion(), metadata.getVersion());
+  EXPECT_EQ(pkg.getNames(), metadata.getNames());  // not the footprint's name
+  EXPECT_EQ(pkg.getDescriptions(), metadata.getDescriptions());
+  EXPECT_EQ(pkg.getKeywords(), metadata.getKeywords());
+  EXPECT_EQ(pkg.getAllAvailableLocales(), metadata.getAllAvailableLocales());
+  EXPECT_EQ(pkg.getCategories(), metadata.getCategories());
+  EXPECT_FALSE(metadata.getParentUuid());
+  EXPECT_FALSE(metadata.getComponentUuid());
+  EXPECT_FALSE(metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testDevice) {
+  Uuid   cmpUuid = Uuid::createRandom();
+  Uuid   pkgUuid = Uuid::createRandom();
+  Device dev(Uuid::createRandom(), Version::fromString("1"), "author",
+             ElementName("Device"), "", "", cmpUuid, pkgUuid);
+  std::shared_ptr<TransactionalFileSystem> fs = save(dev);
+
+  TransactionalDirectory dir(fs);
+  LibraryElementMetadata metadata = LibraryElementMetadata::read<Device>(dir);
+  EXPECT_EQ(dev.getUuid(), metadata.getUuid());
+  EXPECT_EQ(tl::make_optional(cmpUuid), metadata.getComponentUuid());
+  EXPECT_EQ(tl::make_optional(pkgUuid), metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testWrongElementType) {
+  Package pkg(Uuid::createRandom(), Version::fromString("1"), "author",
+              ElementName("Package"), "", "");
+  std::shared_ptr<TransactionalFileSystem> fs = save(pkg);
+
+  TransactionalDirectory dir(fs);
+  EXPECT_THROW(LibraryElementMetadata::read<Device>(dir), RuntimeError);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,108 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/library/pkg/padarraygenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PadArrayGeneratorTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PadArrayGeneratorTest, testGridRowNames) {
+  EXPECT_EQ("A", PadArrayGenerator::getGridRowName(0));
+  EXPECT_EQ("H", PadArrayGenerator::getGridRowName(7));
+  EXPECT_EQ("J", PadArrayGenerator::getGridRowName(8));  // no "I"
+  EXPECT_EQ("Y", PadArrayGenerator::getGridRowName(19));
+  EXPECT_EQ("AA", PadArrayGenerator::getGridRowName(20));
+  EXPECT_EQ("AB", PadArrayGenerator::getGridRowName(21));
+  EXPECT_EQ("BA", PadArrayGenerator::getGridRowName(40));
+}
+
+TEST_F(PadArrayGeneratorTest, testGrid) {
+  QVector<PadArrayGenerator::Pad> pads = PadArrayGenerator::generateGrid(
+      3, 2, PositiveLength(1000000), PositiveLength(2000000), false);
+  ASSERT_EQ(6, pads.count());
+  EXPECT_EQ("A1", pads.at(0).name);
+  EXPECT_EQ(Point(-1000000, 1000000), pads.at(0).position);
+  EXPECT_EQ("A3", pads.at(2).name);
+  EXPECT_EQ(Point(1000000, 1000000), pads.at(2).position);
+  EXPECT_EQ("B2", pads.at(4).name);
+  EXPECT_EQ(Point(0, -1000000), pads.at(4).position);
+}
+
+TEST_F(PadArrayGeneratorTest, testStaggeredGrid) {
+  QVector<PadArrayGenerator::Pad> pads = PadArrayGenerator::generateGrid(
+      4, 2, PositiveLength(1000000), PositiveLength(1000000), true);
+  ASSERT_EQ(4, pads.count());
+  EXPECT_EQ("A1", pads.at(0).name);
+  EXPECT_EQ("A3", pads.at(1).name);
+  EXPECT_EQ("B2", pads.at(2).name);
+  EXPECT_EQ("B4", pads.at(3).name);
+  EXPECT_EQ(Point(-500000, -500000), pads.at(2).position);
+}
+
+TEST_F(PadArrayGeneratorTest, testPerimeter) {
+  QVector<PadArrayGenerator::Pad> pads = PadArrayGenerator::generatePerimeter(
+      2, 3, PositiveLength(500000), PositiveLength(4000000),
+      PositiveLength(6000000));
+  ASSERT_EQ(10, pads.count());
+  EXPECT_EQ("1", pads.at(0).name);
+  EXPECT_EQ(Point(-2000000, 500000), pads.at(0).position);
+  EXPECT_EQ(Angle::deg0(), pads.at(0).rotation);
+  EXPECT_EQ(Point(-250000, -3000000), pads.at(3).position);  // bottom side
+  EXPECT_EQ(Angle::deg90(), pads.at(3).rotation);
+  EXPECT_EQ(Point(2000000, -500000), pads.at(5).position);  // right side
+  EXPECT_EQ("10", pads.at(9).name);
+  EXPECT_EQ(Point(-250000, 3000000), pads.at(9).position);  // top side
+}
+
+TEST_F(PadArrayGeneratorTest, testDualInLine) {
+  QVector<PadArrayGenerator::Pad> pads = PadArrayGenerator::generatePerimeter(
+      0, 4, PositiveLength(2540000), PositiveLength(7620000),
+      PositiveLength(1));
+  ASSERT_EQ(8, pads.count());
+  EXPECT_EQ(Point(-3810000, 3810000), pads.at(0).position);
+  EXPECT_EQ(Point(3810000, 3810000), pads.at(7).position);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardassemblyexport.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardAssemblyExportTest : public ::testing::Test {
+protected:
+  static Project* openProject() {
+    FilePath projectFp(
+        TEST_DATA_DIR
+        "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest"
+        "/test_project/test_project.lpp");
+    return new Project(std::unique_ptr<TransactionalDirectory>(
+                           new TransactionalDirectory(
+                               TransactionalFileSystem::openRO(
+                                   projectFp.getParentDir()))),
+                       projectFp.getFilename(), true, true);
+  }
+
+  static QList<QByteArray> getRows(const QByteArray& csv) noexcept {
+    QList<QByteArray> rows = csv.split('\n');
+    EXPECT_TRUE(rows.last().isEmpty());  // ends with a newline
+    rows.removeLast();
+    return rows;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardAssemblyExportTest, testBomContainsAllDevices) {
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  board->load(false);
+  ASSERT_FALSE(board->getDeviceInstances().isEmpty());
+
+  BoardAssemblyExport export_(*board);
+  QList<QByteArray>   rows = getRows(export_.generateBom());
+  ASSERT_GE(rows.count(), 2);
+  EXPECT_TRUE(rows.first().startsWith("\"Quantity\","));
+  int quantity = 0;
+  for (int i = 1; i < rows.count(); ++i) {
+    quantity += rows.at(i).mid(1, rows.at(i).indexOf('"', 1) - 1).toInt();
+  }
+  EXPECT_EQ(board->getDeviceInstances().count(), quantity);
+}
+
+TEST_F(BoardAssemblyExportTest, testPickPlaceContainsAllDevices) {
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  board->load(false);
+
+  BoardAssemblyExport export_(*board);
+  QList<QByteArray>   rows = getRows(export_.generatePickPlace());
+  ASSERT_FALSE(rows.isEmpty());
+  EXPECT_TRUE(rows.first().startsWith("\"Designator\","));
+  EXPECT_EQ(board->getDeviceInstances().count() + 1, rows.count());
+  for (int i = 1; i < rows.count(); ++i) {
+    EXPECT_TRUE(rows.at(i).endsWith(",\"top\"") ||
+                rows.at(i).endsWith(",\"bottom\""));
+  }
+}
+
+TEST_F(BoardAssemblyExportTest, testLoadWithoutPlanes) {
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  board->load(false);
+  ASSERT_FALSE(board->getPlanes().isEmpty());
+  foreach (const BI_Plane* plane, board->getPlanes()) {
+    EXPECT_TRUE(plane->getFragments().isEmpty());
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -0,0 +1,187 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardDesignRuleCheckTest : public ::testing::Test {
+protected:
+  typedef BoardDesignRuleCheck::Object   Object;
+  typedef BoardDesignRuleCheck::Snapshot Snapshot;
+
+  static Object createRect(const QString& key, const tl::optional<Uuid>& net,
+                           qint64 left, qint64 top, qint64 right,
+                           qint64 bottom) noexcept {
+    return Object{key,
+                  key,
+                  net,
+                  ClipperLib::Path{ClipperLib::IntPoint(left, top),
+                                   ClipperLib::IntPoint(right, top),
+                                   ClipperLib::IntPoint(right, bottom),
+                                   ClipperLib::IntPoint(left, bottom)},
+                  ClipperLib::IntRect{left, top, right, bottom}};
+  }
+
+  static Snapshot createSnapshot(const QVector<Object>& objects) noexcept {
+    return Snapshot{UnsignedLength(200000), {{"top_cu", objects}}};
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardDesignRuleCheckTest, testObjectsTooClose) {
+  Uuid                 net1 = Uuid::createRandom();
+  Uuid                 net2 = Uuid::createRandom();
+  BoardDesignRuleCheck drc;
+  drc.check(createSnapshot({
+      createRect("a", net1, 0, 0, 1000000, 1000000),
+      createRect("b", net2, 1100000, 0, 2000000, 1000000),
+  }));
+  ASSERT_EQ(1, drc.getViolations().count());
+  EXPECT_EQ("top_cu", drc.getViolations().first().layer);
+  EXPECT_EQ("a", drc.getViolations().first().object1);
+  EXPECT_EQ("b", drc.getViolations().first().object2);
+  EXPECT_EQ(Length(1050000), drc.getViolations().first().position.getX());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testObjectsFarEnoughApart) {
+  BoardDesignRuleCheck drc;
+  drc.check(createSnapshot({
+      createRect("a", Uuid::createRandom(), 0, 0, 1000000, 1000000),
+      createRect("b", Uuid::createRandom(), 1200000, 0, 2000000, 1000000),
+  }));
+  EXPECT_EQ(0, drc.getViolations().count());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testObjectsOfSameNetSignal) {
+  Uuid                 net = Uuid::createRandom();
+  BoardDesignRuleCheck drc;
+  drc.check(createSnapshot({
+      createRect("a", net, 0, 0, 1000000, 1000000),
+      createRect("b", net, 500000, 0, 2000000, 1000000),
+  }));
+  EXPECT_EQ(0, drc.getViolations().count());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testUnconnectedObjects) {
+  BoardDesignRuleCheck drc;
+  drc.check(createSnapshot({
+      createRect("a", tl::nullopt, 0, 0, 1000000, 1000000),
+      createRect("b", tl::nullopt, 1100000, 0, 2000000, 1000000),
+  }));
+  EXPECT_EQ(1, drc.getViolations().count());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testContainedObject) {
+  BoardDesignRuleCheck drc;
+  drc.check(createSnapshot({
+      createRect("a", Uuid::createRandom(), 0, 0, 1000000, 1000000),
+      createRect("b", Uuid::createRandom(), 400000, 400000, 600000, 600000),
+  }));
+  EXPECT_EQ(1, drc.getViolations().count());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testIncrementalCheck) {
+  Uuid                 net1 = Uuid::createRandom();
+  Uuid                 net2 = Uuid::createRandom();
+  Uuid                 net3 = Uuid::createRandom();
+  BoardDesignRuleCheck drc;
+  Object               a = createRect("a", net1, 0, 0, 1000000, 1000000);
+  Object b = createRect("b", net2, 1100000, 0, 2000000, 1000000);
+  Object c = createRect("c", net3, 5000000, 0, 6000000, 1000000);
+  drc.check(createSnapshot({a, b, c}));
+  EXPECT_EQ(3, drc.getCheckedObjectsCount());
+  QVector<BoardDesignRuleCheck::Violation> violations = drc.getViolations();
+  ASSERT_EQ(1, violations.count());
+
+  // unmodified objects are not checked again
+  drc.check(createSnapshot({a, b, c}));
+  EXPECT_EQ(0, drc.getCheckedObjectsCount());
+  EXPECT_EQ(violations, drc.getViolations());
+
+  // move "c" close to "b"
+  c = createRect("c", net3, 2100000, 0, 3000000, 1000000);
+  drc.check(createSnapshot({a, b, c}));
+  EXPECT_EQ(1, drc.getCheckedObjectsCount());
+  EXPECT_EQ(2, drc.getViolations().count());
+
+  // remove "b"
+  drc.check(createSnapshot({a, c}));
+  EXPECT_EQ(0, drc.getViolations().count());
+
+  // the result must be the same as a full check
+  drc.check(createSnapshot({a, b, c}));
+  QVector<BoardDesignRuleCheck::Violation> incremental = drc.getViolations();
+  drc.reset();
+  drc.check(createSnapshot({a, b, c}));
+  EXPECT_EQ(3, drc.getCheckedObjectsCount());
+  EXPECT_EQ(incremental, drc.getViolations());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testProjectIsDeterministic) {
+  FilePath projectFp(TEST_DATA_DIR
+                     "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest"
+                     "/test_project/test_project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+  Board* board = project->getBoards().first();
+  board->rebuildAllPlanes();
+
+  QVector<BoardDesignRuleCheck::Violation> violations =
+      board->runDesignRuleCheck().getViolations();
+  EXPECT_EQ(violations, board->runDesignRuleCheck().getViolations());
+  EXPECT_EQ(0, board->runDesignRuleCheck().getCheckedObjectsCount());
+
+  BoardDesignRuleCheck drc;
+  drc.check(BoardDesignRuleCheck::createSnapshot(*board));
+  EXPECT_EQ(violations, drc.getViolations());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -23,7 +23,10 @@
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/utils/clipperhelpers.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardplanefragmentsbuilder.h>
+#include <librepcb/project/boards/items/bi_device.h>
 #include <librepcb/project/boards/items/bi_plane.h>
 #include <librepcb/project/project.h>
 
@@ -70,7 +73,7 @@ TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
 
   // force planes rebuild
   Board* board = project->getBoards().first();
-  board->rebuildAllPlanes();
+  board->rebuildAllPlanesForFabrication();
 
   // determine actual plane fragments
   QMap<Uuid, QSet<Path>> actualPlaneFragments;
@@ -98,10 +101,10 @@ TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
   SExpression expectedSexpr =
       SExpression::parse(FileUtils::readFile(expectedFp), expectedFp);
   QMap<Uuid, QSet<Path>> expectedPlaneFragments;
-  foreach (const SExpression& child, expectedSexpr.getChildren("plane")) {
-    Uuid uuid = child.getValueOfFirstChild<Uuid>();
-    foreach (const SExpression& fragmentChild, child.getChildren("fragment")) {
-      expectedPlaneFragments[uuid].insert(Path(fragmentChild));
+  foreach (const SExpression* child, expectedSexpr.getChildren("plane")) {
+    Uuid uuid = child->getValueOfFirstChild<Uuid>();
+    foreach (const SExpression* fragmentChild, child->getChildren("fragment")) {
+      expectedPlaneFragments[uuid].insert(Path(*fragmentChild));
     }
   }
 
@@ -109,6 +112,207 @@ TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
   EXPECT_EQ(expectedPlaneFragments, actualPlaneFragments);
 }
 
+TEST(BoardPlaneFragmentsBuilderTest, testRebuildWithoutModifications) {
+  FilePath testDataDir(
+      TEST_DATA_DIR
+      "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest");
+
+  // open project from test data directory
+  FilePath projectFp = testDataDir.getPathTo("test_project/test_project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+
+  // rebuilding planes incrementally must not modify unaffected fragments
+  Board* board = project->getBoards().first();
+  board->rebuildAllPlanes();
+  QMap<Uuid, QVector<Path>> fragments;
+  foreach (const BI_Plane* plane, board->getPlanes()) {
+    fragments[plane->getUuid()] = plane->getFragments();
+  }
+  board->rebuildAllPlanes();
+  foreach (const BI_Plane* plane, board->getPlanes()) {
+    EXPECT_EQ(fragments[plane->getUuid()], plane->getFragments());
+  }
+}
+
+TEST(BoardPlaneFragmentsBuilderTest, testIncrementalRebuildAfterModification) {
+  FilePath testDataDir(
+      TEST_DATA_DIR
+      "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest");
+  FilePath projectFp = testDataDir.getPathTo("test_project/test_project.lpp");
+
+  // open the project twice from the test data directory
+  QScopedPointer<Project> project(new Project(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+          TransactionalFileSystem::openRO(projectFp.getParentDir()))),
+      projectFp.getFilename()));
+  QScopedPointer<Project> reference(new Project(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+          TransactionalFileSystem::openRO(projectFp.getParentDir()))),
+      projectFp.getFilename()));
+  Board* board          = project->getBoards().first();
+  Board* referenceBoard = reference->getBoards().first();
+  ASSERT_FALSE(board->getDeviceInstances().isEmpty());
+
+  // build the planes, then move a device so only some tiles become dirty and
+  // rebuild the planes incrementally
+  board->rebuildAllPlanes();
+  const Point offset(1000000, 500000);
+  BI_Device*  device = board->getDeviceInstances().first();
+  device->setPosition(device->getPosition() + offset);
+  board->rebuildAllPlanes();
+
+  // apply the same modification to the reference board, but build its planes
+  // only once, i.e. from scratch
+  BI_Device* referenceDevice = referenceBoard->getDeviceInstances().value(
+      device->getComponentInstanceUuid());
+  ASSERT_TRUE(referenceDevice);
+  referenceDevice->setPosition(referenceDevice->getPosition() + offset);
+  referenceBoard->rebuildAllPlanes();
+
+  // Note: The tile borders may lead to different (but collinear) vertices, so
+  // the covered areas are compared instead of the paths.
+  ASSERT_EQ(referenceBoard->getPlanes().count(), board->getPlanes().count());
+  for (int i = 0; i < board->getPlanes().count(); ++i) {
+    const BI_Plane* plane          = board->getPlanes().at(i);
+    const BI_Plane* referencePlane = referenceBoard->getPlanes().at(i);
+    ASSERT_EQ(referencePlane->getUuid(), plane->getUuid());
+    ClipperLib::Clipper c;
+    c.AddPaths(ClipperHelpers::convert(referencePlane->getFragments(),
+                                       PositiveLength(5000)),
+               ClipperLib::ptSubject, true);
+    c.AddPaths(ClipperHelpers::convert(plane->getFragments(),
+                                       PositiveLength(5000)),
+               ClipperLib::ptClip, true);
+    ClipperLib::Paths difference;
+    c.Execute(ClipperLib::ctXor, difference, ClipperLib::pftEvenOdd,
+              ClipperLib::pftEvenOdd);
+    double area = 0;
+    for (const ClipperLib::Path& path : difference) {
+      area += std::abs(ClipperLib::Area(path));
+    }
+    EXPECT_LT(area, 1000000.0);  // less than 1um^2
+  }
+}
+
+TEST(BoardPlaneFragmentsBuilderTest, testFabricationRebuildAfterModifications) {
+  FilePath testDataDir(
+      TEST_DATA_DIR
+      "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest");
+  FilePath projectFp = testDataDir.getPathTo("test_project/test_project.lpp");
+
+  // open the project twice from the test data directory
+  QScopedPointer<Project> project(new Project(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+          TransactionalFileSystem::openRO(projectFp.getParentDir()))),
+      projectFp.getFilename()));
+  QScopedPointer<Project> reference(new Project(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+          TransactionalFileSystem::openRO(projectFp.getParentDir()))),
+      projectFp.getFilename()));
+  Board* board          = project->getBoards().first();
+  Board* referenceBoard = reference->getBoards().first();
+  ASSERT_FALSE(board->getDeviceInstances().isEmpty());
+
+  // move a device several times and rebuild the planes incrementally after
+  // every move, like the board editor does
+  const QList<Point> offsets = {Point(1000000, 500000), Point(-300000, 0),
+                                Point(0, 2000000)};
+  BI_Device*         device  = board->getDeviceInstances().first();
+  board->rebuildAllPlanes();
+  foreach (const Point& offset, offsets) {
+    device->setPosition(device->getPosition() + offset);
+    board->rebuildAllPlanes();
+  }
+  board->rebuildAllPlanesForFabrication();
+
+  // apply the same modifications to the reference board, but build its planes
+  // only once, i.e. from scratch
+  BI_Device* referenceDevice = referenceBoard->getDeviceInstances().value(
+      device->getComponentInstanceUuid());
+  ASSERT_TRUE(referenceDevice);
+  foreach (const Point& offset, offsets) {
+    referenceDevice->setPosition(referenceDevice->getPosition() + offset);
+  }
+  referenceBoard->rebuildAllPlanesForFabrication();
+
+  // the fabrication output must not depend on the previous incremental builds
+  ASSERT_EQ(referenceBoard->getPlanes().count(), board->getPlanes().count());
+  for (int i = 0; i < board->getPlanes().count(); ++i) {
+    const BI_Plane* plane          = board->getPlanes().at(i);
+    const BI_Plane* referencePlane = referenceBoard->getPlanes().at(i);
+    ASSERT_EQ(referencePlane->getUuid(), plane->getUuid());
+    EXPECT_EQ(referencePlane->getFragments(), plane->getFragments());
+  }
+}
+
+TEST(BoardPlaneFragmentsBuilderTest, testBoardAreaCache) {
+  QVector<Path> outlines = {Path::centeredRect(PositiveLength(10000000),
+                                               PositiveLength(10000000))};
+  BoardAreaCache cache;
+  std::shared_ptr<const ClipperLib::Paths> area1 = cache.get(
+      outlines, UnsignedLength(100000), PositiveLength(5000));
+  std::shared_ptr<const ClipperLib::Paths> area2 = cache.get(
+      outlines, UnsignedLength(200000), PositiveLength(5000));
+  ASSERT_TRUE(area1 && area2);
+  EXPECT_NE(area1, area2);
+  EXPECT_FALSE(area1->empty());
+
+  // same parameters must return the cached area
+  EXPECT_EQ(area1, cache.get(outlines, UnsignedLength(100000),
+                             PositiveLength(5000)));
+
+  // modified outlines must invalidate the cache
+  outlines.append(Path::circle(PositiveLength(1000000)));
+  EXPECT_NE(area1, cache.get(outlines, UnsignedLength(100000),
+                             PositiveLength(5000)));
+}
+
+TEST(BoardPlaneFragmentsBuilderTest, testFingerprint) {
+  typedef BoardPlaneFragmentsBuilder Builder;
+
+  Uuid              other   = Uuid::createRandom();
+  ClipperLib::Path  cutOut1 = {ClipperLib::IntPoint(0, 0),
+                              ClipperLib::IntPoint(1000, 0),
+                              ClipperLib::IntPoint(1000, 1000)};
+  ClipperLib::Path  cutOut2 = {ClipperLib::IntPoint(5000, 0),
+                              ClipperLib::IntPoint(6000, 0),
+                              ClipperLib::IntPoint(6000, 1000)};
+  Builder::Snapshot snapshot{
+      Uuid::createRandom(),
+      Builder::Quality::Draft,
+      Builder::getMaxArcTolerance(Builder::Quality::Draft),
+      Path::centeredRect(PositiveLength(10000000), PositiveLength(10000000)),
+      UnsignedLength(200000),
+      UnsignedLength(300000),
+      false,
+      nullptr,
+      {other},
+      {cutOut1, cutOut2},
+      {},
+      {}};
+  QHash<Uuid, QByteArray> fingerprints = {{other, QByteArray("a")}};
+  QByteArray fingerprint = Builder::calcFingerprint(snapshot, fingerprints);
+
+  // the order of the cut-outs does not matter
+  Builder::Snapshot reordered = snapshot;
+  reordered.cutOuts           = {cutOut2, cutOut1};
+  EXPECT_EQ(fingerprint, Builder::calcFingerprint(reordered, fingerprints));
+
+  // modified inputs must change the fingerprint
+  Builder::Snapshot modified = snapshot;
+  modified.minClearance      = UnsignedLength(400000);
+  EXPECT_NE(fingerprint, Builder::calcFingerprint(modified, fingerprints));
+
+  // modified planes to subtract must change the fingerprint as well
+  EXPECT_NE(fingerprint,
+            Builder::calcFingerprint(snapshot, {{other, QByteArray("b")}}));
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
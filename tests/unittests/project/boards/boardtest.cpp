@@ -0,0 +1,178 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/scopeguard.h>
+#include <librepcb/common/utils/performancecounters.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardTest : public ::testing::Test {
+protected:
+  FilePath mProjectDir;
+  FilePath mProjectFile;
+
+  BoardTest() {
+    mProjectDir  = FilePath::getRandomTempPath();
+    mProjectFile = mProjectDir.getPathTo("test_project.lpp");
+    FileUtils::copyDirRecursively(
+        FilePath(TEST_DATA_DIR
+                 "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest"
+                 "/test_project"),
+        mProjectDir);
+  }
+
+  virtual ~BoardTest() { QDir(mProjectDir.toStr()).removeRecursively(); }
+
+  Project* openProject() const {
+    return new Project(std::unique_ptr<TransactionalDirectory>(
+                           new TransactionalDirectory(
+                               TransactionalFileSystem::openRW(mProjectDir))),
+                       mProjectFile.getFilename());
+  }
+
+  static NetSignal::RoutingStatistics calcRoutingStatistics(
+      const Board& board, const NetSignal& netsignal) noexcept {
+    NetSignal::RoutingStatistics stats{};
+    foreach (const BI_NetSegment* netsegment, board.getNetSegments()) {
+      if (&netsegment->getNetSignal() != &netsignal) continue;
+      foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+        stats.trackLength += (netline->getEndPoint().getPosition() -
+                              netline->getStartPoint().getPosition())
+                                 .getLength();
+      }
+      stats.viaCount += netsegment->getVias().count();
+    }
+    return stats;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardTest, testRoutingStatistics) {
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  ASSERT_FALSE(board->getNetSegments().isEmpty());
+  BI_NetSegment* netsegment = board->getNetSegments().first();
+  NetSignal&     netsignal  = netsegment->getNetSignal();
+  ASSERT_FALSE(netsegment->getNetPoints().isEmpty());
+
+  // after loading
+  NetSignal::RoutingStatistics expected =
+      calcRoutingStatistics(*board, netsignal);
+  EXPECT_GT(expected.trackLength, 0);
+  EXPECT_EQ(expected.trackLength,
+            netsignal.getBoardRoutingStatistics(*board).trackLength);
+  EXPECT_EQ(expected.viaCount,
+            netsignal.getBoardRoutingStatistics(*board).viaCount);
+
+  // after moving a netpoint
+  BI_NetPoint* netpoint = netsegment->getNetPoints().first();
+  netpoint->setPosition(netpoint->getPosition() + Point(1000000, 2000000));
+  expected = calcRoutingStatistics(*board, netsignal);
+  EXPECT_EQ(expected.trackLength,
+            netsignal.getBoardRoutingStatistics(*board).trackLength);
+
+  // after removing the net segment
+  board->removeNetSegment(*netsegment);
+  expected = calcRoutingStatistics(*board, netsignal);
+  EXPECT_EQ(expected.trackLength,
+            netsignal.getBoardRoutingStatistics(*board).trackLength);
+  EXPECT_EQ(expected.viaCount,
+            netsignal.getBoardRoutingStatistics(*board).viaCount);
+  board->addNetSegment(*netsegment);
+}
+
+TEST_F(BoardTest, testPerformanceCounters) {
+  typedef PerformanceCounters::Counter Counter;
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  ASSERT_FALSE(board->getPlanes().isEmpty());
+  ASSERT_FALSE(board->getNetSegments().isEmpty());
+  PerformanceCounters::reset();
+  PerformanceCounters::setEnabled(true);
+  auto guard = scopeGuard([]() {
+    PerformanceCounters::setEnabled(false);
+    PerformanceCounters::reset();
+  });
+
+  // every plane is built exactly once
+  board->rebuildAllPlanes();
+  EXPECT_EQ(board->getPlanes().count(),
+            PerformanceCounters::get(Counter::PlaneRebuilds));
+  EXPECT_GT(PerformanceCounters::get(Counter::ClipperExecutions), 0);
+
+  // airwires of unmodified net signals are not built again
+  board->forceAirWiresRebuild();
+  PerformanceCounters::reset();
+  board->forceAirWiresRebuild();
+  EXPECT_EQ(0, PerformanceCounters::get(Counter::AirWireRebuilds));
+
+  // moving a netpoint only rebuilds the airwires of its net signal
+  BI_NetSegment* netsegment = board->getNetSegments().first();
+  ASSERT_FALSE(netsegment->getNetPoints().isEmpty());
+  BI_NetPoint* netpoint = netsegment->getNetPoints().first();
+  netpoint->setPosition(netpoint->getPosition() + Point(1000000, 0));
+  board->triggerAirWiresRebuild();
+  EXPECT_EQ(1, PerformanceCounters::get(Counter::AirWireRebuilds));
+  EXPECT_EQ(0, PerformanceCounters::get(Counter::PlaneRebuilds));
+}
+
+TEST_F(BoardTest, testGerberExportIsReproducible) {
+  QScopedPointer<Project> project(openProject());
+  Board*                  board = project->getBoards().first();
+  board->rebuildAllPlanes();
+  BoardGerberExport exp(*board, board->getFabricationOutputSettings());
+  EXPECT_EQ(QVector<FilePath>(), exp.verifyReproducibility());
+  EXPECT_FALSE(exp.getOutputDirectory().isExistingDir());  // nothing written
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
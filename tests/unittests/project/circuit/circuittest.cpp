@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../newprojectfixture.h"
+
+#include <gtest/gtest.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class CircuitTest : public NewProjectFixture {
+protected:
+  NetSignal* addNetSignal(const QString& name) {
+    Circuit&                  circuit = mProject->getCircuit();
+    QScopedPointer<NetSignal> netsignal(
+        new NetSignal(circuit, *circuit.getNetClasses().first(),
+                      CircuitIdentifier(name), true));
+    circuit.addNetSignal(*netsignal);  // can throw
+    return netsignal.take();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(CircuitTest, testGetNetSignalByName) {
+  Circuit&   circuit = mProject->getCircuit();
+  NetSignal* gnd     = addNetSignal("GND");
+  EXPECT_EQ(gnd, circuit.getNetSignalByName("GND"));
+  EXPECT_EQ(nullptr, circuit.getNetSignalByName("VCC"));
+  EXPECT_THROW(addNetSignal("GND"), RuntimeError);
+
+  circuit.setNetSignalName(*gnd, CircuitIdentifier("VCC"), false);
+  EXPECT_EQ(nullptr, circuit.getNetSignalByName("GND"));
+  EXPECT_EQ(gnd, circuit.getNetSignalByName("VCC"));
+
+  circuit.removeNetSignal(*gnd);
+  EXPECT_EQ(nullptr, circuit.getNetSignalByName("VCC"));
+  delete gnd;
+}
+
+TEST_F(CircuitTest, testGenerateAutoNetSignalName) {
+  Circuit& circuit = mProject->getCircuit();
+  EXPECT_EQ("N1", circuit.generateAutoNetSignalName());
+  EXPECT_EQ("N1", circuit.generateAutoNetSignalName());  // not added yet
+  NetSignal* n1 = addNetSignal("N1");
+  addNetSignal("N2");
+  addNetSignal("N4");
+  EXPECT_EQ("N3", circuit.generateAutoNetSignalName());
+  addNetSignal("N3");
+  EXPECT_EQ("N5", circuit.generateAutoNetSignalName());
+
+  // freed names are reused
+  circuit.setNetSignalName(*n1, CircuitIdentifier("GND"), false);
+  EXPECT_EQ("N1", circuit.generateAutoNetSignalName());
+  circuit.removeNetSignal(*n1);
+  delete n1;
+  EXPECT_EQ("N1", circuit.generateAutoNetSignalName());
+}
+
+TEST_F(CircuitTest, testGenerateAutoNetSignalNames) {
+  Circuit& circuit = mProject->getCircuit();
+  addNetSignal("N2");
+  addNetSignal("N3");
+  addNetSignal("N01");  // not an auto name
+  EXPECT_EQ(QStringList({"N1", "N4", "N5"}),
+            circuit.generateAutoNetSignalNames(3));
+  EXPECT_EQ(QStringList(), circuit.generateAutoNetSignalNames(0));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -0,0 +1,99 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../newprojectfixture.h"
+
+#include <gtest/gtest.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class NetClassTest : public NewProjectFixture {
+protected:
+  NetClass* parse(const QByteArray& content) {
+    SExpression root = SExpression::parse(content, FilePath());
+    return new NetClass(mProject->getCircuit(), root);  // can throw
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(NetClassTest, testParseWithoutAirWiresPolicy) {
+  QScopedPointer<NetClass> netclass(
+      parse("(netclass 8bd3bd24-a899-4b1e-9a0d-8d5c4e5e9c1a "
+            "(name \"default\"))"));
+  EXPECT_EQ(ElementName("default"), netclass->getName());
+  EXPECT_EQ(NetClass::AirWiresPolicy::Always, netclass->getAirWiresPolicy());
+
+  // the default policy must not be written, to keep files unmodified
+  SExpression sexpr = netclass->serializeToDomElement("netclass");
+  EXPECT_EQ(nullptr, sexpr.tryGetChildByPath("airwires"));
+}
+
+TEST_F(NetClassTest, testSerializeAndParse) {
+  QList<NetClass::AirWiresPolicy> policies = {
+      NetClass::AirWiresPolicy::Always,
+      NetClass::AirWiresPolicy::OnHighlight,
+      NetClass::AirWiresPolicy::Never,
+  };
+  foreach (NetClass::AirWiresPolicy policy, policies) {
+    NetClass obj1(mProject->getCircuit(), ElementName("foo"));
+    obj1.setAirWiresPolicy(policy);
+    SExpression sexpr1 = obj1.serializeToDomElement("netclass");
+
+    QScopedPointer<NetClass> obj2(parse(sexpr1.toByteArray()));
+    EXPECT_EQ(obj1.getUuid(), obj2->getUuid());
+    EXPECT_EQ(obj1.getName(), obj2->getName());
+    EXPECT_EQ(policy, obj2->getAirWiresPolicy());
+    SExpression sexpr2 = obj2->serializeToDomElement("netclass");
+    EXPECT_EQ(sexpr1.toByteArray(), sexpr2.toByteArray());
+  }
+}
+
+TEST_F(NetClassTest, testParseUnknownAirWiresPolicy) {
+  EXPECT_THROW(parse("(netclass 8bd3bd24-a899-4b1e-9a0d-8d5c4e5e9c1a "
+                     "(name \"default\") (airwires foo))"),
+               RuntimeError);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -122,6 +122,21 @@ TEST_F(ProjectLibraryTest, testLoadSymbol) {
             mExistingSymbolFile.size());  // not upgraded
 }
 
+TEST_F(ProjectLibraryTest, testLoadSymbolOnDemand) {
+  Uuid uuid = Uuid::fromString(mExistingSymbolFile.dir().dirName());
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  EXPECT_EQ(0, lib.getLoadedSymbols().count());
+  EXPECT_EQ(nullptr, lib.getSymbol(Uuid::createRandom()));
+  EXPECT_EQ(0, lib.getLoadedSymbols().count());
+  library::Symbol* symbol = lib.getSymbol(uuid);
+  ASSERT_NE(nullptr, symbol);
+  EXPECT_EQ(uuid, symbol->getUuid());
+  EXPECT_EQ(1, lib.getLoadedSymbols().count());
+  EXPECT_EQ(symbol, lib.getSymbol(uuid));
+  EXPECT_EQ(symbol, lib.getSymbols().value(uuid));
+}
+
 TEST_F(ProjectLibraryTest, testAddSymbol) {
   {
     ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
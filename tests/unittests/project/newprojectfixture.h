@@ -0,0 +1,75 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEWPROJECTFIXTURE_H
+#define NEWPROJECTFIXTURE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Class NewProjectFixture
+ ******************************************************************************/
+
+/**
+ * @brief Test fixture providing a newly created project in a temporary
+ *        directory which is removed again after the test
+ */
+class NewProjectFixture : public ::testing::Test {
+protected:
+  FilePath                mProjectDir;
+  QScopedPointer<Project> mProject;
+
+  NewProjectFixture() {
+    mProjectDir = FilePath::getRandomTempPath();
+    mProject.reset(Project::create(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRW(mProjectDir))),
+        "project.lpp"));
+  }
+
+  virtual ~NewProjectFixture() {
+    mProject.reset();
+    QDir(mProjectDir.toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // NEWPROJECTFIXTURE_H
@@ -22,6 +22,11 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/geometry/cmd/cmdpolygonedit.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
 #include <librepcb/project/metadata/projectmetadata.h>
 #include <librepcb/project/project.h>
 
@@ -191,6 +196,70 @@ TEST_F(ProjectTest, testSettersGetters) {
   EXPECT_EQ(version, project->getMetadata().getVersion());
 }
 
+TEST_F(ProjectTest, testAttributesChangedIsEmittedOnce) {
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  int emitted = 0;
+  QObject::connect(project.data(), &Project::attributesChanged,
+                   [&emitted]() { ++emitted; });
+
+  // modify several attributes within the same event loop iteration
+  project->getMetadata().setName(ElementName("new name"));
+  project->getMetadata().setAuthor("new author");
+  project->getMetadata().setVersion("new version");
+  EXPECT_EQ(0, emitted);
+
+  // the signal is emitted only once in the next event loop iteration
+  qApp->processEvents();
+  EXPECT_EQ(1, emitted);
+  qApp->processEvents();
+  EXPECT_EQ(1, emitted);
+}
+
+TEST_F(ProjectTest, testSaveUndoneEditOfInactiveBoard) {
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  Board* board = project->createBoard(ElementName("board 1"));
+  project->addBoard(*board);
+  project->addBoard(*project->createBoard(ElementName("board 2")));
+
+  // add a polygon to the first board
+  Path        path =
+      Path::centeredRect(PositiveLength(1000000), PositiveLength(1000000));
+  BI_Polygon* polygon =
+      new BI_Polygon(*board, Uuid::createRandom(),
+                     GraphicsLayerName(GraphicsLayer::sBoardOutlines),
+                     UnsignedLength(0), false, false, path);
+  board->addPolygon(*polygon);
+
+  // edit the polygon with a generic undo command which doesn't know the board
+  UndoStack                      undoStack;
+  QScopedPointer<CmdPolygonEdit> cmd(
+      new CmdPolygonEdit(polygon->getPolygon()));
+  cmd->setPath(Path::centeredRect(PositiveLength(2000000),
+                                  PositiveLength(2000000)),
+               false);
+  undoStack.execCmd(cmd.take());
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  EXPECT_FALSE(board->isModified());
+
+  // undo the edit, e.g. while the other board is active in the editor
+  undoStack.undo();
+  EXPECT_TRUE(board->isModified());
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+
+  // close and re-open project, the undo must have been saved
+  undoStack.clear();
+  project.reset();
+  project.reset(new Project(createDir(false), mProjectFile.getFilename()));
+  board = project->getBoardByName("board 1");
+  ASSERT_TRUE(board);
+  ASSERT_EQ(1, board->getPolygons().count());
+  EXPECT_EQ(path, board->getPolygons().first()->getPolygon().getPath());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
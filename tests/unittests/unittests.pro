@@ -26,7 +26,6 @@ LIBS += \
     -llibrepcbproject \
     -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
     -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
-    -lsexpresso \
     -lclipper \
     -lparseagle -lquazip -lz
 
@@ -47,7 +46,6 @@ DEPENDPATH += \
     ../../libs/librepcb/common \
     ../../libs/parseagle \
     ../../libs/quazip \
-    ../../libs/sexpresso \
     ../../libs/clipper \
 
 PRE_TARGETDEPS += \
@@ -58,18 +56,23 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcblibrary.a \
     $${DESTDIR}/liblibrepcbcommon.a \
     $${DESTDIR}/libquazip.a \
-    $${DESTDIR}/libsexpresso.a \
     $${DESTDIR}/libclipper.a \
 
 SOURCES += \
     common/applicationtest.cpp \
     common/attributes/attributesubstitutortest.cpp \
+    common/cam/camnumberformattertest.cpp \
+    common/cam/excellongeneratortest.cpp \
     common/fileio/directorylocktest.cpp \
     common/fileio/filepathtest.cpp \
+    common/fileio/pathtrietest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
+    common/fileio/sexpressioncachetest.cpp \
+    common/fileio/sexpressiontest.cpp \
     common/fileio/transactionaldirectorytest.cpp \
     common/fileio/transactionalfilesystemtest.cpp \
     common/geometry/pathtest.cpp \
+    common/graphics/graphicsscenetest.cpp \
     common/network/filedownloadtest.cpp \
     common/network/networkrequesttest.cpp \
     common/scopeguardtest.cpp \
@@ -77,29 +80,48 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/undostacktest.cpp \
     common/units/angletest.cpp \
     common/units/lengthsnaptest.cpp \
     common/units/lengthtest.cpp \
     common/units/pointtest.cpp \
     common/units/ratiotest.cpp \
+    common/utils/disjointsetstest.cpp \
+    common/utils/indexedlisttest.cpp \
+    common/utils/objectpooltest.cpp \
+    common/utils/performancecounterstest.cpp \
+    common/utils/profilertest.cpp \
+    common/utils/taskschedulertest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
     eagleimport/deviceconvertertest.cpp \
     eagleimport/devicesetconvertertest.cpp \
     eagleimport/packageconvertertest.cpp \
+    eagleimport/polygonsimplifiertest.cpp \
     eagleimport/symbolconvertertest.cpp \
     library/cmp/componentsymbolvariantitemtest.cpp \
     library/librarybaseelementtest.cpp \
+    library/libraryelementcachetest.cpp \
+    library/libraryelementcheckcachetest.cpp \
+    library/libraryelementmetadatatest.cpp \
+    library/pkg/padarraygeneratortest.cpp \
     main.cpp \
+    project/boards/boardassemblyexporttest.cpp \
+    project/boards/boarddesignrulechecktest.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
+    project/boards/boardtest.cpp \
+    project/circuit/circuittest.cpp \
+    project/circuit/netclasstest.cpp \
     project/library/projectlibrarytest.cpp \
     project/projecttest.cpp \
+    workspace/library/workspacelibrarydbtest.cpp \
     workspace/workspacetest.cpp \
 
 HEADERS += \
     common/attributes/attributeproviderdummy.h \
     common/fileio/serializableobjectmock.h \
     common/network/networkrequestbasesignalreceiver.h \
+    project/newprojectfixture.h \
 
 FORMS += \
 
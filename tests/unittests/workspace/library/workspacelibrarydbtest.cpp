@@ -0,0 +1,268 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/elements.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class WorkspaceLibraryDbTest : public ::testing::Test {
+protected:
+  FilePath                  mWsDir;
+  QScopedPointer<Workspace> mWs;
+
+  WorkspaceLibraryDbTest() {
+    mWsDir = FilePath::getRandomTempPath();
+    Workspace::createNewWorkspace(mWsDir);
+    mWs.reset(new Workspace(mWsDir));
+  }
+
+  virtual ~WorkspaceLibraryDbTest() {
+    mWs.reset();
+    QDir(mWsDir.toStr()).removeRecursively();
+  }
+
+  WorkspaceLibraryDb& db() { return mWs->getLibraryDb(); }
+
+  FilePath getLibraryPath(const QString& lib) const {
+    return mWs->getLocalLibrariesPath().getPathTo(lib % ".lplib");
+  }
+
+  void createLibrary(const QString& lib) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(getLibraryPath(lib));
+    TransactionalDirectory dir(fs);
+
+    library::Library element(Uuid::createRandom(), Version::fromString("0.1"),
+                             "test", ElementName(lib), "", "");
+    element.saveTo(dir);
+    fs->save();
+  }
+
+  FilePath saveElement(const QString&               lib,
+                       library::LibraryBaseElement& element) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(getLibraryPath(lib));
+    TransactionalDirectory dir(fs, element.getShortElementName());
+    element.saveIntoParentDirectory(dir);
+    fs->save();
+    return getLibraryPath(lib).getPathTo(element.getShortElementName() % "/" %
+                                         element.getUuid().toStr());
+  }
+
+  FilePath addSymbol(const QString& lib, const Uuid& uuid,
+                     const QString& version, const QString& name) {
+    library::Symbol sym(uuid, Version::fromString(version), "test",
+                        ElementName(name), "", "");
+    return saveElement(lib, sym);
+  }
+
+  FilePath addPackage(const QString& lib, const Uuid& uuid,
+                      const QString& name) {
+    library::Package pkg(uuid, Version::fromString("0.1"), "test",
+                         ElementName(name), "", "");
+    return saveElement(lib, pkg);
+  }
+
+  FilePath addDevice(const QString& lib, const Uuid& uuid, const Uuid& cmp,
+                     const Uuid& pkg) {
+    library::Device dev(uuid, Version::fromString("0.1"), "test",
+                        ElementName("Device"), "", "", cmp, pkg);
+    return saveElement(lib, dev);
+  }
+
+  void scanLibraries() {
+    QEventLoop loop;
+    QObject::connect(&db(), &WorkspaceLibraryDb::scanFinished, &loop,
+                     &QEventLoop::quit);
+    QTimer::singleShot(60000, &loop, &QEventLoop::quit);  // timeout
+    db().startLibraryRescan();
+    loop.exec();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetLatestElementsOfFoundAndMissingUuids) {
+  createLibrary("A");
+  Uuid     uuid1 = Uuid::createRandom();
+  Uuid     uuid2 = Uuid::createRandom();
+  Uuid     uuid3 = Uuid::createRandom();  // does not exist
+  FilePath fp1   = addSymbol("A", uuid1, "0.1", "Symbol 1");
+  FilePath fp2   = addSymbol("A", uuid2, "0.1", "Symbol 2");
+  scanLibraries();
+
+  QHash<Uuid, FilePath> expected = {{uuid1, fp1}, {uuid2, fp2}};
+  EXPECT_EQ(expected, db().getLatestElements<library::Symbol>(
+                          {uuid1, uuid2, uuid3}));
+  EXPECT_EQ(QHash<Uuid, FilePath>(),
+            db().getLatestElements<library::Symbol>({uuid3}));
+  EXPECT_EQ(QHash<Uuid, FilePath>(),
+            db().getLatestElements<library::Package>({uuid1}));
+  EXPECT_EQ(QHash<Uuid, FilePath>(),
+            db().getLatestElements<library::Symbol>(QSet<Uuid>()));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetLatestElementsPicksLatestVersion) {
+  createLibrary("A");
+  createLibrary("B");
+  createLibrary("C");
+  Uuid uuid = Uuid::createRandom();
+  addSymbol("A", uuid, "0.9", "Old");
+  FilePath latest = addSymbol("B", uuid, "0.10", "Latest");
+  addSymbol("C", uuid, "0.2", "Older");
+  scanLibraries();
+
+  QHash<Uuid, FilePath> elements =
+      db().getLatestElements<library::Symbol>({uuid});
+  EXPECT_EQ(1, elements.count());
+  EXPECT_EQ(latest, elements.value(uuid));
+  EXPECT_EQ(latest, db().getLatestSymbol(uuid));
+  EXPECT_EQ(3, db().getSymbols(uuid).count());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetElementNamesOfFoundAndMissingElements) {
+  createLibrary("A");
+  FilePath fp1 = addSymbol("A", Uuid::createRandom(), "0.1", "Symbol 1");
+  FilePath fp2 = addSymbol("A", Uuid::createRandom(), "0.1", "Symbol 2");
+  FilePath fp3 = getLibraryPath("A").getPathTo("sym/missing");
+  scanLibraries();
+
+  QHash<FilePath, QString> expected = {{fp1, "Symbol 1"}, {fp2, "Symbol 2"}};
+  EXPECT_EQ(expected, db().getElementNames<library::Symbol>(
+                          {fp1, fp2, fp3}, {"en_US"}));
+  EXPECT_EQ(QHash<FilePath, QString>(),
+            db().getElementNames<library::Symbol>({fp3}, {"en_US"}));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetDevicesOfComponentsAndTheirMetadata) {
+  createLibrary("A");
+  Uuid     cmp1   = Uuid::createRandom();
+  Uuid     cmp2   = Uuid::createRandom();
+  Uuid     cmp3   = Uuid::createRandom();  // has no devices
+  Uuid     pkg1   = Uuid::createRandom();
+  Uuid     pkg2   = Uuid::createRandom();  // does not exist
+  Uuid     dev1   = Uuid::createRandom();
+  Uuid     dev2   = Uuid::createRandom();
+  Uuid     dev3   = Uuid::createRandom();
+  FilePath devFp1 = addDevice("A", dev1, cmp1, pkg1);
+  FilePath devFp2 = addDevice("A", dev2, cmp1, pkg2);
+  FilePath devFp3 = addDevice("A", dev3, cmp2, pkg1);
+  FilePath pkgFp1 = addPackage("A", pkg1, "Package 1");
+  scanLibraries();
+
+  QMultiHash<Uuid, Uuid> devices =
+      db().getDevicesOfComponents({cmp1, cmp2, cmp3});
+  EXPECT_EQ(3, devices.count());
+  EXPECT_EQ(QSet<Uuid>({dev1, dev2}), devices.values(cmp1).toSet());
+  EXPECT_EQ(QList<Uuid>({dev3}), devices.values(cmp2));
+  EXPECT_FALSE(devices.contains(cmp3));
+
+  QHash<FilePath, Uuid> pkgUuids;
+  QHash<FilePath, Uuid> cmpUuids;
+  db().getDevicesMetadata(
+      {devFp2, devFp3, getLibraryPath("A").getPathTo("dev/missing")},
+      &pkgUuids, &cmpUuids);
+  EXPECT_EQ((QHash<FilePath, Uuid>{{devFp2, pkg2}, {devFp3, pkg1}}), pkgUuids);
+  EXPECT_EQ((QHash<FilePath, Uuid>{{devFp2, cmp1}, {devFp3, cmp2}}), cmpUuids);
+
+  // only existing packages are returned
+  QHash<Uuid, FilePath> pkgFps =
+      db().getLatestElements<library::Package>({pkg1, pkg2});
+  EXPECT_EQ((QHash<Uuid, FilePath>{{pkg1, pkgFp1}}), pkgFps);
+  EXPECT_EQ(devFp1, db().getLatestDevice(dev1));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testLatestElementsIndexIsUpdatedAfterRescan) {
+  createLibrary("A");
+  Uuid     uuid = Uuid::createRandom();
+  FilePath fpA  = addSymbol("A", uuid, "0.1", "Symbol");
+  scanLibraries();
+  EXPECT_EQ(fpA, db().getLatestSymbol(uuid));  // fills the index
+
+  // a newer version must be returned after the rescan
+  createLibrary("B");
+  FilePath fpB = addSymbol("B", uuid, "0.2", "Symbol");
+  EXPECT_EQ(fpA, db().getLatestSymbol(uuid));  // not scanned yet
+  scanLibraries();
+  EXPECT_EQ(fpB, db().getLatestSymbol(uuid));
+  EXPECT_EQ(fpB, db().getLatestElements<library::Symbol>({uuid}).value(uuid));
+
+  // removed elements must not be returned anymore after the rescan
+  ASSERT_TRUE(QDir(getLibraryPath("B").toStr()).removeRecursively());
+  scanLibraries();
+  EXPECT_EQ(fpA, db().getLatestSymbol(uuid));
+  EXPECT_EQ(fpA, db().getLatestElements<library::Symbol>({uuid}).value(uuid));
+  ASSERT_TRUE(QDir(getLibraryPath("A").toStr()).removeRecursively());
+  scanLibraries();
+  EXPECT_FALSE(db().getLatestSymbol(uuid).isValid());
+  EXPECT_TRUE(db().getLatestElements<library::Symbol>({uuid}).isEmpty());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testElementTranslationsAreUpdatedAfterRescan) {
+  createLibrary("A");
+  Uuid     uuid = Uuid::createRandom();
+  FilePath fp   = addSymbol("A", uuid, "0.1", "Old Name");
+  scanLibraries();
+
+  // fill the cache
+  QString name;
+  db().getElementTranslations<library::Symbol>(fp, {"en_US"}, &name);
+  EXPECT_EQ("Old Name", name.toStdString());
+  EXPECT_EQ("Old Name", db().getElementNames<library::Symbol>({fp}, {"en_US"})
+                            .value(fp)
+                            .toStdString());
+
+  // the modified name must be returned after the rescan
+  addSymbol("A", uuid, "0.1", "New Name");
+  scanLibraries();
+  db().getElementTranslations<library::Symbol>(fp, {"en_US"}, &name);
+  EXPECT_EQ("New Name", name.toStdString());
+  EXPECT_EQ("New Name", db().getElementNames<library::Symbol>({fp}, {"en_US"})
+                            .value(fp)
+                            .toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace workspace
+}  // namespace librepcb
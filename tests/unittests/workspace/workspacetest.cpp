@@ -24,6 +24,7 @@
 #include <librepcb/common/application.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/versionfile.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/workspace/workspace.h>
 
 #include <QtCore>
@@ -134,6 +135,31 @@ TEST_F(WorkspaceTest, testGetHighestFileFormatVersionOfWorkspace) {
             Workspace::getHighestFileFormatVersionOfWorkspace(mWsDir));
 }
 
+TEST_F(WorkspaceTest, testLibraryElementCacheIsSharedWhileReferenced) {
+  Workspace::createNewWorkspace(mWsDir);
+  Workspace ws(mWsDir);
+
+  std::weak_ptr<library::LibraryElementCache> released;
+  {
+    std::shared_ptr<library::LibraryElementCache> cache1 =
+        ws.getLibraryElementCache();
+    std::shared_ptr<library::LibraryElementCache> cache2 =
+        ws.getLibraryElementCache();
+    ASSERT_NE(nullptr, cache1);
+    EXPECT_EQ(cache1.get(), cache2.get());
+    EXPECT_EQ(2, cache1.use_count());  // the workspace holds no reference
+    EXPECT_EQ(1000, cache1->getMaxEntries());
+    released = cache1;
+  }
+
+  // the cache is destroyed with its last reference, and created again on demand
+  EXPECT_TRUE(released.expired());
+  std::shared_ptr<library::LibraryElementCache> cache =
+      ws.getLibraryElementCache();
+  ASSERT_NE(nullptr, cache);
+  EXPECT_EQ(0, cache->getEntryCount());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/